@@ -59,6 +59,11 @@ enum class distribution_id : int8_t {
               ///< simulating real-world numeric data.
   GEOMETRIC,  ///< Geometric sampling - highest chance to sample close to the lower bound. Good for
               ///< simulating real data with asymmetric distribution (unsigned values, timestamps).
+  ZIPF,       ///< Zipf sampling (exponent 1) - the i-th smallest value is sampled with probability
+              ///< proportional to 1/i. Models heavy-tailed key popularity, e.g. word frequencies
+              ///< or page views. Only supported for discrete (integral) values.
+  LOGNORMAL,  ///< Log-normal sampling - the logarithm of the samples is normally distributed.
+              ///< Models positively skewed data such as payload sizes or response times.
 };
 
 // Default distribution types for each type
@@ -18,6 +18,7 @@
 
 #include "generate_benchmark_input.hpp"
 
+#include <cmath>
 #include <memory>
 #include <random>
 
@@ -74,6 +75,72 @@ auto make_geometric_dist(T range_start, T range_end)
   return std::exponential_distribution<T>(geometric_dist_p(range_size));
 }
 
+/**
+ * @brief Bounded Zipf distribution with exponent 1.
+ *
+ * Samples from {0, ..., range_size} with the probability of the i-th smallest value proportional
+ * to 1/(i + 1), using Hormann's rejection-inversion method so no per-value state is needed even
+ * for huge ranges.
+ */
+template <typename T>
+class zipf_distribution {
+  double n;
+  double h_x1;
+  double h_n;
+  double s;
+
+  // Integral of the density 1/x; the inverse of this function maps uniform samples to values
+  static double h_integral(double x) { return std::log(x); }
+
+ public:
+  zipf_distribution(T range_size)
+    : n{std::max<double>(range_size, 1)},
+      h_x1{h_integral(1.5) - 1},
+      h_n{h_integral(n + 0.5)},
+      s{2 - std::exp(h_integral(2.5) - 0.5)}
+  {
+  }
+
+  template <typename Engine>
+  T operator()(Engine& engine)
+  {
+    std::uniform_real_distribution<double> uniform{0., 1.};
+    while (true) {
+      double const u = h_x1 + uniform(engine) * (h_n - h_x1);
+      double const x = std::exp(u);
+      double const k = std::max(1., std::min(n, std::floor(x + 0.5)));
+      if (k - x <= s or u >= h_integral(k + 0.5) - 1. / k) { return static_cast<T>(k - 1); }
+    }
+  }
+};
+
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value, T>* = nullptr>
+auto make_zipf_dist(T range_start, T range_end)
+{
+  using uT = typename std::make_unsigned<T>::type;
+  if (range_start > range_end) std::swap(range_start, range_end);
+  return zipf_distribution<uT>((uT)range_end - (uT)range_start);
+}
+
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value, T>* = nullptr>
+auto make_lognormal_dist(T range_start, T range_end)
+{
+  using uT            = typename std::make_unsigned<T>::type;
+  uT const range_size = range_end - range_start;
+  // Median at the geometric center of the range; +/- three sigmas covers the range
+  double const mean = std::log(std::max<double>(range_size, 1)) / 2;
+  return std::lognormal_distribution<double>(mean, mean / 3);
+}
+
+template <typename T, std::enable_if_t<cudf::is_floating_point<T>()>* = nullptr>
+auto make_lognormal_dist(T range_start, T range_end)
+{
+  T const range_size = range_end - range_start;
+  // Median at the geometric center of the range; +/- three sigmas covers the range
+  T const mean = std::log(std::max<T>(range_size, 1)) / 2;
+  return std::lognormal_distribution<T>(mean, mean / 3);
+}
+
 template <typename T>
 using distribution_fn = std::function<T(std::mt19937&)>;
 
@@ -95,6 +162,21 @@ distribution_fn<T> make_distribution(distribution_id did, T lower_bound, T upper
         else
           return lower_bound - dist(engine) + lower_bound;
       };
+    case distribution_id::ZIPF:
+      return [lower_bound, upper_bound, dist = make_zipf_dist(lower_bound, upper_bound)](
+               std::mt19937& engine) mutable -> T {
+        if (lower_bound <= upper_bound)
+          return lower_bound + dist(engine);
+        else
+          return lower_bound - dist(engine);
+      };
+    case distribution_id::LOGNORMAL:
+      return [lower_bound, upper_bound, dist = make_lognormal_dist(lower_bound, upper_bound)](
+               std::mt19937& engine) mutable -> T {
+        using uT            = typename std::make_unsigned<T>::type;
+        uT const range_size = (uT)upper_bound - (uT)lower_bound;
+        return lower_bound + static_cast<T>(std::min<double>(dist(engine), range_size));
+      };
     default: CUDF_FAIL("Unsupported probability distribution");
   }
 }
@@ -117,6 +199,11 @@ distribution_fn<T> make_distribution(distribution_id dist_id, T lower_bound, T u
         else
           return lower_bound - dist(engine);
       };
+    case distribution_id::LOGNORMAL:
+      return [lower_bound, upper_bound, dist = make_lognormal_dist(lower_bound, upper_bound)](
+               std::mt19937& engine) mutable -> T {
+        return lower_bound + std::min(dist(engine), upper_bound - lower_bound);
+      };
     default: CUDF_FAIL("Unsupported random distribution");
   }
 }
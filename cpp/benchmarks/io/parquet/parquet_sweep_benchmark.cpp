@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/parquet.hpp>
+
+// Sweeps of the data properties that drive Parquet performance in realistic
+// schemas: null density, string cardinality, and nesting depth, each crossed
+// with the compression codec, for both the reader and the writer. Throughput
+// is reported as bytes/second of the in-memory table representation.
+//
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr size_t data_size = 512 << 20;
+
+namespace cudf_io = cudf::io;
+
+class ParquetWriteSweep : public cudf::benchmark {
+};
+class ParquetReadSweep : public cudf::benchmark {
+};
+
+namespace {
+
+/**
+ * @brief Builds the table described by the benchmark arguments.
+ *
+ * Argument layout, shared by the read and write benchmarks:
+ * 0: sweep dimension value (meaning depends on the benchmark)
+ * 1: compression codec (enabled = SNAPPY)
+ */
+std::unique_ptr<cudf::table> create_nulls_table(benchmark::State& state)
+{
+  data_profile profile;
+  profile.set_null_frequency(state.range(0) / 100.0);
+  auto const data_types = get_type_or_group({int32_t(type_group_id::INTEGRAL_SIGNED),
+                                             int32_t(type_group_id::FLOATING_POINT),
+                                             int32_t(cudf::type_id::STRING)});
+  return create_random_table(data_types, data_types.size(), table_size_bytes{data_size}, profile);
+}
+
+std::unique_ptr<cudf::table> create_strings_table(benchmark::State& state)
+{
+  data_profile profile;
+  profile.set_cardinality(state.range(0));
+  return create_random_table(
+    {cudf::type_id::STRING}, 8, table_size_bytes{data_size}, profile);
+}
+
+std::unique_ptr<cudf::table> create_nested_table(benchmark::State& state)
+{
+  data_profile profile;
+  profile.set_list_depth(state.range(0));
+  profile.set_list_type(cudf::type_id::INT32);
+  return create_random_table(
+    {cudf::type_id::LIST}, 8, table_size_bytes{data_size}, profile);
+}
+
+cudf_io::compression_type compression_arg(benchmark::State& state)
+{
+  return state.range(1) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
+}
+
+void parq_write_sweep(benchmark::State& state, std::unique_ptr<cudf::table> const& tbl)
+{
+  auto const view       = tbl->view();
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  cuio_source_sink_pair source_sink(io_type::HOST_BUFFER);
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::parquet_writer_options opts =
+      cudf_io::parquet_writer_options::builder(source_sink.make_sink_info(), view)
+        .compression(compression_arg(state));
+    cudf_io::write_parquet(opts);
+  }
+
+  state.SetBytesProcessed(data_size * state.iterations());
+  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+}
+
+void parq_read_sweep(benchmark::State& state, std::unique_ptr<cudf::table> const& tbl)
+{
+  auto const view = tbl->view();
+
+  cuio_source_sink_pair source_sink(io_type::HOST_BUFFER);
+  cudf_io::parquet_writer_options write_opts =
+    cudf_io::parquet_writer_options::builder(source_sink.make_sink_info(), view)
+      .compression(compression_arg(state));
+  cudf_io::write_parquet(write_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(source_sink.make_source_info());
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  for (auto _ : state) {
+    cuda_event_timer const raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_parquet(read_opts);
+  }
+
+  state.SetBytesProcessed(data_size * state.iterations());
+  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+}
+
+}  // namespace
+
+#define PARQ_SWEEP_BENCHMARK_DEFINE(fixture, name, benchmark_fn, table_fn, dimension_values) \
+  BENCHMARK_DEFINE_F(fixture, name)                                                          \
+  (::benchmark::State & state)                                                               \
+  {                                                                                          \
+    auto const tbl = table_fn(state);                                                        \
+    benchmark_fn(state, tbl);                                                                \
+  }                                                                                          \
+  BENCHMARK_REGISTER_F(fixture, name)                                                        \
+    ->ArgsProduct({dimension_values, {false, true}})                                         \
+    ->Unit(benchmark::kMillisecond)                                                          \
+    ->UseManualTime();
+
+#define PARQ_SWEEP_NULL_FRACTIONS \
+  {                               \
+    0, 1, 10, 50, 90              \
+  }
+#define PARQ_SWEEP_CARDINALITIES \
+  {                              \
+    0, 32, 1000, 100000          \
+  }
+#define PARQ_SWEEP_LIST_DEPTHS \
+  {                            \
+    1, 2, 4                    \
+  }
+
+PARQ_SWEEP_BENCHMARK_DEFINE(
+  ParquetWriteSweep, null_density, parq_write_sweep, create_nulls_table, PARQ_SWEEP_NULL_FRACTIONS);
+PARQ_SWEEP_BENCHMARK_DEFINE(
+  ParquetReadSweep, null_density, parq_read_sweep, create_nulls_table, PARQ_SWEEP_NULL_FRACTIONS);
+
+PARQ_SWEEP_BENCHMARK_DEFINE(ParquetWriteSweep,
+                            string_cardinality,
+                            parq_write_sweep,
+                            create_strings_table,
+                            PARQ_SWEEP_CARDINALITIES);
+PARQ_SWEEP_BENCHMARK_DEFINE(ParquetReadSweep,
+                            string_cardinality,
+                            parq_read_sweep,
+                            create_strings_table,
+                            PARQ_SWEEP_CARDINALITIES);
+
+PARQ_SWEEP_BENCHMARK_DEFINE(ParquetWriteSweep,
+                            nesting_depth,
+                            parq_write_sweep,
+                            create_nested_table,
+                            PARQ_SWEEP_LIST_DEPTHS);
+PARQ_SWEEP_BENCHMARK_DEFINE(
+  ParquetReadSweep, nesting_depth, parq_read_sweep, create_nested_table, PARQ_SWEEP_LIST_DEPTHS);
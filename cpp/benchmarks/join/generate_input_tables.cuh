@@ -60,6 +60,21 @@ __global__ static void init_build_tbl(key_type* const build_tbl,
   state[start_idx] = localState;
 }
 
+/**
+ * Samples a key rank in [0, num_keys) from a Zipf-like distribution with the
+ * given exponent, using the inverse of the continuous approximation of the
+ * Zipf CDF. An exponent of 1 is handled separately as the integral changes
+ * form there.
+ */
+__device__ inline double zipf_rank(double u, double num_keys, double exponent)
+{
+  double const rank =
+    (exponent == 1.0)
+      ? pow(num_keys, u)
+      : pow(1.0 - u * (1.0 - pow(num_keys, 1.0 - exponent)), 1.0 / (1.0 - exponent));
+  return min(rank - 1.0, num_keys - 1.0);
+}
+
 template <typename key_type, typename size_type>
 __global__ void init_probe_tbl(key_type* const probe_tbl,
                                const size_type probe_tbl_size,
@@ -67,6 +82,7 @@ __global__ void init_probe_tbl(key_type* const probe_tbl,
                                const key_type rand_max,
                                const double selectivity,
                                const int multiplicity,
+                               const double zipf_exponent,
                                curandState* state,
                                const int num_states)
 {
@@ -83,8 +99,13 @@ __global__ void init_probe_tbl(key_type* const probe_tbl,
     if (x <= selectivity) {
       // x <= selectivity means this key in the probe table should be present in the build table, so
       // we pick a key from [0, build_tbl_size / multiplicity]
-      x   = curand_uniform_double(&localState);
-      val = static_cast<key_type>(x * (build_tbl_size / multiplicity));
+      x = curand_uniform_double(&localState);
+      if (zipf_exponent > 0.0) {
+        val = static_cast<key_type>(
+          zipf_rank(x, static_cast<double>(build_tbl_size / multiplicity), zipf_exponent));
+      } else {
+        val = static_cast<key_type>(x * (build_tbl_size / multiplicity));
+      }
     } else {
       // This key in the probe table should not be present in the build table, so we pick a key from
       // [build_tbl_size, rand_max].
@@ -120,6 +141,10 @@ __global__ void init_probe_tbl(key_type* const probe_tbl,
  * @param[in] selectivity           probability with which an element of the probe table is
  *                                  present in the build table.
  * @param[in] multiplicity          number of matches for each key.
+ * @param[in] zipf_exponent         skew of the matching probe keys. 0 (the default) draws
+ *                                  matching keys uniformly; larger values concentrate the
+ *                                  probes on ever fewer hot build keys, following a Zipf
+ *                                  distribution with this exponent.
  */
 template <typename key_type, typename size_type>
 void generate_input_tables(key_type* const build_tbl,
@@ -127,7 +152,8 @@ void generate_input_tables(key_type* const build_tbl,
                            key_type* const probe_tbl,
                            const size_type probe_tbl_size,
                            const double selectivity,
-                           const int multiplicity)
+                           const int multiplicity,
+                           const double zipf_exponent = 0.0)
 {
   // With large values of rand_max the a lot of temporary storage is needed for the lottery. At the
   // expense of not being that accurate with applying the selectivity an especially more memory
@@ -174,6 +200,7 @@ void generate_input_tables(key_type* const build_tbl,
                                                           rand_max,
                                                           selectivity,
                                                           multiplicity,
+                                                          zipf_exponent,
                                                           devStates.data(),
                                                           num_states);
 
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/join/join_benchmark_common.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+
+#include <numeric>
+
+// Sweeps of the data properties that drive join performance beyond table
+// sizes: key skew (Zipf exponent of the matching probe keys), match
+// selectivity, null fraction, and key representation (numeric, string and
+// multi-column keys), for hash, semi and conditional joins. The uniform-key
+// benchmarks in join_benchmark.cu cover the size dimension; this suite holds
+// the sizes fixed and sweeps the data shape instead.
+
+template <typename key_type, typename payload_type>
+class JoinSuite : public cudf::benchmark {
+};
+
+namespace {
+
+enum class join_algorithm { INNER_HASH, LEFT_SEMI, CONDITIONAL_INNER };
+
+enum class key_kind {
+  NUMERIC,       // join on the generated integer key column directly
+  STRING,        // join on the decimal string representation of the keys
+  MULTI_COLUMN   // join on two columns that together identify the key
+};
+
+/**
+ * @brief Benchmarks a join while sweeping the shape of the key data.
+ *
+ * Argument layout:
+ * 0: build table size
+ * 1: probe table size
+ * 2: match selectivity in basis points (1 = 0.01%, 10'000 = 100%)
+ * 3: Zipf exponent of the matching probe keys, in hundredths (0 = uniform)
+ * 4: null fraction of the key columns, in percent
+ *
+ * The sweep values are scaled integers so that they appear unscaled in the
+ * benchmark name.
+ */
+template <typename key_type, typename payload_type>
+void BM_join_suite(benchmark::State& state, join_algorithm algorithm, key_kind keys)
+{
+  auto const build_table_size   = static_cast<cudf::size_type>(state.range(0));
+  auto const probe_table_size   = static_cast<cudf::size_type>(state.range(1));
+  double const selectivity      = state.range(2) / 10'000.0;
+  double const zipf_exponent    = state.range(3) / 100.0;
+  double const null_probability = state.range(4) / 100.0;
+  int const multiplicity        = 1;
+
+  // Generate the integer key columns every key representation derives from
+  cudf::test::UniformRandomGenerator<int> rand_gen(0, 99);
+  auto random_null_mask = [&](cudf::size_type size) {
+    auto validity = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(0),
+      [&](auto i) { return rand_gen.generate() >= null_probability * 100; });
+    return cudf::test::detail::make_null_mask(validity, validity + size);
+  };
+
+  auto const key_dtype = cudf::data_type(cudf::type_to_id<key_type>());
+  auto make_key_column = [&](cudf::size_type size) {
+    return null_probability > 0 ? cudf::make_numeric_column(key_dtype, size, random_null_mask(size))
+                                : cudf::make_numeric_column(key_dtype, size);
+  };
+  std::unique_ptr<cudf::column> build_key_column = make_key_column(build_table_size);
+  std::unique_ptr<cudf::column> probe_key_column = make_key_column(probe_table_size);
+
+  generate_input_tables<key_type, cudf::size_type>(
+    build_key_column->mutable_view().template data<key_type>(),
+    build_table_size,
+    probe_key_column->mutable_view().template data<key_type>(),
+    probe_table_size,
+    selectivity,
+    multiplicity,
+    zipf_exponent);
+
+  // Derive the benchmarked key representation from the generated keys. A key
+  // always maps to the same derived key(s) on both sides, so the requested
+  // selectivity carries over, and null masks propagate through the conversions.
+  auto derive_key_columns = [&](cudf::column_view const& key_column) {
+    std::vector<std::unique_ptr<cudf::column>> derived;
+    if (keys == key_kind::STRING) {
+      derived.push_back(cudf::strings::from_integers(key_column));
+    } else if (keys == key_kind::MULTI_COLUMN) {
+      // Split each key into a high and a low part; equality of the pair is
+      // equivalent to equality of the original key.
+      auto const divisor = cudf::numeric_scalar<key_type>(1 << 10);
+      derived.push_back(
+        cudf::binary_operation(key_column, divisor, cudf::binary_operator::DIV, key_dtype));
+      derived.push_back(
+        cudf::binary_operation(key_column, divisor, cudf::binary_operator::MOD, key_dtype));
+    }
+    return derived;
+  };
+  auto const build_derived_keys = derive_key_columns(build_key_column->view());
+  auto const probe_derived_keys = derive_key_columns(probe_key_column->view());
+
+  auto payload_data_it = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<payload_type> build_payload_column(
+    payload_data_it, payload_data_it + build_table_size);
+  cudf::test::fixed_width_column_wrapper<payload_type> probe_payload_column(
+    payload_data_it, payload_data_it + probe_table_size);
+
+  auto make_input_table = [](std::vector<std::unique_ptr<cudf::column>> const& derived_keys,
+                             cudf::column_view const& key_column,
+                             cudf::column_view const& payload_column) {
+    std::vector<cudf::column_view> columns;
+    if (derived_keys.empty()) {
+      columns.push_back(key_column);
+    } else {
+      for (auto const& key : derived_keys) { columns.push_back(key->view()); }
+    }
+    columns.push_back(payload_column);
+    return cudf::table_view(columns);
+  };
+  cudf::table_view build_table =
+    make_input_table(build_derived_keys, build_key_column->view(), build_payload_column);
+  cudf::table_view probe_table =
+    make_input_table(probe_derived_keys, probe_key_column->view(), probe_payload_column);
+
+  std::vector<cudf::size_type> columns_to_join(std::max(build_derived_keys.size(), size_t{1}));
+  std::iota(columns_to_join.begin(), columns_to_join.end(), 0);
+
+  CHECK_CUDA(0);
+
+  switch (algorithm) {
+    case join_algorithm::INNER_HASH:
+      for (auto _ : state) {
+        cuda_event_timer raii(state, true, rmm::cuda_stream_default);
+        auto result = cudf::inner_join(
+          probe_table, build_table, columns_to_join, columns_to_join, cudf::null_equality::UNEQUAL);
+      }
+      break;
+    case join_algorithm::LEFT_SEMI:
+      for (auto _ : state) {
+        cuda_event_timer raii(state, true, rmm::cuda_stream_default);
+        auto result = cudf::left_semi_join(
+          probe_table, build_table, columns_to_join, columns_to_join, cudf::null_equality::UNEQUAL);
+      }
+      break;
+    case join_algorithm::CONDITIONAL_INNER: {
+      auto const col_ref_left_0 = cudf::ast::column_reference(0);
+      auto const col_ref_right_0 =
+        cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+      auto left_zero_eq_right_zero =
+        cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_left_0, col_ref_right_0);
+      for (auto _ : state) {
+        cuda_event_timer raii(state, true, rmm::cuda_stream_default);
+        auto result = cudf::conditional_inner_join(probe_table, build_table, left_zero_eq_right_zero);
+      }
+      break;
+    }
+  }
+}
+
+}  // namespace
+
+#define JOIN_SUITE_BENCHMARK_DEFINE(name, key_type, payload_type, algorithm, keys) \
+  BENCHMARK_TEMPLATE_DEFINE_F(JoinSuite, name, key_type, payload_type)             \
+  (::benchmark::State & st)                                                        \
+  {                                                                                \
+    BM_join_suite<key_type, payload_type>(st, algorithm, keys);                    \
+  }
+
+JOIN_SUITE_BENCHMARK_DEFINE(
+  inner_join_32bit, int32_t, int32_t, join_algorithm::INNER_HASH, key_kind::NUMERIC);
+JOIN_SUITE_BENCHMARK_DEFINE(
+  inner_join_64bit, int64_t, int64_t, join_algorithm::INNER_HASH, key_kind::NUMERIC);
+JOIN_SUITE_BENCHMARK_DEFINE(
+  inner_join_string, int32_t, int32_t, join_algorithm::INNER_HASH, key_kind::STRING);
+JOIN_SUITE_BENCHMARK_DEFINE(
+  inner_join_multicol, int32_t, int32_t, join_algorithm::INNER_HASH, key_kind::MULTI_COLUMN);
+JOIN_SUITE_BENCHMARK_DEFINE(
+  left_semi_join_32bit, int32_t, int32_t, join_algorithm::LEFT_SEMI, key_kind::NUMERIC);
+JOIN_SUITE_BENCHMARK_DEFINE(
+  left_semi_join_string, int32_t, int32_t, join_algorithm::LEFT_SEMI, key_kind::STRING);
+JOIN_SUITE_BENCHMARK_DEFINE(
+  conditional_inner_join_32bit, int32_t, int32_t, join_algorithm::CONDITIONAL_INNER, key_kind::NUMERIC);
+
+// Sweep values: selectivity in basis points, Zipf exponent in hundredths, null
+// fraction in percent; each sweep varies one axis and pins the other two at
+// the defaults of join_benchmark.cu (30% selectivity, uniform keys, no nulls).
+#define JOIN_SUITE_SELECTIVITY_SWEEP(build_size, probe_size)    \
+  ->ArgsProduct({{build_size}, {probe_size}, {1, 100, 3'000, 10'000}, {0}, {0}})
+#define JOIN_SUITE_SKEW_SWEEP(build_size, probe_size)           \
+  ->ArgsProduct({{build_size}, {probe_size}, {3'000}, {50, 100, 150}, {0}})
+#define JOIN_SUITE_NULLS_SWEEP(build_size, probe_size)          \
+  ->ArgsProduct({{build_size}, {probe_size}, {3'000}, {0}, {10, 50, 90}})
+
+#define JOIN_SUITE_BENCHMARK_REGISTER(name, build_size, probe_size) \
+  BENCHMARK_REGISTER_F(JoinSuite, name)                             \
+    ->Unit(benchmark::kMillisecond)                                 \
+    JOIN_SUITE_SELECTIVITY_SWEEP(build_size, probe_size)            \
+    JOIN_SUITE_SKEW_SWEEP(build_size, probe_size)                   \
+    JOIN_SUITE_NULLS_SWEEP(build_size, probe_size)                  \
+    ->UseManualTime();
+
+JOIN_SUITE_BENCHMARK_REGISTER(inner_join_32bit, 10'000'000, 40'000'000);
+JOIN_SUITE_BENCHMARK_REGISTER(inner_join_64bit, 10'000'000, 40'000'000);
+JOIN_SUITE_BENCHMARK_REGISTER(inner_join_string, 1'000'000, 4'000'000);
+JOIN_SUITE_BENCHMARK_REGISTER(inner_join_multicol, 10'000'000, 40'000'000);
+JOIN_SUITE_BENCHMARK_REGISTER(left_semi_join_32bit, 10'000'000, 40'000'000);
+JOIN_SUITE_BENCHMARK_REGISTER(left_semi_join_string, 1'000'000, 4'000'000);
+// The conditional join is quadratic in the input sizes; keep them small.
+JOIN_SUITE_BENCHMARK_REGISTER(conditional_inner_join_32bit, 100'000, 400'000);
@@ -51,8 +51,10 @@ function(jit_preprocess_files)
 endfunction()
 
 jit_preprocess_files(
-  SOURCE_DIRECTORY ${CUDF_SOURCE_DIR}/src FILES binaryop/jit/kernel.cu
-  transform/jit/masked_udf_kernel.cu transform/jit/kernel.cu rolling/jit/kernel.cu
+  SOURCE_DIRECTORY ${CUDF_SOURCE_DIR}/src FILES binaryop/jit/kernel.cu join/jit/kernel.cu
+  transform/jit/masked_udf_kernel.cu transform/jit/kernel.cu
+  transform/jit/multi_transform_kernel.cu
+  transform/jit/row_expression_kernel.cu rolling/jit/kernel.cu groupby/sort/jit/kernel.cu
 )
 
 add_custom_target(
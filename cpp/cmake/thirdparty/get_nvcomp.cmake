@@ -20,7 +20,7 @@ function(find_and_configure_nvcomp VERSION)
     nvcomp ${VERSION}
     GLOBAL_TARGETS nvcomp::nvcomp
     CPM_ARGS GITHUB_REPOSITORY NVIDIA/nvcomp
-    GIT_TAG c435afaf4ba8a8d12f379d688effcb185886cec1
+    GIT_TAG v${VERSION}
     OPTIONS "BUILD_STATIC ON" "BUILD_TESTS OFF" "BUILD_BENCHMARKS OFF" "BUILD_EXAMPLES OFF"
   )
 
@@ -35,6 +35,7 @@ function(find_and_configure_nvcomp VERSION)
 
 endfunction()
 
-set(CUDF_MIN_VERSION_nvCOMP 2.1.0)
+# Zstandard decompression requires the batched zstd API introduced in nvCOMP 2.3
+set(CUDF_MIN_VERSION_nvCOMP 2.3.0)
 
 find_and_configure_nvcomp(${CUDF_MIN_VERSION_nvCOMP})
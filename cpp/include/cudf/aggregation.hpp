@@ -75,10 +75,12 @@ class aggregation {
     ARGMAX,          ///< Index of max element
     ARGMIN,          ///< Index of min element
     NUNIQUE,         ///< count number of unique elements
+    APPROX_NUNIQUE,  ///< approximate count of unique elements via HyperLogLog
     NTH_ELEMENT,     ///< get the nth element
     ROW_NUMBER,      ///< get row-number of current index (relative to rolling window)
     RANK,            ///< get rank       of current index
     DENSE_RANK,      ///< get dense rank of current index
+    PERCENT_RANK,    ///< get percent (i.e. fractional) rank of current index
     COLLECT_LIST,    ///< collect values into a list
     COLLECT_SET,     ///< collect values into a list without duplicate entries
     LEAD,            ///< window function, accesses row at specified offset following current row
@@ -265,6 +267,22 @@ std::unique_ptr<Base> make_argmin_aggregation();
 template <typename Base = aggregation>
 std::unique_ptr<Base> make_nunique_aggregation(null_policy null_handling = null_policy::EXCLUDE);
 
+/**
+ * @brief Factory to create an `approx_nunique` aggregation
+ *
+ * `approx_nunique` returns an estimate of the number of unique elements computed
+ * with a HyperLogLog sketch of `2^precision` registers. The estimate is within a
+ * relative error of roughly `1.04 / sqrt(2^precision)` of the exact count with
+ * high probability, while using constant memory per group regardless of
+ * cardinality. The default precision of 11 yields a typical error of ~2.3%.
+ *
+ * @param null_handling Indicates if null values will be counted.
+ * @param precision Number of index bits in the sketch, in `[4, 18]`.
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_approx_nunique_aggregation(
+  null_policy null_handling = null_policy::EXCLUDE, size_type precision = 11);
+
 /**
  * @brief Factory to create a `nth_element` aggregation
  *
@@ -390,6 +408,36 @@ std::unique_ptr<Base> make_rank_aggregation();
 template <typename Base = aggregation>
 std::unique_ptr<Base> make_dense_rank_aggregation();
 
+/**
+ * @brief Factory to create a PERCENT_RANK aggregation
+ *
+ * `PERCENT_RANK` returns a non-nullable column of double "percent ranks": the `RANK` of the
+ * current row minus one, divided by the number of rows in the group (or column, for ungrouped
+ * scans) minus one. Results therefore lie in `[0, 1]`; a group with a single row ranks as `0`.
+ *
+ * This aggregation only works with "scan" algorithms. The input column into the group or
+ * ungrouped scan is an orderby column that orders the rows that the aggregate function ranks.
+ * If rows are ordered by more than one column, the orderby input column should be a struct
+ * column containing the ordering columns.
+ *
+ * Note:
+ *  1. This method requires that the rows are presorted by the group keys and order_by columns.
+ *  2. `PERCENT_RANK` aggregations will return a fully valid column regardless of null_handling
+ *     policy specified in the scan.
+ *  3. `PERCENT_RANK` aggregations are not compatible with exclusive scans.
+ *
+ * @code{.pseudo}
+ * Example: For the presorted motor-racing dataset described on `make_rank_aggregation`:
+ *
+ * A grouped percent rank aggregation scan with:
+ *   groupby column      : driver_name
+ *   input orderby column: num_overtakes
+ *  result: column<double>{0.0, 0.0, 0.0, 0.75, 0.75, 0.0, 0.0, 0.667, 1.0}
+ * @endcode
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_percent_rank_aggregation();
+
 /**
  * @brief Factory to create a COLLECT_LIST aggregation
  *
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -123,6 +124,15 @@ CUDA_HOST_DEVICE_CALLABLE constexpr void ast_operator_dispatcher(ast_operator op
     case ast_operator::NULL_LOGICAL_OR:
       f.template operator()<ast_operator::NULL_LOGICAL_OR>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::CONTAINS:
+      f.template operator()<ast_operator::CONTAINS>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::STARTS_WITH:
+      f.template operator()<ast_operator::STARTS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::ENDS_WITH:
+      f.template operator()<ast_operator::ENDS_WITH>(std::forward<Ts>(args)...);
+      break;
     case ast_operator::IDENTITY:
       f.template operator()<ast_operator::IDENTITY>(std::forward<Ts>(args)...);
       break;
@@ -529,6 +539,40 @@ struct operator_functor<ast_operator::NULL_LOGICAL_OR, false>
   : public operator_functor<ast_operator::LOGICAL_OR, false> {
 };
 
+// The string operators match the semantics of cudf::strings::contains, starts_with, and
+// ends_with: an empty right-hand side matches every non-null left-hand side.
+template <>
+struct operator_functor<ast_operator::CONTAINS, false> {
+  static constexpr auto arity{2};
+
+  CUDA_DEVICE_CALLABLE bool operator()(cudf::string_view lhs, cudf::string_view rhs)
+  {
+    return rhs.empty() || (lhs.find(rhs) >= 0);
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::STARTS_WITH, false> {
+  static constexpr auto arity{2};
+
+  CUDA_DEVICE_CALLABLE bool operator()(cudf::string_view lhs, cudf::string_view rhs)
+  {
+    return (rhs.size_bytes() <= lhs.size_bytes()) &&
+           (rhs.compare(lhs.data(), rhs.size_bytes()) == 0);
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::ENDS_WITH, false> {
+  static constexpr auto arity{2};
+
+  CUDA_DEVICE_CALLABLE bool operator()(cudf::string_view lhs, cudf::string_view rhs)
+  {
+    return (rhs.size_bytes() <= lhs.size_bytes()) &&
+           (rhs.compare(lhs.data() + lhs.size_bytes() - rhs.size_bytes(), rhs.size_bytes()) == 0);
+  }
+};
+
 template <>
 struct operator_functor<ast_operator::IDENTITY, false> {
   static constexpr auto arity{1};
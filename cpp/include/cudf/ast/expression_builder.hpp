@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace ast {
+
+/**
+ * @brief Builds a deferred expression graph that is evaluated in one fused pass.
+ *
+ * Applying binary operations one at a time (e.g. via `cudf::binary_operation`)
+ * allocates and writes an intermediate column for every operator. This builder
+ * instead records the operations as an expression graph; nothing is evaluated
+ * until `materialize()`, which hands the whole graph to `cudf::compute_column`
+ * so all operators run in a single kernel with no intermediate columns.
+ *
+ * Unlike building `ast::operation` nodes by hand, the builder owns every node
+ * it creates, so callers do not need to keep intermediate expression objects
+ * alive themselves:
+ *
+ * @code{.cpp}
+ * auto builder = cudf::ast::expression_builder(table);
+ * auto const& a = builder.column(0);
+ * auto const& b = builder.column(1);
+ * auto const& c = builder.column(2);
+ * auto const& result = builder.add(builder.mul(a, b), c);  // a * b + c
+ * auto output = builder.materialize(result);  // single fused kernel
+ * @endcode
+ *
+ * The referenced table must remain valid until after `materialize()` returns.
+ */
+class expression_builder {
+ public:
+  /**
+   * @brief Construct a new expression builder for the given table.
+   *
+   * @param table The table that column references and `materialize()` evaluate against.
+   */
+  explicit expression_builder(table_view const& table) : _table(table) {}
+
+  /**
+   * @brief Creates a reference to a column of the table.
+   *
+   * @param column_index Index of the column in the table
+   * @return The new column reference node, owned by this builder
+   */
+  expression const& column(cudf::size_type column_index);
+
+  /**
+   * @brief Records an operation node for the given operator and operands.
+   *
+   * @param op A unary operator
+   * @param input The operand expression
+   * @return The new operation node, owned by this builder
+   */
+  expression const& make_operation(ast_operator op, expression const& input);
+
+  /**
+   * @brief Records an operation node for the given operator and operands.
+   *
+   * @param op A binary operator
+   * @param left The left operand expression
+   * @param right The right operand expression
+   * @return The new operation node, owned by this builder
+   */
+  expression const& make_operation(ast_operator op,
+                                   expression const& left,
+                                   expression const& right);
+
+  /// @brief Records `left + right`.
+  expression const& add(expression const& left, expression const& right)
+  {
+    return make_operation(ast_operator::ADD, left, right);
+  }
+
+  /// @brief Records `left - right`.
+  expression const& sub(expression const& left, expression const& right)
+  {
+    return make_operation(ast_operator::SUB, left, right);
+  }
+
+  /// @brief Records `left * right`.
+  expression const& mul(expression const& left, expression const& right)
+  {
+    return make_operation(ast_operator::MUL, left, right);
+  }
+
+  /// @brief Records `left / right`.
+  expression const& div(expression const& left, expression const& right)
+  {
+    return make_operation(ast_operator::DIV, left, right);
+  }
+
+  /**
+   * @brief Evaluates the recorded graph rooted at `root` in a single fused pass.
+   *
+   * @param root The expression to evaluate; typically the value returned by the
+   * last builder call
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return Column of the evaluated results
+   */
+  std::unique_ptr<cudf::column> materialize(
+    expression const& root,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  table_view _table;
+  std::vector<std::unique_ptr<expression>> _nodes;
+};
+
+}  // namespace ast
+}  // namespace cudf
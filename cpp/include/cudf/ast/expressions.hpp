@@ -87,6 +87,9 @@ enum class ast_operator {
                      ///< NULL_LOGICAL_OR(null, true) is true,
                      ///< NULL_LOGICAL_OR(null, false) is null, and NULL_LOGICAL_OR(valid, valid) ==
                      ///< LOGICAL_OR(valid, valid)
+  CONTAINS,          ///< true if lhs contains rhs as a substring; strings only
+  STARTS_WITH,       ///< true if lhs starts with rhs; strings only
+  ENDS_WITH,         ///< true if lhs ends with rhs; strings only
   // Unary operators
   IDENTITY,        ///< Identity function
   SIN,             ///< Trigonometric sine
@@ -182,6 +185,13 @@ class literal : public expression {
    */
   cudf::detail::fixed_width_scalar_device_view_base get_value() const { return value; }
 
+  /**
+   * @brief Get the underlying scalar for host-side inspection of the literal.
+   *
+   * @return cudf::scalar
+   */
+  cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @brief Accepts a visitor class.
    *
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+
+namespace cudf {
+
+/**
+ * @addtogroup column_factories
+ * @{
+ * @file
+ * @brief Broadcast (constant) column representation
+ */
+
+/**
+ * @brief A column whose rows are all equal to a single scalar, represented as
+ * the scalar plus a row count.
+ *
+ * Literal columns — a partitioning date or a constant fill repeated across
+ * every row of a batch — carry one value's worth of information, yet
+ * `make_column_from_scalar` materializes them in full. A `broadcast_column`
+ * keeps the value symbolic: operations that can preserve the constant (gather,
+ * resizing, concatenation of equal constants, binary operations between two
+ * constants) cost nothing, and the column is only materialized at a true sink
+ * via `materialize()`.
+ *
+ * The scalar is shared between broadcasts derived from one another, so
+ * `with_size` and `gather` allocate no device memory. An invalid scalar
+ * broadcasts to an all-null column, matching `make_column_from_scalar`.
+ */
+class broadcast_column {
+ public:
+  /**
+   * @brief Creates a broadcast column of `size` copies of `value`.
+   *
+   * @throws cudf::logic_error if `value` is null or `size` is negative
+   *
+   * @param value The value of every row; ownership is taken
+   * @param size The number of rows the column represents
+   */
+  broadcast_column(std::unique_ptr<scalar> value, size_type size);
+
+  /**
+   * @brief Returns the scalar every row is equal to.
+   */
+  scalar const& value() const;
+
+  /**
+   * @brief Returns the number of rows the column represents.
+   */
+  size_type size() const;
+
+  /**
+   * @brief Returns the type of the represented column.
+   */
+  data_type type() const;
+
+  /**
+   * @brief Returns a broadcast of the same value with a different row count,
+   * sharing the scalar with `*this`.
+   *
+   * Covers slicing and repetition of a constant column without touching device
+   * memory.
+   *
+   * @throws cudf::logic_error if `size` is negative
+   *
+   * @param size The number of rows of the returned broadcast
+   */
+  broadcast_column with_size(size_type size) const;
+
+  /**
+   * @brief Materializes the represented column.
+   *
+   * This is the sink path: writers and any operation without a broadcast
+   * overload consume the result. Equivalent to `make_column_from_scalar`.
+   *
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A column of `size()` copies of `value()`
+   */
+  std::unique_ptr<column> materialize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  broadcast_column(std::shared_ptr<scalar const> value, size_type size);
+
+  std::shared_ptr<scalar const> _value;
+  size_type _size;
+};
+
+/**
+ * @brief Gathers from a broadcast column.
+ *
+ * Every row of a broadcast column holds the same value, so the result is
+ * another broadcast of the same scalar sized to the gather map — no device
+ * work is performed and the map's values are never read. Out-of-bounds
+ * indices are therefore not detected; callers needing `NULLIFY` semantics
+ * must materialize first.
+ *
+ * @throws cudf::logic_error if `gather_map` is not a non-nullable index column
+ *
+ * @param input The broadcast column to gather from
+ * @param gather_map The column of indices to gather
+ * @return A broadcast column with one row per gather map entry
+ */
+broadcast_column gather(broadcast_column const& input, column_view const& gather_map);
+
+/**
+ * @brief Concatenates broadcast columns.
+ *
+ * Adjacent parts sharing one scalar — the common case of a constant flowing
+ * through per-batch slices — are materialized by a single
+ * `make_column_from_scalar` of their summed size, skipping the per-part
+ * intermediates and the extra copy a plain `cudf::concatenate` would cost.
+ *
+ * @throws cudf::logic_error if `columns` is empty or the parts' types differ
+ *
+ * @param columns The broadcast columns to concatenate
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The concatenated column
+ */
+std::unique_ptr<column> concatenate(
+  host_span<broadcast_column const> columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a binary operation between a broadcast column and a column.
+ *
+ * Forwards to the scalar/column form of `cudf::binary_operation`, so the
+ * broadcast operand is never materialized.
+ *
+ * @throws cudf::logic_error if the operands' sizes differ
+ *
+ * @param lhs         The left operand broadcast column
+ * @param rhs         The right operand column
+ * @param op          The binary operator
+ * @param output_type The desired data type of the output column
+ * @param mr          Device memory resource used to allocate the returned column's device memory
+ * @return            Output column of `output_type` type containing the result
+ */
+std::unique_ptr<column> binary_operation(
+  broadcast_column const& lhs,
+  column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a binary operation between a column and a broadcast column.
+ *
+ * Forwards to the column/scalar form of `cudf::binary_operation`, so the
+ * broadcast operand is never materialized.
+ *
+ * @throws cudf::logic_error if the operands' sizes differ
+ *
+ * @param lhs         The left operand column
+ * @param rhs         The right operand broadcast column
+ * @param op          The binary operator
+ * @param output_type The desired data type of the output column
+ * @param mr          Device memory resource used to allocate the returned column's device memory
+ * @return            Output column of `output_type` type containing the result
+ */
+std::unique_ptr<column> binary_operation(
+  column_view const& lhs,
+  broadcast_column const& rhs,
+  binary_operator op,
+  data_type output_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a binary operation between two broadcast columns.
+ *
+ * The operation is evaluated once, on a single row, and the result is
+ * broadcast back to the operands' size — the row count never enters the cost.
+ *
+ * @throws cudf::logic_error if the operands' sizes differ
+ *
+ * @param lhs         The left operand broadcast column
+ * @param rhs         The right operand broadcast column
+ * @param op          The binary operator
+ * @param output_type The desired data type of the output
+ * @param mr          Device memory resource used for the single-row evaluation
+ * @return            A broadcast column of `output_type` type containing the result
+ */
+broadcast_column binary_operation(
+  broadcast_column const& lhs,
+  broadcast_column const& rhs,
+  binary_operator op,
+  data_type output_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+
+namespace cudf {
+
+/**
+ * @addtogroup column_factories
+ * @{
+ * @file
+ * @brief Bit-packed boolean column representation
+ */
+
+/**
+ * @brief A boolean column stored as one bit per row.
+ *
+ * `BOOL8` columns spend a byte per value, so the predicate intermediates of a
+ * filter-heavy query are eight times larger than the information they carry
+ * and must be converted through `bools_to_mask` before they can touch a null
+ * mask. A `packed_bools` keeps the values in bitmask layout from the start:
+ * it is an eighth the size of the equivalent `BOOL8` column, logical AND/OR/NOT
+ * operate a word (32 rows) at a time, and `cudf::apply_boolean_mask` accepts it
+ * directly without any unpacking.
+ *
+ * A `packed_bools` has no separate validity; a null boolean is represented as
+ * `false`, matching the way `apply_boolean_mask` and `bools_to_mask` already
+ * treat nulls. Bits beyond `size()` in the final word are unset.
+ */
+class packed_bools {
+ public:
+  /**
+   * @brief Creates a packed copy of a `BOOL8` column.
+   *
+   * Element `i` produces a set bit iff it is non-null and `true`.
+   *
+   * @throws cudf::logic_error if `bools` is not of type `BOOL8`
+   *
+   * @param bools The boolean column to pack
+   * @param mr Device memory resource used to allocate the bitmask
+   */
+  explicit packed_bools(
+    column_view const& bools,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Adopts an existing bitmask as a packed boolean column.
+   *
+   * @throws cudf::logic_error if `size` is negative, or if `bits` is too small
+   * to hold `size` bits
+   *
+   * @param bits The bitmask to adopt; bits at positions `size` and beyond must be unset
+   * @param size The number of rows the bitmask represents
+   */
+  packed_bools(rmm::device_buffer&& bits, size_type size);
+
+  /**
+   * @brief Returns the number of rows.
+   */
+  size_type size() const noexcept { return _size; }
+
+  /**
+   * @brief Returns the bitmask holding the values.
+   */
+  bitmask_type const* data() const noexcept
+  {
+    return static_cast<bitmask_type const*>(_bits.data());
+  }
+
+  /**
+   * @brief Returns the number of `true` rows.
+   */
+  size_type true_count() const;
+
+  /**
+   * @brief Unpacks into an equivalent non-nullable `BOOL8` column.
+   *
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A `BOOL8` column of `size()` rows
+   */
+  std::unique_ptr<column> to_column(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  rmm::device_buffer _bits;  ///< Bitmask holding one bit per row
+  size_type _size;           ///< Number of rows represented
+};
+
+/**
+ * @brief Computes the elementwise logical AND of two packed boolean columns.
+ *
+ * @throws cudf::logic_error if `lhs.size() != rhs.size()`
+ *
+ * @param lhs The first operand
+ * @param rhs The second operand
+ * @param mr Device memory resource used to allocate the returned bitmask
+ * @return A packed boolean column of `lhs.size()` rows
+ */
+packed_bools packed_and(
+  packed_bools const& lhs,
+  packed_bools const& rhs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the elementwise logical OR of two packed boolean columns.
+ *
+ * @throws cudf::logic_error if `lhs.size() != rhs.size()`
+ *
+ * @param lhs The first operand
+ * @param rhs The second operand
+ * @param mr Device memory resource used to allocate the returned bitmask
+ * @return A packed boolean column of `lhs.size()` rows
+ */
+packed_bools packed_or(
+  packed_bools const& lhs,
+  packed_bools const& rhs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the elementwise logical NOT of a packed boolean column.
+ *
+ * @param input The operand
+ * @param mr Device memory resource used to allocate the returned bitmask
+ * @return A packed boolean column of `input.size()` rows
+ */
+packed_bools packed_not(
+  packed_bools const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
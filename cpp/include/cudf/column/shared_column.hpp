@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @file
+ * @brief Class definition for cudf::shared_column
+ */
+
+namespace cudf {
+
+/**
+ * @brief An owning wrapper that shares a column's device buffers across slices,
+ * deep-copying only when unique ownership is requested.
+ *
+ * `cudf::slice()` and `cudf::split()` produce non-owning views, forcing callers that
+ * outlive the source column to deep-copy each slice. A `shared_column` instead holds a
+ * reference-counted base column: `slice()` and `split()` on it return new
+ * `shared_column`s backed by the same device buffers, so any number of overlapping
+ * windows over a large column share its data, offsets and null mask allocations.
+ *
+ * Every slice retains its lineage: `base()` returns a `shared_column` over the full,
+ * unsliced base column, and `is_base()` reports whether this instance covers it
+ * entirely.
+ *
+ * Ownership is materialized lazily, in the manner of copy-on-write: `release()` moves
+ * the base column out without any device copy when this instance is the sole reference
+ * to an unsliced base, and deep-copies the viewed rows otherwise.
+ */
+class shared_column {
+ public:
+  shared_column()                     = default;
+  ~shared_column()                    = default;
+  shared_column(shared_column const&) = default;  ///< Shares the base column
+  shared_column(shared_column&&)      = default;
+  shared_column& operator=(shared_column const&) = default;  ///< Shares the base column
+  shared_column& operator=(shared_column&&) = default;
+
+  /**
+   * @brief Construct from an existing column, taking ownership of its contents.
+   *
+   * @throws cudf::logic_error if `col` is null.
+   *
+   * @param col The column to take ownership of
+   */
+  explicit shared_column(std::unique_ptr<column>&& col);
+
+  /**
+   * @brief Returns a view of the rows covered by this instance.
+   *
+   * The view remains valid as long as any `shared_column` referencing the same base
+   * column is alive.
+   */
+  column_view view() const { return _view; }
+
+  /**
+   * @brief Implicit conversion to `column_view`, for use with view-based APIs.
+   */
+  operator column_view() const { return _view; }
+
+  /**
+   * @brief Returns the number of rows covered by this instance.
+   */
+  size_type size() const { return _view.size(); }
+
+  /**
+   * @brief Returns the element `data_type` of the base column.
+   */
+  data_type type() const { return _view.type(); }
+
+  /**
+   * @brief Returns true if more than one `shared_column` references the base column.
+   */
+  bool is_shared() const { return _base.use_count() > 1; }
+
+  /**
+   * @brief Returns true if this instance covers the entire base column.
+   */
+  bool is_base() const;
+
+  /**
+   * @brief Returns a `shared_column` covering the entire base column this slice
+   * descends from.
+   */
+  shared_column base() const;
+
+  /**
+   * @brief Returns a `shared_column` over the rows `[begin, end)`, sharing the base
+   * column's device buffers.
+   *
+   * @throws cudf::logic_error for invalid or out-of-range slice bounds, as with
+   * `cudf::slice()`.
+   *
+   * @param begin The index of the first row in the slice
+   * @param end The index one past the last row in the slice
+   */
+  shared_column slice(size_type begin, size_type end) const;
+
+  /**
+   * @brief Splits into a set of contiguous `shared_column`s, all sharing the base
+   * column's device buffers.
+   *
+   * Split points follow the conventions of `cudf::split()`: for `splits` of size N,
+   * N + 1 columns are returned.
+   *
+   * @throws cudf::logic_error for invalid or unsorted split points, as with
+   * `cudf::split()`.
+   *
+   * @param splits Indices at which to split
+   */
+  std::vector<shared_column> split(host_span<size_type const> splits) const;
+
+  /**
+   * @brief Relinquishes shared ownership and returns a uniquely owned column of the
+   * covered rows.
+   *
+   * If this instance is the only reference to its base column and covers it entirely,
+   * the base column is moved out without copying any device memory. Otherwise the
+   * viewed rows are deep-copied. In both cases this instance is left empty.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used for any allocation performed by a deep copy.
+   * @return The covered rows as a uniquely owned column
+   */
+  std::unique_ptr<column> release(
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  shared_column(std::shared_ptr<column> base, column_view view);
+
+  std::shared_ptr<column> _base;  ///< The owning column, shared between slices
+  column_view _view;              ///< The rows of `_base` covered by this instance
+};
+
+}  // namespace cudf
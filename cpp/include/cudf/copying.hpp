@@ -20,6 +20,7 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <memory>
 #include <vector>
@@ -81,6 +82,105 @@ std::unique_ptr<table> gather(
   out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Gathers the specified rows of a table, destroying the input table as it goes.
+ *
+ * @ingroup copy_gather
+ *
+ * Equivalent to `gather(source_table->view(), gather_map, bounds_policy, mr)` except
+ * that each column of `source_table` is freed as soon as it has been gathered, so
+ * peak device memory usage is roughly the larger of the input and the output rather
+ * than their sum. Use this form when the input table is no longer needed and memory,
+ * not compute, limits batch size.
+ *
+ * @throws cudf::logic_error if gather_map contains null values.
+ *
+ * @param[in] source_table The input table, consumed by the gather
+ * @param[in] gather_map View into a non-nullable column of integral indices that maps the
+ * rows in the source columns to rows in the destination columns. Must not reference the
+ * device memory of `source_table`.
+ * @param[in] bounds_policy Policy to apply to account for possible out-of-bounds indices
+ * `DONT_CHECK` skips all bounds checking for gather map values. `NULLIFY` coerces rows that
+ * corresponds to out-of-bounds indices in the gather map to be null elements. Callers should
+ * use `DONT_CHECK` when they are certain that the gather_map contains only valid indices for
+ * better performance. If `policy` is set to `DONT_CHECK` and there are out-of-bounds indices
+ * in the gather map, the behavior is undefined. Defaults to `DONT_CHECK`.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return std::unique_ptr<table> Result of the gather
+ */
+std::unique_ptr<table> gather(
+  std::unique_ptr<table>&& source_table,
+  column_view const& gather_map,
+  out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief A gather map that has been validated once for reuse across many gather calls.
+ *
+ * @ingroup copy_gather
+ *
+ * Construction checks the map for nulls and records its minimum and maximum
+ * index values. Gathers performed with the prepared map use the recorded range
+ * to choose the fastest safe execution path: maps known to be fully in-bounds
+ * for the source table skip the per-element bounds checks entirely, while maps
+ * containing negative or out-of-bounds indices fall back to index translation
+ * and nullification as appropriate.
+ *
+ * The object holds a view of the caller's map; the underlying device memory
+ * must remain valid for the lifetime of the prepared map.
+ *
+ * @throws cudf::logic_error if gather_map contains null values.
+ */
+class prepared_gather_map {
+ public:
+  /**
+   * @brief Validate the given gather map and record its index range.
+   *
+   * @param gather_map View into a non-nullable column of integral indices.
+   */
+  explicit prepared_gather_map(column_view const& gather_map);
+
+  /**
+   * @brief Returns the view of the gather map this object was built from.
+   */
+  column_view const& map() const noexcept { return _map; }
+
+  /**
+   * @brief Returns the smallest index value in the map (0 if the map is empty).
+   */
+  size_type min_index() const noexcept { return _min_index; }
+
+  /**
+   * @brief Returns the largest index value in the map (-1 if the map is empty).
+   */
+  size_type max_index() const noexcept { return _max_index; }
+
+ private:
+  column_view _map;
+  size_type _min_index;
+  size_type _max_index;
+};
+
+/**
+ * @brief Gathers the specified rows of a set of columns using a prepared gather map.
+ *
+ * @ingroup copy_gather
+ *
+ * Equivalent to `gather(source_table, gather_map.map(), ...)` with the bounds
+ * policy chosen automatically from the index range recorded when the map was
+ * prepared. Reusing one prepared map across many tables amortizes the map
+ * validation and lets in-bounds maps take the unchecked gather path safely.
+ *
+ * @param[in] source_table The input columns whose rows will be gathered
+ * @param[in] gather_map The prepared gather map
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return std::unique_ptr<table> Result of the gather
+ */
+std::unique_ptr<table> gather(
+  table_view const& source_table,
+  prepared_gather_map const& gather_map,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Reverses the rows within a table.
  * Creates a new table that is the reverse of @p source_table.
@@ -456,6 +556,31 @@ std::vector<table_view> slice(table_view const& input, host_span<size_type const
  */
 std::vector<table_view> slice(table_view const& input, std::initializer_list<size_type> indices);
 
+/**
+ * @brief Materializes the slice `[begin, end)` of a table, destroying the input table.
+ *
+ * @ingroup copy_slice
+ *
+ * Produces the same result as copying `slice(input->view(), {begin, end})` into a new
+ * table, but consumes the input: when the slice spans the whole table the input is
+ * returned unchanged with its device buffers reused, and otherwise each input column is
+ * freed as soon as its slice has been copied. Use this form when the input table is no
+ * longer needed and peak device memory limits batch size.
+ *
+ * @throws cudf::logic_error if `begin < 0`, `end < begin` or `end > input->num_rows()`
+ *
+ * @param input Table to slice, consumed by the operation
+ * @param begin Index of the first desired row in the slice (inclusive)
+ * @param end Index of the last desired row in the slice (exclusive)
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return A table owning the rows `[begin, end)` of `input`
+ */
+std::unique_ptr<table> slice(
+  std::unique_ptr<table>&& input,
+  size_type begin,
+  size_type end,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Splits a `column_view` into a set of `column_view`s according to a set of indices
  * derived from expected splits.
@@ -705,6 +830,215 @@ table_view unpack(packed_columns const& input);
  */
 table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
+/**
+ * @brief The result of a `cudf::spill` call: a table compressed into a single device blob.
+ *
+ * @ingroup copy_split
+ *
+ * `data` holds the concatenation of independently compressed blocks of the
+ * `cudf::pack` representation of the table; `block_sizes` records the stored
+ * size of each block. A block whose stored size equals the block size used for
+ * compression (or the final partial block's size) was stored uncompressed
+ * because compression did not shrink it. `metadata_` is the host-side pack
+ * metadata needed to reconstruct the table after `cudf::unspill`.
+ */
+struct spilled_columns {
+  std::unique_ptr<packed_columns::metadata> metadata_;
+  std::unique_ptr<rmm::device_buffer> data;
+  std::vector<size_type> block_sizes;
+  std::size_t uncompressed_size{0};
+};
+
+/**
+ * @brief Compresses a table into a compact device blob using on-GPU Snappy.
+ *
+ * @ingroup copy_split
+ *
+ * The table is first packed into a contiguous buffer (see `cudf::pack`), which
+ * is then compressed block-by-block with the Snappy device encoder. Blocks that
+ * do not shrink are stored raw, so the blob is never larger than the packed
+ * representation plus the host-side block index. The intended use is spilling
+ * under memory pressure: for compressible data, compressing on-GPU and moving
+ * the smaller blob beats copying the raw table over PCIe. The returned blob may
+ * be copied to host memory and back without affecting `cudf::unspill`, as long
+ * as it is back in device memory when unspilling.
+ *
+ * @param input View of the table to spill
+ * @param mr Device memory resource used to allocate the returned blob's device memory
+ * @return The compressed table and the host-side metadata needed to restore it
+ */
+spilled_columns spill(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Decompresses the result of `cudf::spill` back into a packed table.
+ *
+ * @ingroup copy_split
+ *
+ * Returns a `packed_columns` equivalent to what `cudf::pack` produced for the
+ * original table; pass it to `cudf::unpack` to obtain a `table_view` over the
+ * restored data.
+ *
+ * @throws cudf::logic_error if a compressed block fails to decompress
+ *
+ * @param input The compressed table returned by `cudf::spill`
+ * @param mr Device memory resource used to allocate the returned buffer's device memory
+ * @return The uncompressed packed table
+ */
+packed_columns unspill(
+  spilled_columns const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief The result of a `cudf::export_ipc` call.
+ *
+ * @ingroup copy_split
+ *
+ * `data` owns the contiguous device buffer that the exported CUDA IPC memory handle refers
+ * to; it must be kept alive until every peer process is done reading the table. `serialized`
+ * is the host blob to hand to the peer over any host channel (socket, pipe, shared memory):
+ * the CUDA IPC memory handle followed by the `cudf::pack` metadata.
+ */
+struct ipc_exported_table {
+  packed_columns data;
+  std::vector<uint8_t> serialized;
+};
+
+/**
+ * @brief A table imported from another process via `cudf::import_ipc`.
+ *
+ * @ingroup copy_split
+ *
+ * Owns the mapping of the exporting process' device buffer and closes it on destruction.
+ * The `table_view` returned by `view()` is non-owning; it must not outlive this object, and
+ * the exporting process must keep the buffer alive while it is in use here.
+ */
+class ipc_imported_table {
+ public:
+  ipc_imported_table(void* base, std::vector<uint8_t>&& metadata);
+  ~ipc_imported_table();
+
+  ipc_imported_table(ipc_imported_table const&) = delete;
+  ipc_imported_table& operator=(ipc_imported_table const&) = delete;
+
+  /**
+   * @brief Returns a non-owning view of the imported table.
+   */
+  table_view view() const;
+
+ private:
+  void* _base;
+  std::vector<uint8_t> _metadata;
+};
+
+/**
+ * @brief Exports a table for zero-copy sharing with another process on the same GPU.
+ *
+ * @ingroup copy_split
+ *
+ * The table is packed into a single contiguous device buffer (covering nested and string
+ * columns, see `cudf::pack`) allocated directly with the CUDA allocator, since CUDA IPC
+ * memory handles refer to whole base allocations. The returned `serialized` blob contains
+ * the IPC memory handle and the metadata needed by `cudf::import_ipc` to reconstruct the
+ * table in the peer process without copying the data.
+ *
+ * The device is synchronized before returning, so the handle may be sent immediately.
+ *
+ * @param input View of the table to export
+ * @return The packed table owning the shared buffer, and the blob to send to the peer
+ */
+ipc_exported_table export_ipc(table_view const& input);
+
+/**
+ * @brief Imports a table exported by `cudf::export_ipc` in another process.
+ *
+ * Opens the CUDA IPC memory handle contained in `serialized` and reconstructs a
+ * `table_view` over the mapped buffer with zero copies.
+ *
+ * @throw cudf::logic_error if `serialized` is too small to contain an IPC handle
+ *
+ * @param serialized The blob produced by `export_ipc` in the exporting process
+ * @return An owning wrapper whose `view()` is the imported table
+ */
+std::unique_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& serialized);
+
+/**
+ * @brief A host-resident snapshot of a table, filled by an asynchronous device-to-host copy.
+ *
+ * @ingroup copy_split
+ *
+ * `metadata()` is the `cudf::pack` metadata of the snapshot and `data()` the matching
+ * pack data buffer in pinned host memory. The copy into the buffer is enqueued on the
+ * default stream when the snapshot is created and overlaps with subsequent device work;
+ * the buffer contents must not be read until `wait()` has returned (or `is_ready()`
+ * reports true). The snapshot keeps the device-side staging buffer alive until the
+ * copy has completed.
+ */
+class host_snapshot {
+ public:
+  host_snapshot(host_snapshot&& other) noexcept;
+  host_snapshot& operator=(host_snapshot&& other) noexcept;
+  host_snapshot(host_snapshot const&) = delete;
+  host_snapshot& operator=(host_snapshot const&) = delete;
+  ~host_snapshot();
+
+  /**
+   * @brief Blocks until the device-to-host copy has completed and releases the
+   * device-side staging buffer.
+   */
+  void wait();
+
+  /**
+   * @brief Returns true if the device-to-host copy has completed.
+   */
+  bool is_ready() const;
+
+  /**
+   * @brief Returns the `cudf::pack` metadata describing the snapshot.
+   */
+  packed_columns::metadata const& metadata() const { return *_metadata; }
+
+  /**
+   * @brief Returns the pinned host buffer holding the packed table data.
+   *
+   * Only valid to read after `wait()` has returned.
+   */
+  uint8_t const* data() const { return static_cast<uint8_t const*>(_host_data); }
+
+  /**
+   * @brief Returns the size of the packed table data in bytes.
+   */
+  std::size_t size() const { return _size; }
+
+ private:
+  friend host_snapshot to_host(table_view const& input);
+  explicit host_snapshot(table_view const& input);
+
+  std::unique_ptr<packed_columns::metadata> _metadata;
+  std::unique_ptr<rmm::device_buffer> _staging;
+  void* _host_data{nullptr};
+  std::size_t _size{0};
+  cudaEvent_t _event{nullptr};
+};
+
+/**
+ * @brief Takes a contiguous host snapshot of a table without blocking the device.
+ *
+ * @ingroup copy_split
+ *
+ * The table is packed into a single contiguous device buffer (see `cudf::pack`) and its
+ * copy to pinned host memory is enqueued on the default stream before returning, so the
+ * transfer overlaps with device work submitted afterwards. Call `wait()` on the returned
+ * snapshot before reading the host buffer. The snapshot can be restored to the device by
+ * copying `data()` back into a `device_buffer` and calling `cudf::unpack` with
+ * `metadata()`.
+ *
+ * @param input View of the table to snapshot
+ * @return The snapshot owning the pinned host buffer and pack metadata
+ */
+host_snapshot to_host(table_view const& input);
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -800,6 +1134,36 @@ std::unique_ptr<column> copy_if_else(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a new column selecting each row from the first of several
+ *        candidate columns whose condition holds, like a SQL CASE expression.
+ *
+ * For each row `i`, the output is `results[k][i]` for the smallest `k` such
+ * that `conditions[k][i]` is non-null and `true`, or `otherwise[i]` if no
+ * condition holds. A null condition element represents false.
+ *
+ * Equivalent to chaining `conditions.size() - 1` calls to `copy_if_else`, but
+ * every condition is evaluated in a single pass and only the final column is
+ * materialized, instead of one intermediate column per branch.
+ *
+ * @throws cudf::logic_error if `conditions` is empty or its size differs from `results`
+ * @throws cudf::logic_error if any condition is not of type `BOOL8`
+ * @throws cudf::logic_error if any result is not of the same type as `otherwise`
+ * @throws cudf::logic_error if any condition or result is not of the same length as `otherwise`
+ *
+ * @param[in] conditions Columns of `type_id::BOOL8`, tested in order for each row
+ * @param[in] results Columns supplying the output rows of the corresponding condition
+ * @param[in] otherwise Column supplying the output rows where no condition holds
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns new column with the selected elements
+ */
+std::unique_ptr<column> case_when(
+  host_span<column_view const> conditions,
+  host_span<column_view const> results,
+  column_view const& otherwise,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Scatters rows from the input table to rows of the output corresponding
  * to true values in a boolean mask.
@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
 
 /**
  * @file datetime.hpp
@@ -378,5 +379,104 @@ std::unique_ptr<column> ceil_nanosecond(
   column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Round down each timestamp to a multiple of the given interval
+ *
+ * The interval buckets are anchored at the UNIX epoch, so an interval of
+ * 5 minutes maps all timestamps in [12:00, 12:05) to 12:00. The returned
+ * column has the same timestamp type as the input and may be used directly
+ * as a groupby key for time bucketing.
+ *
+ * @code{.pseudo}
+ * Example:
+ * timestamps = [12:02:33, 12:07:00, 12:04:59]
+ * interval   = duration_s{300}  // 5 minutes
+ * r = floor_timestamps(timestamps, interval)
+ * r is now [12:00:00, 12:05:00, 12:00:00]
+ * @endcode
+ *
+ * @throw cudf::logic_error if the input column is not a TIMESTAMP
+ * @throw cudf::logic_error if `interval` is not a valid, positive duration scalar
+ * @throw cudf::logic_error if `interval` is not a multiple of the timestamp resolution
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param interval Duration scalar specifying the bucket width
+ * @param mr Device memory resource used to allocate device memory of the returned column.
+ * @return cudf::column of the same timestamp type as the input column
+ */
+std::unique_ptr<column> floor_timestamps(
+  column_view const& column,
+  scalar const& interval,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Round up each timestamp to a multiple of the given interval
+ *
+ * The interval buckets are anchored at the UNIX epoch. Timestamps already on
+ * a bucket boundary are unchanged.
+ *
+ * @throw cudf::logic_error if the input column is not a TIMESTAMP
+ * @throw cudf::logic_error if `interval` is not a valid, positive duration scalar
+ * @throw cudf::logic_error if `interval` is not a multiple of the timestamp resolution
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param interval Duration scalar specifying the bucket width
+ * @param mr Device memory resource used to allocate device memory of the returned column.
+ * @return cudf::column of the same timestamp type as the input column
+ */
+std::unique_ptr<column> ceil_timestamps(
+  column_view const& column,
+  scalar const& interval,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Round each timestamp to the nearest multiple of the given interval
+ *
+ * The interval buckets are anchored at the UNIX epoch. Halfway values are
+ * rounded up.
+ *
+ * @throw cudf::logic_error if the input column is not a TIMESTAMP
+ * @throw cudf::logic_error if `interval` is not a valid, positive duration scalar
+ * @throw cudf::logic_error if `interval` is not a multiple of the timestamp resolution
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param interval Duration scalar specifying the bucket width
+ * @param mr Device memory resource used to allocate device memory of the returned column.
+ * @return cudf::column of the same timestamp type as the input column
+ */
+std::unique_ptr<column> round_timestamps(
+  column_view const& column,
+  scalar const& interval,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts timestamps from one timezone's wall-clock time to another's
+ *
+ * Each input timestamp is interpreted as wall-clock time in `from_timezone`,
+ * normalized to UTC using that timezone's transition table, and then shifted
+ * to wall-clock time in `to_timezone`. "UTC" or an empty string denotes UTC.
+ * Timezone transition tables are parsed from the system's TZif files and
+ * cached process-wide, so repeated conversions for the same timezone reuse
+ * the device-resident table.
+ *
+ * Wall-clock times that fall in the repeated or skipped hour around a DST
+ * transition resolve to the offset in effect at the matching UTC instant.
+ *
+ * @throw cudf::logic_error if the input column is not a TIMESTAMP of seconds
+ * or finer resolution
+ * @throw cudf::logic_error if a timezone name cannot be resolved to a TZif file
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param from_timezone Standard timezone name (for example, "US/Pacific") the input is in
+ * @param to_timezone Standard timezone name the output should be in
+ * @param mr Device memory resource used to allocate device memory of the returned column.
+ * @return cudf::column of the same timestamp type as the input column
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& column,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace datetime
 }  // namespace cudf
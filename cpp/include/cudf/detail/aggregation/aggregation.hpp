@@ -69,6 +69,8 @@ class simple_aggregations_collector {  // Declares the interface for the simple
                                                           class argmin_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
                                                           class nunique_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(
+    data_type col_type, class approx_nunique_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
                                                           class nth_element_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
@@ -77,6 +79,8 @@ class simple_aggregations_collector {  // Declares the interface for the simple
                                                           class rank_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
                                                           class dense_rank_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(
+    data_type col_type, class percent_rank_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(
     data_type col_type, class collect_list_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
@@ -122,10 +126,12 @@ class aggregation_finalizer {  // Declares the interface for the finalizer
   virtual void visit(class argmax_aggregation const& agg);
   virtual void visit(class argmin_aggregation const& agg);
   virtual void visit(class nunique_aggregation const& agg);
+  virtual void visit(class approx_nunique_aggregation const& agg);
   virtual void visit(class nth_element_aggregation const& agg);
   virtual void visit(class row_number_aggregation const& agg);
   virtual void visit(class rank_aggregation const& agg);
   virtual void visit(class dense_rank_aggregation const& agg);
+  virtual void visit(class percent_rank_aggregation const& agg);
   virtual void visit(class collect_list_aggregation const& agg);
   virtual void visit(class collect_set_aggregation const& agg);
   virtual void visit(class lead_lag_aggregation const& agg);
@@ -545,6 +551,46 @@ class nunique_aggregation final : public groupby_aggregation {
   size_t hash_impl() const { return std::hash<int>{}(static_cast<int>(_null_handling)); }
 };
 
+/**
+ * @brief Derived class for specifying an approximate nunique aggregation
+ */
+class approx_nunique_aggregation final : public groupby_aggregation {
+ public:
+  approx_nunique_aggregation(null_policy null_handling, size_type precision)
+    : aggregation{APPROX_NUNIQUE}, _null_handling{null_handling}, _precision{precision}
+  {
+  }
+
+  null_policy _null_handling;  ///< include or exclude nulls
+  size_type _precision;        ///< number of HyperLogLog index bits
+
+  bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<approx_nunique_aggregation const&>(_other);
+    return _null_handling == other._null_handling and _precision == other._precision;
+  }
+
+  size_t do_hash() const override { return this->aggregation::do_hash() ^ hash_impl(); }
+
+  std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<approx_nunique_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+
+ private:
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(static_cast<int>(_null_handling)) ^ std::hash<int>{}(_precision);
+  }
+};
+
 /**
  * @brief Derived class for specifying a nth element aggregation
  */
@@ -642,6 +688,26 @@ class dense_rank_aggregation final : public rolling_aggregation, public groupby_
   void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
 };
 
+/**
+ * @brief Derived class for specifying a percent rank aggregation
+ */
+class percent_rank_aggregation final : public rolling_aggregation,
+                                       public groupby_scan_aggregation {
+ public:
+  percent_rank_aggregation() : aggregation{PERCENT_RANK} {}
+
+  std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<percent_rank_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
 /**
  * @brief Derived aggregation class for specifying COLLECT_LIST aggregation
  */
@@ -767,7 +833,7 @@ class lead_lag_aggregation final : public rolling_aggregation {
  * @brief Derived class for specifying a custom aggregation
  * specified in udf
  */
-class udf_aggregation final : public rolling_aggregation {
+class udf_aggregation final : public rolling_aggregation, public groupby_aggregation {
  public:
   udf_aggregation(aggregation::Kind type,
                   std::string const& user_defined_aggregator,
@@ -1113,12 +1179,15 @@ struct target_type_impl<
   using type = int64_t;
 };
 
-// Summing fixed_point numbers, always use the decimal64 accumulator
+// Summing fixed_point numbers, use the decimal64 accumulator for the 32/64-bit
+// representations and keep decimal128 as is
 template <typename Source, aggregation::Kind k>
 struct target_type_impl<Source,
                         k,
                         std::enable_if_t<is_fixed_point<Source>() && (k == aggregation::SUM)>> {
-  using type = numeric::decimal64;
+  using type = std::conditional_t<std::is_same_v<Source, numeric::decimal128>,
+                                  numeric::decimal128,
+                                  numeric::decimal64>;
 };
 
 // Summing/Multiplying float/doubles, use same type accumulator
@@ -1185,6 +1254,12 @@ struct target_type_impl<Source, aggregation::NUNIQUE> {
   using type = size_type;
 };
 
+// Always use size_type accumulator for APPROX_NUNIQUE
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_NUNIQUE> {
+  using type = size_type;
+};
+
 // Always use Source for NTH_ELEMENT
 template <typename Source>
 struct target_type_impl<Source, aggregation::NTH_ELEMENT> {
@@ -1203,6 +1278,12 @@ struct target_type_impl<Source, aggregation::RANK> {
   using type = size_type;
 };
 
+// Always use double for PERCENT_RANK
+template <typename Source>
+struct target_type_impl<Source, aggregation::PERCENT_RANK> {
+  using type = double;
+};
+
 // Always use size_type accumulator for DENSE_RANK
 template <typename Source>
 struct target_type_impl<Source, aggregation::DENSE_RANK> {
@@ -1363,6 +1444,8 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::ARGMIN>(std::forward<Ts>(args)...);
     case aggregation::NUNIQUE:
       return f.template operator()<aggregation::NUNIQUE>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_NUNIQUE:
+      return f.template operator()<aggregation::APPROX_NUNIQUE>(std::forward<Ts>(args)...);
     case aggregation::NTH_ELEMENT:
       return f.template operator()<aggregation::NTH_ELEMENT>(std::forward<Ts>(args)...);
     case aggregation::ROW_NUMBER:
@@ -1371,6 +1454,8 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::RANK>(std::forward<Ts>(args)...);
     case aggregation::DENSE_RANK:
       return f.template operator()<aggregation::DENSE_RANK>(std::forward<Ts>(args)...);
+    case aggregation::PERCENT_RANK:
+      return f.template operator()<aggregation::PERCENT_RANK>(std::forward<Ts>(args)...);
     case aggregation::COLLECT_LIST:
       return f.template operator()<aggregation::COLLECT_LIST>(std::forward<Ts>(args)...);
     case aggregation::COLLECT_SET:
@@ -1393,6 +1478,10 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
     case aggregation::MERGE_TDIGEST:
       return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::PTX:
+      return f.template operator()<aggregation::PTX>(std::forward<Ts>(args)...);
+    case aggregation::CUDA:
+      return f.template operator()<aggregation::CUDA>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
@@ -39,6 +39,8 @@
 #include <rmm/exec_policy.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <unordered_map>
 
 #include <thrust/functional.h>
 #include <thrust/gather.h>
@@ -616,6 +618,78 @@ void gather_bitmask(table_view const& source,
   }
 }
 
+/**
+ * @brief Kernel gathering a batch of equal-width fixed-size columns.
+ *
+ * Each thread reads a gather map entry once and copies that row for every
+ * column in the batch, amortizing the map read and the kernel launch across
+ * the batch instead of paying one launch per column.
+ */
+template <typename Element, typename MapIterator>
+__global__ void gather_fused_kernel(Element const* const* sources,
+                                    Element* const* destinations,
+                                    size_type num_columns,
+                                    size_type num_rows,
+                                    MapIterator gather_map)
+{
+  size_type destination_row = threadIdx.x + blockIdx.x * blockDim.x;
+  while (destination_row < num_rows) {
+    auto const source_row = gather_map[destination_row];
+    for (size_type i = 0; i < num_columns; ++i) {
+      destinations[i][destination_row] = sources[i][source_row];
+    }
+    destination_row += blockDim.x * gridDim.x;
+  }
+}
+
+/**
+ * @brief Gathers a group of fixed-size columns of the same element width with a
+ * single kernel launch.
+ *
+ * Used by the table-level gather below to batch fixed-width columns so that a
+ * wide table pays one launch per distinct element width rather than one per
+ * column.
+ *
+ * @param element_width Size in bytes of each column's element type; must be 1, 2, 4 or 8
+ * @param source_data Device pointers to the first element of each source column
+ * @param destination_data Device pointers to the first element of each destination column
+ * @param num_rows Number of rows to gather
+ * @param gather_map_begin Start of the gather map
+ * @param stream CUDA stream used for kernel launches
+ */
+template <typename MapIterator>
+void gather_fused(std::size_t element_width,
+                  std::vector<void const*> const& source_data,
+                  std::vector<void*> const& destination_data,
+                  size_type num_rows,
+                  MapIterator gather_map_begin,
+                  rmm::cuda_stream_view stream)
+{
+  auto const num_columns    = static_cast<size_type>(source_data.size());
+  auto const d_sources = make_device_uvector_async(source_data, stream);
+  auto d_destinations  = make_device_uvector_async(destination_data, stream);
+
+  constexpr size_type block_size = 256;
+  auto const grid                = grid_1d{num_rows, block_size};
+  auto launch                    = [&](auto dummy) {
+    using Element = decltype(dummy);
+    gather_fused_kernel<Element>
+      <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+        reinterpret_cast<Element const* const*>(d_sources.data()),
+        reinterpret_cast<Element* const*>(d_destinations.data()),
+        num_columns,
+        num_rows,
+        gather_map_begin);
+  };
+  switch (element_width) {
+    case 1: launch(uint8_t{}); break;
+    case 2: launch(uint16_t{}); break;
+    case 4: launch(uint32_t{}); break;
+    case 8: launch(uint64_t{}); break;
+    default: CUDF_FAIL("Unsupported element width for fused gather");
+  }
+}
+
 /**
  * @brief Gathers the specified rows of a set of columns according to a gather map.
  *
@@ -653,13 +727,46 @@ std::unique_ptr<table> gather(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  std::vector<std::unique_ptr<column>> destination_columns;
+  auto const num_rows = cudf::distance(gather_map_begin, gather_map_end);
+  std::vector<std::unique_ptr<column>> destination_columns(source_table.num_columns());
+
+  // Group fixed-size columns of the same element width and gather each group
+  // through a single fused kernel, so a wide table pays one launch per distinct
+  // width instead of one per column. NULLIFY needs per-element bounds handling
+  // and keeps the per-column path.
+  if (bounds_policy == out_of_bounds_policy::DONT_CHECK and num_rows > 0) {
+    std::unordered_map<std::size_t, std::vector<size_type>> width_groups;
+    for (size_type i = 0; i < source_table.num_columns(); ++i) {
+      auto const& source_column = source_table.column(i);
+      if (not cudf::is_fixed_width(source_column.type())) { continue; }
+      auto const width = cudf::size_of(source_column.type());
+      if (width == 1 or width == 2 or width == 4 or width == 8) {
+        width_groups[width].push_back(i);
+      }
+    }
+    for (auto const& [width, group] : width_groups) {
+      if (group.size() < 2) { continue; }  // a lone column gains nothing from fusing
+      std::vector<void const*> source_data;
+      std::vector<void*> destination_data;
+      for (auto const i : group) {
+        auto const& source_column = source_table.column(i);
+        destination_columns[i]    = cudf::detail::allocate_like(
+          source_column, num_rows, cudf::mask_allocation_policy::NEVER, stream, mr);
+        source_data.push_back(source_column.head<unsigned char>() +
+                              width * source_column.offset());
+        destination_data.push_back(destination_columns[i]->mutable_view().head());
+      }
+      gather_fused(width, source_data, destination_data, num_rows, gather_map_begin, stream);
+    }
+  }
 
   // TODO: Could be beneficial to use streams internally here
 
-  for (auto const& source_column : source_table) {
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (destination_columns[i] != nullptr) { continue; }  // gathered by a fused batch above
+    auto const& source_column = source_table.column(i);
     // The data gather for n columns will be put on the first n streams
-    destination_columns.push_back(
+    destination_columns[i] =
       cudf::type_dispatcher<dispatch_storage_type>(source_column.type(),
                                                    column_gatherer{},
                                                    source_column,
@@ -667,7 +774,7 @@ std::unique_ptr<table> gather(
                                                    gather_map_end,
                                                    bounds_policy == out_of_bounds_policy::NULLIFY,
                                                    stream,
-                                                   mr));
+                                                   mr);
   }
 
   auto const nullable = bounds_policy == out_of_bounds_policy::NULLIFY ||
@@ -83,5 +83,33 @@ std::unique_ptr<table> gather(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::gather(std::unique_ptr<table>&&,column_view const&,out_of_bounds_policy,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param[in] neg_indices Interpret each negative index `i` in the
+ * `gather_map` as the positive index `i+num_source_rows`.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> gather(
+  std::unique_ptr<table>&& source_table,
+  column_view const& gather_map,
+  out_of_bounds_policy bounds_policy,
+  negative_index_policy neg_indices,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::gather(table_view const&,prepared_gather_map const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> gather(
+  table_view const& source_table,
+  prepared_gather_map const& gather_map,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
@@ -90,6 +91,114 @@ __global__ void offset_bitmask_binop(Binop op,
   if (threadIdx.x == 0) { atomicAdd(count_ptr, block_count); }
 }
 
+/**
+ * @brief Device-side evaluator of a null-mask expression tree
+ *
+ * Evaluates an arbitrary AND/OR expression over any number of bitmasks one
+ * word at a time, so that value kernels can fuse null propagation with their
+ * own output instead of launching a separate `bitmask_and`/`bitmask_or` pass
+ * per operator. The expression is stored in postfix order: a `MASK` node
+ * produces a word of the corresponding source mask and `BIT_AND`/`BIT_OR`
+ * nodes combine the two most recently produced intermediate results.
+ */
+class bitmask_expr {
+ public:
+  /// Deepest operand stack a well-formed expression may require
+  static constexpr size_type max_depth = 32;
+
+  /**
+   * @brief Constructs an evaluator over device-resident expression state
+   *
+   * @param nodes Nodes of the expression tree, in postfix order
+   * @param masks Array of source mask pointers
+   * @param masks_begin_bits Array of bit offsets into corresponding @p masks
+   * @param mask_size_bits Number of bits read from each mask
+   */
+  bitmask_expr(device_span<bitmask_expr_node const> nodes,
+               device_span<bitmask_type const*> masks,
+               device_span<size_type const> masks_begin_bits,
+               size_type mask_size_bits)
+    : _nodes(nodes), _masks(masks), _begin_bits(masks_begin_bits), _size_bits(mask_size_bits)
+  {
+  }
+
+  /**
+   * @brief Computes one word of the merged bitmask
+   *
+   * @param destination_word_index Index of the word to compute
+   * @return The merged bitmask word
+   */
+  __device__ bitmask_type word(size_type destination_word_index) const
+  {
+    bitmask_type stack[max_depth];
+    size_type top = -1;
+    for (size_type i = 0; i < static_cast<size_type>(_nodes.size()); ++i) {
+      auto const node = _nodes[i];
+      if (node.op == bitmask_expr_op::MASK) {
+        stack[++top] = detail::get_mask_offset_word(_masks[node.mask_index],
+                                                    destination_word_index,
+                                                    _begin_bits[node.mask_index],
+                                                    _begin_bits[node.mask_index] + _size_bits);
+      } else {
+        auto const rhs = stack[top--];
+        stack[top] = node.op == bitmask_expr_op::BIT_AND ? (stack[top] & rhs) : (stack[top] | rhs);
+      }
+    }
+    return stack[0];
+  }
+
+ private:
+  device_span<bitmask_expr_node const> _nodes;
+  device_span<bitmask_type const*> _masks;
+  device_span<size_type const> _begin_bits;
+  size_type _size_bits;
+};
+
+/**
+ * @brief Computes the fold of a null-mask expression over an array of bitmasks
+ *
+ * @tparam block_size Number of threads in each thread block
+ *
+ * @param expr The expression evaluator used to compute each destination word
+ * @param destination The bitmask to write result into
+ * @param source_size_bits Number of bits in each source mask
+ * @param count_ptr Pointer to counter of set bits
+ */
+template <int block_size>
+__global__ void offset_bitmask_expr(bitmask_expr expr,
+                                    device_span<bitmask_type> destination,
+                                    size_type source_size_bits,
+                                    size_type* count_ptr)
+{
+  constexpr auto const word_size{detail::size_in_bits<bitmask_type>()};
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+
+  size_type thread_count = 0;
+
+  for (size_type destination_word_index = tid; destination_word_index < destination.size();
+       destination_word_index += blockDim.x * gridDim.x) {
+    bitmask_type const destination_word = expr.word(destination_word_index);
+    destination[destination_word_index] = destination_word;
+    thread_count += __popc(destination_word);
+  }
+
+  // Subtract any slack bits from the last word
+  if (tid == 0) {
+    size_type const last_bit_index = source_size_bits - 1;
+    size_type const num_slack_bits = word_size - (last_bit_index % word_size) - 1;
+    if (num_slack_bits > 0) {
+      size_type const word_index = cudf::word_index(last_bit_index);
+      thread_count -= __popc(destination[word_index] & set_most_significant_bits(num_slack_bits));
+    }
+  }
+
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type block_count = BlockReduce(temp_storage).Sum(thread_count);
+
+  if (threadIdx.x == 0) { atomicAdd(count_ptr, block_count); }
+}
+
 /**
  * @copydoc bitmask_binop(Binop op, host_span<bitmask_type const *> const, host_span<size_type>
  * const, size_type, rmm::mr::device_memory_resource *)
@@ -141,6 +141,68 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the null count of every column of the table
+ *
+ * Counts the unset bits of all the columns' null masks in a single batched
+ * kernel launch instead of one `count_unset_bits` launch per column. Columns
+ * without a null mask report zero nulls. Null counts cached in the views are
+ * ignored; use this when the counts of several columns are unknown.
+ *
+ * @param view The table whose null counts are computed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The null count of each column of `view`
+ */
+std::vector<size_type> null_counts(table_view const& view,
+                                   rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Operation performed by a node of a null-mask expression tree.
+ */
+enum class bitmask_expr_op : int32_t {
+  MASK,     ///< Produces the words of the source mask selected by `mask_index`
+  BIT_AND,  ///< Combines the two most recently produced results with bitwise AND
+  BIT_OR    ///< Combines the two most recently produced results with bitwise OR
+};
+
+/**
+ * @brief Node of a null-mask expression tree, stored in postfix order.
+ *
+ * An expression such as `(m0 & m1) | m2` is encoded as the node sequence
+ * `{MASK 0, MASK 1, BIT_AND, MASK 2, BIT_OR}`.
+ */
+struct bitmask_expr_node {
+  bitmask_expr_op op;    ///< Operation performed by this node
+  size_type mask_index;  ///< Index of the source mask, used only when `op == MASK`
+};
+
+/**
+ * @brief Folds an AND/OR expression over an array of bitmasks in a single pass
+ *
+ * Merges any number of bitmasks through an arbitrary tree of AND/OR operators
+ * with one kernel launch, instead of one `bitmask_and`/`bitmask_or` pass per
+ * operator.
+ *
+ * @throws cudf::logic_error if `expr` is not a well-formed postfix expression,
+ * references a mask index out of range, or exceeds the evaluator's operand
+ * stack depth
+ *
+ * @param expr The expression tree to fold, in postfix order
+ * @param masks The list of data pointers of the source bitmasks
+ * @param masks_begin_bits The bit offsets from which each mask is read
+ * @param mask_size_bits The number of bits to be merged from each mask
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return A pair of the resulting bitmask and its null count
+ */
+std::pair<rmm::device_buffer, size_type> bitmask_expr_fold(
+  host_span<bitmask_expr_node const> expr,
+  host_span<bitmask_type const*> masks,
+  host_span<size_type const> masks_begin_bits,
+  size_type mask_size_bits,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Performs a bitwise AND of the specified bitmasks,
  *        and writes in place to destination
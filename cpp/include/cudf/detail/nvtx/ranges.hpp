@@ -18,6 +18,13 @@
 
 #include "nvtx3.hpp"
 
+#include <cudf/profiling.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+
 namespace cudf {
 /**
  * @brief Tag type for libcudf's NVTX domain.
@@ -31,6 +38,67 @@ struct libcudf_domain {
  */
 using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
 
+namespace detail {
+
+/**
+ * @brief Returns the runtime toggle controlling whether libcudf pushes NVTX
+ * ranges.
+ *
+ * Initialized from the `LIBCUDF_NVTX_RANGES` environment variable: ranges are
+ * on unless it is set to `0`. The flag may be flipped at any time via
+ * `cudf::enable_nvtx_ranges()` / `cudf::disable_nvtx_ranges()`.
+ */
+inline std::atomic<bool>& nvtx_ranges_enabled()
+{
+  static std::atomic<bool> enabled{[] {
+    auto const* env = std::getenv("LIBCUDF_NVTX_RANGES");
+    return env == nullptr or env[0] != '0';
+  }()};
+  return enabled;
+}
+
+/**
+ * @brief An NVTX range in the libcudf domain that is pushed only when ranges
+ * are enabled at runtime.
+ *
+ * Constructor arguments are forwarded to `nvtx3::event_attributes`, so a range
+ * may carry a message, payload, etc. When ranges are disabled the constructor
+ * is a single relaxed atomic load.
+ */
+class optional_thread_range {
+ public:
+  template <typename... Args>
+  explicit optional_thread_range(Args const&... args) noexcept
+  {
+    if (nvtx_ranges_enabled().load(std::memory_order_relaxed)) {
+      _range.emplace(::nvtx3::event_attributes{args...});
+    }
+  }
+
+  optional_thread_range(optional_thread_range const&) = delete;
+  optional_thread_range& operator=(optional_thread_range const&) = delete;
+  optional_thread_range(optional_thread_range&&)                 = delete;
+  optional_thread_range& operator=(optional_thread_range&&) = delete;
+
+ private:
+  std::optional<thread_range> _range;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Enables NVTX ranges for all subsequently entered libcudf functions.
+ */
+inline void enable_nvtx_ranges() { detail::nvtx_ranges_enabled().store(true); }
+
+/**
+ * @brief Disables NVTX ranges; subsequently entered libcudf functions push no
+ * ranges.
+ *
+ * Ranges already open on any thread are closed normally.
+ */
+inline void disable_nvtx_ranges() { detail::nvtx_ranges_enabled().store(false); }
+
 }  // namespace cudf
 
 /**
@@ -38,7 +106,9 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. The range is suppressed when NVTX ranges are disabled at
+ * runtime. The function is also recorded by `cudf::profiling` when that is
+ * enabled.
  *
  * Example:
  * ```
@@ -48,4 +118,34 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * }
  * ```
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                                                        \
+  static ::nvtx3::registered_message<cudf::libcudf_domain> const                 \
+    nvtx3_func_name__{__func__};                                                 \
+  static ::nvtx3::event_attributes const nvtx3_func_attr__{nvtx3_func_name__};   \
+  cudf::detail::optional_thread_range const nvtx3_range__{nvtx3_func_attr__};    \
+  cudf::profiling::scope const cudf_profiling_scope__{__func__};
+
+/**
+ * @brief Like `CUDF_FUNC_RANGE()`, but attaches a numeric payload to the range.
+ *
+ * The payload typically carries the number of rows or bytes the call operates
+ * on, so traces can attribute GPU time and data volume to operators without a
+ * rebuild. The payload is also reported to `cudf::profiling` as the call's
+ * data volume.
+ *
+ * Example:
+ * ```
+ * std::unique_ptr<table> some_function(table_view const& input){
+ *    CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
+ *    ...
+ * }
+ * ```
+ */
+#define CUDF_FUNC_RANGE_WITH_PAYLOAD(value)                                \
+  static ::nvtx3::registered_message<cudf::libcudf_domain> const           \
+    nvtx3_func_name__{__func__};                                           \
+  auto const cudf_range_payload__ = static_cast<std::int64_t>(value);      \
+  cudf::detail::optional_thread_range const nvtx3_range__{                 \
+    nvtx3_func_name__, ::nvtx3::payload{cudf_range_payload__}};            \
+  cudf::profiling::scope const cudf_profiling_scope__{                     \
+    __func__, static_cast<std::size_t>(cudf_range_payload__)};
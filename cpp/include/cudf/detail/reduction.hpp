@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/reduction.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @copydoc cudf::reduce(column_view const&, std::unique_ptr<aggregation> const&, data_type,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<scalar> reduce(
+  column_view const& col,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::reduce_multi(column_view const&, std::vector<std::unique_ptr<aggregation>> const&,
+ * std::vector<data_type> const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<scalar>> reduce_multi(
+  column_view const& col,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  std::vector<data_type> const& output_dtypes,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::segmented_reduce(column_view const&, column_view const&,
+ * std::unique_ptr<aggregation> const&, data_type, null_policy, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const& values,
+  column_view const& offsets,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::batched_reduce(table_view const&, std::unique_ptr<aggregation> const&,
+ * data_type, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> batched_reduce(
+  table_view const& input,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace detail
+}  // namespace cudf
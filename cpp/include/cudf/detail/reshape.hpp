@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/types.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -45,5 +47,37 @@ std::unique_ptr<column> interleave_columns(
   rmm::cuda_stream_view               = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::deinterleave_columns
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<table> deinterleave_columns(
+  column_view const& input,
+  size_type num_columns,
+  rmm::cuda_stream_view               = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::to_rows
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::vector<std::unique_ptr<column>> to_rows(
+  table_view const& input,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::from_rows
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<table> from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -23,6 +23,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -47,5 +48,25 @@ std::unique_ptr<column> rolling_window(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc std::vector<std::unique_ptr<column>> rolling_window(
+ *            column_view const& input,
+ *            size_type preceding_window,
+ *            size_type following_window,
+ *            size_type min_periods,
+ *            std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+ *            rmm::mr::device_memory_resource* mr)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> rolling_window_multi(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief A cache of immutable, valid device scalars, keyed by type and bit pattern.
+ *
+ * Constructing a `cudf::scalar` performs a device allocation and a host-to-device copy.
+ * Workloads that repeatedly apply the same literals (e.g. expression evaluation over
+ * many batches) pay that cost on every call. This pool constructs each distinct
+ * fixed-width value once and hands out references to the cached scalar thereafter.
+ *
+ * Cached scalars are always valid and must never be mutated; they are shared between
+ * all callers. The creating stream is synchronized once when a value is first
+ * inserted, so returned scalars are safe to use on any stream. References remain
+ * valid until `clear()` is called.
+ *
+ * All member functions are thread-safe.
+ */
+class scalar_pool {
+ public:
+  scalar_pool()                   = default;
+  scalar_pool(scalar_pool const&) = delete;
+  scalar_pool& operator=(scalar_pool const&) = delete;
+
+  /**
+   * @brief Returns a cached device scalar holding `value`, constructing it on first use.
+   *
+   * Only fixed-width, non-fixed-point types are supported; fixed-point scales would
+   * alias in a bit-pattern key, and variable-width values are not "small" scalars.
+   *
+   * @param value The value of the returned scalar
+   * @param stream CUDA stream used if the scalar needs to be constructed
+   * @return Reference to an immutable, valid scalar holding `value`
+   */
+  template <typename T>
+  scalar const& get(T const& value, rmm::cuda_stream_view stream = rmm::cuda_stream_default)
+  {
+    static_assert(cudf::is_fixed_width<T>() and not cudf::is_fixed_point<T>(),
+                  "scalar_pool only caches fixed-width, non-fixed-point scalar values.");
+
+    auto const key = make_key(value);
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto it = _cache.find(key);
+    if (it == _cache.end()) {
+      auto new_scalar = std::make_unique<scalar_type_t<T>>(value, true, stream);
+      // One-time synchronization makes the cached value visible to all streams
+      stream.synchronize();
+      it = _cache.emplace(key, std::move(new_scalar)).first;
+    }
+    return *it->second;
+  }
+
+  /**
+   * @brief Removes all cached scalars, invalidating previously returned references.
+   */
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _cache.clear();
+  }
+
+  /**
+   * @brief Returns the number of distinct scalars currently cached.
+   */
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _cache.size();
+  }
+
+ private:
+  using key_type = std::pair<std::int32_t, std::uint64_t>;  ///< type id and value bit pattern
+
+  template <typename T>
+  static key_type make_key(T const& value)
+  {
+    static_assert(sizeof(T) <= sizeof(std::uint64_t), "Value too large for bit-pattern key.");
+    std::uint64_t bits{0};
+    std::memcpy(&bits, &value, sizeof(T));
+    return {static_cast<std::int32_t>(type_to_id<T>()), bits};
+  }
+
+  std::map<key_type, std::unique_ptr<scalar>> _cache;
+  mutable std::mutex _mutex;
+};
+
+/**
+ * @brief Returns the process-wide scalar pool.
+ *
+ * Scalars cached here live until process exit or an explicit `clear()`; callers holding
+ * many distinct literals should prefer a locally scoped `scalar_pool`.
+ */
+scalar_pool& get_scalar_pool();
+
+}  // namespace detail
+}  // namespace cudf
@@ -35,6 +35,9 @@
 
 #include <thrust/uninitialized_fill.h>
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace cudf {
 namespace detail {
 
@@ -341,6 +344,77 @@ struct column_scatterer_impl<struct_view> {
   }
 };
 
+/**
+ * @brief Kernel scattering a batch of equal-width fixed-size columns.
+ *
+ * The counterpart of `gather_fused_kernel`: each thread reads a scatter map
+ * entry once and writes that row for every column in the batch.
+ */
+template <typename Element, typename MapIterator>
+__global__ void scatter_fused_kernel(Element const* const* sources,
+                                     Element* const* destinations,
+                                     size_type num_columns,
+                                     size_type num_rows,
+                                     MapIterator scatter_map)
+{
+  size_type source_row = threadIdx.x + blockIdx.x * blockDim.x;
+  while (source_row < num_rows) {
+    auto const destination_row = scatter_map[source_row];
+    for (size_type i = 0; i < num_columns; ++i) {
+      destinations[i][destination_row] = sources[i][source_row];
+    }
+    source_row += blockDim.x * gridDim.x;
+  }
+}
+
+/**
+ * @brief Scatters a group of fixed-size columns of the same element width with
+ * a single kernel launch.
+ *
+ * Used by the table-level scatter below to batch fixed-width columns so that a
+ * wide table pays one scatter launch per distinct element width rather than one
+ * per column.
+ *
+ * @param element_width Size in bytes of each column's element type; must be 1, 2, 4 or 8
+ * @param source_data Device pointers to the first element of each source column
+ * @param destination_data Device pointers to the first element of each destination column
+ * @param num_rows Number of rows to scatter
+ * @param scatter_map_begin Start of the scatter map
+ * @param stream CUDA stream used for kernel launches
+ */
+template <typename MapIterator>
+void scatter_fused(std::size_t element_width,
+                   std::vector<void const*> const& source_data,
+                   std::vector<void*> const& destination_data,
+                   size_type num_rows,
+                   MapIterator scatter_map_begin,
+                   rmm::cuda_stream_view stream)
+{
+  auto const num_columns = static_cast<size_type>(source_data.size());
+  auto const d_sources   = make_device_uvector_async(source_data, stream);
+  auto d_destinations    = make_device_uvector_async(destination_data, stream);
+
+  constexpr size_type block_size = 256;
+  auto const grid                = grid_1d{num_rows, block_size};
+  auto launch                    = [&](auto dummy) {
+    using Element = decltype(dummy);
+    scatter_fused_kernel<Element>
+      <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+        reinterpret_cast<Element const* const*>(d_sources.data()),
+        reinterpret_cast<Element* const*>(d_destinations.data()),
+        num_columns,
+        num_rows,
+        scatter_map_begin);
+  };
+  switch (element_width) {
+    case 1: launch(uint8_t{}); break;
+    case 2: launch(uint16_t{}); break;
+    case 4: launch(uint32_t{}); break;
+    case 8: launch(uint64_t{}); break;
+    default: CUDF_FAIL("Unsupported element width for fused scatter");
+  }
+}
+
 /**
  * @brief Scatters the rows of the source table into a copy of the target table
  * according to a scatter map.
@@ -409,20 +483,52 @@ std::unique_ptr<table> scatter(
     thrust::make_transform_iterator(scatter_map_end, index_converter<MapType>{target.num_rows()});
   auto result = std::vector<std::unique_ptr<column>>(target.num_columns());
 
-  std::transform(source.begin(),
-                 source.end(),
-                 target.begin(),
-                 result.begin(),
-                 [=](auto const& source_col, auto const& target_col) {
-                   return type_dispatcher<dispatch_storage_type>(source_col.type(),
-                                                                 column_scatterer{},
-                                                                 source_col,
-                                                                 updated_scatter_map_begin,
-                                                                 updated_scatter_map_end,
-                                                                 target_col,
-                                                                 stream,
-                                                                 mr);
-                 });
+  auto const scatter_rows =
+    static_cast<size_type>(std::distance(scatter_map_begin, scatter_map_end));
+
+  // Group fixed-size columns of the same element width and scatter each group
+  // through a single fused kernel, so a wide table pays one scatter launch per
+  // distinct width instead of one per column. The copy of each target column
+  // still happens per column.
+  if (scatter_rows > 0) {
+    std::unordered_map<std::size_t, std::vector<size_type>> width_groups;
+    for (size_type i = 0; i < target.num_columns(); ++i) {
+      auto const& source_col = source.column(i);
+      if (not cudf::is_fixed_width(source_col.type()) or
+          source_col.type() != target.column(i).type()) {
+        continue;
+      }
+      auto const width = cudf::size_of(source_col.type());
+      if (width == 1 or width == 2 or width == 4 or width == 8) {
+        width_groups[width].push_back(i);
+      }
+    }
+    for (auto const& [width, group] : width_groups) {
+      if (group.size() < 2) { continue; }  // a lone column gains nothing from fusing
+      std::vector<void const*> source_data;
+      std::vector<void*> destination_data;
+      for (auto const i : group) {
+        auto const& source_col = source.column(i);
+        result[i]              = std::make_unique<column>(target.column(i), stream, mr);
+        source_data.push_back(source_col.head<unsigned char>() + width * source_col.offset());
+        destination_data.push_back(result[i]->mutable_view().head());
+      }
+      scatter_fused(
+        width, source_data, destination_data, scatter_rows, updated_scatter_map_begin, stream);
+    }
+  }
+
+  for (size_type i = 0; i < target.num_columns(); ++i) {
+    if (result[i] != nullptr) { continue; }  // scattered by a fused batch above
+    result[i] = type_dispatcher<dispatch_storage_type>(source.column(i).type(),
+                                                       column_scatterer{},
+                                                       source.column(i),
+                                                       updated_scatter_map_begin,
+                                                       updated_scatter_map_end,
+                                                       target.column(i),
+                                                       stream,
+                                                       mr);
+  }
 
   // We still need to call `gather_bitmask` even when the source columns are not nullable,
   // as if the target has null_mask, that null_mask needs to be updated after scattering.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/tdigest/tdigest_column_view.cuh>
 #include <cudf/types.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -23,6 +24,28 @@ namespace detail {
 
 namespace tdigest {
 
+/**
+ * @copydoc cudf::tdigest::create_tdigest
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> create_tdigest(
+  column_view const& input,
+  int max_centroids,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::tdigest::merge_tdigests
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> merge_tdigests(
+  cudf::tdigest::tdigest_column_view const& input,
+  int max_centroids,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Create a tdigest column from it's constituent components.
  *
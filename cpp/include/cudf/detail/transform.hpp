@@ -36,6 +36,20 @@ std::unique_ptr<column> transform(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::transform(table_view const&, std::string const&, std::vector<data_type> const&,
+ * bool, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> transform(
+  table_view const& inputs,
+  std::string const& transform_udf,
+  std::vector<data_type> const& output_types,
+  bool is_ptx,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::compute_column
  *
@@ -274,6 +274,13 @@ MurmurHash3_32<numeric::decimal64>::operator()(numeric::decimal64 const& key) co
   return this->compute(key.value());
 }
 
+template <>
+hash_value_type CUDA_DEVICE_CALLABLE
+MurmurHash3_32<numeric::decimal128>::operator()(numeric::decimal128 const& key) const
+{
+  return this->compute(key.value());
+}
+
 template <>
 hash_value_type CUDA_DEVICE_CALLABLE
 MurmurHash3_32<cudf::list_view>::operator()(cudf::list_view const& key) const
@@ -419,6 +426,13 @@ SparkMurmurHash3_32<numeric::decimal64>::operator()(numeric::decimal64 const& ke
   return this->compute<uint64_t>(key.value());
 }
 
+template <>
+hash_value_type CUDA_DEVICE_CALLABLE
+SparkMurmurHash3_32<numeric::decimal128>::operator()(numeric::decimal128 const& key) const
+{
+  return this->compute<__int128_t>(key.value());
+}
+
 template <>
 hash_value_type CUDA_DEVICE_CALLABLE
 SparkMurmurHash3_32<cudf::list_view>::operator()(cudf::list_view const& key) const
@@ -497,6 +511,211 @@ SparkMurmurHash3_32<double>::operator()(double const& key) const
   return this->compute_floating_point(key);
 }
 
+// XXHash_64 implementation from
+// https://github.com/Cyan4973/xxHash
+//-----------------------------------------------------------------------------
+// xxHash - Extremely Fast Hash algorithm
+// Copyright (C) 2012-2021 Yann Collet
+// BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  XXHash_64() = default;
+  constexpr XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int8_t r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  // Callable from the host as well so that e.g. the parquet writer/reader can hash
+  // host-side filter literals consistently with device-side column values
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  // compute wrapper for floating point types
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_floating_point(T const& key) const
+  {
+    if (key == T{0.0}) {
+      return compute(T{0.0});
+    } else if (isnan(key)) {
+      T nan = std::numeric_limits<T>::quiet_NaN();
+      return compute(nan);
+    } else {
+      return compute(key);
+    }
+  }
+
+  template <typename TKey>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(TKey));
+  }
+
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(uint8_t const* data, int len) const
+  {
+    constexpr uint64_t prime1 = 0x9e3779b185ebca87ul;
+    constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4ful;
+    constexpr uint64_t prime3 = 0x165667b19e3779f9ul;
+    constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ul;
+    constexpr uint64_t prime5 = 0x27d4eb2f165667c5ul;
+
+    // Individual byte reads for unaligned accesses (very likely for strings)
+    auto getblock32 = [](uint8_t const* q) -> uint64_t {
+      return q[0] | (q[1] << 8) | (q[2] << 16) | (static_cast<uint32_t>(q[3]) << 24);
+    };
+    auto getblock64 = [getblock32](uint8_t const* q) -> uint64_t {
+      return getblock32(q) | (getblock32(q + 4) << 32);
+    };
+    auto round = [this](uint64_t acc, uint64_t input) -> uint64_t {
+      return rotl64(acc + input * prime2, 31) * prime1;
+    };
+
+    uint8_t const* const end = data + len;
+    uint64_t h64;
+
+    if (len >= 32) {
+      uint8_t const* const limit = end - 32;
+      uint64_t v1                = m_seed + prime1 + prime2;
+      uint64_t v2                = m_seed + prime2;
+      uint64_t v3                = m_seed;
+      uint64_t v4                = m_seed - prime1;
+
+      do {
+        v1 = round(v1, getblock64(data));
+        v2 = round(v2, getblock64(data + 8));
+        v3 = round(v3, getblock64(data + 16));
+        v4 = round(v4, getblock64(data + 24));
+        data += 32;
+      } while (data <= limit);
+
+      h64 = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+
+      h64 = (h64 ^ round(0, v1)) * prime1 + prime4;
+      h64 = (h64 ^ round(0, v2)) * prime1 + prime4;
+      h64 = (h64 ^ round(0, v3)) * prime1 + prime4;
+      h64 = (h64 ^ round(0, v4)) * prime1 + prime4;
+    } else {
+      h64 = m_seed + prime5;
+    }
+
+    h64 += len;
+
+    while (data + 8 <= end) {
+      h64 ^= round(0, getblock64(data));
+      h64 = rotl64(h64, 27) * prime1 + prime4;
+      data += 8;
+    }
+    if (data + 4 <= end) {
+      h64 ^= getblock32(data) * prime1;
+      h64 = rotl64(h64, 23) * prime2 + prime3;
+      data += 4;
+    }
+    while (data < end) {
+      h64 ^= (*data) * prime5;
+      h64 = rotl64(h64, 11) * prime1;
+      ++data;
+    }
+
+    // avalanche
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+  }
+
+  /**
+   * @brief  Combines two hash values into a new single hash value. Called
+   * repeatedly to create a hash value from several variables.
+   * Taken from the Boost hash_combine function, modified for 64-bit
+   * https://www.boost.org/doc/libs/1_35_0/doc/html/boost/hash_combine_id241013.html
+   *
+   * @param lhs The first hash value to combine
+   * @param rhs The second hash value to combine
+   *
+   * @returns A hash value that intelligently combines the lhs and rhs hash values
+   */
+  constexpr result_type hash_combine(result_type lhs, result_type rhs) const
+  {
+    result_type combined{lhs};
+
+    combined ^= rhs + 0x9e3779b97f4a7c15 + (combined << 6) + (combined >> 2);
+
+    return combined;
+  }
+
+ private:
+  uint64_t m_seed{cudf::DEFAULT_HASH_SEED};
+};
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<bool>::operator()(bool const& key) const
+{
+  return this->compute(static_cast<uint8_t>(key));
+}
+
+/**
+ * @brief Specialization of XXHash_64 operator for strings.
+ */
+template <>
+uint64_t CUDA_DEVICE_CALLABLE XXHash_64<cudf::string_view>::operator()(
+  cudf::string_view const& key) const
+{
+  return this->compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<float>::operator()(float const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<double>::operator()(double const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<numeric::decimal32>::operator()(numeric::decimal32 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<numeric::decimal64>::operator()(numeric::decimal64 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<numeric::decimal128>::operator()(numeric::decimal128 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE XXHash_64<cudf::list_view>::operator()(cudf::list_view const& key) const
+{
+  cudf_assert(false && "List column hashing is not supported");
+  return 0;
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<cudf::struct_view>::operator()(cudf::struct_view const& key) const
+{
+  cudf_assert(false && "Direct hashing of struct_view is not supported");
+  return 0;
+}
+
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
  * reinterpreted as the result_type of the functor.
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief A kernel launch configuration managed by the launch config registry.
+ */
+struct launch_config {
+  size_type block_size;            ///< Threads per block
+  size_type items_per_thread{1};   ///< Elements processed by each thread
+};
+
+/**
+ * @brief Returns the tuned launch configuration for a kernel, or `fallback`.
+ *
+ * Looks `kernel_name` up in the in-process registry, which is seeded from the
+ * per-device profile persisted under the kernel cache directory (the same
+ * location the JIT kernel cache uses, overridable with the
+ * `LIBCUDF_KERNEL_CACHE_PATH` environment variable). Returns `fallback` when
+ * no profile has been recorded for this kernel on the installed GPU.
+ *
+ * @param kernel_name Registry key identifying the kernel. Must not contain whitespace.
+ * @param fallback Configuration to use when the kernel has not been tuned
+ * @return The tuned or fallback launch configuration
+ */
+launch_config get_launch_config(std::string const& kernel_name, launch_config fallback);
+
+/**
+ * @brief Selects the fastest of `candidates` for a kernel and persists the winner.
+ *
+ * On the first call for `kernel_name` on a given device, each candidate is
+ * passed to `launch` once to warm up and then timed with CUDA events on
+ * `stream`; the fastest candidate is recorded in the registry and appended to
+ * the on-disk profile so later calls — and later processes — skip the
+ * benchmark and return the winner directly.
+ *
+ * Because every candidate is actually executed, `launch` must be idempotent:
+ * repeating it any number of times must produce the same result as running it
+ * once. Tuning synchronizes `stream` to read back the event timings.
+ *
+ * @param kernel_name Registry key identifying the kernel. Must not contain whitespace.
+ * @param candidates Launch configurations to benchmark. Must not be empty.
+ * @param launch Callable that launches the kernel with a given configuration
+ * @param stream CUDA stream used for the benchmark launches
+ * @return The fastest launch configuration
+ */
+launch_config tune_launch_config(std::string const& kernel_name,
+                                 std::vector<launch_config> const& candidates,
+                                 std::function<void(launch_config const&)> const& launch,
+                                 rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
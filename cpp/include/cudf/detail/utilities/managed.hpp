@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/managed.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @copydoc cudf::prefetch(column_view const&)
+ *
+ * @param stream CUDA stream used for the prefetch
+ */
+void prefetch(column_view const& input,
+              rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::prefetch(table_view const&)
+ *
+ * @param stream CUDA stream used for the prefetch
+ */
+void prefetch(table_view const& input,
+              rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+}  // namespace detail
+}  // namespace cudf
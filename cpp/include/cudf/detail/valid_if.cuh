@@ -68,10 +68,15 @@ __global__ void valid_if_kernel(
 
 /**
  * @brief Generate a bitmask where every bit is set for which a predicate is
- * `true` over the elements in `[begin,end)`.
+ * `true` over the elements in `[begin,end)` without synchronizing the stream.
  *
  * Bit `i` in the output mask will be set if `p(*(begin+i)) == true`.
  *
+ * The number of set bits is accumulated into the caller-provided device
+ * memory `valid_count` which must be zero-initialized; no host-visible value
+ * is produced so the call adds no implicit synchronization. The count is only
+ * valid once the stream has been synchronized.
+ *
  * If `distance(begin,end) == 0`, returns an empty `rmm::device_buffer`.
  *
  * @throws cudf::logic_error if `(begin > end)`
@@ -79,15 +84,16 @@ __global__ void valid_if_kernel(
  * @param begin The beginning of the sequence
  * @param end The end of the sequence
  * @param p The predicate
+ * @param valid_count Zero-initialized device memory the set-bit count is added to
  * @param stream CUDA stream used for device memory operations and kernel launches.
- * @return A pair containing a `device_buffer` with the new bitmask and it's
- * null count
+ * @return A `device_buffer` with the new bitmask
  */
 template <typename InputIterator, typename Predicate>
-std::pair<rmm::device_buffer, size_type> valid_if(
+rmm::device_buffer valid_if_async(
   InputIterator begin,
   InputIterator end,
   Predicate p,
+  size_type* valid_count,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -97,18 +103,47 @@ std::pair<rmm::device_buffer, size_type> valid_if(
 
   auto null_mask = detail::create_null_mask(size, mask_state::UNINITIALIZED, stream, mr);
 
-  size_type null_count{0};
   if (size > 0) {
-    rmm::device_scalar<size_type> valid_count{0, stream};
-
     constexpr size_type block_size{256};
     grid_1d grid{size, block_size};
 
     valid_if_kernel<block_size><<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-      static_cast<bitmask_type*>(null_mask.data()), begin, size, p, valid_count.data());
-
-    null_count = size - valid_count.value(stream);
+      static_cast<bitmask_type*>(null_mask.data()), begin, size, p, valid_count);
   }
+  return null_mask;
+}
+
+/**
+ * @brief Generate a bitmask where every bit is set for which a predicate is
+ * `true` over the elements in `[begin,end)`.
+ *
+ * Bit `i` in the output mask will be set if `p(*(begin+i)) == true`.
+ *
+ * If `distance(begin,end) == 0`, returns an empty `rmm::device_buffer`.
+ *
+ * @throws cudf::logic_error if `(begin > end)`
+ *
+ * @param begin The beginning of the sequence
+ * @param end The end of the sequence
+ * @param p The predicate
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return A pair containing a `device_buffer` with the new bitmask and it's
+ * null count
+ */
+template <typename InputIterator, typename Predicate>
+std::pair<rmm::device_buffer, size_type> valid_if(
+  InputIterator begin,
+  InputIterator end,
+  Predicate p,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  size_type const size = thrust::distance(begin, end);
+
+  rmm::device_scalar<size_type> valid_count{0, stream};
+  auto null_mask = valid_if_async(begin, end, p, valid_count.data(), stream, mr);
+
+  size_type const null_count = size > 0 ? size - valid_count.value(stream) : 0;
   return std::make_pair(std::move(null_mask), null_count);
 }
 
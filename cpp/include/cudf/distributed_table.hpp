@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup table_classes
+ * @{
+ * @file
+ * @brief Experimental single-node multi-GPU table abstraction
+ */
+
+/**
+ * @brief A table sharded across the GPUs of a single node (experimental).
+ *
+ * Each shard is an ordinary cudf table resident on one device; shard order
+ * defines row order. Cross-device operations move data directly between GPUs
+ * with peer copies (NVLink where available) instead of bouncing through host
+ * memory, using the packed-buffer format from `cudf::pack` so each shard
+ * transfer is one contiguous copy.
+ *
+ * Call `enable_peer_access` once for the participating devices before using
+ * cross-device operations; without peer access the copies fall back to the
+ * driver's PCIe path but remain correct.
+ *
+ * This interface is experimental: it covers shard-local access, gathering all
+ * shards to one device, and hash repartitioning across the shard devices.
+ * Rebuilding a shard from a received packed buffer currently performs one
+ * device-local copy to take ownership.
+ */
+class distributed_table {
+ public:
+  /**
+   * @brief One shard of a distributed table: a device id and the table resident on it.
+   */
+  struct shard {
+    int device_id;                ///< CUDA device the table is resident on
+    std::unique_ptr<table> data;  ///< The shard's rows
+  };
+
+  /**
+   * @brief Constructs a distributed table from per-device shards.
+   *
+   * @throws cudf::logic_error if `shards` is empty, a shard table is null, or
+   * the shard column types do not match
+   *
+   * @param shards The shards, in row order
+   */
+  explicit distributed_table(std::vector<shard>&& shards);
+
+  /**
+   * @brief Returns the number of shards.
+   */
+  size_type num_shards() const noexcept { return static_cast<size_type>(_shards.size()); }
+
+  /**
+   * @brief Returns the total number of rows across all shards.
+   */
+  size_type num_rows() const;
+
+  /**
+   * @brief Returns the device a shard is resident on.
+   */
+  int shard_device(size_type shard_index) const { return _shards.at(shard_index).device_id; }
+
+  /**
+   * @brief Returns a view of a shard's rows.
+   *
+   * The view is only valid for use on the shard's device.
+   */
+  table_view shard_view(size_type shard_index) const { return _shards.at(shard_index).data->view(); }
+
+  /**
+   * @brief Enables bidirectional peer access between all pairs of the given devices.
+   *
+   * Pairs that do not support peer access are skipped; copies between them go
+   * through the driver instead.
+   *
+   * @param device_ids The devices to connect
+   */
+  static void enable_peer_access(std::vector<int> const& device_ids);
+
+  /**
+   * @brief Concatenates all shards into a single table on one device.
+   *
+   * Shards resident on other devices are packed and peer-copied to
+   * `device_id` before concatenation.
+   *
+   * @param device_id The device the result is allocated on
+   * @return The concatenated table, in shard order
+   */
+  std::unique_ptr<table> gather_to(int device_id) const;
+
+  /**
+   * @brief Repartitions the rows across the shard devices by key hash.
+   *
+   * Each shard is hash-partitioned locally into one packed buffer per target
+   * device and the buffers are exchanged with peer copies, so rows with equal
+   * keys end up on the same device. The result has one shard per current
+   * shard device.
+   *
+   * @throws cudf::logic_error if `columns_to_hash` is empty
+   *
+   * @param columns_to_hash Indices of the key columns
+   * @param hash_function Optional hash id that chooses the hash function to use
+   * @param seed Optional seed value to the hash function
+   * @return A new distributed table partitioned by key hash
+   */
+  distributed_table hash_partition(std::vector<size_type> const& columns_to_hash,
+                                   hash_id hash_function = hash_id::HASH_MURMUR3,
+                                   uint32_t seed         = DEFAULT_HASH_SEED) const;
+
+ private:
+  std::vector<shard> _shards;
+};
+
+/** @} */  // end of group
+
+}  // namespace cudf
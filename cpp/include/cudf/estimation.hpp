@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace estimation {
+/**
+ * @addtogroup estimation
+ * @{
+ * @file
+ * @brief Sampled cardinality estimation utilities for query planners
+ */
+
+/**
+ * @brief Estimates the number of distinct values in a column from a random sample.
+ *
+ * Samples `sample_size` rows without replacement, hashes them, and extrapolates
+ * the distinct count of the whole column using the Duj1 estimator on the sample
+ * value frequencies. The result is clamped to `[1, input.size()]`. Nulls count
+ * as a single distinct value.
+ *
+ * The estimate is cheap but approximate; it is intended for planner heuristics
+ * such as join ordering, not for exact results (use `cudf::distinct_count` for
+ * those).
+ *
+ * @param input Column to estimate the distinct count of
+ * @param sample_size Maximum number of rows to sample
+ * @param seed Seed for the random row sampling
+ * @return Estimated number of distinct values
+ */
+double estimate_distinct_count(column_view const& input,
+                               size_type sample_size = 8192,
+                               int64_t seed          = 0);
+
+/**
+ * @brief Builds approximate equi-depth histogram bucket boundaries from a sample.
+ *
+ * Samples `sample_size` rows without replacement, sorts the sample, and returns
+ * the values found at the `num_buckets + 1` evenly spaced sample quantiles. The
+ * boundaries are of the input type; consecutive boundaries delimit buckets that
+ * hold approximately equal row counts.
+ *
+ * @throws cudf::logic_error if `num_buckets` is not positive
+ *
+ * @param input Column to build the histogram over
+ * @param num_buckets Number of equi-depth buckets
+ * @param sample_size Maximum number of rows to sample
+ * @param seed Seed for the random row sampling
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Column of `num_buckets + 1` ascending bucket boundary values
+ */
+std::unique_ptr<column> equidepth_histogram(
+  column_view const& input,
+  size_type num_buckets,
+  size_type sample_size               = 8192,
+  int64_t seed                        = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Estimates the selectivity of an inner equi-join from samples of both key columns.
+ *
+ * Estimates the distinct counts of both key columns from samples and applies
+ * the standard uniformity assumption `1 / max(ndv(left), ndv(right))`. The
+ * expected inner join output size is the returned selectivity multiplied by
+ * `left.size() * right.size()`.
+ *
+ * @param left Left join key column
+ * @param right Right join key column
+ * @param sample_size Maximum number of rows to sample from each column
+ * @param seed Seed for the random row sampling
+ * @return Estimated join selectivity in `(0, 1]`
+ */
+double estimate_join_selectivity(column_view const& left,
+                                 column_view const& right,
+                                 size_type sample_size = 8192,
+                                 int64_t seed          = 0);
+
+/**
+ * @brief Builds a count-min sketch of the value frequencies in a column.
+ *
+ * The sketch is a `depth x width` grid of counters returned as a flat UINT64
+ * column in row-major order. Each non-null input row increments one counter
+ * per sketch row, so the estimated frequency of a value is the minimum of its
+ * `depth` counters: an overestimate by at most `2 * N / width` with
+ * probability `1 - 0.5^depth`, and never an underestimate. Null rows are not
+ * counted.
+ *
+ * Sketches built with the same `width`, `depth` and `seed` are mergeable:
+ * adding two sketches element-wise yields the sketch of the concatenated
+ * inputs, so partial sketches from multiple batches or devices combine
+ * without rescanning the data.
+ *
+ * @throws cudf::logic_error if `width` or `depth` is not positive
+ *
+ * @param input Column to sketch
+ * @param width Number of counters per sketch row
+ * @param depth Number of independently hashed sketch rows
+ * @param seed Seed for the sketch hash family
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return UINT64 column of `depth * width` counters
+ */
+std::unique_ptr<column> count_min_sketch(
+  column_view const& input,
+  size_type width                     = 4096,
+  size_type depth                     = 5,
+  uint32_t seed                       = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the `k` candidate values with the highest sketched frequencies.
+ *
+ * Estimates the frequency of each candidate from a count-min sketch built by
+ * `count_min_sketch` and returns a two-column table holding the top `k`
+ * candidates ordered by decreasing estimate: the candidate values (of the
+ * candidates' type) and their estimated counts (UINT64). The candidates are
+ * typically the distinct values of a sample or batch of the sketched data;
+ * values absent from the candidates cannot be reported regardless of their
+ * true frequency.
+ *
+ * `depth` and `seed` must match the values the sketch was built with; `width`
+ * is derived from the sketch size.
+ *
+ * @throws cudf::logic_error if `k` is not positive, if the sketch is not a
+ * UINT64 column with a size divisible by `depth`, or if the candidates
+ * contain nulls
+ *
+ * @param sketch Counter column returned by `count_min_sketch`
+ * @param candidates Column of candidate values to rank
+ * @param k Number of top candidates to return
+ * @param depth Number of sketch rows used to build the sketch
+ * @param seed Seed the sketch was built with
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table of the top `k` candidate values and their estimated counts
+ */
+std::unique_ptr<table> topk_from_sketch(
+  column_view const& sketch,
+  column_view const& candidates,
+  size_type k,
+  size_type depth                     = 5,
+  uint32_t seed                       = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+
+}  // namespace estimation
+}  // namespace cudf
@@ -161,8 +161,19 @@ std::unique_ptr<table> repeat(
  * step = 2
  * return = [0, 2, 4]
  * ```
- * @throws cudf::logic_error if @p init and @p step are not the same type.
- * @throws cudf::logic_error if scalar types are not numeric.
+ * Timestamp sequences at a fixed interval are generated by passing a timestamp @p init
+ * and a duration @p step of the same resolution:
+ *
+ * ```
+ * size = 3
+ * init = 2020-01-01 00:00:00 (TIMESTAMP_SECONDS)
+ * step = 3600 (DURATION_SECONDS)
+ * return = [2020-01-01 00:00:00, 2020-01-01 01:00:00, 2020-01-01 02:00:00]
+ * ```
+ *
+ * @throws cudf::logic_error if @p init and @p step are not the same type, unless @p init is a
+ * timestamp and @p step a duration of matching resolution.
+ * @throws cudf::logic_error if scalar types are not numeric or timestamp/duration.
  * @throws cudf::logic_error if @p size is < 0.
  *
  * @param size Size of the output column
@@ -177,6 +188,41 @@ std::unique_ptr<column> sequence(
   scalar const& step,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Fills a column with sequences that restart at every change of group label.
+ *
+ * Rows with equal consecutive values in @p group_labels belong to the same group. Within
+ * each group the output starts over at @p init and increments by @p step, so for row `i`
+ * in a group beginning at row `g`, `output[i] = init + (i - g) * step`. With `init = 0`
+ * and `step = 1` this yields a per-group row number.
+ *
+ * ```
+ * group_labels = [0, 0, 0, 1, 1, 2]
+ * init = 0
+ * step = 1
+ * return = [0, 1, 2, 0, 1, 0]
+ * ```
+ *
+ * Null labels compare equal to each other, so a run of null labels forms one group.
+ * Labels are compared only to their immediate neighbors; equal labels in
+ * non-contiguous runs form separate groups.
+ *
+ * @throws cudf::logic_error if @p init and @p step are not the same type.
+ * @throws cudf::logic_error if scalar types are not numeric.
+ * @throws cudf::logic_error if @p group_labels is a nested type.
+ *
+ * @param group_labels Column of group labels, with equal consecutive labels forming groups
+ * @param init First value of each group's sequence
+ * @param step Increment value
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return std::unique_ptr<column> The result column containing the per-group sequences
+ */
+std::unique_ptr<column> sequence_by_group(
+  column_view const& group_labels,
+  scalar const& init,
+  scalar const& step,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Fills a column with a sequence of value specified by an initial value and a step of 1.
  *
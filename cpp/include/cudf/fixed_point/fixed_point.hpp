@@ -48,7 +48,9 @@ enum class Radix : int32_t { BASE_2 = 2, BASE_10 = 10 };
 template <typename T>
 constexpr inline auto is_supported_representation_type()
 {
-  return cuda::std::is_same_v<T, int32_t> || cuda::std::is_same_v<T, int64_t>;
+  return cuda::std::is_same_v<T, int32_t> ||  //
+         cuda::std::is_same_v<T, int64_t> ||  //
+         cuda::std::is_same_v<T, __int128_t>;
 }
 
 template <typename T>
@@ -151,6 +153,42 @@ CUDA_HOST_DEVICE_CALLABLE constexpr T shift(T const& val, scale_type const& scal
     return left_shift<Rep, Rad>(val, scale);
 }
 
+/**
+ * @brief Host-side absolute value that also covers `__int128_t`
+ */
+template <typename T>
+constexpr auto abs(T value)
+{
+  return value >= 0 ? value : -value;
+}
+
+/**
+ * @brief Host-side string conversion that also covers `__int128_t`
+ *
+ * `std::to_string` has no overload for `__int128_t`, so the digits are peeled
+ * off manually for that representation type.
+ */
+template <typename T>
+inline std::string to_string(T value)
+{
+  if constexpr (cuda::std::is_same_v<T, __int128_t>) {
+    if (value == 0) return "0";
+    auto const negative = value < 0;
+    auto s              = std::string{};
+    while (value != 0) {
+      // remainder handles the sign, avoiding overflow on the lowest value
+      auto const digit = static_cast<int>(value % 10);
+      s.push_back(static_cast<char>('0' + (negative ? -digit : digit)));
+      value /= 10;
+    }
+    if (negative) s.push_back('-');
+    std::reverse(s.begin(), s.end());
+    return s;
+  } else {
+    return std::to_string(value);
+  }
+}
+
 }  // namespace detail
 
 /**
@@ -551,17 +589,17 @@ class fixed_point {
   explicit operator std::string() const
   {
     if (_scale < 0) {
-      auto const av   = std::abs(_value);
-      int64_t const n = std::pow(10, -_scale);
-      int64_t const f = av % n;
+      auto const av = detail::abs(_value);
+      Rep const n   = detail::ipow<Rep, Radix::BASE_10>(-_scale);
+      Rep const f   = av % n;
       auto const num_zeros =
-        std::max(0, (-_scale - static_cast<int32_t>(std::to_string(f).size())));
+        std::max(0, (-_scale - static_cast<int32_t>(detail::to_string(f).size())));
       auto const zeros = std::string(num_zeros, '0');
       auto const sign  = _value < 0 ? std::string("-") : std::string();
-      return sign + std::to_string(av / n) + std::string(".") + zeros + std::to_string(av % n);
+      return sign + detail::to_string(av / n) + std::string(".") + zeros + detail::to_string(f);
     } else {
       auto const zeros = std::string(_scale, '0');
-      return std::to_string(_value) + zeros;
+      return detail::to_string(_value) + zeros;
     }
   }
 };
@@ -752,8 +790,9 @@ CUDA_HOST_DEVICE_CALLABLE bool operator>(fixed_point<Rep1, Rad1> const& lhs,
   return lhs.rescaled(scale)._value > rhs.rescaled(scale)._value;
 }
 
-using decimal32 = fixed_point<int32_t, Radix::BASE_10>;
-using decimal64 = fixed_point<int64_t, Radix::BASE_10>;
+using decimal32  = fixed_point<int32_t, Radix::BASE_10>;
+using decimal64  = fixed_point<int64_t, Radix::BASE_10>;
+using decimal128 = fixed_point<__int128_t, Radix::BASE_10>;
 
 /** @} */  // end of group
 }  // namespace numeric
@@ -23,6 +23,7 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <rmm/cuda_stream_view.hpp>
 
@@ -176,6 +177,7 @@ class groupby {
    *
    * @param requests The set of columns to aggregate and the aggregations to
    * perform
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
    * @return Pair containing the table with each group's unique key and
    * a vector of aggregation_results for each request in the same order as
@@ -183,6 +185,73 @@ class groupby {
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
     host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Performs grouped aggregations and returns mergeable partial states
+   * instead of final results.
+   *
+   * This is the first phase of two-phase (partial/final) aggregation, intended
+   * for distributed engines that aggregate each partition locally, shuffle the
+   * much smaller partial states, and combine them with `merge_aggregate`.
+   *
+   * For every aggregation in a request one state column is returned. State
+   * columns are final results for aggregations that merge with themselves
+   * (`SUM`, `MIN`, `MAX`), counts for `COUNT_VALID`/`COUNT_ALL`, a
+   * `STRUCT<sum, count>` column for `MEAN`, a `STRUCT<count, mean, m2>` column
+   * for `M2`/`VARIANCE`/`STD` (the layout consumed by `MERGE_M2`), and a
+   * tdigest column for `MEDIAN`/`QUANTILE`. Any other aggregation kind throws.
+   *
+   * To combine partials, concatenate the returned key tables and the state
+   * columns from all partitions, construct a `groupby` on the concatenated
+   * keys and call `merge_aggregate` with the concatenated state column and the
+   * original aggregations.
+   *
+   * @throws cudf::logic_error If an aggregation does not support partial
+   * aggregation or if `requests[i].values.size() != keys.num_rows()`.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results holding each aggregation's mergeable state
+   * column, in the same order as specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> partial_aggregate(
+    host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Combines partial aggregation states produced by `partial_aggregate`
+   * into final results.
+   *
+   * The keys of this groupby must be the concatenation of the key tables
+   * returned by the `partial_aggregate` calls being merged, and
+   * `requests[i].values` must be the matching concatenation of the state
+   * columns for `requests[i].aggregations[j]`, which must equal the
+   * aggregations given to `partial_aggregate`.
+   *
+   * Final results match a single-pass `aggregate` over the combined input,
+   * except that `MEDIAN` and `QUANTILE` are approximate (computed from merged
+   * tdigests with linear interpolation).
+   *
+   * @throws cudf::logic_error If an aggregation does not support partial
+   * aggregation, if a state column does not have the layout produced by
+   * `partial_aggregate`, or if `requests[i].values.size() != keys.num_rows()`.
+   *
+   * @param requests The set of state columns and the original aggregations
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> merge_aggregate(
+    host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
   /**
@@ -231,6 +300,7 @@ class groupby {
    * ```
    *
    * @param requests The set of columns to scan and the scans to perform
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
    * @return Pair containing the table with each group's key and
    * a vector of aggregation_results for each request in the same order as
@@ -238,6 +308,7 @@ class groupby {
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> scan(
     host_span<scan_request const> requests,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
   /**
@@ -284,6 +355,7 @@ class groupby {
    * @param values Table whose columns to be shifted
    * @param offsets The offsets by which to shift the input
    * @param fill_values Fill values for indeterminable outputs
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
    * @return Pair containing the tables with each group's key and the columns shifted
    *
@@ -294,6 +366,7 @@ class groupby {
     table_view const& values,
     host_span<size_type const> offsets,
     std::vector<std::reference_wrapper<const scalar>> const& fill_values,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
   /**
@@ -318,11 +391,13 @@ class groupby {
    * and the `values` of the `groups` object will be `nullptr`.
    *
    * @param values Table representing values on which a groupby operation is to be performed
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned tables's device memory in the
    * returned groups
    * @return A `groups` object representing grouped keys and values
    */
   groups get_groups(cudf::table_view values             = {},
+                    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
   /**
@@ -363,6 +438,7 @@ class groupby {
   std::pair<std::unique_ptr<table>, std::unique_ptr<table>> replace_nulls(
     table_view const& values,
     host_span<cudf::replace_policy const> replace_policies,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
  private:
@@ -375,9 +451,9 @@ class groupby {
   std::vector<null_order> _null_precedence{};            ///< If keys are sorted,
                                                          ///< indicates null order
                                                          ///< of each column
-  std::unique_ptr<detail::sort::sort_groupby_helper>
-    _helper;  ///< Helper object
-              ///< used by sort based implementation
+  std::shared_ptr<detail::sort::sort_groupby_helper>
+    _helper;  ///< Helper object used by sort based implementation; shared with
+              ///< the memoization cache when the keys are registered immutable
 
   /**
    * @brief Get the sort helper object
@@ -407,6 +483,98 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Performs grouped aggregations one hash partition at a time to bound
+ * peak device memory.
+ *
+ * The keys and all requested value columns are hash-partitioned on the keys
+ * into `num_partitions` chunks, each chunk is aggregated independently with
+ * `groupby::aggregate` and the per-chunk results are concatenated. Every key
+ * lands in exactly one chunk, so the concatenated output matches a single
+ * `groupby::aggregate` over the whole input for any supported aggregation —
+ * no merge step is needed.
+ *
+ * Each chunk is packed into one contiguous device buffer (see `cudf::pack`)
+ * which is freed as soon as its chunk has been aggregated, so the grouping
+ * intermediates (sort order, grouped values) only ever cover one chunk at a
+ * time. This is intended for high-cardinality groupbys whose intermediates do
+ * not fit in device memory alongside the input; choose `num_partitions` such
+ * that one chunk's working set fits.
+ *
+ * The order of rows in the result is arbitrary, as with
+ * `groupby::aggregate`.
+ *
+ * @throws cudf::logic_error If `num_partitions <= 0` or if
+ * `requests[i].values.size() != keys.num_rows()`.
+ *
+ * @param keys Table whose rows act as the groupby keys
+ * @param requests The set of columns to aggregate and the aggregations to
+ * perform
+ * @param num_partitions The number of chunks to split the input into
+ * @param null_handling Indicates whether rows in `keys` that contain NULL
+ * values should be included
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @return Pair containing the table with each group's unique key and
+ * a vector of aggregation_results for each request in the same order as
+ * specified in `requests`.
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> external_aggregate(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  size_type num_partitions,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */
+/**
+ * @brief Opt-in memoization of groupby work over immutable tables.
+ *
+ * Dashboards and other interactive workloads issue overlapping groupbys against the same
+ * resident tables. Once a keys table is registered immutable, `groupby::aggregate` caches
+ * its grouping pre-pass (the sort helper's group offsets and labels) and completed
+ * aggregation results, keyed by the table's identity (column device pointers, sizes,
+ * offsets and types), the groupby options and the aggregation set. Cache hits return deep
+ * copies of the stored results; the grouping pre-pass is shared directly.
+ *
+ * Registration is a promise: the table's device memory must not be modified or freed while
+ * it is registered, and a freed-then-reallocated table that lands on the same device
+ * pointers would alias a stale entry — deregister tables before releasing them. Access to
+ * a cached grouping pre-pass is not synchronized; concurrent aggregations over the same
+ * registered keys must be externally serialized.
+ */
+namespace memoization {
+
+/**
+ * @brief Registers a table as immutable, enabling caching of groupby work over it.
+ *
+ * @param table The table whose memory the caller promises not to modify or free
+ */
+void register_immutable(table_view const& table);
+
+/**
+ * @brief Deregisters a table and drops every cache entry derived from it.
+ *
+ * @param table A table previously passed to `register_immutable`
+ */
+void deregister(table_view const& table);
+
+/**
+ * @brief Drops all registrations and cached entries.
+ */
+void clear();
+
+/**
+ * @brief Sets the maximum number of entries kept in each cache (grouping pre-passes and
+ * aggregation results); least recently used entries are evicted beyond it.
+ *
+ * The default capacity is 64 entries per cache.
+ *
+ * @param max_entries Maximum number of entries to retain
+ */
+void set_capacity(std::size_t max_entries);
+
+}  // namespace memoization
+
 }  // namespace groupby
 }  // namespace cudf
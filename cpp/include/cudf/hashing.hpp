@@ -29,6 +29,9 @@ namespace cudf {
 /**
  * @brief Computes the hash value of each row in the input set of columns.
  *
+ * The output column type depends on the hash function: `HASH_MD5` produces a string column,
+ * `HASH_XXHASH64` a UINT64 column, and all other hash functions an INT32 column.
+ *
  * @param input The table of columns to hash.
  * @param hash_function The hash function enum to use.
  * @param initial_hash Optional host_span of initial hash values for each column.
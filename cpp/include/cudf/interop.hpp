@@ -75,6 +75,69 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+class dlpack_adopted_table;
+
+/**
+ * @brief Takes ownership of a DLPack tensor, wrapping it zero-copy when possible.
+ *
+ * If the tensor is device-resident on the current device, each column is contiguous
+ * (unit row stride) and the data pointer is aligned for the element type, no data is
+ * moved: the returned object exposes column views directly over the tensor's memory and
+ * retains the manager's deleter, invoking it on destruction. Otherwise the data is copied
+ * into new columns, exactly as `from_dlpack`, and the tensor is deleted once the copy
+ * completes.
+ *
+ * @note Unlike `from_dlpack`, this function takes ownership of the managed tensor in both
+ * paths; the caller must not use or delete it afterwards.
+ *
+ * @throw cudf::logic_error if any of the DLTensor fields are unsupported
+ *
+ * @param managed_tensor a 1D or 2D column-major (Fortran order) tensor
+ * @param mr Device memory resource used for the copy fallback
+ *
+ * @return Table adopting (or, on fallback, owning a copy of) the tensor data
+ */
+std::unique_ptr<dlpack_adopted_table> adopt_dlpack(
+  DLManagedTensor* managed_tensor,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief A table adopted from a DLPack tensor via `cudf::adopt_dlpack`.
+ *
+ * In the zero-copy case this owns the managed tensor and calls its deleter on
+ * destruction; the `table_view` returned by `view()` points into the tensor's memory and
+ * must not outlive this object. In the copy-fallback case it owns the copied columns
+ * instead and the tensor has already been deleted.
+ */
+class dlpack_adopted_table {
+ public:
+  ~dlpack_adopted_table();
+
+  dlpack_adopted_table(dlpack_adopted_table const&) = delete;
+  dlpack_adopted_table& operator=(dlpack_adopted_table const&) = delete;
+
+  /**
+   * @brief Returns a non-owning view of the adopted table.
+   */
+  table_view view() const;
+
+  /**
+   * @brief Returns true if the table aliases the tensor's memory rather than a copy.
+   */
+  bool is_zero_copy() const;
+
+ private:
+  friend std::unique_ptr<dlpack_adopted_table> adopt_dlpack(DLManagedTensor*,
+                                                            rmm::mr::device_memory_resource*);
+
+  dlpack_adopted_table(DLManagedTensor* tensor, std::vector<column_view>&& columns);
+  explicit dlpack_adopted_table(std::unique_ptr<table> copied);
+
+  DLManagedTensor* _tensor = nullptr;  ///< owned; nullptr when the copy fallback was taken
+  std::vector<column_view> _columns;   ///< zero-copy views into the tensor's memory
+  std::unique_ptr<table> _table;       ///< copy fallback
+};
+
 /** @} */  // end of group
 
 /**
@@ -126,5 +189,46 @@ std::unique_ptr<table> from_arrow(
   arrow::Table const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create an `arrow::Table` referencing the device buffers of `input` without copying
+ *
+ * Unlike `to_arrow`, no data leaves the device: each array's buffers point directly at the
+ * columns' device memory and share ownership of `input`, so the table stays alive as long
+ * as any buffer referencing it does. Only types whose layout cudf and Arrow share are
+ * supported: non-boolean primitive types (numeric, timestamp, duration), with an optional
+ * validity bitmask.
+ *
+ * @note The buffers of the returned arrays contain device pointers, as in a table produced
+ * by reading Arrow IPC data into device memory; they must not be dereferenced on the host.
+ *
+ * @throws cudf::logic_error if `metadata` is non-empty and its size doesn't match the number
+ * of columns, or if a column has an unsupported type
+ *
+ * @param input table to export; ownership is shared with the returned arrays
+ * @param metadata Contains names of the columns; empty names are used when omitted
+ * @return arrow Table viewing the device memory of `input`
+ */
+std::shared_ptr<arrow::Table> to_arrow_device(std::shared_ptr<table> input,
+                                              std::vector<column_metadata> const& metadata = {});
+
+/**
+ * @brief Create a non-owning `table_view` over the device buffers of the given arrow Table
+ *
+ * Zero-copy counterpart of `from_arrow` for Arrow data that is already resident in device
+ * memory, e.g. record batches received through Arrow CUDA IPC or Flight into device
+ * buffers. Each column must consist of exactly one chunk and have a type whose layout cudf
+ * and Arrow share: non-boolean primitive types (numeric, timestamp, duration), with an
+ * optional validity bitmask.
+ *
+ * The returned `table_view` does not own its memory; the caller must keep `input` alive for
+ * as long as the view (or anything derived from it) is in use.
+ *
+ * @throws cudf::logic_error if a column is chunked or has an unsupported type
+ *
+ * @param input arrow Table whose buffers reside in device memory
+ * @return non-owning `table_view` over the device buffers of `input`
+ */
+table_view from_arrow_device(arrow::Table const& input);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -633,6 +633,9 @@ class csv_reader_options {
   /**
    * @brief Sets per-column types
    *
+   * The map may cover only a subset of the columns; types of columns it leaves
+   * out are inferred from the data, and columns it covers skip type detection.
+   *
    * @param types Column name -> data type map specifying the columns' target data types
    */
   void set_dtypes(std::map<std::string, data_type> types) { _dtypes = std::move(types); }
@@ -1068,6 +1071,9 @@ class csv_reader_options_builder {
   /**
    * @brief Sets per-column types.
    *
+   * The map may cover only a subset of the columns; types of columns it leaves
+   * out are inferred from the data, and columns it covers skip type detection.
+   *
    * @param types Column name -> data type map specifying the columns' target data types
    * @return this for chaining.
    */
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/io/types.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -38,8 +39,10 @@ class data_sink {
    * @brief Create a sink from a file path
    *
    * @param[in] filepath Path to the file to use
+   * @param[in] gds cuFile policy for device writes to this file (the default is AUTO)
    */
-  static std::unique_ptr<data_sink> create(const std::string& filepath);
+  static std::unique_ptr<data_sink> create(const std::string& filepath,
+                                           gds_policy gds = gds_policy::AUTO);
 
   /**
    * @brief Create a sink from a std::vector
@@ -74,10 +74,12 @@ class datasource {
    * @param[in] filepath Path to the file to use
    * @param[in] offset Bytes from the start of the file (the default is zero)
    * @param[in] size Bytes from the offset; use zero for entire file (the default is zero)
+   * @param[in] gds cuFile policy for device reads from this file (the default is AUTO)
    */
   static std::unique_ptr<datasource> create(const std::string& filepath,
-                                            size_t offset = 0,
-                                            size_t size   = 0);
+                                            size_t offset  = 0,
+                                            size_t size    = 0,
+                                            gds_policy gds = gds_policy::AUTO);
 
   /**
    * @brief Creates a source from a memory buffer.
@@ -101,6 +103,27 @@ class datasource {
    */
   static std::unique_ptr<datasource> create(datasource* source);
 
+  /**
+   * @brief Creates a source that reads ahead a known list of extents from another source.
+   *
+   * The extents are fetched concurrently on a background thread pool as soon as the
+   * wrapper is created, so that subsequent reads overlap with storage latency instead
+   * of serializing on it. `host_read` calls that fall entirely within a prefetched
+   * extent are served from the cached buffer; all other reads, as well as device
+   * reads, fall through to the wrapped source.
+   *
+   * The wrapped source must support concurrent `host_read` calls (as the memory
+   * mapped and Arrow-based sources do).
+   *
+   * @param[in] source Owning pointer to the source to wrap
+   * @param[in] extents (offset, size) pairs that are expected to be read
+   * @param[in] num_threads Number of concurrent read-ahead threads
+   */
+  static std::unique_ptr<datasource> create_prefetched(
+    std::unique_ptr<datasource> source,
+    std::vector<std::pair<size_t, size_t>> const& extents,
+    size_t num_threads = 4);
+
   /**
    * @brief Creates a vector of datasources, one per element in the input vector.
    *
@@ -252,6 +275,19 @@ class datasource {
    */
   virtual bool is_empty() const { return size() == 0; }
 
+  /**
+   * @brief Returns a string that identifies the current content of the source, or an empty
+   * string when no such identity is available.
+   *
+   * File-backed sources combine the file path with its modification time and size, so the
+   * identity changes whenever the file does. Readers use it to cache data derived from the
+   * source — parsed footers, for instance — across calls. Sources without a stable identity
+   * (in-memory buffers, user implementations) return an empty string and are never cached.
+   *
+   * @return String identifying the source content; empty if the source cannot provide one
+   */
+  virtual std::string content_id() const { return std::string{}; }
+
   /**
    * @brief Implementation for non owning buffer where datasource holds buffer until destruction.
    */
@@ -75,6 +75,17 @@ class reader {
    */
   table_with_metadata read(orc_reader_options const& options,
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Reads the dataset into caller-provided pre-allocated columns.
+   *
+   * @param options Settings for controlling reading behavior
+   * @param out Table whose columns receive the decoded data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void read_into(orc_reader_options const& options,
+                 table& out,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
 /**
@@ -36,10 +36,21 @@ namespace io {
 class parquet_reader_options;
 class parquet_writer_options;
 class chunked_parquet_writer_options;
+struct parquet_file_metadata;
 
 namespace detail {
 namespace parquet {
 
+/**
+ * @brief Reads only the footer metadata of the given sources.
+ *
+ * @copydoc cudf::io::read_parquet_metadata
+ *
+ * @param sources Input `datasource` objects to read the footers from
+ */
+std::vector<cudf::io::parquet_file_metadata> read_parquet_metadata(
+  std::vector<std::unique_ptr<cudf::io::datasource>> const& sources);
+
 /**
  * @brief Class to read Parquet dataset data into columns.
  */
@@ -77,6 +88,62 @@ class reader {
    */
   table_with_metadata read(parquet_reader_options const& options,
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Reads the dataset into caller-provided pre-allocated columns.
+   *
+   * @param options Settings for controlling reading behavior
+   * @param out Table whose columns receive the decoded data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void read_into(parquet_reader_options const& options,
+                 table& out,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+};
+
+/**
+ * @brief Class to read chunks of Parquet dataset data into columns.
+ */
+class chunked_reader {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor from a read size limit and an array of datasources
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   * or `0` if there is no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          parquet_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns `true` if there is another chunk to be read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
 /**
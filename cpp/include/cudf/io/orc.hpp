@@ -22,11 +22,16 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+struct expression;
+}  // namespace ast
+
 namespace io {
 /**
  * @addtogroup io_readers
@@ -70,6 +75,9 @@ class orc_reader_options {
   // Columns that should be converted from Decimal to Float64
   std::vector<std::string> _decimal_cols_as_float;
 
+  // Predicate used to prune stripes using column statistics
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   friend orc_reader_options_builder;
 
   /**
@@ -143,6 +151,14 @@ class orc_reader_options {
     return _decimal_cols_as_float;
   }
 
+  /**
+   * @brief Returns the predicate used to prune stripes, if set.
+   */
+  std::optional<std::reference_wrapper<ast::expression const>> const& get_filter() const
+  {
+    return _filter;
+  }
+
   // Setters
 
   /**
@@ -216,6 +232,22 @@ class orc_reader_options {
   {
     _decimal_cols_as_float = std::move(val);
   }
+
+  /**
+   * @brief Sets a predicate used to prune stripes before any device transfer.
+   *
+   * Stripes whose column statistics prove that no row can satisfy the predicate are
+   * skipped entirely. This is a coarse filter: rows of the surviving stripes are
+   * returned unfiltered, so the caller is still responsible for applying the predicate
+   * to the output table. The expression may only reference columns of the selected
+   * output table (by index) and literals; unsupported sub-expressions are treated
+   * conservatively and prune nothing.
+   *
+   * The expression is stored by reference and must outlive the read.
+   *
+   * @param filter AST expression to prune stripes with.
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
 };
 
 class orc_reader_options_builder {
@@ -332,6 +364,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets a predicate used to prune stripes using column statistics.
+   *
+   * @param filter AST expression to prune stripes with.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -368,6 +412,24 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reads an ORC dataset into caller-provided pre-allocated columns.
+ *
+ * Decodes directly into the columns of `out` instead of allocating a new table,
+ * so a fixed-schema streaming ingest can reuse a ring of output tables across
+ * batches. The destination must match the file schema: one fixed-width,
+ * non-nested column per output column with matching types, exactly as many rows
+ * as the read will produce, and a null mask on any column that can receive
+ * nulls.
+ *
+ * @throws cudf::logic_error if the destination shape, types, or capacity do not
+ * match the data being read
+ *
+ * @param options Settings for controlling reading behavior.
+ * @param out Table whose columns receive the decoded data.
+ */
+void read_orc_into(orc_reader_options const& options, table& out);
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
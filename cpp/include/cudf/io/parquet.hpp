@@ -25,11 +25,17 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <iostream>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+struct expression;
+}  // namespace ast
+
 namespace io {
 /**
  * @addtogroup io_readers
@@ -60,6 +66,8 @@ class parquet_reader_options {
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to return fully dictionary-encoded string data as dictionary columns
+  bool _convert_strings_to_dictionaries = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
   // Cast timestamp columns to a specific type
@@ -69,6 +77,9 @@ class parquet_reader_options {
   // doubles for storage of types unsupported by cudf
   bool _strict_decimal_types = false;
 
+  // Predicate used to prune row groups using column chunk statistics
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   /**
    * @brief Constructor from source info.
    *
@@ -105,6 +116,15 @@ class parquet_reader_options {
    */
   bool is_enabled_convert_strings_to_categories() const { return _convert_strings_to_categories; }
 
+  /**
+   * @brief Returns true/false depending on whether strings should be returned as dictionary
+   * columns or not.
+   */
+  bool is_enabled_convert_strings_to_dictionaries() const
+  {
+    return _convert_strings_to_dictionaries;
+  }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    */
@@ -141,9 +161,23 @@ class parquet_reader_options {
    */
   bool is_enabled_strict_decimal_types() const { return _strict_decimal_types; }
 
+  /**
+   * @brief Returns the predicate used to prune row groups, if set.
+   */
+  std::optional<std::reference_wrapper<ast::expression const>> const& get_filter() const
+  {
+    return _filter;
+  }
+
   /**
    * @brief Sets names of the columns to be read.
    *
+   * Names may be nested projection paths using '.' as the separator, e.g.
+   * "telemetry.gps.lat" selects a single leaf out of a struct hierarchy. Only
+   * the column chunks of the selected leaves are read and decompressed; the
+   * unselected siblings are never touched. Selecting an inner node selects its
+   * whole subtree.
+   *
    * @param col_names Vector of column names.
    */
   void set_columns(std::vector<std::string> col_names) { _columns = std::move(col_names); }
@@ -169,6 +203,21 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable returning strings as dictionary columns.
+   *
+   * String columns whose chunks are entirely dictionary-encoded in the file are returned as
+   * DICTIONARY32 columns built directly from the Parquet dictionary pages, skipping the
+   * materialization of the string data. Columns with any non-dictionary-encoded page fall
+   * back to regular string output. Cannot be combined with conversion to categories.
+   *
+   * @param val Boolean value to enable/disable returning strings as dictionary columns.
+   */
+  void enable_convert_strings_to_dictionaries(bool val)
+  {
+    _convert_strings_to_dictionaries = val;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -218,6 +267,22 @@ class parquet_reader_options {
    * cudf will convert unsupported types to double.
    */
   void set_strict_decimal_types(bool val) { _strict_decimal_types = val; }
+
+  /**
+   * @brief Sets a predicate used to prune row groups before any device transfer.
+   *
+   * Row groups whose column chunk statistics prove that no row can satisfy the
+   * predicate are skipped entirely. This is a coarse filter: rows of the surviving
+   * row groups are returned unfiltered, so the caller is still responsible for
+   * applying the predicate to the output table. The expression may only reference
+   * columns of the selected output table (by index) and literals; unsupported
+   * sub-expressions are treated conservatively and prune nothing.
+   *
+   * The expression is stored by reference and must outlive the read.
+   *
+   * @param filter AST expression to prune row groups with.
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
 };
 
 class parquet_reader_options_builder {
@@ -241,6 +306,9 @@ class parquet_reader_options_builder {
   /**
    * @brief Sets names of the columns to be read.
    *
+   * Names may be nested projection paths, e.g. "telemetry.gps.lat"; see
+   * `parquet_reader_options::set_columns`.
+   *
    * @param col_names Vector of column names.
    * @return this for chaining.
    */
@@ -274,6 +342,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable returning strings as dictionary columns.
+   *
+   * @param val Boolean value to enable/disable returning strings as dictionary columns.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& convert_strings_to_dictionaries(bool val)
+  {
+    options._convert_strings_to_dictionaries = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -322,6 +402,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets a predicate used to prune row groups using column chunk statistics.
+   *
+   * @param filter AST expression to prune row groups with.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable error with unsupported decimal types.
    *
@@ -367,6 +459,121 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reads a Parquet dataset into caller-provided pre-allocated columns.
+ *
+ * Decodes directly into the columns of `out` instead of allocating a new table,
+ * so a fixed-schema streaming ingest can reuse a ring of output tables across
+ * batches. The destination must match the file schema: one fixed-width,
+ * non-nested column per output column with matching types, exactly as many rows
+ * as the read will produce, and a null mask on any column that can receive
+ * nulls.
+ *
+ * @throws cudf::logic_error if the destination shape, types, or capacity do not
+ * match the data being read
+ *
+ * @param options Settings for controlling reading behavior
+ * @param out Table whose columns receive the decoded data
+ */
+void read_parquet_into(parquet_reader_options const& options, table& out);
+
+/**
+ * @brief Footer metadata of a single Parquet file
+ *
+ * Produced by `read_parquet_metadata()` from the footer thrift alone, without touching
+ * any column chunk data or device memory.
+ */
+struct parquet_file_metadata {
+  std::vector<std::string> column_names;  //!< Top-level column names, in schema order
+  int64_t num_rows         = 0;           //!< Total number of rows across all row groups
+  size_type num_row_groups = 0;           //!< Number of row groups
+  std::vector<int64_t> row_group_num_rows;         //!< Number of rows in each row group
+  std::vector<int64_t> row_group_total_byte_size;  //!< Uncompressed data size of each row group
+  std::map<std::string, std::string> key_value_metadata;  //!< File-level user key-value metadata
+};
+
+/**
+ * @brief Reads only the footer metadata of a set of Parquet files.
+ *
+ * Footers are parsed on a host thread pool, one task per source, so interrogating a large
+ * file listing (e.g. for query planning) does not pay the cost of constructing a full
+ * reader per file.
+ *
+ * @code
+ *  auto metadata = cudf::io::read_parquet_metadata(cudf::io::source_info("dataset.parquet"));
+ * @endcode
+ *
+ * @param src_info Datasources to read the footers from
+ *
+ * @return Footer metadata of each input file, in source order
+ */
+std::vector<parquet_file_metadata> read_parquet_metadata(source_info const& src_info);
+
+/**
+ * @brief Chunked parquet reader class to read a Parquet dataset in pieces that fit
+ * a device memory budget.
+ *
+ * Where `read_parquet()` materializes the whole selected row group set at once, this
+ * reader hands back a sequence of tables, each produced from as many consecutive row
+ * groups as fit under the caller-supplied limit on uncompressed bytes. This allows
+ * datasets much larger than the available device memory to be processed a chunk at a
+ * time.
+ *
+ * The following code snippet demonstrates a typical read loop:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.parquet");
+ *  auto options = cudf::io::parquet_reader_options::builder(source);
+ *  auto reader  = cudf::io::chunked_parquet_reader(1024 * 1024 * 1024, options);
+ *
+ *  while (reader.has_next()) { process(reader.read_chunk()); }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  chunked_parquet_reader() = default;
+
+  /**
+   * @brief Constructor from a read size limit and reader options.
+   *
+   * A chunk always contains at least one row group, so a single row group larger than
+   * `chunk_read_limit` is still returned (by itself) rather than failing the read.
+   *
+   * @param chunk_read_limit Limit on the number of uncompressed bytes returned per
+   * `read_chunk()` call, or `0` for no limit
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_parquet_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Returns `true` if there is another chunk to be read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of row groups as a table.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk() const;
+
+  // Unique pointer to impl reader class
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -398,6 +605,8 @@ class parquet_writer_options {
   bool _write_timestamps_as_int96 = false;
   // Column chunks file path to be set in the raw output metadata
   std::string _column_chunks_file_path;
+  // Maximum number of row group batches encoded/compressed while earlier batches are written
+  size_type _write_pipeline_depth = 2;
 
   /**
    * @brief Constructor from sink and table.
@@ -472,6 +681,11 @@ class parquet_writer_options {
    */
   std::string get_column_chunks_file_path() const { return _column_chunks_file_path; }
 
+  /**
+   * @brief Returns the maximum number of row group batches in flight while writing.
+   */
+  size_type get_write_pipeline_depth() const { return _write_pipeline_depth; }
+
   /**
    * @brief Sets metadata.
    *
@@ -510,6 +724,21 @@ class parquet_writer_options {
   {
     _column_chunks_file_path.assign(file_path);
   }
+
+  /**
+   * @brief Sets the maximum number of row group batches in flight while writing.
+   *
+   * Row groups are encoded and compressed in batches; later batches may be processed while
+   * earlier ones are still being written to the sink. Each additional level of depth holds
+   * one extra batch worth of device memory. A depth of 1 disables the pipelining.
+   *
+   * @param depth Maximum number of batches in flight; must be at least 1.
+   */
+  void set_write_pipeline_depth(size_type depth)
+  {
+    CUDF_EXPECTS(depth >= 1, "Write pipeline depth must be at least 1");
+    _write_pipeline_depth = depth;
+  }
 };
 
 class parquet_writer_options_builder {
@@ -594,6 +823,18 @@ class parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the maximum number of row group batches in flight while writing.
+   *
+   * @param depth Maximum number of batches in flight; must be at least 1.
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& write_pipeline_depth(size_type depth)
+  {
+    options.set_write_pipeline_depth(depth);
+    return *this;
+  }
+
   /**
    * @brief move parquet_writer_options member once it's built.
    */
@@ -660,6 +901,10 @@ class chunked_parquet_writer_options {
   // Parquet writer can write INT96 or TIMESTAMP_MICROS. Defaults to TIMESTAMP_MICROS.
   // If true then overrides any per-column setting in _metadata.
   bool _write_timestamps_as_int96 = false;
+  // Maximum number of row group batches encoded/compressed while earlier batches are written
+  size_type _write_pipeline_depth = 2;
+  // Coalesce written batches until they hold at least this many rows (0 = flush every write)
+  size_type _target_row_group_rows = 0;
 
   /**
    * @brief Constructor from sink.
@@ -703,6 +948,16 @@ class chunked_parquet_writer_options {
    */
   bool is_enabled_int96_timestamps() const { return _write_timestamps_as_int96; }
 
+  /**
+   * @brief Returns the maximum number of row group batches in flight while writing.
+   */
+  size_type get_write_pipeline_depth() const { return _write_pipeline_depth; }
+
+  /**
+   * @brief Returns the number of rows coalesced into a row group across writes.
+   */
+  size_type get_target_row_group_rows() const { return _target_row_group_rows; }
+
   /**
    * @brief Sets metadata.
    *
@@ -732,6 +987,39 @@ class chunked_parquet_writer_options {
    */
   void enable_int96_timestamps(bool req) { _write_timestamps_as_int96 = req; }
 
+  /**
+   * @brief Sets the maximum number of row group batches in flight while writing.
+   *
+   * Row groups are encoded and compressed in batches; later batches may be processed while
+   * earlier ones are still being written to the sink. Each additional level of depth holds
+   * one extra batch worth of device memory. A depth of 1 disables the pipelining.
+   *
+   * @param depth Maximum number of batches in flight; must be at least 1.
+   */
+  void set_write_pipeline_depth(size_type depth)
+  {
+    CUDF_EXPECTS(depth >= 1, "Write pipeline depth must be at least 1");
+    _write_pipeline_depth = depth;
+  }
+
+  /**
+   * @brief Sets the number of rows to coalesce into a row group across writes.
+   *
+   * When nonzero, batches passed to `parquet_chunked_writer::write` are buffered until at
+   * least this many rows have accumulated and only then handed to the writer, decoupling
+   * the caller's batch size from the on-disk row-group layout. Streaming callers that
+   * write small batches otherwise produce one undersized row group per batch, which hurts
+   * scan throughput on the written file. The buffered copy holds up to one target row
+   * group's worth of device memory; `close()` flushes any remainder.
+   *
+   * @param rows Minimum number of rows per coalesced row group; 0 flushes every write.
+   */
+  void set_target_row_group_rows(size_type rows)
+  {
+    CUDF_EXPECTS(rows >= 0, "Target row group rows cannot be negative");
+    _target_row_group_rows = rows;
+  }
+
   /**
    * @brief creates builder to build chunked_parquet_writer_options.
    *
@@ -811,6 +1099,30 @@ class chunked_parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the maximum number of row group batches in flight while writing.
+   *
+   * @param depth Maximum number of batches in flight; must be at least 1.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& write_pipeline_depth(size_type depth)
+  {
+    options.set_write_pipeline_depth(depth);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the number of rows to coalesce into a row group across writes.
+   *
+   * @param rows Minimum number of rows per coalesced row group; 0 flushes every write.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& target_row_group_rows(size_type rows)
+  {
+    options.set_target_row_group_rows(rows);
+    return *this;
+  }
+
   /**
    * @brief move chunked_parquet_writer_options member once it's built.
    */
@@ -842,6 +1154,10 @@ class chunked_parquet_writer_options_builder {
  *  writer.write(table1)
  *  writer.close()
  *  @endcode
+ *
+ * When `chunked_parquet_writer_options::set_target_row_group_rows` is set, written batches
+ * are buffered and coalesced until the target number of rows has accumulated, so the
+ * on-disk row-group size is independent of how finely the caller chops its writes.
  */
 class parquet_chunked_writer {
  public:
@@ -850,6 +1166,9 @@ class parquet_chunked_writer {
    *        This is added just to satisfy cython.
    */
   parquet_chunked_writer() = default;
+  ~parquet_chunked_writer();
+  parquet_chunked_writer(parquet_chunked_writer&&);
+  parquet_chunked_writer& operator=(parquet_chunked_writer&&);
 
   /**
    * @brief Constructor with chunked writer options
@@ -880,6 +1199,17 @@ class parquet_chunked_writer {
 
   // Unique pointer to impl writer class
   std::unique_ptr<cudf::io::detail::parquet::writer> writer;
+
+ private:
+  /**
+   * @brief Hands any buffered batches to the writer as one coalesced table.
+   */
+  void flush_buffered();
+
+  // Batches buffered until they reach the target row-group size (coalescing mode)
+  std::vector<std::unique_ptr<table>> buffered_tables;
+  size_type buffered_rows         = 0;
+  size_type target_row_group_rows = 0;
 };
 
 /** @} */  // end of group
@@ -22,6 +22,7 @@
 #include <rmm/mr/device/device_memory_resource.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -32,6 +33,22 @@ std::unique_ptr<cudf::column> multibyte_split(
   std::string const& delimiter,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Splits data from each source into a strings column using the delimiter.
+ *
+ * Sources are scanned concurrently, on separate streams, so the fixed cost of a scan is not paid
+ * once per source. The returned columns match the order of the input sources.
+ *
+ * @param sources Sources of the text data, one output column is produced per source
+ * @param delimiter Delimiter to split the text on
+ * @param mr Memory resource to use for the device memory allocation
+ * @return One strings column per source, each containing the split text of that source
+ */
+std::vector<std::unique_ptr<cudf::column>> multibyte_split(
+  std::vector<data_chunk_source const*> const& sources,
+  std::string const& delimiter,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace text
 }  // namespace io
 }  // namespace cudf
@@ -73,6 +73,19 @@ enum class io_type {
   USER_IMPLEMENTED,  ///< Input/output is handled by a custom user class
 };
 
+/**
+ * @brief Per-source policy for GPUDirect Storage (cuFile) IO
+ *
+ * Controls whether file IO for a given source or sink transfers data directly
+ * between storage and device memory, bypassing the host bounce buffer. `AUTO`
+ * defers to the global `LIBCUDF_CUFILE_POLICY` environment setting.
+ */
+enum class gds_policy {
+  AUTO,    ///< Use cuFile when enabled globally and beneficial for the operation size
+  ALWAYS,  ///< Use cuFile for all device IO on this source; fails if unavailable
+  OFF,     ///< Never use cuFile for this source
+};
+
 /**
  * @brief Behavior when handling quotations in field data
  */
@@ -156,6 +169,8 @@ struct source_info {
   std::vector<host_buffer> buffers;
   std::vector<std::shared_ptr<arrow::io::RandomAccessFile>> files;
   std::vector<cudf::io::datasource*> user_sources;
+  // cuFile policy; only applies to FILEPATH sources
+  gds_policy gds = gds_policy::AUTO;
 
   source_info() = default;
 
@@ -195,6 +210,8 @@ struct sink_info {
   std::string filepath;
   std::vector<char>* buffer      = nullptr;
   cudf::io::data_sink* user_sink = nullptr;
+  // cuFile policy; only applies to FILEPATH sinks
+  gds_policy gds = gds_policy::AUTO;
 
   sink_info() = default;
 
@@ -216,6 +233,7 @@ class column_in_metadata {
   thrust::optional<bool> _nullable;
   bool _list_column_is_map  = false;
   bool _use_int96_timestamp = false;
+  bool _skip_compression    = false;
   // bool _output_as_binary = false;
   thrust::optional<uint8_t> _decimal_precision;
   std::vector<column_in_metadata> children;
@@ -285,6 +303,23 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Specifies whether this column's data should be written without compression, regardless
+   * of the file-level compression requested in the writer options.
+   *
+   * Useful for columns that are known not to compress (e.g. random floats or already-compressed
+   * blobs), where running the compression kernels only costs write time. Only the leaf data of
+   * this column is affected; the option does not propagate to children.
+   *
+   * @param skip True = write this column's pages uncompressed
+   * @return this for chaining
+   */
+  column_in_metadata& set_skip_compression(bool skip)
+  {
+    _skip_compression = skip;
+    return *this;
+  }
+
   /**
    * @brief Set the decimal precision of this column. Only valid if this column is a decimal
    * (fixed-point) type
@@ -341,6 +376,11 @@ class column_in_metadata {
    */
   bool is_enabled_int96_timestamps() const { return _use_int96_timestamp; }
 
+  /**
+   * @brief Get whether this column's data is to be written without compression
+   */
+  bool is_enabled_skip_compression() const { return _skip_compression; }
+
   /**
    * @brief Get whether precision has been set for this decimal column
    */
@@ -377,5 +417,28 @@ class table_input_metadata {
   std::map<std::string, std::string> user_data;  //!< Format-dependent metadata as key-values pairs
 };
 
+/**
+ * @brief Slices a table into contiguous partitions of roughly equal encoded size.
+ *
+ * Computes slice boundaries such that each returned view covers approximately
+ * `target_partition_bytes` of row data, measured with `cudf::row_bit_count` so
+ * variable-width columns contribute their actual sizes (string bytes are
+ * counted via the offsets, not per-element averages). Boundaries are a pure
+ * function of the input and the budget, so concurrent writer instances fed one
+ * slice each produce a deterministic overall layout with row groups or stripes
+ * aligned to the budget.
+ *
+ * A single row larger than the budget forms its own partition. The returned
+ * views are non-owning; the input table must outlive them.
+ *
+ * @throws cudf::logic_error if `target_partition_bytes` is zero
+ *
+ * @param input The table to slice
+ * @param target_partition_bytes Approximate encoded size of each partition
+ * @return Non-empty vector of contiguous, non-overlapping views covering `input`
+ */
+std::vector<table_view> partition_for_write(table_view const& input,
+                                            std::size_t target_partition_bytes);
+
 }  // namespace io
 }  // namespace cudf
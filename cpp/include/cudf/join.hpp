@@ -17,13 +17,18 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -60,6 +65,7 @@ namespace cudf {
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -71,6 +77,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 inner_join(cudf::table_view const& left_keys,
            cudf::table_view const& right_keys,
            null_equality compare_nulls         = null_equality::EQUAL,
+           rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -105,6 +112,7 @@ inner_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -116,6 +124,179 @@ std::unique_ptr<cudf::table> inner_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs an inner join in partitioned passes to bound the peak device memory used
+ * by the hash table.
+ *
+ * Both tables are hash-partitioned on their join keys with the same hash function, and each
+ * partition pair is joined independently, so only one partition's hash table is resident at
+ * a time. The number of partitions is derived from `device_memory_budget` and an estimate of
+ * the build (right) table's device footprint; a budget of 0 degenerates to a single
+ * partition, which is equivalent to `inner_join`.
+ *
+ * The rows in the result are in an unspecified order, as with `inner_join`.
+ *
+ * @throw cudf::logic_error if number of elements in `left_on` or `right_on` mismatch.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * The column from `left` indicated by `left_on[i]` will be compared against the column
+ * from `right` indicated by `right_on[i]`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * The column from `right` indicated by `right_on[i]` will be compared against the column
+ * from `left` indicated by `left_on[i]`.
+ * @param[in] device_memory_budget Approximate device memory, in bytes, that a single join
+ * pass may use for the build table and its hash map; 0 means unbounded
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return Result of joining `left` and `right` tables on the columns
+ * specified by `left_on` and `right_on`.
+ */
+std::unique_ptr<cudf::table> partitioned_inner_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::size_t device_memory_budget    = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between two
+ * tables that are both sorted on the join keys.
+ *
+ * Exploits the sort order instead of building a hash table: each left row's matches form a
+ * contiguous run in the right table found by binary search, so the join has no build pass
+ * and no hash-table memory footprint. Both tables must be sorted ascending on all key
+ * columns with nulls ordered before all other values; nulls compare equal to each other,
+ * as in `inner_join` with `null_equality::EQUAL`.
+ *
+ * The first returned vector contains the row indices from the left table that have a match
+ * in the right table, in left-table order; the corresponding values in the second returned
+ * vector are the matched row indices from the right table.
+ *
+ * @throw cudf::logic_error if number of columns in `left_keys` or `right_keys` mismatch.
+ *
+ * @param[in] left_keys The left table's key columns, sorted ascending, nulls first
+ * @param[in] right_keys The right table's key columns, sorted ascending, nulls first
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+merge_inner_join(cudf::table_view const& left_keys,
+                 cudf::table_view const& right_keys,
+                 rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Controls which right-table row an as-of join matches to each left row.
+ */
+enum class asof_join_direction : int32_t {
+  BACKWARD,  ///< Match the last right row whose `on` value is at or before the left value
+  FORWARD,   ///< Match the first right row whose `on` value is at or after the left value
+  NEAREST    ///< Match the right row with the closest `on` value; ties prefer BACKWARD
+};
+
+/**
+ * @brief Returns a row index vector mapping each left row to its as-of match in the right
+ * table.
+ *
+ * An as-of join aligns each left row with at most one right row: among the right rows
+ * whose `by` key columns equal the left row's, the match is chosen by `direction` from
+ * the ordered `on` column (typically a timestamp). A left row with no qualifying right
+ * row — no equal `by` key, no row in the requested direction, or no row within
+ * `tolerance` — maps to an unspecified out-of-bounds value, so the result can be used
+ * directly with `cudf::gather` and `out_of_bounds_policy::NULLIFY` to produce a
+ * left-join-style table.
+ *
+ * The right table must be sorted ascending on the `by` columns and then the `on` column.
+ * The left table may be in any order. The `on` and `by` key columns must not contain
+ * nulls.
+ *
+ * @code{.pseudo}
+ * Left on: {3, 1, 7}
+ * Right on: {1, 2, 6}
+ * direction: BACKWARD
+ * Result: {1, 0, 2}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `left_by` and `right_by` differ in size, if corresponding
+ * key columns differ in type, if a key column contains nulls, if the `on` columns are not
+ * integral or chrono typed, or if `tolerance` is negative.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table, sorted ascending on (`right_by`..., `right_on`)
+ * @param[in] left_on Index of the ordered column in `left` to match on
+ * @param[in] right_on Index of the ordered column in `right` to match on
+ * @param[in] left_by Indices of the `left` columns to match exactly
+ * @param[in] right_by Indices of the `right` columns to match exactly
+ * @param[in] direction Whether to match backward, forward, or to the nearest `on` value
+ * @param[in] tolerance Maximum distance between matched `on` values, in ticks of the `on`
+ * column's type; no limit if not provided
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector's device memory
+ *
+ * @return A vector of `left.num_rows()` right-table row indices, with out-of-bounds
+ * values for left rows that have no match
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  cudf::size_type left_on,
+  cudf::size_type right_on,
+  std::vector<cudf::size_type> const& left_by,
+  std::vector<cudf::size_type> const& right_by,
+  asof_join_direction direction       = asof_join_direction::BACKWARD,
+  std::optional<int64_t> tolerance    = std::nullopt,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors pairing each point with every
+ * interval that contains it.
+ *
+ * An interval `i` is defined by the half-open range `[left_edges[i], right_edges[i])`;
+ * a point `points[j]` matches it when `left_edges[i] <= points[j] < right_edges[i]`.
+ * The first vector holds point indices, the second the matching interval indices,
+ * suitable for gathering from the point and interval tables respectively.
+ *
+ * The intervals are sorted by left edge once and each point then binary-searches
+ * the sorted edges, so the cost is `O((N + M) log M)` plus one step per actual
+ * overlap instead of the `O(N * M)` of expressing the containment predicate
+ * through a conditional join. Intervals may overlap; points falling into several
+ * intervals produce one pair per containing interval, in an unspecified order.
+ *
+ * @throw cudf::logic_error if the points and edge columns differ in type, if the
+ * edge columns differ in size, if any input contains nulls, or if the type is not
+ * numeric or chrono.
+ *
+ * @param[in] points Column of point values to locate
+ * @param[in] left_edges Inclusive left edge of each interval
+ * @param[in] right_edges Exclusive right edge of each interval
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors' device memory
+ *
+ * @return A pair of vectors [`point_indices`, `interval_indices`] with one entry
+ * per containment match
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+interval_join(
+  column_view const& points,
+  column_view const& left_edges,
+  column_view const& right_edges,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -145,6 +326,7 @@ std::unique_ptr<cudf::table> inner_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -156,6 +338,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 left_join(cudf::table_view const& left_keys,
           cudf::table_view const& right_keys,
           null_equality compare_nulls         = null_equality::EQUAL,
+          rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
           rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -198,6 +381,7 @@ left_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -209,6 +393,7 @@ std::unique_ptr<cudf::table> left_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -237,6 +422,7 @@ std::unique_ptr<cudf::table> left_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -248,6 +434,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 full_join(cudf::table_view const& left_keys,
           cudf::table_view const& right_keys,
           null_equality compare_nulls         = null_equality::EQUAL,
+          rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
           rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -290,6 +477,7 @@ full_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -301,6 +489,7 @@ std::unique_ptr<cudf::table> full_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -324,6 +513,7 @@ std::unique_ptr<cudf::table> full_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A vector `left_indices` that can be used to construct
@@ -334,6 +524,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
   cudf::table_view const& left_keys,
   cudf::table_view const& right_keys,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -382,6 +573,7 @@ std::unique_ptr<cudf::table> left_semi_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -403,6 +595,7 @@ std::unique_ptr<cudf::table> left_semi_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A column `left_indices` that can be used to construct
@@ -413,6 +606,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
   cudf::table_view const& left_keys,
   cudf::table_view const& right_keys,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -464,6 +658,51 @@ std::unique_ptr<cudf::table> left_anti_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters `input` to the rows whose key columns may have a match in `keys`
+ *
+ * Builds a Bloom filter over the rows of `keys` and returns the rows of
+ * `input` whose key columns pass the filter. The result is a superset of the
+ * corresponding `left_semi_join`: rows with a match are always kept, and a
+ * small fraction (roughly 5%) of non-matching rows may also be kept due to
+ * Bloom filter false positives.
+ *
+ * This is intended as a cheap, inexact pre-filter that can be pushed below
+ * expensive operations (e.g. applied to each batch of a scan before a join),
+ * with the exact join performed on the reduced input afterwards.
+ *
+ * @code{.pseudo}
+ * input: {{0, 1, 2}}
+ * keys: {{1, 2, 3}}
+ * input_on: {0}
+ * keys_on: {0}
+ * Result: {{1, 2}} (possibly plus false positives)
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `input_on` or `keys_on`
+ * mismatch.
+ *
+ * @param[in] input    The table to filter
+ * @param[in] keys     The table providing the keys to filter by
+ * @param[in] input_on The column indices from `input` used as filter keys.
+ *                     The column from `input` indicated by `input_on[i]`
+ *                     will be compared against the column from `keys`
+ *                     indicated by `keys_on[i]`.
+ * @param[in] keys_on  The column indices from `keys` used as filter keys
+ * @param[in] mr       Device memory resource used to allocate the returned table's
+ *                     device memory
+ *
+ * @return             The rows of `input` that possibly match a row of `keys` on
+ *                     the columns specified by `input_on` and `keys_on`
+ */
+std::unique_ptr<cudf::table> filter_by_bloom(
+  cudf::table_view const& input,
+  cudf::table_view const& keys,
+  std::vector<cudf::size_type> const& input_on,
+  std::vector<cudf::size_type> const& keys_on,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -484,6 +723,7 @@ std::unique_ptr<cudf::table> left_anti_join(
  *
  * @param left  The left table
  * @param right The right table
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr    Device memory resource used to allocate the returned table's device memory
  *
  * @return     Result of cross joining `left` and `right` tables
@@ -491,6 +731,7 @@ std::unique_ptr<cudf::table> left_anti_join(
 std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -644,11 +885,132 @@ class hash_join {
     rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Serializes the internal hash table into a host blob.
+   *
+   * The blob captures the fully built hash table so it can be persisted or shared between
+   * processes and restored with `deserialize` without paying the build cost again. The
+   * blob is tied to the libcudf version that produced it and to the exact contents of the
+   * build table; it does not contain the build table itself.
+   *
+   * @param stream CUDA stream used for device memory operations
+   *
+   * @return A host buffer holding the serialized hash table
+   */
+  std::vector<std::uint8_t> serialize(
+    rmm::cuda_stream_view stream = rmm::cuda_stream_default) const;
+
+  /**
+   * @brief Reconstructs a hash join object from a blob produced by `serialize`.
+   *
+   * The caller must supply the same build table (same contents, same column order) that
+   * the serialized object was constructed from; behavior is undefined otherwise. As with
+   * the building constructor, the returned object must not outlive the table viewed by
+   * `build`.
+   *
+   * @throw cudf::logic_error if the blob is truncated, was produced by an incompatible
+   * libcudf version, or does not match the row count of `build`.
+   *
+   * @param blob A buffer returned by `serialize`
+   * @param build The build table the serialized hash table was built from
+   * @param stream CUDA stream used for device memory operations
+   *
+   * @return A hash join object equivalent to the one that was serialized
+   */
+  static std::unique_ptr<hash_join> deserialize(
+    host_span<std::uint8_t const> blob,
+    cudf::table_view const& build,
+    rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
  private:
   struct hash_join_impl;
   const std::unique_ptr<const hash_join_impl> impl;
+
+  hash_join(std::unique_ptr<const hash_join_impl> impl);
 };
 
+/**
+ * @brief A process-wide registry of prepared hash joins, shared across threads.
+ *
+ * Broadcast joins against small dimension tables probe the same build side from
+ * many query threads; building a private `hash_join` per thread multiplies both
+ * the build cost and the device memory by the thread count. The registry builds
+ * each named join once, owns a single device copy of its build table, and hands
+ * out shared references that any number of threads may probe concurrently on
+ * independent streams (the hash table is immutable after build).
+ *
+ * Entries are evicted in least-recently-used order when the registered device
+ * memory exceeds the configured budget. Eviction only drops the registry's
+ * reference: shared references already handed out keep the join alive until
+ * released, so probes in flight are never invalidated.
+ */
+namespace prepared_joins {
+
+/**
+ * @brief Returns the registered join under `name`, building and registering it
+ * from `build` if absent.
+ *
+ * The build table is deep-copied to device memory owned by the registry, so the
+ * caller's `build` only needs to live for the duration of this call. Concurrent
+ * callers registering the same name serialize on the registry lock and all
+ * receive the same instance; only the first pays the copy and build cost.
+ *
+ * @param name Registry key identifying the prepared join
+ * @param build The build table to prepare if `name` is not yet registered
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return A shared reference to the prepared join; it remains valid after eviction
+ */
+std::shared_ptr<hash_join const> insert(std::string const& name,
+                                        table_view const& build,
+                                        null_equality compare_nulls  = null_equality::EQUAL,
+                                        rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Returns the registered join under `name`, or an empty pointer if absent.
+ *
+ * A hit refreshes the entry's position in the eviction order.
+ *
+ * @param name Registry key to look up
+ */
+std::shared_ptr<hash_join const> find(std::string const& name);
+
+/**
+ * @brief Removes the entry under `name` from the registry.
+ *
+ * @param name Registry key to remove
+ * @return true if an entry was removed
+ */
+bool erase(std::string const& name);
+
+/**
+ * @brief Removes all entries from the registry.
+ */
+void clear();
+
+/**
+ * @brief Limits the device memory held by registered entries.
+ *
+ * When an insertion pushes the registered total above the budget, the least
+ * recently used entries are evicted until it fits (the entry being inserted is
+ * never evicted). A budget of 0 — the default — means unlimited. The accounted
+ * size of an entry is the device size of its build-table copy plus an estimate
+ * of the hash table.
+ *
+ * @param bytes The budget in bytes, or 0 for unlimited
+ */
+void set_memory_budget(std::size_t bytes);
+
+/**
+ * @brief Returns the device memory currently held by registered entries, in bytes.
+ *
+ * Evicted entries still alive through outstanding shared references are not
+ * counted.
+ */
+std::size_t memory_used();
+
+}  // namespace prepared_joins
+
 /**
  * @brief Returns a pair of row index vectors corresponding to all pairs
  * of rows between the specified tables where the predicate evaluates to true.
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+namespace cudf {
+
+/**
+ * @addtogroup label_bins
+ * @{
+ * @file
+ * @brief API for labeling timestamp-gap sessions.
+ */
+
+/**
+ * @brief Assigns a session label to every row, starting a new session whenever
+ * the keys change or the gap to the previous timestamp exceeds a threshold.
+ *
+ * Row `i` starts a new session if its keys differ from the keys of row `i - 1`
+ * or if `timestamps[i] - timestamps[i - 1] > gap`. Labels are contiguous
+ * integers starting at 0 and increase by one with each new session, so they are
+ * unique across the whole column rather than per key.
+ *
+ * The input must already be ordered by keys with ascending timestamps within
+ * each key (the ordering a sort by `keys, timestamps` produces); the labels are
+ * computed in a single fused comparison-and-scan pass without materializing the
+ * intermediate gap or flag columns.
+ *
+ * @throws cudf::logic_error if `keys.num_rows() != timestamps.size()`
+ * @throws cudf::logic_error if `timestamps` is not a timestamp column or contains nulls
+ * @throws cudf::logic_error if `gap` is not a valid duration scalar matching the
+ * timestamp's resolution
+ *
+ * @param keys Table of session key columns (e.g. the user id)
+ * @param timestamps Event timestamps, ascending within each key
+ * @param gap Largest timestamp difference still considered the same session
+ * @param mr Device memory resource used to allocate the returned column
+ * @return INT32 column of session labels, one per input row
+ */
+std::unique_ptr<column> label_sessions(
+  table_view const& keys,
+  column_view const& timestamps,
+  scalar const& gap,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
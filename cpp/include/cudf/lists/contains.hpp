@@ -74,6 +74,58 @@ std::unique_ptr<column> contains(
   cudf::column_view const& search_keys,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a column of `size_type` values indicating the position of the specified
+ * scalar within each row of a list column.
+ *
+ * The output column has as many elements as the input `lists` column.
+ * Output `column[i]` is set to the index of the first element in the lists row `lists[i]`
+ * that equals the value specified in `search_key`. If the list row does not contain the
+ * search key, the output is set to -1.
+ *
+ * Output `column[i]` is set to null if one or more of the following are true:
+ *   1. The search key `search_key` is null
+ *   2. The list row `lists[i]` is null
+ *   3. The list row `lists[i]` does not contain the search key, and contains at least
+ *      one null.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_key The scalar key to be looked up in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the position of the lookup,
+ *         or -1 where the key is absent
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of `size_type` values indicating the position of the corresponding
+ * value in the second column within each list row of the first column.
+ *
+ * The output column has as many elements as the input `lists` column.
+ * Output `column[i]` is set to the index of the first element in the lists row `lists[i]`
+ * that equals the value in `search_keys[i]`. If the list row does not contain the
+ * search key, the output is set to -1.
+ *
+ * Output `column[i]` is set to null if one or more of the following are true:
+ *   1. The row `search_keys[i]` is null
+ *   2. The list row `lists[i]` is null
+ *   3. The list row `lists[i]` does not contain the `search_keys[i]`, and contains at least
+ *      one null.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_keys Column of elements to be looked up in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the position of the lookup,
+ *         or -1 where the key is absent
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::column_view const& search_keys,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace lists
 }  // namespace cudf
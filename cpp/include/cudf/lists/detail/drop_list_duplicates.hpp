@@ -51,6 +51,7 @@ std::unique_ptr<column> drop_list_duplicates(
   lists_column_view const& input,
   null_equality nulls_equal,
   nan_equality nans_equal,
+  duplicate_keep_option keep_option,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_elements
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Reduces each list element of the given lists column to a single value.
+ *
+ * The output column has one row per list: `output[i]` is the reduction of the
+ * elements of `input[i]`. The reduction runs directly over the lists column's
+ * offsets via `cudf::segmented_reduce`, so it supports the same aggregations
+ * (`sum`, `product`, `min`, `max`, `any`, `all`) with the same type and
+ * `null_handling` rules. A null or empty list row produces a null output row.
+ *
+ * @code{.pseudo}
+ * l = { {1, 2, 3}, {4}, {}, {5, 6} }
+ * r = reduce(l, make_sum_aggregation(), INT32)
+ * r is now {6, 4, null, 11}
+ * @endcode
+ *
+ * @param input Lists column of values to reduce
+ * @param agg Aggregation operator applied to each list
+ * @param output_dtype The computation and output precision
+ * @param null_handling Whether a null element nullifies its list's result
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Column with one reduction result per list row
+ */
+std::unique_ptr<column> reduce(
+  lists_column_view const& input,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_set_operations
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Create a lists column of distinct elements common to each pair of corresponding lists
+ * from the input lists columns.
+ *
+ * The operation is performed row-wise without flattening the inputs into element rows: each pair
+ * of lists is treated as a pair of sets and their intersection is emitted as the output list.
+ * Output elements within each list are distinct; their order is not guaranteed to be preserved
+ * as in the input. A row that is null in either input is null in the output.
+ *
+ * @throw cudf::logic_error if the input columns differ in size or in child type.
+ * @throw cudf::logic_error if the child columns of the inputs are of nested types other than
+ *        STRUCT.
+ *
+ * @code{.pseudo}
+ * lhs = { {1, 1, 2, 3}, {4, 5}, NULL }
+ * rhs = { {2, 3, 5},    {6, 7}, {8}  }
+ * intersect(lhs, rhs) = { {2, 3}, {}, NULL }
+ * @endcode
+ *
+ * @param lhs The input lists column for one side.
+ * @param rhs The input lists column for the other side.
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal.
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ *        (only applicable for floating point elements).
+ * @param mr Device resource used to allocate memory.
+ *
+ * @return A lists column containing the row-wise intersections of the inputs.
+ */
+std::unique_ptr<column> intersect(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::UNEQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a lists column of distinct elements found in either of each pair of corresponding
+ * lists from the input lists columns.
+ *
+ * The operation is performed row-wise without flattening the inputs into element rows: each pair
+ * of lists is treated as a pair of sets and their union is emitted as the output list. Output
+ * elements within each list are distinct; their order is not guaranteed to be preserved as in the
+ * input. A row that is null in either input is null in the output.
+ *
+ * @throw cudf::logic_error if the input columns differ in size or in child type.
+ * @throw cudf::logic_error if the child columns of the inputs are of nested types other than
+ *        STRUCT.
+ *
+ * @code{.pseudo}
+ * lhs = { {1, 1, 2, 3}, {4, 5}, NULL }
+ * rhs = { {2, 3, 5},    {6, 7}, {8}  }
+ * union_(lhs, rhs) = { {1, 2, 3, 5}, {4, 5, 6, 7}, NULL }
+ * @endcode
+ *
+ * @param lhs The input lists column for one side.
+ * @param rhs The input lists column for the other side.
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal.
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ *        (only applicable for floating point elements).
+ * @param mr Device resource used to allocate memory.
+ *
+ * @return A lists column containing the row-wise unions of the inputs.
+ */
+std::unique_ptr<column> union_(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::UNEQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a lists column of distinct elements of each list in `lhs` that are not found in
+ * the corresponding list in `rhs`.
+ *
+ * The operation is performed row-wise without flattening the inputs into element rows: each pair
+ * of lists is treated as a pair of sets and their difference is emitted as the output list.
+ * Output elements within each list are distinct; their order is not guaranteed to be preserved
+ * as in the input. A row that is null in either input is null in the output.
+ *
+ * @throw cudf::logic_error if the input columns differ in size or in child type.
+ * @throw cudf::logic_error if the child columns of the inputs are of nested types other than
+ *        STRUCT.
+ *
+ * @code{.pseudo}
+ * lhs = { {1, 1, 2, 3}, {4, 5}, NULL }
+ * rhs = { {2, 3, 5},    {6, 7}, {8}  }
+ * difference(lhs, rhs) = { {1}, {4, 5}, NULL }
+ * @endcode
+ *
+ * @param lhs The lists column of elements to copy.
+ * @param rhs The lists column of elements to exclude.
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal.
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ *        (only applicable for floating point elements).
+ * @param mr Device resource used to allocate memory.
+ *
+ * @return A lists column containing the row-wise differences of the inputs.
+ */
+std::unique_ptr<column> difference(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::UNEQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
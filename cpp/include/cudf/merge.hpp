@@ -101,5 +101,49 @@ std::unique_ptr<cudf::table> merge(
   std::vector<cudf::null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr                  = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Merge a sorted table with a small sorted delta table.
+ *
+ * Produces the same result as `cudf::merge({target, delta}, ...)` but computes
+ * the merged row order with one binary search per delta row instead of a
+ * comparator-driven merge over every row, so the number of row comparisons
+ * scales with the size of the delta rather than the size of the target. This
+ * is intended for incrementally maintaining a large sorted table to which
+ * small sorted batches are appended.
+ *
+ * Rows from `target` precede equal rows from `delta` in the result.
+ *
+ * Example:
+ * ```
+ * input:
+ * target: [{0, 4, 4, 8}, {1, 2, 3, 4}]
+ * delta:  [{2, 4},       {5, 6}]
+ * output: [{0, 2, 4, 4, 4, 8}, {1, 5, 2, 3, 6, 4}]
+ * ```
+ *
+ * @throws cudf::logic_error if `target` and `delta` have different numbers of
+ * columns or mismatched column types
+ * @throws cudf::logic_error if `key_cols` is empty, larger than the number of
+ * columns, or its size mismatches `column_order`
+ *
+ * @param[in] target Table sorted on the key columns
+ * @param[in] delta Table sorted on the key columns, typically much smaller
+ *                  than `target`
+ * @param[in] key_cols Indices of columns to be used for comparison criteria
+ * @param[in] column_order Sort order types of columns indexed by key_cols
+ * @param[in] null_precedence Array indicating the order of nulls with respect
+ * to non-nulls for the indexing columns (key_cols)
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns A table containing the sorted union of `target` and `delta` rows
+ */
+std::unique_ptr<cudf::table> incremental_merge(
+  table_view const& target,
+  table_view const& delta,
+  std::vector<cudf::size_type> const& key_cols,
+  std::vector<cudf::order> const& column_order,
+  std::vector<cudf::null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr                  = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
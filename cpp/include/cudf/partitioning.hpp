@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -99,6 +101,134 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Partitions rows by hash value and packs each partition into a contiguous buffer.
+ *
+ * Equivalent to `hash_partition` followed by `contiguous_split` at the returned partition
+ * offsets, without exposing the intermediate reordered table. Each returned `packed_table`
+ * owns one contiguous device buffer and a compact host metadata blob (see `cudf::pack`),
+ * ready to hand to a transport (NCCL, UCX, MPI) for an all-to-all exchange; the receiver
+ * reconstructs a `table_view` over the received buffer with `cudf::unpack` without copies.
+ * Running successive batches on different streams overlaps partitioning of one batch with
+ * the transfer of the previous one.
+ *
+ * Returns one `packed_table` per partition; individual partitions may be empty. Mirroring
+ * `hash_partition`, an empty vector is returned if `num_partitions <= 0`, if `input` has no
+ * rows, or if `columns_to_hash` is empty.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned packed buffers
+ *
+ * @returns One packed table per partition
+ */
+std::vector<packed_table> hash_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions rows by hash value directly into caller-provided device buffers.
+ *
+ * Applies the same row reordering as `hash_partition`, but writes column `i`'s
+ * reordered values into `output_buffers[i]` instead of allocating output
+ * columns. This lets partitions land directly in externally managed memory —
+ * for example transport-registered buffers for an all-to-all exchange — with
+ * no copy out of library-owned allocations. The returned vector holds the
+ * offset of the first row of each partition, as in `hash_partition`.
+ *
+ * Only tables of non-nullable fixed-width columns are supported, and
+ * `num_partitions` must not exceed 1024, the limit of the shared memory
+ * partitioning kernel. Each output buffer must hold at least
+ * `input.num_rows() * size_of(column type)` bytes.
+ *
+ * Mirroring `hash_partition`, an empty vector is returned and the output
+ * buffers are left untouched if `num_partitions <= 0`, if `input` has no rows,
+ * or if `columns_to_hash` is empty.
+ *
+ * @throws cudf::logic_error if `num_partitions > 1024`
+ * @throws cudf::logic_error if a column is nullable or not fixed-width
+ * @throws cudf::logic_error if `output_buffers` does not hold one large-enough
+ * buffer per input column
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param output_buffers One preallocated device buffer per input column
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @returns Vector of the offset of the first row of each partition
+ */
+std::vector<size_type> hash_partition_into(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  host_span<device_span<uint8_t> const> output_buffers,
+  hash_id hash_function        = hash_id::HASH_MURMUR3,
+  uint32_t seed                = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Partitions rows of `input` into ranges delimited by sorted splitter values.
+ *
+ * Row `r` of `input` is assigned to the partition whose range contains the
+ * row's values in `columns_to_partition`: partition `p` receives the rows
+ * that compare at or after splitter `p - 1` and before splitter `p`, so
+ * `splitters.num_rows() + 1` partitions are produced. The splitter table
+ * must hold one column per partitioning column, with matching types, sorted
+ * according to `column_order` and `null_precedence`. This is the
+ * partitioning step of a distributed sort: sample-based splitters route each
+ * range of keys to one rank.
+ *
+ * The partition assignment is a single `upper_bound` search of the splitters,
+ * and rows are moved with the same single-pass partitioner that
+ * `cudf::partition` uses, with no materialized intermediate beyond the
+ * per-row partition number.
+ *
+ * When the caller knows `input` is already sorted on the partitioning columns
+ * (the usual case for distributed sort), passing `sorted::YES` skips the
+ * per-row pass entirely: the partition boundaries are found by searching the
+ * splitters in the input, the table is copied through unchanged, and every
+ * output partition is guaranteed to remain sorted.
+ *
+ * @throws cudf::logic_error if `splitters` does not have one column per
+ * partitioning column
+ *
+ * @param[in] input The table to partition
+ * @param[in] columns_to_partition Indices of input columns the ranges are defined over
+ * @param[in] splitters Sorted table of range boundaries
+ * @param[in] column_order The desired sort order for each partitioning column
+ * @param[in] null_precedence Whether nulls sort before or after other values
+ * @param[in] is_input_sorted Whether `input` is already sorted on the
+ * partitioning columns; if `sorted::YES`, each output partition stays sorted
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return A std::pair consisting of a unique_ptr to the partitioned table
+ * and the partition offsets for each partition within the table.
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_partition,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  sorted is_input_sorted              = sorted::NO,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Round-robin partition.
  *
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace profiling {
+
+/**
+ * @addtogroup utility_profiling
+ * @{
+ * @file
+ * @brief Built-in per-operator metrics collection
+ */
+
+/**
+ * @brief Aggregated metrics for all profiled calls sharing one name.
+ */
+struct operator_summary {
+  std::string name;                    ///< Name the scopes were created with (typically `__func__`)
+  std::size_t num_calls;               ///< Number of profiled calls
+  std::chrono::nanoseconds wall_time;  ///< Total host wall time spent in the calls
+  std::chrono::nanoseconds kernel_time;  ///< Total device time between each call's start and end,
+                                         ///< measured with CUDA events on the default stream
+  std::size_t data_volume;  ///< Sum of the data volumes the calls reported. libcudf's built-in
+                            ///< instrumentation reports row counts; explicit scopes may report
+                            ///< bytes instead
+  std::size_t peak_memory;  ///< Device memory high-water mark observed during the calls; the
+                            ///< operator that raised the process-wide high-water mark reports it
+};
+
+/**
+ * @brief Aggregated device-memory metrics for all allocations attributed to one
+ * operator name.
+ *
+ * Allocations are attributed to the innermost profiling scope active on the
+ * allocating thread; allocations made outside any scope aggregate under an
+ * empty name.
+ */
+struct memory_summary {
+  std::string name;              ///< Name of the scope the allocations were made under
+  std::size_t num_allocations;   ///< Number of allocations
+  std::size_t allocated_bytes;   ///< Sum of all allocation sizes
+  std::size_t peak_bytes;        ///< High-water mark of bytes held by this operator's allocations
+  std::chrono::nanoseconds
+    total_lifetime;  ///< Summed host wall time between allocation and deallocation; allocations
+                     ///< still outstanding do not contribute
+};
+
+/**
+ * @brief A single allocation or deallocation observed while profiling.
+ */
+struct allocation_event {
+  char const* name;    ///< For an allocation, the innermost active scope name; for a
+                       ///< deallocation, the scope the buffer was attributed to when allocated.
+                       ///< Empty when no scope applies; only valid for the duration of the
+                       ///< callback
+  void const* pointer;   ///< The allocated or freed device pointer
+  std::size_t bytes;     ///< Size of the allocation
+  bool is_allocation;    ///< true for an allocation, false for a deallocation
+};
+
+/**
+ * @brief Callback invoked for every allocation event while profiling is enabled.
+ */
+using allocation_callback = std::function<void(allocation_event const&)>;
+
+/**
+ * @brief Installs a callback observing every device allocation and deallocation.
+ *
+ * The callback runs synchronously on the allocating thread and must not
+ * allocate device memory or call back into the profiler. Pass an empty
+ * function to remove the callback. The built-in aggregation reported by
+ * `memory_report()` is unaffected by the callback.
+ *
+ * @param callback The callback to install, or empty to uninstall
+ */
+void set_allocation_callback(allocation_callback callback);
+
+/**
+ * @brief Returns true if profiling is currently enabled.
+ */
+bool is_enabled();
+
+/**
+ * @brief Starts collecting per-operator metrics.
+ *
+ * Installs a tracking adaptor around the current device memory resource so
+ * peak allocation can be attributed to calls; the adaptor is removed again by
+ * `disable()`. The current device resource must not be replaced while
+ * profiling is enabled.
+ */
+void enable();
+
+/**
+ * @brief Stops collecting metrics and uninstalls the memory tracking adaptor.
+ *
+ * Metrics already collected remain available to `report()`.
+ */
+void disable();
+
+/**
+ * @brief Discards all collected metrics.
+ */
+void reset();
+
+/**
+ * @brief Returns the collected metrics aggregated by name, ordered by
+ * decreasing total wall time.
+ *
+ * Synchronizes with the device to resolve the kernel timings of calls that
+ * have not yet completed.
+ */
+std::vector<operator_summary> report();
+
+/**
+ * @brief Returns the device-memory metrics aggregated by operator name, ordered
+ * by decreasing allocated bytes.
+ *
+ * Attribution covers allocations served while profiling was enabled;
+ * deallocations of those buffers update lifetimes even after `disable()`.
+ */
+std::vector<memory_summary> memory_report();
+
+/**
+ * @brief An RAII scope that records one profiled call.
+ *
+ * Construction records the start of a call, destruction its end. When
+ * profiling is disabled the constructor costs a single atomic load and
+ * nothing is recorded.
+ *
+ * Scopes nest: an operator calling another profiled operator contributes to
+ * both names. Peak memory attribution assumes scopes on concurrent threads do
+ * not overlap.
+ *
+ * Example:
+ * ```
+ * void some_function(table_view const& input){
+ *    profiling::scope const profile_scope{__func__, input_bytes};
+ *    ...
+ * }
+ * ```
+ */
+class scope {
+ public:
+  /**
+   * @brief Records the start of a profiled call.
+   *
+   * @param name Name to aggregate the call under; must outlive the scope
+   * (a string literal or `__func__`)
+   * @param data_volume Optional data volume (rows or bytes) to attribute to the call
+   */
+  explicit scope(char const* name, std::size_t data_volume = 0);
+  ~scope();
+
+  scope(scope const&) = delete;
+  scope& operator=(scope const&) = delete;
+  scope(scope&&)                 = delete;
+  scope& operator=(scope&&) = delete;
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;  ///< null when profiling is disabled
+};
+
+/** @} */  // end of group
+
+}  // namespace profiling
+}  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
 
 namespace cudf {
 /**
@@ -69,6 +70,109 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Computes several reductions of the values in all rows of a column in
+ * a single pass.
+ *
+ * This is equivalent to calling `cudf::reduce` once per aggregation, but
+ * reductions whose accumulators can be combined (`min`, `max`, `sum`,
+ * `sum_of_squares` and `mean` over numeric columns) share one pass over the
+ * input so each element is loaded from memory only once. Aggregations that
+ * cannot be fused fall back to individual `cudf::reduce` calls and each result
+ * is always identical to the result of the corresponding single-aggregation
+ * reduction.
+ *
+ * The i-th returned scalar is the result of `aggs[i]` computed with output
+ * type `output_dtypes[i]`, following the type rules documented on
+ * `cudf::reduce`.
+ *
+ * @throw cudf::logic_error if `aggs.size() != output_dtypes.size()`.
+ *
+ * @param col Input column view
+ * @param aggs Aggregation operators applied by the reduction
+ * @param output_dtypes The computation and output precision of each aggregation
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns Output scalars with the reduce results, one per aggregation
+ */
+std::vector<std::unique_ptr<scalar>> reduce_multi(
+  column_view const& col,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  std::vector<data_type> const& output_dtypes,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Computes the reduction of each segment of a column of values.
+ *
+ * The segments are described by an offsets column, as produced by a lists
+ * column or by `cudf::detail::make_offsets_child_column`: segment `i` covers
+ * the value rows `[offsets[i], offsets[i+1])` and produces output row `i`.
+ * This reduces each segment with a single `cub::DeviceSegmentedReduce` pass,
+ * so per-segment statistics do not require synthesizing group labels and
+ * running a groupby.
+ *
+ * An empty segment produces a null output row. Null values within a segment
+ * are skipped when `null_handling` is null_policy::EXCLUDE; with
+ * null_policy::INCLUDE any segment containing a null produces a null output
+ * row.
+ *
+ * Only `sum`, `product`, `min`, `max`, `any` and `all` aggregations are
+ * supported, over numeric value columns. Unlike `cudf::reduce`, no implicit
+ * widening is performed: `output_dtype` must match the input type (or BOOL8
+ * for `any` and `all`).
+ *
+ * @throw cudf::logic_error if `offsets` is empty or contains nulls.
+ * @throw cudf::logic_error if `output_dtype` does not match the rules above.
+ *
+ * @param values Column of values to reduce
+ * @param offsets Column of size_type offsets delimiting the segments; must contain
+ * `num_segments + 1` monotonically increasing values bounded by `values.size()`
+ * @param agg Aggregation operator applied to each segment
+ * @param output_dtype The computation and output precision
+ * @param null_handling Whether a null in a segment nullifies the segment's result
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Column with one reduction result per segment
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const& values,
+  column_view const& offsets,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Computes the same reduction over every column of a table in one
+ * kernel launch.
+ *
+ * This is equivalent to calling `cudf::reduce` once per column, but all
+ * columns are reduced by a single kernel — one thread block accumulates each
+ * column — so wide tables of small columns (e.g. a per-column statistics
+ * pass) avoid one kernel launch and one intermediate allocation per column.
+ *
+ * All columns must share one type. The result is a column with one row per
+ * input column: row `i` holds the reduction of `input.column(i)` and is null
+ * when that column is empty or entirely null. Null values are skipped.
+ *
+ * Only `sum`, `product`, `min` and `max` aggregations over numeric columns
+ * are supported and, as with `cudf::segmented_reduce`, no implicit widening
+ * is performed: `output_dtype` must match the column type.
+ *
+ * @throw cudf::logic_error if `input` has no columns or the column types
+ * differ.
+ * @throw cudf::logic_error if `output_dtype` does not match the column type.
+ *
+ * @param input Table whose columns are each reduced
+ * @param agg Aggregation operator applied to every column
+ * @param output_dtype The computation and output precision
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Column with one reduction result per input column
+ */
+std::unique_ptr<column> batched_reduce(
+  table_view const& input,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
@@ -94,6 +198,41 @@ std::unique_ptr<column> scan(
   null_policy null_handling           = null_policy::EXCLUDE,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Computes the scan of a column within runs of equal key rows.
+ *
+ * The scan restarts at every row whose `keys` row differs from the previous
+ * row's, following `thrust::inclusive_scan_by_key` semantics: rows with equal
+ * keys that are not adjacent belong to different runs. The input is therefore
+ * expected to already be clustered (e.g. sorted or sessionized) by `keys`;
+ * unlike a groupby scan no sort is performed, so a single pass over the data
+ * suffices. Null key rows compare equal to each other, matching groupby.
+ *
+ * Supports `sum`, `product`, `min` and `max` aggregations over numeric value
+ * columns. Null values are skipped for the operation when `null_handling` is
+ * null_policy::EXCLUDE, and the output row for a null input row is null; with
+ * null_policy::INCLUDE a null nullifies the remainder of its run.
+ *
+ * @throws cudf::logic_error if `values.size() != keys.num_rows()`.
+ * @throws cudf::logic_error if `keys` has no columns.
+ *
+ * @param values The input column of values to scan
+ * @param keys Table of key columns delimiting the runs
+ * @param agg unique_ptr to aggregation operator applied by the scan
+ * @param inclusive The flag for applying an inclusive scan if
+ *        scan_type::INCLUSIVE, an exclusive scan if scan_type::EXCLUSIVE.
+ * @param null_handling Whether a null value nullifies the rest of its run
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Column with one scan result per input row
+ */
+std::unique_ptr<column> scan_by_key(
+  column_view const& values,
+  table_view const& keys,
+  std::unique_ptr<aggregation> const& agg,
+  scan_type inclusive,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Determines the minimum and maximum values of a column.
  *
@@ -107,6 +246,81 @@ std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
   column_view const& col,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the row index of the minimum value of a column.
+ *
+ * Null values are skipped; ties resolve to the smallest index. The result is
+ * an INT32 scalar whose `is_valid()` is false when the column is empty or
+ * entirely null.
+ *
+ * @throw cudf::logic_error if the column type is not relationally comparable.
+ *
+ * @param col Column to search
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return Scalar holding the index of the minimum value
+ */
+std::unique_ptr<scalar> argmin(
+  column_view const& col,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the row index of the maximum value of a column.
+ *
+ * Null values are skipped; ties resolve to the smallest index. The result is
+ * an INT32 scalar whose `is_valid()` is false when the column is empty or
+ * entirely null.
+ *
+ * @throw cudf::logic_error if the column type is not relationally comparable.
+ *
+ * @param col Column to search
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return Scalar holding the index of the maximum value
+ */
+std::unique_ptr<scalar> argmax(
+  column_view const& col,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the row of a table holding the minimum value of one of its columns.
+ *
+ * Gathers the full row whose `input.column(value_column)` value is smallest in
+ * a single pass, replacing the sort-then-head pattern for "earliest/latest
+ * record" queries. Null values in the value column are skipped; ties resolve
+ * to the smallest index. If the value column is empty or entirely null the
+ * result has zero rows.
+ *
+ * @throw cudf::logic_error if `value_column` is out of range or the value
+ * column type is not relationally comparable.
+ *
+ * @param input Table to gather the row from
+ * @param value_column Index of the column whose minimum selects the row
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return A one-row table holding the row with the minimum value
+ */
+std::unique_ptr<table> min_by(
+  table_view const& input,
+  size_type value_column,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the row of a table holding the maximum value of one of its columns.
+ *
+ * The maximum-value counterpart of `cudf::min_by`; see there for the
+ * null-handling, tie-break and empty-result rules.
+ *
+ * @throw cudf::logic_error if `value_column` is out of range or the value
+ * column type is not relationally comparable.
+ *
+ * @param input Table to gather the row from
+ * @param value_column Index of the column whose maximum selects the row
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return A one-row table holding the row with the maximum value
+ */
+std::unique_ptr<table> max_by(
+  table_view const& input,
+  size_type value_column,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 }  // namespace cudf
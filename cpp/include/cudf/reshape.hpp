@@ -17,9 +17,13 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -51,6 +55,32 @@ std::unique_ptr<column> interleave_columns(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Separates an interleaved column into the columns of a table.
+ *
+ * Converts the row major column `input` into a column major table of
+ * `num_columns` columns. This is the inverse of `interleave_columns`.
+ * Example:
+ * ```
+ * input       = [A1, B1, A2, B2, A3, B3]
+ * num_columns = 2
+ * return      = [[A1, A2, A3], [B1, B2, B3]]
+ * ```
+ *
+ * @throws cudf::logic_error if `num_columns` is not positive.
+ * @throws cudf::logic_error if `input.size()` is not a multiple of `num_columns`.
+ *
+ * @param[in] input Column containing the interleaved values.
+ * @param[in] num_columns Number of columns to produce.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return The deinterleaved columns as a table
+ */
+std::unique_ptr<table> deinterleave_columns(
+  column_view const& input,
+  size_type num_columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Repeats the rows from `input` table `count` times to form a new table.
  *
@@ -88,6 +118,9 @@ enum class flip_endianness : bool { NO, YES };
  * return        = [[0x00, 0x00, 0x21, 0xe3], [0x00, 0x00, 0x01, 0x35]]
  * ```
  *
+ * The bytes are materialized into a new column; to reinterpret a column as a
+ * same-sized type without copying, use `cudf::bit_cast()` instead.
+ *
  * @param input_column Column to be converted to lists of bytes.
  * @param endian_configuration Whether to retain or flip the endianness of the elements.
  * @param mr Device memory resource used to allocate the returned column's device memory.
@@ -99,6 +132,53 @@ std::unique_ptr<column> byte_cast(
   flip_endianness endian_configuration,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Converts a table into packed row-major byte data
+ *
+ * Each row of the output is the fixed-width values of that table row packed
+ * together, one list of bytes per row. Within a row each value is placed at an
+ * offset aligned to its own size, a validity bitmask with one bit per column
+ * follows the values, and the row is padded to a multiple of 8 bytes so rows
+ * can be copied with 64-bit accesses. The layout is fully determined by the
+ * column types, in column order, and `from_rows` reverses it.
+ *
+ * The result is returned as multiple lists columns when the packed data is
+ * too large for a single column; the rows are in table order across the
+ * returned columns.
+ *
+ * @throws cudf::logic_error if any column is not of fixed-width type.
+ * @throws cudf::logic_error if a row is too large to be processed.
+ *
+ * @param input Table containing fixed-width columns to convert.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ *
+ * @return Lists columns of bytes, one list per input table row.
+ */
+std::vector<std::unique_ptr<column>> to_rows(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts packed row-major byte data back into a table
+ *
+ * This is the inverse of `to_rows`. The `schema` must match the column types
+ * the rows were created from, in the same order.
+ *
+ * @throws cudf::logic_error if the input is not a lists column of bytes.
+ * @throws cudf::logic_error if any schema type is not of fixed-width type.
+ * @throws cudf::logic_error if the input size does not match the schema layout.
+ *
+ * @param input Lists column of bytes in the layout produced by `to_rows`.
+ * @param schema The types of the columns packed into each row.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @return Table of fixed-width columns rebuilt from the rows.
+ */
+std::unique_ptr<table> from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 }  // namespace cudf
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+
+namespace cudf {
+
+/**
+ * @addtogroup column_factories
+ * @{
+ * @file
+ * @brief Run-end encoded column representation
+ */
+
+/**
+ * @brief A run-end encoded column: each run of equal adjacent values is stored
+ * once, alongside the exclusive end offset of the run.
+ *
+ * Run `i` covers the decoded rows `[run_ends[i - 1], run_ends[i])` (with an
+ * implicit 0 for the first run) and all of them hold `values[i]`, following
+ * Arrow's run-end encoding layout. Sorted or clustered columns — timestamps,
+ * status codes, partition keys — collapse to a handful of runs, so operations
+ * expressed over the runs touch orders of magnitude fewer elements than the
+ * decoded column.
+ *
+ * The encoding is a standalone representation rather than a new column type:
+ * `run_ends` is an INT32 column and `values` is a column of the input type
+ * (adjacent nulls form runs like any other equal values).
+ */
+class rle_column {
+ public:
+  /**
+   * @brief Assembles a run-end encoded column from its parts.
+   *
+   * @throws cudf::logic_error if `run_ends` is not a non-nullable INT32 column
+   * or its length differs from `values`
+   *
+   * @param run_ends Exclusive end offset of each run, ascending
+   * @param values One value per run
+   */
+  rle_column(std::unique_ptr<column> run_ends, std::unique_ptr<column> values);
+
+  /**
+   * @brief Returns a view of the run end offsets.
+   */
+  column_view run_ends() const;
+
+  /**
+   * @brief Returns a view of the run values.
+   */
+  column_view values() const;
+
+  /**
+   * @brief Returns the number of rows of the decoded column.
+   */
+  size_type size() const;
+
+  /**
+   * @brief Returns the number of runs.
+   */
+  size_type num_runs() const;
+
+ private:
+  std::unique_ptr<column> _run_ends;
+  std::unique_ptr<column> _values;
+  size_type _size;
+};
+
+/**
+ * @brief Run-end encodes a column.
+ *
+ * Supports every type with row equality semantics; nulls compare equal to each
+ * other, so adjacent nulls collapse into a run.
+ *
+ * @param input The column to encode
+ * @param mr Device memory resource used to allocate the encoding's device memory
+ * @return The run-end encoded column
+ */
+rle_column rle_encode(
+  column_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Materializes the decoded column of a run-end encoding.
+ *
+ * @param input The encoded column
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The decoded column
+ */
+std::unique_ptr<column> rle_decode(
+  rle_column const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Finds the insertion points of `needles` in the decoded domain of a
+ * sorted run-end encoded column without decoding it.
+ *
+ * Equivalent to `cudf::lower_bound` over the decoded column (ascending order,
+ * nulls after valid values), but the binary search runs over the run values —
+ * one element per run — and the hit is translated through `run_ends`, so the
+ * cost scales with the number of runs rather than the number of rows.
+ *
+ * @param haystack The encoded column; its decoded form must be sorted ascending
+ * @param needles Values to search for
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT32 column of insertion points into the decoded domain
+ */
+std::unique_ptr<column> rle_lower_bound(
+  rle_column const& haystack,
+  column_view const& needles,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Finds the last insertion points of `needles` in the decoded domain of
+ * a sorted run-end encoded column without decoding it.
+ *
+ * The `cudf::upper_bound` counterpart of `rle_lower_bound`.
+ *
+ * @param haystack The encoded column; its decoded form must be sorted ascending
+ * @param needles Values to search for
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT32 column of insertion points into the decoded domain
+ */
+std::unique_ptr<column> rle_upper_bound(
+  rle_column const& haystack,
+  column_view const& needles,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -20,6 +20,8 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 /**
@@ -48,6 +50,12 @@ namespace cudf {
  *   it is suggested to convert integer column types (especially low-precision integers)
  *   to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
  *
+ * In addition to the fixed aggregation list, user-defined window functions are supported via
+ * `make_udf_aggregation()`: a CUDA-C or PTX function operating on the window's values is
+ * JIT-compiled into the rolling kernel at runtime and cached across invocations (and, with
+ * `LIBCUDF_KERNEL_CACHE_PATH` set, across processes). UDF aggregations currently require an
+ * input column without nulls.
+ *
  * @param[in] input The input column
  * @param[in] preceding_window The static rolling window size in the backward direction.
  * @param[in] following_window The static rolling window size in the forward direction.
@@ -89,6 +97,37 @@ std::unique_ptr<column> rolling_window(
   rolling_aggregation const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Applies several rolling window aggregations over the same fixed-size window.
+ *
+ * Equivalent to calling `rolling_window` once per aggregation, but when every requested
+ * aggregation is one of SUM, MIN, MAX, MEAN, COUNT_VALID, VARIANCE or STD and the input is
+ * numeric, all of them are computed in a single kernel pass: each window's elements are
+ * visited once and feed multiple accumulators, instead of once per aggregation. Other
+ * aggregations (or non-numeric inputs) fall back to one pass per aggregation and still
+ * produce the same results.
+ *
+ * Output column types and null semantics per aggregation match the single-aggregation
+ * overload.
+ *
+ * @param[in] input The input column
+ * @param[in] preceding_window The static rolling window size in the backward direction
+ * @param[in] following_window The static rolling window size in the forward direction
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null
+ * @param[in] aggs The rolling window aggregations to compute
+ * @param[in] mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @returns One nullable output column per requested aggregation, in request order
+ */
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Abstraction for window boundary sizes
  */
@@ -532,6 +571,45 @@ std::unique_ptr<column> grouped_range_rolling_window(
   rolling_aggregation const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Precomputes the per-row window extents of a grouped, range-based window specification.
+ *
+ * `grouped_range_rolling_window()` derives every row's window with binary searches over the
+ * order-by column. When several aggregations are run over identical windows, that search cost is
+ * paid once per aggregation. This function performs the searches once, returning a pair of
+ * `INT32` columns holding each row's preceding and following window extents (in rows, with the
+ * same semantics as the window columns accepted by `rolling_window()`).
+ *
+ * The returned columns may be passed to `rolling_window()` any number of times, e.g.:
+ *
+ * @code{.pseudo}
+ * auto [preceding, following] =
+ *   grouped_range_rolling_window_bounds(keys, orderby, order, preceding_bounds, following_bounds);
+ * auto sums  = rolling_window(input, *preceding, *following, min_periods, sum_aggr);
+ * auto means = rolling_window(input, *preceding, *following, min_periods, mean_aggr);
+ * @endcode
+ *
+ * `group_keys` and `orderby_column` must be pre-sorted exactly as required by
+ * `grouped_range_rolling_window()`; the same type combinations of order-by column and range
+ * bounds are supported.
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] orderby_column The (pre-sorted) order-by column, for range comparisons
+ * @param[in] order  The order (ASCENDING/DESCENDING) in which the order-by column is sorted
+ * @param[in] preceding The interval value in the backward direction
+ * @param[in] following The interval value in the forward direction
+ * @param[in] mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @returns   A pair of `INT32` columns with each row's preceding and following window extents
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_range_rolling_window_bounds(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
@@ -166,5 +166,65 @@ std::unique_ptr<column> contains(
   column_view const& needles,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A set of values prepared once for repeated `contains` probes.
+ *
+ * `cudf::contains(haystack, needles)` rebuilds its device hash set from the
+ * needles on every call, so screening a stream of batches against one large
+ * IN-list pays the build cost per batch. A `contains_lookup` hashes the
+ * needles once at construction; each `contains` call then only probes.
+ *
+ * The lookup owns a copy of the needles, so the column passed to the
+ * constructor need not outlive it. Probing matches `cudf::contains`
+ * exactly, including its null semantics and supported types.
+ *
+ * @code{.pseudo}
+ *   lookup = contains_lookup(needles)   // hash 50k literals once
+ *   for each batch:
+ *     mask = lookup.contains(batch)     // probe only
+ * @endcode
+ */
+class contains_lookup {
+ public:
+  /**
+   * @brief Builds the hash set of `needles` values to be probed.
+   *
+   * @param needles A column of values to search for in later `contains` calls
+   * @param mr Device memory resource used to allocate the lookup's device memory
+   */
+  explicit contains_lookup(
+    column_view const& needles,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  contains_lookup(contains_lookup&&);
+  contains_lookup& operator=(contains_lookup&&);
+  contains_lookup(contains_lookup const&) = delete;
+  contains_lookup& operator=(contains_lookup const&) = delete;
+  ~contains_lookup();
+
+  /**
+   * @brief  Returns a new column of type bool identifying for each element of
+   *         @p haystack, if that element is contained in the prepared needles.
+   *
+   * Equivalent to `cudf::contains(haystack, needles, mr)` with the needles
+   * this lookup was built from.
+   *
+   * @throws cudf::logic_error if `haystack.type()` does not match the needles type
+   *
+   * @param haystack A column object
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A column of bool elements containing true if the corresponding entry in haystack
+   * appears in the needles and false if it does not.
+   */
+  std::unique_ptr<column> contains(
+    column_view const& haystack,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  struct impl;
+
+ private:
+  std::unique_ptr<impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
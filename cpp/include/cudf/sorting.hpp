@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
@@ -117,6 +118,37 @@ std::unique_ptr<table> sort(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the first `k` rows of the table in a lexicographic sorted order
+ *
+ * Equivalent to selecting the first `k` rows of `cudf::sort(input)`, but only the
+ * selected rows are gathered, and for a single fixed-width key column without nulls
+ * the full sorted permutation of the table is never materialized.
+ *
+ * If `k` is greater than or equal to the number of rows, the result is the same as
+ * `cudf::sort(input)`.
+ *
+ * @throws cudf::logic_error if `k` is negative
+ *
+ * @param input The table to select from
+ * @param k The number of rows to return
+ * @param column_order The desired order for each column. Size must be
+ * equal to `input.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `input`. Size must be equal to
+ * `input.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return New table containing the first `k` rows of `input` in sorted order
+ */
+std::unique_ptr<table> top_k(
+  table_view const& input,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Performs a key-value sort.
  *
@@ -266,5 +298,101 @@ std::unique_ptr<table> stable_segmented_sort_by_key(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Serves a sorted result set page by page without re-sorting or
+ * materializing the full sorted table.
+ *
+ * The constructor computes the stable sorted order of `input` once; each
+ * `next_page(max_rows)` then gathers only the next rows through the stored
+ * permutation, so fetching a later page of a large result costs one small
+ * gather instead of a re-sort. The cursor is stable: the permutation is fixed
+ * at construction, so successive pages never overlap or skip rows even where
+ * equal keys make the sort order ambiguous.
+ *
+ * Between pages the cursor holds only the permutation (4 bytes per row) and a
+ * view of the source table. The permutation can additionally be spilled to
+ * host memory with `spill()` to free that device memory too; `next_page` then
+ * uploads just the page's slice of indices before gathering.
+ *
+ * The caller must keep the source table alive and unmodified for the lifetime
+ * of the cursor.
+ */
+class result_cursor {
+ public:
+  result_cursor() = delete;
+  ~result_cursor();
+  result_cursor(result_cursor const&) = delete;
+  result_cursor& operator=(result_cursor const&) = delete;
+  result_cursor(result_cursor&&)                 = default;
+  result_cursor& operator=(result_cursor&&) = default;
+
+  /**
+   * @brief Constructs a cursor over `input` sorted by the given order.
+   *
+   * @param input The table to serve in sorted order
+   * @param column_order The desired sort order for each column. Size must be
+   * equal to `input.num_columns()` or empty. If empty, all columns are sorted
+   * in ascending order.
+   * @param null_precedence The desired order of null compared to other
+   * elements for each column. Size must be equal to `input.num_columns()` or
+   * empty. If empty, all columns use `null_order::BEFORE`.
+   * @param mr Device memory resource used to allocate the stored permutation
+   */
+  explicit result_cursor(
+    table_view const& input,
+    std::vector<order> const& column_order         = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the next page of up to `max_rows` rows in sorted order.
+   *
+   * Returns fewer rows for the last page and an empty table once the cursor
+   * is exhausted.
+   *
+   * @throws cudf::logic_error if `max_rows` is not positive.
+   *
+   * @param max_rows Maximum number of rows in the returned page
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return Table holding the page's rows
+   */
+  std::unique_ptr<table> next_page(
+    size_type max_rows,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Moves the cursor so the next page starts at sorted row `position`.
+   *
+   * @throws cudf::logic_error if `position` is negative or greater than the
+   * number of rows.
+   *
+   * @param position Sorted row index the next page starts at
+   */
+  void seek(size_type position);
+
+  /**
+   * @brief Copies the permutation to host memory and frees its device memory.
+   *
+   * Subsequent pages upload only their slice of indices. A no-op if the
+   * cursor is already spilled.
+   */
+  void spill();
+
+  /// Sorted row index the next page starts at
+  size_type position() const { return _position; }
+
+  /// Total number of rows served by the cursor
+  size_type num_rows() const { return _input.num_rows(); }
+
+  /// True if pages remain
+  bool has_next() const { return _position < _input.num_rows(); }
+
+ private:
+  table_view _input;                   ///< Source table the pages are gathered from
+  std::unique_ptr<column> _order;      ///< Device permutation; empty once spilled
+  std::vector<size_type> _host_order;  ///< Host copy of the permutation once spilled
+  size_type _position = 0;             ///< Sorted row index the next page starts at
+};
+
 /** @} */  // end of group
 }  // namespace cudf
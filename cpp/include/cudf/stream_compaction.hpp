@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
 #include <vector>
 
@@ -204,6 +207,103 @@ std::unique_ptr<table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Filters a table using a column of boolean values as a mask, destroying the
+ * input table as it goes.
+ *
+ * @ingroup reorder_filter
+ *
+ * Produces the same result as `apply_boolean_mask(input->view(), boolean_mask, mr)` except
+ * that each column of `input` is freed as soon as it has been filtered, so peak device
+ * memory usage is roughly the size of the input plus one column rather than the input
+ * plus the full output. Use this form when the input table is no longer needed and
+ * memory, not compute, limits batch size.
+ *
+ * @throws cudf::logic_error if `input.num_rows() != boolean_mask.size()`.
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param[in] input The input table to filter, consumed by the operation
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used
+ * as a mask to filter the `input`. Must not reference the device memory of `input`.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing all rows of `input` passing the filter defined by
+ * @p boolean_mask.
+ */
+std::unique_ptr<table> apply_boolean_mask(
+  std::unique_ptr<table>&& input,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts a boolean mask into a gather map of the passing row indices.
+ *
+ * @ingroup reorder_filter
+ *
+ * Returns a `size_type` column containing, in ascending order, the index of
+ * every row for which the corresponding element of `boolean_mask` is non-null
+ * and `true`. Gathering with the returned map produces the same result as
+ * `apply_boolean_mask`, but the mask is scanned only once regardless of how
+ * many columns (or tables) are subsequently gathered with the map.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @return Column of the indices of rows passing the filter defined by
+ * @p boolean_mask, for use with `cudf::gather`.
+ */
+std::unique_ptr<column> mask_to_gather_map(
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters `input` using a bit-packed boolean column as a mask.
+ *
+ * @ingroup reorder_filter
+ *
+ * Element `i` of each column of `input` is copied to the output iff bit `i` of
+ * `boolean_mask` is set. Equivalent to applying `boolean_mask.to_column()` with
+ * the `BOOL8` overload, but the mask is read in its packed form, so no
+ * unpacking column is ever allocated. This operation is stable: the input
+ * order is preserved.
+ *
+ * @throws cudf::logic_error if `input.num_rows() != boolean_mask.size()` and
+ * `input.num_rows() != 0`
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] boolean_mask A packed boolean column used as a mask to filter the `input`
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of all rows of @p input passing
+ * the filter defined by @p boolean_mask.
+ */
+std::unique_ptr<table> apply_boolean_mask(
+  table_view const& input,
+  packed_bools const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters a table to the rows where a predicate expression is true.
+ *
+ * @ingroup reorder_filter
+ *
+ * Produces the same result as evaluating `predicate` with `cudf::compute_column`
+ * and passing the resulting column to `apply_boolean_mask`, but fuses the
+ * predicate evaluation into the compaction kernels so the boolean mask is never
+ * materialized in device memory. Rows where the predicate evaluates to null are
+ * filtered out.
+ *
+ * @throws cudf::logic_error if `predicate` does not evaluate to a boolean
+ *
+ * @param[in] input The input table to filter
+ * @param[in] predicate AST expression evaluated against each row of `input`
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing all rows of `input` for which `predicate` is true
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
@@ -243,6 +343,109 @@ std::unique_ptr<table> drop_duplicates(
   null_order null_precedence          = null_order::BEFORE,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a new table without duplicate rows, without sorting
+ *
+ * Given an `input` table_view, each row is copied to the output table if the
+ * corresponding row of `keys` columns has not been seen before. Deduplication is
+ * performed with a concurrent hash set rather than a sort, so the relative cost
+ * does not grow with the number or width of the key columns the way
+ * `drop_duplicates` does. The rows that are kept appear in the output in the
+ * same relative order as in `input`, but which of several duplicate rows
+ * survives is unspecified. Use `drop_duplicates` when a particular duplicate
+ * (first or last) must be retained.
+ *
+ * @param[in] input       input table_view to copy only distinct rows
+ * @param[in] keys        vector of indices representing key columns from `input`
+ * @param[in] nulls_equal flag to denote nulls are equal if null_equality::EQUAL, nulls are not
+ *                        equal if null_equality::UNEQUAL
+ * @param[in] mr          Device memory resource used to allocate the returned table's device
+ * memory
+ *
+ * @return Table with one row per distinct key.
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Incrementally deduplicates a stream of tables against all rows seen
+ * so far.
+ *
+ * Unlike `drop_duplicates`, which considers a single table in isolation, a
+ * `distinct_builder` keeps a persistent device hash set of every distinct key
+ * row it has been given. Each call to `insert` returns only the rows of the
+ * batch whose keys have not been seen in any earlier batch (nor earlier in the
+ * same batch), and adds those keys to the set. Previously seen rows are never
+ * re-hashed or re-sorted when a new batch arrives, so the per-batch cost is
+ * proportional to the batch size, not to the history.
+ *
+ * If a key occurs more than once within a single batch, exactly one of the
+ * duplicate rows is emitted; which one is unspecified.
+ *
+ * @code{.pseudo}
+ * builder = distinct_builder({{}})           // empty int column as schema
+ * builder.insert({{4, 5, 4, 6}}) -> {{4, 5, 6}}
+ * builder.insert({{5, 7, 4}})    -> {{7}}
+ * @endcode
+ */
+class distinct_builder {
+ public:
+  distinct_builder() = delete;
+  ~distinct_builder();
+  distinct_builder(distinct_builder const&) = delete;
+  distinct_builder(distinct_builder&&)      = delete;
+  distinct_builder& operator=(distinct_builder const&) = delete;
+  distinct_builder& operator=(distinct_builder&&) = delete;
+
+  /**
+   * @brief Construct a distinct builder for subsequent insert calls.
+   *
+   * The column types of `initial` define the key schema every inserted batch
+   * must match. Rows of `initial` (deduplicated) seed the set of seen keys but
+   * are not returned by later `insert` calls; pass a table with no rows to
+   * start from an empty history.
+   *
+   * @param initial Table whose rows seed the set of seen keys
+   * @param nulls_equal Controls whether null key values are considered equal.
+   * If `null_equality::UNEQUAL`, rows with nulls in their keys never match and
+   * are always emitted as newly seen.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  distinct_builder(cudf::table_view const& initial,
+                   null_equality nulls_equal    = null_equality::EQUAL,
+                   rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Inserts a batch and returns the rows whose keys were not seen before.
+   *
+   * @throws cudf::logic_error if the column types of `batch` do not match the
+   * types of the table the builder was constructed with.
+   *
+   * @param batch The batch of rows to deduplicate against the accumulated history
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   *
+   * @return Table containing the rows of `batch` whose keys were newly seen
+   */
+  std::unique_ptr<table> insert(
+    cudf::table_view const& batch,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the number of distinct key rows seen so far.
+   */
+  size_type num_seen() const;
+
+ private:
+  struct distinct_builder_impl;
+
+  std::unique_ptr<distinct_builder_impl> impl;
+};
+
 /**
  * @brief Count the unique elements in the column_view
  *
@@ -23,11 +23,11 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/copy.h>
 #include <thrust/for_each.h>
-#include <thrust/transform_reduce.h>
 
 namespace cudf {
 namespace strings {
@@ -66,16 +66,8 @@ std::unique_ptr<column> make_strings_column(IndexPairIterator begin,
 
   using string_index_pair = thrust::pair<const char*, size_type>;
 
-  // check total size is not too large for cudf column
-  auto size_checker = [] __device__(string_index_pair const& item) {
-    return (item.first != nullptr) ? item.second : 0;
-  };
-  size_t const bytes = thrust::transform_reduce(
-    rmm::exec_policy(stream), begin, end, size_checker, 0, thrust::plus<size_t>());
-  CUDF_EXPECTS(bytes < static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
-               "total size of strings is too large for cudf column");
-
-  // build offsets column from the strings sizes
+  // build offsets column from the strings sizes;
+  // this also verifies the total size fits in a cudf column
   auto offsets_transformer = [] __device__(string_index_pair item) {
     return (item.first != nullptr ? static_cast<int32_t>(item.second) : 0);
   };
@@ -83,12 +75,31 @@ std::unique_ptr<column> make_strings_column(IndexPairIterator begin,
   auto offsets_column          = strings::detail::make_offsets_child_column(
     offsets_transformer_itr, offsets_transformer_itr + strings_count, stream, mr);
 
-  // create null mask
+  // create the null mask asynchronously, leaving the valid count in device memory
   auto validator = [] __device__(string_index_pair const item) { return item.first != nullptr; };
-  auto new_nulls = cudf::detail::valid_if(begin, end, validator, stream, mr);
-  auto const null_count = new_nulls.second;
+  rmm::device_scalar<size_type> valid_count{0, stream};
   auto null_mask =
-    (null_count > 0) ? std::move(new_nulls.first) : rmm::device_buffer{0, stream, mr};
+    cudf::detail::valid_if_async(begin, end, validator, valid_count.data(), stream, mr);
+
+  // a single synchronization point retrieves the total bytes and the valid count
+  // together once all of the preceding kernels have been enqueued
+  size_type h_bytes       = 0;
+  size_type h_valid_count = 0;
+  CUDA_TRY(cudaMemcpyAsync(&h_bytes,
+                           offsets_column->view().template data<int32_t>() + strings_count,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  CUDA_TRY(cudaMemcpyAsync(&h_valid_count,
+                           valid_count.data(),
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  auto const bytes      = static_cast<std::size_t>(h_bytes);
+  auto const null_count = strings_count - h_valid_count;
+  if (null_count == 0) { null_mask = rmm::device_buffer{0, stream, mr}; }
 
   auto const avg_bytes_per_row = bytes / std::max(strings_count - null_count, 1);
   // build chars column
@@ -22,11 +22,14 @@
 #include <cudf/strings/string_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/transform.h>
 
+#include <limits>
 #include <mutex>
 #include <unordered_map>
 
@@ -58,13 +61,27 @@ std::unique_ptr<column> make_offsets_child_column(
     make_numeric_column(data_type{type_id::INT32}, count + 1, mask_state::UNALLOCATED, stream, mr);
   auto offsets_view = offsets_column->mutable_view();
   auto d_offsets    = offsets_view.template data<int32_t>();
+  // The scan is computed in 64-bit so exceeding the 32-bit offset type is
+  // detected and reported rather than silently wrapping into corrupt offsets.
   // Using inclusive-scan to compute last entry which is the total size.
   // Exclusive-scan is possible but will not compute that last entry.
   // Rather than manually computing the final offset using values in device memory,
-  // we use inclusive-scan on a shifted output (d_offsets+1) and then set the first
-  // offset values to zero manually.
-  thrust::inclusive_scan(rmm::exec_policy(stream), begin, end, d_offsets + 1);
-  CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(int32_t), stream.value()));
+  // we use inclusive-scan on a shifted output (offsets64+1) and then set the first
+  // offset value to zero manually.
+  auto input_itr = thrust::make_transform_iterator(
+    begin, [] __device__(auto v) { return static_cast<int64_t>(v); });
+  rmm::device_uvector<int64_t> offsets64(count + 1, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), input_itr, input_itr + count, offsets64.begin() + 1);
+  offsets64.set_element_to_zero_async(0, stream);
+  auto const total_bytes = offsets64.back_element(stream);
+  CUDF_EXPECTS(total_bytes <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+               "total size of strings is too large for cudf column");
+  thrust::transform(rmm::exec_policy(stream),
+                    offsets64.begin(),
+                    offsets64.end(),
+                    d_offsets,
+                    [] __device__(int64_t offset) { return static_cast<int32_t>(offset); });
   return offsets_column;
 }
 
@@ -78,6 +78,23 @@ std::unique_ptr<cudf::column> child_chars_from_string_vector(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns true if the column's strings are long enough on average
+ * that a warp-per-string kernel is expected to outperform the usual
+ * thread-per-string kernel.
+ *
+ * Thread-per-string kernels serialize the byte loop of each string in a
+ * single thread, so columns of mostly long strings suffer from divergence
+ * and poor load coalescing. Callers that provide a warp-parallel variant
+ * should use this to decide which kernel to launch.
+ *
+ * Only column metadata is inspected; no device work is performed.
+ *
+ * @param input Strings column to measure
+ * @return True if a warp-per-string kernel should be preferred
+ */
+bool prefer_warp_parallel(strings_column_view const& input);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
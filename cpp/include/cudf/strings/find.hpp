@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
@@ -127,6 +128,29 @@ std::unique_ptr<column> contains(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a column of boolean values for each row of a dictionary column
+ * where true indicates the target string was found within that row's key string.
+ *
+ * The search runs over the distinct keys only and each row's result is mapped
+ * through its dictionary index, so the amount of work scales with the number of
+ * keys rather than the number of rows.
+ *
+ * Any null entries in the dictionary column return corresponding null entries
+ * in the output column.
+ *
+ * @throw cudf::logic_error if the dictionary keys are not a strings column
+ *
+ * @param input Dictionary column with string keys.
+ * @param target UTF-8 encoded string to search for in each key.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New type_id::BOOL8 column.
+ */
+std::unique_ptr<column> contains(
+  dictionary_column_view const& input,
+  string_scalar const& target,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a column of boolean values for each string where true indicates
  * the target string was found at the beginning of that string in the provided column.
@@ -57,6 +57,38 @@ std::unique_ptr<table> findall_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the character positions of each matching occurrence of the
+ * regex pattern within each string.
+ *
+ * The output is a LIST column with one STRUCT element per match holding two
+ * INT32 members: the begin (inclusive) and end (exclusive) character
+ * positions of the match. Unlike findall_re, the matched substrings are not
+ * copied into the result.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["bunny","rabbit"]
+ * r = findall_positions_re(s, "[ab]")
+ * r is now a LIST column:
+ *   [[(0,1)], [(1,2),(2,3),(3,4)]]
+ * @endcode
+ *
+ * A string with no matches produces an empty list row.
+ * Any null string entries return corresponding null output rows.
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported by this API.
+ *
+ * @param strings Strings instance for this operation.
+ * @param pattern Regex pattern to match within each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of (begin,end) position pairs.
+ */
+std::unique_ptr<column> findall_positions_re(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <thrust/optional.h>
 
@@ -119,6 +120,28 @@ std::unique_ptr<cudf::column> get_json_object(
   get_json_object_options options     = get_json_object_options{},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply several JSONPath strings to all rows in an input strings column.
+ *
+ * Returns one strings column per path, each equal to calling `get_json_object`
+ * with that path alone. All paths are evaluated together per document visit,
+ * so a document is pulled through the parser once per kernel pass regardless
+ * of how many fields are extracted from it, instead of being re-read from
+ * device memory once per path.
+ *
+ * @param col The input strings column. Each row must contain a valid json string
+ * @param json_paths The JSONPath strings to be applied to each row; must remain
+ * valid until the call returns
+ * @param options Options for controlling the behavior of the function
+ * @param mr Resource for allocating device memory.
+ * @return One strings column of retrieved json object strings per path
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_object(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options     = get_json_object_options{},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -232,6 +232,50 @@ std::unique_ptr<column> rsplit_record(
   size_type maxsplit                  = -1,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Splits individual strings elements into lists of token positions
+ * without copying any character data.
+ *
+ * The tokens are identified exactly as in `split_record` but instead of
+ * materializing each token into new child strings columns, the output is a
+ * lists column of structs where each struct holds the byte offset of the
+ * token within the input column's character data and the token's size in
+ * bytes. The first struct child is the INT32 byte offset and the second is
+ * the INT32 byte length.
+ *
+ * This is useful for tokenize-then-select pipelines where only a few tokens
+ * are ultimately kept: no memory is allocated for token character data.
+ *
+ * @code{.pseudo}
+ * s = ["a_bc", "def_g"]
+ * s1 = split_to_list_view(s, "_")
+ * s1 is a lists column of (offset, length) structs:
+ *     [ [{0, 1}, {2, 2}],
+ *       [{4, 3}, {8, 1}] ]
+ * @endcode
+ *
+ * The returned column does not own the character data it refers to; it is
+ * only valid for the lifetime of the input column.
+ *
+ * A null string element will result in a null list item for that row.
+ *
+ * @throw cudf:logic_error if `delimiter` is invalid.
+ *
+ * @param strings A column of string elements to be split.
+ * @param delimiter The string to identify split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform.
+ *        Default of -1 indicates all possible splits on each string.
+ * @param mr Device memory resource used to allocate the returned result's device memory.
+ * @return Lists column of (byte offset, byte length) structs referencing the
+ *         input column's character data.
+ */
+std::unique_ptr<column> split_to_list_view(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -22,12 +22,6 @@
 #include <cudf/utilities/error.hpp>
 #endif
 
-// This is defined when including this header in a https://github.com/NVIDIA/jitify
-// or jitify2 source file. The jitify cannot include thrust headers at this time.
-#ifndef CUDF_JIT_UDF
-#include <thrust/count.h>
-#endif
-
 // This file should only include device code logic.
 // Host-only or host/device code should be defined in the string_view.hpp header file.
 
@@ -45,13 +39,31 @@ namespace detail {
 __device__ inline size_type characters_in_string(const char* str, size_type bytes)
 {
   if ((str == 0) || (bytes == 0)) return 0;
-  auto ptr = reinterpret_cast<uint8_t const*>(str);
+  auto ptr       = reinterpret_cast<uint8_t const*>(str);
+  auto const end = ptr + bytes;
 #ifndef CUDF_JIT_UDF
-  return thrust::count_if(
-    thrust::seq, ptr, ptr + bytes, [](uint8_t chr) { return is_begin_utf8_char(chr); });
+  size_type chars = 0;
+  // consume unaligned leading bytes so the 8-byte loads below are aligned
+  while (ptr < end && (reinterpret_cast<uintptr_t>(ptr) & 7) != 0) {
+    chars += is_begin_utf8_char(*ptr++);
+  }
+  // SWAR: count UTF-8 continuation bytes (10xxxxxx) eight at a time;
+  // every other byte begins a character
+  while (ptr + 8 <= end) {
+    auto const v = *reinterpret_cast<uint64_t const*>(ptr);
+    // mark the high bit of each byte b where (b & 0xC0) == 0x80
+    auto const continuations = v & ~(v << 1) & 0x8080808080808080ul;
+    chars += 8 - __popcll(continuations);
+    ptr += 8;
+  }
+  while (ptr < end) {
+    chars += is_begin_utf8_char(*ptr++);
+  }
+  return chars;
 #else
+  // CUDF_JIT_UDF is defined when including this header in a jitify source file,
+  // which cannot rely on <cstdint> types; keep the byte-wise loop there
   size_type chars = 0;
-  auto const end  = ptr + bytes;
   while (ptr < end) {
     chars += is_begin_utf8_char(*ptr++);
   }
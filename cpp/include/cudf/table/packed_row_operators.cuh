@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+
+/**
+ * @brief Computes the hash value of a row stored in a packed byte layout.
+ *
+ * Unlike `row_hasher`, no per-column type dispatch happens per row; the row's
+ * bytes are hashed as one contiguous key. Hash values therefore differ from
+ * `row_hasher` and must only be paired with `packed_row_equality_comparator`
+ * over the same packed rows.
+ */
+class packed_row_hasher {
+ public:
+  packed_row_hasher(uint8_t const* rows, size_type row_size, uint32_t seed = DEFAULT_HASH_SEED)
+    : _rows{rows}, _row_size{row_size}, _seed{seed}
+  {
+  }
+
+  __device__ hash_value_type operator()(size_type row_index) const
+  {
+    auto const row =
+      reinterpret_cast<char const*>(_rows + static_cast<std::size_t>(row_index) * _row_size);
+    return MurmurHash3_32<string_view>{_seed}(string_view{row, _row_size});
+  }
+
+ private:
+  uint8_t const* _rows;
+  size_type _row_size;
+  uint32_t _seed;
+};
+
+/**
+ * @brief Performs equality comparison of two rows stored in a packed byte layout.
+ *
+ * Rows compare equal when all of their bytes match. This matches element-wise
+ * equality for the column types accepted by `packed_row_table`.
+ */
+class packed_row_equality_comparator {
+ public:
+  packed_row_equality_comparator(uint8_t const* rows, size_type row_size)
+    : _rows{rows}, _row_size{row_size}
+  {
+  }
+
+  __device__ bool operator()(size_type lhs_index, size_type rhs_index) const
+  {
+    auto const* lhs = _rows + static_cast<std::size_t>(lhs_index) * _row_size;
+    auto const* rhs = _rows + static_cast<std::size_t>(rhs_index) * _row_size;
+    for (size_type i = 0; i < _row_size; ++i) {
+      if (lhs[i] != rhs[i]) { return false; }
+    }
+    return true;
+  }
+
+ private:
+  uint8_t const* _rows;
+  size_type _row_size;
+};
+
+/**
+ * @brief Packs a table's column values into an interleaved row-major byte layout.
+ *
+ * The packing is done once per table with one strided copy per column, so the
+ * hash and equality operators it hands out read each row as contiguous bytes
+ * without any per-column type dispatch. This pays off for hash-based
+ * operators on tables with many columns, where the dispatch loop in
+ * `row_hasher`/`row_equality_comparator` dominates.
+ *
+ * Only null-free fixed-width columns are supported, excluding floating-point
+ * types since their byte equality differs from value equality (-0.0/0.0 and
+ * NaNs). Use `is_supported` to decide between this and the classic row
+ * operators at runtime.
+ */
+class packed_row_table {
+ public:
+  /**
+   * @brief Indicates whether all columns of `input` can be packed.
+   */
+  static bool is_supported(table_view const& input)
+  {
+    return std::all_of(input.begin(), input.end(), [](column_view const& col) {
+      return is_fixed_width(col.type()) and not is_floating_point(col.type()) and
+             not col.has_nulls();
+    });
+  }
+
+  packed_row_table(table_view const& input, rmm::cuda_stream_view stream)
+    : _num_rows{input.num_rows()}, _rows{0, stream}
+  {
+    CUDF_EXPECTS(is_supported(input),
+                 "Only null-free, non-floating-point fixed-width columns can be packed");
+
+    _row_size = std::accumulate(input.begin(), input.end(), size_type{0}, [](auto sum, auto col) {
+      return sum + size_of(col.type());
+    });
+    _rows.resize(static_cast<std::size_t>(_num_rows) * _row_size, stream);
+
+    // one strided copy per column interleaves the values row-major
+    size_type column_offset = 0;
+    for (auto const& col : input) {
+      auto const width = size_of(col.type());
+      auto const* src  = col.head<uint8_t>() + static_cast<std::size_t>(col.offset()) * width;
+      CUDA_TRY(cudaMemcpy2DAsync(_rows.data() + column_offset,
+                                 _row_size,
+                                 src,
+                                 width,
+                                 width,
+                                 _num_rows,
+                                 cudaMemcpyDefault,
+                                 stream.value()));
+      column_offset += width;
+    }
+  }
+
+  /**
+   * @brief Returns a hasher over the packed rows.
+   */
+  packed_row_hasher hasher(uint32_t seed = DEFAULT_HASH_SEED) const
+  {
+    return packed_row_hasher{_rows.data(), _row_size, seed};
+  }
+
+  /**
+   * @brief Returns an equality comparator over the packed rows.
+   */
+  packed_row_equality_comparator equality_comparator() const
+  {
+    return packed_row_equality_comparator{_rows.data(), _row_size};
+  }
+
+  [[nodiscard]] size_type num_rows() const { return _num_rows; }
+  [[nodiscard]] size_type row_size() const { return _row_size; }
+
+ private:
+  size_type _num_rows;
+  size_type _row_size{};
+  rmm::device_uvector<uint8_t> _rows;
+};
+
+}  // namespace cudf
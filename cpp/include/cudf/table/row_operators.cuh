@@ -301,8 +301,44 @@ class element_relational_comparator {
                               rhs.element<Element>(rhs_element_index));
   }
 
+  /**
+   * @brief Performs a relational comparison between two struct elements, by comparing
+   * their member columns in order.
+   *
+   * Null struct rows are ordered by `null_precedence` before any member is examined, so
+   * member null masks need not have parent nulls superimposed. Members must themselves be
+   * relationally comparable; deeper nesting requires flattening.
+   */
+  template <typename Element, std::enable_if_t<std::is_same_v<Element, struct_view>>* = nullptr>
+  __device__ weak_ordering operator()(size_type lhs_element_index,
+                                      size_type rhs_element_index) const noexcept
+  {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+
+      if (lhs_is_null or rhs_is_null) {  // atleast one is null
+        return null_compare(lhs_is_null, rhs_is_null, null_precedence);
+      }
+    }
+
+    // Children of a sliced struct column are not themselves sliced; the parent offset
+    // must be applied when indexing into them.
+    for (size_type i = 0; i < lhs.num_child_columns(); ++i) {
+      auto const comparator =
+        element_relational_comparator<has_nulls>{lhs.child(i), rhs.child(i), null_precedence};
+      auto const state = cudf::type_dispatcher(lhs.child(i).type(),
+                                               comparator,
+                                               lhs_element_index + lhs.offset(),
+                                               rhs_element_index + rhs.offset());
+      if (state != weak_ordering::EQUIVALENT) { return state; }
+    }
+    return weak_ordering::EQUIVALENT;
+  }
+
   template <typename Element,
-            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>()>* = nullptr>
+            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>() and
+                             not std::is_same_v<Element, struct_view>>* = nullptr>
   __device__ weak_ordering operator()(size_type lhs_element_index, size_type rhs_element_index)
   {
     cudf_assert(false && "Attempted to compare elements of uncomparable types.");
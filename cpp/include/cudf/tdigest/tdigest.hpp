@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/tdigest/tdigest_column_view.cuh>
+#include <cudf/types.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace tdigest {
+
+/**
+ * @brief Create a tdigest column summarizing the distribution of values in `input`
+ *
+ * The result is a one-row tdigest column of the structure described in
+ * `tdigest_column_view`. It can be queried for approximate percentiles with
+ * `cudf::percentile_approx` and combined with digests built from other batches
+ * using `cudf::tdigest::merge_tdigests`, so a distribution can be maintained
+ * incrementally without keeping or sorting the original values.
+ *
+ * `max_centroids` places an upper bound on the size of the digest. A larger
+ * value yields a larger but more accurate digest.
+ *
+ * @throws cudf::logic_error if `input` is not a numeric or fixed-point column
+ *
+ * @param input Column of values to summarize
+ * @param max_centroids Parameter controlling compression level and accuracy
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A one-row tdigest column summarizing `input`
+ */
+std::unique_ptr<column> create_tdigest(
+  column_view const& input,
+  int max_centroids                   = 1000,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Merge all rows of a tdigest column into a single digest
+ *
+ * Combines digests produced by `create_tdigest` (or by the groupby `TDIGEST`
+ * aggregation) over separate batches into one digest equivalent to summarizing
+ * the concatenation of the batches.
+ *
+ * @throws cudf::logic_error if `input` is not a valid tdigest column
+ *
+ * @param input tdigest column whose rows are merged
+ * @param max_centroids Parameter controlling compression level and accuracy
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A one-row tdigest column merging all rows of `input`
+ */
+std::unique_ptr<column> merge_tdigests(
+  tdigest_column_view const& input,
+  int max_centroids                   = 1000,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace tdigest
+}  // namespace cudf
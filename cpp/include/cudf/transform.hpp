@@ -20,6 +20,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -54,6 +55,38 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Creates new columns by applying a transform function against every
+ * row of the input columns in a single pass.
+ *
+ * Computes:
+ * `F(&out0[i], ..., &outM[i], in0[i], ..., inN[i])` for every row `i`
+ *
+ * The UDF is called with a pointer into each output column followed by the
+ * value of each input column, so one jitted kernel can produce several output
+ * columns without materializing intermediate results. An output row is null
+ * if the corresponding row of any input column is null.
+ *
+ * PTX UDFs return a single value and are therefore limited to one output column.
+ *
+ * @throws cudf::logic_error if any input or output type is not fixed-width
+ * @throws cudf::logic_error if `is_ptx` is true and more than one output type is requested
+ *
+ * @param inputs        An immutable view of the input columns to transform
+ * @param transform_udf The PTX/CUDA string of the transform function to apply
+ * @param output_types  The output types that are compatible with the output types in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param mr            Device memory resource used to allocate the returned columns' device memory
+ * @return              The columns resulting from applying the transform function to
+ *                      every row of the input columns
+ */
+std::vector<std::unique_ptr<column>> transform(
+  table_view const& inputs,
+  std::string const& transform_udf,
+  std::vector<data_type> const& output_types,
+  bool is_ptx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 std::unique_ptr<column> generalized_masked_op(
   table_view const& data_view,
   std::string const& binary_udf,
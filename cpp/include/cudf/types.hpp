@@ -61,6 +61,7 @@ namespace cudf {
 class column;
 class column_view;
 class mutable_column_view;
+class packed_bools;
 class string_view;
 class list_view;
 class struct_view;
@@ -236,6 +237,7 @@ enum class type_id : int32_t {
   LIST,                    ///< List elements
   DECIMAL32,               ///< Fixed-point type with int32_t
   DECIMAL64,               ///< Fixed-point type with int64_t
+  DECIMAL128,              ///< Fixed-point type with __int128_t
   STRUCT,                  ///< Struct elements
   // `NUM_TYPE_IDS` must be last!
   NUM_TYPE_IDS  ///< Total number of type ids
@@ -271,7 +273,7 @@ class data_type {
    */
   explicit data_type(type_id id, int32_t scale) : _id{id}, _fixed_point_scale{scale}
   {
-    assert(id == type_id::DECIMAL32 || id == type_id::DECIMAL64);
+    assert(id == type_id::DECIMAL32 || id == type_id::DECIMAL64 || id == type_id::DECIMAL128);
   }
 
   /**
@@ -343,7 +345,8 @@ enum class hash_id {
   HASH_MURMUR3,         ///< Murmur3 hash function
   HASH_MD5,             ///< MD5 hash function
   HASH_SERIAL_MURMUR3,  ///< Serial Murmur3 hash function
-  HASH_SPARK_MURMUR3    ///< Spark Murmur3 hash function
+  HASH_SPARK_MURMUR3,   ///< Spark Murmur3 hash function
+  HASH_XXHASH64         ///< XXHash_64 hash function
 };
 
 /**
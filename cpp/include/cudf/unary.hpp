@@ -18,6 +18,7 @@
 
 #include <cudf/types.hpp>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -68,6 +69,31 @@ std::unique_ptr<cudf::column> unary_operation(
   cudf::unary_operator op,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Performs a chain of unary math ops on all values in a column in a single pass
+ *
+ * The ops are applied to each element in order, so `{ABS, LOG}` computes `log(abs(x))`.
+ * This is equivalent to calling `unary_operation` once per op but fuses the whole
+ * chain into one kernel so the column is read and written only once regardless of
+ * the chain length.
+ *
+ * Only the floating-point math ops (`SIN` through `RINT`) are supported and the
+ * input must be a floating-point column.
+ *
+ * @throws cudf::logic_error if `ops` is empty or contains a non-math op
+ * @throws cudf::logic_error if `input` is not a floating-point column
+ *
+ * @param input A `column_view` as input
+ * @param ops Operations to perform on each element, applied in order
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns Column of same size as `input` containing result of the operations
+ */
+std::unique_ptr<cudf::column> unary_chain(
+  cudf::column_view const& input,
+  std::vector<cudf::unary_operator> const& ops,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements where for every element in `input` `true`
  * indicates the value is null and `false` indicates the value is valid.
@@ -101,6 +127,11 @@ std::unique_ptr<cudf::column> is_valid(
  *
  * Supports only fixed-width types.
  *
+ * When the source and target types have identical bit layouts (e.g. INT64 to
+ * TIMESTAMP_SECONDS, or INT32 to DECIMAL32), `cudf::bit_cast()` produces the
+ * same result as a zero-copy `column_view` instead of materializing a new
+ * column; see `cudf::is_bit_castable()`.
+ *
  * @param input Input column
  * @param out_type Desired datatype of output column
  * @param mr Device memory resource used to allocate the returned column's device memory
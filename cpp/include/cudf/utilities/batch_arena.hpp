@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace cudf {
+
+/**
+ * @brief A scope during which intermediate allocations are drawn from a stack-style arena.
+ *
+ * Operator chains allocate and free many short-lived `rmm::device_buffer`s per
+ * batch; even with a pool resource the per-allocation bookkeeping adds up. While
+ * a `batch_arena` is alive it installs itself as the current device resource, so
+ * any allocation that does not name an explicit resource — in particular the
+ * intermediates produced inside detail functions — is served by bumping a
+ * pointer within blocks reserved from the previous resource. Individual
+ * deallocations are no-ops; all arena memory is released wholesale when the
+ * scope ends:
+ *
+ * @code{.cpp}
+ * {
+ *   cudf::batch_arena arena(16 << 20, stream);
+ *   auto tmp = cudf::binary_operation(a, b, op, type);       // arena memory
+ *   result   = cudf::reduce(tmp->view(), agg, dtype,
+ *                           arena.upstream());               // outlives scope
+ * }  // all intermediate memory released at once
+ * @endcode
+ *
+ * Allocations that must outlive the scope (the batch's results) must be made
+ * with `upstream()` — arena-backed memory dangles once the scope ends. Scopes
+ * must be strictly nested and used from a single thread, since the arena swaps
+ * the process-wide current device resource. Work drawing from the arena should
+ * be issued on the arena's stream (or synchronized with it) before the scope
+ * ends, as the blocks are returned to the upstream resource in stream order on
+ * that stream.
+ */
+class batch_arena {
+ public:
+  static constexpr std::size_t default_initial_size{1 << 23};  ///< Initial reservation in bytes.
+
+  /**
+   * @brief Construct an arena scope and install it as the current device resource.
+   *
+   * @throw cudf::logic_error if `initial_size` is zero
+   *
+   * @param initial_size Size in bytes of the first block reserved from the upstream resource;
+   *                     further blocks of geometrically increasing size are reserved on demand
+   * @param stream Stream on which blocks are reserved and released
+   */
+  explicit batch_arena(std::size_t initial_size     = default_initial_size,
+                       rmm::cuda_stream_view stream = rmm::cuda_stream_view{});
+
+  batch_arena(batch_arena const&) = delete;
+  batch_arena& operator=(batch_arena const&) = delete;
+
+  /**
+   * @brief Restores the previous device resource and releases all arena memory wholesale.
+   */
+  ~batch_arena();
+
+  /**
+   * @brief Returns the resource that was current when this scope was entered.
+   *
+   * Use this for allocations that must outlive the arena scope.
+   */
+  rmm::mr::device_memory_resource* upstream() const { return _previous; }
+
+  /**
+   * @brief Returns the number of bytes handed out by the arena so far.
+   */
+  std::size_t allocated_bytes() const;
+
+  /**
+   * @brief Returns the number of bytes reserved from the upstream resource so far.
+   */
+  std::size_t reserved_bytes() const;
+
+ private:
+  std::unique_ptr<rmm::mr::device_memory_resource> _resource;
+  rmm::mr::device_memory_resource* _previous;
+};
+
+}  // namespace cudf
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+namespace cudf {
+
+/**
+ * @brief Captures a fixed sequence of device work into a replayable CUDA graph.
+ *
+ * Pipelines that run an identical sequence of kernels on same-shaped batches
+ * pay per-kernel launch overhead on every batch. Capturing the sequence once
+ * and replaying the instantiated graph reduces the whole pipeline to a single
+ * launch:
+ *
+ * @code{.cpp}
+ * cudf::cuda_graph graph;
+ * graph.begin_capture(stream);
+ * run_pipeline(batch, stream);  // capture-safe work only
+ * graph.end_capture(stream);
+ * for (auto& next_batch : batches) {
+ *   update_inputs(next_batch);  // write into the captured buffers
+ *   graph.launch(stream);
+ * }
+ * @endcode
+ *
+ * Work is capture-safe only if it enqueues no host-visible reads and performs
+ * no synchronous allocations on the captured stream. In libcudf terms:
+ *
+ * - all output and temporary memory must come from a stream-ordered or
+ *   pre-allocated resource (e.g. an arena or pool memory resource); the
+ *   default cudaMalloc-backed resource is not capturable,
+ * - operations that read sizes or null counts back to the host cannot be
+ *   captured. Compiled binary ops on pre-allocated outputs, gather with a
+ *   `prepared_gather_map` (no per-call bounds reduction), and fixed-width
+ *   transforms are capture-safe; strings column construction is not, since
+ *   sizing the chars child requires a host readback,
+ * - the replay reuses the captured buffer addresses, so inputs must be
+ *   updated in place between launches.
+ *
+ * The class is movable but not copyable; destroying it releases the captured
+ * and instantiated graphs.
+ */
+class cuda_graph {
+ public:
+  cuda_graph() = default;
+  ~cuda_graph();
+
+  cuda_graph(cuda_graph const&) = delete;
+  cuda_graph& operator=(cuda_graph const&) = delete;
+  cuda_graph(cuda_graph&& other) noexcept;
+  cuda_graph& operator=(cuda_graph&& other) noexcept;
+
+  /**
+   * @brief Begins capturing work submitted to `stream`.
+   *
+   * Capture uses thread-local mode so unrelated streams in other threads are
+   * unaffected.
+   *
+   * @throw cudf::cuda_error if the stream is already capturing
+   *
+   * @param stream The stream whose subsequent work is captured
+   */
+  void begin_capture(rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Ends the capture on `stream` and instantiates the executable graph.
+   *
+   * Any previously instantiated graph held by this object is released.
+   *
+   * @throw cudf::cuda_error if capture was invalidated (e.g. by a
+   * synchronization or non-stream-ordered allocation during capture)
+   *
+   * @param stream The stream passed to `begin_capture`
+   */
+  void end_capture(rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Launches the instantiated graph on `stream`.
+   *
+   * @throw cudf::logic_error if no capture has been completed
+   *
+   * @param stream The stream to replay the captured work on
+   */
+  void launch(rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Returns true if a capture has been completed and the graph can be launched.
+   */
+  bool is_instantiated() const noexcept { return _exec != nullptr; }
+
+  /**
+   * @brief Returns true if `stream` is currently capturing.
+   *
+   * Detail code can consult this to reject operations that would invalidate
+   * an ongoing capture instead of failing with an opaque CUDA error.
+   *
+   * @param stream The stream to query
+   */
+  static bool is_capturing(rmm::cuda_stream_view stream);
+
+ private:
+  void destroy() noexcept;
+
+  cudaGraph_t _graph{nullptr};
+  cudaGraphExec_t _exec{nullptr};
+};
+
+}  // namespace cudf
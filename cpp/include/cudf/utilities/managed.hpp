@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <memory>
+
+namespace cudf {
+
+/**
+ * @brief Returns a process-lifetime memory resource backed by CUDA managed (unified) memory.
+ *
+ * Columns allocated from this resource are addressable from both host and
+ * device and are paged onto the GPU on demand, so tables far larger than
+ * device memory stay usable without manual spill code. Access from a kernel
+ * without a prior prefetch pages on fault; call `cudf::prefetch()` before an
+ * operation to overlap the migration with other work instead.
+ *
+ * @return Pointer to a `rmm::mr::managed_memory_resource` singleton
+ */
+rmm::mr::device_memory_resource* managed_memory_resource();
+
+/**
+ * @brief Deep copies a column into CUDA managed memory.
+ *
+ * The returned column is an ordinary `cudf::column` whose device buffers were
+ * allocated from `managed_memory_resource()`; every libcudf API accepts it
+ * unchanged. Intended for occasionally-accessed data that should be evictable
+ * to host memory under GPU memory pressure.
+ *
+ * @param input Column to copy
+ * @return Column with contents of `input` backed by managed memory
+ */
+std::unique_ptr<column> make_managed_column(column_view const& input);
+
+/**
+ * @brief Deep copies a table into CUDA managed memory.
+ *
+ * @copydetails make_managed_column
+ *
+ * @param input Table to copy
+ * @return Table with contents of `input` backed by managed memory
+ */
+std::unique_ptr<table> make_managed_table(table_view const& input);
+
+/**
+ * @brief Prefetches a column's buffers to the current device.
+ *
+ * Issues `cudaMemPrefetchAsync` for the data, null mask, and (recursively)
+ * child buffers of `input` that reside in managed memory, so a subsequent
+ * kernel reads resident pages instead of faulting them in one at a time.
+ * Buffers in ordinary device memory are ignored, making this safe to call
+ * unconditionally. Operator entry points that read whole columns (gather,
+ * stream compaction) already prefetch their inputs; call this directly ahead
+ * of custom kernels.
+ *
+ * @param input Column whose managed buffers are prefetched
+ */
+void prefetch(column_view const& input);
+
+/**
+ * @brief Prefetches every column of a table to the current device.
+ *
+ * @copydetails prefetch(column_view const&)
+ *
+ * @param input Table whose managed buffers are prefetched
+ */
+void prefetch(table_view const& input);
+
+}  // namespace cudf
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @brief A fixed-size pool of CUDA streams for running independent work concurrently.
+ *
+ * Public libcudf APIs accept a `rmm::cuda_stream_view` parameter, but callers
+ * that issue every operation on the same stream serialize otherwise independent
+ * pipelines on one GPU. This pool owns a set of non-default streams and hands
+ * them out round-robin so separate operator pipelines can overlap:
+ *
+ * @code{.cpp}
+ * cudf::stream_pool pool(4);
+ * auto result1 = cudf::binary_operation(a, b, op, type, pool.get_stream());
+ * auto result2 = cudf::binary_operation(c, d, op, type, pool.get_stream());
+ * pool.synchronize();  // wait for both pipelines before using the results
+ * @endcode
+ *
+ * `get_stream()` is thread-safe; the returned views remain valid for the
+ * lifetime of the pool. Work submitted on different streams of the pool is
+ * unordered with respect to each other — callers are responsible for any
+ * required synchronization between pipelines that share data.
+ */
+class stream_pool {
+ public:
+  static constexpr std::size_t default_size{16};  ///< Default number of streams in the pool.
+
+  /**
+   * @brief Construct a new pool of CUDA streams.
+   *
+   * @throw cudf::logic_error if `pool_size` is zero
+   *
+   * @param pool_size The number of streams to create
+   */
+  explicit stream_pool(std::size_t pool_size = default_size);
+
+  stream_pool(stream_pool const&) = delete;
+  stream_pool& operator=(stream_pool const&) = delete;
+
+  /**
+   * @brief Returns a stream from the pool.
+   *
+   * Streams are handed out round-robin and may be returned more than once;
+   * two calls are only guaranteed distinct streams if fewer than `size()`
+   * streams have been handed out in between. This function is thread-safe.
+   *
+   * @return View of a stream owned by this pool
+   */
+  rmm::cuda_stream_view get_stream();
+
+  /**
+   * @brief Returns the number of streams in the pool.
+   */
+  std::size_t size() const { return _streams.size(); }
+
+  /**
+   * @brief Synchronizes the host with every stream in the pool.
+   */
+  void synchronize();
+
+ private:
+  std::vector<rmm::cuda_stream> _streams;
+  std::atomic_size_t _next{0};
+};
+
+}  // namespace cudf
@@ -85,8 +85,9 @@ using id_to_type = typename id_to_type_impl<Id>::type;
 /**
  * @brief "Returns" the corresponding type that is stored on the device when using `cudf::column`
  *
- * For `decimal32`, the storage type is an `int32_t`.
- * For `decimal64`, the storage type is an `int64_t`.
+ * For `decimal32`,  the storage type is an `int32_t`.
+ * For `decimal64`,  the storage type is an `int64_t`.
+ * For `decimal128`, the storage type is an `__int128_t`.
  *
  * Use this "type function" with the `using` type alias:
  * @code
@@ -99,7 +100,8 @@ using id_to_type = typename id_to_type_impl<Id>::type;
 template <typename T>
 using device_storage_type_t =
   std::conditional_t<std::is_same_v<numeric::decimal32, T>, int32_t,
-  std::conditional_t<std::is_same_v<numeric::decimal64, T>, int64_t, T>>;
+  std::conditional_t<std::is_same_v<numeric::decimal64, T>, int64_t,
+  std::conditional_t<std::is_same_v<numeric::decimal128, T>, __int128_t, T>>>;
 // clang-format on
 
 /**
@@ -130,7 +132,8 @@ template <typename T>
 bool type_id_matches_device_storage_type(type_id id)
 {
   return (id == type_id::DECIMAL32 && std::is_same_v<T, int32_t>) ||
-         (id == type_id::DECIMAL64 && std::is_same_v<T, int64_t>) || id == type_to_id<T>();
+         (id == type_id::DECIMAL64 && std::is_same_v<T, int64_t>) ||
+         (id == type_id::DECIMAL128 && std::is_same_v<T, __int128_t>) || id == type_to_id<T>();
 }
 
 /**
@@ -188,6 +191,7 @@ CUDF_TYPE_MAPPING(dictionary32, type_id::DICTIONARY32);
 CUDF_TYPE_MAPPING(cudf::list_view, type_id::LIST);
 CUDF_TYPE_MAPPING(numeric::decimal32, type_id::DECIMAL32);
 CUDF_TYPE_MAPPING(numeric::decimal64, type_id::DECIMAL64);
+CUDF_TYPE_MAPPING(numeric::decimal128, type_id::DECIMAL128);
 CUDF_TYPE_MAPPING(cudf::struct_view, type_id::STRUCT);
 
 /**
@@ -221,6 +225,7 @@ MAP_NUMERIC_SCALAR(int8_t)
 MAP_NUMERIC_SCALAR(int16_t)
 MAP_NUMERIC_SCALAR(int32_t)
 MAP_NUMERIC_SCALAR(int64_t)
+MAP_NUMERIC_SCALAR(__int128_t)
 MAP_NUMERIC_SCALAR(uint8_t)
 MAP_NUMERIC_SCALAR(uint16_t)
 MAP_NUMERIC_SCALAR(uint32_t)
@@ -253,6 +258,12 @@ struct type_to_scalar_type_impl<numeric::decimal64> {
   using ScalarDeviceType = cudf::fixed_point_scalar_device_view<numeric::decimal64>;
 };
 
+template <>
+struct type_to_scalar_type_impl<numeric::decimal128> {
+  using ScalarType       = cudf::fixed_point_scalar<numeric::decimal128>;
+  using ScalarDeviceType = cudf::fixed_point_scalar_device_view<numeric::decimal128>;
+};
+
 template <>  // TODO: this is a temporary solution for make_pair_iterator
 struct type_to_scalar_type_impl<cudf::dictionary32> {
   using ScalarType       = cudf::numeric_scalar<int32_t>;
@@ -492,6 +503,9 @@ CUDF_HDFI constexpr decltype(auto) type_dispatcher(cudf::data_type dtype, Functo
     case type_id::DECIMAL64:
       return f.template operator()<typename IdTypeMap<type_id::DECIMAL64>::type>(
         std::forward<Ts>(args)...);
+    case type_id::DECIMAL128:
+      return f.template operator()<typename IdTypeMap<type_id::DECIMAL128>::type>(
+        std::forward<Ts>(args)...);
     case type_id::STRUCT:
       return f.template operator()<typename IdTypeMap<type_id::STRUCT>::type>(
         std::forward<Ts>(args)...);
@@ -514,6 +528,118 @@ CUDF_HDFI constexpr decltype(auto) type_dispatcher(cudf::data_type dtype, Functo
   }
 }
 
+/**
+ * @brief A compile-time list of `type_id`s for use with `list_type_dispatcher`.
+ *
+ * @tparam Ids The `type_id`s a call site supports
+ */
+template <cudf::type_id... Ids>
+struct dispatch_list {
+};
+
+/// Dispatch list covering all numeric types (integral, floating point, and bool)
+using numeric_dispatch_list = dispatch_list<type_id::BOOL8,
+                                            type_id::INT8,
+                                            type_id::INT16,
+                                            type_id::INT32,
+                                            type_id::INT64,
+                                            type_id::UINT8,
+                                            type_id::UINT16,
+                                            type_id::UINT32,
+                                            type_id::UINT64,
+                                            type_id::FLOAT32,
+                                            type_id::FLOAT64>;
+
+/// Dispatch list covering the integral types (including bool)
+using integral_dispatch_list = dispatch_list<type_id::BOOL8,
+                                             type_id::INT8,
+                                             type_id::INT16,
+                                             type_id::INT32,
+                                             type_id::INT64,
+                                             type_id::UINT8,
+                                             type_id::UINT16,
+                                             type_id::UINT32,
+                                             type_id::UINT64>;
+
+/// Dispatch list covering the floating-point types
+using floating_point_dispatch_list = dispatch_list<type_id::FLOAT32, type_id::FLOAT64>;
+
+/// Dispatch list covering the timestamp types
+using timestamp_dispatch_list = dispatch_list<type_id::TIMESTAMP_DAYS,
+                                              type_id::TIMESTAMP_SECONDS,
+                                              type_id::TIMESTAMP_MILLISECONDS,
+                                              type_id::TIMESTAMP_MICROSECONDS,
+                                              type_id::TIMESTAMP_NANOSECONDS>;
+
+/// Dispatch list covering the duration types
+using duration_dispatch_list = dispatch_list<type_id::DURATION_DAYS,
+                                             type_id::DURATION_SECONDS,
+                                             type_id::DURATION_MILLISECONDS,
+                                             type_id::DURATION_MICROSECONDS,
+                                             type_id::DURATION_NANOSECONDS>;
+
+namespace detail {
+template <cudf::type_id Id, cudf::type_id... Rest>
+struct list_dispatch_fn {
+  template <typename Functor, typename... Ts>
+  static constexpr decltype(auto) invoke(cudf::data_type dtype, Functor f, Ts&&... args)
+  {
+    if (dtype.id() == Id) {
+      return f.template operator()<id_to_type<Id>>(std::forward<Ts>(args)...);
+    }
+    if constexpr (sizeof...(Rest) > 0) {
+      return list_dispatch_fn<Rest...>::invoke(dtype, f, std::forward<Ts>(args)...);
+    } else {
+      CUDF_FAIL("Invalid type_id for this dispatch list.");
+    }
+  }
+};
+
+template <typename DispatchList>
+struct list_type_dispatcher_impl;
+
+template <cudf::type_id... Ids>
+struct list_type_dispatcher_impl<dispatch_list<Ids...>> {
+  static_assert(sizeof...(Ids) > 0, "A dispatch list must contain at least one type_id.");
+  template <typename Functor, typename... Ts>
+  static constexpr decltype(auto) invoke(cudf::data_type dtype, Functor f, Ts&&... args)
+  {
+    return list_dispatch_fn<Ids...>::invoke(dtype, f, std::forward<Ts>(args)...);
+  }
+};
+}  // namespace detail
+
+/**
+ * @brief Invokes an `operator()` template, like `type_dispatcher`, but only
+ * instantiates it for the types in an explicit `dispatch_list`.
+ *
+ * `type_dispatcher` instantiates the functor for every `type_id`, even at call
+ * sites that can only ever see a few types. When the supported set is known at
+ * the call site, dispatching over a list instead avoids generating code (and
+ * kernels) for the types that would just `CUDF_FAIL` anyway, which reduces
+ * binary size and compile time:
+ *
+ * @code
+ * // instantiates the functor for float and double only
+ * cudf::list_type_dispatcher<cudf::floating_point_dispatch_list>(t, functor{});
+ * @endcode
+ *
+ * A `data_type` whose `id()` is not in the list throws `cudf::logic_error`.
+ * Unlike `type_dispatcher`, this dispatcher is host-only.
+ *
+ * @tparam DispatchList A `dispatch_list` of the supported `type_id`s
+ * @param dtype The `cudf::data_type` whose `id()` selects the instantiation
+ * @param f The callable whose `operator()` template is invoked
+ * @param args Parameter pack of arguments forwarded to the `operator()` invocation
+ * @return Whatever is returned by the callable's `operator()`
+ */
+template <typename DispatchList, typename Functor, typename... Ts>
+constexpr decltype(auto) list_type_dispatcher(cudf::data_type dtype, Functor f, Ts&&... args)
+{
+  return detail::list_type_dispatcher_impl<DispatchList>::invoke(
+    dtype, f, std::forward<Ts>(args)...);
+}
+
 namespace detail {
 template <typename T1>
 struct double_type_dispatcher_second_type {
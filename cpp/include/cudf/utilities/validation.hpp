@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cudf {
+/**
+ * @addtogroup utility_error
+ * @{
+ * @file
+ * @brief Runtime control over input validation cost
+ */
+
+/**
+ * @brief Controls how much input validation libcudf performs.
+ *
+ * Some precondition checks are more than a host-side comparison: verifying
+ * that an offsets child has no nulls, for example, may launch a bit-counting
+ * kernel and synchronize when the null count has not been computed yet. For
+ * pipelines that construct columns from already-validated data these checks
+ * are pure overhead.
+ */
+enum class validation_level : int32_t {
+  FULL,    ///< Validate all invariants, including checks that may touch device memory
+  MINIMAL  ///< Skip checks that launch kernels or synchronize; inputs are trusted
+};
+
+/**
+ * @brief Returns the calling thread's current validation level.
+ *
+ * The level defaults to `validation_level::FULL`.
+ */
+validation_level get_validation_level();
+
+/**
+ * @brief Sets the calling thread's validation level.
+ *
+ * The level is thread-local so one thread trusting its inputs does not
+ * disable checks for concurrent callers. Prefer `validation_scope` over
+ * calling this directly.
+ *
+ * @param level The level to set
+ */
+void set_validation_level(validation_level level);
+
+/**
+ * @brief Returns true if device-touching validation checks should run.
+ */
+bool full_validation_enabled();
+
+/**
+ * @brief Sets the validation level for the lifetime of the scope.
+ *
+ * @code
+ * {
+ *   cudf::validation_scope trusted{cudf::validation_level::MINIMAL};
+ *   auto column = cudf::make_strings_column(...);  // skips device-side checks
+ * }
+ * // full validation is restored here
+ * @endcode
+ */
+class validation_scope {
+ public:
+  explicit validation_scope(validation_level level) : _previous{get_validation_level()}
+  {
+    set_validation_level(level);
+  }
+  ~validation_scope() { set_validation_level(_previous); }
+
+  validation_scope(validation_scope const&) = delete;
+  validation_scope& operator=(validation_scope const&) = delete;
+
+ private:
+  validation_level _previous;
+};
+
+/** @} */  // end of group
+
+}  // namespace cudf
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup column_search
+ * @{
+ * @file
+ * @brief Zone-map index over resident columns for chunk-level predicate pruning
+ */
+
+/**
+ * @brief Per-chunk min/max/null-count statistics over a column.
+ *
+ * A zone map divides a column into fixed-size row chunks and records the
+ * minimum, maximum, and null count of each chunk, mirroring the statistics
+ * that file readers use for row-group pruning. Built once over a resident
+ * column, it lets repeated range filters skip whole chunks before any
+ * row-level predicate evaluation:
+ *
+ * @code
+ * auto zmap = cudf::zone_map(col);
+ * for (auto chunk : zmap.matching_chunks(lo, hi)) {
+ *   // row-level filter only over rows
+ *   // [chunk * zmap.chunk_rows(), (chunk + 1) * zmap.chunk_rows())
+ * }
+ * @endcode
+ *
+ * Chunk matching is conservative: a listed chunk may contain no matching
+ * rows, but an unlisted chunk is guaranteed to contain none. On data sorted
+ * by the indexed column the listed chunks form a tight contiguous range.
+ *
+ * The statistics hold a copy and remain valid independently of the input
+ * column's lifetime.
+ */
+class zone_map {
+ public:
+  static constexpr size_type default_chunk_rows = 65536;  ///< Default rows per chunk
+
+  /**
+   * @brief Builds the per-chunk statistics for a column.
+   *
+   * @throws cudf::logic_error if `input` is not of a fixed-width, relationally
+   * comparable type
+   * @throws cudf::logic_error if `chunk_rows` is not positive
+   *
+   * @param input The column to index
+   * @param chunk_rows Number of rows covered by each chunk
+   * @param mr Device memory resource used to allocate the statistics columns
+   */
+  explicit zone_map(column_view const& input,
+                    size_type chunk_rows                = default_chunk_rows,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the number of chunks covered by this zone map.
+   */
+  size_type num_chunks() const noexcept { return _minimums->size(); }
+
+  /**
+   * @brief Returns the number of rows covered by each chunk (the last chunk may be smaller).
+   */
+  size_type chunk_rows() const noexcept { return _chunk_rows; }
+
+  /**
+   * @brief Returns the number of rows in the indexed column.
+   */
+  size_type num_rows() const noexcept { return _num_rows; }
+
+  /**
+   * @brief Returns the per-chunk minimum values.
+   *
+   * Chunks containing only nulls hold a sentinel greater than any real value.
+   */
+  column_view minimums() const noexcept { return _minimums->view(); }
+
+  /**
+   * @brief Returns the per-chunk maximum values.
+   *
+   * Chunks containing only nulls hold a sentinel less than any real value.
+   */
+  column_view maximums() const noexcept { return _maximums->view(); }
+
+  /**
+   * @brief Returns the per-chunk null counts.
+   */
+  std::vector<size_type> const& null_counts() const noexcept { return _null_counts; }
+
+  /**
+   * @brief Returns the chunks that may contain rows with values in `[lo, hi]`.
+   *
+   * Chunks whose recorded range does not intersect `[lo, hi]` are omitted;
+   * null rows never match a range predicate.
+   *
+   * @throws cudf::logic_error if the scalar types do not match the indexed column
+   *
+   * @param lo Inclusive lower bound of the predicate range
+   * @param hi Inclusive upper bound of the predicate range
+   * @return Ascending indices of the chunks that may contain matching rows
+   */
+  std::vector<size_type> matching_chunks(scalar const& lo, scalar const& hi) const;
+
+ private:
+  size_type _num_rows;
+  size_type _chunk_rows;
+  std::unique_ptr<column> _minimums;
+  std::unique_ptr<column> _maximums;
+  std::vector<size_type> _null_counts;
+};
+
+/** @} */  // end of group
+
+}  // namespace cudf
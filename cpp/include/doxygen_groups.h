@@ -80,6 +80,7 @@
  *   @defgroup column_merge Merging
  *   @defgroup column_join Joining
  *   @defgroup column_quantiles Quantiles
+ *   @defgroup estimation Cardinality Estimation
  *   @defgroup column_aggregation Aggregation
  *   @{
  *     @defgroup aggregation_factories Aggregation Factories
@@ -150,11 +151,13 @@
  *   @defgroup lists_gather Gathering
  *   @defgroup lists_elements Counting
  *   @defgroup lists_drop_duplicates Filtering
+ *   @defgroup lists_set_operations Set Operations
  *   @defgroup lists_sort Sorting
  * @}
  * @defgroup nvtext_apis NVText
  * @{
  *   @defgroup nvtext_ngrams NGrams
+ *   @defgroup nvtext_minhash MinHashing
  *   @defgroup nvtext_normalize Normalizing
  *   @defgroup nvtext_stemmer Stemming
  *   @defgroup nvtext_edit_distance Edit Distance
@@ -24,6 +24,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <memory>
+
 namespace nvtext {
 namespace detail {
 
@@ -45,5 +47,19 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Return the device-resident vocabulary for the given file, loading it on first use.
+ *
+ * The vocabulary tables are cached process-wide keyed by file path and shared
+ * across tokenize calls and host threads. Cached entries are allocated with the
+ * current device memory resource and live until process exit.
+ *
+ * @param filename_hashed_vocabulary A path to the preprocessed vocab.txt file.
+ * @param stream CUDA stream used for device memory operations if a load is required.
+ * @return shared vocabulary hash-table elements
+ */
+std::shared_ptr<hashed_vocabulary const> get_cached_vocabulary(
+  std::string const& filename_hashed_vocabulary, rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace nvtext
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the MinHash signature for each string.
+ *
+ * For each string, the character ngrams of width `ngrams` are hashed with
+ * MurmurHash3_32 using `num_hashes` different seeds and the minimum hash
+ * value for each seed is kept. The result for each string is a list of
+ * `num_hashes` UINT32 values. Hash `i` of a signature uses seed `i` so
+ * signatures from separate calls with the same parameters are comparable.
+ *
+ * The ngram generation, hashing, and min-reduction are fused into a single
+ * kernel; no intermediate ngram strings are materialized.
+ *
+ * Strings with fewer than `ngrams` characters (including empty strings) are
+ * hashed whole. A null input row produces a null row in the output.
+ *
+ * @throw cudf::logic_error if `ngrams < 2`
+ * @throw cudf::logic_error if `num_hashes < 1`
+ * @throw cudf::logic_error if the output size exceeds the column size limit
+ *
+ * @param strings Strings column to compute signatures for.
+ * @param ngrams The character ngram width used for hashing.
+ *               Default is 4 characters.
+ * @param num_hashes Number of hash values in each signature.
+ *                   Default is 32 hashes.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of UINT32 signature values, one list per input string.
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 4,
+  cudf::size_type num_hashes          = 32,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
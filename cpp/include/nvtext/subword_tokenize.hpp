@@ -22,6 +22,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <vector>
+
 namespace nvtext {
 
 /**
@@ -179,5 +181,53 @@ tokenizer_result subword_tokenize(
   uint32_t max_rows_tensor,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Tokenizes a batch of independent strings columns in a single pass.
+ *
+ * This is equivalent to calling subword_tokenize() on the concatenation of the
+ * input columns. The columns are combined on the device and run through the
+ * tokenizer kernels once, so many small columns (e.g. micro-batches from an
+ * inference service) incur the kernel launch sequence a single time rather
+ * than once per column.
+ *
+ * The output tensor rows for each input column appear in batch order. The
+ * row-id values in the `tensor_metadata` result refer to rows of the
+ * concatenated input: the rows for `batch[i]` begin at the sum of the sizes
+ * of the preceding columns.
+ *
+ * @throw cudf::logic_error if `batch` is empty
+ * @throw cudf::logic_error if `stride > max_sequence_length`
+ * @throw cudf::logic_error if `max_sequence_length * max_rows_tensor` is
+ *        larger than the max value for cudf::size_type
+ *
+ * @param batch The independent strings columns to tokenize together.
+ * @param vocabulary_table The vocabulary table pre-loaded into this object.
+ * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+ *        for each string.
+ * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+ *        the token-ids from the previous row, unless it is the first string.
+ * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+ *        input stream to lower-case and strip accents from those characters.
+ *        If false, accented and uppercase characters are not transformed.
+ * @param do_truncate If true, the tokenizer will discard all the token-ids after
+ *        `max_sequence_length` for each input string. If false, it will use a new row
+ *        in the output token-ids to continue generating the output.
+ * @param max_rows_tensor Maximum number of rows for the output token-ids expected
+ *        to be generated by the tokenizer for the entire batch.
+ *        Used for allocating temporary working memory on the GPU device.
+ *        If the output generates a larger number of rows, behavior is undefined.
+ * @param mr Memory resource to allocate any returned objects.
+ * @return token-ids, attention-mask, and metadata for the whole batch
+ */
+tokenizer_result subword_tokenize_batch(
+  std::vector<cudf::strings_column_view> const& batch,
+  hashed_vocabulary const& vocabulary_table,
+  uint32_t max_sequence_length,
+  uint32_t stride,
+  bool do_lower_case,
+  bool do_truncate,
+  uint32_t max_rows_tensor,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
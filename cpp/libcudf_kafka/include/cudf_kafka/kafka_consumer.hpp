@@ -22,6 +22,8 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
 
 namespace cudf {
 namespace io {
@@ -186,7 +188,9 @@ class kafka_consumer : public cudf::io::datasource {
   int default_timeout = 10000;  // milliseconds
   std::string delimiter;
 
-  std::string buffer;
+  // Messages are aggregated in page-locked memory so that the device transfer performed by the
+  // reader consuming this datasource can be done asynchronously and at full PCIe bandwidth
+  thrust::host_vector<char, thrust::system::cuda::experimental::pinned_allocator<char>> buffer;
 
  private:
   RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const& topic,
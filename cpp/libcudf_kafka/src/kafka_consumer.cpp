@@ -92,7 +92,7 @@ size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
 {
   if (offset > buffer.size()) { return 0; }
   auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  memcpy(dst, buffer.data() + offset, read_size);
   return read_size;
 }
 
@@ -116,19 +116,34 @@ void kafka_consumer::consume_to_buffer()
   int64_t messages_read = 0;
   auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
 
+  // Batch the polled messages and defer the payload copies until the total size is known, so
+  // the buffer is allocated exactly once instead of being grown message by message
+  std::vector<std::unique_ptr<RdKafka::Message>> messages;
+  size_t total_size = 0;
+
   while (messages_read < end_offset - start_offset && end > std::chrono::steady_clock::now()) {
     std::unique_ptr<RdKafka::Message> msg{
       consumer->consume((end - std::chrono::steady_clock::now()).count())};
 
     if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char*>(msg->payload()));
-      buffer.append(delimiter);
+      total_size += msg->len() + delimiter.size();
+      messages.push_back(std::move(msg));
       messages_read++;
     } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
       // If there are no more messages return
       break;
     }
   }
+
+  // Compact the batched payloads into the pinned buffer
+  buffer.resize(total_size);
+  size_t write_offset = 0;
+  for (auto const& msg : messages) {
+    memcpy(buffer.data() + write_offset, msg->payload(), msg->len());
+    write_offset += msg->len();
+    memcpy(buffer.data() + write_offset, delimiter.data(), delimiter.size());
+    write_offset += delimiter.size();
+  }
 }
 
 std::map<std::string, std::string> kafka_consumer::current_configs()
@@ -16,6 +16,7 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <memory>
@@ -136,6 +137,12 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, approx_nunique_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   data_type col_type, nth_element_aggregation const& agg)
 {
@@ -160,6 +167,12 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, percent_rank_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   data_type col_type, collect_list_aggregation const& agg)
 {
@@ -313,6 +326,11 @@ void aggregation_finalizer::visit(nunique_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(approx_nunique_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 void aggregation_finalizer::visit(nth_element_aggregation const& agg)
 {
   visit(static_cast<aggregation const&>(agg));
@@ -333,6 +351,11 @@ void aggregation_finalizer::visit(dense_rank_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(percent_rank_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 void aggregation_finalizer::visit(collect_list_aggregation const& agg)
 {
   visit(static_cast<aggregation const&>(agg));
@@ -576,6 +599,20 @@ template std::unique_ptr<aggregation> make_nunique_aggregation<aggregation>(
 template std::unique_ptr<groupby_aggregation> make_nunique_aggregation<groupby_aggregation>(
   null_policy null_handling);
 
+/// Factory to create an APPROX_NUNIQUE aggregation
+template <typename Base>
+std::unique_ptr<Base> make_approx_nunique_aggregation(null_policy null_handling,
+                                                      size_type precision)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 18,
+               "approx_nunique precision must be in [4, 18]");
+  return std::make_unique<detail::approx_nunique_aggregation>(null_handling, precision);
+}
+template std::unique_ptr<aggregation> make_approx_nunique_aggregation<aggregation>(
+  null_policy null_handling, size_type precision);
+template std::unique_ptr<groupby_aggregation> make_approx_nunique_aggregation<groupby_aggregation>(
+  null_policy null_handling, size_type precision);
+
 /// Factory to create an NTH_ELEMENT aggregation
 template <typename Base>
 std::unique_ptr<Base> make_nth_element_aggregation(size_type n, null_policy null_handling)
@@ -616,6 +653,16 @@ template std::unique_ptr<aggregation> make_dense_rank_aggregation<aggregation>()
 template std::unique_ptr<groupby_scan_aggregation>
 make_dense_rank_aggregation<groupby_scan_aggregation>();
 
+/// Factory to create a PERCENT_RANK aggregation
+template <typename Base>
+std::unique_ptr<Base> make_percent_rank_aggregation()
+{
+  return std::make_unique<detail::percent_rank_aggregation>();
+}
+template std::unique_ptr<aggregation> make_percent_rank_aggregation<aggregation>();
+template std::unique_ptr<groupby_scan_aggregation>
+make_percent_rank_aggregation<groupby_scan_aggregation>();
+
 /// Factory to create a COLLECT_LIST aggregation
 template <typename Base>
 std::unique_ptr<Base> make_collect_list_aggregation(null_policy null_handling)
@@ -680,6 +727,8 @@ template std::unique_ptr<aggregation> make_udf_aggregation<aggregation>(
   udf_type type, std::string const& user_defined_aggregator, data_type output_type);
 template std::unique_ptr<rolling_aggregation> make_udf_aggregation<rolling_aggregation>(
   udf_type type, std::string const& user_defined_aggregator, data_type output_type);
+template std::unique_ptr<groupby_aggregation> make_udf_aggregation<groupby_aggregation>(
+  udf_type type, std::string const& user_defined_aggregator, data_type output_type);
 
 /// Factory to create a MERGE_LISTS aggregation
 template <typename Base>
@@ -760,8 +809,9 @@ struct target_type_functor {
   constexpr data_type operator()() const noexcept
   {
     auto const id = type_to_id<target_type_t<Source, k>>();
-    return id == type_id::DECIMAL32 || id == type_id::DECIMAL64 ? data_type{id, type.scale()}
-                                                                : data_type{id};
+    return id == type_id::DECIMAL32 || id == type_id::DECIMAL64 || id == type_id::DECIMAL128
+             ? data_type{id, type.scale()}
+             : data_type{id};
   }
 };
 
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/ast/expression_builder.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace ast {
+
+expression const& expression_builder::column(cudf::size_type column_index)
+{
+  CUDF_EXPECTS(column_index >= 0 && column_index < _table.num_columns(),
+               "Column index is out of range for the builder's table.");
+  _nodes.push_back(std::make_unique<column_reference>(column_index));
+  return *_nodes.back();
+}
+
+expression const& expression_builder::make_operation(ast_operator op, expression const& input)
+{
+  _nodes.push_back(std::make_unique<operation>(op, input));
+  return *_nodes.back();
+}
+
+expression const& expression_builder::make_operation(ast_operator op,
+                                                     expression const& left,
+                                                     expression const& right)
+{
+  _nodes.push_back(std::make_unique<operation>(op, left, right));
+  return *_nodes.back();
+}
+
+std::unique_ptr<cudf::column> expression_builder::materialize(
+  expression const& root, rmm::mr::device_memory_resource* mr) const
+{
+  return cudf::compute_column(_table, root, mr);
+}
+
+}  // namespace ast
+}  // namespace cudf
@@ -43,6 +43,8 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <thrust/optional.h>
 
@@ -78,6 +80,24 @@ inline bool is_null_dependent(binary_operator op)
          op == binary_operator::NULL_MAX;
 }
 
+/**
+ * @brief Returns `true` if the operand contributes only nulls to the operation.
+ *
+ * When an operand is entirely null, a null-propagating operator nulls every output
+ * row and the output null mask already encodes that, so the value kernel need not
+ * be launched.
+ */
+inline bool is_all_null(column_view const& v, rmm::cuda_stream_view)
+{
+  return v.size() > 0 and v.null_count() == v.size();
+}
+
+/** @copydoc is_all_null(column_view const&, rmm::cuda_stream_view) */
+inline bool is_all_null(scalar const& s, rmm::cuda_stream_view stream)
+{
+  return not s.is_valid(stream);
+}
+
 /**
  * @brief Returns `true` if `binary_operator` `op` is a basic arithmetic binary operation
  */
@@ -298,6 +318,10 @@ std::unique_ptr<column> binary_operation(LhsType const& lhs,
   if constexpr (std::is_same_v<RhsType, column_view>)
     if (rhs.is_empty()) return out;
 
+  // every output row is already null; skip launching the value kernel
+  if (not is_null_dependent(op) and (is_all_null(lhs, stream) or is_all_null(rhs, stream)))
+    return out;
+
   auto out_view = out->mutable_view();
   cudf::binops::compiled::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
@@ -460,13 +484,19 @@ std::unique_ptr<column> fixed_point_binary_operation(scalar const& lhs,
         auto const scale  = scale_type{rhs.type().scale()};
         auto const scalar = make_fixed_point_scalar<decimal32>(val * factor, scale);
         binops::jit::binary_operation(out_view, *scalar, rhs, op, stream);
-      } else {
-        CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+      } else if (lhs.type().id() == type_id::DECIMAL64) {
         auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
         auto const val    = static_cast<fixed_point_scalar<decimal64> const&>(lhs).value(stream);
         auto const scale  = scale_type{rhs.type().scale()};
         auto const scalar = make_fixed_point_scalar<decimal64>(val * factor, scale);
         binops::jit::binary_operation(out_view, *scalar, rhs, op, stream);
+      } else {
+        CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+        auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+        auto const val    = static_cast<fixed_point_scalar<decimal128> const&>(lhs).value(stream);
+        auto const scale  = scale_type{rhs.type().scale()};
+        auto const scalar = make_fixed_point_scalar<decimal128>(val * factor, scale);
+        binops::jit::binary_operation(out_view, *scalar, rhs, op, stream);
       }
     } else {
       auto const diff   = rhs.type().scale() - lhs.type().scale();
@@ -475,11 +505,15 @@ std::unique_ptr<column> fixed_point_binary_operation(scalar const& lhs,
           auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+        } else if (lhs.type().id() == type_id::DECIMAL64) {
           auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
+        } else {
+          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+          auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+          auto const scalar = make_fixed_point_scalar<decimal128>(factor, scale_type{-diff});
+          return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
         }
       }();
       binops::jit::binary_operation(out_view, lhs, result->view(), op, stream);
@@ -530,13 +564,19 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
         auto const scale  = scale_type{lhs.type().scale()};
         auto const scalar = make_fixed_point_scalar<decimal32>(val * factor, scale);
         binops::jit::binary_operation(out_view, lhs, *scalar, op, stream);
-      } else {
-        CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+      } else if (rhs.type().id() == type_id::DECIMAL64) {
         auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
         auto const val    = static_cast<fixed_point_scalar<decimal64> const&>(rhs).value(stream);
         auto const scale  = scale_type{rhs.type().scale()};
         auto const scalar = make_fixed_point_scalar<decimal64>(val * factor, scale);
         binops::jit::binary_operation(out_view, lhs, *scalar, op, stream);
+      } else {
+        CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+        auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+        auto const val    = static_cast<fixed_point_scalar<decimal128> const&>(rhs).value(stream);
+        auto const scale  = scale_type{rhs.type().scale()};
+        auto const scalar = make_fixed_point_scalar<decimal128>(val * factor, scale);
+        binops::jit::binary_operation(out_view, lhs, *scalar, op, stream);
       }
     } else {
       auto const diff   = lhs.type().scale() - rhs.type().scale();
@@ -545,11 +585,15 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
           auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+        } else if (rhs.type().id() == type_id::DECIMAL64) {
           auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
+        } else {
+          CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+          auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+          auto const scalar = make_fixed_point_scalar<decimal128>(factor, scale_type{-diff});
+          return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
         }
       }();
       binops::jit::binary_operation(out_view, result->view(), rhs, op, stream);
@@ -598,11 +642,15 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
           auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+        } else if (lhs.type().id() == type_id::DECIMAL64) {
           auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
+        } else {
+          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+          auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+          auto const scalar = make_fixed_point_scalar<decimal128>(factor, scale_type{-diff});
+          return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
         }
       }();
       binops::jit::binary_operation(out_view, result->view(), rhs, op, stream);
@@ -613,11 +661,15 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
           auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+        } else if (lhs.type().id() == type_id::DECIMAL64) {
           auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
+        } else {
+          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+          auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+          auto const scalar = make_fixed_point_scalar<decimal128>(factor, scale_type{-diff});
+          return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
         }
       }();
       binops::jit::binary_operation(out_view, lhs, result->view(), op, stream);
@@ -651,6 +703,11 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
 
   if (rhs.is_empty()) return out;
 
+  // every output row is already null; skip launching the value kernel
+  if (not binops::is_null_dependent(op) and
+      (binops::is_all_null(lhs, stream) or binops::is_all_null(rhs, stream)))
+    return out;
+
   auto out_view = out->mutable_view();
   binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
@@ -679,6 +736,11 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 
   if (lhs.is_empty()) return out;
 
+  // every output row is already null; skip launching the value kernel
+  if (not binops::is_null_dependent(op) and
+      (binops::is_all_null(lhs, stream) or binops::is_all_null(rhs, stream)))
+    return out;
+
   auto out_view = out->mutable_view();
   binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
@@ -709,6 +771,11 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 
   if (lhs.is_empty() or rhs.is_empty()) return out;
 
+  // every output row is already null; skip launching the value kernel
+  if (not binops::is_null_dependent(op) and
+      (binops::is_all_null(lhs, stream) or binops::is_all_null(rhs, stream)))
+    return out;
+
   auto out_view = out->mutable_view();
   binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
@@ -746,6 +813,45 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   CUDF_FUNC_RANGE();
   return detail::jit::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
 }
+
+std::future<void> preload_binary_operation(data_type output_type,
+                                           data_type lhs_type,
+                                           data_type rhs_type,
+                                           std::vector<binary_operator> const& ops)
+{
+  auto const out_name = cudf::jit::get_type_name(output_type);
+  auto const lhs_name = cudf::jit::get_type_name(lhs_type);
+  auto const rhs_name = cudf::jit::get_type_name(rhs_type);
+
+  std::vector<std::string> kernel_names;
+  for (auto const op : ops) {
+    char const* kernel_v_v = binops::is_null_dependent(op)
+                               ? "cudf::binops::jit::kernel_v_v_with_validity"
+                               : "cudf::binops::jit::kernel_v_v";
+    char const* kernel_v_s = binops::is_null_dependent(op)
+                               ? "cudf::binops::jit::kernel_v_s_with_validity"
+                               : "cudf::binops::jit::kernel_v_s";
+
+    kernel_names.push_back(
+      jitify2::reflection::Template(kernel_v_v)  //
+        .instantiate(out_name,
+                     lhs_name,
+                     rhs_name,
+                     binops::jit::get_operator_name(op, binops::jit::OperatorType::Direct)));
+    // the scalar kernel is launched with the scalar as the right operand for
+    // both operand orders; the reversed order uses the reversed operator.
+    for (auto const op_type : {binops::jit::OperatorType::Direct,
+                               binops::jit::OperatorType::Reverse}) {
+      kernel_names.push_back(jitify2::reflection::Template(kernel_v_s)  //
+                               .instantiate(out_name,
+                                            lhs_name,
+                                            rhs_name,
+                                            binops::jit::get_operator_name(op, op_type)));
+    }
+  }
+
+  return cudf::jit::preload_kernels(*binaryop_jit_kernel_cu_jit, std::move(kernel_names));
+}
 }  // namespace jit
 
 namespace detail {
@@ -757,7 +863,7 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          rmm::mr::device_memory_resource* mr)
 {
   return binops::compiled::binary_operation<scalar, column_view>(
-    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+    lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          scalar const& rhs,
@@ -767,7 +873,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::mr::device_memory_resource* mr)
 {
   return binops::compiled::binary_operation<column_view, scalar>(
-    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+    lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
@@ -777,7 +883,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::mr::device_memory_resource* mr)
 {
   return binops::compiled::binary_operation<column_view, column_view>(
-    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+    lhs, rhs, op, output_type, stream, mr);
 }
 
 std::unique_ptr<column> binary_operation(column_view const& lhs,
@@ -806,6 +912,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   // Check for 0 sized data
   if (lhs.is_empty() or rhs.is_empty()) return out;
 
+  // every output row is already null, so the UDF's results would be unobservable
+  if (null_count == lhs.size()) return out;
+
   auto out_view = out->mutable_view();
   binops::jit::binary_operation(out_view, lhs, rhs, ptx, stream);
   return out;
@@ -837,38 +946,42 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          scalar const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
 }
 
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          std::string const& ptx,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, ptx, output_type, rmm::cuda_stream_default, mr);
+  return detail::binary_operation(lhs, rhs, ptx, output_type, stream, mr);
 }
 
 }  // namespace cudf
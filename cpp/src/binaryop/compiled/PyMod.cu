@@ -22,5 +22,6 @@ template void apply_binary_op<ops::PyMod>(mutable_column_device_view&,
                                           column_device_view const&,
                                           bool is_lhs_scalar,
                                           bool is_rhs_scalar,
+                                          bool has_nulls,
                                           rmm::cuda_stream_view);
 }
@@ -85,8 +85,9 @@ struct typed_casted_writer {
  * @brief Functor to launch only defined operations with common type.
  *
  * @tparam BinaryOperator binary operator functor
+ * @tparam has_nulls true if either operand may contain nulls
  */
-template <typename BinaryOperator>
+template <typename BinaryOperator, bool has_nulls>
 struct ops_wrapper {
   mutable_column_device_view& out;
   column_device_view const& lhs;
@@ -109,10 +110,10 @@ struct ops_wrapper {
           auto result       = BinaryOperator{}.template operator()<TypeCommon, TypeCommon>(
             x,
             y,
-            lhs.is_valid(is_lhs_scalar ? 0 : i),
-            rhs.is_valid(is_rhs_scalar ? 0 : i),
+            has_nulls ? lhs.is_valid(is_lhs_scalar ? 0 : i) : true,
+            has_nulls ? rhs.is_valid(is_rhs_scalar ? 0 : i) : true,
             output_valid);
-          if (out.nullable() && !output_valid) out.set_null(i);
+          if (has_nulls && out.nullable() && !output_valid) out.set_null(i);
           return result;
         } else {
           return BinaryOperator{}.template operator()<TypeCommon, TypeCommon>(x, y);
@@ -133,8 +134,9 @@ struct ops_wrapper {
  * @brief Functor to launch only defined operations without common type.
  *
  * @tparam BinaryOperator binary operator functor
+ * @tparam has_nulls true if either operand may contain nulls
  */
-template <typename BinaryOperator>
+template <typename BinaryOperator, bool has_nulls>
 struct ops2_wrapper {
   mutable_column_device_view& out;
   column_device_view const& lhs;
@@ -156,10 +158,10 @@ struct ops2_wrapper {
           auto result       = BinaryOperator{}.template operator()<TypeLhs, TypeRhs>(
             x,
             y,
-            lhs.is_valid(is_lhs_scalar ? 0 : i),
-            rhs.is_valid(is_rhs_scalar ? 0 : i),
+            has_nulls ? lhs.is_valid(is_lhs_scalar ? 0 : i) : true,
+            has_nulls ? rhs.is_valid(is_rhs_scalar ? 0 : i) : true,
             output_valid);
-          if (out.nullable() && !output_valid) out.set_null(i);
+          if (has_nulls && out.nullable() && !output_valid) out.set_null(i);
           return result;
         } else {
           return BinaryOperator{}.template operator()<TypeLhs, TypeRhs>(x, y);
@@ -183,8 +185,9 @@ struct ops2_wrapper {
  * double type dispatcher for lhs and rhs without common types.
  *
  * @tparam BinaryOperator binary operator functor
+ * @tparam has_nulls true if either operand may contain nulls
  */
-template <class BinaryOperator>
+template <class BinaryOperator, bool has_nulls>
 struct device_type_dispatcher {
   mutable_column_device_view out;
   column_device_view lhs;
@@ -196,14 +199,15 @@ struct device_type_dispatcher {
   __device__ void operator()(size_type i)
   {
     if (common_data_type) {
-      type_dispatcher(*common_data_type,
-                      ops_wrapper<BinaryOperator>{out, lhs, rhs, is_lhs_scalar, is_rhs_scalar},
-                      i);
+      type_dispatcher(
+        *common_data_type,
+        ops_wrapper<BinaryOperator, has_nulls>{out, lhs, rhs, is_lhs_scalar, is_rhs_scalar},
+        i);
     } else {
       double_type_dispatcher(
         lhs.type(),
         rhs.type(),
-        ops2_wrapper<BinaryOperator>{out, lhs, rhs, is_lhs_scalar, is_rhs_scalar},
+        ops2_wrapper<BinaryOperator, has_nulls>{out, lhs, rhs, is_lhs_scalar, is_rhs_scalar},
         i);
     }
   }
@@ -258,15 +262,22 @@ void apply_binary_op(mutable_column_device_view& outd,
                      column_device_view const& rhsd,
                      bool is_lhs_scalar,
                      bool is_rhs_scalar,
+                     bool has_nulls,
                      rmm::cuda_stream_view stream)
 {
   auto common_dtype = get_common_type(outd.type(), lhsd.type(), rhsd.type());
 
-  // Create binop functor instance
-  auto binop_func = device_type_dispatcher<BinaryOperator>{
-    outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype};
-  // Execute it on every element
-  for_each(stream, outd.size(), binop_func);
+  // Create binop functor instance and execute it on every element.
+  // The null-free instantiation performs no validity loads.
+  if (has_nulls) {
+    auto binop_func = device_type_dispatcher<BinaryOperator, true>{
+      outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype};
+    for_each(stream, outd.size(), binop_func);
+  } else {
+    auto binop_func = device_type_dispatcher<BinaryOperator, false>{
+      outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype};
+    for_each(stream, outd.size(), binop_func);
+  }
 }
 
 }  // namespace compiled
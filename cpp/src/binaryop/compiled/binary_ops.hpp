@@ -185,6 +185,7 @@ bool is_supported_operation(data_type out, data_type lhs, data_type rhs, binary_
  * @param rhsd device view of right operand column
  * @param is_lhs_scalar true if @p lhsd is a single element column representing a scalar
  * @param is_rhs_scalar true if @p rhsd is a single element column representing a scalar
+ * @param has_nulls true if either operand contains nulls; selects the null-aware instantiation
  * @param stream CUDA stream used for device memory operations
  */
 template <class BinaryOperator>
@@ -193,6 +194,7 @@ void apply_binary_op(mutable_column_device_view&,
                      column_device_view const&,
                      bool is_lhs_scalar,
                      bool is_rhs_scalar,
+                     bool has_nulls,
                      rmm::cuda_stream_view stream);
 /**
  * @brief Deploys single type or double type dispatcher that runs equality operation on each element
@@ -209,6 +211,7 @@ void apply_binary_op(mutable_column_device_view&,
  * @param is_lhs_scalar true if @p lhsd is a single element column representing a scalar
  * @param is_rhs_scalar true if @p rhsd is a single element column representing a scalar
  * @param op comparison binary operator
+ * @param has_nulls true if either operand contains nulls; selects the null-aware instantiation
  * @param stream CUDA stream used for device memory operations
  */
 void dispatch_equality_op(mutable_column_device_view& outd,
@@ -217,6 +220,7 @@ void dispatch_equality_op(mutable_column_device_view& outd,
                           bool is_lhs_scalar,
                           bool is_rhs_scalar,
                           binary_operator op,
+                          bool has_nulls,
                           rmm::cuda_stream_view stream);
 }  // namespace compiled
 }  // namespace binops
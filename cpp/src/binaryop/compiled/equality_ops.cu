@@ -17,16 +17,17 @@
 #include "binary_ops.cuh"
 
 namespace cudf::binops::compiled {
-void dispatch_equality_op(mutable_column_device_view& outd,
-                          column_device_view const& lhsd,
-                          column_device_view const& rhsd,
-                          bool is_lhs_scalar,
-                          bool is_rhs_scalar,
-                          binary_operator op,
-                          rmm::cuda_stream_view stream)
+namespace {
+template <bool has_nulls>
+void launch_equality_op(mutable_column_device_view& outd,
+                        column_device_view const& lhsd,
+                        column_device_view const& rhsd,
+                        bool is_lhs_scalar,
+                        bool is_rhs_scalar,
+                        binary_operator op,
+                        std::optional<data_type> common_dtype,
+                        rmm::cuda_stream_view stream)
 {
-  auto common_dtype = get_common_type(outd.type(), lhsd.type(), rhsd.type());
-
   // Execute it on every element
   for_each(
     stream,
@@ -35,12 +36,33 @@ void dispatch_equality_op(mutable_column_device_view& outd,
       // clang-format off
       // Similar enabled template types should go together (better performance)
       switch (op) {
-      case binary_operator::EQUAL:         device_type_dispatcher<ops::Equal>{outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype}(i); break;
-      case binary_operator::NOT_EQUAL:     device_type_dispatcher<ops::NotEqual>{outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype}(i); break;
-      case binary_operator::NULL_EQUALS:   device_type_dispatcher<ops::NullEquals>{outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype}(i); break;
+      case binary_operator::EQUAL:         device_type_dispatcher<ops::Equal, has_nulls>{outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype}(i); break;
+      case binary_operator::NOT_EQUAL:     device_type_dispatcher<ops::NotEqual, has_nulls>{outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype}(i); break;
+      case binary_operator::NULL_EQUALS:   device_type_dispatcher<ops::NullEquals, has_nulls>{outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype}(i); break;
       default:;
       }
       // clang-format on
     });
 }
+}  // namespace
+
+void dispatch_equality_op(mutable_column_device_view& outd,
+                          column_device_view const& lhsd,
+                          column_device_view const& rhsd,
+                          bool is_lhs_scalar,
+                          bool is_rhs_scalar,
+                          binary_operator op,
+                          bool has_nulls,
+                          rmm::cuda_stream_view stream)
+{
+  auto common_dtype = get_common_type(outd.type(), lhsd.type(), rhsd.type());
+
+  if (has_nulls) {
+    launch_equality_op<true>(
+      outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, op, common_dtype, stream);
+  } else {
+    launch_equality_op<false>(
+      outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, op, common_dtype, stream);
+  }
+}
 }  // namespace cudf::binops::compiled
@@ -437,6 +437,173 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
   return std::make_pair(std::move(null_mask), 0);
 }
 
+namespace {
+
+/**
+ * @brief Computes the number of set bits in one word slot of a batch of
+ * bitmask ranges laid out consecutively in a global slot space.
+ */
+struct batched_word_num_set_bits_functor {
+  device_span<bitmask_type const*> masks;
+  device_span<size_type const> slot_offsets;  ///< Prefix sum of the word count of each range
+  device_span<size_type const> first_bits;    ///< First bit index of each range
+  device_span<size_type const> last_bits;     ///< One past the last bit index of each range
+
+  __device__ size_type operator()(size_type slot) const
+  {
+    auto const range =
+      thrust::upper_bound(thrust::seq, slot_offsets.begin(), slot_offsets.end(), slot) -
+      slot_offsets.begin() - 1;
+    auto const first_word = word_index(first_bits[range]);
+    auto const word       = first_word + (slot - slot_offsets[range]);
+    bitmask_type bits     = masks[range][word];
+    if (word == first_word) {
+      bits &= ~set_least_significant_bits(intra_word_index(first_bits[range]));
+    }
+    auto const last_bit = last_bits[range] - 1;
+    if (word == word_index(last_bit)) {
+      auto const num_slack_bits = static_cast<size_type>(detail::size_in_bits<bitmask_type>()) -
+                                  intra_word_index(last_bit) - 1;
+      bits &= ~set_most_significant_bits(num_slack_bits);
+    }
+    return __popc(bits);
+  }
+};
+
+}  // namespace
+
+// Computes the null count of every column of the table in one batched launch
+std::vector<size_type> null_counts(table_view const& view, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<size_type> counts(view.num_columns(), 0);
+
+  std::vector<size_type> batched_indices;
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> slot_offsets{0};
+  std::vector<size_type> first_bits;
+  std::vector<size_type> last_bits;
+  for (size_type i = 0; i < view.num_columns(); ++i) {
+    auto const& col = view.column(i);
+    if (not col.nullable() or col.size() == 0) { continue; }
+    auto const first = col.offset();
+    auto const last  = col.offset() + col.size();
+    batched_indices.push_back(i);
+    masks.push_back(col.null_mask());
+    first_bits.push_back(first);
+    last_bits.push_back(last);
+    slot_offsets.push_back(slot_offsets.back() + word_index(last - 1) - word_index(first) + 1);
+  }
+  if (masks.empty()) { return counts; }
+
+  auto const num_ranges = static_cast<size_type>(masks.size());
+  auto d_masks          = make_device_uvector_async(masks, stream);
+  auto d_slot_offsets   = make_device_uvector_async(slot_offsets, stream);
+  auto d_first_bits     = make_device_uvector_async(first_bits, stream);
+  auto d_last_bits      = make_device_uvector_async(last_bits, stream);
+  rmm::device_uvector<size_type> d_set_counts(num_ranges, stream);
+
+  auto word_num_set_bits = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    batched_word_num_set_bits_functor{d_masks, d_slot_offsets, d_first_bits, d_last_bits});
+
+  // first allocate temporary memory
+
+  size_t temp_storage_bytes{0};
+  CUDA_TRY(cub::DeviceSegmentedReduce::Sum(nullptr,
+                                           temp_storage_bytes,
+                                           word_num_set_bits,
+                                           d_set_counts.begin(),
+                                           num_ranges,
+                                           d_slot_offsets.begin(),
+                                           d_slot_offsets.begin() + 1,
+                                           stream.value()));
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+
+  // second perform segmented reduction
+
+  CUDA_TRY(cub::DeviceSegmentedReduce::Sum(d_temp_storage.data(),
+                                           temp_storage_bytes,
+                                           word_num_set_bits,
+                                           d_set_counts.begin(),
+                                           num_ranges,
+                                           d_slot_offsets.begin(),
+                                           d_slot_offsets.begin() + 1,
+                                           stream.value()));
+
+  CHECK_CUDA(stream.value());
+
+  std::vector<size_type> h_set_counts(num_ranges);
+  CUDA_TRY(cudaMemcpyAsync(h_set_counts.data(),
+                           d_set_counts.data(),
+                           num_ranges * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+
+  stream.synchronize();  // now h_set_counts is valid.
+
+  for (size_type r = 0; r < num_ranges; ++r) {
+    counts[batched_indices[r]] = (last_bits[r] - first_bits[r]) - h_set_counts[r];
+  }
+  return counts;
+}
+
+// Folds an AND/OR expression over the masks in a single kernel pass
+std::pair<rmm::device_buffer, size_type> bitmask_expr_fold(
+  host_span<bitmask_expr_node const> expr,
+  host_span<bitmask_type const*> masks,
+  host_span<size_type const> masks_begin_bits,
+  size_type mask_size_bits,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(mask_size_bits > 0, "Invalid bit range.");
+  CUDF_EXPECTS(masks.size() == masks_begin_bits.size(),
+               "Mask and offset arrays must be the same size");
+  CUDF_EXPECTS(
+    std::all_of(masks_begin_bits.begin(), masks_begin_bits.end(), [](auto b) { return b >= 0; }),
+    "Invalid range.");
+  CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
+               "Mask pointer cannot be null");
+
+  // Verify the expression is a postfix traversal of a binary AND/OR tree whose
+  // operand stack fits the device-side evaluator
+  size_type depth = 0;
+  for (auto const& node : expr) {
+    if (node.op == bitmask_expr_op::MASK) {
+      CUDF_EXPECTS(node.mask_index >= 0 and node.mask_index < static_cast<size_type>(masks.size()),
+                   "Mask index out of range");
+      depth++;
+      CUDF_EXPECTS(depth <= bitmask_expr::max_depth, "Bitmask expression is too deep");
+    } else {
+      CUDF_EXPECTS(depth >= 2, "Malformed bitmask expression");
+      depth--;
+    }
+  }
+  CUDF_EXPECTS(depth == 1, "Malformed bitmask expression");
+
+  rmm::device_scalar<size_type> d_counter{0, stream, mr};
+  auto d_nodes      = make_device_uvector_async(expr, stream, mr);
+  auto d_masks      = make_device_uvector_async(masks, stream, mr);
+  auto d_begin_bits = make_device_uvector_async(masks_begin_bits, stream, mr);
+
+  auto dest_mask = rmm::device_buffer{bitmask_allocation_size_bytes(mask_size_bits), stream, mr};
+  auto destination = device_span<bitmask_type>(static_cast<bitmask_type*>(dest_mask.data()),
+                                               num_bitmask_words(mask_size_bits));
+
+  auto constexpr block_size = 256;
+  cudf::detail::grid_1d config(destination.size(), block_size);
+  offset_bitmask_expr<block_size>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+      bitmask_expr{d_nodes, d_masks, d_begin_bits, mask_size_bits},
+      destination,
+      mask_size_bits,
+      d_counter.data());
+  CHECK_CUDA(stream.value());
+  auto const null_count = mask_size_bits - d_counter.value(stream);
+  return std::make_pair(std::move(dest_mask), null_count);
+}
+
 /**
  * @copydoc cudf::segmented_count_set_bits
  *
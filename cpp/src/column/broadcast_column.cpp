@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/broadcast_column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+
+broadcast_column::broadcast_column(std::unique_ptr<scalar> value, size_type size)
+  : _value{std::move(value)}, _size{size}
+{
+  CUDF_EXPECTS(_value != nullptr, "value must not be null.");
+  CUDF_EXPECTS(_size >= 0, "size must not be negative.");
+}
+
+broadcast_column::broadcast_column(std::shared_ptr<scalar const> value, size_type size)
+  : _value{std::move(value)}, _size{size}
+{
+}
+
+scalar const& broadcast_column::value() const { return *_value; }
+size_type broadcast_column::size() const { return _size; }
+data_type broadcast_column::type() const { return _value->type(); }
+
+broadcast_column broadcast_column::with_size(size_type size) const
+{
+  CUDF_EXPECTS(size >= 0, "size must not be negative.");
+  return broadcast_column{_value, size};
+}
+
+std::unique_ptr<column> broadcast_column::materialize(rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_size);
+  return make_column_from_scalar(*_value, _size, rmm::cuda_stream_default, mr);
+}
+
+broadcast_column gather(broadcast_column const& input, column_view const& gather_map)
+{
+  CUDF_EXPECTS(is_index_type(gather_map.type()), "gather_map must be an index type.");
+  CUDF_EXPECTS(not gather_map.has_nulls(), "gather_map must not contain nulls.");
+  return input.with_size(gather_map.size());
+}
+
+std::unique_ptr<column> concatenate(host_span<broadcast_column const> columns,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not columns.empty(), "Need at least one column to concatenate.");
+  CUDF_EXPECTS(std::all_of(columns.begin(),
+                           columns.end(),
+                           [&](auto const& col) { return col.type() == columns.front().type(); }),
+               "Type mismatch in columns to concatenate.");
+
+  // merge adjacent parts that share a scalar into one materialization each
+  std::vector<std::unique_ptr<column>> pieces;
+  auto run_value = &columns.front().value();
+  auto run_size  = size_type{0};
+  for (auto const& col : columns) {
+    if (&col.value() != run_value) {
+      pieces.push_back(make_column_from_scalar(*run_value, run_size, rmm::cuda_stream_default, mr));
+      run_value = &col.value();
+      run_size  = 0;
+    }
+    run_size += col.size();
+  }
+  pieces.push_back(make_column_from_scalar(*run_value, run_size, rmm::cuda_stream_default, mr));
+
+  if (pieces.size() == 1) { return std::move(pieces.front()); }
+
+  std::vector<column_view> views;
+  views.reserve(pieces.size());
+  std::transform(pieces.begin(), pieces.end(), std::back_inserter(views), [](auto const& piece) {
+    return piece->view();
+  });
+  return cudf::concatenate(host_span<column_view const>{views}, mr);
+}
+
+std::unique_ptr<column> binary_operation(broadcast_column const& lhs,
+                                         column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match.");
+  return binary_operation(lhs.value(), rhs, op, output_type, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         broadcast_column const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match.");
+  return binary_operation(lhs, rhs.value(), op, output_type, rmm::cuda_stream_default, mr);
+}
+
+broadcast_column binary_operation(broadcast_column const& lhs,
+                                  broadcast_column const& rhs,
+                                  binary_operator op,
+                                  data_type output_type,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match.");
+  // both operands are constant: evaluate on a single row and broadcast the result
+  auto const one_row = make_column_from_scalar(lhs.value(), 1, rmm::cuda_stream_default, mr);
+  auto const result =
+    binary_operation(one_row->view(), rhs.value(), op, output_type, rmm::cuda_stream_default, mr);
+  return broadcast_column{get_element(result->view(), 0, mr), lhs.size()};
+}
+
+}  // namespace cudf
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/packed_bools.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform.h>
+
+#include <array>
+#include <utility>
+
+namespace cudf {
+
+packed_bools::packed_bools(column_view const& bools, rmm::mr::device_memory_resource* mr)
+  : _bits{}, _size{bools.size()}
+{
+  CUDF_FUNC_RANGE();
+  auto mask = detail::bools_to_mask(bools, rmm::cuda_stream_default, mr);
+  _bits     = std::move(*mask.first);
+}
+
+packed_bools::packed_bools(rmm::device_buffer&& bits, size_type size)
+  : _bits{std::move(bits)}, _size{size}
+{
+  CUDF_EXPECTS(size >= 0, "Size must not be negative");
+  CUDF_EXPECTS(_bits.size() >= num_bitmask_words(size) * sizeof(bitmask_type),
+               "Bitmask is too small for the requested number of rows");
+}
+
+size_type packed_bools::true_count() const
+{
+  if (_size == 0) { return 0; }
+  return detail::count_set_bits(data(), 0, _size, rmm::cuda_stream_default);
+}
+
+std::unique_ptr<column> packed_bools::to_column(rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::mask_to_bools(data(), 0, _size, rmm::cuda_stream_default, mr);
+}
+
+namespace {
+
+/**
+ * @brief Merges two packed boolean columns through a two-operand bitmask expression.
+ */
+packed_bools packed_binop(packed_bools const& lhs,
+                          packed_bools const& rhs,
+                          detail::bitmask_expr_op op,
+                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Operand sizes must match");
+
+  if (lhs.size() == 0) { return packed_bools{rmm::device_buffer{}, 0}; }
+
+  std::array<detail::bitmask_expr_node, 3> expr{{{detail::bitmask_expr_op::MASK, 0},
+                                                 {detail::bitmask_expr_op::MASK, 1},
+                                                 {op, 0}}};
+  std::array<bitmask_type const*, 2> masks{lhs.data(), rhs.data()};
+  std::array<size_type, 2> begin_bits{0, 0};
+
+  auto result = detail::bitmask_expr_fold(expr,
+                                          masks,
+                                          host_span<size_type const>{begin_bits},
+                                          lhs.size(),
+                                          rmm::cuda_stream_default,
+                                          mr);
+  return packed_bools{std::move(result.first), lhs.size()};
+}
+
+}  // namespace
+
+packed_bools packed_and(packed_bools const& lhs,
+                        packed_bools const& rhs,
+                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return packed_binop(lhs, rhs, detail::bitmask_expr_op::BIT_AND, mr);
+}
+
+packed_bools packed_or(packed_bools const& lhs,
+                       packed_bools const& rhs,
+                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return packed_binop(lhs, rhs, detail::bitmask_expr_op::BIT_OR, mr);
+}
+
+packed_bools packed_not(packed_bools const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  if (input.size() == 0) { return packed_bools{rmm::device_buffer{}, 0}; }
+
+  auto const stream    = rmm::cuda_stream_default;
+  auto const num_words = num_bitmask_words(input.size());
+  rmm::device_buffer bits{static_cast<std::size_t>(num_words) * sizeof(bitmask_type), stream, mr};
+
+  thrust::transform(rmm::exec_policy(stream),
+                    input.data(),
+                    input.data() + num_words,
+                    static_cast<bitmask_type*>(bits.data()),
+                    [] __device__(bitmask_type word) { return ~word; });
+
+  // keep the bits beyond `size` in the final word unset
+  auto const word_bits = static_cast<size_type>(detail::size_in_bits<bitmask_type>());
+  if (input.size() % word_bits != 0) {
+    detail::set_null_mask(
+      static_cast<bitmask_type*>(bits.data()), input.size(), num_words * word_bits, false, stream);
+  }
+
+  return packed_bools{std::move(bits), input.size()};
+}
+
+}  // namespace cudf
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace cudf {
+
+namespace {
+
+/**
+ * @brief Returns the memory resource used for exported buffers.
+ *
+ * CUDA IPC memory handles refer to whole base allocations, so the exported buffer must be
+ * its own cudaMalloc allocation; suballocating resources (e.g. a pool) cannot be used here.
+ */
+rmm::mr::cuda_memory_resource* ipc_memory_resource()
+{
+  static rmm::mr::cuda_memory_resource mr{};
+  return &mr;
+}
+
+}  // namespace
+
+ipc_exported_table export_ipc(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  auto const stream = rmm::cuda_stream_default;
+  auto packed       = detail::pack(input, stream, ipc_memory_resource());
+
+  cudaIpcMemHandle_t handle{};
+  if (packed.gpu_data->size() != 0) {
+    CUDA_TRY(cudaIpcGetMemHandle(&handle, packed.gpu_data->data()));
+  }
+  // make the packed data visible before the handle can reach the importing process
+  stream.synchronize();
+
+  std::vector<uint8_t> serialized(sizeof(cudaIpcMemHandle_t) + packed.metadata_->size());
+  std::memcpy(serialized.data(), &handle, sizeof(cudaIpcMemHandle_t));
+  std::memcpy(serialized.data() + sizeof(cudaIpcMemHandle_t),
+              packed.metadata_->data(),
+              packed.metadata_->size());
+
+  return ipc_exported_table{std::move(packed), std::move(serialized)};
+}
+
+ipc_imported_table::ipc_imported_table(void* base, std::vector<uint8_t>&& metadata)
+  : _base(base), _metadata(std::move(metadata))
+{
+}
+
+ipc_imported_table::~ipc_imported_table()
+{
+  if (_base != nullptr) {
+    auto const close_result = cudaIpcCloseMemHandle(_base);
+    assert(close_result == cudaSuccess);
+  }
+}
+
+table_view ipc_imported_table::view() const
+{
+  return unpack(_metadata.data(), static_cast<uint8_t const*>(_base));
+}
+
+std::unique_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& serialized)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(serialized.size() >= sizeof(cudaIpcMemHandle_t),
+               "Serialized blob is too small to contain an IPC memory handle");
+
+  // an exported empty table carries a zeroed handle and no device buffer to map
+  auto const handle_bytes = serialized.data();
+  void* base              = nullptr;
+  if (std::any_of(handle_bytes, handle_bytes + sizeof(cudaIpcMemHandle_t), [](uint8_t byte) {
+        return byte != 0;
+      })) {
+    cudaIpcMemHandle_t handle{};
+    std::memcpy(&handle, handle_bytes, sizeof(cudaIpcMemHandle_t));
+    CUDA_TRY(cudaIpcOpenMemHandle(&base, handle, cudaIpcMemLazyEnablePeerAccess));
+  }
+
+  std::vector<uint8_t> metadata(serialized.begin() + sizeof(cudaIpcMemHandle_t),
+                                serialized.end());
+  return std::make_unique<ipc_imported_table>(base, std::move(metadata));
+}
+
+}  // namespace cudf
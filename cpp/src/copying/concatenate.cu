@@ -22,6 +22,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/launch_config.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/concatenate.hpp>
 #include <cudf/lists/detail/concatenate.hpp>
@@ -133,14 +134,27 @@ void concatenate_masks(device_span<column_device_view const> d_views,
                        size_type output_size,
                        rmm::cuda_stream_view stream)
 {
-  constexpr size_type block_size{256};
-  cudf::detail::grid_1d config(output_size, block_size);
-  concatenate_masks_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-    d_views.data(),
-    d_offsets.data(),
-    static_cast<size_type>(d_views.size()),
-    dest_mask,
-    output_size);
+  auto const launch = [&](detail::launch_config const& config) {
+    cudf::detail::grid_1d grid(output_size, config.block_size);
+    concatenate_masks_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      d_views.data(),
+      d_offsets.data(),
+      static_cast<size_type>(d_views.size()),
+      dest_mask,
+      output_size);
+  };
+
+  constexpr size_type default_block_size{256};
+  // The kernel only overwrites destination words, so benchmarking the real
+  // launch is safe. Tune only on inputs large enough for a meaningful timing;
+  // small launches use the persisted winner or the default.
+  constexpr size_type tuning_threshold{1 << 22};
+  auto const config =
+    output_size >= tuning_threshold
+      ? detail::tune_launch_config(
+          "concatenate_masks", {{128}, {256}, {512}}, launch, stream)
+      : detail::get_launch_config("concatenate_masks", {default_block_size});
+  launch(config);
 }
 
 void concatenate_masks(host_span<column_view const> views,
@@ -546,14 +560,20 @@ rmm::device_buffer concatenate_masks(host_span<column_view const> views,
 std::unique_ptr<column> concatenate(host_span<column_view const> columns_to_concat,
                                     rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(std::accumulate(
+    columns_to_concat.begin(), columns_to_concat.end(), std::size_t{0}, [](auto sum, auto const& c) {
+      return sum + c.size();
+    }));
   return detail::concatenate(columns_to_concat, rmm::cuda_stream_default, mr);
 }
 
 std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
                                    rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(std::accumulate(
+    tables_to_concat.begin(), tables_to_concat.end(), std::size_t{0}, [](auto sum, auto const& t) {
+      return sum + t.num_rows();
+    }));
   return detail::concatenate(tables_to_concat, rmm::cuda_stream_default, mr);
 }
 
@@ -22,6 +22,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/launch_config.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_view.hpp>
@@ -1045,9 +1046,26 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
 
   // copy.  1 block per buffer
   {
-    constexpr size_type block_size = 256;
-    copy_partition<block_size><<<num_bufs, block_size, 0, stream.value()>>>(
-      num_src_bufs, d_src_bufs, d_dst_bufs, d_dst_buf_info);
+    // The block size is a template parameter, so the registry selects among
+    // pre-built instantiations. The kernel accumulates null counts and cannot
+    // be re-launched for timing, so the config comes from the persisted
+    // profile only; unknown sizes use the default instantiation.
+    constexpr size_type default_block_size = 256;
+    auto const config                      = cudf::detail::get_launch_config(
+      "contiguous_split_copy_partition", {default_block_size});
+    switch (config.block_size) {
+      case 128:
+        copy_partition<128><<<num_bufs, 128, 0, stream.value()>>>(
+          num_src_bufs, d_src_bufs, d_dst_bufs, d_dst_buf_info);
+        break;
+      case 512:
+        copy_partition<512><<<num_bufs, 512, 0, stream.value()>>>(
+          num_src_bufs, d_src_bufs, d_dst_bufs, d_dst_buf_info);
+        break;
+      default:
+        copy_partition<default_block_size><<<num_bufs, default_block_size, 0, stream.value()>>>(
+          num_src_bufs, d_src_bufs, d_dst_bufs, d_dst_buf_info);
+    }
   }
 
   // DtoH dst info (to retrieve null counts)
@@ -20,10 +20,17 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/managed.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/pair.h>
+#include <thrust/transform_reduce.h>
+
+#include <limits>
 
 namespace cudf {
 namespace detail {
@@ -37,6 +44,9 @@ std::unique_ptr<table> gather(table_view const& source_table,
 {
   CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
 
+  // page managed-memory source columns onto the device before the gather kernels touch them
+  prefetch(source_table, stream);
+
   // create index type normalizing iterator for the gather_map
   auto map_begin = indexalator_factory::make_input_iterator(gather_map);
   auto map_end   = map_begin + gather_map.size();
@@ -69,14 +79,100 @@ std::unique_ptr<table> gather(table_view const& source_table,
   return gather(source_table, map_col, bounds_policy, neg_indices, stream, mr);
 }
 
+std::unique_ptr<table> gather(table_view const& source_table,
+                              prepared_gather_map const& gather_map,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto const n_rows = source_table.num_rows();
+
+  // maps known to be fully in-bounds skip the per-element bounds checks entirely
+  if (gather_map.min_index() >= 0 && gather_map.max_index() < n_rows) {
+    return gather(source_table,
+                  gather_map.map(),
+                  out_of_bounds_policy::DONT_CHECK,
+                  negative_index_policy::NOT_ALLOWED,
+                  stream,
+                  mr);
+  }
+
+  // negative indices require translation; checks can still be skipped when the
+  // recorded range shows every index resolves within the source table
+  auto const neg_indices = gather_map.min_index() < 0 ? negative_index_policy::ALLOWED
+                                                      : negative_index_policy::NOT_ALLOWED;
+  auto const bounds_policy =
+    (gather_map.min_index() >= -n_rows && gather_map.max_index() < n_rows)
+      ? out_of_bounds_policy::DONT_CHECK
+      : out_of_bounds_policy::NULLIFY;
+  return gather(source_table, gather_map.map(), bounds_policy, neg_indices, stream, mr);
+}
+
+std::unique_ptr<table> gather(std::unique_ptr<table>&& source_table,
+                              column_view const& gather_map,
+                              out_of_bounds_policy bounds_policy,
+                              negative_index_policy neg_indices,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto source_columns = source_table->release();
+
+  // gather column by column, freeing each source column as soon as its result
+  // has been materialized so peak memory tracks the larger side of the copy
+  // rather than the sum of input and output
+  std::vector<std::unique_ptr<column>> result_columns;
+  result_columns.reserve(source_columns.size());
+  for (auto& source_column : source_columns) {
+    result_columns.push_back(
+      std::move(gather(table_view{{source_column->view()}},
+                       gather_map,
+                       bounds_policy,
+                       neg_indices,
+                       stream,
+                       mr)
+                  ->release()
+                  .front()));
+    source_column.reset();
+  }
+  return std::make_unique<table>(std::move(result_columns));
+}
+
 }  // namespace detail
 
+prepared_gather_map::prepared_gather_map(column_view const& gather_map)
+  : _map(gather_map), _min_index(0), _max_index(-1)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+  if (gather_map.is_empty()) { return; }
+
+  auto const map_begin = detail::indexalator_factory::make_input_iterator(gather_map);
+  auto const minmax    = thrust::transform_reduce(
+    rmm::exec_policy(rmm::cuda_stream_default),
+    map_begin,
+    map_begin + gather_map.size(),
+    [] __device__(size_type idx) { return thrust::make_pair(idx, idx); },
+    thrust::make_pair(std::numeric_limits<size_type>::max(), std::numeric_limits<size_type>::min()),
+    [] __device__(auto lhs, auto rhs) {
+      return thrust::make_pair(std::min(lhs.first, rhs.first), std::max(lhs.second, rhs.second));
+    });
+  _min_index = minmax.first;
+  _max_index = minmax.second;
+}
+
+std::unique_ptr<table> gather(table_view const& source_table,
+                              prepared_gather_map const& gather_map,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(gather_map.map().size());
+  return detail::gather(source_table, gather_map, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<table> gather(table_view const& source_table,
                               column_view const& gather_map,
                               out_of_bounds_policy bounds_policy,
                               rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(gather_map.size());
 
   auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
                                                      : detail::negative_index_policy::ALLOWED;
@@ -85,4 +181,22 @@ std::unique_ptr<table> gather(table_view const& source_table,
     source_table, gather_map, bounds_policy, index_policy, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> gather(std::unique_ptr<table>&& source_table,
+                              column_view const& gather_map,
+                              out_of_bounds_policy bounds_policy,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(gather_map.size());
+
+  auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
+                                                     : detail::negative_index_policy::ALLOWED;
+
+  return detail::gather(std::move(source_table),
+                        gather_map,
+                        bounds_policy,
+                        index_policy,
+                        rmm::cuda_stream_default,
+                        mr);
+}
+
 }  // namespace cudf
@@ -496,7 +496,7 @@ std::unique_ptr<table> scatter(table_view const& source,
                                bool check_bounds,
                                rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(source.num_rows());
   return detail::scatter(source, scatter_map, target, check_bounds, rmm::cuda_stream_default, mr);
 }
 
@@ -515,7 +515,7 @@ std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                                             column_view const& boolean_mask,
                                             rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(target.num_rows());
   return detail::boolean_mask_scatter(input, target, boolean_mask, rmm::cuda_stream_default, mr);
 }
 
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/shared_column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace cudf {
+
+shared_column::shared_column(std::unique_ptr<column>&& col) : _base{std::move(col)}
+{
+  CUDF_EXPECTS(_base != nullptr, "Invalid null column.");
+  _view = _base->view();
+}
+
+shared_column::shared_column(std::shared_ptr<column> base, column_view view)
+  : _base{std::move(base)}, _view{view}
+{
+}
+
+bool shared_column::is_base() const
+{
+  return _base != nullptr and _view.offset() == 0 and _view.size() == _base->size();
+}
+
+shared_column shared_column::base() const { return shared_column{_base, _base->view()}; }
+
+shared_column shared_column::slice(size_type begin, size_type end) const
+{
+  return shared_column{_base, cudf::slice(_view, {begin, end}).front()};
+}
+
+std::vector<shared_column> shared_column::split(host_span<size_type const> splits) const
+{
+  auto const views = cudf::split(_view, splits);
+  auto result      = std::vector<shared_column>{};
+  result.reserve(views.size());
+  std::transform(views.begin(), views.end(), std::back_inserter(result), [this](auto const& view) {
+    return shared_column{_base, view};
+  });
+  return result;
+}
+
+std::unique_ptr<column> shared_column::release(rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(_base != nullptr, "Cannot release an empty shared_column.");
+
+  auto result = (not is_shared() and is_base()) ? std::make_unique<column>(std::move(*_base))
+                                                : std::make_unique<column>(_view, stream, mr);
+  _base.reset();
+  _view = column_view{};
+  return result;
+}
+
+}  // namespace cudf
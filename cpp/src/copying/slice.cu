@@ -14,12 +14,14 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -92,6 +94,32 @@ std::vector<table_view> slice(table_view const& input,
   return result;
 }
 
+std::unique_ptr<table> slice(std::unique_ptr<table>&& input,
+                             size_type begin,
+                             size_type end,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
+  CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
+  CUDF_EXPECTS(end <= input->num_rows(), "Slice range out of bounds.");
+
+  // a slice spanning the whole table reuses the input's buffers outright
+  if (begin == 0 and end == input->num_rows()) { return std::move(input); }
+
+  // copy column by column, freeing each input column as soon as its slice has
+  // been materialized so peak memory tracks the input rather than input+output
+  auto input_columns = input->release();
+  std::vector<std::unique_ptr<column>> result_columns;
+  result_columns.reserve(input_columns.size());
+  for (auto& input_column : input_columns) {
+    result_columns.push_back(std::make_unique<column>(
+      cudf::detail::slice(input_column->view(), begin, end), stream, mr));
+    input_column.reset();
+  }
+  return std::make_unique<table>(std::move(result_columns));
+}
+
 std::vector<column_view> slice(column_view const& input,
                                std::initializer_list<size_type> indices,
                                rmm::cuda_stream_view stream)
@@ -120,6 +148,15 @@ std::vector<table_view> slice(table_view const& input, host_span<size_type const
   return detail::slice(input, indices, rmm::cuda_stream_default);
 };
 
+std::unique_ptr<table> slice(std::unique_ptr<table>&& input,
+                             size_type begin,
+                             size_type end,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::slice(std::move(input), begin, end, rmm::cuda_stream_default, mr);
+}
+
 std::vector<column_view> slice(column_view const& input, std::initializer_list<size_type> indices)
 {
   CUDF_FUNC_RANGE();
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <io/comp/gpuinflate.h>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Blocks are compressed independently; matches the ORC writer's compression block size.
+constexpr std::size_t spill_block_size = 1 << 18;
+
+/**
+ * @brief Worst-case Snappy compressed size for a block of the given size.
+ */
+constexpr std::size_t max_compressed_size(std::size_t block_size)
+{
+  return block_size + block_size / 6 + 32;
+}
+
+}  // namespace
+
+spilled_columns spill(table_view const& input,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  // pack into a single contiguous buffer; the packed buffer is an intermediate
+  auto packed      = detail::pack(input, stream, rmm::mr::get_current_device_resource());
+  auto const total = packed.gpu_data->size();
+
+  spilled_columns result;
+  result.metadata_         = std::move(packed.metadata_);
+  result.uncompressed_size = total;
+  if (total == 0) {
+    result.data = std::make_unique<rmm::device_buffer>();
+    return result;
+  }
+
+  auto const num_blocks     = util::div_rounding_up_safe(total, spill_block_size);
+  auto const scratch_stride = max_compressed_size(spill_block_size);
+  rmm::device_uvector<uint8_t> scratch(num_blocks * scratch_stride, stream);
+
+  auto const* src = static_cast<uint8_t const*>(packed.gpu_data->data());
+  std::vector<io::gpu_inflate_input_s> h_inputs(num_blocks);
+  for (std::size_t i = 0; i < num_blocks; ++i) {
+    auto const offset = i * spill_block_size;
+    auto const length = std::min(spill_block_size, total - offset);
+    h_inputs[i] = {src + offset, length, scratch.data() + i * scratch_stride, scratch_stride};
+  }
+  auto d_inputs = cudf::detail::make_device_uvector_async(h_inputs, stream);
+  rmm::device_uvector<io::gpu_inflate_status_s> d_statuses(num_blocks, stream);
+  CUDA_TRY(
+    io::gpu_snap(d_inputs.data(), d_statuses.data(), static_cast<int>(num_blocks), stream));
+  auto const h_statuses = cudf::detail::make_std_vector_sync(d_statuses, stream);
+
+  // store each block compressed only if compression shrank it
+  result.block_sizes.reserve(num_blocks);
+  std::size_t stored_total = 0;
+  for (std::size_t i = 0; i < num_blocks; ++i) {
+    auto const length     = h_inputs[i].srcSize;
+    auto const compressed = h_statuses[i].status == 0 and h_statuses[i].bytes_written < length;
+    auto const stored     = compressed ? h_statuses[i].bytes_written : length;
+    result.block_sizes.push_back(static_cast<size_type>(stored));
+    stored_total += stored;
+  }
+
+  result.data = std::make_unique<rmm::device_buffer>(stored_total, stream, mr);
+  auto* dst   = static_cast<uint8_t*>(result.data->data());
+  std::size_t out_offset = 0;
+  for (std::size_t i = 0; i < num_blocks; ++i) {
+    auto const stored = static_cast<std::size_t>(result.block_sizes[i]);
+    auto const* from =
+      stored < h_inputs[i].srcSize ? h_inputs[i].dstDevice : h_inputs[i].srcDevice;
+    CUDA_TRY(
+      cudaMemcpyAsync(dst + out_offset, from, stored, cudaMemcpyDefault, stream.value()));
+    out_offset += stored;
+  }
+  // the packed buffer and scratch are freed in stream order after the copies
+  return result;
+}
+
+packed_columns unspill(spilled_columns const& input,
+                       rmm::cuda_stream_view stream,
+                       rmm::mr::device_memory_resource* mr)
+{
+  auto metadata = std::make_unique<packed_columns::metadata>(std::vector<uint8_t>(
+    input.metadata_->data(), input.metadata_->data() + input.metadata_->size()));
+  auto gpu_data = std::make_unique<rmm::device_buffer>(input.uncompressed_size, stream, mr);
+  if (input.uncompressed_size == 0) {
+    return packed_columns{std::move(metadata), std::move(gpu_data)};
+  }
+
+  auto const total = input.uncompressed_size;
+  auto const* src  = static_cast<uint8_t const*>(input.data->data());
+  auto* dst        = static_cast<uint8_t*>(gpu_data->data());
+
+  // separate compressed blocks from those stored raw
+  std::vector<io::gpu_inflate_input_s> h_compressed;
+  std::vector<io::gpu_inflate_input_s> h_raw;
+  std::size_t in_offset = 0;
+  for (std::size_t i = 0; i < input.block_sizes.size(); ++i) {
+    auto const out_offset = i * spill_block_size;
+    auto const length     = std::min(spill_block_size, total - out_offset);
+    auto const stored     = static_cast<std::size_t>(input.block_sizes[i]);
+    auto& blocks          = stored < length ? h_compressed : h_raw;
+    blocks.push_back({src + in_offset, stored, dst + out_offset, length});
+    in_offset += stored;
+  }
+
+  if (not h_compressed.empty()) {
+    auto d_inputs = cudf::detail::make_device_uvector_async(h_compressed, stream);
+    rmm::device_uvector<io::gpu_inflate_status_s> d_statuses(h_compressed.size(), stream);
+    CUDA_TRY(io::gpu_unsnap(
+      d_inputs.data(), d_statuses.data(), static_cast<int>(h_compressed.size()), stream));
+    auto const h_statuses = cudf::detail::make_std_vector_sync(d_statuses, stream);
+    CUDF_EXPECTS(std::all_of(h_statuses.begin(),
+                             h_statuses.end(),
+                             [](auto const& s) { return s.status == 0; }),
+                 "Snappy decompression of a spilled block failed");
+  }
+  if (not h_raw.empty()) {
+    auto d_inputs = cudf::detail::make_device_uvector_async(h_raw, stream);
+    CUDA_TRY(io::gpu_copy_uncompressed_blocks(
+      d_inputs.data(), static_cast<int>(h_raw.size()), stream));
+  }
+
+  return packed_columns{std::move(metadata), std::move(gpu_data)};
+}
+
+}  // namespace detail
+
+spilled_columns spill(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::spill(input, rmm::cuda_stream_default, mr);
+}
+
+packed_columns unspill(spilled_columns const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::unspill(input, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
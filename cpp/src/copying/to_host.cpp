@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cassert>
+#include <utility>
+
+namespace cudf {
+
+host_snapshot::host_snapshot(table_view const& input)
+{
+  auto const stream = rmm::cuda_stream_default;
+  auto packed       = detail::pack(input, stream, rmm::mr::get_current_device_resource());
+
+  _metadata = std::move(packed.metadata_);
+  _size     = packed.gpu_data->size();
+  if (_size != 0) {
+    // the destination is pinned so the copy is truly asynchronous and overlaps
+    // with device work enqueued after this call
+    CUDA_TRY(cudaMallocHost(&_host_data, _size));
+    // keep the packed device buffer alive until the copy has completed
+    _staging = std::move(packed.gpu_data);
+    CUDA_TRY(cudaMemcpyAsync(
+      _host_data, _staging->data(), _size, cudaMemcpyDeviceToHost, stream.value()));
+  }
+  CUDA_TRY(cudaEventCreateWithFlags(&_event, cudaEventDisableTiming));
+  CUDA_TRY(cudaEventRecord(_event, stream.value()));
+}
+
+host_snapshot::host_snapshot(host_snapshot&& other) noexcept
+  : _metadata(std::move(other._metadata)),
+    _staging(std::move(other._staging)),
+    _host_data(std::exchange(other._host_data, nullptr)),
+    _size(std::exchange(other._size, 0)),
+    _event(std::exchange(other._event, nullptr))
+{
+}
+
+host_snapshot& host_snapshot::operator=(host_snapshot&& other) noexcept
+{
+  if (this != &other) {
+    this->~host_snapshot();
+    new (this) host_snapshot(std::move(other));
+  }
+  return *this;
+}
+
+host_snapshot::~host_snapshot()
+{
+  if (_event != nullptr) {
+    // the copy must have completed before the pinned buffer can be released
+    auto const sync_result = cudaEventSynchronize(_event);
+    assert(sync_result == cudaSuccess);
+    cudaEventDestroy(_event);
+  }
+  if (_host_data != nullptr) { cudaFreeHost(_host_data); }
+}
+
+void host_snapshot::wait()
+{
+  if (_event != nullptr) { CUDA_TRY(cudaEventSynchronize(_event)); }
+  // the device-side staging buffer is no longer needed once the copy is done
+  _staging.reset();
+}
+
+bool host_snapshot::is_ready() const
+{
+  if (_event == nullptr) { return true; }
+  auto const status = cudaEventQuery(_event);
+  if (status == cudaErrorNotReady) { return false; }
+  CUDA_TRY(status);
+  return true;
+}
+
+host_snapshot to_host(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return host_snapshot(input);
+}
+
+}  // namespace cudf
@@ -117,6 +117,42 @@ struct ceil_timestamp {
   }
 };
 
+// Rounding direction for the interval-based rounding operators
+enum class rounding_kind { FLOOR, CEIL, ROUND };
+
+/**
+ * @brief Rounds a timestamp to a multiple of the given interval tick count.
+ *
+ * The interval is expressed in ticks of the timestamp's own resolution and
+ * is anchored at the UNIX epoch. ROUND resolves halfway values upward.
+ */
+struct round_interval_timestamp {
+  int64_t interval;
+  rounding_kind mode;
+
+  // floor division that rounds toward negative infinity for pre-epoch values
+  static CUDA_DEVICE_CALLABLE int64_t floored_div(int64_t n, int64_t d)
+  {
+    auto const q = n / d;
+    return (n % d != 0 && n < 0) ? q - 1 : q;
+  }
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE Timestamp operator()(Timestamp const ts) const
+  {
+    auto const count    = static_cast<int64_t>(ts.time_since_epoch().count());
+    auto const quotient = [&] {
+      switch (mode) {
+        case rounding_kind::FLOOR: return floored_div(count, interval);
+        case rounding_kind::CEIL: return -floored_div(-count, interval);
+        default: return floored_div(count + interval / 2, interval);
+      }
+    }();
+    return Timestamp{typename Timestamp::duration{
+      static_cast<typename Timestamp::duration::rep>(quotient * interval)}};
+  }
+};
+
 // Number of days until month indexed by leap year and month (0-based index)
 static __device__ int16_t const days_until_month[2][13] = {
   {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},  // For non leap years
@@ -234,6 +270,81 @@ struct dispatch_ceil {
   }
 };
 
+// Specific function for applying the interval-based floor/ceil/round ops
+struct dispatch_round_interval {
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp<Timestamp>(), std::unique_ptr<cudf::column>> operator()(
+    cudf::column_view const& column,
+    int64_t interval,
+    rounding_kind mode,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    auto size            = column.size();
+    auto output_col_type = data_type{cudf::type_to_id<Timestamp>()};
+
+    // Return an empty column if source column is empty
+    if (size == 0) return make_empty_column(output_col_type);
+
+    auto output = make_fixed_width_column(output_col_type,
+                                          size,
+                                          cudf::detail::copy_bitmask(column, stream, mr),
+                                          column.null_count(),
+                                          stream,
+                                          mr);
+
+    thrust::transform(rmm::exec_policy(stream),
+                      column.begin<Timestamp>(),
+                      column.end<Timestamp>(),
+                      output->mutable_view().begin<Timestamp>(),
+                      round_interval_timestamp{interval, mode});
+
+    return output;
+  }
+
+  template <typename Timestamp, typename... Args>
+  std::enable_if_t<!cudf::is_timestamp<Timestamp>(), std::unique_ptr<cudf::column>> operator()(
+    Args&&...)
+  {
+    CUDF_FAIL("Must be cudf::timestamp");
+  }
+};
+
+// Returns the length of one tick of the given timestamp or duration type
+// as a fraction of a second (numerator, denominator).
+std::pair<int64_t, int64_t> time_period(type_id id)
+{
+  switch (id) {
+    case type_id::TIMESTAMP_DAYS:
+    case type_id::DURATION_DAYS: return {86400, 1};
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::DURATION_SECONDS: return {1, 1};
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::DURATION_MILLISECONDS: return {1, 1000};
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::DURATION_MICROSECONDS: return {1, 1000000};
+    case type_id::TIMESTAMP_NANOSECONDS:
+    case type_id::DURATION_NANOSECONDS: return {1, 1000000000};
+    default: CUDF_FAIL("Expected a timestamp or duration type");
+  }
+}
+
+// Returns the tick count held by a duration scalar
+struct interval_count_functor {
+  template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+  int64_t operator()(scalar const& interval, rmm::cuda_stream_view stream) const
+  {
+    return static_cast<int64_t>(
+      static_cast<duration_scalar<T> const&>(interval).value(stream).count());
+  }
+
+  template <typename T, std::enable_if_t<!cudf::is_duration<T>()>* = nullptr, typename... Args>
+  int64_t operator()(Args&&...) const
+  {
+    CUDF_FAIL("Interval must be a duration scalar");
+  }
+};
+
 // Apply the functor for every element/row in the input column to create the output column
 template <typename TransformFunctor, typename OutputColT>
 struct launch_functor {
@@ -393,6 +504,36 @@ std::unique_ptr<column> ceil_general(column_view const& column,
     column.type(), dispatch_ceil<detail::ceil_timestamp<Component>>{}, column, stream, mr);
 }
 
+std::unique_ptr<column> round_interval_general(rounding_kind mode,
+                                               column_view const& column,
+                                               scalar const& interval,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(is_duration(interval.type()), "Interval must be a duration type");
+  CUDF_EXPECTS(interval.is_valid(stream), "Interval must be a valid scalar");
+
+  auto const count = type_dispatcher(interval.type(), interval_count_functor{}, interval, stream);
+  CUDF_EXPECTS(count > 0, "Interval must be a positive duration");
+
+  // convert the interval into ticks of the timestamp's own resolution
+  auto const [interval_num, interval_den] = time_period(interval.type().id());
+  auto const [column_num, column_den]     = time_period(column.type().id());
+  auto const numerator                    = count * interval_num * column_den;
+  auto const denominator                  = interval_den * column_num;
+  CUDF_EXPECTS(numerator % denominator == 0,
+               "Interval must be a multiple of the timestamp resolution");
+
+  return type_dispatcher(column.type(),
+                         dispatch_round_interval{},
+                         column,
+                         numerator / denominator,
+                         mode,
+                         stream,
+                         mr);
+}
+
 std::unique_ptr<column> extract_year(column_view const& column,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
@@ -547,6 +688,33 @@ std::unique_ptr<column> ceil_nanosecond(column_view const& column,
     column, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> floor_timestamps(column_view const& column,
+                                         scalar const& interval,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::round_interval_general(
+    detail::rounding_kind::FLOOR, column, interval, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> ceil_timestamps(column_view const& column,
+                                        scalar const& interval,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::round_interval_general(
+    detail::rounding_kind::CEIL, column, interval, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> round_timestamps(column_view const& column,
+                                         scalar const& interval,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::round_interval_general(
+    detail::rounding_kind::ROUND, column, interval, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> extract_year(column_view const& column, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
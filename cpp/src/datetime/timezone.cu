@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/durations.hpp>
+
+#include <io/orc/timezone.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns a view of the device-resident transition table for the given timezone.
+ *
+ * Tables are kept in a process-wide cache so each timezone's TZif file is
+ * parsed and uploaded only once; subsequent lookups return the cached table.
+ * "UTC" and the empty string map to an empty table (zero offset everywhere).
+ */
+cudf::io::timezone_table_view cached_timezone_table(std::string const& timezone_name,
+                                                    rmm::cuda_stream_view stream)
+{
+  static std::mutex cache_mutex;
+  static std::map<std::string, cudf::io::timezone_table> cache;
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto found = cache.find(timezone_name);
+  if (found == cache.end()) {
+    found =
+      cache
+        .emplace(timezone_name, cudf::io::build_timezone_transition_table(timezone_name, stream))
+        .first;
+  }
+  return found->second.view();
+}
+
+/**
+ * @brief Shifts a timestamp from one timezone's wall-clock time to another's.
+ *
+ * The input is interpreted as wall-clock time in the source timezone; it is
+ * first normalized to UTC and then shifted by the target timezone's offset.
+ * An empty table means UTC (zero offset).
+ */
+struct convert_timezone_functor {
+  cudf::io::timezone_table_view from;
+  cudf::io::timezone_table_view to;
+
+  static __device__ int64_t offset_of(cudf::io::timezone_table_view const& tz, int64_t secs)
+  {
+    return tz.ttimes.empty() ? 0 : cudf::io::get_gmt_offset(tz.ttimes, tz.offsets, secs);
+  }
+
+  template <typename Timestamp>
+  __device__ Timestamp operator()(Timestamp const ts) const
+  {
+    using duration         = typename Timestamp::duration;
+    auto const since_epoch = ts.time_since_epoch();
+    auto const secs        = cuda::std::chrono::floor<duration_s>(since_epoch).count();
+    auto const from_offset = offset_of(from, secs);
+    auto const to_offset   = offset_of(to, secs - from_offset);
+    return Timestamp{since_epoch +
+                     cuda::std::chrono::duration_cast<duration>(duration_s{to_offset - from_offset})};
+  }
+};
+
+struct dispatch_convert_timezone {
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp<Timestamp>(), std::unique_ptr<cudf::column>> operator()(
+    cudf::column_view const& column,
+    cudf::io::timezone_table_view from,
+    cudf::io::timezone_table_view to,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    auto size            = column.size();
+    auto output_col_type = data_type{cudf::type_to_id<Timestamp>()};
+
+    // Return an empty column if source column is empty
+    if (size == 0) return make_empty_column(output_col_type);
+
+    auto output = make_fixed_width_column(output_col_type,
+                                          size,
+                                          cudf::detail::copy_bitmask(column, stream, mr),
+                                          column.null_count(),
+                                          stream,
+                                          mr);
+
+    thrust::transform(rmm::exec_policy(stream),
+                      column.begin<Timestamp>(),
+                      column.end<Timestamp>(),
+                      output->mutable_view().begin<Timestamp>(),
+                      convert_timezone_functor{from, to});
+
+    return output;
+  }
+
+  template <typename Timestamp, typename... Args>
+  std::enable_if_t<!cudf::is_timestamp<Timestamp>(), std::unique_ptr<cudf::column>> operator()(
+    Args&&...)
+  {
+    CUDF_FAIL("Must be cudf::timestamp");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> convert_timezone(column_view const& column,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(column.type().id() != type_id::TIMESTAMP_DAYS,
+               "Day timestamps cannot represent sub-day timezone offsets");
+
+  auto const from = cached_timezone_table(from_timezone, stream);
+  auto const to   = cached_timezone_table(to_timezone, stream);
+
+  return type_dispatcher(column.type(), dispatch_convert_timezone{}, column, from, to, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& column,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(
+    column, from_timezone, to_timezone, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/distributed_table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Makes a device current for the lifetime of the guard.
+ */
+struct device_guard {
+  explicit device_guard(int device)
+  {
+    CUDA_TRY(cudaGetDevice(&_previous));
+    CUDA_TRY(cudaSetDevice(device));
+  }
+  ~device_guard() { cudaSetDevice(_previous); }
+
+  device_guard(device_guard const&) = delete;
+  device_guard& operator=(device_guard const&) = delete;
+
+ private:
+  int _previous{};
+};
+
+/**
+ * @brief Copies a packed buffer to a target device and rebuilds an owning table there.
+ *
+ * The peer copy is one contiguous transfer per shard; rebuilding the table
+ * from the unpacked view costs one additional device-local copy to take
+ * ownership of the rows.
+ */
+std::unique_ptr<table> move_packed_to_device(packed_columns const& packed,
+                                             int source_device,
+                                             int target_device)
+{
+  device_guard guard(target_device);
+  auto const stream = rmm::cuda_stream_default;
+
+  rmm::device_buffer buffer(packed.gpu_data->size(), stream);
+  if (buffer.size() > 0) {
+    CUDA_TRY(cudaMemcpyPeerAsync(buffer.data(),
+                                 target_device,
+                                 packed.gpu_data->data(),
+                                 source_device,
+                                 buffer.size(),
+                                 stream.value()));
+  }
+  stream.synchronize();
+
+  auto const view =
+    unpack(packed.metadata_->data(), static_cast<uint8_t const*>(buffer.data()));
+  return std::make_unique<table>(view);
+}
+
+}  // namespace
+
+distributed_table::distributed_table(std::vector<shard>&& shards) : _shards(std::move(shards))
+{
+  CUDF_EXPECTS(not _shards.empty(), "distributed_table requires at least one shard");
+  for (auto const& s : _shards) {
+    CUDF_EXPECTS(s.data != nullptr, "distributed_table shard table must not be null");
+    CUDF_EXPECTS(s.data->num_columns() == _shards.front().data->num_columns(),
+                 "distributed_table shards must have the same number of columns");
+    for (size_type col = 0; col < s.data->num_columns(); ++col) {
+      CUDF_EXPECTS(
+        column_types_equal(s.data->view().column(col), _shards.front().data->view().column(col)),
+        "distributed_table shards must have matching column types");
+    }
+  }
+}
+
+size_type distributed_table::num_rows() const
+{
+  return std::accumulate(_shards.begin(), _shards.end(), size_type{0}, [](auto sum, auto const& s) {
+    return sum + s.data->num_rows();
+  });
+}
+
+void distributed_table::enable_peer_access(std::vector<int> const& device_ids)
+{
+  for (auto const device : device_ids) {
+    device_guard guard(device);
+    for (auto const peer : device_ids) {
+      if (peer == device) { continue; }
+      int can_access = 0;
+      CUDA_TRY(cudaDeviceCanAccessPeer(&can_access, device, peer));
+      if (can_access == 0) { continue; }
+      auto const result = cudaDeviceEnablePeerAccess(peer, 0);
+      if (result != cudaSuccess and result != cudaErrorPeerAccessAlreadyEnabled) {
+        CUDA_TRY(result);
+      }
+      // clear the sticky already-enabled error so later calls see a clean state
+      cudaGetLastError();
+    }
+  }
+}
+
+std::unique_ptr<table> distributed_table::gather_to(int device_id) const
+{
+  CUDF_FUNC_RANGE();
+
+  // pack and move remote shards first so the transfer sources stay alive
+  std::vector<std::unique_ptr<table>> moved;
+  std::vector<table_view> views;
+  for (auto const& s : _shards) {
+    if (s.device_id == device_id) {
+      views.push_back(s.data->view());
+      continue;
+    }
+    auto packed = [&] {
+      device_guard guard(s.device_id);
+      return pack(s.data->view());
+    }();
+    moved.push_back(move_packed_to_device(packed, s.device_id, device_id));
+    views.push_back(moved.back()->view());
+  }
+
+  device_guard guard(device_id);
+  return concatenate(views);
+}
+
+distributed_table distributed_table::hash_partition(std::vector<size_type> const& columns_to_hash,
+                                                    hash_id hash_function,
+                                                    uint32_t seed) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not columns_to_hash.empty(), "hash_partition requires at least one key column");
+
+  auto const num_targets = num_shards();
+
+  // partition every shard locally into one packed buffer per target device
+  std::vector<std::vector<packed_table>> pieces(_shards.size());
+  for (std::size_t source = 0; source < _shards.size(); ++source) {
+    device_guard guard(_shards[source].device_id);
+    pieces[source] = hash_partition_and_pack(
+      _shards[source].data->view(), columns_to_hash, num_targets, hash_function, seed);
+  }
+
+  // exchange: target shard i receives piece i of every source shard
+  std::vector<shard> result;
+  result.reserve(_shards.size());
+  for (size_type target = 0; target < num_targets; ++target) {
+    auto const target_device = _shards[target].device_id;
+
+    std::vector<std::unique_ptr<table>> moved;
+    std::vector<table_view> views;
+    for (std::size_t source = 0; source < _shards.size(); ++source) {
+      // empty source shards produce no pieces at all
+      if (pieces[source].empty()) { continue; }
+      moved.push_back(move_packed_to_device(
+        pieces[source][target].data, _shards[source].device_id, target_device));
+      views.push_back(moved.back()->view());
+    }
+
+    device_guard guard(target_device);
+    auto merged =
+      views.empty() ? empty_like(_shards.front().data->view()) : concatenate(views);
+    result.push_back(shard{target_device, std::move(merged)});
+  }
+  return distributed_table(std::move(result));
+}
+
+}  // namespace cudf
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/estimation.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace estimation {
+namespace detail {
+namespace {
+
+/**
+ * @brief Sample frequency statistics used by the distinct-count estimator.
+ */
+struct sample_stats {
+  size_type sample_rows;     ///< number of rows sampled
+  size_type distinct_values; ///< distinct values in the sample
+  size_type singletons;      ///< values appearing exactly once in the sample
+};
+
+/**
+ * @brief Samples rows of a column and computes value frequency statistics.
+ *
+ * The sampled rows are hashed so the statistics work for any column type;
+ * hash collisions within a sample are rare enough to not matter for
+ * estimation purposes.
+ */
+sample_stats compute_sample_stats(column_view const& input,
+                                  size_type sample_size,
+                                  int64_t seed,
+                                  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = input.size();
+  auto const n        = std::min(sample_size, num_rows);
+
+  auto const sampled = cudf::detail::sample(
+    table_view{{input}}, n, sample_with_replacement::FALSE, seed, stream);
+  auto const hashes =
+    cudf::detail::hash(sampled->view(), hash_id::HASH_MURMUR3, {}, 0, stream);
+  auto d_hashes = hashes->view().begin<int32_t>();
+
+  rmm::device_uvector<int32_t> sorted(n, stream);
+  thrust::copy(rmm::exec_policy(stream), d_hashes, d_hashes + n, sorted.begin());
+  thrust::sort(rmm::exec_policy(stream), sorted.begin(), sorted.end());
+
+  // count distinct values and singletons by comparing each sorted hash with
+  // its neighbors
+  auto d_sorted  = sorted.data();
+  auto const distinct = static_cast<size_type>(thrust::count_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(n),
+    [d_sorted] __device__(size_type idx) {
+      return idx == 0 || d_sorted[idx] != d_sorted[idx - 1];
+    }));
+  auto const singletons = static_cast<size_type>(thrust::count_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(n),
+    [d_sorted, n] __device__(size_type idx) {
+      return (idx == 0 || d_sorted[idx] != d_sorted[idx - 1]) &&
+             (idx == n - 1 || d_sorted[idx] != d_sorted[idx + 1]);
+    }));
+
+  return sample_stats{n, distinct, singletons};
+}
+
+/**
+ * @brief Hashes each row of a column twice with independent seeds.
+ *
+ * The count-min sketch derives its `depth` hash functions from the pair with
+ * Kirsch-Mitzenmacher double hashing, `h1 + d * h2`, so a sketch of any depth
+ * needs only two hashing passes over the data.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> compute_sketch_hashes(
+  column_view const& input, uint32_t seed, rmm::cuda_stream_view stream)
+{
+  auto h1 = cudf::detail::hash(table_view{{input}}, hash_id::HASH_MURMUR3, {}, seed, stream);
+  auto h2 = cudf::detail::hash(
+    table_view{{input}}, hash_id::HASH_MURMUR3, {}, seed ^ 0x9e3779b9, stream);
+  return {std::move(h1), std::move(h2)};
+}
+
+/**
+ * @brief Returns the sketch cell a row hash pair maps to in sketch row `d`.
+ */
+__device__ inline size_type sketch_cell(uint32_t h1, uint32_t h2, size_type d, size_type width)
+{
+  // force the stride odd so h2 == 0 cannot collapse all sketch rows to one cell
+  auto const cell = (h1 + static_cast<uint32_t>(d) * (h2 | 1u)) % static_cast<uint32_t>(width);
+  return static_cast<size_type>(cell);
+}
+
+}  // namespace
+
+double estimate_distinct_count(column_view const& input,
+                               size_type sample_size,
+                               int64_t seed,
+                               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(sample_size > 0, "sample_size must be positive");
+  if (input.is_empty()) { return 0.0; }
+
+  auto const stats = compute_sample_stats(input, sample_size, seed, stream);
+  if (stats.sample_rows == input.size()) {
+    // the sample covered the whole column so the count is exact
+    return static_cast<double>(stats.distinct_values);
+  }
+
+  // Duj1 estimator: scale up the sample distinct count by the fraction of
+  // singletons, which indicates how much of the value domain remains unseen
+  auto const n = static_cast<double>(stats.sample_rows);
+  auto const d = static_cast<double>(stats.distinct_values);
+  auto const q = n / static_cast<double>(input.size());
+  auto const denominator =
+    1.0 - ((1.0 - q) * static_cast<double>(stats.singletons)) / n;
+  auto const estimate = denominator > 0 ? d / denominator : static_cast<double>(input.size());
+
+  return std::min(std::max(estimate, d), static_cast<double>(input.size()));
+}
+
+std::unique_ptr<column> equidepth_histogram(column_view const& input,
+                                            size_type num_buckets,
+                                            size_type sample_size,
+                                            int64_t seed,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_buckets > 0, "number of buckets must be positive");
+  CUDF_EXPECTS(sample_size > 0, "sample_size must be positive");
+  if (input.is_empty()) { return empty_like(input); }
+
+  auto const n = std::min(sample_size, input.size());
+  auto const sampled = cudf::detail::sample(
+    table_view{{input}}, n, sample_with_replacement::FALSE, seed, stream);
+  auto const sorted = cudf::detail::sort(sampled->view(), {}, {}, stream);
+
+  // gather the values at the evenly spaced sample quantiles
+  auto boundary_index = cudf::detail::make_counting_transform_iterator(
+    0, [n, num_buckets] __device__(size_type idx) {
+      return static_cast<size_type>((static_cast<int64_t>(idx) * (n - 1)) / num_buckets);
+    });
+  auto result = cudf::detail::gather(sorted->view(),
+                                     boundary_index,
+                                     boundary_index + num_buckets + 1,
+                                     out_of_bounds_policy::DONT_CHECK,
+                                     stream,
+                                     mr);
+  return std::move(result->release().front());
+}
+
+double estimate_join_selectivity(column_view const& left,
+                                 column_view const& right,
+                                 size_type sample_size,
+                                 int64_t seed,
+                                 rmm::cuda_stream_view stream)
+{
+  if (left.is_empty() || right.is_empty()) { return 0.0; }
+
+  // standard uniformity assumption: each left key matches 1/ndv of the right
+  // keys (and vice versa), so the selectivity is the inverse of the larger
+  // estimated distinct count
+  auto const left_ndv  = estimate_distinct_count(left, sample_size, seed, stream);
+  auto const right_ndv = estimate_distinct_count(right, sample_size, seed, stream);
+  return 1.0 / std::max({left_ndv, right_ndv, 1.0});
+}
+
+std::unique_ptr<column> count_min_sketch(column_view const& input,
+                                         size_type width,
+                                         size_type depth,
+                                         uint32_t seed,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(width > 0, "sketch width must be positive");
+  CUDF_EXPECTS(depth > 0, "sketch depth must be positive");
+
+  auto const num_counters = depth * width;
+  rmm::device_uvector<uint64_t> counters(num_counters, stream, mr);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), counters.begin(), counters.end(), uint64_t{0});
+
+  if (!input.is_empty()) {
+    auto const hashes = compute_sketch_hashes(input, seed, stream);
+    auto const d_h1   = hashes.first->view().begin<int32_t>();
+    auto const d_h2   = hashes.second->view().begin<int32_t>();
+    auto const d_mask = input.null_mask();
+    auto const offset = input.offset();
+    auto d_counters   = counters.data();
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [d_h1, d_h2, d_mask, offset, d_counters, width, depth] __device__(size_type idx) {
+        if (d_mask != nullptr && !bit_is_set(d_mask, idx + offset)) { return; }
+        auto const h1 = static_cast<uint32_t>(d_h1[idx]);
+        auto const h2 = static_cast<uint32_t>(d_h2[idx]);
+        for (size_type d = 0; d < depth; ++d) {
+          auto const cell = d * width + sketch_cell(h1, h2, d, width);
+          atomicAdd(reinterpret_cast<unsigned long long*>(d_counters) + cell, 1ull);
+        }
+      });
+  }
+
+  return std::make_unique<column>(data_type{type_id::UINT64}, num_counters, counters.release());
+}
+
+std::unique_ptr<table> topk_from_sketch(column_view const& sketch,
+                                        column_view const& candidates,
+                                        size_type k,
+                                        size_type depth,
+                                        uint32_t seed,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k > 0, "k must be positive");
+  CUDF_EXPECTS(depth > 0, "sketch depth must be positive");
+  CUDF_EXPECTS(sketch.type().id() == type_id::UINT64 && !sketch.has_nulls(),
+               "sketch must be a non-nullable UINT64 column");
+  CUDF_EXPECTS(sketch.size() > 0 && sketch.size() % depth == 0,
+               "sketch size must be a positive multiple of depth");
+  CUDF_EXPECTS(!candidates.has_nulls(), "candidates must not contain nulls");
+
+  auto const width = sketch.size() / depth;
+
+  // estimate each candidate's count as the minimum of its sketch counters
+  auto counts = make_numeric_column(
+    data_type{type_id::UINT64}, candidates.size(), mask_state::UNALLOCATED, stream, mr);
+  if (!candidates.is_empty()) {
+    auto const hashes   = compute_sketch_hashes(candidates, seed, stream);
+    auto const d_h1     = hashes.first->view().begin<int32_t>();
+    auto const d_h2     = hashes.second->view().begin<int32_t>();
+    auto const d_sketch = sketch.begin<uint64_t>();
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(candidates.size()),
+                      counts->mutable_view().begin<uint64_t>(),
+                      [d_h1, d_h2, d_sketch, width, depth] __device__(size_type idx) {
+                        auto const h1 = static_cast<uint32_t>(d_h1[idx]);
+                        auto const h2 = static_cast<uint32_t>(d_h2[idx]);
+                        auto estimate = d_sketch[sketch_cell(h1, h2, 0, width)];
+                        for (size_type d = 1; d < depth; ++d) {
+                          auto const count = d_sketch[d * width + sketch_cell(h1, h2, d, width)];
+                          estimate         = std::min(estimate, count);
+                        }
+                        return estimate;
+                      });
+  }
+
+  // rank the candidates by estimated count and keep the top k
+  auto const order =
+    cudf::detail::sorted_order(table_view{{counts->view()}}, {order::DESCENDING}, {}, stream);
+  auto const d_order = order->view().begin<size_type>();
+  auto const out_k   = std::min(k, candidates.size());
+  return cudf::detail::gather(table_view{{candidates, counts->view()}},
+                              d_order,
+                              d_order + out_k,
+                              out_of_bounds_policy::DONT_CHECK,
+                              stream,
+                              mr);
+}
+
+}  // namespace detail
+
+double estimate_distinct_count(column_view const& input, size_type sample_size, int64_t seed)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_distinct_count(input, sample_size, seed, rmm::cuda_stream_default);
+}
+
+std::unique_ptr<column> equidepth_histogram(column_view const& input,
+                                            size_type num_buckets,
+                                            size_type sample_size,
+                                            int64_t seed,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::equidepth_histogram(
+    input, num_buckets, sample_size, seed, rmm::cuda_stream_default, mr);
+}
+
+double estimate_join_selectivity(column_view const& left,
+                                 column_view const& right,
+                                 size_type sample_size,
+                                 int64_t seed)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_join_selectivity(
+    left, right, sample_size, seed, rmm::cuda_stream_default);
+}
+
+std::unique_ptr<column> count_min_sketch(column_view const& input,
+                                         size_type width,
+                                         size_type depth,
+                                         uint32_t seed,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_min_sketch(input, width, depth, seed, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> topk_from_sketch(column_view const& sketch,
+                                        column_view const& candidates,
+                                        size_type k,
+                                        size_type depth,
+                                        uint32_t seed,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::topk_from_sketch(sketch, candidates, k, depth, seed, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace estimation
+}  // namespace cudf
@@ -20,12 +20,21 @@
 #include <cudf/filling.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -50,6 +59,29 @@ struct const_tabulator {
   T __device__ operator()(cudf::size_type i) { return n_init.value() + static_cast<T>(i); }
 };
 
+template <typename T>
+struct timestamp_tabulator {
+  cudf::timestamp_scalar_device_view<T> const t_init;
+  cudf::duration_scalar_device_view<typename T::duration> const d_step;
+
+  T __device__ operator()(cudf::size_type i)
+  {
+    return t_init.value() + d_step.value() * static_cast<typename T::duration::rep>(i);
+  }
+};
+
+template <typename T>
+struct grouped_tabulator {
+  cudf::numeric_scalar_device_view<T> const n_init;
+  cudf::numeric_scalar_device_view<T> const n_step;
+  cudf::size_type const* group_starts;
+
+  T __device__ operator()(cudf::size_type i)
+  {
+    return n_init.value() + static_cast<T>(i - group_starts[i]) * n_step.value();
+  }
+};
+
 /**
  * @brief Functor called by the `type_dispatcher` to generate the sequence specified
  * by init and step.
@@ -108,6 +140,71 @@ struct sequence_functor {
     return result;
   }
 
+  template <typename T, typename std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(size_type size,
+                                     scalar const& init,
+                                     scalar const& step,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(step.type().id() == type_to_id<typename T::duration>(),
+                 "step resolution must match the timestamp resolution of init.");
+
+    auto result = make_fixed_width_column(init.type(), size, mask_state::UNALLOCATED, stream, mr);
+    auto result_device_view = mutable_column_device_view::create(*result, stream);
+
+    auto t_init =
+      get_scalar_device_view(static_cast<cudf::timestamp_scalar<T>&>(const_cast<scalar&>(init)));
+    auto d_step = get_scalar_device_view(
+      static_cast<cudf::duration_scalar<typename T::duration>&>(const_cast<scalar&>(step)));
+
+    thrust::tabulate(rmm::exec_policy(stream),
+                     result_device_view->begin<T>(),
+                     result_device_view->end<T>(),
+                     timestamp_tabulator<T>{t_init, d_step});
+
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_numeric<T>() or cudf::is_boolean<T>(), std::unique_ptr<column>>
+  operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported sequence scalar type");
+  }
+};
+
+/**
+ * @brief Functor called by the `type_dispatcher` to generate per-group sequences from
+ * precomputed group start indices.
+ */
+struct group_sequence_functor {
+  template <
+    typename T,
+    typename std::enable_if_t<cudf::is_numeric<T>() and not cudf::is_boolean<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(scalar const& init,
+                                     scalar const& step,
+                                     device_span<size_type const> group_starts,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto result = make_fixed_width_column(
+      init.type(), static_cast<size_type>(group_starts.size()), mask_state::UNALLOCATED, stream, mr);
+    auto result_device_view = mutable_column_device_view::create(*result, stream);
+
+    auto n_init =
+      get_scalar_device_view(static_cast<cudf::scalar_type_t<T>&>(const_cast<scalar&>(init)));
+    auto n_step =
+      get_scalar_device_view(static_cast<cudf::scalar_type_t<T>&>(const_cast<scalar&>(step)));
+
+    thrust::tabulate(rmm::exec_policy(stream),
+                     result_device_view->begin<T>(),
+                     result_device_view->end<T>(),
+                     grouped_tabulator<T>{n_init, n_step, group_starts.data()});
+
+    return result;
+  }
+
   template <typename T, typename... Args>
   std::enable_if_t<not cudf::is_numeric<T>() or cudf::is_boolean<T>(), std::unique_ptr<column>>
   operator()(Args&&...)
@@ -116,6 +213,33 @@ struct sequence_functor {
   }
 };
 
+/**
+ * @brief Computes, for each row, the index at which its run of equal consecutive labels
+ * begins.
+ */
+template <bool has_nulls>
+rmm::device_uvector<size_type> compute_group_starts(table_view const& labels,
+                                                    rmm::cuda_stream_view stream)
+{
+  auto const d_labels = table_device_view::create(labels, stream);
+  auto const comp     = row_equality_comparator<has_nulls>(*d_labels, *d_labels, true);
+
+  auto group_starts = rmm::device_uvector<size_type>(labels.num_rows(), stream);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   group_starts.begin(),
+                   group_starts.end(),
+                   [comp] __device__(size_type i) -> size_type {
+                     return (i == 0 or not comp(i, i - 1)) ? i : 0;
+                   });
+  // Group start indices are non-decreasing, so a max-scan propagates each start over its run
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         group_starts.begin(),
+                         group_starts.end(),
+                         group_starts.begin(),
+                         thrust::maximum<size_type>{});
+  return group_starts;
+}
+
 }  // anonymous namespace
 
 std::unique_ptr<column> sequence(size_type size,
@@ -124,9 +248,13 @@ std::unique_ptr<column> sequence(size_type size,
                                  rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(init.type() == step.type(), "init and step must be of the same type.");
   CUDF_EXPECTS(size >= 0, "size must be >= 0");
-  CUDF_EXPECTS(is_numeric(init.type()), "Input scalar types must be numeric");
+  if (is_timestamp(init.type())) {
+    CUDF_EXPECTS(is_duration(step.type()), "step must be a duration for timestamp sequences.");
+  } else {
+    CUDF_EXPECTS(init.type() == step.type(), "init and step must be of the same type.");
+    CUDF_EXPECTS(is_numeric(init.type()), "Input scalar types must be numeric");
+  }
 
   return type_dispatcher(init.type(), sequence_functor{}, size, init, step, stream, mr);
 }
@@ -143,6 +271,31 @@ std::unique_ptr<column> sequence(
   return type_dispatcher(init.type(), sequence_functor{}, size, init, stream, mr);
 }
 
+std::unique_ptr<column> sequence_by_group(column_view const& group_labels,
+                                          scalar const& init,
+                                          scalar const& step,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(init.type() == step.type(), "init and step must be of the same type.");
+  CUDF_EXPECTS(is_numeric(init.type()), "Input scalar types must be numeric");
+  CUDF_EXPECTS(not is_nested(group_labels.type()), "Group labels must not be a nested type.");
+
+  if (group_labels.is_empty()) { return make_empty_column(init.type()); }
+
+  auto const labels = table_view{{group_labels}};
+  auto const group_starts = has_nested_nulls(labels) ? compute_group_starts<true>(labels, stream)
+                                                     : compute_group_starts<false>(labels, stream);
+
+  return type_dispatcher(init.type(),
+                         group_sequence_functor{},
+                         init,
+                         step,
+                         device_span<size_type const>{group_starts.data(), group_starts.size()},
+                         stream,
+                         mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> sequence(size_type size,
@@ -160,4 +313,12 @@ std::unique_ptr<column> sequence(size_type size,
   return detail::sequence(size, init, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> sequence_by_group(column_view const& group_labels,
+                                          scalar const& init,
+                                          scalar const& step,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  return detail::sequence_by_group(group_labels, init, step, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -16,10 +16,15 @@
 
 #pragma once
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
 #include <vector>
 
@@ -55,6 +60,67 @@ inline std::vector<aggregation_result> extract_results(host_span<RequestType con
   return results;
 }
 
+/**
+ * @brief Indicates if an aggregation over an entirely-null values column has a
+ * result that requires no computation.
+ *
+ * Null-excluding aggregations see no input rows when every value is null:
+ * counts are zero and every other result row is null. Aggregations that give
+ * nulls meaning (COUNT_ALL, NUNIQUE with null_policy::INCLUDE, collects, ...)
+ * return false so callers run the full computation.
+ */
+inline bool has_trivial_all_null_result(aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::ARGMIN:
+    case aggregation::ARGMAX:
+    case aggregation::MEAN:
+    case aggregation::M2:
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+    case aggregation::MEDIAN:
+    case aggregation::COUNT_VALID: return true;
+    case aggregation::NUNIQUE:
+      return dynamic_cast<cudf::detail::nunique_aggregation const&>(agg)._null_handling ==
+             null_policy::EXCLUDE;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns the result of aggregating an entirely-null values column, or
+ * nullptr if the result requires the full computation.
+ *
+ * @see has_trivial_all_null_result
+ *
+ * @param values Values column, every row of which is null
+ * @param agg Aggregation to produce the result for
+ * @param num_groups Number of result rows
+ */
+inline std::unique_ptr<column> all_null_values_result(column_view const& values,
+                                                      aggregation const& agg,
+                                                      size_type num_groups,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  if (not has_trivial_all_null_result(agg)) { return nullptr; }
+
+  if (agg.kind == aggregation::COUNT_VALID or agg.kind == aggregation::NUNIQUE) {
+    auto const zero = make_fixed_width_scalar<size_type>(0, stream);
+    return make_column_from_scalar(*zero, num_groups, stream, mr);
+  }
+
+  auto const output_type = cudf::detail::target_type(values.type(), agg.kind);
+  // let the full path report unsupported type/aggregation combinations
+  if (output_type.id() == type_id::EMPTY) { return nullptr; }
+  auto const null_value = make_default_constructed_scalar(output_type, stream);
+  return make_column_from_scalar(*null_value, num_groups, stream, mr);
+}
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
@@ -14,33 +14,53 @@
  * limitations under the License.
  */
 
+#include <groupby/memoization.hpp>
+
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/group_replace_nulls.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/partitioning.hpp>
 #include <cudf/strings/string_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/tdigest/tdigest_column_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
 #include <thrust/copy.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
 
 #include <memory>
+#include <numeric>
+#include <sstream>
 #include <utility>
 
 namespace cudf {
@@ -178,13 +198,107 @@ void verify_valid_requests(host_span<RequestType const> requests)
     "Invalid type/aggregation combination.");
 }
 
+/// Returns true if `k` can be split into a partial and a merge phase
+bool is_mergeable_aggregation(aggregation::Kind k)
+{
+  switch (k) {
+    case aggregation::SUM:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::MEAN:
+    case aggregation::M2:
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+    case aggregation::MEDIAN:
+    case aggregation::QUANTILE: return true;
+    default: return false;
+  }
+}
+
+/// Verifies all aggs in the requests support partial aggregation
+void verify_mergeable_requests(host_span<aggregation_request const> requests)
+{
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [](auto const& request) {
+                  return std::all_of(
+                    request.aggregations.begin(),
+                    request.aggregations.end(),
+                    [](auto const& agg) { return is_mergeable_aggregation(agg->kind); });
+                }),
+    "Aggregation kind does not support partial aggregation.");
+}
+
+/// Computes the per-group variance from a MERGE_M2 result, i.e. a
+/// STRUCT<count, mean, m2> column. Groups with `count <= ddof` are null.
+std::unique_ptr<column> variance_from_merged_m2(column_view const& merged_m2,
+                                                size_type ddof,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  auto const num_groups = merged_m2.size();
+  auto const counts     = merged_m2.child(0);
+  auto const d_m2s      = column_device_view::create(merged_m2.child(2), stream);
+
+  auto result = make_numeric_column(
+    data_type(type_id::FLOAT64), num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto validities = rmm::device_uvector<int8_t>(num_groups, stream);
+
+  auto const out_iter = thrust::make_zip_iterator(
+    thrust::make_tuple(result->mutable_view().begin<double>(), validities.begin()));
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_groups),
+                    out_iter,
+                    [counts = counts.begin<size_type>(), m2s = *d_m2s, ddof] __device__(
+                      size_type group_index) {
+                      auto const is_valid =
+                        m2s.is_valid(group_index) and counts[group_index] > ddof;
+                      auto const variance =
+                        is_valid ? m2s.element<double>(group_index) / (counts[group_index] - ddof)
+                                 : 0.0;
+                      return thrust::make_tuple(variance, static_cast<int8_t>(is_valid));
+                    });
+
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    validities.begin(), validities.end(), thrust::identity<int8_t>{}, stream, mr);
+  if (null_count > 0) { result->set_null_mask(std::move(null_mask), null_count); }
+  return result;
+}
+
+/// Evaluates the requested percentiles on a MERGE_TDIGEST result and flattens
+/// the per-group percentile lists into one column, matching the row layout of
+/// the single-pass QUANTILE/MEDIAN results.
+std::unique_ptr<column> percentiles_from_merged_tdigest(column_view const& merged_tdigest,
+                                                        std::vector<double> const& percentiles,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  auto const d_percentiles = cudf::detail::make_device_uvector_async(percentiles, stream);
+  auto const percentiles_view = column_view(data_type(type_id::FLOAT64),
+                                            static_cast<size_type>(percentiles.size()),
+                                            d_percentiles.data());
+
+  auto result = cudf::detail::percentile_approx(
+    tdigest::tdigest_column_view{merged_tdigest}, percentiles_view, stream, mr);
+
+  // Every group produces `percentiles.size()` values, so the lists child is
+  // already the flattened result
+  return std::move(result->release().children[lists_column_view::child_column_index]);
+}
+
 }  // namespace
 
 // Compute aggregation requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
-  host_span<aggregation_request const> requests, rmm::mr::device_memory_resource* mr)
+  host_span<aggregation_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys.num_rows());
   CUDF_EXPECTS(
     std::all_of(requests.begin(),
                 requests.end(),
@@ -195,14 +309,266 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
 
   if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
 
-  return dispatch_aggregation(requests, rmm::cuda_stream_default, mr);
+  if (memoization::detail::is_immutable(_keys)) {
+    // keys are registered immutable: cache completed results keyed by the table identity,
+    // the groupby options and the aggregation set
+    std::ostringstream oss;
+    oss << memoization::detail::table_identity(_keys)
+        << "|a:" << static_cast<int>(_include_null_keys) << ':'
+        << static_cast<int>(_keys_are_sorted);
+    for (auto const o : _column_order) {
+      oss << ':' << static_cast<int>(o);
+    }
+    for (auto const o : _null_precedence) {
+      oss << ':' << static_cast<int>(o);
+    }
+    for (auto const& request : requests) {
+      oss << '#' << memoization::detail::table_identity(table_view{{request.values}});
+      for (auto const& agg : request.aggregations) {
+        oss << ':' << static_cast<int>(agg->kind) << ':' << agg->do_hash();
+      }
+    }
+    auto const key = oss.str();
+
+    if (auto cached = memoization::detail::find_result(key, stream, mr)) {
+      return std::move(*cached);
+    }
+    auto result = dispatch_aggregation(requests, stream, mr);
+    memoization::detail::store_result(key, result, stream);
+    return result;
+  }
+
+  return dispatch_aggregation(requests, stream, mr);
+}
+
+// Compute partial aggregation states for later merging
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::partial_aggregate(
+  host_span<aggregation_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys.num_rows());
+  verify_mergeable_requests(requests);
+
+  // Expand each aggregation into the simple aggregations whose results make
+  // up its mergeable state
+  std::vector<aggregation_request> partial_requests;
+  for (auto const& request : requests) {
+    aggregation_request partial_request;
+    partial_request.values = request.values;
+    for (auto const& agg : request.aggregations) {
+      switch (agg->kind) {
+        case aggregation::SUM:
+          partial_request.aggregations.push_back(make_sum_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::MIN:
+          partial_request.aggregations.push_back(make_min_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::MAX:
+          partial_request.aggregations.push_back(make_max_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::COUNT_VALID:
+        case aggregation::COUNT_ALL:
+          partial_request.aggregations.push_back(make_count_aggregation<groupby_aggregation>(
+            agg->kind == aggregation::COUNT_ALL ? null_policy::INCLUDE : null_policy::EXCLUDE));
+          break;
+        case aggregation::MEAN:
+          partial_request.aggregations.push_back(make_sum_aggregation<groupby_aggregation>());
+          partial_request.aggregations.push_back(make_count_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::M2:
+        case aggregation::VARIANCE:
+        case aggregation::STD:
+          partial_request.aggregations.push_back(make_count_aggregation<groupby_aggregation>());
+          partial_request.aggregations.push_back(make_mean_aggregation<groupby_aggregation>());
+          partial_request.aggregations.push_back(make_m2_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::MEDIAN:
+        case aggregation::QUANTILE:
+          partial_request.aggregations.push_back(make_tdigest_aggregation<groupby_aggregation>());
+          break;
+        default: CUDF_FAIL("Aggregation kind does not support partial aggregation.");
+      }
+    }
+    partial_requests.push_back(std::move(partial_request));
+  }
+
+  auto [unique_keys, partial_results] = aggregate(partial_requests, mr);
+
+  // Reassemble the simple results into one state column per aggregation,
+  // packing multi-part states into structs
+  std::vector<aggregation_result> results;
+  for (size_t i = 0; i < requests.size(); ++i) {
+    auto& partials = partial_results[i].results;
+    std::vector<std::unique_ptr<column>> states;
+    size_t pos = 0;
+
+    auto pack_struct = [&](size_type num_children) {
+      std::vector<std::unique_ptr<column>> children;
+      for (size_type c = 0; c < num_children; ++c) {
+        children.push_back(std::move(partials[pos++]));
+      }
+      auto const num_rows = children.front()->size();
+      return make_structs_column(
+        num_rows, std::move(children), 0, rmm::device_buffer{}, stream, mr);
+    };
+
+    for (auto const& agg : requests[i].aggregations) {
+      switch (agg->kind) {
+        case aggregation::MEAN: states.push_back(pack_struct(2)); break;
+        case aggregation::M2:
+        case aggregation::VARIANCE:
+        case aggregation::STD: states.push_back(pack_struct(3)); break;
+        default: states.push_back(std::move(partials[pos++]));
+      }
+    }
+    results.push_back(aggregation_result{std::move(states)});
+  }
+
+  return std::make_pair(std::move(unique_keys), std::move(results));
+}
+
+// Merge partial aggregation states into final results
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::merge_aggregate(
+  host_span<aggregation_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys.num_rows());
+  verify_mergeable_requests(requests);
+
+  // One merge request per state column; MEAN merges each struct child
+  // separately because requests hold a single values column
+  std::vector<aggregation_request> merge_requests;
+  auto const add_merge_request = [&](column_view const& values,
+                                     std::unique_ptr<groupby_aggregation> merge_agg) {
+    aggregation_request merge_request;
+    merge_request.values = values;
+    merge_request.aggregations.push_back(std::move(merge_agg));
+    merge_requests.push_back(std::move(merge_request));
+  };
+
+  for (auto const& request : requests) {
+    for (auto const& agg : request.aggregations) {
+      switch (agg->kind) {
+        case aggregation::SUM:
+        case aggregation::COUNT_VALID:
+        case aggregation::COUNT_ALL:
+          add_merge_request(request.values, make_sum_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::MIN:
+          add_merge_request(request.values, make_min_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::MAX:
+          add_merge_request(request.values, make_max_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::MEAN:
+          CUDF_EXPECTS(request.values.type().id() == type_id::STRUCT and
+                         request.values.num_children() == 2,
+                       "MEAN merge input must be the STRUCT<sum, count> state column "
+                       "produced by partial_aggregate.");
+          add_merge_request(request.values.child(0), make_sum_aggregation<groupby_aggregation>());
+          add_merge_request(request.values.child(1), make_sum_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::M2:
+        case aggregation::VARIANCE:
+        case aggregation::STD:
+          add_merge_request(request.values, make_merge_m2_aggregation<groupby_aggregation>());
+          break;
+        case aggregation::MEDIAN:
+        case aggregation::QUANTILE:
+          add_merge_request(request.values, make_merge_tdigest_aggregation<groupby_aggregation>());
+          break;
+        default: CUDF_FAIL("Aggregation kind does not support partial aggregation.");
+      }
+    }
+  }
+
+  auto [unique_keys, merge_results] = aggregate(merge_requests, mr);
+
+  // Finalize each aggregation from its merged state
+  std::vector<aggregation_result> results;
+  size_t pos = 0;
+  auto next_result = [&] { return std::move(merge_results[pos++].results.front()); };
+
+  for (auto const& request : requests) {
+    std::vector<std::unique_ptr<column>> finalized;
+    for (auto const& agg : request.aggregations) {
+      switch (agg->kind) {
+        case aggregation::SUM:
+        case aggregation::MIN:
+        case aggregation::MAX: finalized.push_back(next_result()); break;
+        case aggregation::COUNT_VALID:
+        case aggregation::COUNT_ALL: {
+          auto const merged_counts = next_result();
+          finalized.push_back(cudf::detail::cast(
+            merged_counts->view(), data_type(type_to_id<size_type>()), stream, mr));
+          break;
+        }
+        case aggregation::MEAN: {
+          auto const merged_sums   = next_result();
+          auto const merged_counts = next_result();
+          finalized.push_back(
+            cudf::detail::binary_operation(merged_sums->view(),
+                                           merged_counts->view(),
+                                           binary_operator::DIV,
+                                           cudf::detail::target_type(merged_sums->type(),
+                                                                     aggregation::MEAN),
+                                           stream,
+                                           mr));
+          break;
+        }
+        case aggregation::M2: {
+          auto merged_m2 = next_result();
+          finalized.push_back(std::move(merged_m2->release().children[2]));
+          break;
+        }
+        case aggregation::VARIANCE: {
+          auto const merged_m2 = next_result();
+          auto const& var_agg  = dynamic_cast<cudf::detail::std_var_aggregation const&>(*agg);
+          finalized.push_back(
+            variance_from_merged_m2(merged_m2->view(), var_agg._ddof, stream, mr));
+          break;
+        }
+        case aggregation::STD: {
+          auto const merged_m2 = next_result();
+          auto const& std_agg  = dynamic_cast<cudf::detail::std_var_aggregation const&>(*agg);
+          auto const variance =
+            variance_from_merged_m2(merged_m2->view(), std_agg._ddof, stream, mr);
+          finalized.push_back(
+            cudf::detail::unary_operation(variance->view(), unary_operator::SQRT, stream, mr));
+          break;
+        }
+        case aggregation::MEDIAN: {
+          auto const merged_tdigest = next_result();
+          finalized.push_back(
+            percentiles_from_merged_tdigest(merged_tdigest->view(), {0.5}, stream, mr));
+          break;
+        }
+        case aggregation::QUANTILE: {
+          auto const merged_tdigest = next_result();
+          auto const& quantile_agg =
+            dynamic_cast<cudf::detail::quantile_aggregation const&>(*agg);
+          finalized.push_back(percentiles_from_merged_tdigest(
+            merged_tdigest->view(), quantile_agg._quantiles, stream, mr));
+          break;
+        }
+        default: CUDF_FAIL("Aggregation kind does not support partial aggregation.");
+      }
+    }
+    results.push_back(aggregation_result{std::move(finalized)});
+  }
+
+  return std::make_pair(std::move(unique_keys), std::move(results));
 }
 
 // Compute scan requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan(
-  host_span<scan_request const> requests, rmm::mr::device_memory_resource* mr)
+  host_span<scan_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys.num_rows());
   CUDF_EXPECTS(
     std::all_of(requests.begin(),
                 requests.end(),
@@ -213,15 +579,17 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan
 
   if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
 
-  return sort_scan(requests, rmm::cuda_stream_default, mr);
+  return sort_scan(requests, stream, mr);
 }
 
-groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource* mr)
+groupby::groups groupby::get_groups(table_view values,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  auto grouped_keys = helper().sorted_keys(rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys.num_rows());
+  auto grouped_keys = helper().sorted_keys(stream, mr);
 
-  auto const& group_offsets = helper().group_offsets(rmm::cuda_stream_default);
+  auto const& group_offsets = helper().group_offsets(stream);
   std::vector<size_type> group_offsets_vector(group_offsets.size());
   thrust::copy(thrust::device_pointer_cast(group_offsets.begin()),
                thrust::device_pointer_cast(group_offsets.end()),
@@ -229,10 +597,10 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
 
   if (values.num_columns()) {
     auto grouped_values = cudf::detail::gather(values,
-                                               helper().key_sort_order(rmm::cuda_stream_default),
+                                               helper().key_sort_order(stream),
                                                cudf::out_of_bounds_policy::DONT_CHECK,
                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                               rmm::cuda_stream_default,
+                                               stream,
                                                mr);
     return groupby::groups{
       std::move(grouped_keys), std::move(group_offsets_vector), std::move(grouped_values)};
@@ -244,16 +612,16 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
 std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::replace_nulls(
   table_view const& values,
   host_span<cudf::replace_policy const> replace_policies,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys.num_rows());
   CUDF_EXPECTS(_keys.num_rows() == values.num_rows(),
                "Size mismatch between group labels and value.");
   CUDF_EXPECTS(static_cast<cudf::size_type>(replace_policies.size()) == values.num_columns(),
                "Size mismatch between num_columns and replace_policies.");
 
   if (values.is_empty()) { return std::make_pair(empty_like(_keys), empty_like(values)); }
-  auto const stream = rmm::cuda_stream_default;
 
   auto const& group_labels = helper().group_labels(stream);
   std::vector<std::unique_ptr<column>> results;
@@ -275,11 +643,118 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::replace_nulls
                         std::make_unique<table>(std::move(results)));
 }
 
+// Aggregate one hash partition at a time to bound peak device memory
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> external_aggregate(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  size_type num_partitions,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(keys.num_rows());
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive.");
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [&keys](auto const& request) { return request.values.size() == keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  auto const stream = rmm::cuda_stream_default;
+
+  auto const clone_request = [](aggregation_request const& request, column_view const& values) {
+    aggregation_request cloned;
+    cloned.values = values;
+    for (auto const& agg : request.aggregations) {
+      auto copy = agg->clone();
+      cloned.aggregations.emplace_back(dynamic_cast<groupby_aggregation*>(copy.release()));
+    }
+    return cloned;
+  };
+
+  // Shuffle the keys and every values column together so rows stay aligned,
+  // packing each partition into its own contiguous buffer
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  for (auto const& request : requests) {
+    columns.push_back(request.values);
+  }
+  std::vector<size_type> columns_to_hash(keys.num_columns());
+  std::iota(columns_to_hash.begin(), columns_to_hash.end(), 0);
+  auto partitions = hash_partition_and_pack(table_view{columns}, columns_to_hash, num_partitions);
+
+  // hash_partition_and_pack returns no partitions for empty inputs
+  if (partitions.empty()) { return groupby(keys, null_handling).aggregate(requests, stream, mr); }
+
+  std::vector<std::unique_ptr<table>> chunk_keys;
+  std::vector<std::vector<aggregation_result>> chunk_results;
+  for (auto& partition : partitions) {
+    auto const chunk = partition.table;
+    if (chunk.num_rows() == 0) {
+      partition.data = packed_columns{};
+      continue;
+    }
+    std::vector<column_view> chunk_key_columns;
+    for (size_type i = 0; i < keys.num_columns(); ++i) {
+      chunk_key_columns.push_back(chunk.column(i));
+    }
+    std::vector<aggregation_request> chunk_requests;
+    for (size_t i = 0; i < requests.size(); ++i) {
+      chunk_requests.push_back(clone_request(requests[i], chunk.column(keys.num_columns() + i)));
+    }
+    groupby chunk_groupby(table_view{chunk_key_columns}, null_handling);
+    auto [unique_keys, results] = chunk_groupby.aggregate(chunk_requests, stream, mr);
+    chunk_keys.push_back(std::move(unique_keys));
+    chunk_results.push_back(std::move(results));
+    // Results live in their own allocations; drop the chunk's packed buffer now
+    // so only one chunk's rows and grouping intermediates are resident at a time
+    partition.data = packed_columns{};
+  }
+
+  // Every key hashes into exactly one chunk, so the per-chunk results only need
+  // to be concatenated — no merge step
+  std::vector<table_view> key_views;
+  key_views.reserve(chunk_keys.size());
+  std::transform(chunk_keys.begin(),
+                 chunk_keys.end(),
+                 std::back_inserter(key_views),
+                 [](auto const& chunk) { return chunk->view(); });
+  auto unique_keys = cudf::detail::concatenate(key_views, stream, mr);
+
+  std::vector<aggregation_result> results;
+  for (size_t i = 0; i < requests.size(); ++i) {
+    std::vector<std::unique_ptr<column>> columns_out;
+    for (size_t agg = 0; agg < chunk_results.front()[i].results.size(); ++agg) {
+      std::vector<column_view> agg_views;
+      agg_views.reserve(chunk_results.size());
+      std::transform(chunk_results.begin(),
+                     chunk_results.end(),
+                     std::back_inserter(agg_views),
+                     [&](auto const& chunk) { return chunk[i].results[agg]->view(); });
+      columns_out.push_back(cudf::detail::concatenate(agg_views, stream, mr));
+    }
+    results.push_back(aggregation_result{std::move(columns_out)});
+  }
+
+  return std::make_pair(std::move(unique_keys), std::move(results));
+}
+
 // Get the sort helper object
 detail::sort::sort_groupby_helper& groupby::helper()
 {
   if (_helper) return *_helper;
-  _helper = std::make_unique<detail::sort::sort_groupby_helper>(
+  if (memoization::detail::is_immutable(_keys)) {
+    std::ostringstream oss;
+    oss << memoization::detail::table_identity(_keys) << "|h:"
+        << static_cast<int>(_include_null_keys) << ':' << static_cast<int>(_keys_are_sorted);
+    auto const key = oss.str();
+    _helper        = memoization::detail::find_helper(key);
+    if (!_helper) {
+      _helper = std::make_shared<detail::sort::sort_groupby_helper>(
+        _keys, _include_null_keys, _keys_are_sorted);
+      memoization::detail::store_helper(key, _helper);
+    }
+    return *_helper;
+  }
+  _helper = std::make_shared<detail::sort::sort_groupby_helper>(
     _keys, _include_null_keys, _keys_are_sorted);
   return *_helper;
 };
@@ -288,9 +763,10 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::shift(
   table_view const& values,
   host_span<size_type const> offsets,
   std::vector<std::reference_wrapper<const scalar>> const& fill_values,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(_keys.num_rows());
   CUDF_EXPECTS(values.num_columns() == static_cast<size_type>(fill_values.size()),
                "Mismatch number of fill_values and columns.");
   CUDF_EXPECTS(
@@ -299,7 +775,6 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::shift(
                 [&](auto i) { return values.column(i).type() == fill_values[i].get().type(); }),
     "values and fill_value should have the same type.");
 
-  auto stream = rmm::cuda_stream_default;
   std::vector<std::unique_ptr<column>> results;
   auto const& group_offsets = helper().group_offsets(stream);
   std::transform(
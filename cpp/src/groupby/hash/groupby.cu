@@ -33,6 +33,7 @@
 #include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
@@ -43,11 +44,17 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 #include <hash/concurrent_unordered_map.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/unique.h>
+
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <utility>
 
@@ -347,8 +354,15 @@ flatten_single_pass_aggs(host_span<aggregation_request const> requests)
   for (auto const& request : requests) {
     auto const& agg_v = request.aggregations;
 
+    // entirely-null values columns have trivial results for null-excluding
+    // aggregations; keep them out of the single-pass kernel so it never reads
+    // them (sparse_to_dense_results stores their results directly)
+    auto const values_all_null =
+      request.values.size() > 0 and request.values.null_count() == request.values.size();
+
     std::unordered_set<aggregation::Kind> agg_kinds_set;
     auto insert_agg = [&](column_view const& request_values, std::unique_ptr<aggregation>&& agg) {
+      if (values_all_null and has_trivial_all_null_result(*agg)) { return; }
       if (agg_kinds_set.insert(agg->kind).second) {
         agg_kinds.push_back(agg->kind);
         aggs.push_back(std::move(agg));
@@ -399,11 +413,22 @@ void sparse_to_dense_results(table_view const& keys,
     auto const& agg_v = request.aggregations;
     auto const& col   = request.values;
 
+    auto const values_all_null = col.size() > 0 and col.null_count() == col.size();
+
     // Given an aggregation, this will get the result from sparse_results and
     // convert and return dense, compacted result
     auto finalizer = hash_compound_agg_finalizer<Map>(
       col, sparse_results, dense_results, gather_map, map, row_bitmask_ptr, stream, mr);
     for (auto&& agg : agg_v) {
+      // aggregations excluded from the single-pass kernel for entirely-null
+      // columns have no sparse result; store their trivial result directly
+      if (values_all_null and not dense_results->has_result(col, *agg)) {
+        if (auto result = all_null_values_result(
+              col, *agg, static_cast<size_type>(gather_map.size()), stream, mr)) {
+          dense_results->add_result(col, *agg, std::move(result));
+          continue;
+        }
+      }
       agg->finalize(finalizer);
     }
   }
@@ -475,6 +500,88 @@ auto create_sparse_results_table(table_view const& flattened_values,
   return sparse_table;
 }
 
+// Tuning knobs for the shared memory pre-aggregation pass
+constexpr size_type shmem_prepass_block_size = 256;
+// Number of leading rows hashed to estimate the group cardinality
+constexpr size_type shmem_prepass_sample_size = 8192;
+// Shared memory budget per block; leaves headroom below the 48KB static limit
+constexpr std::size_t shmem_prepass_budget = 44 * 1024;
+// Cap on the grid size so each block aggregates many rows before its one
+// flush of the shared table into the global sparse table
+constexpr size_type shmem_prepass_max_blocks = 4096;
+
+struct shmem_prepass_plan {
+  size_type capacity;  ///< Number of slots in each block's shared table
+  std::vector<size_type> accumulator_offsets;  ///< Byte offset of each column's accumulators
+  std::size_t shared_memory_size;              ///< Total shared memory per block
+};
+
+/**
+ * @brief Determines whether the shared memory pre-aggregation pass supports
+ * this set of aggregations and lays out the per-block shared memory if so.
+ *
+ * The pass is limited to SUM/MIN/MAX/COUNT over numeric columns without nulls:
+ * these need no validity updates and have arithmetic accumulators that fit in
+ * shared memory. Picks the largest power-of-two slot count whose keys and
+ * accumulators fit in the budget.
+ */
+std::optional<shmem_prepass_plan> make_shmem_prepass_plan(
+  table_view const& flattened_values,
+  std::vector<aggregation::Kind> const& agg_kinds,
+  table const& sparse_table)
+{
+  auto const supported_kind = [](aggregation::Kind k) {
+    return k == aggregation::SUM or k == aggregation::MIN or k == aggregation::MAX or
+           k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL;
+  };
+  if (not std::all_of(agg_kinds.begin(), agg_kinds.end(), supported_kind)) { return std::nullopt; }
+  if (not std::all_of(flattened_values.begin(), flattened_values.end(), [](auto const& col) {
+        return cudf::is_numeric(col.type()) and not col.has_nulls();
+      })) {
+    return std::nullopt;
+  }
+
+  for (size_type capacity = 1024; capacity >= 128; capacity /= 2) {
+    shmem_prepass_plan plan{capacity, {}, 0};
+    auto const align8 = [](std::size_t n) { return (n + 7) & ~std::size_t{7}; };
+    std::size_t offset = align8(capacity * sizeof(size_type));  // key slots come first
+    for (auto const& col : sparse_table.view()) {
+      plan.accumulator_offsets.push_back(static_cast<size_type>(offset));
+      offset = align8(offset + capacity * cudf::size_of(col.type()));
+    }
+    if (offset <= shmem_prepass_budget) {
+      plan.shared_memory_size = offset;
+      return plan;
+    }
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Estimates the number of groups by counting distinct row hashes over a
+ * prefix sample of the keys.
+ *
+ * A prefix sample can underestimate the true cardinality; that only costs
+ * performance, not correctness, since the pre-aggregation kernel falls back to
+ * global memory for groups that do not fit in its shared table.
+ */
+template <bool keys_have_nulls>
+size_type estimate_cardinality(table_device_view const& d_keys,
+                               size_type num_rows,
+                               rmm::cuda_stream_view stream)
+{
+  auto const sample_size = std::min(num_rows, shmem_prepass_sample_size);
+  rmm::device_uvector<hash_value_type> hashes(sample_size, stream);
+  row_hasher<default_hash, keys_have_nulls> hasher{d_keys};
+  thrust::tabulate(rmm::exec_policy(stream),
+                   hashes.begin(),
+                   hashes.end(),
+                   [hasher] __device__(size_type i) { return hasher(i); });
+  thrust::sort(rmm::exec_policy(stream), hashes.begin(), hashes.end());
+  auto const distinct_end = thrust::unique(rmm::exec_policy(stream), hashes.begin(), hashes.end());
+  return static_cast<size_type>(thrust::distance(hashes.begin(), distinct_end));
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
@@ -503,17 +610,52 @@ void compute_single_pass_aggs(table_view const& keys,
 
   auto row_bitmask =
     skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream).first : rmm::device_buffer{};
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    keys.num_rows(),
-    hash::compute_single_pass_aggs_fn<Map>{map,
-                                           keys.num_rows(),
-                                           *d_values,
-                                           *d_sparse_table,
-                                           d_aggs.data(),
-                                           static_cast<bitmask_type*>(row_bitmask.data()),
-                                           skip_key_rows_with_nulls});
+
+  // For low-cardinality groupbys, pre-aggregate in per-block shared memory
+  // tables and merge them into the global sparse table once per block instead
+  // of issuing one global atomic update per input row.
+  auto const prepass_plan = make_shmem_prepass_plan(flattened_values, agg_kinds, sparse_table);
+  auto const use_shmem_prepass = [&] {
+    if (not prepass_plan) { return false; }
+    auto d_keys_ptr = table_device_view::create(keys, stream);
+    auto const estimated_groups =
+      estimate_cardinality<keys_have_nulls>(*d_keys_ptr, keys.num_rows(), stream);
+    // Keep the shared tables at most half full so probe sequences stay short
+    return estimated_groups * 2 <= prepass_plan->capacity;
+  }();
+
+  if (use_shmem_prepass) {
+    auto const d_offsets =
+      cudf::detail::make_device_uvector_async(prepass_plan->accumulator_offsets, stream);
+    auto const num_blocks = std::min(
+      shmem_prepass_max_blocks,
+      cudf::util::div_rounding_up_safe(keys.num_rows(), shmem_prepass_block_size));
+    hash::compute_single_pass_shmem_aggs<<<num_blocks,
+                                           shmem_prepass_block_size,
+                                           prepass_plan->shared_memory_size,
+                                           stream.value()>>>(
+      map,
+      keys.num_rows(),
+      *d_values,
+      *d_sparse_table,
+      d_aggs.data(),
+      static_cast<bitmask_type*>(row_bitmask.data()),
+      skip_key_rows_with_nulls,
+      prepass_plan->capacity,
+      d_offsets.data());
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      keys.num_rows(),
+      hash::compute_single_pass_aggs_fn<Map>{map,
+                                             keys.num_rows(),
+                                             *d_values,
+                                             *d_sparse_table,
+                                             d_aggs.data(),
+                                             static_cast<bitmask_type*>(row_bitmask.data()),
+                                             skip_key_rows_with_nulls});
+  }
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
   for (size_t i = 0; i < aggs.size(); i++) {
@@ -18,7 +18,11 @@
 
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/groupby.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/utilities/bit.hpp>
 #include "multi_pass_kernels.cuh"
 
@@ -115,6 +119,255 @@ struct compute_single_pass_aggs_fn {
   }
 };
 
+/// Sentinel marking an unoccupied slot in the per-block shared memory table
+constexpr size_type SHMEM_EMPTY_KEY{-1};
+
+/**
+ * @brief Initializes a column's shared memory accumulators with the
+ * aggregation identity.
+ *
+ * Dispatched on the sparse output column's (target) type; only arithmetic
+ * targets are ever reached because the shared memory pre-pass is restricted to
+ * SUM/MIN/MAX/COUNT over numeric columns.
+ */
+struct shmem_identity_initializer {
+  template <typename Target, std::enable_if_t<std::is_arithmetic<Target>::value>* = nullptr>
+  __device__ void operator()(int8_t* accumulator, size_type capacity, aggregation::Kind k) const
+  {
+    auto* typed = reinterpret_cast<Target*>(accumulator);
+    for (size_type i = threadIdx.x; i < capacity; i += blockDim.x) {
+      switch (k) {
+        case aggregation::MIN: typed[i] = DeviceMin::identity<Target>(); break;
+        case aggregation::MAX: typed[i] = DeviceMax::identity<Target>(); break;
+        default: typed[i] = DeviceSum::identity<Target>(); break;
+      }
+    }
+  }
+
+  template <typename Target, std::enable_if_t<not std::is_arithmetic<Target>::value>* = nullptr>
+  __device__ void operator()(int8_t*, size_type, aggregation::Kind) const
+  {
+  }
+};
+
+/**
+ * @brief Aggregates one source element into a column's shared memory
+ * accumulator slot.
+ *
+ * Dispatched on the source column's type.
+ */
+struct shmem_element_aggregator {
+  template <typename Source,
+            std::enable_if_t<std::is_arithmetic<Source>::value>* = nullptr>
+  __device__ void operator()(int8_t* accumulator,
+                             size_type slot,
+                             column_device_view const& source,
+                             size_type source_index,
+                             aggregation::Kind k) const
+  {
+    switch (k) {
+      case aggregation::SUM: {
+        using Target = cudf::detail::target_type_t<Source, aggregation::SUM>;
+        cudf::genericAtomicOperation(reinterpret_cast<Target*>(accumulator) + slot,
+                                     static_cast<Target>(source.element<Source>(source_index)),
+                                     DeviceSum{});
+        break;
+      }
+      case aggregation::MIN: {
+        using Target = cudf::detail::target_type_t<Source, aggregation::MIN>;
+        cudf::genericAtomicOperation(reinterpret_cast<Target*>(accumulator) + slot,
+                                     static_cast<Target>(source.element<Source>(source_index)),
+                                     DeviceMin{});
+        break;
+      }
+      case aggregation::MAX: {
+        using Target = cudf::detail::target_type_t<Source, aggregation::MAX>;
+        cudf::genericAtomicOperation(reinterpret_cast<Target*>(accumulator) + slot,
+                                     static_cast<Target>(source.element<Source>(source_index)),
+                                     DeviceMax{});
+        break;
+      }
+      // The pre-pass only runs when the source columns have no nulls, so
+      // COUNT_VALID and COUNT_ALL are equivalent.
+      case aggregation::COUNT_VALID:
+      case aggregation::COUNT_ALL: {
+        cudf::genericAtomicOperation(
+          reinterpret_cast<size_type*>(accumulator) + slot, size_type{1}, DeviceSum{});
+        break;
+      }
+      default: break;
+    }
+  }
+
+  template <typename Source,
+            std::enable_if_t<not std::is_arithmetic<Source>::value>* = nullptr>
+  __device__ void operator()(
+    int8_t*, size_type, column_device_view const&, size_type, aggregation::Kind) const
+  {
+  }
+};
+
+/**
+ * @brief Merges one shared memory accumulator slot into the global sparse
+ * output column.
+ *
+ * Dispatched on the source column's type so the accumulator (target) type
+ * matches the one used by `shmem_element_aggregator`.
+ */
+struct shmem_result_combiner {
+  template <typename Source,
+            std::enable_if_t<std::is_arithmetic<Source>::value>* = nullptr>
+  __device__ void operator()(int8_t const* accumulator,
+                             size_type slot,
+                             mutable_column_device_view target,
+                             size_type target_index,
+                             aggregation::Kind k) const
+  {
+    switch (k) {
+      case aggregation::SUM: {
+        using Target = cudf::detail::target_type_t<Source, aggregation::SUM>;
+        cudf::genericAtomicOperation(&target.element<Target>(target_index),
+                                     reinterpret_cast<Target const*>(accumulator)[slot],
+                                     DeviceSum{});
+        break;
+      }
+      case aggregation::MIN: {
+        using Target = cudf::detail::target_type_t<Source, aggregation::MIN>;
+        cudf::genericAtomicOperation(&target.element<Target>(target_index),
+                                     reinterpret_cast<Target const*>(accumulator)[slot],
+                                     DeviceMin{});
+        break;
+      }
+      case aggregation::MAX: {
+        using Target = cudf::detail::target_type_t<Source, aggregation::MAX>;
+        cudf::genericAtomicOperation(&target.element<Target>(target_index),
+                                     reinterpret_cast<Target const*>(accumulator)[slot],
+                                     DeviceMax{});
+        break;
+      }
+      case aggregation::COUNT_VALID:
+      case aggregation::COUNT_ALL: {
+        cudf::genericAtomicOperation(&target.element<size_type>(target_index),
+                                     reinterpret_cast<size_type const*>(accumulator)[slot],
+                                     DeviceSum{});
+        break;
+      }
+      default: break;
+    }
+  }
+
+  template <typename Source,
+            std::enable_if_t<not std::is_arithmetic<Source>::value>* = nullptr>
+  __device__ void operator()(
+    int8_t const*, size_type, mutable_column_device_view, size_type, aggregation::Kind) const
+  {
+  }
+};
+
+/**
+ * @brief Two-level variant of `compute_single_pass_aggs_fn` for low-cardinality
+ * groupbys.
+ *
+ * Each block maintains a small open-addressing hash table in shared memory,
+ * keyed by the sparse output row index obtained from the global map, and
+ * pre-aggregates its rows there. The shared tables are merged into the global
+ * sparse table once per block at the end, so the number of global atomic
+ * updates per column drops from one per row to roughly one per (block, group)
+ * pair. Rows whose group does not fit in the shared table (the cardinality
+ * estimate was too low) fall back to aggregating directly into the sparse
+ * table, which keeps the kernel correct for any cardinality.
+ *
+ * The caller guarantees that all aggregations are SUM/MIN/MAX/COUNT over
+ * numeric columns without nulls; see `shmem_prepass_plan`.
+ *
+ * @tparam Map The type of the hash map
+ */
+template <typename Map>
+__global__ void compute_single_pass_shmem_aggs(Map map,
+                                               size_type num_keys,
+                                               table_device_view input_values,
+                                               mutable_table_device_view output_values,
+                                               aggregation::Kind const* __restrict__ aggs,
+                                               bitmask_type const* __restrict__ row_bitmask,
+                                               bool skip_rows_with_nulls,
+                                               size_type shared_capacity,
+                                               size_type const* __restrict__ accumulator_offsets)
+{
+  extern __shared__ int8_t shared_mem[];
+  auto* const shared_keys = reinterpret_cast<size_type*>(shared_mem);
+
+  for (size_type i = threadIdx.x; i < shared_capacity; i += blockDim.x) {
+    shared_keys[i] = SHMEM_EMPTY_KEY;
+  }
+  for (size_type col = 0; col < output_values.num_columns(); ++col) {
+    cudf::type_dispatcher(output_values.column(col).type(),
+                          shmem_identity_initializer{},
+                          shared_mem + accumulator_offsets[col],
+                          shared_capacity,
+                          aggs[col]);
+  }
+  __syncthreads();
+
+  auto const hasher = cudf::detail::MurmurHash3_32<size_type>{};
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_keys;
+       i += blockDim.x * gridDim.x) {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { continue; }
+
+    auto result             = map.insert(thrust::make_pair(i, i));
+    auto const target_index = result.first->second;
+
+    // Find or insert the group's output row index in the shared table
+    auto slot       = static_cast<size_type>(hasher(target_index) & (shared_capacity - 1));
+    size_type found = SHMEM_EMPTY_KEY;
+    for (size_type probes = 0; probes < shared_capacity; ++probes) {
+      auto const existing = shared_keys[slot];
+      if (existing == target_index) {
+        found = slot;
+        break;
+      }
+      if (existing == SHMEM_EMPTY_KEY) {
+        auto const old = atomicCAS(&shared_keys[slot], SHMEM_EMPTY_KEY, target_index);
+        if (old == SHMEM_EMPTY_KEY or old == target_index) {
+          found = slot;
+          break;
+        }
+      }
+      slot = (slot + 1) & (shared_capacity - 1);
+    }
+
+    if (found != SHMEM_EMPTY_KEY) {
+      for (size_type col = 0; col < input_values.num_columns(); ++col) {
+        cudf::type_dispatcher(input_values.column(col).type(),
+                              shmem_element_aggregator{},
+                              shared_mem + accumulator_offsets[col],
+                              found,
+                              input_values.column(col),
+                              i,
+                              aggs[col]);
+      }
+    } else {
+      // Shared table is full: aggregate this row directly into global memory
+      cudf::detail::aggregate_row<true, true>(output_values, target_index, input_values, i, aggs);
+    }
+  }
+  __syncthreads();
+
+  // Merge this block's pre-aggregated results into the global sparse table
+  for (size_type slot = threadIdx.x; slot < shared_capacity; slot += blockDim.x) {
+    auto const target_index = shared_keys[slot];
+    if (target_index == SHMEM_EMPTY_KEY) { continue; }
+    for (size_type col = 0; col < input_values.num_columns(); ++col) {
+      cudf::type_dispatcher(input_values.column(col).type(),
+                            shmem_result_combiner{},
+                            shared_mem + accumulator_offsets[col],
+                            slot,
+                            output_values.column(col),
+                            target_index,
+                            aggs[col]);
+    }
+  }
+}
+
 }  // namespace hash
 }  // namespace detail
 }  // namespace groupby
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/memoization.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace cudf {
+namespace groupby {
+namespace memoization {
+namespace {
+
+using helper_ptr = std::shared_ptr<cudf::groupby::detail::sort::sort_groupby_helper>;
+using result_t   = std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>;
+
+struct cached_helper {
+  helper_ptr helper;
+  std::string table_id;  ///< identity of the registered keys, for per-table invalidation
+  uint64_t last_use;
+};
+
+struct cached_result {
+  std::unique_ptr<table> keys;
+  std::vector<aggregation_result> results;
+  std::string table_id;
+  uint64_t last_use;
+};
+
+struct memo_state {
+  std::mutex mutex;
+  std::unordered_set<std::string> immutable_tables;
+  std::unordered_map<std::string, cached_helper> helpers;
+  std::unordered_map<std::string, cached_result> results;
+  std::size_t capacity = 64;
+  uint64_t use_counter = 0;
+};
+
+memo_state& state()
+{
+  static memo_state s;
+  return s;
+}
+
+// Evicts least recently used entries until the map is within capacity.
+template <typename Map>
+void evict_to_capacity(Map& map, std::size_t capacity)
+{
+  while (map.size() > capacity) {
+    auto victim = map.begin();
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      if (it->second.last_use < victim->second.last_use) { victim = it; }
+    }
+    map.erase(victim);
+  }
+}
+
+void serialize_column_identity(std::ostringstream& oss, column_view const& col)
+{
+  oss << col.head<void>() << ':' << col.null_mask() << ':' << col.size() << ':' << col.offset()
+      << ':' << static_cast<int32_t>(col.type().id()) << ';';
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    serialize_column_identity(oss, col.child(i));
+  }
+}
+
+}  // namespace
+
+namespace detail {
+
+std::string table_identity(table_view const& table)
+{
+  std::ostringstream oss;
+  for (auto const& col : table) {
+    serialize_column_identity(oss, col);
+  }
+  return oss.str();
+}
+
+bool is_immutable(table_view const& table)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return s.immutable_tables.count(table_identity(table)) > 0;
+}
+
+helper_ptr find_helper(std::string const& key)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto const it = s.helpers.find(key);
+  if (it == s.helpers.end()) { return nullptr; }
+  it->second.last_use = ++s.use_counter;
+  return it->second.helper;
+}
+
+void store_helper(std::string const& key, helper_ptr helper)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto& entry    = s.helpers[key];
+  entry.helper   = std::move(helper);
+  entry.table_id = key.substr(0, key.find('|'));
+  entry.last_use = ++s.use_counter;
+  evict_to_capacity(s.helpers, s.capacity);
+}
+
+std::unique_ptr<result_t> find_result(std::string const& key,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto const it = s.results.find(key);
+  if (it == s.results.end()) { return nullptr; }
+  it->second.last_use = ++s.use_counter;
+
+  // hand out deep copies; the cached result stays owned by the cache
+  auto copy   = std::make_unique<result_t>();
+  copy->first = std::make_unique<table>(it->second.keys->view(), stream, mr);
+  copy->second.reserve(it->second.results.size());
+  for (auto const& cached : it->second.results) {
+    aggregation_result result;
+    result.results.reserve(cached.results.size());
+    for (auto const& col : cached.results) {
+      result.results.push_back(std::make_unique<column>(col->view(), stream, mr));
+    }
+    copy->second.push_back(std::move(result));
+  }
+  return copy;
+}
+
+void store_result(std::string const& key, result_t const& result, rmm::cuda_stream_view stream)
+{
+  auto& s       = state();
+  auto const mr = rmm::mr::get_current_device_resource();
+
+  // copy outside the lock; only the map insertion needs it
+  auto keys = std::make_unique<table>(result.first->view(), stream, mr);
+  std::vector<aggregation_result> results;
+  results.reserve(result.second.size());
+  for (auto const& res : result.second) {
+    aggregation_result copy;
+    copy.results.reserve(res.results.size());
+    for (auto const& col : res.results) {
+      copy.results.push_back(std::make_unique<column>(col->view(), stream, mr));
+    }
+    results.push_back(std::move(copy));
+  }
+
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto& entry    = s.results[key];
+  entry.keys     = std::move(keys);
+  entry.results  = std::move(results);
+  entry.table_id = key.substr(0, key.find('|'));
+  entry.last_use = ++s.use_counter;
+  evict_to_capacity(s.results, s.capacity);
+}
+
+}  // namespace detail
+
+void register_immutable(table_view const& table)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.immutable_tables.insert(detail::table_identity(table));
+}
+
+void deregister(table_view const& table)
+{
+  auto& s       = state();
+  auto const id = detail::table_identity(table);
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.immutable_tables.erase(id);
+  for (auto it = s.helpers.begin(); it != s.helpers.end();) {
+    it = it->second.table_id == id ? s.helpers.erase(it) : std::next(it);
+  }
+  for (auto it = s.results.begin(); it != s.results.end();) {
+    it = it->second.table_id == id ? s.results.erase(it) : std::next(it);
+  }
+}
+
+void clear()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.immutable_tables.clear();
+  s.helpers.clear();
+  s.results.clear();
+}
+
+void set_capacity(std::size_t max_entries)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.capacity = max_entries;
+  evict_to_capacity(s.helpers, s.capacity);
+  evict_to_capacity(s.results, s.capacity);
+}
+
+}  // namespace memoization
+}  // namespace groupby
+}  // namespace cudf
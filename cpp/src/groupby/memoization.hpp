@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace memoization {
+namespace detail {
+
+/**
+ * @brief Returns whether the table's identity is currently registered immutable.
+ */
+bool is_immutable(table_view const& table);
+
+/**
+ * @brief Serializes the identity of a table: per-column device pointers, sizes, offsets
+ * and types. Used as the leading part of every cache key.
+ */
+std::string table_identity(table_view const& table);
+
+/**
+ * @brief Looks up a cached grouping pre-pass, refreshing its LRU position.
+ *
+ * @return The shared helper, or nullptr on a miss
+ */
+std::shared_ptr<cudf::groupby::detail::sort::sort_groupby_helper> find_helper(
+  std::string const& key);
+
+/**
+ * @brief Stores a grouping pre-pass under the given key, evicting the least recently used
+ * entry beyond capacity.
+ */
+void store_helper(std::string const& key,
+                  std::shared_ptr<cudf::groupby::detail::sort::sort_groupby_helper> helper);
+
+/**
+ * @brief Looks up a cached aggregation result, returning a deep copy on a hit.
+ *
+ * @return The copied result, or no value on a miss
+ */
+std::unique_ptr<std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>> find_result(
+  std::string const& key, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Stores a deep copy of an aggregation result under the given key, evicting the
+ * least recently used entry beyond capacity.
+ */
+void store_result(std::string const& key,
+                  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> const& result,
+                  rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace memoization
+}  // namespace groupby
+}  // namespace cudf
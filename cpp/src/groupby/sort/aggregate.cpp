@@ -359,6 +359,23 @@ void aggregate_result_functor::operator()<aggregation::NUNIQUE>(aggregation cons
   cache.add_result(values, agg, std::move(result));
 };
 
+template <>
+void aggregate_result_functor::operator()<aggregation::APPROX_NUNIQUE>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) return;
+
+  auto& approx_nunique_agg = dynamic_cast<cudf::detail::approx_nunique_aggregation const&>(agg);
+
+  auto result = detail::group_approx_nunique(get_grouped_values(),
+                                             helper.group_labels(stream),
+                                             helper.num_groups(stream),
+                                             approx_nunique_agg._null_handling,
+                                             approx_nunique_agg._precision,
+                                             stream,
+                                             mr);
+  cache.add_result(values, agg, std::move(result));
+};
+
 template <>
 void aggregate_result_functor::operator()<aggregation::NTH_ELEMENT>(aggregation const& agg)
 {
@@ -425,8 +442,12 @@ void aggregate_result_functor::operator()<aggregation::COLLECT_SET>(aggregation
   cache.add_result(
     values,
     agg,
-    lists::detail::drop_list_duplicates(
-      lists_column_view(collect_result->view()), nulls_equal, nans_equal, stream, mr));
+    lists::detail::drop_list_duplicates(lists_column_view(collect_result->view()),
+                                        nulls_equal,
+                                        nans_equal,
+                                        duplicate_keep_option::KEEP_FIRST,
+                                        stream,
+                                        mr));
 };
 
 /**
@@ -496,6 +517,7 @@ void aggregate_result_functor::operator()<aggregation::MERGE_SETS>(aggregation c
                    lists::detail::drop_list_duplicates(lists_column_view(merged_result->view()),
                                                        merge_sets_agg._nulls_equal,
                                                        merge_sets_agg._nans_equal,
+                                                       duplicate_keep_option::KEEP_FIRST,
                                                        stream,
                                                        mr));
 };
@@ -753,6 +775,64 @@ void aggregate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregatio
                                                mr));
 };
 
+/**
+ * @brief Perform a user-defined CUDA aggregation on the values in each group.
+ *
+ * The user-defined function is JIT compiled and applied to the contiguous run of values
+ * belonging to each group, producing one output row per group.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::CUDA>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  cache.add_result(values,
+                   agg,
+                   detail::group_udf(get_grouped_values(),
+                                     helper.group_offsets(stream),
+                                     helper.num_groups(stream),
+                                     agg,
+                                     stream,
+                                     mr));
+};
+
+/**
+ * @brief Perform a user-defined PTX aggregation on the values in each group.
+ *
+ * The UDF type is read from the aggregation itself, so the CUDA implementation applies
+ * unchanged.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::PTX>(aggregation const& agg)
+{
+  operator()<aggregation::CUDA>(agg);
+};
+
+/**
+ * @brief Stores the trivial result for an entirely-null values column, if the
+ * aggregation admits one.
+ *
+ * When the result is trivial the grouped values never need to be materialized
+ * or scanned; only the number of groups is required. @see all_null_values_result
+ *
+ * @return true if a result was stored and the aggregation dispatch can be skipped
+ */
+bool store_all_null_result(column_view const& values,
+                           aggregation const& agg,
+                           sort::sort_groupby_helper& helper,
+                           cudf::detail::result_cache& cache,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  if (values.size() == 0 or values.null_count() != values.size()) { return false; }
+  if (cache.has_result(values, agg)) { return true; }
+
+  auto result = all_null_values_result(values, agg, helper.num_groups(stream), stream, mr);
+  if (not result) { return false; }
+  cache.add_result(values, agg, std::move(result));
+  return true;
+}
+
 }  // namespace detail
 
 // Sort-based groupby
@@ -770,6 +850,11 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
     auto store_functor =
       detail::aggregate_result_functor(request.values, helper(), cache, stream, mr);
     for (auto const& agg : request.aggregations) {
+      // entirely-null value columns (common after outer joins) have trivial
+      // results for null-excluding aggregations; store those without grouping
+      if (detail::store_all_null_result(request.values, *agg, helper(), cache, stream, mr)) {
+        continue;
+      }
       // TODO (dm): single pass compute all supported reductions
       cudf::detail::aggregation_dispatcher(agg->kind, store_functor, *agg);
     }
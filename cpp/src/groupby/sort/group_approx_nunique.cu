@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <limits>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+/**
+ * @brief Estimates the cardinality of one group from its HyperLogLog registers.
+ *
+ * Applies the bias correction from the HyperLogLog paper, falling back to
+ * linear counting for small estimates and correcting for 32-bit hash
+ * collisions for very large ones.
+ */
+struct hll_estimator {
+  int8_t const* registers;  ///< all groups' registers, `num_registers` per group
+  size_type num_registers;  ///< registers per group, a power of two in [16, 2^18]
+
+  __device__ size_type operator()(size_type group_index) const
+  {
+    auto const* reg = registers + static_cast<std::size_t>(group_index) * num_registers;
+
+    double harmonic_sum = 0;
+    size_type zeros     = 0;
+    for (size_type j = 0; j < num_registers; ++j) {
+      harmonic_sum += exp2(-static_cast<double>(reg[j]));
+      zeros += static_cast<size_type>(reg[j] == 0);
+    }
+
+    auto const m       = static_cast<double>(num_registers);
+    auto const alpha_m = num_registers == 16   ? 0.673
+                         : num_registers == 32 ? 0.697
+                         : num_registers == 64 ? 0.709
+                                               : 0.7213 / (1.0 + 1.079 / m);
+
+    constexpr double two_pow_32 = 4294967296.0;
+
+    auto estimate = alpha_m * m * m / harmonic_sum;
+    if (estimate <= 2.5 * m and zeros > 0) {
+      // small-range correction: linear counting on empty registers
+      estimate = m * log(m / static_cast<double>(zeros));
+    } else if (estimate > two_pow_32 / 30.0) {
+      // large-range correction for 32-bit hash collisions
+      estimate = -two_pow_32 * log1p(-estimate / two_pow_32);
+    }
+    return static_cast<size_type>(round(estimate));
+  }
+};
+
+struct approx_nunique_functor {
+  template <typename T>
+  std::enable_if_t<cudf::is_equality_comparable<T, T>(), std::unique_ptr<column>> operator()(
+    column_view const& values,
+    cudf::device_span<size_type const> group_labels,
+    size_type const num_groups,
+    null_policy null_handling,
+    size_type precision,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    auto result = make_numeric_column(
+      data_type(type_to_id<size_type>()), num_groups, mask_state::UNALLOCATED, stream, mr);
+
+    if (num_groups == 0) { return result; }
+
+    auto const num_registers = size_type{1} << precision;
+    rmm::device_uvector<int8_t> registers(
+      static_cast<std::size_t>(num_groups) * num_registers, stream);
+    thrust::uninitialized_fill(
+      rmm::exec_policy(stream), registers.begin(), registers.end(), int8_t{0});
+
+    auto values_view = column_device_view::create(values, stream);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      values.size(),
+      [v             = *values_view,
+       registers     = registers.data(),
+       group_labels  = group_labels.data(),
+       null_handling,
+       precision,
+       num_registers] __device__(size_type i) {
+        if (null_handling == null_policy::EXCLUDE and v.is_null(i)) { return; }
+        // All nulls hash to the same value, so they count as one distinct element
+        auto const hash = v.is_valid(i) ? default_hash<T>{}(v.element<T>(i))
+                                        : std::numeric_limits<hash_value_type>::max();
+        // top `precision` bits pick the register, leading-zero count of the
+        // remainder (plus one) is the rank stored in it
+        auto const reg_index = static_cast<size_type>(hash >> (32 - precision));
+        auto const remainder = static_cast<hash_value_type>(hash << precision);
+        auto const rank      = static_cast<int8_t>(
+          remainder == 0 ? 33 - precision : __clz(static_cast<int>(remainder)) + 1);
+        cudf::genericAtomicOperation(
+          registers + static_cast<std::size_t>(group_labels[i]) * num_registers + reg_index,
+          rank,
+          DeviceMax{});
+      });
+
+    thrust::tabulate(rmm::exec_policy(stream),
+                     result->mutable_view().begin<size_type>(),
+                     result->mutable_view().end<size_type>(),
+                     hll_estimator{registers.data(), num_registers});
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!cudf::is_equality_comparable<T, T>(), std::unique_ptr<column>> operator()(
+    Args&&...)
+  {
+    CUDF_FAIL("nested type group_approx_nunique not supported");
+  }
+};
+}  // namespace
+
+std::unique_ptr<column> group_approx_nunique(column_view const& values,
+                                             cudf::device_span<size_type const> group_labels,
+                                             size_type const num_groups,
+                                             null_policy null_handling,
+                                             size_type precision,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_groups >= 0, "number of groups cannot be negative");
+  CUDF_EXPECTS(static_cast<size_t>(values.size()) == group_labels.size(),
+               "Size of values column should be same as that of group labels");
+  CUDF_EXPECTS(precision >= 4 and precision <= 18, "precision must be in [4, 18]");
+
+  return type_dispatcher(values.type(),
+                         approx_nunique_functor{},
+                         values,
+                         group_labels,
+                         num_groups,
+                         null_handling,
+                         precision,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
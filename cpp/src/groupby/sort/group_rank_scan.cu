@@ -138,6 +138,37 @@ std::unique_ptr<column> dense_rank_scan(column_view const& order_by,
     mr);
 }
 
+std::unique_ptr<column> percent_rank_scan(column_view const& order_by,
+                                          device_span<size_type const> group_labels,
+                                          device_span<size_type const> group_offsets,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const ranks = rank_scan(
+    order_by, group_labels, group_offsets, stream, rmm::mr::get_current_device_resource());
+  auto percent_ranks = make_fixed_width_column(data_type{type_to_id<double>()},
+                                               static_cast<size_type>(group_labels.size()),
+                                               mask_state::UNALLOCATED,
+                                               stream,
+                                               mr);
+
+  thrust::tabulate(rmm::exec_policy(stream),
+                   percent_ranks->mutable_view().begin<double>(),
+                   percent_ranks->mutable_view().end<double>(),
+                   [d_ranks = ranks->view().begin<size_type>(),
+                    labels  = group_labels.data(),
+                    offsets = group_offsets.data()] __device__(size_type row_index) {
+                     auto const group_size =
+                       offsets[labels[row_index] + 1] - offsets[labels[row_index]];
+                     // a single-row group ranks as 0 rather than dividing by zero
+                     return group_size == 1 ? 0.0
+                                            : (d_ranks[row_index] - 1) /
+                                                static_cast<double>(group_size - 1);
+                   });
+
+  return percent_ranks;
+}
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
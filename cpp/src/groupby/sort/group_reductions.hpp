@@ -333,6 +333,42 @@ std::unique_ptr<column> group_nunique(column_view const& values,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to estimate the number of unique values in each group of
+ *  @p values using a HyperLogLog sketch
+ *
+ * Each group maintains `2^precision` one-byte registers; the estimate for a
+ * group is computed from its registers with the standard HyperLogLog bias
+ * correction, switching to linear counting for small cardinalities. The
+ * expected relative error is about `1.04 / sqrt(2^precision)`.
+ *
+ * @code{.pseudo}
+ * values        = [2, 4, 4, -1, -2, <NA>, 4, <NA>]
+ * group_labels  = [0, 0, 0,  1,  1,    2, 2,    3]
+ * num_groups    = 4
+ *
+ * group_approx_nunique(null_policy::EXCLUDE) ~= [2, 2, 1, 0]
+ * group_approx_nunique(null_policy::INCLUDE) ~= [2, 2, 2, 1]
+ * @endcode
+ *
+ * @param values Grouped values to estimate the unique count of
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups ( unique values in @p group_labels )
+ * @param null_handling Exclude nulls while counting if null_policy::EXCLUDE,
+ *  Include nulls if null_policy::INCLUDE.
+ *  Nulls are treated equal.
+ * @param precision Number of index bits in each group's sketch, in `[4, 18]`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> group_approx_nunique(column_view const& values,
+                                             cudf::device_span<size_type const> group_labels,
+                                             size_type const num_groups,
+                                             null_policy null_handling,
+                                             size_type precision,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Internal API to calculate nth values in each group of  @p values
  *
@@ -571,6 +607,29 @@ std::unique_ptr<column> group_merge_tdigest(column_view const& values,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to apply a user-defined aggregation (CUDA or PTX) to each group
+ *
+ * The user-defined function is JIT compiled and invoked once per group with the group's
+ * contiguous run of values, producing one output row per group. The UDF interface is the
+ * same as the one used by the rolling window UDF aggregations.
+ *
+ * @throws cudf::logic_error if `values` contains nulls
+ *
+ * @param grouped_values Grouped values to aggregate
+ * @param group_offsets Offsets of groups' starting points within @p grouped_values
+ * @param num_groups Number of groups
+ * @param agg The CUDA or PTX UDF aggregation to perform
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> group_udf(column_view const& grouped_values,
+                                  cudf::device_span<size_type const> group_offsets,
+                                  size_type num_groups,
+                                  aggregation const& agg,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
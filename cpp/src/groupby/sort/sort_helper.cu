@@ -24,20 +24,26 @@
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/string_view.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/device/device_radix_sort.cuh>
+
 #include <thrust/binary_search.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/sequence.h>
+#include <thrust/tabulate.h>
 #include <thrust/uninitialized_fill.h>
 #include <thrust/unique.h>
 
@@ -91,6 +97,143 @@ namespace cudf {
 namespace groupby {
 namespace detail {
 namespace sort {
+namespace {
+
+/**
+ * @brief Encodes one fixed-width element as an unsigned integer whose natural
+ * ordering matches the element's ascending sort order.
+ *
+ * The encoding occupies exactly `8 * sizeof(element)` low bits so that
+ * multiple columns can be packed side by side into one radix-sortable key.
+ */
+struct fixed_width_radix_encoder {
+  template <typename Rep>
+  __device__ uint64_t sign_flipped(Rep value) const
+  {
+    using Unsigned = std::make_unsigned_t<Rep>;
+    return static_cast<uint64_t>(static_cast<Unsigned>(value) ^
+                                 (Unsigned{1} << (8 * sizeof(Rep) - 1)));
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(cudf::is_fixed_width<T>() and not std::is_floating_point_v<T>)>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row_index) const
+  {
+    if constexpr (cudf::is_timestamp<T>()) {
+      return sign_flipped(col.element<T>(row_index).time_since_epoch().count());
+    } else if constexpr (cudf::is_duration<T>()) {
+      return sign_flipped(col.element<T>(row_index).count());
+    } else if constexpr (std::is_signed_v<T>) {
+      return sign_flipped(col.element<T>(row_index));
+    } else {
+      // bool and unsigned integers sort in their natural bit order
+      return static_cast<uint64_t>(col.element<T>(row_index));
+    }
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not cudf::is_fixed_width<T>() or std::is_floating_point_v<T>)>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row_index) const
+  {
+    cudf_assert(false && "Unsupported type for radix key packing.");
+    return 0;
+  }
+};
+
+/**
+ * @brief Packs all key columns of a row into a single radix-sortable key,
+ * first column in the most significant bits.
+ */
+struct row_radix_key_fn {
+  table_device_view _keys;
+  size_type const* _column_bits;  ///< bits occupied by each column's encoding
+
+  __device__ uint64_t operator()(size_type row_index) const
+  {
+    uint64_t packed = 0;
+    for (size_type col = 0; col < _keys.num_columns(); ++col) {
+      packed = (packed << _column_bits[col]) |
+               type_dispatcher<dispatch_storage_type>(_keys.column(col).type(),
+                                                      fixed_width_radix_encoder{},
+                                                      _keys.column(col),
+                                                      row_index);
+    }
+    return packed;
+  }
+};
+
+/**
+ * @brief Computes the stable sorted order of `keys` with a cub radix sort when
+ * all key columns can be packed into a single 64-bit key.
+ *
+ * Eligible keys are null-free, non-floating-point fixed-width columns whose
+ * widths sum to at most 8 bytes; sign bits of signed integers, timestamps,
+ * durations and fixed-point values are flipped to preserve their ordering.
+ * Floating-point keys are left to the comparison sort so that its NaN ordering
+ * is preserved. Returns nullptr when the keys are not eligible.
+ */
+std::unique_ptr<column> radix_sorted_order(table_view const& keys, rmm::cuda_stream_view stream)
+{
+  auto const is_radix_sortable = [](auto const& col) {
+    return cudf::is_fixed_width(col.type()) and not cudf::is_floating_point(col.type()) and
+           not col.has_nulls();
+  };
+  if (keys.num_rows() == 0 or keys.num_columns() == 0 or
+      not std::all_of(keys.begin(), keys.end(), is_radix_sortable)) {
+    return nullptr;
+  }
+
+  std::vector<size_type> column_bits(keys.num_columns());
+  std::transform(keys.begin(), keys.end(), column_bits.begin(), [](auto const& col) {
+    return static_cast<size_type>(8 * cudf::size_of(col.type()));
+  });
+  auto const total_bits = std::accumulate(column_bits.begin(), column_bits.end(), size_type{0});
+  if (total_bits > static_cast<size_type>(8 * sizeof(uint64_t))) { return nullptr; }
+
+  auto const num_rows   = keys.num_rows();
+  auto const d_bits     = cudf::detail::make_device_uvector_async(column_bits, stream);
+  auto const d_keys     = table_device_view::create(keys, stream);
+  auto packed_keys      = rmm::device_uvector<uint64_t>(num_rows, stream);
+  auto sorted_keys      = rmm::device_uvector<uint64_t>(num_rows, stream);
+  auto unsorted_indices = rmm::device_uvector<size_type>(num_rows, stream);
+
+  thrust::tabulate(rmm::exec_policy(stream),
+                   packed_keys.begin(),
+                   packed_keys.end(),
+                   row_radix_key_fn{*d_keys, d_bits.data()});
+  thrust::sequence(rmm::exec_policy(stream), unsorted_indices.begin(), unsorted_indices.end(), 0);
+
+  auto sorted_order = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream);
+
+  rmm::device_buffer d_temp_storage;
+  size_t temp_storage_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                  temp_storage_bytes,
+                                  packed_keys.data(),
+                                  sorted_keys.data(),
+                                  unsorted_indices.data(),
+                                  sorted_order->mutable_view().data<size_type>(),
+                                  num_rows,
+                                  0,
+                                  total_bits,
+                                  stream.value());
+  d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+  cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                  temp_storage_bytes,
+                                  packed_keys.data(),
+                                  sorted_keys.data(),
+                                  unsorted_indices.data(),
+                                  sorted_order->mutable_view().data<size_type>(),
+                                  num_rows,
+                                  0,
+                                  total_bits,
+                                  stream.value());
+
+  return sorted_order;
+}
+
+}  // namespace
 
 sort_groupby_helper::sort_groupby_helper(table_view const& keys,
                                          null_policy include_null_keys,
@@ -159,6 +302,12 @@ column_view sort_groupby_helper::key_sort_order(rmm::cuda_stream_view stream)
   }
 
   if (_include_null_keys == null_policy::INCLUDE || !cudf::has_nulls(_keys)) {  // SQL style
+    // Null-free fixed-width keys can be packed into a single 64-bit key and
+    // radix sorted, which is considerably faster than the comparison sort
+    if (auto radix_order = radix_sorted_order(_keys, stream)) {
+      _key_sorted_order = std::move(radix_order);
+      return sliced_key_sorted_order();
+    }
     _key_sorted_order = cudf::detail::stable_sorted_order(
       _keys,
       {},
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Non-owning device view of a Bloom filter bit array.
+ *
+ * The filter stores two bits per inserted hash value. The first bit index is
+ * taken directly from the hash value; the second is derived by re-hashing it,
+ * so callers only need to compute a single hash per row. `contains` may return
+ * false positives but never false negatives, which makes the filter safe to
+ * use as a pre-filter in front of an exact hash table probe.
+ */
+class bloom_filter_view {
+ public:
+  bloom_filter_view(uint32_t* words, uint32_t num_bits)
+    : _words{words}, _bit_mask{num_bits - 1}
+  {
+  }
+
+  __device__ void insert(hash_value_type hash)
+  {
+    atomicOr(_words + word_index(first_bit(hash)), uint32_t{1} << bit_offset(first_bit(hash)));
+    atomicOr(_words + word_index(second_bit(hash)), uint32_t{1} << bit_offset(second_bit(hash)));
+  }
+
+  __device__ bool contains(hash_value_type hash) const
+  {
+    return is_set(first_bit(hash)) and is_set(second_bit(hash));
+  }
+
+ private:
+  __device__ uint32_t first_bit(hash_value_type hash) const
+  {
+    return static_cast<uint32_t>(hash) & _bit_mask;
+  }
+
+  __device__ uint32_t second_bit(hash_value_type hash) const
+  {
+    return MurmurHash3_32<hash_value_type>{}(hash) & _bit_mask;
+  }
+
+  __device__ static uint32_t word_index(uint32_t bit) { return bit >> 5; }
+  __device__ static uint32_t bit_offset(uint32_t bit) { return bit & 31; }
+
+  __device__ bool is_set(uint32_t bit) const
+  {
+    return _words[word_index(bit)] & (uint32_t{1} << bit_offset(bit));
+  }
+
+  uint32_t* _words;
+  uint32_t _bit_mask;  ///< num_bits - 1; num_bits is always a power of two
+};
+
+/**
+ * @brief Owning Bloom filter sized for an expected number of keys.
+ *
+ * Allocates roughly eight bits per expected key, rounded up to a power of two
+ * so bit indices reduce to a mask. With the two probes per key used by
+ * `bloom_filter_view` this gives a false-positive rate of about 5%.
+ */
+class bloom_filter {
+ public:
+  bloom_filter(size_type num_keys, rmm::cuda_stream_view stream)
+    : _num_bits{compute_num_bits(num_keys)}, _words(_num_bits / 32, stream)
+  {
+    thrust::fill(rmm::exec_policy(stream), _words.begin(), _words.end(), uint32_t{0});
+  }
+
+  [[nodiscard]] bloom_filter_view view() { return bloom_filter_view{_words.data(), _num_bits}; }
+
+ private:
+  static uint32_t compute_num_bits(size_type num_keys)
+  {
+    uint64_t num_bits = 256;  // floor keeps tiny filters a full word multiple
+    while (num_bits < static_cast<uint64_t>(num_keys) * 8 and num_bits < (uint64_t{1} << 31)) {
+      num_bits <<= 1;
+    }
+    return static_cast<uint32_t>(num_bits);
+  }
+
+  uint32_t _num_bits;
+  rmm::device_uvector<uint32_t> _words;
+};
+
+}  // namespace detail
+}  // namespace cudf
@@ -263,9 +263,11 @@ class concurrent_unordered_map {
    *a type where atomicCAS is natively supported, this optimization path
    *will insert the pair in a single atomicCAS operation.
    */
-  template <typename pair_type = value_type>
+  template <typename insert_key_equal, typename pair_type = value_type>
   __device__ std::enable_if_t<is_packable<pair_type>(), insert_result> attempt_insert(
-    value_type* const __restrict__ insert_location, value_type const& insert_pair)
+    value_type* const __restrict__ insert_location,
+    value_type const& insert_pair,
+    insert_key_equal f_equal)
   {
     pair_packer<pair_type> const unused{thrust::make_pair(m_unused_key, m_unused_element)};
     pair_packer<pair_type> const new_pair{insert_pair};
@@ -276,7 +278,7 @@ class concurrent_unordered_map {
 
     if (old.packed == unused.packed) { return insert_result::SUCCESS; }
 
-    if (m_equal(old.pair.first, insert_pair.first)) { return insert_result::DUPLICATE; }
+    if (f_equal(old.pair.first, insert_pair.first)) { return insert_result::DUPLICATE; }
     return insert_result::CONTINUE;
   }
 
@@ -287,9 +289,11 @@ class concurrent_unordered_map {
    * @param[in] insert_pair The pair to insert
    * @return Enum indicating result of insert attempt.
    */
-  template <typename pair_type = value_type>
+  template <typename insert_key_equal, typename pair_type = value_type>
   __device__ std::enable_if_t<not is_packable<pair_type>(), insert_result> attempt_insert(
-    value_type* const __restrict__ insert_location, value_type const& insert_pair)
+    value_type* const __restrict__ insert_location,
+    value_type const& insert_pair,
+    insert_key_equal f_equal)
   {
     key_type const old_key{atomicCAS(&(insert_location->first), m_unused_key, insert_pair.first)};
 
@@ -300,7 +304,7 @@ class concurrent_unordered_map {
     }
 
     // Key already exists
-    if (m_equal(old_key, insert_pair.first)) { return insert_result::DUPLICATE; }
+    if (f_equal(old_key, insert_pair.first)) { return insert_result::DUPLICATE; }
 
     return insert_result::CONTINUE;
   }
@@ -326,7 +330,35 @@ class concurrent_unordered_map {
    */
   __device__ thrust::pair<iterator, bool> insert(value_type const& insert_pair)
   {
-    const size_type key_hash{m_hf(insert_pair.first)};
+    return insert(insert_pair, m_hf, m_equal);
+  }
+
+  /**
+   * @brief Attempts to insert a key, value pair into the map.
+   *
+   * This version of the insert function specifies a hashing function and an
+   * equality comparison, mirroring the corresponding `find` overload. This
+   * allows the caller to insert with functions other than the ones the map was
+   * constructed with (for example, when the stored functions reference device
+   * views that have since been rebuilt).
+   *
+   * @tparam insert_hasher     Type of hashing function
+   * @tparam insert_key_equal  Type of equality comparison
+   *
+   * @param insert_pair The key and value pair to insert
+   * @param f_hash      The hashing function to use to hash the new key
+   * @param f_equal     The equality function to use to compare the new key with
+   *                    the contents of the hash table
+   * @return Iterator, Boolean pair. Iterator is to the location of the
+   *newly inserted pair, or the existing pair that prevented the insert.
+   *Boolean indicates insert success.
+   */
+  template <typename insert_hasher, typename insert_key_equal>
+  __device__ thrust::pair<iterator, bool> insert(value_type const& insert_pair,
+                                                 insert_hasher f_hash,
+                                                 insert_key_equal f_equal)
+  {
+    const size_type key_hash{f_hash(insert_pair.first)};
     size_type index{key_hash % m_capacity};
 
     insert_result status{insert_result::CONTINUE};
@@ -335,7 +367,7 @@ class concurrent_unordered_map {
 
     while (status == insert_result::CONTINUE) {
       current_bucket = &m_hashtbl_values[index];
-      status         = attempt_insert(current_bucket, insert_pair);
+      status         = attempt_insert(current_bucket, insert_pair, f_equal);
       index          = (index + 1) % m_capacity;
     }
 
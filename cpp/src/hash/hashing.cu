@@ -47,6 +47,35 @@ std::vector<column_view> to_leaf_columns(IterType iter_begin, IterType iter_end)
   return leaf_columns;
 }
 
+/**
+ * @brief Computes the xxhash64 value of an element, chaining the running row hash as the seed.
+ *
+ * Null elements return the running hash unchanged, matching the serial murmur3 convention of
+ * seeding with the chained hash for nulls.
+ */
+template <bool has_nulls>
+class xxhash64_element_hasher {
+ public:
+  __device__ xxhash64_element_hasher(uint64_t seed) : _seed{seed} {}
+
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  __device__ uint64_t operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return _seed; }
+    return XXHash_64<T>{_seed}(col.element<T>(row_index));
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  __device__ uint64_t operator()(column_device_view col, size_type row_index) const
+  {
+    cudf_assert(false && "Unsupported type in hash.");
+    return {};
+  }
+
+ private:
+  uint64_t _seed;
+};
+
 }  // namespace
 
 template <template <typename> class hash_function>
@@ -105,6 +134,55 @@ std::unique_ptr<column> serial_murmur_hash3_32(table_view const& input,
   return output;
 }
 
+std::unique_ptr<column> xxhash_64(table_view const& input,
+                                  uint64_t seed,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::UINT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  table_view const leaf_table(to_leaf_columns(input.begin(), input.end()));
+  auto const device_input = table_device_view::create(leaf_table, stream);
+  auto output_view        = output->mutable_view();
+
+  if (has_nulls(leaf_table)) {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     output_view.begin<uint64_t>(),
+                     output_view.end<uint64_t>(),
+                     [device_input = *device_input, seed] __device__(auto row_index) {
+                       return thrust::reduce(
+                         thrust::seq,
+                         device_input.begin(),
+                         device_input.end(),
+                         seed,
+                         [rindex = row_index] __device__(auto hash, auto column) {
+                           return cudf::type_dispatcher(
+                             column.type(), xxhash64_element_hasher<true>{hash}, column, rindex);
+                         });
+                     });
+  } else {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     output_view.begin<uint64_t>(),
+                     output_view.end<uint64_t>(),
+                     [device_input = *device_input, seed] __device__(auto row_index) {
+                       return thrust::reduce(
+                         thrust::seq,
+                         device_input.begin(),
+                         device_input.end(),
+                         seed,
+                         [rindex = row_index] __device__(auto hash, auto column) {
+                           return cudf::type_dispatcher(
+                             column.type(), xxhash64_element_hasher<false>{hash}, column, rindex);
+                         });
+                     });
+  }
+
+  return output;
+}
+
 std::unique_ptr<column> hash(table_view const& input,
                              hash_id hash_function,
                              cudf::host_span<uint32_t const> initial_hash,
@@ -119,6 +197,7 @@ std::unique_ptr<column> hash(table_view const& input,
       return serial_murmur_hash3_32<MurmurHash3_32>(input, seed, stream, mr);
     case (hash_id::HASH_SPARK_MURMUR3):
       return serial_murmur_hash3_32<SparkMurmurHash3_32>(input, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64): return xxhash_64(input, seed, stream, mr);
     default: return nullptr;
   }
 }
@@ -15,6 +15,7 @@
  */
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/lists/list_view.cuh>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -276,14 +277,100 @@ DLManagedTensor* to_dlpack(table_view const& input,
 
 }  // namespace detail
 
+dlpack_adopted_table::dlpack_adopted_table(DLManagedTensor* tensor,
+                                           std::vector<column_view>&& columns)
+  : _tensor{tensor}, _columns{std::move(columns)}
+{
+}
+
+dlpack_adopted_table::dlpack_adopted_table(std::unique_ptr<table> copied) : _table{std::move(copied)}
+{
+}
+
+dlpack_adopted_table::~dlpack_adopted_table()
+{
+  if (_tensor != nullptr and _tensor->deleter != nullptr) { _tensor->deleter(_tensor); }
+}
+
+table_view dlpack_adopted_table::view() const
+{
+  return _table != nullptr ? _table->view() : table_view{_columns};
+}
+
+bool dlpack_adopted_table::is_zero_copy() const { return _tensor != nullptr; }
+
+std::unique_ptr<dlpack_adopted_table> adopt_dlpack(DLManagedTensor* managed_tensor,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  auto const adoptable = [&] {
+    if (tensor.device.device_type != kDLCUDA) { return false; }
+    // a unit row stride means each column is contiguous in device memory
+    if (tensor.strides != nullptr and tensor.strides[0] != 1) { return false; }
+    auto const byte_width = size_of(DLDataType_to_data_type(tensor.dtype));
+    auto const data       = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
+    return data % byte_width == 0;
+  }();
+
+  if (not adoptable) {
+    // we own the tensor, so delete it once the copy has completed
+    auto copied = detail::from_dlpack(managed_tensor, rmm::cuda_stream_default, mr);
+    rmm::cuda_stream_default.synchronize();
+    if (managed_tensor->deleter != nullptr) { managed_tensor->deleter(managed_tensor); }
+    return std::unique_ptr<dlpack_adopted_table>(new dlpack_adopted_table(std::move(copied)));
+  }
+
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  CUDF_EXPECTS(tensor.device.device_id == device_id, "DLTensor device ID must be current device");
+
+  CUDF_EXPECTS(tensor.ndim > 0 && tensor.ndim <= 2, "DLTensor must be 1D or 2D");
+  CUDF_EXPECTS(tensor.shape[0] >= 0,
+               "DLTensor first dim should be of shape greater than or equal-to 0.");
+  CUDF_EXPECTS(tensor.shape[0] < std::numeric_limits<size_type>::max(),
+               "DLTensor first dim exceeds size supported by cudf");
+  if (tensor.ndim > 1) {
+    CUDF_EXPECTS(tensor.shape[1] >= 0,
+                 "DLTensor second dim should be of shape greater than or equal-to 0.");
+    CUDF_EXPECTS(tensor.shape[1] < std::numeric_limits<size_type>::max(),
+                 "DLTensor second dim exceeds size supported by cudf");
+  }
+
+  data_type const dtype   = DLDataType_to_data_type(tensor.dtype);
+  size_t const byte_width = size_of(dtype);
+  auto const num_rows     = static_cast<size_type>(tensor.shape[0]);
+  size_t const num_columns = (tensor.ndim == 2) ? static_cast<size_t>(tensor.shape[1]) : 1;
+
+  size_t const col_stride = (tensor.ndim == 2 && nullptr != tensor.strides)
+                              ? byte_width * tensor.strides[1]
+                              : byte_width * static_cast<size_t>(num_rows);
+
+  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
+
+  std::vector<column_view> columns;
+  columns.reserve(num_columns);
+  for (size_t i = 0; i < num_columns; ++i) {
+    columns.emplace_back(dtype, num_rows, reinterpret_cast<void const*>(tensor_data));
+    tensor_data += col_stride;
+  }
+
+  return std::unique_ptr<dlpack_adopted_table>(
+    new dlpack_adopted_table(managed_tensor, std::move(columns)));
+}
+
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                                    rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE();
   return detail::from_dlpack(managed_tensor, rmm::cuda_stream_default, mr);
 }
 
 DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resource* mr)
 {
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return detail::to_dlpack(input, rmm::cuda_stream_default, mr);
 }
 
@@ -453,4 +453,42 @@ std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
   return detail::from_arrow(input_table, rmm::cuda_stream_default, mr);
 }
 
+table_view from_arrow_device(arrow::Table const& input)
+{
+  CUDF_FUNC_RANGE();
+
+  std::vector<column_view> columns;
+  for (auto const& chunked_array : input.columns()) {
+    CUDF_EXPECTS(chunked_array->num_chunks() == 1,
+                 "from_arrow_device requires exactly one chunk per column");
+    auto const& array = *chunked_array->chunk(0);
+    auto const type   = detail::arrow_to_cudf_type(*array.type());
+    // arrow bit-packs booleans and uses 128 bits for decimals, so only the remaining
+    // fixed-width types share their layout between cudf and arrow
+    CUDF_EXPECTS(
+      is_fixed_width(type) and type.id() != type_id::BOOL8 and not is_fixed_point(type),
+      "from_arrow_device only supports non-boolean primitive types");
+
+    // primitive arrays carry the validity bitmap in buffer 0 and the values in buffer 1
+    auto const& buffers  = array.data()->buffers;
+    auto const null_mask = buffers[0] != nullptr
+                             ? reinterpret_cast<bitmask_type const*>(buffers[0]->data())
+                             : nullptr;
+    // Array::null_count() would count the bits on the host when the count is unknown, which
+    // must not happen on a device-resident bitmap; let cudf compute it lazily instead
+    auto const arrow_null_count = array.data()->null_count.load();
+    auto const null_count       = arrow_null_count == arrow::kUnknownNullCount
+                                    ? cudf::UNKNOWN_NULL_COUNT
+                                    : static_cast<size_type>(arrow_null_count);
+    columns.emplace_back(type,
+                         static_cast<size_type>(array.length()),
+                         buffers[1]->data(),
+                         null_mask,
+                         null_count,
+                         static_cast<size_type>(array.offset()));
+  }
+
+  return table_view{columns};
+}
+
 }  // namespace cudf
@@ -23,6 +23,7 @@
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -382,4 +383,69 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
   return detail::to_arrow(input, metadata, rmm::cuda_stream_default, ar_mr);
 }
 
+namespace {
+
+/**
+ * @brief An arrow buffer pointing into device memory owned by a cudf table.
+ *
+ * Shares ownership of the table so that the memory outlives every buffer referencing it.
+ */
+class table_device_buffer : public arrow::Buffer {
+ public:
+  table_device_buffer(uint8_t const* data, int64_t size, std::shared_ptr<cudf::table> owner)
+    : arrow::Buffer(data, size), _owner(std::move(owner))
+  {
+  }
+
+ private:
+  std::shared_ptr<cudf::table> _owner;
+};
+
+}  // namespace
+
+std::shared_ptr<arrow::Table> to_arrow_device(std::shared_ptr<table> input,
+                                              std::vector<column_metadata> const& metadata)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    metadata.empty() or metadata.size() == static_cast<std::size_t>(input->num_columns()),
+    "columns' metadata should be equal to number of columns in table");
+
+  auto const input_view = input->view();
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+
+  for (size_type i = 0; i < input_view.num_columns(); i++) {
+    auto const col = input_view.column(i);
+    // arrow bit-packs booleans and uses 128 bits for decimals, so only the remaining
+    // fixed-width types share their layout between cudf and arrow
+    CUDF_EXPECTS(is_fixed_width(col.type()) and col.type().id() != type_id::BOOL8 and
+                   not is_fixed_point(col.type()),
+                 "to_arrow_device only supports non-boolean primitive types");
+
+    auto const num_base_elements = static_cast<int64_t>(col.offset()) + col.size();
+    auto data_buffer             = std::make_shared<table_device_buffer>(
+      col.head<uint8_t>(), num_base_elements * size_of(col.type()), input);
+    auto null_buffer =
+      col.nullable()
+        ? std::static_pointer_cast<arrow::Buffer>(std::make_shared<table_device_buffer>(
+            reinterpret_cast<uint8_t const*>(col.null_mask()),
+            static_cast<int64_t>(
+              bitmask_allocation_size_bytes(static_cast<size_type>(num_base_elements))),
+            input))
+        : std::shared_ptr<arrow::Buffer>{};
+
+    arrays.push_back(detail::to_arrow_array(col.type().id(),
+                                            static_cast<int64_t>(col.size()),
+                                            std::move(data_buffer),
+                                            std::move(null_buffer),
+                                            static_cast<int64_t>(col.null_count()),
+                                            static_cast<int64_t>(col.offset())));
+    auto const name = metadata.empty() ? std::string{} : metadata[i].name;
+    fields.push_back(arrow::field(name, arrays.back()->type(), col.nullable()));
+  }
+
+  return arrow::Table::Make(arrow::schema(fields), arrays, input_view.num_rows());
+}
+
 }  // namespace cudf
@@ -39,6 +39,11 @@
 
 #include <nvcomp/snappy.h>
 
+#if __has_include(<nvcomp/zstd.h>)
+#include <nvcomp/zstd.h>
+#define CUDF_NVCOMP_HAS_ZSTD 1
+#endif
+
 #include <memory>
 #include <string>
 #include <utility>
@@ -319,6 +324,105 @@ rmm::device_buffer decompress_data(datasource& source,
     }
 
     return decomp_block_data;
+  } else if (meta.codec == "zstandard") {
+#ifdef CUDF_NVCOMP_HAS_ZSTD
+    size_t const num_blocks = meta.block_list.size();
+
+    // Find ptrs to each compressed block in comp_block_data by removing header offset
+    hostdevice_vector<void const*> compressed_data_ptrs(num_blocks, stream);
+    std::transform(meta.block_list.begin(),
+                   meta.block_list.end(),
+                   compressed_data_ptrs.host_ptr(),
+                   [&](auto const& block) {
+                     return static_cast<std::byte const*>(comp_block_data.data()) +
+                            (block.offset - meta.block_list[0].offset);
+                   });
+    compressed_data_ptrs.host_to_device(stream);
+
+    hostdevice_vector<size_t> compressed_data_sizes(num_blocks, stream);
+    std::transform(meta.block_list.begin(),
+                   meta.block_list.end(),
+                   compressed_data_sizes.host_ptr(),
+                   [](auto const& block) { return block.size; });
+    compressed_data_sizes.host_to_device(stream);
+
+    hostdevice_vector<size_t> uncompressed_data_sizes(num_blocks, stream);
+    nvcompStatus_t status =
+      nvcompBatchedZstdGetDecompressSizeAsync(compressed_data_ptrs.device_ptr(),
+                                              compressed_data_sizes.device_ptr(),
+                                              uncompressed_data_sizes.device_ptr(),
+                                              num_blocks,
+                                              stream.value());
+    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
+                 "Unable to get uncompressed sizes for Zstandard compressed blocks");
+    uncompressed_data_sizes.device_to_host(stream, true);
+
+    size_t const uncompressed_data_size =
+      std::reduce(uncompressed_data_sizes.begin(), uncompressed_data_sizes.end());
+    size_t const max_uncomp_block_size = std::reduce(
+      uncompressed_data_sizes.begin(), uncompressed_data_sizes.end(), 0, thrust::maximum<size_t>());
+
+    size_t temp_size;
+    status = nvcompBatchedZstdDecompressGetTempSize(num_blocks, max_uncomp_block_size, &temp_size);
+    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
+                 "Unable to get scratch size for Zstandard decompression");
+
+    rmm::device_buffer scratch(temp_size, stream);
+    rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
+    rmm::device_uvector<void*> uncompressed_data_ptrs(num_blocks, stream);
+    hostdevice_vector<size_t> uncompressed_data_offsets(num_blocks, stream);
+
+    std::exclusive_scan(uncompressed_data_sizes.begin(),
+                        uncompressed_data_sizes.end(),
+                        uncompressed_data_offsets.begin(),
+                        0);
+    uncompressed_data_offsets.host_to_device(stream);
+
+    thrust::tabulate(rmm::exec_policy(),
+                     uncompressed_data_ptrs.begin(),
+                     uncompressed_data_ptrs.end(),
+                     [off  = uncompressed_data_offsets.device_ptr(),
+                      data = static_cast<std::byte*>(decomp_block_data.data())] __device__(int i) {
+                       return data + off[i];
+                     });
+
+    rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_blocks, stream);
+    rmm::device_uvector<nvcompStatus_t> statuses(num_blocks, stream);
+
+    status = nvcompBatchedZstdDecompressAsync(compressed_data_ptrs.device_ptr(),
+                                              compressed_data_sizes.device_ptr(),
+                                              uncompressed_data_sizes.device_ptr(),
+                                              actual_uncompressed_data_sizes.data(),
+                                              num_blocks,
+                                              scratch.data(),
+                                              scratch.size(),
+                                              uncompressed_data_ptrs.data(),
+                                              statuses.data(),
+                                              stream);
+    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
+                 "unable to perform Zstandard decompression");
+
+    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
+                               uncompressed_data_sizes.d_begin(),
+                               uncompressed_data_sizes.d_end(),
+                               actual_uncompressed_data_sizes.begin()),
+                 "Mismatch in expected and actual decompressed size during Zstandard decompression");
+    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
+                               statuses.begin(),
+                               statuses.end(),
+                               thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
+                 "Error during Zstandard decompression");
+
+    // Update blocks offsets & sizes to refer to uncompressed data
+    for (size_t i = 0; i < num_blocks; i++) {
+      meta.block_list[i].offset = uncompressed_data_offsets[i];
+      meta.block_list[i].size   = uncompressed_data_sizes[i];
+    }
+
+    return decomp_block_data;
+#else
+    CUDF_FAIL("Zstandard decompression requires nvCOMP 2.3 or newer");
+#endif
   } else {
     CUDF_FAIL("Unsupported compression codec\n");
   }
@@ -86,6 +86,28 @@ cudaError_t gpu_unsnap(gpu_inflate_input_s* inputs,
                        int count                    = 1,
                        rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Interface for decompressing Zstandard-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ *
+ * Decompression is performed through nvCOMP's batched Zstandard API; throws
+ * cudf::logic_error when cuDF is built against an nvCOMP without Zstandard
+ * support (older than 2.3).
+ *
+ * @param[in] inputs List of input argument structures, in device memory
+ * @param[out] outputs List of output status structures, in device memory
+ * @param[in] max_uncomp_block_size Size in bytes of the largest uncompressed chunk
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void gpu_unzstd(gpu_inflate_input_s* inputs,
+                gpu_inflate_status_s* outputs,
+                size_t max_uncomp_block_size,
+                int count                    = 1,
+                rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @brief Computes the size of temporary memory for Brotli decompression
  *
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpuinflate.h"
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#if __has_include(<nvcomp/zstd.h>)
+#include <nvcomp/zstd.h>
+#define CUDF_NVCOMP_HAS_ZSTD 1
+#endif
+
+#include <thrust/equal.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace io {
+
+#ifdef CUDF_NVCOMP_HAS_ZSTD
+
+void gpu_unzstd(gpu_inflate_input_s* inputs,
+                gpu_inflate_status_s* outputs,
+                size_t max_uncomp_block_size,
+                int count,
+                rmm::cuda_stream_view stream)
+{
+  size_t const num_blocks = count;
+  size_t temp_size;
+
+  auto status = nvcompBatchedZstdDecompressGetTempSize(num_blocks, max_uncomp_block_size, &temp_size);
+  CUDF_EXPECTS(nvcompStatus_t::nvcompSuccess == status,
+               "Unable to get scratch size for Zstandard decompression");
+
+  rmm::device_buffer scratch(temp_size, stream);
+  rmm::device_uvector<void const*> compressed_data_ptrs(num_blocks, stream);
+  rmm::device_uvector<size_t> compressed_data_sizes(num_blocks, stream);
+  rmm::device_uvector<void*> uncompressed_data_ptrs(num_blocks, stream);
+  rmm::device_uvector<size_t> uncompressed_data_sizes(num_blocks, stream);
+
+  rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_blocks, stream);
+  rmm::device_uvector<nvcompStatus_t> statuses(num_blocks, stream);
+
+  // Prepare the vectors
+  auto comp_it = thrust::make_zip_iterator(compressed_data_ptrs.begin(),
+                                           compressed_data_sizes.begin(),
+                                           uncompressed_data_ptrs.begin(),
+                                           uncompressed_data_sizes.data());
+  thrust::transform(rmm::exec_policy(stream),
+                    inputs,
+                    inputs + num_blocks,
+                    comp_it,
+                    [] __device__(gpu_inflate_input_s in) {
+                      return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice, in.dstSize);
+                    });
+
+  status = nvcompBatchedZstdDecompressAsync(compressed_data_ptrs.data(),
+                                            compressed_data_sizes.data(),
+                                            uncompressed_data_sizes.data(),
+                                            actual_uncompressed_data_sizes.data(),
+                                            num_blocks,
+                                            scratch.data(),
+                                            scratch.size(),
+                                            uncompressed_data_ptrs.data(),
+                                            statuses.data(),
+                                            stream.value());
+  CUDF_EXPECTS(nvcompStatus_t::nvcompSuccess == status,
+               "unable to perform Zstandard decompression");
+
+  CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
+                             statuses.begin(),
+                             statuses.end(),
+                             thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
+               "Error during Zstandard decompression");
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0ul),
+    num_blocks,
+    [outputs, actual_uncomp_sizes = actual_uncompressed_data_sizes.data()] __device__(auto i) {
+      outputs[i].bytes_written = actual_uncomp_sizes[i];
+      outputs[i].status        = 0;
+    });
+}
+
+#else
+
+void gpu_unzstd(gpu_inflate_input_s*,
+                gpu_inflate_status_s*,
+                size_t,
+                int,
+                rmm::cuda_stream_view)
+{
+  CUDF_FAIL("Zstandard decompression requires nvCOMP 2.3 or newer");
+}
+
+#endif  // CUDF_NVCOMP_HAS_ZSTD
+
+}  // namespace io
+}  // namespace cudf
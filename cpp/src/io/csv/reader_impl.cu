@@ -26,6 +26,7 @@
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/staging_copy.hpp>
 #include <io/utilities/type_conversion.hpp>
 
 #include <cudf/detail/utilities/cuda.cuh>
@@ -248,8 +249,13 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
   range_end += (range_end < data.size());
 
   // Reserve memory by allocating and then resetting the size
+  // A bounded byte range retains (nearly) the entire input on the device, so reserve it all up
+  // front; otherwise every 64MB chunk past the initial reservation re-allocates the buffer and
+  // copies all previously loaded data, which is quadratic in the range size
   rmm::device_uvector<char> d_data{
-    (load_whole_file) ? data.size() : std::min(buffer_size * 2, data.size()), stream};
+    (load_whole_file || range_end < data.size()) ? data.size()
+                                                 : std::min(buffer_size * 2, data.size()),
+    stream};
   d_data.resize(0, stream);
   rmm::device_uvector<uint64_t> all_row_offsets{0, stream};
   do {
@@ -258,11 +264,11 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
 
     auto const previous_data_size = d_data.size();
     d_data.resize(target_pos - buffer_pos, stream);
-    CUDA_TRY(cudaMemcpyAsync(d_data.begin() + previous_data_size,
-                             data.begin() + buffer_pos + previous_data_size,
-                             target_pos - buffer_pos - previous_data_size,
-                             cudaMemcpyDefault,
-                             stream.value()));
+    // the source buffer is pageable; stage through pinned chunks for full H2D bandwidth
+    cudf::io::detail::copy_to_device_staged(d_data.begin() + previous_data_size,
+                                            data.begin() + buffer_pos + previous_data_size,
+                                            target_pos - buffer_pos - previous_data_size,
+                                            stream);
 
     // Pass 1: Count the potential number of rows in each character block for each
     // possible parser state at the beginning of the block.
@@ -490,9 +496,9 @@ std::vector<data_type> get_data_types_from_column_names(
   for (int32_t i = 0; i < num_actual_columns; i++) {
     if (column_flags[i] & column_parse::enabled) {
       auto const col_type_it = column_type_map.find(column_names[i]);
-      CUDF_EXPECTS(col_type_it != column_type_map.end(),
-                   "Must specify data types for all active columns");
-      selected_dtypes.emplace_back(col_type_it->second);
+      // columns the map leaves out are marked EMPTY and inferred from the data
+      selected_dtypes.emplace_back(col_type_it != column_type_map.end() ? col_type_it->second
+                                                                        : data_type{type_id::EMPTY});
     }
   }
 
@@ -776,6 +782,38 @@ table_with_metadata read_csv(cudf::io::datasource* source,
                        num_actual_columns);
                    }},
                  reader_opts.get_dtypes());
+
+    // Partial dtype maps are allowed: columns without a hint were marked EMPTY
+    // above, and only those run through the type detection pass. Hinted columns
+    // are excluded from detection entirely, so fully hinted files skip it.
+    auto const num_unknown = static_cast<int32_t>(std::count_if(
+      column_types.begin(), column_types.end(), [](auto const& type) {
+        return type.id() == type_id::EMPTY;
+      }));
+    if (num_unknown > 0) {
+      auto detection_flags = column_flags;
+      for (size_t i = 0, active_col = 0; i < detection_flags.size(); ++i) {
+        if (detection_flags[i] & column_parse::enabled) {
+          if (column_types[active_col].id() != type_id::EMPTY) {
+            detection_flags[i] &= static_cast<column_parse::flags>(~column_parse::enabled);
+          }
+          ++active_col;
+        }
+      }
+      auto const inferred_types = infer_column_types(  //
+        parse_opts,
+        detection_flags,
+        data,
+        row_offsets,
+        num_records,
+        num_unknown,
+        reader_opts.get_timestamp_type(),
+        stream);
+      auto inferred_it = inferred_types.begin();
+      for (auto& type : column_types) {
+        if (type.id() == type_id::EMPTY) { type = *inferred_it++; }
+      }
+    }
   }
 
   out_columns.reserve(column_types.size());
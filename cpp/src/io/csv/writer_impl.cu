@@ -371,11 +371,26 @@ void writer::impl::write_chunked(strings_column_view const& str_column_view,
   char const* ptr_all_bytes = strings_column.chars_begin();
 
   if (out_sink_->is_device_write_preferred(total_num_bytes)) {
+    // Wait for any queued host writes first so chunks land in the sink in order
+    for (auto& task : write_tasks_) {
+      task.wait();
+    }
+    write_tasks_.clear();
+
     // Direct write from device memory
     out_sink_->device_write(ptr_all_bytes, total_num_bytes, stream);
+
+    // Needs newline at the end, to separate from next chunk
+    if (out_sink_->is_device_write_preferred(newline.size())) {
+      out_sink_->device_write(newline.data(), newline.size(), stream);
+    } else {
+      out_sink_->host_write(options_.get_line_terminator().data(),
+                            options_.get_line_terminator().size());
+    }
   } else {
-    // copy the bytes to host to write them out
-    thrust::host_vector<char> h_bytes(total_num_bytes);
+    // copy the bytes to host, then queue the sink write so it overlaps with the
+    // string conversion of the next chunk
+    std::vector<char> h_bytes(total_num_bytes);
     CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
                              ptr_all_bytes,
                              total_num_bytes * sizeof(char),
@@ -383,15 +398,12 @@ void writer::impl::write_chunked(strings_column_view const& str_column_view,
                              stream.value()));
     stream.synchronize();
 
-    out_sink_->host_write(h_bytes.data(), total_num_bytes);
-  }
-
-  // Needs newline at the end, to separate from next chunk
-  if (out_sink_->is_device_write_preferred(newline.size())) {
-    out_sink_->device_write(newline.data(), newline.size(), stream);
-  } else {
-    out_sink_->host_write(options_.get_line_terminator().data(),
-                          options_.get_line_terminator().size());
+    write_tasks_.push_back(write_pool_.submit(
+      [this, h_bytes = std::move(h_bytes), terminator = options_.get_line_terminator()]() {
+        out_sink_->host_write(h_bytes.data(), h_bytes.size());
+        // Needs newline at the end, to separate from next chunk
+        out_sink_->host_write(terminator.data(), terminator.size());
+      }));
   }
 }
 
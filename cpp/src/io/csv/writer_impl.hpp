@@ -21,6 +21,7 @@
 
 #include <cudf/strings/strings_column_view.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
@@ -30,6 +31,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -102,13 +104,22 @@ class writer::impl {
                          const table_metadata* metadata = nullptr,
                          rmm::cuda_stream_view stream   = rmm::cuda_stream_default)
   {
-    // purposely no-op (for now);
+    // drain host writes queued by `write_chunked`
+    for (auto& task : write_tasks_) {
+      task.wait();
+    }
+    write_tasks_.clear();
   }
 
  private:
   std::unique_ptr<data_sink> out_sink_;
   rmm::mr::device_memory_resource* mr_ = nullptr;
   csv_writer_options const options_;
+
+  // Single-threaded pool so queued host writes land in the sink in submission order, while
+  // the next chunk's string conversion proceeds on the calling thread
+  cudf::detail::thread_pool write_pool_{1};
+  std::vector<std::future<void>> write_tasks_;
 };
 
 std::unique_ptr<column> pandas_format_durations(
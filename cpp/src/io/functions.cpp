@@ -16,6 +16,7 @@
 
 #include <io/orc/orc.h>
 #include <algorithm>
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/io/avro.hpp>
 #include <cudf/io/csv.hpp>
@@ -115,7 +116,8 @@ std::vector<std::unique_ptr<cudf::io::datasource>> make_datasources(source_info
     case io_type::FILEPATH: {
       auto sources = std::vector<std::unique_ptr<cudf::io::datasource>>();
       for (auto const& filepath : info.filepaths) {
-        sources.emplace_back(cudf::io::datasource::create(filepath, range_offset, range_size));
+        sources.emplace_back(
+          cudf::io::datasource::create(filepath, range_offset, range_size, info.gds));
       }
       return sources;
     }
@@ -128,7 +130,7 @@ std::vector<std::unique_ptr<cudf::io::datasource>> make_datasources(source_info
 std::unique_ptr<data_sink> make_datasink(sink_info const& info)
 {
   switch (info.type) {
-    case io_type::FILEPATH: return cudf::io::data_sink::create(info.filepath);
+    case io_type::FILEPATH: return cudf::io::data_sink::create(info.filepath, info.gds);
     case io_type::HOST_BUFFER: return cudf::io::data_sink::create(info.buffer);
     case io_type::VOID: return cudf::io::data_sink::create();
     case io_type::USER_IMPLEMENTED: return cudf::io::data_sink::create(info.user_sink);
@@ -337,6 +339,22 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::read_orc_into
+ */
+void read_orc_into(orc_reader_options const& options, table& out)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(options.get_source());
+  auto reader = std::make_unique<detail_orc::reader>(std::move(datasources),
+                                                options,
+                                                rmm::cuda_stream_default,
+                                                rmm::mr::get_current_device_resource());
+
+  reader->read_into(options, out);
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -404,6 +422,66 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::read_parquet_into
+ */
+void read_parquet_into(parquet_reader_options const& options, table& out)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(options.get_source());
+  auto reader = std::make_unique<detail_parquet::reader>(std::move(datasources),
+                                                options,
+                                                rmm::cuda_stream_default,
+                                                rmm::mr::get_current_device_resource());
+
+  reader->read_into(options, out);
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_metadata
+ */
+std::vector<parquet_file_metadata> read_parquet_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(src_info);
+  return detail_parquet::read_parquet_metadata(datasources);
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::chunked_parquet_reader
+ */
+chunked_parquet_reader::chunked_parquet_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto datasources = make_datasources(options.get_source());
+
+  reader = std::make_unique<detail_parquet::chunked_reader>(
+    chunk_read_limit, std::move(datasources), options, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::~chunked_parquet_reader
+ */
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::has_next
+ */
+bool chunked_parquet_reader::has_next() const { return reader->has_next(); }
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+ */
+table_with_metadata chunked_parquet_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::merge_rowgroup_metadata
  */
@@ -454,6 +532,7 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(parquet_writer_options const
  */
 parquet_chunked_writer::parquet_chunked_writer(chunked_parquet_writer_options const& options,
                                                rmm::mr::device_memory_resource* mr)
+  : target_row_group_rows(options.get_target_row_group_rows())
 {
   namespace io_detail = cudf::io::detail;
 
@@ -463,6 +542,11 @@ parquet_chunked_writer::parquet_chunked_writer(chunked_parquet_writer_options co
     std::move(sink), options, io_detail::SingleWriteMode::NO, rmm::cuda_stream_default, mr);
 }
 
+// Defined here so the buffered tables' destructor sees the complete cudf::table type
+parquet_chunked_writer::~parquet_chunked_writer()                                   = default;
+parquet_chunked_writer::parquet_chunked_writer(parquet_chunked_writer&&)            = default;
+parquet_chunked_writer& parquet_chunked_writer::operator=(parquet_chunked_writer&&) = default;
+
 /**
  * @copydoc cudf::io::parquet_chunked_writer::write
  */
@@ -470,11 +554,39 @@ parquet_chunked_writer& parquet_chunked_writer::write(table_view const& table)
 {
   CUDF_FUNC_RANGE();
 
+  if (target_row_group_rows > 0) {
+    // Coalescing mode: own a copy of the batch and only hand the writer a row
+    // group's worth of rows at a time
+    buffered_tables.push_back(std::make_unique<cudf::table>(table));
+    buffered_rows += table.num_rows();
+    if (buffered_rows >= target_row_group_rows) { flush_buffered(); }
+    return *this;
+  }
+
   writer->write(table);
 
   return *this;
 }
 
+void parquet_chunked_writer::flush_buffered()
+{
+  if (buffered_tables.empty()) { return; }
+  if (buffered_tables.size() == 1) {
+    writer->write(buffered_tables.front()->view());
+  } else {
+    std::vector<table_view> views;
+    views.reserve(buffered_tables.size());
+    std::transform(buffered_tables.begin(),
+                   buffered_tables.end(),
+                   std::back_inserter(views),
+                   [](auto const& buffered) { return buffered->view(); });
+    auto const coalesced = cudf::concatenate(views);
+    writer->write(coalesced->view());
+  }
+  buffered_tables.clear();
+  buffered_rows = 0;
+}
+
 /**
  * @copydoc cudf::io::parquet_chunked_writer::close
  */
@@ -482,6 +594,7 @@ std::unique_ptr<std::vector<uint8_t>> parquet_chunked_writer::close(
   std::string const& column_chunks_file_path)
 {
   CUDF_FUNC_RANGE();
+  flush_buffered();
   return writer->close(column_chunks_file_path);
 }
 
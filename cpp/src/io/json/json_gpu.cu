@@ -340,7 +340,8 @@ __device__ field_descriptor next_field_descriptor(const char* begin,
   auto const desc_pre_trim =
     col_map.capacity() == 0
       // No key - column and begin are trivial
-      ? field_descriptor{field_idx, begin, cudf::io::gpu::seek_field_end(begin, end, opts, true)}
+      ? field_descriptor{
+          field_idx, begin, cudf::io::gpu::seek_field_end(begin, end, opts, true, true)}
       : [&]() {
           auto const key_range = get_next_key(begin, end, opts.quotechar);
           auto const key_hash  = MurmurHash3_32<cudf::string_view>{}(
@@ -352,7 +353,7 @@ __device__ field_descriptor next_field_descriptor(const char* begin,
           // Skip the colon between the key and the value
           auto const value_begin = thrust::find(thrust::seq, key_range.second, end, ':') + 1;
           return field_descriptor{
-            column, value_begin, cudf::io::gpu::seek_field_end(value_begin, end, opts, true)};
+            column, value_begin, cudf::io::gpu::seek_field_end(value_begin, end, opts, true, true)};
         }();
 
   // Modify start & end to ignore whitespace and quotechars
@@ -511,6 +512,11 @@ __global__ void detect_data_types_kernel(
       atomicAdd(&column_infos[desc.column].string_count, 1);
       continue;
     }
+    // Nested objects and lists are passed through whole, as strings
+    if (*desc.value_begin == '{' || *desc.value_begin == '[') {
+      atomicAdd(&column_infos[desc.column].string_count, 1);
+      continue;
+    }
 
     int digit_count    = 0;
     int decimal_count  = 0;
@@ -618,7 +624,7 @@ __device__ key_value_range get_next_key_value_range(char const* begin,
   if (colon == end) return {end, end, end};
 
   // Field value (including delimiters)
-  auto const value_end = cudf::io::gpu::seek_field_end(colon + 1, end, opts, true);
+  auto const value_end = cudf::io::gpu::seek_field_end(colon + 1, end, opts, true, true);
   return {key_range.first, key_range.second, colon + 1, value_end};
 }
 
@@ -21,6 +21,7 @@
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/staging_copy.hpp>
 #include <io/utilities/type_conversion.hpp>
 
 #include <cudf/column/column_factories.hpp>
@@ -332,9 +333,12 @@ rmm::device_uvector<char> upload_data_to_device(json_reader_options const& reade
   CUDF_EXPECTS(bytes_to_upload <= h_data.size(),
                "Error finding the record within the specified byte range.\n");
 
-  // Upload the raw data that is within the rows of interest
-  return cudf::detail::make_device_uvector_async(h_data.subspan(start_offset, bytes_to_upload),
-                                                 stream);
+  // Upload the raw data that is within the rows of interest, staging the pageable
+  // source through pinned chunks for full H2D bandwidth
+  auto d_data = rmm::device_uvector<char>(bytes_to_upload, stream);
+  cudf::io::detail::copy_to_device_staged(
+    d_data.data(), h_data.data() + start_offset, bytes_to_upload, stream);
+  return d_data;
 }
 
 std::pair<std::vector<std::string>, col_map_ptr_type> get_column_names_and_map(
@@ -587,7 +591,8 @@ table_with_metadata read_json(std::vector<std::unique_ptr<datasource>>& sources,
   auto d_data = rmm::device_uvector<char>(0, stream);
 
   if (should_load_whole_source(reader_opts)) {
-    d_data = cudf::detail::make_device_uvector_async(h_data, stream);
+    d_data.resize(h_data.size(), stream);
+    cudf::io::detail::copy_to_device_staged(d_data.data(), h_data.data(), h_data.size(), stream);
   }
 
   auto rec_starts = find_record_starts(reader_opts, h_data, d_data, stream);
@@ -16,8 +16,22 @@
 
 #include "aggregate_orc_metadata.hpp"
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
 #include <algorithm>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <numeric>
+#include <thread>
+#include <unordered_map>
 
 namespace cudf::io::orc::detail {
 
@@ -91,17 +105,206 @@ void add_column_to_mapping(std::map<size_type, std::vector<size_type>>& selected
 
 /**
  * @brief Create a metadata object from each element in the source vector
+ *
+ * Footers of sources that were not parsed before are parsed in parallel on the thread pool.
+ * Parses of file-backed sources are cached, keyed on the source's `content_id` (path,
+ * modification time and size), so repeated reads of a growing partitioned dataset only pay for
+ * the files added since the last read. The cached instance's stale source pointer is never
+ * used; every returned metadata is rebound to the source of the current call.
  */
 auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
 {
+  static std::mutex cache_mutex;
+  static std::unordered_map<std::string, std::shared_ptr<metadata const>> footer_cache;
+  constexpr size_t max_cached_footers = 16384;
+
+  std::vector<std::string> keys(sources.size());
+  std::vector<std::shared_ptr<metadata const>> parsed(sources.size());
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    for (size_t i = 0; i < sources.size(); ++i) {
+      keys[i] = sources[i]->content_id();
+      if (not keys[i].empty()) {
+        auto const it = footer_cache.find(keys[i]);
+        if (it != footer_cache.end()) { parsed[i] = it->second; }
+      }
+    }
+  }
+
+  static cudf::detail::thread_pool pool(std::thread::hardware_concurrency());
+  std::vector<std::future<std::shared_ptr<metadata const>>> parse_tasks(sources.size());
+  for (size_t i = 0; i < sources.size(); ++i) {
+    if (parsed[i] == nullptr) {
+      parse_tasks[i] = pool.submit(
+        [](datasource* source) { return std::make_shared<metadata const>(source); },
+        sources[i].get());
+    }
+  }
+
   std::vector<metadata> metadatas;
-  std::transform(
-    sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-      return metadata(source.get());
-    });
+  metadatas.reserve(sources.size());
+  for (size_t i = 0; i < sources.size(); ++i) {
+    if (parse_tasks[i].valid()) { parsed[i] = parse_tasks[i].get(); }
+    metadatas.emplace_back(*parsed[i], sources[i].get());
+  }
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  if (footer_cache.size() + sources.size() > max_cached_footers) { footer_cache.clear(); }
+  for (size_t i = 0; i < sources.size(); ++i) {
+    if (not keys[i].empty()) { footer_cache.emplace(keys[i], parsed[i]); }
+  }
   return metadatas;
 }
 
+/**
+ * @brief Functor to read the host value of a filter literal as a double.
+ */
+struct literal_as_double {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  double operator()(cudf::scalar const& s) const
+  {
+    return static_cast<double>(
+      static_cast<cudf::numeric_scalar<T> const&>(s).value(rmm::cuda_stream_default));
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  double operator()(cudf::scalar const& s) const
+  {
+    return static_cast<double>(static_cast<cudf::timestamp_scalar<T> const&>(s)
+                                 .value(rmm::cuda_stream_default)
+                                 .time_since_epoch()
+                                 .count());
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+  double operator()(cudf::scalar const& s) const
+  {
+    return static_cast<double>(
+      static_cast<cudf::duration_scalar<T> const&>(s).value(rmm::cuda_stream_default).count());
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_arithmetic<T>::value and not cudf::is_timestamp<T>() and
+                             not cudf::is_duration<T>()>* = nullptr>
+  double operator()(cudf::scalar const&) const
+  {
+    CUDF_FAIL("Unsupported literal type for statistics-based stripe filtering");
+  }
+};
+
+/**
+ * @brief Decodes a column statistics blob to a min/max pair of doubles.
+ *
+ * @return true if the statistics contain a usable minimum and maximum
+ */
+bool stats_min_max_as_double(ColStatsBlob const& blob, double& min, double& max)
+{
+  column_statistics stats;
+  ProtobufReader(blob.data(), blob.size()).read(stats);
+
+  auto const read_minmax = [&](auto const& minmax_stats) {
+    if (not minmax_stats.minimum.has_value() or not minmax_stats.maximum.has_value()) {
+      return false;
+    }
+    min = static_cast<double>(*minmax_stats.minimum);
+    max = static_cast<double>(*minmax_stats.maximum);
+    return true;
+  };
+  if (stats.int_stats) { return read_minmax(*stats.int_stats); }
+  if (stats.double_stats) { return read_minmax(*stats.double_stats); }
+  if (stats.date_stats) { return read_minmax(*stats.date_stats); }
+  // String, decimal, and timestamp statistics are not used for filtering
+  return false;
+}
+
+/**
+ * @brief Conservative evaluator of an AST predicate against stripe statistics.
+ *
+ * Answers whether any row of a stripe *may* satisfy the predicate. Only comparisons
+ * between a column reference and a literal, combined with logical AND/OR, are
+ * understood; any other sub-expression conservatively evaluates to "may match" so
+ * that no stripe is pruned incorrectly.
+ */
+class stripe_stats_filter {
+ public:
+  stripe_stats_filter(std::function<ColStatsBlob const*(size_type)> column_stats)
+    : _column_stats(std::move(column_stats))
+  {
+  }
+
+  bool may_match(ast::expression const& expr) const
+  {
+    auto const* op = dynamic_cast<ast::operation const*>(&expr);
+    if (op == nullptr) { return true; }
+
+    auto const operands = op->get_operands();
+    switch (op->get_operator()) {
+      case ast::ast_operator::LOGICAL_AND:
+      case ast::ast_operator::NULL_LOGICAL_AND:
+        return may_match(operands[0]) and may_match(operands[1]);
+      case ast::ast_operator::LOGICAL_OR:
+      case ast::ast_operator::NULL_LOGICAL_OR:
+        return may_match(operands[0]) or may_match(operands[1]);
+      case ast::ast_operator::EQUAL:
+      case ast::ast_operator::NOT_EQUAL:
+      case ast::ast_operator::LESS:
+      case ast::ast_operator::LESS_EQUAL:
+      case ast::ast_operator::GREATER:
+      case ast::ast_operator::GREATER_EQUAL:
+        return comparison_may_match(op->get_operator(), operands[0], operands[1]);
+      default: return true;
+    }
+  }
+
+ private:
+  bool comparison_may_match(ast::ast_operator op,
+                            ast::expression const& lhs,
+                            ast::expression const& rhs) const
+  {
+    auto const* col = dynamic_cast<ast::column_reference const*>(&lhs);
+    auto const* lit = dynamic_cast<ast::literal const*>(&rhs);
+    if (col == nullptr or lit == nullptr) {
+      // Accept the flipped `literal op column` form by mirroring the operator
+      col = dynamic_cast<ast::column_reference const*>(&rhs);
+      lit = dynamic_cast<ast::literal const*>(&lhs);
+      if (col == nullptr or lit == nullptr) { return true; }
+      op = flip_comparison(op);
+    }
+
+    auto const* stats_blob = _column_stats(col->get_column_index());
+    if (stats_blob == nullptr) { return true; }
+
+    double min, max;
+    if (not stats_min_max_as_double(*stats_blob, min, max)) { return true; }
+
+    auto const value =
+      cudf::type_dispatcher(lit->get_data_type(), literal_as_double{}, lit->get_scalar());
+
+    switch (op) {
+      case ast::ast_operator::EQUAL: return value >= min and value <= max;
+      case ast::ast_operator::NOT_EQUAL: return not(min == max and value == min);
+      case ast::ast_operator::LESS: return min < value;
+      case ast::ast_operator::LESS_EQUAL: return min <= value;
+      case ast::ast_operator::GREATER: return max > value;
+      case ast::ast_operator::GREATER_EQUAL: return max >= value;
+      default: return true;
+    }
+  }
+
+  static ast::ast_operator flip_comparison(ast::ast_operator op)
+  {
+    switch (op) {
+      case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+      case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+      case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+      case ast::ast_operator::GREATER_EQUAL: return ast::ast_operator::LESS_EQUAL;
+      default: return op;
+    }
+  }
+
+  std::function<ColStatsBlob const*(size_type)> _column_stats;
+};
+
 }  // namespace
 
 size_type aggregate_orc_metadata::calc_num_rows() const
@@ -245,6 +448,51 @@ std::vector<metadata::stripe_source_mapping> aggregate_orc_metadata::select_stri
   return selected_stripes_mapping;
 }
 
+std::vector<std::vector<size_type>> aggregate_orc_metadata::filter_stripes(
+  std::vector<std::vector<size_type>> const& user_specified_stripes,
+  ast::expression const& filter,
+  std::vector<size_type> const& output_column_ids) const
+{
+  if (not user_specified_stripes.empty()) {
+    CUDF_EXPECTS(user_specified_stripes.size() == per_file_metadata.size(),
+                 "Must specify stripes for each source");
+  }
+
+  std::vector<std::vector<size_type>> filtered_stripes(per_file_metadata.size());
+  for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+    auto const& pfm = per_file_metadata[src_idx];
+
+    std::vector<size_type> candidate_stripes;
+    if (not user_specified_stripes.empty()) {
+      candidate_stripes = user_specified_stripes[src_idx];
+    } else {
+      candidate_stripes.resize(pfm.ff.stripes.size());
+      std::iota(candidate_stripes.begin(), candidate_stripes.end(), 0);
+    }
+
+    for (auto const stripe_idx : candidate_stripes) {
+      CUDF_EXPECTS(stripe_idx >= 0 and static_cast<size_t>(stripe_idx) < pfm.ff.stripes.size(),
+                   "Invalid stripe index");
+      // Returns the statistics blob for the referenced output column, if present
+      auto const column_stats = [&](size_type col_idx) -> ColStatsBlob const* {
+        if (static_cast<size_t>(stripe_idx) >= pfm.md.stripeStats.size()) { return nullptr; }
+        if (col_idx < 0 or static_cast<size_t>(col_idx) >= output_column_ids.size()) {
+          return nullptr;
+        }
+        auto const& col_stats = pfm.md.stripeStats[stripe_idx].colStats;
+        auto const col_id     = output_column_ids[col_idx];
+        if (static_cast<size_t>(col_id) >= col_stats.size()) { return nullptr; }
+        return &col_stats[col_id];
+      };
+      if (stripe_stats_filter{column_stats}.may_match(filter)) {
+        filtered_stripes[src_idx].push_back(stripe_idx);
+      }
+    }
+  }
+
+  return filtered_stripes;
+}
+
 column_hierarchy aggregate_orc_metadata::select_columns(
   std::vector<std::string> const& column_paths)
 {
@@ -19,6 +19,12 @@
 #include <map>
 #include <vector>
 
+namespace cudf {
+namespace ast {
+struct expression;
+}  // namespace ast
+}  // namespace cudf
+
 namespace cudf::io::orc::detail {
 
 /**
@@ -115,6 +121,25 @@ class aggregate_orc_metadata {
     size_type& row_start,
     size_type& row_count);
 
+  /**
+   * @brief Prunes stripes whose column statistics cannot satisfy a predicate.
+   *
+   * Evaluates the predicate against the per-stripe statistics from the metadata
+   * section of each file. Stripes without usable statistics are conservatively kept.
+   *
+   * @param user_specified_stripes Explicitly requested stripes, one list per source;
+   * empty means all
+   * @param filter Predicate to evaluate against the stripe statistics
+   * @param output_column_ids ORC column id of each top-level output column the filter
+   * may reference
+   *
+   * @return Surviving stripe indices, one list per source
+   */
+  std::vector<std::vector<size_type>> filter_stripes(
+    std::vector<std::vector<size_type>> const& user_specified_stripes,
+    ast::expression const& filter,
+    std::vector<size_type> const& output_column_ids) const;
+
   /**
    * @brief Filters ORC file to a selection of columns, based on their paths in the file.
    *
@@ -466,6 +466,20 @@ metadata::metadata(datasource* const src) : source(src)
   init_column_names();
 }
 
+metadata::metadata(metadata const& other, datasource* const src)
+  : ps(other.ps),
+    ff(other.ff),
+    md(other.md),
+    stripefooters(other.stripefooters),
+    decompressor(
+      std::make_unique<OrcDecompressor>(other.ps.compression, other.ps.compressionBlockSize)),
+    source(src),
+    parents(other.parents),
+    column_names(other.column_names),
+    column_paths(other.column_paths)
+{
+}
+
 void metadata::init_column_names()
 {
   column_names.resize(get_num_columns());
@@ -583,6 +583,14 @@ class metadata {
  public:
   explicit metadata(datasource* const src);
 
+  /**
+   * @brief Copies already-parsed metadata, rebinding it to a different source.
+   *
+   * Used by the footer cache to reuse a parse across reads of an unchanged file; only the
+   * source pointer and the (cheap) decompressor are fresh.
+   */
+  metadata(metadata const& other, datasource* const src);
+
   size_t get_total_rows() const { return ff.numberOfRows; }
   int get_num_stripes() const { return ff.stripes.size(); }
   int get_num_columns() const { return ff.types.size(); }
@@ -877,6 +877,11 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
 
   // Control decimals conversion (float64 or int64 with optional scale)
   _decimal_cols_as_float = options.get_decimal_cols_as_float();
+
+  _filter = options.get_filter();
+  CUDF_EXPECTS(
+    not _filter.has_value() or (options.get_skip_rows() == 0 and options.get_num_rows() == -1),
+    "Stripe filtering cannot be combined with skip_rows/num_rows");
 }
 
 timezone_table reader::impl::compute_timezone_table(
@@ -919,8 +924,19 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   if (selected_columns.num_levels() == 0)
     return {std::make_unique<table>(), std::move(out_metadata)};
 
+  // Prune stripes whose statistics prove the filter cannot be satisfied
+  auto const filtered_stripes = [&]() -> std::vector<std::vector<size_type>> {
+    if (not _filter.has_value()) { return stripes; }
+    std::vector<size_type> output_column_ids;
+    std::transform(selected_columns.levels[0].cbegin(),
+                   selected_columns.levels[0].cend(),
+                   std::back_inserter(output_column_ids),
+                   [](auto const& col_meta) { return col_meta.id; });
+    return _metadata.filter_stripes(stripes, _filter.value().get(), output_column_ids);
+  }();
+
   // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata.select_stripes(stripes, skip_rows, num_rows);
+  const auto selected_stripes = _metadata.select_stripes(filtered_stripes, skip_rows, num_rows);
 
   auto const tz_table = compute_timezone_table(selected_stripes, stream);
 
@@ -1072,13 +1088,20 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                len));
 
             } else {
-              const auto buffer =
-                _metadata.per_file_metadata[stripe_source_mapping.source_idx].source->host_read(
-                  offset, len);
-              CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
-              CUDA_TRY(cudaMemcpyAsync(
-                d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-              stream.synchronize();
+              // Stage the read through the pool so that reads of separate stripes overlap
+              // instead of serializing on the calling thread
+              auto* const source =
+                _metadata.per_file_metadata[stripe_source_mapping.source_idx].source;
+              read_tasks.push_back(std::make_pair(
+                _read_pool.submit([source, d_dst, offset, len, stream]() -> size_t {
+                  const auto buffer = source->host_read(offset, len);
+                  CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
+                  CUDA_TRY(cudaMemcpyAsync(
+                    d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
+                  stream.synchronize();
+                  return len;
+                }),
+                len));
             }
           }
 
@@ -1211,7 +1234,20 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           auto n_rows       = (level == 0) ? num_rows : _col_meta.num_child_rows[i];
           // For list column, offset column will be always size + 1
           if (is_list_type) n_rows++;
-          out_buffers[level].emplace_back(column_types[i], n_rows, is_nullable, stream, _mr);
+          if (_external_output != nullptr and level == 0) {
+            // decode directly into the caller's pre-allocated column
+            auto& out_col = _external_output->get_column(static_cast<size_type>(i));
+            CUDF_EXPECTS(out_col.type() == column_types[i],
+                         "Destination column type does not match the file schema");
+            auto view = out_col.mutable_view();
+            column_buffer buffer(column_types[i], is_nullable);
+            buffer.set_external(
+              view.head<void>(), out_col.nullable() ? view.null_mask() : nullptr, out_col.size());
+            buffer.create(n_rows, stream, _mr);
+            out_buffers[level].push_back(std::move(buffer));
+          } else {
+            out_buffers[level].emplace_back(column_types[i], n_rows, is_nullable, stream, _mr);
+          }
         }
 
         if (not is_data_empty) {
@@ -1255,6 +1291,21 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     }
   }
 
+  // In read_into mode the data was decoded directly into the caller's columns, so only
+  // the null counts need updating.
+  if (_external_output != nullptr) {
+    CUDF_EXPECTS(
+      std::all_of(out_buffers[0].cbegin(),
+                  out_buffers[0].cend(),
+                  [&](auto const& buffer) { return buffer.size == _external_output->num_rows(); }),
+      "Destination table row count does not match the decoded row count");
+    for (size_t i = 0; i < out_buffers[0].size(); ++i) {
+      _external_output->get_column(static_cast<size_type>(i))
+        .set_null_count(out_buffers[0][i].null_count());
+    }
+    return {std::make_unique<table>(), std::move(out_metadata)};
+  }
+
   // If out_columns is empty, then create columns from buffer.
   if (out_columns.empty()) {
     create_columns(std::move(out_buffers), out_columns, schema_info, stream);
@@ -1278,6 +1329,28 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+void reader::impl::read_into(size_type skip_rows,
+                             size_type num_rows,
+                             const std::vector<std::vector<size_type>>& stripes,
+                             table& out,
+                             rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(selected_columns.num_levels() <= 1, "read_into does not support nested columns");
+  CUDF_EXPECTS(selected_columns.num_levels() == 0 or
+                 out.num_columns() ==
+                   static_cast<size_type>(selected_columns.levels[0].size()),
+               "Destination table column count does not match the file schema");
+
+  _external_output = &out;
+  try {
+    read(skip_rows, num_rows, stripes, stream);
+  } catch (...) {
+    _external_output = nullptr;
+    throw;
+  }
+  _external_output = nullptr;
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                orc_reader_options const& options,
@@ -1297,6 +1370,13 @@ table_with_metadata reader::read(orc_reader_options const& options, rmm::cuda_st
     options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
 }
 
+// Forward to implementation
+void reader::read_into(orc_reader_options const& options, table& out, rmm::cuda_stream_view stream)
+{
+  _impl->read_into(
+    options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), out, stream);
+}
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
@@ -22,7 +22,9 @@
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/orc.hpp>
@@ -30,6 +32,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -101,6 +104,25 @@ class reader::impl {
                            const std::vector<std::vector<size_type>>& stripes,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Decodes the dataset into the caller's pre-allocated columns.
+   *
+   * The destination must match the file schema: one fixed-width, non-nested column per
+   * output column, with matching types, exactly as many rows as will be decoded, and a
+   * null mask wherever the file can produce nulls. No output memory is allocated.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param stripes Indices of individual stripes to load if non-empty
+   * @param out Table whose columns receive the decoded data
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void read_into(size_type skip_rows,
+                 size_type num_rows,
+                 const std::vector<std::vector<size_type>>& stripes,
+                 table& out,
+                 rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Decompresses the stripe data, at stream granularity
@@ -221,9 +243,17 @@ class reader::impl {
 
   bool _use_index     = true;
   bool _use_np_dtypes = true;
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
   std::vector<std::string> _decimal_cols_as_float;
   data_type _timestamp_type{type_id::EMPTY};
   reader_column_meta _col_meta;
+  // destination table for read_into(); when set, decoding writes into its columns
+  // instead of materializing new ones
+  table* _external_output = nullptr;
+
+  // Pool used to overlap the host reads of stripe data across stripes and sources; the
+  // benefit from multithreaded read plateaus around 16 threads
+  cudf::detail::thread_pool _read_pool{16};
 };
 
 }  // namespace orc
@@ -1224,7 +1224,9 @@ __global__ void __launch_bounds__(1024)
         min(comp_blk_size, ss.stream_size - min(b * comp_blk_size, ss.stream_size));
       uint32_t dst_len = (blk_out->status == 0) ? blk_out->bytes_written : src_len;
       uint32_t blk_size24;
-      if (dst_len >= src_len) {
+      // Store the block uncompressed if compression does not save at least ~5% (ratio < 1.05);
+      // a marginal size reduction is not worth the decompression cost on read
+      if (dst_len * 21 >= src_len * 20) {
         // Copy from uncompressed source
         src                    = static_cast<const uint8_t*>(blk_in->srcDevice);
         blk_out->bytes_written = src_len;
@@ -32,6 +32,7 @@
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_pool.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
@@ -388,6 +389,15 @@ void init_dictionaries(orc_table_view& orc_table,
   dict->device_to_host(stream, true);
 }
 
+/**
+ * @brief Maximum ratio of unique to total strings for dictionary encoding to be used.
+ *
+ * Matches the default key size threshold of the Java ORC writer; above this ratio the index and
+ * length streams outweigh the size saved by deduplication, so the per-stripe sort and merge of
+ * the chunk dictionaries is not worth performing.
+ */
+constexpr double max_dictionary_unique_ratio = 0.8;
+
 void writer::impl::build_dictionaries(orc_table_view& orc_table,
                                       host_span<stripe_rowgroups const> stripe_bounds,
                                       hostdevice_2dvector<gpu::DictionaryChunk> const& dict,
@@ -419,8 +429,10 @@ void writer::impl::build_dictionaries(orc_table_view& orc_table,
 
     if (enable_dictionary_) {
       struct string_column_cost {
-        size_t direct     = 0;
-        size_t dictionary = 0;
+        size_t direct       = 0;
+        size_t dictionary   = 0;
+        size_t total_count  = 0;
+        size_t unique_count = 0;
       };
       auto const col_cost =
         std::accumulate(stripe_bounds.front().cbegin(),
@@ -429,11 +441,18 @@ void writer::impl::build_dictionaries(orc_table_view& orc_table,
                         [&](auto cost, auto rg_idx) -> string_column_cost {
                           const auto& dt = dict[rg_idx][dict_idx];
                           return {cost.direct + dt.string_char_count,
-                                  cost.dictionary + dt.dict_char_count + dt.num_dict_strings};
+                                  cost.dictionary + dt.dict_char_count + dt.num_dict_strings,
+                                  cost.total_count + dt.num_strings,
+                                  cost.unique_count + dt.num_dict_strings};
                         });
-      // Disable dictionary if it does not reduce the output size
+      // Strings are only deduplicated within each chunk at this point, so the summed chunk
+      // counts overestimate the number of unique strings in the column
+      auto const high_cardinality =
+        col_cost.unique_count > max_dictionary_unique_ratio * col_cost.total_count;
+      // Disable dictionary if it does not reduce the output size, or if the cardinality is too
+      // high for dictionary encoding to pay off
       if (!dictionary_enabled[orc_table.string_column(dict_idx).index()] ||
-          col_cost.dictionary >= col_cost.direct) {
+          col_cost.dictionary >= col_cost.direct || high_cardinality) {
         for (auto const& stripe : stripe_bounds) {
           stripe_dict[stripe.id][dict_idx].dict_data = nullptr;
         }
@@ -1839,25 +1858,37 @@ void writer::impl::write(table_view const& table)
     nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
       compression_blocksize_, nvcompBatchedSnappyDefaultOpts, &max_compressed_block_size);
   }
+  // Ranges of compressed blocks, per stripe; used to compress and copy back each stripe
+  // independently of the others
+  std::vector<uint32_t> stripe_first_blocks;
+  stripe_first_blocks.reserve(segmentation.num_stripes() + 1);
   auto stream_output = [&]() {
     size_t max_stream_size = 0;
     bool all_device_write  = true;
 
-    for (auto& ss : strm_descs.host_view().flat_view()) {
-      if (!out_sink_->is_device_write_preferred(ss.stream_size)) { all_device_write = false; }
-      size_t stream_size = ss.stream_size;
-      if (compression_kind_ != NONE) {
-        ss.first_block = num_compressed_blocks;
-        ss.bfr_offset  = compressed_bfr_size;
-
-        auto num_blocks = std::max<uint32_t>(
-          (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
-        stream_size += num_blocks * BLOCK_HEADER_SIZE;
-        num_compressed_blocks += num_blocks;
-        compressed_bfr_size += (max_compressed_block_size + BLOCK_HEADER_SIZE) * num_blocks;
+    for (size_t stripe_id = 0; stripe_id < segmentation.num_stripes(); ++stripe_id) {
+      stripe_first_blocks.push_back(num_compressed_blocks);
+      uint32_t stripe_num_blocks = 0;
+      for (auto& ss : strm_descs[stripe_id]) {
+        if (!out_sink_->is_device_write_preferred(ss.stream_size)) { all_device_write = false; }
+        size_t stream_size = ss.stream_size;
+        if (compression_kind_ != NONE) {
+          // Block numbering restarts in each stripe so that compression can operate on
+          // per-stripe slices of the block arrays
+          ss.first_block = stripe_num_blocks;
+          ss.bfr_offset  = compressed_bfr_size;
+
+          auto num_blocks = std::max<uint32_t>(
+            (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
+          stream_size += num_blocks * BLOCK_HEADER_SIZE;
+          stripe_num_blocks += num_blocks;
+          compressed_bfr_size += (max_compressed_block_size + BLOCK_HEADER_SIZE) * num_blocks;
+        }
+        max_stream_size = std::max(max_stream_size, stream_size);
       }
-      max_stream_size = std::max(max_stream_size, stream_size);
+      num_compressed_blocks += stripe_num_blocks;
     }
+    stripe_first_blocks.push_back(num_compressed_blocks);
 
     if (all_device_write) {
       return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
@@ -1871,24 +1902,46 @@ void writer::impl::write(table_view const& table)
     }
   }();
 
-  // Compress the data streams
+  // Compress the data streams, stripe by stripe, so that writing earlier stripes to the sink
+  // can overlap with compression of the later ones
   rmm::device_buffer compressed_data(compressed_bfr_size, stream);
   hostdevice_vector<gpu_inflate_status_s> comp_out(num_compressed_blocks, stream);
   hostdevice_vector<gpu_inflate_input_s> comp_in(num_compressed_blocks, stream);
-  if (compression_kind_ != NONE) {
+  rmm::cuda_stream_pool comp_streams(compression_pool_.get_thread_count());
+  std::vector<std::future<void>> comp_tasks;
+  if (compression_kind_ != NONE and num_compressed_blocks != 0) {
     strm_descs.host_to_device(stream);
-    gpu::CompressOrcDataStreams(static_cast<uint8_t*>(compressed_data.data()),
-                                num_compressed_blocks,
-                                compression_kind_,
-                                compression_blocksize_,
-                                max_compressed_block_size,
-                                strm_descs,
-                                enc_data.streams,
-                                comp_in,
-                                comp_out,
-                                stream);
-    strm_descs.device_to_host(stream);
-    comp_out.device_to_host(stream, true);
+    stream.synchronize();
+    auto const num_data_streams = strm_descs.size().second;
+    for (size_t stripe_id = 0; stripe_id < segmentation.num_stripes(); ++stripe_id) {
+      uint32_t const first_block = stripe_first_blocks[stripe_id];
+      uint32_t const num_blocks  = stripe_first_blocks[stripe_id + 1] - first_block;
+      auto const comp_stream = comp_streams.get_stream(stripe_id % comp_streams.get_pool_size());
+      comp_tasks.push_back(compression_pool_.submit(
+        [&, stripe_id, first_block, num_blocks, num_data_streams, comp_stream]() {
+          gpu::CompressOrcDataStreams(static_cast<uint8_t*>(compressed_data.data()),
+                                      num_blocks,
+                                      compression_kind_,
+                                      compression_blocksize_,
+                                      max_compressed_block_size,
+                                      strm_descs.device_view().subspan(stripe_id, 1),
+                                      enc_data.streams,
+                                      {comp_in.device_ptr(first_block), num_blocks},
+                                      {comp_out.device_ptr(first_block), num_blocks},
+                                      comp_stream);
+          CUDA_TRY(cudaMemcpyAsync(strm_descs.base_host_ptr(stripe_id * num_data_streams),
+                                   strm_descs.base_device_ptr(stripe_id * num_data_streams),
+                                   num_data_streams * sizeof(gpu::StripeStream),
+                                   cudaMemcpyDeviceToHost,
+                                   comp_stream.value()));
+          CUDA_TRY(cudaMemcpyAsync(comp_out.host_ptr(first_block),
+                                   comp_out.device_ptr(first_block),
+                                   num_blocks * sizeof(gpu_inflate_status_s),
+                                   cudaMemcpyDeviceToHost,
+                                   comp_stream.value()));
+          comp_stream.synchronize();
+        }));
+    }
   }
 
   ProtobufWriter pbw_(&buffer_);
@@ -1899,9 +1952,16 @@ void writer::impl::write(table_view const& table)
     auto const& rowgroups_range = segmentation.stripes[stripe_id];
     auto& stripe                = stripes[stripe_id];
 
+    // Wait for the stripe's streams to be compressed and copied back to the host
+    if (not comp_tasks.empty()) { comp_tasks[stripe_id].wait(); }
+
     stripe.offset = out_sink_->bytes_written();
 
     // Column (skippable) index streams appear at the start of the stripe
+    auto const stripe_comp_out =
+      host_span<gpu_inflate_status_s const>{comp_out.host_ptr(stripe_first_blocks[stripe_id]),
+                                            stripe_first_blocks[stripe_id + 1] -
+                                              stripe_first_blocks[stripe_id]};
     for (size_type stream_id = 0; stream_id < num_index_streams; ++stream_id) {
       write_index_stream(stripe_id,
                          stream_id,
@@ -1909,7 +1969,7 @@ void writer::impl::write(table_view const& table)
                          rowgroups_range,
                          enc_data.streams,
                          strm_descs,
-                         comp_out,
+                         stripe_comp_out,
                          &stripe,
                          &streams,
                          &pbw_);
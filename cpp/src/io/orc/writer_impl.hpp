@@ -20,6 +20,7 @@
 #include "orc_gpu.h"
 
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
@@ -374,6 +375,9 @@ class writer::impl {
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
+  // Worker threads that compress later stripes on side streams while earlier stripes are
+  // flushed to the sink
+  cudf::detail::thread_pool compression_pool_{2};
 };
 
 }  // namespace orc
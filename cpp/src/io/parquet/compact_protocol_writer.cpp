@@ -117,6 +117,74 @@ size_t CompactProtocolWriter::write(const ColumnChunkMetaData& s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   if (s.statistics_blob.size() != 0) { c.field_struct_blob(12, s.statistics_blob); }
+  if (s.bloom_filter_offset >= 0) { c.field_int(14, s.bloom_filter_offset); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const PageLocation& p)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, p.offset);
+  c.field_int(2, p.compressed_page_size);
+  c.field_int(3, p.first_row_index);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const OffsetIndex& o)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct_list(1, o.page_locations);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const ColumnIndex& ci)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_bool_list(1, ci.null_pages);
+  c.field_binary_list(2, ci.min_values);
+  c.field_binary_list(3, ci.max_values);
+  c.field_int(4, static_cast<int32_t>(ci.boundary_order));
+  if (ci.null_counts.size() != 0) { c.field_int64_list(5, ci.null_counts); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterAlgorithm&)
+{
+  // Union with a single empty-struct member (SplitBlockAlgorithm BLOCK)
+  CompactProtocolFieldWriter c(*this);
+  c.put_field_header(1, c.current_field(), ST_FLD_STRUCT);
+  c.put_byte(0);  // SplitBlockAlgorithm struct end
+  c.set_current_field(1);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHash&)
+{
+  // Union with a single empty-struct member (XxHash XXHASH)
+  CompactProtocolFieldWriter c(*this);
+  c.put_field_header(1, c.current_field(), ST_FLD_STRUCT);
+  c.put_byte(0);  // XxHash struct end
+  c.set_current_field(1);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterCompression&)
+{
+  // Union with a single empty-struct member (Uncompressed UNCOMPRESSED)
+  CompactProtocolFieldWriter c(*this);
+  c.put_field_header(1, c.current_field(), ST_FLD_STRUCT);
+  c.put_byte(0);  // Uncompressed struct end
+  c.set_current_field(1);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHeader& b)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, b.num_bytes);
+  c.field_struct(2, b.algorithm);
+  c.field_struct(3, b.hash);
+  c.field_struct(4, b.compression);
   return c.value();
 }
 
@@ -156,6 +224,23 @@ void CompactProtocolFieldWriter::put_field_header(int f, int cur, int t)
   }
 }
 
+inline void CompactProtocolFieldWriter::field_bool(int field, bool val)
+{
+  put_field_header(field, current_field_value, val ? ST_FLD_TRUE : ST_FLD_FALSE);
+  current_field_value = field;
+}
+
+inline void CompactProtocolFieldWriter::field_bool_list(int field, const std::vector<bool>& val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto v : val) {
+    put_byte(v ? ST_FLD_TRUE : ST_FLD_FALSE);
+  }
+  current_field_value = field;
+}
+
 inline void CompactProtocolFieldWriter::field_int(int field, int32_t val)
 {
   put_field_header(field, current_field_value, ST_FLD_I32);
@@ -182,6 +267,18 @@ inline void CompactProtocolFieldWriter::field_int_list(int field, const std::vec
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_int64_list(int field,
+                                                         const std::vector<int64_t>& val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_I64));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto& v : val) {
+    put_int(v);
+  }
+  current_field_value = field;
+}
+
 template <typename T>
 inline void CompactProtocolFieldWriter::field_struct(int field, const T& val)
 {
@@ -217,6 +314,19 @@ inline void CompactProtocolFieldWriter::field_struct_blob(int field,
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_binary_list(
+  int field, const std::vector<std::vector<uint8_t>>& val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_BINARY));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto& v : val) {
+    put_uint(v.size());
+    put_byte(v.data(), (uint32_t)v.size());
+  }
+  current_field_value = field;
+}
+
 inline void CompactProtocolFieldWriter::field_string(int field, const std::string& val)
 {
   put_field_header(field, current_field_value, ST_FLD_BINARY);
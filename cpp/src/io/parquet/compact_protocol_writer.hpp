@@ -44,6 +44,13 @@ class CompactProtocolWriter {
   size_t write(const KeyValue&);
   size_t write(const ColumnChunk&);
   size_t write(const ColumnChunkMetaData&);
+  size_t write(const PageLocation&);
+  size_t write(const OffsetIndex&);
+  size_t write(const ColumnIndex&);
+  size_t write(const BloomFilterAlgorithm&);
+  size_t write(const BloomFilterHash&);
+  size_t write(const BloomFilterCompression&);
+  size_t write(const BloomFilterHeader&);
 
  protected:
   std::vector<uint8_t>& m_buf;
@@ -71,6 +78,10 @@ class CompactProtocolFieldWriter {
 
   void put_field_header(int f, int cur, int t);
 
+  inline void field_bool(int field, bool val);
+
+  inline void field_bool_list(int field, const std::vector<bool>& val);
+
   inline void field_int(int field, int32_t val);
 
   inline void field_int(int field, int64_t val);
@@ -78,6 +89,8 @@ class CompactProtocolFieldWriter {
   template <typename Enum>
   inline void field_int_list(int field, const std::vector<Enum>& val);
 
+  inline void field_int64_list(int field, const std::vector<int64_t>& val);
+
   template <typename T>
   inline void field_struct(int field, const T& val);
 
@@ -90,6 +103,8 @@ class CompactProtocolFieldWriter {
 
   inline void field_string(int field, const std::string& val);
 
+  inline void field_binary_list(int field, const std::vector<std::vector<uint8_t>>& val);
+
   inline void field_string_list(int field, const std::vector<std::string>& val);
 
   inline int current_field();
@@ -518,9 +518,14 @@ inline __device__ void gpuOutputString(volatile page_state_s* s, int src_pos, vo
 
   if (s->dict_base) {
     // String dictionary
-    uint32_t dict_pos = (s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] *
-                                               sizeof(string_index_pair)
-                                           : 0;
+    uint32_t dict_idx = (s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] : 0;
+    if (s->col.output_string_dict_index && s->dtype_len == 4) {
+      // Emit the dictionary index itself; the dictionary entries become the keys of the
+      // output dictionary column, so the string data is never materialized
+      *static_cast<uint32_t*>(dstv) = dict_idx + s->col.dict_index_base;
+      return;
+    }
+    uint32_t dict_pos = dict_idx * sizeof(string_index_pair);
     if (dict_pos < (uint32_t)s->dict_size) {
       const string_index_pair* src =
         reinterpret_cast<const string_index_pair*>(s->dict_base + dict_pos);
@@ -862,6 +867,39 @@ inline __device__ void gpuOutputFixedLenByteArrayAsInt64(volatile page_state_s*
   *dst = unscaled64;
 }
 
+/**
+ * @brief Output a fixed-length byte array(len <= 16) as a 128-bit int
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst Pointer to row output data
+ */
+inline __device__ void gpuOutputFixedLenByteArrayAsInt128(volatile page_state_s* s,
+                                                          int src_pos,
+                                                          __int128_t* dst)
+{
+  uint32_t const dtype_len_in = s->dtype_len_in;
+  uint8_t const* data         = s->dict_base ? s->dict_base : s->data_start;
+  uint32_t const pos =
+    (s->dict_base ? ((s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] : 0)
+                  : src_pos) *
+    dtype_len_in;
+  uint32_t const dict_size = s->dict_size;
+
+  __int128_t unscaled128 = 0;
+  for (unsigned int i = 0; i < dtype_len_in; i++) {
+    uint32_t v  = (pos + i < dict_size) ? data[pos + i] : 0;
+    unscaled128 = (unscaled128 << 8) | v;
+  }
+  // Shift the unscaled value up and back down when it isn't all 16 bytes,
+  // which sign extend the value for correctly representing negative numbers.
+  if (dtype_len_in < 16) {
+    unscaled128 <<= 128 - dtype_len_in * 8;
+    unscaled128 >>= 128 - dtype_len_in * 8;
+  }
+  *dst = unscaled128;
+}
+
 /**
  * @brief Output a small fixed-length value
  *
@@ -888,6 +926,30 @@ inline __device__ void gpuOutputFast(volatile page_state_s* s, int src_pos, T* d
   gpuStoreOutput(dst, dict, dict_pos, dict_size);
 }
 
+/**
+ * @brief Output a byte-stream-split encoded value
+ *
+ * The page stores the i-th byte of every value contiguously; the bytes of the value at
+ * `src_pos` are gathered from the per-byte streams. The number of values in the page is
+ * implied by the size of the value section.
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst8 Pointer to row output data
+ */
+inline __device__ void gpuOutputByteStreamSplit(volatile page_state_s* s,
+                                                int src_pos,
+                                                uint8_t* dst8)
+{
+  uint8_t const* const src  = s->data_start;
+  uint32_t const dtype_len  = s->dtype_len_in;
+  uint32_t const num_values = static_cast<uint32_t>(s->dict_size) / dtype_len;
+  if (static_cast<uint32_t>(src_pos) >= num_values) { return; }
+  for (uint32_t i = 0; i < dtype_len; i++) {
+    dst8[i] = src[i * num_values + src_pos];
+  }
+}
+
 /**
  * @brief Output a N-byte value
  *
@@ -1037,7 +1099,9 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
       s->dtype_len_in          = s->dtype_len;
       uint16_t const data_type = s->col.data_type & 7;
       if (s->col.converted_type == DECIMAL && data_type != INT32 && data_type != INT64) {
-        s->dtype_len = 8;  // FLOAT output
+        // Fixed-length byte arrays decode to int64 (<= 8 bytes) or __int128_t (<= 16
+        // bytes); wider byte arrays are output as FLOAT64
+        s->dtype_len = (s->dtype_len_in > 8 && s->dtype_len_in <= 16) ? 16 : 8;
       } else if (data_type == INT32) {
         if (dtype_len_out == 1) s->dtype_len = 1;  // INT8 output
         if (dtype_len_out == 2) s->dtype_len = 2;  // INT16 output
@@ -1127,6 +1191,15 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
           s->dict_val  = 0;
           if ((s->col.data_type & 7) == BOOLEAN) { s->dict_run = s->dict_size * 2 + 1; }
           break;
+        case Encoding::BYTE_STREAM_SPLIT:
+          // Fixed-width values split into per-byte streams; only valid for FLOAT/DOUBLE
+          if ((s->col.data_type & 7) == FLOAT || (s->col.data_type & 7) == DOUBLE) {
+            s->dict_size = static_cast<int32_t>(end - cur);
+            s->dict_val  = 0;
+          } else {
+            s->error = 1;
+          }
+          break;
         case Encoding::RLE: s->dict_run = 0; break;
         default:
           s->error = 1;  // Unsupported encoding
@@ -1794,9 +1867,12 @@ extern "C" __global__ void __launch_bounds__(block_size)
             case INT32: gpuOutputFast(s, val_src_pos, static_cast<uint32_t*>(dst)); break;
             case INT64: gpuOutputFast(s, val_src_pos, static_cast<uint2*>(dst)); break;
             default:
-              // we currently do not support reading byte arrays larger than DECIMAL64
+              // byte arrays up to 8 bytes decode to DECIMAL64, up to 16 bytes to
+              // DECIMAL128; anything wider is output as FLOAT64
               if (s->dtype_len_in <= 8) {
                 gpuOutputFixedLenByteArrayAsInt64(s, val_src_pos, static_cast<int64_t*>(dst));
+              } else if (s->dtype_len_in <= 16) {
+                gpuOutputFixedLenByteArrayAsInt128(s, val_src_pos, static_cast<__int128_t*>(dst));
               } else {
                 gpuOutputDecimalAsFloat(s, val_src_pos, static_cast<double*>(dst), dtype);
               }
@@ -1804,6 +1880,8 @@ extern "C" __global__ void __launch_bounds__(block_size)
           }
         } else if (dtype == INT96) {
           gpuOutputInt96Timestamp(s, val_src_pos, static_cast<int64_t*>(dst));
+        } else if (s->page.encoding == Encoding::BYTE_STREAM_SPLIT) {
+          gpuOutputByteStreamSplit(s, val_src_pos, static_cast<uint8_t*>(dst));
         } else if (dtype_len == 8) {
           if (s->ts_scale) {
             gpuOutputInt64Timestamp(s, val_src_pos, static_cast<int64_t*>(dst));
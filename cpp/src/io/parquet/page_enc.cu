@@ -62,6 +62,8 @@ struct page_enc_state_s {
   uint32_t rle_rpt_count;
   uint32_t page_start_val;
   uint32_t chunk_start_val;
+  uint8_t* bss_values_base;  //!< start of the value section for byte-stream-split pages
+  uint32_t bss_numvals;      //!< number of (valid) values in a byte-stream-split page
   volatile uint32_t rpt_map[4];
   volatile uint32_t scratch_red[32];
   EncPage page;
@@ -179,6 +181,7 @@ __global__ void __launch_bounds__(block_size)
   dtype_len = (dtype == INT96)                      ? 12
               : (dtype == INT64 || dtype == DOUBLE) ? 8
               : (dtype == BOOLEAN)                  ? 1
+              : (dtype == FIXED_LEN_BYTE_ARRAY)     ? 16
                                                     : 4;
   __syncthreads();
 
@@ -881,6 +884,7 @@ __global__ void __launch_bounds__(128, 8)
   dtype_len_out = (dtype == INT96)                      ? 12
                   : (dtype == INT64 || dtype == DOUBLE) ? 8
                   : (dtype == BOOLEAN)                  ? 1
+                  : (dtype == FIXED_LEN_BYTE_ARRAY)     ? 16
                                                         : 4;
   if (dtype == INT32) {
     dtype_len_in = GetDtypeLogicalLen(s->col.leaf_column);
@@ -927,6 +931,24 @@ __global__ void __launch_bounds__(128, 8)
     }
   }
   __syncthreads();
+  // Byte-stream-split stores the i-th byte of every value in the page contiguously, so the
+  // total number of values in the page must be known before the first value is written
+  bool const byte_stream_split = s->ck.encoding == Encoding::BYTE_STREAM_SPLIT and
+                                 dict_bits < 0 and (dtype == FLOAT or dtype == DOUBLE);
+  if (byte_stream_split) {
+    uint32_t num_valid = 0;
+    for (uint32_t i = t; i < s->page.num_leaf_values; i += 128) {
+      size_type const idx = s->page_start_val + i;
+      if (idx < s->col.leaf_column->size() and s->col.leaf_column->is_valid(idx)) { num_valid++; }
+    }
+    uint32_t pos, total_valid;
+    block_scan(temp_storage).ExclusiveSum(num_valid, pos, total_valid);
+    if (t == 0) {
+      s->bss_values_base = s->cur;
+      s->bss_numvals     = total_valid;
+    }
+    __syncthreads();
+  }
   for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
     uint32_t nvals = min(s->page.num_leaf_values - cur_val_idx, 128);
     uint32_t len, pos;
@@ -997,7 +1019,28 @@ __global__ void __launch_bounds__(128, 8)
       block_scan(temp_storage).ExclusiveSum(len, pos, total_len);
       __syncthreads();
       if (t == 0) { s->cur = dst + total_len; }
-      if (is_valid) {
+      if (is_valid && byte_stream_split) {
+        // Write the i-th byte of the value into the i-th byte stream of the page; the streams
+        // group the (highly compressible) sign/exponent bytes of the values together
+        uint8_t* const split_base = s->bss_values_base;
+        uint32_t const num_values = s->bss_numvals;
+        uint32_t const value_idx  = static_cast<uint32_t>(dst + pos - split_base) / dtype_len_out;
+        if (dtype == DOUBLE) {
+          auto const v = s->col.leaf_column->element<double>(val_idx);
+          uint64_t bits;
+          memcpy(&bits, &v, 8);
+          for (uint32_t i = 0; i < 8; i++) {
+            split_base[i * num_values + value_idx] = bits >> (i * 8);
+          }
+        } else {
+          auto const v = s->col.leaf_column->element<float>(val_idx);
+          uint32_t bits;
+          memcpy(&bits, &v, 4);
+          for (uint32_t i = 0; i < 4; i++) {
+            split_base[i * num_values + value_idx] = bits >> (i * 8);
+          }
+        }
+      } else if (is_valid) {
         switch (dtype) {
           case INT32:
           case FLOAT: {
@@ -1087,6 +1130,14 @@ __global__ void __launch_bounds__(128, 8)
             dst[pos + 3] = v >> 24;
             if (v != 0) memcpy(dst + pos + 4, str.data(), v);
           } break;
+          case FIXED_LEN_BYTE_ARRAY: {
+            // Only decimal128 is stored as FIXED_LEN_BYTE_ARRAY; parquet decimal byte
+            // arrays are big-endian
+            auto const v = s->col.leaf_column->element<numeric::decimal128>(val_idx).value();
+            for (uint32_t i = 0; i < sizeof(__int128_t); i++) {
+              dst[pos + i] = v >> ((sizeof(__int128_t) - 1 - i) * 8);
+            }
+          } break;
         }
       }
       __syncthreads();
@@ -1098,7 +1149,9 @@ __global__ void __launch_bounds__(128, 8)
     uint32_t compressed_bfr_size = GetMaxCompressedBfrSize(actual_data_size);
     s->page.max_data_size        = actual_data_size;
     s->comp_in.srcDevice         = base;
-    s->comp_in.srcSize           = actual_data_size;
+    // Pages of columns that opted out of compression submit empty input so the compressor
+    // does no work on them; gpuDecideCompression then keeps those chunks uncompressed
+    s->comp_in.srcSize           = (s->col.skip_compression) ? 0 : actual_data_size;
     s->comp_in.dstDevice         = s->page.compressed_data + s->page.max_hdr_size;
     s->comp_in.dstSize           = compressed_bfr_size;
     s->comp_stat.bytes_written   = 0;
@@ -1158,7 +1211,12 @@ __global__ void __launch_bounds__(128) gpuDecideCompression(device_span<EncColum
     bool is_compressed;
     if (has_compression) {
       uint32_t compression_error = atomicAdd(&error_count, 0);
-      is_compressed = (!compression_error && compressed_data_size < uncompressed_data_size);
+      // Only keep the compressed data if it saves at least ~5% (ratio >= 1.05); marginally
+      // compressible chunks (e.g. high-entropy floats) are not worth the decompression cost
+      is_compressed = (!compression_error && static_cast<uint64_t>(compressed_data_size) * 21 <
+                                               static_cast<uint64_t>(uncompressed_data_size) * 20);
+      // Columns that opted out of compression stay uncompressed regardless of the ratio
+      if (ck_g.col_desc->skip_compression) { is_compressed = false; }
     } else {
       is_compressed = false;
     }
@@ -1281,6 +1339,7 @@ __device__ uint8_t* EncodeStatistics(uint8_t* start,
                                      float* fp_scratch)
 {
   uint8_t *end, dtype_len;
+  uint8_t dec128_scratch[2 * sizeof(__int128_t)];
   switch (dtype) {
     case dtype_bool: dtype_len = 1; break;
     case dtype_int8:
@@ -1314,6 +1373,15 @@ __device__ uint8_t* EncodeStatistics(uint8_t* start,
         fp_scratch[1] = s->max_value.fp_val;
         vmin          = &fp_scratch[0];
         vmax          = &fp_scratch[1];
+      } else if (dtype == dtype_decimal128) {
+        // FIXED_LEN_BYTE_ARRAY decimal statistics are stored big-endian
+        for (uint32_t i = 0; i < sizeof(__int128_t); i++) {
+          dec128_scratch[i] = s->min_value.d128_val >> ((sizeof(__int128_t) - 1 - i) * 8);
+          dec128_scratch[sizeof(__int128_t) + i] =
+            s->max_value.d128_val >> ((sizeof(__int128_t) - 1 - i) * 8);
+        }
+        vmin = &dec128_scratch[0];
+        vmax = &dec128_scratch[sizeof(__int128_t)];
       } else {
         vmin = &s->min_value;
         vmax = &s->max_value;
@@ -1374,11 +1442,11 @@ __global__ void __launch_bounds__(128)
       encoding = (col_g.physical_type == BOOLEAN) ? Encoding::RLE
                  : (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
                    ? Encoding::PLAIN_DICTIONARY
-                   : Encoding::PLAIN;
+                   : page_g.chunk->encoding;
     } else {
       encoding = (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
                    ? Encoding::PLAIN_DICTIONARY
-                   : Encoding::PLAIN;
+                   : page_g.chunk->encoding;
     }
     encoder.field_int32(1, page_type);
     encoder.field_int32(2, uncompressed_page_size);
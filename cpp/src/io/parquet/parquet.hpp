@@ -208,6 +208,66 @@ struct SchemaElement {
   }
 };
 
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ */
+struct Statistics {
+  std::vector<uint8_t> max;        // deprecated max value in signed comparison order
+  std::vector<uint8_t> min;        // deprecated min value in signed comparison order
+  int64_t null_count     = -1;     // count of null values in the column
+  int64_t distinct_count = -1;     // count of distinct values occurring
+  std::vector<uint8_t> max_value;  // max value for column determined by ColumnOrder
+  std::vector<uint8_t> min_value;  // min value for column determined by ColumnOrder
+};
+
+struct SplitBlockAlgorithm {
+};
+typedef struct BloomFilterAlgorithm_isset {
+  BloomFilterAlgorithm_isset() : BLOCK(false) {}
+  bool BLOCK;
+} BloomFilterAlgorithm_isset;
+
+struct BloomFilterAlgorithm {
+  BloomFilterAlgorithm_isset isset;
+  SplitBlockAlgorithm BLOCK;
+};
+
+struct XxHash {
+};
+typedef struct BloomFilterHash_isset {
+  BloomFilterHash_isset() : XXHASH(false) {}
+  bool XXHASH;
+} BloomFilterHash_isset;
+
+struct BloomFilterHash {
+  BloomFilterHash_isset isset;
+  XxHash XXHASH;
+};
+
+struct Uncompressed {
+};
+typedef struct BloomFilterCompression_isset {
+  BloomFilterCompression_isset() : UNCOMPRESSED(false) {}
+  bool UNCOMPRESSED;
+} BloomFilterCompression_isset;
+
+struct BloomFilterCompression {
+  BloomFilterCompression_isset isset;
+  Uncompressed UNCOMPRESSED;
+};
+
+/**
+ * @brief Thrift-derived struct describing the header preceding a bloom filter bitset
+ *
+ * The bitset of `num_bytes` bytes immediately follows the encoded header in the file.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bloom filter bitset in bytes
+  BloomFilterAlgorithm algorithm;
+  BloomFilterHash hash;
+  BloomFilterCompression compression;
+};
+
 /**
  * @brief Thrift-derived struct describing a column chunk
  */
@@ -226,6 +286,8 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = -1;  // Byte offset from beginning of file to bloom filter data, or
+                                     // -1 if the chunk has no bloom filter
 };
 
 /**
@@ -286,6 +348,39 @@ struct FileMetaData {
   uint32_t column_order_listsize = 0;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page within a column chunk
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // Byte offset of the page in the file
+  int32_t compressed_page_size = 0;  // Size of the page, including header, in bytes
+  int64_t first_row_index = 0;  // Index of the first row of the page within the column chunk
+};
+
+/**
+ * @brief Thrift-derived struct describing the location of all data pages of a column chunk
+ *
+ * The OffsetIndex is stored after the row group data, so page locations are
+ * available without decoding any page headers.
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing per-page statistics of a column chunk
+ *
+ * Each list has one entry per data page, in the same order as the OffsetIndex.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;  // Whether the corresponding page contains only nulls
+  std::vector<std::vector<uint8_t>> min_values;  // Lower bound of values in each page
+  std::vector<std::vector<uint8_t>> max_values;  // Upper bound of values in each page
+  BoundaryOrder boundary_order =
+    BoundaryOrder::UNORDERED;        // Ordering of the min/max values across pages
+  std::vector<int64_t> null_counts;  // Number of nulls in each page; optional
+};
+
 /**
  * @brief Thrift-derived struct describing the header for a data page
  */
@@ -428,6 +523,14 @@ class CompactProtocolReader {
   bool read(DataPageHeader* d);
   bool read(DictionaryPageHeader* d);
   bool read(KeyValue* k);
+  bool read(Statistics* s);
+  bool read(PageLocation* p);
+  bool read(OffsetIndex* o);
+  bool read(ColumnIndex* c);
+  bool read(BloomFilterAlgorithm* a);
+  bool read(BloomFilterHash* h);
+  bool read(BloomFilterCompression* c);
+  bool read(BloomFilterHeader* b);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -449,12 +552,15 @@ class CompactProtocolReader {
   const uint8_t* m_end  = nullptr;
 
   friend class ParquetFieldBool;
+  friend class ParquetFieldBoolList;
   friend class ParquetFieldInt8;
   friend class ParquetFieldInt32;
   friend class ParquetFieldInt64;
+  friend class ParquetFieldInt64List;
   template <typename T>
   friend class ParquetFieldStructListFunctor;
   friend class ParquetFieldString;
+  friend class ParquetFieldBinary;
   template <typename T>
   friend class ParquetFieldStructFunctor;
   template <typename T, bool>
@@ -464,6 +570,7 @@ class CompactProtocolReader {
   template <typename T>
   friend class ParquetFieldEnumListFunctor;
   friend class ParquetFieldStringList;
+  friend class ParquetFieldBinaryList;
   friend class ParquetFieldStructBlob;
 };
 
@@ -488,6 +595,37 @@ class ParquetFieldBool {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of booleans from CompactProtocolReader
+ *
+ * @return True if field type is not a list of bool
+ */
+class ParquetFieldBoolList {
+  int field_val;
+  std::vector<bool>& val;
+
+ public:
+  ParquetFieldBoolList(int f, std::vector<bool>& v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_TRUE) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      unsigned int current_byte = cpr->getb();
+      if (current_byte != ST_FLD_TRUE && current_byte != ST_FLD_FALSE) return true;
+      val[i] = (current_byte == ST_FLD_TRUE);
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to set value to 8 bit integer read from CompactProtocolReader
  *
@@ -551,6 +689,35 @@ class ParquetFieldInt64 {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of 64 bit integers from CompactProtocolReader
+ *
+ * @return True if field type is not a list of int64
+ */
+class ParquetFieldInt64List {
+  int field_val;
+  std::vector<int64_t>& val;
+
+ public:
+  ParquetFieldInt64List(int f, std::vector<int64_t>& v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_I64) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      val[i] = cpr->get_i64();
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a vector of structures from CompactProtocolReader
  *
@@ -619,6 +786,35 @@ class ParquetFieldString {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a binary value from CompactProtocolReader
+ *
+ * @return True if field type mismatches or if size of binary exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinary {
+  int field_val;
+  std::vector<uint8_t>& val;
+
+ public:
+  ParquetFieldBinary(int f, std::vector<uint8_t>& v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_BINARY) return true;
+    uint32_t n = cpr->get_u32();
+    if (n < (size_t)(cpr->m_end - cpr->m_cur)) {
+      val.assign(cpr->m_cur, cpr->m_cur + n);
+      cpr->m_cur += n;
+      return false;
+    } else {
+      return true;
+    }
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a structure from CompactProtocolReader
  *
@@ -797,6 +993,40 @@ class ParquetFieldStringList {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of binary values from CompactProtocolReader
+ *
+ * @return True if field types mismatch or if the size of a binary value
+ * exceeds bounds of the CompactProtocolReader
+ */
+class ParquetFieldBinaryList {
+  int field_val;
+  std::vector<std::vector<uint8_t>>& val;
+
+ public:
+  ParquetFieldBinaryList(int f, std::vector<std::vector<uint8_t>>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_BINARY) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      uint32_t l = cpr->get_u32();
+      if (l < (size_t)(cpr->m_end - cpr->m_cur)) {
+        val[i].assign(cpr->m_cur, cpr->m_cur + l);
+        cpr->m_cur += l;
+      } else
+        return true;
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a struct from CompactProtocolReader
  *
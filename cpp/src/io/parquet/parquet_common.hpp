@@ -88,6 +88,7 @@ enum class Encoding : uint8_t {
   DELTA_LENGTH_BYTE_ARRAY = 6,
   DELTA_BYTE_ARRAY        = 7,
   RLE_DICTIONARY          = 8,
+  BYTE_STREAM_SPLIT       = 9,
 };
 
 /**
@@ -123,6 +124,15 @@ enum class PageType : uint8_t {
   DATA_PAGE_V2    = 3,
 };
 
+/**
+ * @brief Ordering of the min/max values in a ColumnIndex
+ */
+enum class BoundaryOrder : uint8_t {
+  UNORDERED  = 0,
+  ASCENDING  = 1,
+  DESCENDING = 2,
+};
+
 /**
  * @brief Thrift compact protocol struct field types
  */
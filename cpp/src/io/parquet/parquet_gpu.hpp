@@ -48,6 +48,41 @@ using cudf::io::detail::string_index_pair;
 constexpr size_type MAX_DICT_SIZE =
   std::numeric_limits<uint16_t>::max() - std::numeric_limits<uint16_t>::min() + 1;
 
+/**
+ * @brief Constants and probe helpers for Parquet split-block bloom filters
+ *
+ * A filter is an array of 32-byte (256-bit) blocks. A 64-bit hash of a value selects one
+ * block using its upper 32 bits; the lower 32 bits select one bit in each of the block's
+ * eight words via the salt constants from the Parquet specification. The value is present
+ * in the filter only if all eight selected bits are set. Shared between the writer, which
+ * builds filters on the device, and the reader, which probes them on the host.
+ */
+namespace bloom_filter {
+
+constexpr uint32_t words_per_block = 8;
+constexpr uint32_t bytes_per_block = words_per_block * sizeof(uint32_t);
+
+constexpr uint32_t salt[words_per_block] = {0x47b6137bu,
+                                            0x44974d91u,
+                                            0x8824ad5bu,
+                                            0xa2b7289du,
+                                            0x705495c7u,
+                                            0x2df1424bu,
+                                            0x9efc4947u,
+                                            0x5c6bfb31u};
+
+CUDA_HOST_DEVICE_CALLABLE uint32_t block_index(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint32_t word_mask(uint64_t hash, uint32_t word)
+{
+  return 1u << ((static_cast<uint32_t>(hash) * salt[word]) >> 27);
+}
+
+}  // namespace bloom_filter
+
 /**
  * @brief Struct representing an input column in the file.
  */
@@ -197,7 +232,9 @@ struct ColumnChunkDesc {
       decimal_scale(decimal_scale_),
       ts_clock_rate(ts_clock_rate_),
       src_col_index(src_col_index_),
-      src_col_schema(src_col_schema_)
+      src_col_schema(src_col_schema_),
+      dict_index_base(0),
+      output_string_dict_index(false)
   {
   }
 
@@ -227,14 +264,18 @@ struct ColumnChunkDesc {
 
   int32_t src_col_index;   // my input column index
   int32_t src_col_schema;  // my schema index in the file
+
+  int32_t dict_index_base;        // offset added to emitted string dictionary indices
+  bool output_string_dict_index;  // emit dictionary indices instead of string data
 };
 
 /**
  * @brief Struct describing an encoder column
  */
 struct parquet_column_device_view : stats_column_desc {
-  uint8_t physical_type;   //!< physical data type
-  uint8_t converted_type;  //!< logical data type
+  uint8_t physical_type;     //!< physical data type
+  uint8_t converted_type;    //!< logical data type
+  uint8_t skip_compression;  //!< nonzero if this column's pages are always written uncompressed
   uint8_t level_bits;  //!< bits to encode max definition (lower nibble) & repetition (upper nibble)
                        //!< levels
   constexpr uint8_t num_def_level_bits() { return level_bits & 0xf; }
@@ -329,6 +370,7 @@ struct EncColumnChunk {
   uint16_t* dict_index;   //!< Index of value in dictionary page. column[dict_data[dict_index[row]]]
   uint8_t dict_rle_bits;  //!< Bit size for encoding dictionary indices
   bool use_dictionary;    //!< True if the chunk uses dictionary encoding
+  Encoding encoding;      //!< Encoding of data pages when dictionary encoding is not used
 };
 
 /**
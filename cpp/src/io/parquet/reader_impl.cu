@@ -25,10 +25,18 @@
 #include <io/utilities/config_utils.hpp>
 #include <io/utilities/time_utils.cuh>
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -39,8 +47,14 @@
 
 #include <algorithm>
 #include <array>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <regex>
+#include <thread>
+#include <unordered_map>
 
 namespace cudf {
 namespace io {
@@ -144,6 +158,9 @@ type_id to_type_id(SchemaElement const& schema,
         return type_id::DECIMAL64;
       else if (physical == parquet::FIXED_LEN_BYTE_ARRAY && schema.type_length <= 8) {
         return type_id::DECIMAL64;
+      } else if (physical == parquet::FIXED_LEN_BYTE_ARRAY &&
+                 schema.type_length <= static_cast<int32_t>(sizeof(__int128_t))) {
+        return type_id::DECIMAL128;
       } else {
         CUDF_EXPECTS(strict_decimal_types == false, "Unsupported decimal type read!");
         return type_id::FLOAT64;
@@ -216,12 +233,298 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
 
   int8_t converted_type = converted;
   if (converted_type == parquet::DECIMAL && column_type_id != type_id::FLOAT64 &&
-      column_type_id != type_id::DECIMAL32 && column_type_id != type_id::DECIMAL64) {
+      column_type_id != type_id::DECIMAL32 && column_type_id != type_id::DECIMAL64 &&
+      column_type_id != type_id::DECIMAL128) {
     converted_type = parquet::UNKNOWN;  // Not converting to float64 or decimal
   }
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Functor to read the host value of a filter literal as a double.
+ */
+struct scalar_as_double {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  double operator()(cudf::scalar const& s) const
+  {
+    return static_cast<double>(
+      static_cast<cudf::numeric_scalar<T> const&>(s).value(rmm::cuda_stream_default));
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  double operator()(cudf::scalar const& s) const
+  {
+    return static_cast<double>(static_cast<cudf::timestamp_scalar<T> const&>(s)
+                                 .value(rmm::cuda_stream_default)
+                                 .time_since_epoch()
+                                 .count());
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+  double operator()(cudf::scalar const& s) const
+  {
+    return static_cast<double>(
+      static_cast<cudf::duration_scalar<T> const&>(s).value(rmm::cuda_stream_default).count());
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_arithmetic<T>::value and not cudf::is_timestamp<T>() and
+                             not cudf::is_duration<T>()>* = nullptr>
+  double operator()(cudf::scalar const&) const
+  {
+    CUDF_FAIL("Unsupported literal type for statistics-based row group filtering");
+  }
+};
+
+/**
+ * @brief Functor to hash a filter literal the way the writer hashed column values into a
+ * bloom filter
+ *
+ * The literal is widened to the column's physical type before hashing so that the hash
+ * matches the one computed from the plain-encoded column values.
+ *
+ * @return true if the literal/physical type combination is supported and `hash` was set
+ */
+struct scalar_bloom_hash {
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value and not std::is_same<T, bool>::value>* =
+              nullptr>
+  bool operator()(cudf::scalar const& s, parquet::Type physical_type, uint64_t& hash) const
+  {
+    auto const value =
+      static_cast<cudf::numeric_scalar<T> const&>(s).value(rmm::cuda_stream_default);
+    if (physical_type == parquet::INT32) {
+      hash = cudf::detail::XXHash_64<int32_t>{}(static_cast<int32_t>(value));
+    } else if (physical_type == parquet::INT64) {
+      hash = cudf::detail::XXHash_64<int64_t>{}(static_cast<int64_t>(value));
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  bool operator()(cudf::scalar const& s, parquet::Type physical_type, uint64_t& hash) const
+  {
+    auto const value =
+      static_cast<cudf::numeric_scalar<T> const&>(s).value(rmm::cuda_stream_default);
+    if (physical_type == parquet::FLOAT) {
+      hash = cudf::detail::XXHash_64<float>{}(static_cast<float>(value));
+    } else if (physical_type == parquet::DOUBLE) {
+      hash = cudf::detail::XXHash_64<double>{}(static_cast<double>(value));
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_same<T, bool>::value or
+                             not std::is_arithmetic<T>::value>* = nullptr>
+  bool operator()(cudf::scalar const&, parquet::Type, uint64_t&) const
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief Reads and validates a column chunk's split-block bloom filter bitset
+ *
+ * @return The bitset words, or an empty vector if the filter is absent or not understood
+ */
+std::vector<uint32_t> read_bloom_filter(datasource* source, int64_t offset)
+{
+  // The encoded header is a handful of bytes; read generously past it so one read suffices
+  constexpr size_t max_header_size = 256;
+  if (offset < 0 or static_cast<size_t>(offset) >= source->size()) { return {}; }
+  auto const header_data =
+    source->host_read(offset, std::min<size_t>(max_header_size, source->size() - offset));
+
+  BloomFilterHeader header;
+  CompactProtocolReader cp(header_data->data(), header_data->size());
+  if (not cp.read(&header)) { return {}; }
+  if (not header.algorithm.isset.BLOCK or not header.hash.isset.XXHASH or
+      not header.compression.isset.UNCOMPRESSED) {
+    return {};
+  }
+  if (header.num_bytes <= 0 or header.num_bytes % bloom_filter::bytes_per_block != 0) {
+    return {};
+  }
+
+  auto const bitset_offset = offset + cp.bytecount();
+  if (bitset_offset + header.num_bytes > static_cast<int64_t>(source->size())) { return {}; }
+  auto const bitset_data = source->host_read(bitset_offset, header.num_bytes);
+  if (bitset_data->size() < static_cast<size_t>(header.num_bytes)) { return {}; }
+
+  std::vector<uint32_t> words(header.num_bytes / sizeof(uint32_t));
+  memcpy(words.data(), bitset_data->data(), header.num_bytes);
+  return words;
+}
+
+/**
+ * @brief Decodes a plain-encoded statistics value to a double.
+ *
+ * @return true if the physical type is supported and the value was decoded
+ */
+bool stats_value_as_double(parquet::Type physical_type,
+                           std::vector<uint8_t> const& blob,
+                           double& value)
+{
+  auto const read_as = [&](auto dummy) {
+    using T = decltype(dummy);
+    if (blob.size() < sizeof(T)) { return false; }
+    T v;
+    memcpy(&v, blob.data(), sizeof(T));
+    value = static_cast<double>(v);
+    return true;
+  };
+  switch (physical_type) {
+    case parquet::BOOLEAN: return read_as(uint8_t{});
+    case parquet::INT32: return read_as(int32_t{});
+    case parquet::INT64: return read_as(int64_t{});
+    case parquet::FLOAT: return read_as(float{});
+    case parquet::DOUBLE: return read_as(double{});
+    // Binary (e.g. string) and INT96 statistics are not used for filtering
+    default: return false;
+  }
+}
+
+/**
+ * @brief Conservative evaluator of an AST predicate against column chunk statistics.
+ *
+ * Answers whether any row of a row group *may* satisfy the predicate. Only
+ * comparisons between a column reference and a literal, combined with logical
+ * AND/OR, are understood; any other sub-expression conservatively evaluates to
+ * "may match" so that no row group is pruned incorrectly.
+ */
+class stats_filter {
+ public:
+  stats_filter(std::function<ColumnChunkMetaData const*(size_type)> column_metadata,
+               std::function<std::vector<uint32_t>(ColumnChunkMetaData const&)>
+                 bloom_filter_reader = nullptr)
+    : _column_metadata(std::move(column_metadata)),
+      _bloom_filter_reader(std::move(bloom_filter_reader))
+  {
+  }
+
+  bool may_match(ast::expression const& expr) const
+  {
+    auto const* op = dynamic_cast<ast::operation const*>(&expr);
+    if (op == nullptr) { return true; }
+
+    auto const operands = op->get_operands();
+    switch (op->get_operator()) {
+      case ast::ast_operator::LOGICAL_AND:
+      case ast::ast_operator::NULL_LOGICAL_AND:
+        return may_match(operands[0]) and may_match(operands[1]);
+      case ast::ast_operator::LOGICAL_OR:
+      case ast::ast_operator::NULL_LOGICAL_OR:
+        return may_match(operands[0]) or may_match(operands[1]);
+      case ast::ast_operator::EQUAL:
+      case ast::ast_operator::NOT_EQUAL:
+      case ast::ast_operator::LESS:
+      case ast::ast_operator::LESS_EQUAL:
+      case ast::ast_operator::GREATER:
+      case ast::ast_operator::GREATER_EQUAL:
+        return comparison_may_match(op->get_operator(), operands[0], operands[1]);
+      default: return true;
+    }
+  }
+
+ private:
+  bool comparison_may_match(ast::ast_operator op,
+                            ast::expression const& lhs,
+                            ast::expression const& rhs) const
+  {
+    auto const* col = dynamic_cast<ast::column_reference const*>(&lhs);
+    auto const* lit = dynamic_cast<ast::literal const*>(&rhs);
+    if (col == nullptr or lit == nullptr) {
+      // Accept the flipped `literal op column` form by mirroring the operator
+      col = dynamic_cast<ast::column_reference const*>(&rhs);
+      lit = dynamic_cast<ast::literal const*>(&lhs);
+      if (col == nullptr or lit == nullptr) { return true; }
+      op = flip_comparison(op);
+    }
+
+    auto const* col_meta = _column_metadata(col->get_column_index());
+    if (col_meta == nullptr) { return true; }
+
+    if (not stats_may_match(op, *col_meta, *lit)) { return false; }
+
+    // Even when min/max cannot rule the chunk out, an equality literal absent from the
+    // chunk's bloom filter proves that no row matches
+    if (op == ast::ast_operator::EQUAL) { return bloom_may_contain(*col_meta, *lit); }
+    return true;
+  }
+
+  static bool stats_may_match(ast::ast_operator op,
+                              ColumnChunkMetaData const& col_meta,
+                              ast::literal const& lit)
+  {
+    if (col_meta.statistics_blob.empty()) { return true; }
+
+    Statistics stats;
+    CompactProtocolReader cp(col_meta.statistics_blob.data(), col_meta.statistics_blob.size());
+    if (not cp.read(&stats)) { return true; }
+
+    auto const& min_blob = stats.min_value.empty() ? stats.min : stats.min_value;
+    auto const& max_blob = stats.max_value.empty() ? stats.max : stats.max_value;
+    double min, max;
+    if (not stats_value_as_double(col_meta.type, min_blob, min) or
+        not stats_value_as_double(col_meta.type, max_blob, max)) {
+      return true;
+    }
+
+    auto const value = cudf::type_dispatcher(
+      lit.get_data_type(), scalar_as_double{}, lit.get_scalar());
+
+    switch (op) {
+      case ast::ast_operator::EQUAL: return value >= min and value <= max;
+      case ast::ast_operator::NOT_EQUAL: return not(min == max and value == min);
+      case ast::ast_operator::LESS: return min < value;
+      case ast::ast_operator::LESS_EQUAL: return min <= value;
+      case ast::ast_operator::GREATER: return max > value;
+      case ast::ast_operator::GREATER_EQUAL: return max >= value;
+      default: return true;
+    }
+  }
+
+  bool bloom_may_contain(ColumnChunkMetaData const& col_meta, ast::literal const& lit) const
+  {
+    if (col_meta.bloom_filter_offset < 0 or not _bloom_filter_reader) { return true; }
+
+    uint64_t hash = 0;
+    if (not cudf::type_dispatcher(
+          lit.get_data_type(), scalar_bloom_hash{}, lit.get_scalar(), col_meta.type, hash)) {
+      return true;
+    }
+
+    auto const words = _bloom_filter_reader(col_meta);
+    if (words.empty()) { return true; }
+
+    auto const num_blocks = static_cast<uint32_t>(words.size() / bloom_filter::words_per_block);
+    auto const block = bloom_filter::block_index(hash, num_blocks) * bloom_filter::words_per_block;
+    for (uint32_t i = 0; i < bloom_filter::words_per_block; ++i) {
+      if ((words[block + i] & bloom_filter::word_mask(hash, i)) == 0) { return false; }
+    }
+    return true;
+  }
+
+  static ast::ast_operator flip_comparison(ast::ast_operator op)
+  {
+    switch (op) {
+      case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+      case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+      case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+      case ast::ast_operator::GREATER_EQUAL: return ast::ast_operator::LESS_EQUAL;
+      default: return op;
+    }
+  }
+
+  std::function<ColumnChunkMetaData const*(size_type)> _column_metadata;
+  std::function<std::vector<uint32_t>(ColumnChunkMetaData const&)> _bloom_filter_reader;
+};
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string>& path_in_schema)
@@ -295,14 +598,53 @@ class aggregate_metadata {
   size_type const num_row_groups;
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * Footers of sources that were not parsed before are parsed in parallel on the thread pool.
+   * Parses of file-backed sources are cached, keyed on the source's `content_id` (path,
+   * modification time and size), so repeated reads of a growing partitioned dataset only pay
+   * for the files added since the last read.
    */
   auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
   {
+    static std::mutex cache_mutex;
+    static std::unordered_map<std::string, std::shared_ptr<metadata const>> footer_cache;
+    constexpr size_t max_cached_footers = 16384;
+
+    std::vector<std::string> keys(sources.size());
+    std::vector<std::shared_ptr<metadata const>> parsed(sources.size());
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+      for (size_t i = 0; i < sources.size(); ++i) {
+        keys[i] = sources[i]->content_id();
+        if (not keys[i].empty()) {
+          auto const it = footer_cache.find(keys[i]);
+          if (it != footer_cache.end()) { parsed[i] = it->second; }
+        }
+      }
+    }
+
+    static cudf::detail::thread_pool pool(std::thread::hardware_concurrency());
+    std::vector<std::future<std::shared_ptr<metadata const>>> parse_tasks(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+      if (parsed[i] == nullptr) {
+        parse_tasks[i] = pool.submit(
+          [](datasource* source) { return std::make_shared<metadata const>(source); },
+          sources[i].get());
+      }
+    }
+
     std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-        return metadata(source.get());
-      });
+    metadatas.reserve(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+      if (parse_tasks[i].valid()) { parsed[i] = parse_tasks[i].get(); }
+      metadatas.push_back(*parsed[i]);
+    }
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (footer_cache.size() + sources.size() > max_cached_footers) { footer_cache.clear(); }
+    for (size_t i = 0; i < sources.size(); ++i) {
+      if (not keys[i].empty()) { footer_cache.emplace(keys[i], parsed[i]); }
+    }
     return metadatas;
   }
 
@@ -375,9 +717,7 @@ class aggregate_metadata {
     return per_file_metadata[src_idx].row_groups[row_group_index];
   }
 
-  auto const& get_column_metadata(size_type row_group_index,
-                                  size_type src_idx,
-                                  int schema_idx) const
+  auto const& get_column_chunk(size_type row_group_index, size_type src_idx, int schema_idx) const
   {
     auto col = std::find_if(
       per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
@@ -385,17 +725,69 @@ class aggregate_metadata {
       [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx ? true : false; });
     CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
                  "Found no metadata for schema index");
-    return col->meta_data;
+    return *col;
+  }
+
+  auto const& get_column_metadata(size_type row_group_index,
+                                  size_type src_idx,
+                                  int schema_idx) const
+  {
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
   }
 
   auto get_num_rows() const { return num_rows; }
 
   auto get_num_row_groups() const { return num_row_groups; }
 
+  auto get_num_sources() const { return per_file_metadata.size(); }
+
+  auto get_num_row_groups(size_type src_idx) const
+  {
+    return static_cast<size_type>(per_file_metadata[src_idx].row_groups.size());
+  }
+
   auto const& get_schema(int schema_idx) const { return per_file_metadata[0].schema[schema_idx]; }
 
   auto const& get_key_value_metadata() const { return agg_keyval_map; }
 
+  /**
+   * @brief Finds the flat string columns whose chunks all use dictionary encoding.
+   *
+   * Only such columns can be decoded straight to dictionary indices; plain-encoded
+   * values have no dictionary entry to refer to. The chunk metadata alone cannot tell a
+   * PLAIN dictionary page apart from a mid-chunk fallback to plain data pages, so PLAIN
+   * is tolerated here and the decoded page headers are checked before decoding.
+   *
+   * @return Set of leaf schema indices eligible for dictionary output
+   */
+  std::set<int> dictionary_only_string_schemas() const
+  {
+    auto const is_dict_encoding = [](Encoding enc) {
+      return enc == Encoding::PLAIN_DICTIONARY or enc == Encoding::RLE_DICTIONARY;
+    };
+    std::set<int> eligible;
+    std::set<int> rejected;
+    for (auto const& pfm : per_file_metadata) {
+      for (auto const& rg : pfm.row_groups) {
+        for (auto const& col : rg.columns) {
+          auto const& schema = get_schema(col.schema_idx);
+          if (schema.type != parquet::BYTE_ARRAY or schema.max_repetition_level > 0 or
+              schema.max_definition_level > 1) {
+            continue;
+          }
+          auto const& encodings = col.meta_data.encodings;
+          bool const has_dictionary =
+            std::any_of(encodings.cbegin(), encodings.cend(), is_dict_encoding);
+          (has_dictionary ? eligible : rejected).insert(col.schema_idx);
+        }
+      }
+    }
+    for (auto const schema_idx : rejected) {
+      eligible.erase(schema_idx);
+    }
+    return eligible;
+  }
+
   /**
    * @brief Gets the concrete nesting depth of output cudf columns
    *
@@ -543,12 +935,64 @@ class aggregate_metadata {
     return selection;
   }
 
+  /**
+   * @brief Prunes row groups whose column chunk statistics cannot satisfy a predicate.
+   *
+   * Equality predicates that survive the min/max check additionally probe the column
+   * chunk's bloom filter, when one was written, through the sources.
+   *
+   * @param row_groups Explicitly requested row groups, one list per source; empty means all
+   * @param filter Predicate to evaluate against the column chunk statistics
+   * @param output_column_schemas Schema index of each output column the filter may reference
+   * @param sources Input datasources, one per file
+   *
+   * @return Surviving row group indices, one list per source
+   */
+  std::vector<std::vector<size_type>> filter_row_groups(
+    std::vector<std::vector<size_type>> const& row_groups,
+    ast::expression const& filter,
+    std::vector<int> const& output_column_schemas,
+    std::vector<std::unique_ptr<datasource>> const& sources) const
+  {
+    std::vector<std::vector<size_type>> filtered(per_file_metadata.size());
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      std::vector<size_type> candidates;
+      if (row_groups.empty()) {
+        candidates.resize(per_file_metadata[src_idx].row_groups.size());
+        std::iota(candidates.begin(), candidates.end(), 0);
+      } else {
+        candidates = row_groups[src_idx];
+      }
+      for (auto const rg_idx : candidates) {
+        stats_filter filter_eval(
+          [&](size_type col_idx) -> ColumnChunkMetaData const* {
+            if (col_idx < 0 or col_idx >= static_cast<size_type>(output_column_schemas.size())) {
+              return nullptr;
+            }
+            auto const schema_idx = output_column_schemas[col_idx];
+            auto const& columns   = per_file_metadata[src_idx].row_groups[rg_idx].columns;
+            auto const col =
+              std::find_if(columns.begin(), columns.end(), [&](ColumnChunk const& cc) {
+                return cc.schema_idx == schema_idx;
+              });
+            return col == columns.end() ? nullptr : &col->meta_data;
+          },
+          [&](ColumnChunkMetaData const& col_meta) {
+            return read_bloom_filter(sources[src_idx].get(), col_meta.bloom_filter_offset);
+          });
+        if (filter_eval.may_match(filter)) { filtered[src_idx].push_back(rg_idx); }
+      }
+    }
+    return filtered;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
    * @param use_names List of paths of column names to select
    * @param include_index Whether to always include the PANDAS index column(s)
    * @param strings_to_categorical Type conversion parameter
+   * @param dictionary_schemas Leaf schema indices decoded to dictionary indices (INT32 buffers)
    * @param timestamp_type_id Type conversion parameter
    * @param strict_decimal_types Type conversion parameter
    *
@@ -558,6 +1002,7 @@ class aggregate_metadata {
   auto select_columns(std::vector<std::string> const& use_names,
                       bool include_index,
                       bool strings_to_categorical,
+                      std::set<int> const& dictionary_schemas,
                       type_id timestamp_type_id,
                       bool strict_decimal_types) const
   {
@@ -596,8 +1041,12 @@ class aggregate_metadata {
 
         // if we're at the root, this is a new output column
         auto const col_type =
-          to_type_id(schema_elem, strings_to_categorical, timestamp_type_id, strict_decimal_types);
-        auto const dtype = col_type == type_id::DECIMAL32 || col_type == type_id::DECIMAL64
+          dictionary_schemas.count(schema_idx) > 0
+            ? type_id::INT32  // decoded dictionary indices; wrapped into DICTIONARY32 on output
+            : to_type_id(schema_elem, strings_to_categorical, timestamp_type_id,
+                         strict_decimal_types);
+        auto const dtype = col_type == type_id::DECIMAL32 || col_type == type_id::DECIMAL64 ||
+                               col_type == type_id::DECIMAL128
                              ? data_type{col_type, numeric::scale_type{-schema_elem.decimal_scale}}
                              : data_type{col_type};
 
@@ -896,6 +1345,38 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
   }
 }
 
+/**
+ * @brief Computes the number of bytes of a column chunk needed to cover its first `num_rows` rows.
+ *
+ * Uses the chunk's OffsetIndex, when the file carries one, to drop trailing pages that lie
+ * entirely past the requested row count. Pages of a chunk must be decoded front-to-back, so
+ * only trailing pages can be pruned this way. Falls back to the full compressed size when no
+ * OffsetIndex is present or it fails to parse.
+ */
+size_t trimmed_chunk_read_size(datasource* source,
+                               ColumnChunk const& chunk,
+                               size_t chunk_start,
+                               size_type num_rows,
+                               size_t total_compressed_size)
+{
+  if (chunk.offset_index_length <= 0) { return total_compressed_size; }
+
+  auto const buffer = source->host_read(chunk.offset_index_offset, chunk.offset_index_length);
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  OffsetIndex offset_index;
+  if (not cp.read(&offset_index)) { return total_compressed_size; }
+
+  auto const& locations     = offset_index.page_locations;
+  auto const first_unneeded = std::find_if(
+    locations.begin(), locations.end(), [num_rows](PageLocation const& loc) {
+      return loc.first_row_index >= num_rows;
+    });
+  if (first_unneeded == locations.begin() or first_unneeded == locations.end()) {
+    return total_compressed_size;
+  }
+  return std::min(total_compressed_size, static_cast<size_t>(first_unneeded->offset) - chunk_start);
+}
+
 /**
  * @copydoc cudf::io::detail::parquet::read_column_chunks
  */
@@ -937,9 +1418,22 @@ std::future<void> reader::impl::read_column_chunks(
         read_tasks.emplace_back(std::move(fut_read_size));
         page_data[chunk] = datasource::buffer::create(std::move(buffer));
       } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), stream));
+        // Stage the read through the pool so that reads from separate sources overlap instead
+        // of serializing on the calling thread; matters when reading many small files
+        auto buffer    = rmm::device_buffer(io_size, stream);
+        auto* const db = static_cast<uint8_t*>(buffer.data());
+        auto* const ds = source.get();
+        read_tasks.emplace_back(_read_pool.submit([ds, db, io_offset, io_size, stream]() -> size_t {
+          auto const host_buffer = ds->host_read(io_offset, io_size);
+          CUDA_TRY(cudaMemcpyAsync(db,
+                                   host_buffer->data(),
+                                   host_buffer->size(),
+                                   cudaMemcpyHostToDevice,
+                                   stream.value()));
+          stream.synchronize();
+          return host_buffer->size();
+        }));
+        page_data[chunk] = datasource::buffer::create(std::move(buffer));
       }
       auto d_compdata = page_data[chunk]->data();
       do {
@@ -997,6 +1491,44 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc>&
   pages.device_to_host(stream, true);
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::demote_mixed_encoding_dictionary_columns
+ */
+void reader::impl::demote_mixed_encoding_dictionary_columns(
+  hostdevice_vector<gpu::ColumnChunkDesc>& chunks, hostdevice_vector<gpu::PageInfo> const& pages)
+{
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    if (chunks[c].output_string_dict_index) {
+      bool fully_dictionary = chunks[c].num_dict_pages > 0;
+      for (int32_t p = 0; fully_dictionary and p < chunks[c].max_num_pages; p++) {
+        auto const& page = pages[page_count + p];
+        if ((page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) == 0 and
+            page.encoding != Encoding::PLAIN_DICTIONARY and
+            page.encoding != Encoding::RLE_DICTIONARY) {
+          fully_dictionary = false;
+        }
+      }
+      if (not fully_dictionary) { _demoted_dictionary_schemas.insert(chunks[c].src_col_schema); }
+    }
+    page_count += chunks[c].max_num_pages;
+  }
+  if (_demoted_dictionary_schemas.empty()) { return; }
+
+  // Restore the demoted chunks and their output buffers to regular string decoding; the
+  // output buffers have not been allocated at this point
+  for (size_t c = 0; c < chunks.size(); c++) {
+    if (_demoted_dictionary_schemas.count(chunks[c].src_col_schema) > 0) {
+      chunks[c].output_string_dict_index = false;
+      chunks[c].data_type                = chunks[c].data_type & 7;  // drop the index type width
+    }
+  }
+  for (size_t i = 0; i < _output_columns.size(); ++i) {
+    if (_demoted_dictionary_schemas.count(_output_column_schemas[i]) > 0) {
+      _output_columns[i].type = data_type{type_id::STRING};
+    }
+  }
+}
+
 void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
                        device_span<gpu_inflate_status_s> comp_stat,
                        size_t max_uncomp_page_size,
@@ -1097,9 +1629,10 @@ rmm::device_buffer reader::impl::decompress_page_data(
     int32_t max_decompressed_size;
   };
 
-  std::array<codec_stats, 3> codecs{codec_stats{parquet::GZIP, 0, 0},
+  std::array<codec_stats, 4> codecs{codec_stats{parquet::GZIP, 0, 0},
                                     codec_stats{parquet::SNAPPY, 0, 0},
-                                    codec_stats{parquet::BROTLI, 0, 0}};
+                                    codec_stats{parquet::BROTLI, 0, 0},
+                                    codec_stats{parquet::ZSTD, 0, 0}};
 
   for (auto& codec : codecs) {
     for_each_codec_page(codec.compression_type, [&](size_t page) {
@@ -1176,6 +1709,18 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 stream));
           }
           break;
+        case parquet::ZSTD:
+          if (nvcomp_integration::is_all_enabled()) {
+            gpu_unzstd(inflate_in.device_ptr(start_pos),
+                       inflate_out.device_ptr(start_pos),
+                       codec.max_decompressed_size,
+                       argc - start_pos,
+                       stream);
+          } else {
+            CUDF_FAIL(
+              "Zstandard decompression is disabled; set LIBCUDF_NVCOMP_POLICY=ALWAYS to enable");
+          }
+          break;
         case parquet::BROTLI:
           CUDA_TRY(gpu_debrotli(inflate_in.device_ptr(start_pos),
                                 inflate_out.device_ptr(start_pos),
@@ -1396,6 +1941,10 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chu
   auto chunk_nested_data   = hostdevice_vector<void*>(sum_max_depths);
   auto chunk_offsets       = std::vector<size_t>();
 
+  // Per-chunk dictionary entries of the columns decoded straight to dictionary indices
+  std::map<int, std::vector<device_span<string_index_pair const>>> dictionary_parts;
+  std::map<int, int32_t> dictionary_bases;
+
   // Update chunks with pointers to column data.
   for (size_t c = 0, page_count = 0, str_ofs = 0, chunk_off = 0; c < chunks.size(); c++) {
     input_column_info const& input_col = _input_columns[chunks[c].src_col_index];
@@ -1403,8 +1952,19 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chu
                  "Column/page schema index mismatch");
 
     if (is_dict_chunk(chunks[c])) {
-      chunks[c].str_dict_index = str_dict_index.data() + str_ofs;
-      str_ofs += pages[page_count].num_input_values;
+      auto const num_dict_entries = pages[page_count].num_input_values;
+      chunks[c].str_dict_index    = str_dict_index.data() + str_ofs;
+      if (chunks[c].output_string_dict_index) {
+        // Each chunk carries its own dictionary; record the base offset that the decode
+        // kernel adds to its indices so they address the concatenated dictionaries
+        auto& base               = dictionary_bases[chunks[c].src_col_schema];
+        chunks[c].dict_index_base = base;
+        dictionary_parts[chunks[c].src_col_schema].push_back(
+          device_span<string_index_pair const>{str_dict_index.data() + str_ofs,
+                                               static_cast<size_t>(num_dict_entries)});
+        base += num_dict_entries;
+      }
+      str_ofs += num_dict_entries;
     }
 
     size_t max_depth = _metadata->get_output_nesting_depth(chunks[c].src_col_schema);
@@ -1482,6 +2042,22 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chu
     gpu::BuildStringDictionaryIndex(chunks.device_ptr(), chunks.size(), stream);
   }
 
+  // Materialize the dictionary keys of columns decoded to dictionary indices. The
+  // string_index_pair entries point into the (decompressed) page data, so the keys must
+  // be copied out before those buffers are freed at the end of the pass.
+  _chunk_dictionaries.clear();
+  for (auto const& [schema_idx, parts] : dictionary_parts) {
+    std::vector<std::unique_ptr<column>> part_columns;
+    std::vector<column_view> part_views;
+    for (auto const& part : parts) {
+      part_columns.push_back(make_strings_column(part, stream, _mr));
+      part_views.push_back(part_columns.back()->view());
+    }
+    _chunk_dictionaries[schema_idx] = part_columns.size() == 1
+                                        ? std::move(part_columns.front())
+                                        : cudf::detail::concatenate(part_views, stream, _mr);
+  }
+
   gpu::DecodePageData(pages, chunks, total_rows, min_row, stream);
   pages.device_to_host(stream);
   page_nesting.device_to_host(stream);
@@ -1546,6 +2122,64 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chu
   stream.synchronize();
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::make_dictionary_output
+ */
+std::unique_ptr<column> reader::impl::make_dictionary_output(std::unique_ptr<column> indices,
+                                                             int schema_idx,
+                                                             rmm::cuda_stream_view stream)
+{
+  auto const dict_it = _chunk_dictionaries.find(schema_idx);
+  CUDF_EXPECTS(dict_it != _chunk_dictionaries.end(), "Missing decoded Parquet dictionary");
+  auto const chunk_keys = std::move(dict_it->second);
+
+  // Dictionary keys must be unique and sorted, but every chunk carries its own unordered
+  // dictionary; unify the keys and remap the decoded indices through a lookup table.
+  // Both operations only touch the (small) dictionaries and an INT32 index column, never
+  // the full string data.
+  auto keys_table = cudf::detail::drop_duplicates(table_view{{chunk_keys->view()}},
+                                                  {0},
+                                                  duplicate_keep_option::KEEP_FIRST,
+                                                  null_equality::EQUAL,
+                                                  null_order::BEFORE,
+                                                  stream,
+                                                  _mr);
+  auto const remap = cudf::detail::lower_bound(keys_table->view(),
+                                               table_view{{chunk_keys->view()}},
+                                               {order::ASCENDING},
+                                               {null_order::BEFORE},
+                                               stream);
+
+  auto const num_rows   = indices->size();
+  auto const null_count = indices->null_count();
+  auto contents         = indices->release();
+
+  // The decoded positions at null rows are uninitialized, so remap with bounds
+  // nullification; the parent null mask covers those rows anyway
+  column_view const raw_indices{
+    data_type{type_id::INT32}, num_rows, contents.data->data(), nullptr, 0};
+  auto remapped = cudf::detail::gather(table_view{{remap->view()}},
+                                       raw_indices,
+                                       out_of_bounds_policy::NULLIFY,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       _mr);
+
+  // Rebuild the remapped values as the unsigned, non-nullable indices child that
+  // dictionary columns require
+  auto remapped_contents = remapped->release().front()->release();
+  auto new_indices       = std::make_unique<column>(data_type{type_id::UINT32},
+                                              num_rows,
+                                              std::move(*remapped_contents.data),
+                                              rmm::device_buffer{},
+                                              0);
+
+  return make_dictionary_column(std::move(keys_table->release().front()),
+                                std::move(new_indices),
+                                std::move(*contents.null_mask),
+                                null_count);
+}
+
 reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                    parquet_reader_options const& options,
                    rmm::mr::device_memory_resource* mr)
@@ -1564,23 +2198,87 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
 
-  // Select only columns required by the options
+  // Fully dictionary-encoded string columns may be returned as dictionary columns
+  _strings_to_dictionary = options.is_enabled_convert_strings_to_dictionaries();
+  CUDF_EXPECTS(not(_strings_to_categorical and _strings_to_dictionary),
+               "Strings cannot be converted to both categories and dictionaries");
+  if (_strings_to_dictionary) { _dictionary_schemas = _metadata->dictionary_only_string_schemas(); }
+
+  // Column selection is deferred to read() so that the selection can be rebuilt for
+  // every pass when reading in chunks
+  _selected_columns    = options.get_columns();
+  _use_pandas_metadata = options.is_enabled_use_pandas_metadata();
+
+  _filter = options.get_filter();
+  CUDF_EXPECTS(
+    not _filter.has_value() or (options.get_skip_rows() == 0 and options.get_num_rows() == -1),
+    "Row group filtering cannot be combined with skip_rows/num_rows");
+}
+
+void reader::impl::initialize_columns()
+{
   std::tie(_input_columns, _output_columns, _output_column_schemas) =
-    _metadata->select_columns(options.get_columns(),
-                              options.is_enabled_use_pandas_metadata(),
+    _metadata->select_columns(_selected_columns,
+                              _use_pandas_metadata,
                               _strings_to_categorical,
+                              _dictionary_schemas,
                               _timestamp_type.id(),
                               _strict_decimal_types);
 }
 
+std::vector<std::vector<std::vector<size_type>>> reader::impl::partition_row_groups(
+  std::size_t chunk_read_limit) const
+{
+  auto const num_sources = static_cast<size_type>(_metadata->get_num_sources());
+
+  std::vector<std::vector<std::vector<size_type>>> chunks;
+  auto current              = std::vector<std::vector<size_type>>(num_sources);
+  std::size_t current_bytes = 0;
+  bool current_empty        = true;
+
+  for (size_type src_idx = 0; src_idx < num_sources; ++src_idx) {
+    for (size_type rg_idx = 0; rg_idx < _metadata->get_num_row_groups(src_idx); ++rg_idx) {
+      auto const rg_bytes =
+        static_cast<std::size_t>(_metadata->get_row_group(rg_idx, src_idx).total_byte_size);
+      // Close out the current chunk once adding another row group would exceed the
+      // budget; a chunk always holds at least one row group
+      if (not current_empty and chunk_read_limit != 0 and
+          current_bytes + rg_bytes > chunk_read_limit) {
+        chunks.push_back(std::move(current));
+        current       = std::vector<std::vector<size_type>>(num_sources);
+        current_bytes = 0;
+        current_empty = true;
+      }
+      current[src_idx].push_back(rg_idx);
+      current_bytes += rg_bytes;
+      current_empty = false;
+    }
+  }
+  if (not current_empty) { chunks.push_back(std::move(current)); }
+
+  return chunks;
+}
+
 table_with_metadata reader::impl::read(size_type skip_rows,
                                        size_type num_rows,
                                        std::vector<std::vector<size_type>> const& row_group_list,
                                        rmm::cuda_stream_view stream)
 {
+  // (Re)build the column selection; the output buffers are consumed by make_column on
+  // each pass
+  initialize_columns();
+  _demoted_dictionary_schemas.clear();
+
+  // Prune row groups whose statistics prove the filter cannot be satisfied
+  auto const filtered_row_groups =
+    _filter.has_value()
+      ? _metadata->filter_row_groups(
+          row_group_list, _filter.value().get(), _output_column_schemas, _sources)
+      : row_group_list;
+
   // Select only row groups required
   const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+    _metadata->select_row_groups(filtered_row_groups, skip_rows, num_rows);
 
   table_metadata out_metadata;
 
@@ -1638,19 +2336,35 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         int32_t clock_rate;
         int8_t converted_type;
 
-        std::tie(type_width, clock_rate, converted_type) = conversion_info(
-          to_type_id(schema, _strings_to_categorical, _timestamp_type.id(), _strict_decimal_types),
-          _timestamp_type.id(),
-          schema.type,
-          schema.converted_type,
-          schema.type_length);
+        auto const column_type_id =
+          is_dictionary_index_column(col.schema_idx)
+            ? type_id::INT32
+            : to_type_id(
+                schema, _strings_to_categorical, _timestamp_type.id(), _strict_decimal_types);
+        std::tie(type_width, clock_rate, converted_type) = conversion_info(column_type_id,
+                                                                           _timestamp_type.id(),
+                                                                           schema.type,
+                                                                           schema.converted_type,
+                                                                           schema.type_length);
 
         column_chunk_offsets[chunks.size()] =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        // When the requested rows end inside this row group, the offset index lets us skip
+        // reading (and decompressing) the trailing pages entirely
+        auto const chunk_read_size =
+          (row_group_rows < row_group.num_rows)
+            ? trimmed_chunk_read_size(
+                _sources[row_group_source].get(),
+                _metadata->get_column_chunk(rg.index, rg.source_index, col.schema_idx),
+                column_chunk_offsets[chunks.size()],
+                row_group_rows,
+                col_meta.total_compressed_size)
+            : static_cast<size_t>(col_meta.total_compressed_size);
+
+        chunks.insert(gpu::ColumnChunkDesc(chunk_read_size,
                                            nullptr,
                                            col_meta.num_values,
                                            schema.type,
@@ -1668,6 +2382,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                            clock_rate,
                                            i,
                                            col.schema_idx));
+        chunks[chunks.size() - 1].output_string_dict_index =
+          is_dictionary_index_column(col.schema_idx);
 
         // Map each column chunk to its column index and its source index
         chunk_source_map[chunks.size() - 1] = row_group_source;
@@ -1700,6 +2416,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
       // decoding of column/page information
       decode_page_headers(chunks, pages, stream);
+
+      // the page headers can reveal plain-encoded data pages that the chunk metadata
+      // could not; fall back to regular string output for those columns
+      if (_strings_to_dictionary) { demote_mixed_encoding_dictionary_columns(chunks, pages); }
+
       if (total_decompressed_size > 0) {
         decomp_page_data = decompress_page_data(chunks, pages, stream);
         // Free compressed data
@@ -1742,18 +2463,43 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       // decoding of column data itself
       decode_page_data(chunks, pages, page_nesting_info, skip_rows, num_rows, stream);
 
-      // create the final output cudf columns
+      // create the final output cudf columns; in read_into mode the data was decoded
+      // directly into the caller's columns, so only the null counts need updating
       for (size_t i = 0; i < _output_columns.size(); ++i) {
+        if (_external_output != nullptr) {
+          CUDF_EXPECTS(_output_columns[i].size == _external_output->num_rows(),
+                       "Destination table row count does not match the decoded row count");
+          _external_output->get_column(i).set_null_count(_output_columns[i].null_count());
+          continue;
+        }
         column_name_info& col_name = out_metadata.schema_info.emplace_back("");
-        out_columns.emplace_back(make_column(_output_columns[i], &col_name, stream, _mr));
+        auto col                   = make_column(_output_columns[i], &col_name, stream, _mr);
+        if (is_dictionary_index_column(_output_column_schemas[i])) {
+          col = make_dictionary_output(std::move(col), _output_column_schemas[i], stream);
+        }
+        out_columns.emplace_back(std::move(col));
       }
     }
   }
 
+  if (_external_output != nullptr) {
+    CUDF_EXPECTS(_output_columns.empty() or
+                   _output_columns.front().size == _external_output->num_rows(),
+                 "Destination table row count does not match the decoded row count");
+    return {std::make_unique<table>(), std::move(out_metadata)};
+  }
+
   // Create empty columns as needed (this can happen if we've ended up with no actual data to read)
   for (size_t i = out_columns.size(); i < _output_columns.size(); ++i) {
     column_name_info& col_name = out_metadata.schema_info.emplace_back("");
-    out_columns.emplace_back(io::detail::empty_like(_output_columns[i], &col_name, stream, _mr));
+    if (is_dictionary_index_column(_output_column_schemas[i])) {
+      out_columns.emplace_back(make_dictionary_column(make_empty_column(data_type{type_id::STRING}),
+                                                      make_empty_column(data_type{type_id::UINT32}),
+                                                      rmm::device_buffer{},
+                                                      0));
+    } else {
+      out_columns.emplace_back(io::detail::empty_like(_output_columns[i], &col_name, stream, _mr));
+    }
   }
 
   // Return column names (must match order of returned columns)
@@ -1769,6 +2515,44 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+void reader::impl::read_into(size_type skip_rows,
+                             size_type num_rows,
+                             std::vector<std::vector<size_type>> const& row_group_indices,
+                             table& out,
+                             rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(out.num_columns() == static_cast<size_type>(_output_columns.size()),
+               "Destination table column count does not match the file schema");
+  for (size_t i = 0; i < _output_columns.size(); ++i) {
+    auto& out_col = out.get_column(i);
+    CUDF_EXPECTS(out_col.type() == _output_columns[i].type,
+                 "Destination column type does not match the file schema");
+    CUDF_EXPECTS(_output_columns[i].children.empty(),
+                 "read_into does not support nested columns");
+    CUDF_EXPECTS(not is_dictionary_index_column(_output_column_schemas[i]),
+                 "read_into does not support dictionary output columns");
+    auto view = out_col.mutable_view();
+    _output_columns[i].set_external(
+      view.head<void>(), out_col.nullable() ? view.null_mask() : nullptr, out_col.size());
+  }
+
+  auto const clear_external = [&] {
+    _external_output = nullptr;
+    for (auto& buffer : _output_columns) {
+      buffer.set_external(nullptr, nullptr, 0);
+    }
+  };
+
+  _external_output = &out;
+  try {
+    read(skip_rows, num_rows, row_group_indices, stream);
+  } catch (...) {
+    clear_external();
+    throw;
+  }
+  clear_external();
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                parquet_reader_options const& options,
@@ -1789,6 +2573,94 @@ table_with_metadata reader::read(parquet_reader_options const& options,
     options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
 }
 
+// Forward to implementation
+void reader::read_into(parquet_reader_options const& options,
+                       table& out,
+                       rmm::cuda_stream_view stream)
+{
+  _impl->read_into(
+    options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), out, stream);
+}
+
+chunked_reader::impl::impl(std::size_t chunk_read_limit,
+                           std::vector<std::unique_ptr<datasource>>&& sources,
+                           parquet_reader_options const& options,
+                           rmm::mr::device_memory_resource* mr)
+  : _reader(std::make_unique<reader::impl>(std::move(sources), options, mr))
+{
+  CUDF_EXPECTS(options.get_row_groups().empty() and options.get_skip_rows() == 0 and
+                 options.get_num_rows() == -1,
+               "Chunked reader does not support explicit row selection");
+  _chunks = _reader->partition_row_groups(chunk_read_limit);
+}
+
+table_with_metadata chunked_reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  return _reader->read(0, -1, _chunks[_current_chunk++], stream);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               parquet_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(chunk_read_limit, std::move(sources), options, mr))
+{
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
+}
+
+std::vector<cudf::io::parquet_file_metadata> read_parquet_metadata(
+  std::vector<std::unique_ptr<cudf::io::datasource>> const& sources)
+{
+  if (sources.empty()) { return {}; }
+
+  // Each footer parse is independent and dominated by the thrift decode, so fan the
+  // sources out over a host thread pool; no device work is involved
+  cudf::detail::thread_pool pool(std::min<size_t>(sources.size(), 16));
+  std::vector<std::future<cudf::io::parquet_file_metadata>> tasks;
+  tasks.reserve(sources.size());
+  for (auto const& source : sources) {
+    tasks.push_back(pool.submit([&source] {
+      metadata md(source.get());
+
+      cudf::io::parquet_file_metadata file_meta;
+      file_meta.num_rows       = md.num_rows;
+      file_meta.num_row_groups = static_cast<size_type>(md.row_groups.size());
+      for (auto const child_idx : md.schema[0].children_idx) {
+        file_meta.column_names.push_back(md.schema[child_idx].name);
+      }
+      for (auto const& rg : md.row_groups) {
+        file_meta.row_group_num_rows.push_back(rg.num_rows);
+        file_meta.row_group_total_byte_size.push_back(rg.total_byte_size);
+      }
+      for (auto const& kv : md.key_value_metadata) {
+        file_meta.key_value_metadata[kv.key] = kv.value;
+      }
+      return file_meta;
+    }));
+  }
+
+  std::vector<cudf::io::parquet_file_metadata> result;
+  result.reserve(tasks.size());
+  for (auto& task : tasks) {
+    result.push_back(task.get());
+  }
+  return result;
+}
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
@@ -26,14 +26,19 @@
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/parquet.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -79,7 +84,48 @@ class reader::impl {
                            std::vector<std::vector<size_type>> const& row_group_indices,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Decodes the dataset into the caller's pre-allocated columns.
+   *
+   * The destination must match the file schema: one fixed-width, non-nested column per
+   * output column, with matching types, exactly as many rows as will be decoded, and a
+   * null mask wherever the file can produce nulls. No output memory is allocated.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group_indices Indices of individual row groups to load if non-empty
+   * @param out Table whose columns receive the decoded data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void read_into(size_type skip_rows,
+                 size_type num_rows,
+                 std::vector<std::vector<size_type>> const& row_group_indices,
+                 table& out,
+                 rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Partitions the row groups of all sources into chunks that fit a byte budget.
+   *
+   * Row groups are packed greedily, in file order, by their total uncompressed size as
+   * recorded in the column chunk metadata. Each chunk contains at least one row group,
+   * even if that row group alone exceeds the limit.
+   *
+   * @param chunk_read_limit Limit on the uncompressed bytes per chunk; 0 for no limit
+   *
+   * @return Per-chunk lists of row group indices, one inner list per source
+   */
+  std::vector<std::vector<std::vector<size_type>>> partition_row_groups(
+    std::size_t chunk_read_limit) const;
+
  private:
+  /**
+   * @brief (Re)builds the input/output column selection from the reader options.
+   *
+   * `read()` consumes the output column buffers when materializing the final columns, so
+   * this is invoked before every pass to make the reader re-entrant for chunked reads.
+   */
+  void initialize_columns();
+
   /**
    * @brief Reads compressed page data to device memory
    *
@@ -196,6 +242,47 @@ class reader::impl {
                         size_t total_rows,
                         rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Whether the column at the given schema index is decoded straight to
+   * dictionary indices.
+   */
+  bool is_dictionary_index_column(int schema_idx) const
+  {
+    return _strings_to_dictionary and _dictionary_schemas.count(schema_idx) > 0 and
+           _demoted_dictionary_schemas.count(schema_idx) == 0;
+  }
+
+  /**
+   * @brief Demotes dictionary-index columns with non-dictionary-encoded data pages back
+   * to regular string output.
+   *
+   * The chunk metadata checked up front cannot distinguish a PLAIN-encoded dictionary
+   * page from a mid-chunk fallback to plain data pages; the decoded page headers can.
+   * Must be called after `decode_page_headers` and before the output buffers are
+   * allocated.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   */
+  void demote_mixed_encoding_dictionary_columns(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+                                                hostdevice_vector<gpu::PageInfo> const& pages);
+
+  /**
+   * @brief Assembles the output dictionary column for a column decoded to dictionary indices.
+   *
+   * Unifies the per-chunk dictionaries collected during `decode_page_data` into a single
+   * sorted, deduplicated keys column and remaps the decoded indices accordingly.
+   *
+   * @param indices INT32 column of per-chunk dictionary indices, as decoded
+   * @param schema_idx Schema index of the column
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The DICTIONARY32 output column
+   */
+  std::unique_ptr<column> make_dictionary_output(std::unique_ptr<column> indices,
+                                                 int schema_idx,
+                                                 rmm::cuda_stream_view stream);
+
  private:
   rmm::mr::device_memory_resource* _mr = nullptr;
   std::vector<std::unique_ptr<datasource>> _sources;
@@ -207,10 +294,66 @@ class reader::impl {
   std::vector<column_buffer> _output_columns;
   // _output_columns associated schema indices
   std::vector<int> _output_column_schemas;
+  // destination table for read_into(); when set, decoding writes into its columns
+  // instead of materializing new ones
+  table* _external_output = nullptr;
+
+  // Column selection retained so that `initialize_columns()` can be re-run per pass
+  std::vector<std::string> _selected_columns;
+  bool _use_pandas_metadata = true;
+
+  // Optional predicate used to prune row groups via column chunk statistics
+  std::optional<std::reference_wrapper<cudf::ast::expression const>> _filter;
 
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
+  // Schema indices of string columns whose chunks are all entirely dictionary-encoded
+  std::set<int> _dictionary_schemas;
+  // Schema indices demoted back to string output for the current pass
+  std::set<int> _demoted_dictionary_schemas;
+  // Concatenated per-chunk dictionary keys, per schema index, for the current pass
+  std::map<int, std::unique_ptr<column>> _chunk_dictionaries;
   data_type _timestamp_type{type_id::EMPTY};
   bool _strict_decimal_types = false;
+
+  // Pool used to overlap the host reads of column chunks across sources; the benefit from
+  // multithreaded read plateaus around 16 threads
+  cudf::detail::thread_pool _read_pool{16};
+};
+
+/**
+ * @brief Implementation for chunked Parquet reader
+ */
+class chunked_reader::impl {
+ public:
+  /**
+   * @brief Constructor from a read size limit and an array of dataset sources.
+   *
+   * @param chunk_read_limit Limit on the uncompressed bytes per chunk; 0 for no limit
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                parquet_reader_options const& options,
+                rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @copydoc cudf::io::detail::parquet::chunked_reader::has_next
+   */
+  bool has_next() const { return _current_chunk < _chunks.size(); }
+
+  /**
+   * @copydoc cudf::io::detail::parquet::chunked_reader::read_chunk
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
+ private:
+  std::unique_ptr<reader::impl> _reader;
+  // Row group selections for each chunk, in read order
+  std::vector<std::vector<std::vector<size_type>>> _chunks;
+  std::size_t _current_chunk = 0;
 };
 
 }  // namespace parquet
@@ -27,12 +27,14 @@
 #include "compact_protocol_writer.hpp"
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 
+#include <rmm/cuda_stream_pool.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
@@ -139,6 +141,7 @@ struct schema_tree_node : public SchemaElement {
   LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
+  bool skip_compression = false;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -342,6 +345,10 @@ struct leaf_schema_fn {
     } else if (std::is_same_v<T, numeric::decimal64>) {
       col_schema.type        = Type::INT64;
       col_schema.stats_dtype = statistics_dtype::dtype_decimal64;
+    } else if (std::is_same_v<T, numeric::decimal128>) {
+      col_schema.type        = Type::FIXED_LEN_BYTE_ARRAY;
+      col_schema.type_length = sizeof(__int128_t);
+      col_schema.stats_dtype = statistics_dtype::dtype_decimal128;
     } else {
       CUDF_FAIL("Unsupported fixed point type for parquet writer");
     }
@@ -530,8 +537,9 @@ std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const& linke
 
         col_schema.repetition_type = col_nullable ? OPTIONAL : REQUIRED;
         col_schema.name = (schema[parent_idx].name == "list") ? "element" : col_meta.get_name();
-        col_schema.parent_idx  = parent_idx;
-        col_schema.leaf_column = col;
+        col_schema.parent_idx       = parent_idx;
+        col_schema.leaf_column      = col;
+        col_schema.skip_compression = col_meta.is_enabled_skip_compression();
         schema.push_back(col_schema);
       }
     };
@@ -566,6 +574,7 @@ struct parquet_column_view {
 
   column_view cudf_column_view() const { return cudf_col; }
   parquet::Type physical_type() const { return schema_node.type; }
+  bool skip_compression() const { return schema_node.skip_compression; }
 
   std::vector<std::string> const& get_path_in_schema() { return path_in_schema; }
 
@@ -726,8 +735,9 @@ gpu::parquet_column_device_view parquet_column_view::get_device_view(
     desc.rep_values    = _rep_level.data();
     desc.def_values    = _def_level.data();
   }
-  desc.num_rows      = cudf_col.size();
-  desc.physical_type = static_cast<uint8_t>(physical_type());
+  desc.num_rows         = cudf_col.size();
+  desc.physical_type    = static_cast<uint8_t>(physical_type());
+  desc.skip_compression = schema_node.skip_compression;
 
   desc.level_bits = CompactProtocolReader::NumRequiredBits(max_rep_level()) << 4 |
                     CompactProtocolReader::NumRequiredBits(max_def_level());
@@ -735,6 +745,95 @@ gpu::parquet_column_device_view parquet_column_view::get_device_view(
   return desc;
 }
 
+/**
+ * @brief Returns true if a column is eligible for a per-chunk bloom filter
+ *
+ * Restricted to flat (non-list) columns whose plain-encoded representation can be
+ * reconstructed from the physical value alone, so that a reader hashing a predicate
+ * literal computes the same hash the writer computed from the column values. This
+ * excludes booleans (pointless), decimals (scale-dependent) and timestamps/durations
+ * (rescaled on write).
+ */
+bool is_bloom_filter_eligible(parquet_column_view const& col)
+{
+  if (col.is_list()) { return false; }
+  switch (col.physical_type()) {
+    case Type::INT32:
+    case Type::INT64: return cudf::is_numeric(col.leaf_column_view().type());
+    case Type::FLOAT:
+    case Type::DOUBLE: return true;
+    case Type::BYTE_ARRAY: return col.leaf_column_view().type().id() == type_id::STRING;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Functor that hashes a leaf column element for insertion into a bloom filter
+ *
+ * Values are hashed as their plain-encoded representation: integers narrower than the
+ * INT32/INT64 physical type they are stored as are widened before hashing so that a
+ * reader hashing the physical value computes the same result.
+ */
+struct bloom_filter_hasher {
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value and not std::is_same<T, bool>::value and
+                             sizeof(T) <= sizeof(int32_t)>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const
+  {
+    return XXHash_64<int32_t>{}(static_cast<int32_t>(col.element<T>(row)));
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value and not std::is_same<T, bool>::value and
+                             (sizeof(T) > sizeof(int32_t))>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const
+  {
+    return XXHash_64<int64_t>{}(static_cast<int64_t>(col.element<T>(row)));
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const
+  {
+    return XXHash_64<T>{}(col.element<T>(row));
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const
+  {
+    return XXHash_64<string_view>{}(col.element<string_view>(row));
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_same<T, bool>::value or
+                             (not std::is_arithmetic<T>::value and
+                              not std::is_same<T, string_view>::value)>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const&, size_type) const
+  {
+    cudf_assert(false && "Unsupported type for bloom filter hashing");
+    return 0;
+  }
+};
+
+/**
+ * @brief Functor that inserts one row's leaf value into a split-block bloom filter
+ */
+struct bloom_filter_builder {
+  gpu::parquet_column_device_view const* col_desc;  //!< Column description (device pointer)
+  uint32_t* words;                                  //!< Zero-initialized filter bitset
+  uint32_t num_blocks;                              //!< Number of 32-byte blocks in the bitset
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const& leaf = *col_desc->leaf_column;
+    if (leaf.is_null(row)) { return; }
+    auto const hash  = cudf::type_dispatcher(leaf.type(), bloom_filter_hasher{}, leaf, row);
+    auto const block = bloom_filter::block_index(hash, num_blocks) * bloom_filter::words_per_block;
+    for (uint32_t i = 0; i < bloom_filter::words_per_block; ++i) {
+      atomicOr(words + block + i, bloom_filter::word_mask(hash, i));
+    }
+  }
+};
+
 void writer::impl::init_page_fragments(cudf::detail::hostdevice_2dvector<gpu::PageFragment>& frag,
                                        device_span<gpu::parquet_column_device_view const> col_desc,
                                        uint32_t num_rows,
@@ -972,7 +1071,8 @@ void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks
                                 uint32_t rowgroups_in_batch,
                                 uint32_t first_rowgroup,
                                 const statistics_chunk* page_stats,
-                                const statistics_chunk* chunk_stats)
+                                const statistics_chunk* chunk_stats,
+                                rmm::cuda_stream_view stream)
 {
   auto batch_pages = pages.subspan(first_page_in_batch, pages_in_batch);
 
@@ -1027,6 +1127,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    pipeline_depth_(options.get_write_pipeline_depth()),
     out_sink_(std::move(sink)),
     single_write_mode(mode == SingleWriteMode::YES)
 {
@@ -1046,6 +1147,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    pipeline_depth_(options.get_write_pipeline_depth()),
     single_write_mode(mode == SingleWriteMode::YES),
     out_sink_(std::move(sink))
 {
@@ -1244,9 +1346,21 @@ void writer::impl::write(table_view const& table)
   auto dict_info_owner = build_chunk_dictionaries(chunks, col_desc, num_rows, stream);
   for (uint32_t rg = 0, global_rg = global_rowgroup_base; rg < num_rowgroups; rg++, global_rg++) {
     for (int col = 0; col < num_columns; col++) {
-      if (chunks.host_view()[rg][col].use_dictionary) {
+      auto& ck = chunks.host_view()[rg][col];
+      if (ck.use_dictionary) {
         md.row_groups[global_rg].columns[col].meta_data.encodings.push_back(
           Encoding::PLAIN_DICTIONARY);
+      } else if (compression_ != parquet::Compression::UNCOMPRESSED and
+                 not parquet_columns[col].skip_compression() and
+                 (parquet_columns[col].physical_type() == Type::FLOAT or
+                  parquet_columns[col].physical_type() == Type::DOUBLE)) {
+        // Floating point chunks that did not qualify for dictionary encoding are stored
+        // byte-stream-split: the i-th byte of every value is stored contiguously, which
+        // groups the sign/exponent bytes together and compresses far better than plain
+        // encoding. Same size as plain when left uncompressed, so only used with compression.
+        ck.encoding = Encoding::BYTE_STREAM_SPLIT;
+        md.row_groups[global_rg].columns[col].meta_data.encodings.push_back(
+          Encoding::BYTE_STREAM_SPLIT);
       }
     }
   }
@@ -1320,18 +1434,28 @@ void writer::impl::write(table_view const& table)
   // Clear compressed buffer size if compression has been turned off
   if (compression_ == parquet::Compression::UNCOMPRESSED) { max_comp_bfr_size = 0; }
 
-  // Initialize data pointers in batch
+  // Initialize data pointers in batch. Each pipeline slot gets its own encode/compress
+  // buffers and stream so that a batch can be encoded while the ones before it are still
+  // being flushed to the sink; a batch reuses the buffers of the batch `pipeline_depth`
+  // before it. Device memory for the batch buffers scales with the pipeline depth.
+  size_t const pipeline_depth =
+    std::max<size_t>(1, std::min<size_t>(pipeline_depth_, batch_list.size()));
   uint32_t num_stats_bfr =
     (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_pages + num_chunks : 0;
-  rmm::device_buffer uncomp_bfr(max_uncomp_bfr_size, stream);
-  rmm::device_buffer comp_bfr(max_comp_bfr_size, stream);
+  std::vector<rmm::device_buffer> uncomp_bfrs;
+  std::vector<rmm::device_buffer> comp_bfrs;
+  for (size_t slot = 0; slot < pipeline_depth; slot++) {
+    uncomp_bfrs.emplace_back(max_uncomp_bfr_size, stream);
+    comp_bfrs.emplace_back(max_comp_bfr_size, stream);
+  }
+  rmm::cuda_stream_pool stream_pool(pipeline_depth);
   rmm::device_uvector<gpu::EncPage> pages(num_pages, stream);
 
   // This contains stats for both the pages and the rowgroups. TODO: make them separate.
   rmm::device_uvector<statistics_chunk> page_stats(num_stats_bfr, stream);
   for (uint32_t b = 0, r = 0; b < (uint32_t)batch_list.size(); b++) {
-    uint8_t* bfr   = static_cast<uint8_t*>(uncomp_bfr.data());
-    uint8_t* bfr_c = static_cast<uint8_t*>(comp_bfr.data());
+    uint8_t* bfr   = static_cast<uint8_t*>(uncomp_bfrs[b % pipeline_depth].data());
+    uint8_t* bfr_c = static_cast<uint8_t*>(comp_bfrs[b % pipeline_depth].data());
     for (uint32_t j = 0; j < batch_list[b]; j++, r++) {
       for (int i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk* ck = &chunks[r][i];
@@ -1357,7 +1481,9 @@ void writer::impl::write(table_view const& table)
 
   pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
 
-  // Encode row groups in batches
+  // Encode row groups in batches. Each encoded batch is handed to the writer thread so
+  // that the sink write of one batch overlaps the encoding of the next.
+  std::vector<std::future<void>> batch_tasks;
   for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
        b++) {
     // Count pages in this batch
@@ -1366,6 +1492,12 @@ void writer::impl::write(table_view const& table)
     uint32_t first_page_in_next_batch =
       (rnext < num_rowgroups) ? chunks[rnext][0].first_page : num_pages;
     uint32_t pages_in_batch = first_page_in_next_batch - first_page_in_batch;
+
+    // This batch reuses the buffers of the batch `pipeline_depth` before it; that batch
+    // must be fully written out before encoding into them again
+    if (b >= pipeline_depth) { batch_tasks[b - pipeline_depth].wait(); }
+
+    auto const batch_stream = stream_pool.get_stream(b % pipeline_depth);
     // device_span<gpu::EncPage> batch_pages{pages.data() + first_page_in_batch, }
     encode_pages(
       chunks,
@@ -1377,70 +1509,139 @@ void writer::impl::write(table_view const& table)
       r,
       (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data() : nullptr,
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data() + num_pages
-                                                               : nullptr);
-    std::vector<std::future<void>> write_tasks;
-    for (; r < rnext; r++, global_r++) {
-      for (auto i = 0; i < num_columns; i++) {
-        gpu::EncColumnChunk* ck = &chunks[r][i];
-        uint8_t* dev_bfr;
-        if (ck->is_compressed) {
-          md.row_groups[global_r].columns[i].meta_data.codec = compression_;
-          dev_bfr                                            = ck->compressed_bfr;
-        } else {
-          dev_bfr = ck->uncompressed_bfr;
-        }
-
-        if (out_sink_->is_device_write_preferred(ck->compressed_size)) {
-          // let the writer do what it wants to retrieve the data from the gpu.
-          write_tasks.push_back(
-            out_sink_->device_write_async(dev_bfr + ck->ck_stat_size, ck->compressed_size, stream));
-          // we still need to do a (much smaller) memcpy for the statistics.
-          if (ck->ck_stat_size != 0) {
-            md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
-            CUDA_TRY(
-              cudaMemcpyAsync(md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
-                              dev_bfr,
-                              ck->ck_stat_size,
-                              cudaMemcpyDeviceToHost,
-                              stream.value()));
-            stream.synchronize();
-          }
-        } else {
-          if (!host_bfr) {
-            host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
-                                                uint8_t* ptr = nullptr;
-                                                CUDA_TRY(cudaMallocHost(&ptr, size));
-                                                return ptr;
-                                              }(max_chunk_bfr_size),
-                                              cudaFreeHost};
+                                                               : nullptr,
+      batch_stream);
+
+    uint32_t const first_rowgroup  = r;
+    uint32_t const first_global_rg = global_r;
+    uint32_t const batch_rowgroups = batch_list[b];
+    batch_tasks.push_back(write_pool_.submit([this,
+                                              &chunks,
+                                              &host_bfr,
+                                              batch_stream,
+                                              first_rowgroup,
+                                              first_global_rg,
+                                              batch_rowgroups,
+                                              num_columns,
+                                              max_chunk_bfr_size]() {
+      std::vector<std::future<void>> write_tasks;
+      for (uint32_t r = first_rowgroup, global_r = first_global_rg;
+           r < first_rowgroup + batch_rowgroups;
+           r++, global_r++) {
+        for (auto i = 0; i < num_columns; i++) {
+          gpu::EncColumnChunk* ck = &chunks[r][i];
+          uint8_t* dev_bfr;
+          if (ck->is_compressed) {
+            md.row_groups[global_r].columns[i].meta_data.codec = compression_;
+            dev_bfr                                            = ck->compressed_bfr;
+          } else {
+            dev_bfr = ck->uncompressed_bfr;
           }
-          // copy the full data
-          CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
-                                   dev_bfr,
-                                   ck->ck_stat_size + ck->compressed_size,
-                                   cudaMemcpyDeviceToHost,
-                                   stream.value()));
-          stream.synchronize();
-          out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
-          if (ck->ck_stat_size != 0) {
-            md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
-            memcpy(md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
-                   host_bfr.get(),
-                   ck->ck_stat_size);
+
+          if (out_sink_->is_device_write_preferred(ck->compressed_size)) {
+            // let the writer do what it wants to retrieve the data from the gpu.
+            write_tasks.push_back(out_sink_->device_write_async(
+              dev_bfr + ck->ck_stat_size, ck->compressed_size, batch_stream));
+            // we still need to do a (much smaller) memcpy for the statistics.
+            if (ck->ck_stat_size != 0) {
+              md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
+              CUDA_TRY(
+                cudaMemcpyAsync(md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
+                                dev_bfr,
+                                ck->ck_stat_size,
+                                cudaMemcpyDeviceToHost,
+                                batch_stream.value()));
+              batch_stream.synchronize();
+            }
+          } else {
+            if (!host_bfr) {
+              host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
+                                                  uint8_t* ptr = nullptr;
+                                                  CUDA_TRY(cudaMallocHost(&ptr, size));
+                                                  return ptr;
+                                                }(max_chunk_bfr_size),
+                                                cudaFreeHost};
+            }
+            // copy the full data
+            CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
+                                     dev_bfr,
+                                     ck->ck_stat_size + ck->compressed_size,
+                                     cudaMemcpyDeviceToHost,
+                                     batch_stream.value()));
+            batch_stream.synchronize();
+            out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
+            if (ck->ck_stat_size != 0) {
+              md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
+              memcpy(md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
+                     host_bfr.get(),
+                     ck->ck_stat_size);
+            }
           }
+          md.row_groups[global_r].total_byte_size += ck->compressed_size;
+          md.row_groups[global_r].columns[i].meta_data.data_page_offset =
+            current_chunk_offset + ((ck->use_dictionary) ? ck->dictionary_size : 0);
+          md.row_groups[global_r].columns[i].meta_data.dictionary_page_offset =
+            (ck->use_dictionary) ? current_chunk_offset : 0;
+          md.row_groups[global_r].columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
+          md.row_groups[global_r].columns[i].meta_data.total_compressed_size   = ck->compressed_size;
+          current_chunk_offset += ck->compressed_size;
         }
-        md.row_groups[global_r].total_byte_size += ck->compressed_size;
-        md.row_groups[global_r].columns[i].meta_data.data_page_offset =
-          current_chunk_offset + ((ck->use_dictionary) ? ck->dictionary_size : 0);
-        md.row_groups[global_r].columns[i].meta_data.dictionary_page_offset =
-          (ck->use_dictionary) ? current_chunk_offset : 0;
-        md.row_groups[global_r].columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
-        md.row_groups[global_r].columns[i].meta_data.total_compressed_size   = ck->compressed_size;
-        current_chunk_offset += ck->compressed_size;
       }
-    }
-    for (auto const& task : write_tasks) {
-      task.wait();
+      for (auto const& task : write_tasks) {
+        task.wait();
+      }
+    }));
+    r = rnext;
+    global_r += batch_rowgroups;
+  }
+  // All batches must be flushed before the buffers, chunk descriptors and streams go away
+  for (auto const& task : batch_tasks) {
+    task.wait();
+  }
+
+  // Emit per-chunk bloom filters once all chunk data has been written so that the recorded
+  // offsets are final. Filters are built from the leaf values on the device and appended
+  // between the last column chunk and the footer; readers locate them through
+  // bloom_filter_offset in the chunk metadata.
+  std::vector<uint8_t> bloom_hdr_blob;
+  for (uint32_t rg = 0, global_rg = global_rowgroup_base; rg < num_rowgroups; rg++, global_rg++) {
+    for (int i = 0; i < num_columns; i++) {
+      if (not is_bloom_filter_eligible(parquet_columns[i])) { continue; }
+      auto const& ck = chunks.host_view()[rg][i];
+      if (ck.num_rows == 0) { continue; }
+
+      // Size for ~16 bits per distinct value (rounded up to a power of two blocks), which
+      // keeps the false positive rate around 0.1%. Dictionary-encoded chunks know their
+      // exact distinct count; otherwise conservatively assume all values are distinct.
+      size_type const ndv = ck.use_dictionary ? ck.num_dict_entries : ck.num_values;
+      size_t num_bytes    = bloom_filter::bytes_per_block;
+      while (num_bytes < std::min<size_t>(static_cast<size_t>(ndv) * 2, 1 << 20)) {
+        num_bytes <<= 1;
+      }
+      auto const num_blocks = static_cast<uint32_t>(num_bytes / bloom_filter::bytes_per_block);
+
+      rmm::device_uvector<uint32_t> words(num_bytes / sizeof(uint32_t), stream);
+      CUDA_TRY(cudaMemsetAsync(words.data(), 0, num_bytes, stream.value()));
+      thrust::for_each_n(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<size_type>(ck.start_row),
+        ck.num_rows,
+        bloom_filter_builder{col_desc.device_ptr() + i, words.data(), num_blocks});
+      auto const host_words = cudf::detail::make_std_vector_sync(words, stream);
+
+      BloomFilterHeader header;
+      header.num_bytes                      = static_cast<int32_t>(num_bytes);
+      header.algorithm.isset.BLOCK          = true;
+      header.hash.isset.XXHASH              = true;
+      header.compression.isset.UNCOMPRESSED = true;
+      bloom_hdr_blob.resize(0);
+      CompactProtocolWriter cpw(&bloom_hdr_blob);
+      cpw.write(header);
+
+      md.row_groups[global_rg].columns[i].meta_data.bloom_filter_offset = current_chunk_offset;
+      out_sink_->host_write(bloom_hdr_blob.data(), bloom_hdr_blob.size());
+      out_sink_->host_write(host_words.data(), num_bytes);
+      current_chunk_offset += bloom_hdr_blob.size() + num_bytes;
     }
   }
 }
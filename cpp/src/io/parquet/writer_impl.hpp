@@ -26,6 +26,7 @@
 
 #include <cudf/io/data_sink.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/detail/parquet.hpp>
@@ -192,6 +193,7 @@ class writer::impl {
    * @param first_rowgroup first rowgroup in batch
    * @param page_stats optional page-level statistics (nullptr if none)
    * @param chunk_stats optional chunk-level statistics (nullptr if none)
+   * @param stream CUDA stream used for device memory operations and kernel launches
    */
   void encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                     device_span<gpu::EncPage> pages,
@@ -201,7 +203,8 @@ class writer::impl {
                     uint32_t rowgroups_in_batch,
                     uint32_t first_rowgroup,
                     const statistics_chunk* page_stats,
-                    const statistics_chunk* chunk_stats);
+                    const statistics_chunk* chunk_stats,
+                    rmm::cuda_stream_view stream);
 
  private:
   // TODO : figure out if we want to keep this. It is currently unused.
@@ -215,6 +218,9 @@ class writer::impl {
   Compression compression_           = Compression::UNCOMPRESSED;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
   bool int96_timestamps              = false;
+  // Maximum number of row group batches encoded/compressed while earlier batches are written;
+  // each in-flight batch holds its own encode/compress buffers
+  size_type pipeline_depth_ = 2;
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
   cudf::io::parquet::FileMetaData md;
   // optional user metadata
@@ -229,6 +235,10 @@ class writer::impl {
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
+
+  // Single thread that flushes encoded batches to the sink, in order, while later batches
+  // are still being encoded on the device
+  cudf::detail::thread_pool write_pool_{1};
 };
 
 }  // namespace parquet
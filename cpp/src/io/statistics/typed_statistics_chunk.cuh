@@ -55,12 +55,20 @@ class union_member {
   }
 
   template <typename T, typename U>
-  __device__ static std::enable_if_t<std::is_integral_v<T> and std::is_signed_v<T>, type<T, U>> get(
-    U& val)
+  __device__ static std::enable_if_t<std::is_integral_v<T> and std::is_signed_v<T> and
+                                       not std::is_same_v<T, __int128_t>,
+                                     type<T, U>>
+  get(U& val)
   {
     return val.i_val;
   }
 
+  template <typename T, typename U>
+  __device__ static std::enable_if_t<std::is_same_v<T, __int128_t>, type<T, U>> get(U& val)
+  {
+    return val.d128_val;
+  }
+
   template <typename T, typename U>
   __device__ static std::enable_if_t<std::is_floating_point_v<T>, type<T, U>> get(U& val)
   {
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <io/utilities/thread_pool.hpp>
+
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -43,6 +45,9 @@ int32_t constexpr ITEMS_PER_TILE   = ITEMS_PER_THREAD * THREADS_PER_TILE;
 int32_t constexpr TILES_PER_CHUNK  = 1024;
 int32_t constexpr ITEMS_PER_CHUNK  = ITEMS_PER_TILE * TILES_PER_CHUNK;
 
+// number of sources scanned concurrently when splitting a batch of sources
+int32_t constexpr SOURCES_IN_FLIGHT = 4;
+
 struct PatternScan {
   using BlockScan         = cub::BlockScan<multistate, THREADS_PER_TILE>;
   using BlockScanCallback = cudf::io::text::detail::scan_tile_state_callback<multistate>;
@@ -376,6 +381,42 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
     string_count, std::move(string_offsets), std::move(string_chars));
 }
 
+std::vector<std::unique_ptr<cudf::column>> multibyte_split(
+  std::vector<cudf::io::text::data_chunk_source const*> const& sources,
+  std::string const& delimiter,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr,
+  rmm::cuda_stream_pool& stream_pool)
+{
+  CUDF_FUNC_RANGE();
+
+  auto columns = std::vector<std::unique_ptr<cudf::column>>(sources.size());
+  if (sources.empty()) { return columns; }
+
+  // One scan stream per source; each source's scans additionally pull chunk streams from the
+  // shared pool, same as the single source path
+  auto source_streams = get_streams(sources.size(), stream_pool);
+  fork_stream(source_streams, stream);
+
+  // Worker threads overlap the host-side portions of the scans across sources: chunk reads and
+  // the blocking result size lookup between the two passes
+  auto workers = cudf::detail::thread_pool(std::min<uint32_t>(sources.size(), SOURCES_IN_FLIGHT));
+  auto tasks = std::vector<std::future<void>>();
+  tasks.reserve(sources.size());
+  for (std::size_t i = 0; i < sources.size(); i++) {
+    tasks.push_back(workers.submit([&, i] {
+      columns[i] = multibyte_split(*sources[i], delimiter, source_streams[i], mr, stream_pool);
+    }));
+  }
+  for (auto& task : tasks) {
+    task.get();
+  }
+
+  join_stream(source_streams, stream);
+
+  return columns;
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
@@ -391,6 +432,21 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
   return result;
 }
 
+std::vector<std::unique_ptr<cudf::column>> multibyte_split(
+  std::vector<cudf::io::text::data_chunk_source const*> const& sources,
+  std::string const& delimiter,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto stream = rmm::cuda_stream_default;
+  // 1 scan stream + 2 chunk streams per source in flight
+  auto stream_pool = rmm::cuda_stream_pool(SOURCES_IN_FLIGHT * 3);
+  auto result      = detail::multibyte_split(sources, delimiter, stream, mr, stream_pool);
+
+  stream.synchronize();
+
+  return result;
+}
+
 }  // namespace text
 }  // namespace io
 }  // namespace cudf
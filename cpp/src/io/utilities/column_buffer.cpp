@@ -32,6 +32,21 @@ void column_buffer::create(size_type _size,
 {
   size = _size;
 
+  if (is_external()) {
+    CUDF_EXPECTS(type.id() != type_id::STRING and type.id() != type_id::LIST and
+                   type.id() != type_id::STRUCT,
+                 "External output buffers are only supported for fixed-width columns");
+    CUDF_EXPECTS(size <= _external_capacity, "External output buffer is too small");
+    CUDF_EXPECTS(not is_nullable or _external_mask != nullptr,
+                 "External output column must be nullable to receive nulls");
+    CUDA_TRY(cudaMemsetAsync(_external_data, 0, size_of(type) * size, stream.value()));
+    if (is_nullable) {
+      CUDA_TRY(cudaMemsetAsync(
+        _external_mask, 0, bitmask_allocation_size_bytes(_external_capacity), stream.value()));
+    }
+    return;
+  }
+
   switch (type.id()) {
     case type_id::STRING:
       _strings = std::make_unique<rmm::device_uvector<string_index_pair>>(
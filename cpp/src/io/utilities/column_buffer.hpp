@@ -97,13 +97,27 @@ struct column_buffer {
               rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
               rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
-  auto data() { return _strings ? _strings->data() : _data.data(); }
+  // wrap caller-provided device memory; create() then validates capacity instead of
+  // allocating, and the decoders write directly into the caller's buffers
+  void set_external(void* data, bitmask_type* null_mask, size_type capacity)
+  {
+    _external_data     = data;
+    _external_mask     = null_mask;
+    _external_capacity = capacity;
+  }
+  bool is_external() const { return _external_data != nullptr; }
+
+  auto data()
+  {
+    return _external_data ? _external_data : (_strings ? _strings->data() : _data.data());
+  }
   auto data_size() const { return _strings ? _strings->size() : _data.size(); }
 
   template <typename T = uint32_t>
   auto null_mask()
   {
-    return static_cast<T*>(_null_mask.data());
+    return _external_mask ? reinterpret_cast<T*>(_external_mask)
+                          : static_cast<T*>(_null_mask.data());
   }
   auto null_mask_size() { return _null_mask.size(); };
 
@@ -113,6 +127,9 @@ struct column_buffer {
   rmm::device_buffer _data{};
   rmm::device_buffer _null_mask{};
   size_type _null_count{0};
+  void* _external_data{nullptr};
+  bitmask_type* _external_mask{nullptr};
+  size_type _external_capacity{0};
 
   data_type type{type_id::EMPTY};
   bool is_nullable{false};
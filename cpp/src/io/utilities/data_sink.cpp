@@ -29,8 +29,8 @@ namespace io {
  */
 class file_sink : public data_sink {
  public:
-  explicit file_sink(std::string const& filepath)
-    : _cufile_out(detail::make_cufile_output(filepath))
+  explicit file_sink(std::string const& filepath, gds_policy gds = gds_policy::AUTO)
+    : _cufile_out(detail::make_cufile_output(filepath, gds)), _gds(gds)
   {
     _output_stream.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
     CUDF_EXPECTS(_output_stream.is_open(), "Cannot open output file");
@@ -53,7 +53,8 @@ class file_sink : public data_sink {
 
   bool is_device_write_preferred(size_t size) const override
   {
-    return _cufile_out != nullptr && _cufile_out->is_cufile_io_preferred(size);
+    return _cufile_out != nullptr &&
+           (_gds == gds_policy::ALWAYS || _cufile_out->is_cufile_io_preferred(size));
   }
 
   void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
@@ -79,6 +80,7 @@ class file_sink : public data_sink {
   std::ofstream _output_stream;
   size_t _bytes_written = 0;
   std::unique_ptr<detail::cufile_output_impl> _cufile_out;
+  gds_policy _gds = gds_policy::AUTO;
 };
 
 /**
@@ -172,9 +174,9 @@ class user_sink_wrapper : public data_sink {
   cudf::io::data_sink* const user_sink;
 };
 
-std::unique_ptr<data_sink> data_sink::create(const std::string& filepath)
+std::unique_ptr<data_sink> data_sink::create(const std::string& filepath, gds_policy gds)
 {
-  return std::make_unique<file_sink>(filepath);
+  return std::make_unique<file_sink>(filepath, gds);
 }
 
 std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
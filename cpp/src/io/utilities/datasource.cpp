@@ -18,10 +18,16 @@
 
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <cudf/utilities/error.hpp>
 #include "file_io_utilities.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
 
 namespace cudf {
 namespace io {
@@ -32,8 +38,11 @@ namespace {
  */
 class file_source : public datasource {
  public:
-  explicit file_source(const char* filepath)
-    : _file(filepath, O_RDONLY), _cufile_in(detail::make_cufile_input(filepath))
+  explicit file_source(const char* filepath, gds_policy gds = gds_policy::AUTO)
+    : _file(filepath, O_RDONLY),
+      _filepath(filepath),
+      _cufile_in(detail::make_cufile_input(filepath, gds)),
+      _gds(gds)
   {
   }
 
@@ -43,7 +52,8 @@ class file_source : public datasource {
 
   bool is_device_read_preferred(size_t size) const override
   {
-    return _cufile_in != nullptr && _cufile_in->is_cufile_io_preferred(size);
+    return _cufile_in != nullptr &&
+           (_gds == gds_policy::ALWAYS || _cufile_in->is_cufile_io_preferred(size));
   }
 
   std::unique_ptr<datasource::buffer> device_read(size_t offset,
@@ -80,11 +90,20 @@ class file_source : public datasource {
 
   size_t size() const override { return _file.size(); }
 
+  std::string content_id() const override
+  {
+    struct stat st;
+    if (stat(_filepath.c_str(), &st) != 0) { return std::string{}; }
+    return _filepath + ":" + std::to_string(st.st_mtime) + ":" + std::to_string(st.st_size);
+  }
+
  protected:
   detail::file_wrapper _file;
 
  private:
+  std::string _filepath;
   std::unique_ptr<detail::cufile_input_impl> _cufile_in;
+  gds_policy _gds = gds_policy::AUTO;
 };
 
 /**
@@ -95,8 +114,11 @@ class file_source : public datasource {
  */
 class memory_mapped_source : public file_source {
  public:
-  explicit memory_mapped_source(const char* filepath, size_t offset, size_t size)
-    : file_source(filepath)
+  explicit memory_mapped_source(const char* filepath,
+                                size_t offset,
+                                size_t size,
+                                gds_policy gds = gds_policy::AUTO)
+    : file_source(filepath, gds)
   {
     if (_file.size() != 0) map(_file.desc(), offset, size);
   }
@@ -161,7 +183,10 @@ class memory_mapped_source : public file_source {
  */
 class direct_read_source : public file_source {
  public:
-  explicit direct_read_source(const char* filepath) : file_source(filepath) {}
+  explicit direct_read_source(const char* filepath, gds_policy gds = gds_policy::AUTO)
+    : file_source(filepath, gds)
+  {
+  }
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
@@ -188,6 +213,106 @@ class direct_read_source : public file_source {
   }
 };
 
+/**
+ * @brief Wrapper that reads ahead a known list of extents on a thread pool.
+ *
+ * Each extent is submitted to the pool at construction; reads served from the cache
+ * block only until their own extent has arrived, so independent extents overlap.
+ */
+class prefetched_source : public datasource {
+  struct extent {
+    size_t offset;
+    size_t size;
+    std::future<std::unique_ptr<buffer>> pending;
+    std::unique_ptr<buffer> data;
+  };
+
+ public:
+  explicit prefetched_source(std::unique_ptr<datasource> source,
+                             std::vector<std::pair<size_t, size_t>> const& extents,
+                             size_t num_threads)
+    : _source(std::move(source)), _pool(num_threads)
+  {
+    _extents.reserve(extents.size());
+    for (auto const& e : extents) {
+      auto const offset = e.first;
+      auto const size   = e.second;
+      _extents.push_back(
+        extent{offset, size, _pool.submit([this, offset, size] {
+                 return _source->host_read(offset, size);
+               })});
+    }
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const cached = lookup(offset, size);
+    if (cached == nullptr) { return _source->host_read(offset, size); }
+    return std::make_unique<non_owning_buffer>(
+      const_cast<uint8_t*>(cached->data->data()) + (offset - cached->offset), size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const cached = lookup(offset, size);
+    if (cached == nullptr) { return _source->host_read(offset, size, dst); }
+    std::memcpy(dst, cached->data->data() + (offset - cached->offset), size);
+    return size;
+  }
+
+  bool supports_device_read() const override { return _source->supports_device_read(); }
+
+  bool is_device_read_preferred(size_t size) const override
+  {
+    return _source->is_device_read_preferred(size);
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, stream);
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, dst, stream);
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read_async(offset, size, dst, stream);
+  }
+
+  size_t size() const override { return _source->size(); }
+
+ private:
+  // Returns the completed extent fully containing [offset, offset + size), if any
+  extent* lookup(size_t offset, size_t size)
+  {
+    std::lock_guard<std::mutex> lock(_extents_mutex);
+    auto const it = std::find_if(_extents.begin(), _extents.end(), [&](extent const& e) {
+      return offset >= e.offset && offset + size <= e.offset + e.size;
+    });
+    if (it == _extents.end()) { return nullptr; }
+    if (it->data == nullptr) { it->data = it->pending.get(); }
+    // The source may have clamped the read; only serve fully cached requests
+    if (it->data == nullptr || it->data->size() < (offset - it->offset) + size) { return nullptr; }
+    return &*it;
+  }
+
+  std::unique_ptr<datasource> _source;
+  cudf::detail::thread_pool _pool;
+  std::vector<extent> _extents;
+  std::mutex _extents_mutex;
+};
+
 /**
  * @brief Wrapper class for user implemented data sources
  *
@@ -236,16 +361,20 @@ class user_datasource_wrapper : public datasource {
 
 std::unique_ptr<datasource> datasource::create(const std::string& filepath,
                                                size_t offset,
-                                               size_t size)
+                                               size_t size,
+                                               gds_policy gds)
 {
-#ifdef CUFILE_FOUND
-  if (detail::cufile_config::instance()->is_required()) {
+  if (gds == gds_policy::ALWAYS) {
     // avoid mmap as GDS is expected to be used for most reads
-    return std::make_unique<direct_read_source>(filepath.c_str());
+    return std::make_unique<direct_read_source>(filepath.c_str(), gds);
+  }
+#ifdef CUFILE_FOUND
+  if (gds != gds_policy::OFF && detail::cufile_config::instance()->is_required()) {
+    return std::make_unique<direct_read_source>(filepath.c_str(), gds);
   }
 #endif
   // Use our own memory mapping implementation for direct file reads
-  return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
+  return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size, gds);
 }
 
 std::unique_ptr<datasource> datasource::create(host_buffer const& buffer)
@@ -261,5 +390,14 @@ std::unique_ptr<datasource> datasource::create(datasource* source)
   return std::make_unique<user_datasource_wrapper>(source);
 }
 
+std::unique_ptr<datasource> datasource::create_prefetched(
+  std::unique_ptr<datasource> source,
+  std::vector<std::pair<size_t, size_t>> const& extents,
+  size_t num_threads)
+{
+  CUDF_EXPECTS(num_threads > 0, "Read-ahead requires at least one thread");
+  return std::make_unique<prefetched_source>(std::move(source), extents, num_threads);
+}
+
 }  // namespace io
 }  // namespace cudf
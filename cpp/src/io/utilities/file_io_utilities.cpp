@@ -282,32 +282,42 @@ std::future<void> cufile_output_impl::write_async(void const* data, size_t offse
 }
 #endif
 
-std::unique_ptr<cufile_input_impl> make_cufile_input(std::string const& filepath)
+std::unique_ptr<cufile_input_impl> make_cufile_input(std::string const& filepath, gds_policy gds)
 {
+  if (gds == gds_policy::OFF) { return nullptr; }
 #ifdef CUFILE_FOUND
-  if (cufile_config::instance()->is_enabled()) {
+  if (gds == gds_policy::ALWAYS or cufile_config::instance()->is_enabled()) {
     try {
       return std::make_unique<cufile_input_impl>(filepath);
     } catch (...) {
-      if (cufile_config::instance()->is_required()) throw;
+      if (gds == gds_policy::ALWAYS or cufile_config::instance()->is_required()) throw;
     }
   }
-#endif
   return nullptr;
+#else
+  CUDF_EXPECTS(gds != gds_policy::ALWAYS,
+               "cuFile IO was requested but cuDF was built without cuFile support");
+  return nullptr;
+#endif
 }
 
-std::unique_ptr<cufile_output_impl> make_cufile_output(std::string const& filepath)
+std::unique_ptr<cufile_output_impl> make_cufile_output(std::string const& filepath, gds_policy gds)
 {
+  if (gds == gds_policy::OFF) { return nullptr; }
 #ifdef CUFILE_FOUND
-  if (cufile_config::instance()->is_enabled()) {
+  if (gds == gds_policy::ALWAYS or cufile_config::instance()->is_enabled()) {
     try {
       return std::make_unique<cufile_output_impl>(filepath);
     } catch (...) {
-      if (cufile_config::instance()->is_required()) throw;
+      if (gds == gds_policy::ALWAYS or cufile_config::instance()->is_required()) throw;
     }
   }
-#endif
   return nullptr;
+#else
+  CUDF_EXPECTS(gds != gds_policy::ALWAYS,
+               "cuFile IO was requested but cuDF was built without cuFile support");
+  return nullptr;
+#endif
 }
 
 }  // namespace detail
@@ -304,18 +304,22 @@ class cufile_output_impl final : public cufile_output {
 /**
  * @brief Creates a `cufile_input_impl` object
  *
- * Returns a null pointer if an exception occurs in the `cufile_input_impl` constructor, or if the
- * cuFile library is not installed.
+ * With the default `AUTO` policy, creation is governed by the global cuFile configuration
+ * and a null pointer is returned on failure. `ALWAYS` creates the object regardless of the
+ * global configuration and throws when cuFile cannot be used; `OFF` always returns null.
  */
-std::unique_ptr<cufile_input_impl> make_cufile_input(std::string const& filepath);
+std::unique_ptr<cufile_input_impl> make_cufile_input(std::string const& filepath,
+                                                     gds_policy gds = gds_policy::AUTO);
 
 /**
  * @brief Creates a `cufile_output_impl` object
  *
- * Returns a null pointer if an exception occurs in the `cufile_output_impl` constructor, or if the
- * cuFile library is not installed.
+ * With the default `AUTO` policy, creation is governed by the global cuFile configuration
+ * and a null pointer is returned on failure. `ALWAYS` creates the object regardless of the
+ * global configuration and throws when cuFile cannot be used; `OFF` always returns null.
  */
-std::unique_ptr<cufile_output_impl> make_cufile_output(std::string const& filepath);
+std::unique_ptr<cufile_output_impl> make_cufile_output(std::string const& filepath,
+                                                       gds_policy gds = gds_policy::AUTO);
 
 }  // namespace detail
 }  // namespace io
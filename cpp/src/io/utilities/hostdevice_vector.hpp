@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "pinned_memory_pool.hpp"
+
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -57,7 +59,8 @@ class hostdevice_vector {
     : num_elements(initial_size), max_elements(max_size)
   {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      h_data = static_cast<T*>(
+        cudf::io::detail::pinned_memory_pool::instance().allocate(sizeof(T) * max_elements));
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
@@ -65,8 +68,7 @@ class hostdevice_vector {
   ~hostdevice_vector()
   {
     if (max_elements != 0) {
-      auto const free_result = cudaFreeHost(h_data);
-      assert(free_result == cudaSuccess);
+      cudf::io::detail::pinned_memory_pool::instance().deallocate(h_data, sizeof(T) * max_elements);
     }
   }
 
@@ -241,6 +241,8 @@ namespace gpu {
  * @param opts A set of parsing options
  * @param escape_char A boolean value to signify whether to consider `\` as escape character or
  * just a character.
+ * @param skip_nested A boolean value to signify whether to treat unquoted `{}`/`[]` regions as
+ * part of the field instead of splitting inside them (used for nested JSON values).
  *
  * @return Pointer to the last character in the field, including the
  *  delimiter(s) following the field data
@@ -248,11 +250,13 @@ namespace gpu {
 __device__ __inline__ char const* seek_field_end(char const* begin,
                                                  char const* end,
                                                  parse_options_view const& opts,
-                                                 bool escape_char = false)
+                                                 bool escape_char = false,
+                                                 bool skip_nested = false)
 {
   bool quotation   = false;
   auto current     = begin;
   bool escape_next = false;
+  int nest_depth   = 0;
   while (current < end) {
     // Use simple logic to ignore control chars between any quote seq
     // Handles nominal cases including doublequotes within quotes, but
@@ -262,16 +266,22 @@ __device__ __inline__ char const* seek_field_end(char const* begin,
     if (*current == opts.quotechar and not escape_next) {
       quotation = !quotation;
     } else if (!quotation) {
-      if (*current == opts.delimiter) {
-        while (opts.multi_delimiter && (current + 1 < end) && *(current + 1) == opts.delimiter) {
-          ++current;
+      if (skip_nested and (*current == '{' or *current == '[')) {
+        ++nest_depth;
+      } else if (nest_depth > 0 and (*current == '}' or *current == ']')) {
+        --nest_depth;
+      } else if (nest_depth == 0) {
+        if (*current == opts.delimiter) {
+          while (opts.multi_delimiter && (current + 1 < end) && *(current + 1) == opts.delimiter) {
+            ++current;
+          }
+          break;
+        } else if (*current == opts.terminator) {
+          break;
+        } else if (*current == '\r' && (current + 1 < end && *(current + 1) == '\n')) {
+          --end;
+          break;
         }
-        break;
-      } else if (*current == opts.terminator) {
-        break;
-      } else if (*current == '\r' && (current + 1 < end && *(current + 1) == '\n')) {
-        --end;
-        break;
       }
     }
 
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace io {
+
+std::vector<table_view> partition_for_write(table_view const& input,
+                                            std::size_t target_partition_bytes)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(target_partition_bytes > 0, "Partition byte budget must be positive");
+
+  if (input.num_rows() == 0) { return {input}; }
+
+  auto const stream   = rmm::cuda_stream_default;
+  auto const row_bits = cudf::detail::row_bit_count(input, stream);
+
+  // running total of the row sizes; 64-bit so tables past 256MB of bits are safe
+  rmm::device_uvector<int64_t> cumulative_bits(input.num_rows(), stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         row_bits->view().begin<size_type>(),
+                         row_bits->view().end<size_type>(),
+                         cumulative_bits.begin());
+
+  auto const total_bits  = cumulative_bits.back_element(stream);
+  auto const target_bits = static_cast<int64_t>(target_partition_bytes) * 8;
+  auto const num_splits  = static_cast<size_type>((total_bits - 1) / target_bits);
+  if (num_splits <= 0) { return {input}; }
+
+  // boundary k starts at the first row whose running total exceeds k budgets
+  rmm::device_uvector<int64_t> search_targets(num_splits, stream);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   search_targets.begin(),
+                   search_targets.end(),
+                   [target_bits] __device__(size_type i) { return (i + 1) * target_bits; });
+
+  rmm::device_uvector<size_type> d_splits(num_splits, stream);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      cumulative_bits.begin(),
+                      cumulative_bits.end(),
+                      search_targets.begin(),
+                      search_targets.end(),
+                      d_splits.begin());
+
+  // rows larger than the budget collapse neighboring boundaries; drop the
+  // duplicates and the degenerate endpoints so every partition is non-empty
+  auto splits = cudf::detail::make_std_vector_sync(d_splits, stream);
+  splits.erase(std::unique(splits.begin(), splits.end()), splits.end());
+  splits.erase(std::remove_if(splits.begin(),
+                              splits.end(),
+                              [&](size_type split) {
+                                return split == 0 || split == input.num_rows();
+                              }),
+               splits.end());
+
+  return cudf::split(input, splits);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinned_memory_pool.hpp"
+#include "config_utils.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+namespace {
+
+constexpr std::size_t allocation_alignment = 256;
+
+std::size_t align_up(std::size_t bytes)
+{
+  return (bytes + allocation_alignment - 1) & ~(allocation_alignment - 1);
+}
+
+bool pool_enabled()
+{
+  static bool const enabled = getenv_or("LIBCUDF_PINNED_MEMORY_POOL", "ON") != "OFF";
+  return enabled;
+}
+
+}  // namespace
+
+pinned_memory_pool& pinned_memory_pool::instance()
+{
+  static pinned_memory_pool pool;
+  return pool;
+}
+
+pinned_memory_pool::~pinned_memory_pool()
+{
+  for (auto* slab : _slabs) {
+    auto const free_result = cudaFreeHost(slab);
+    assert(free_result == cudaSuccess);
+  }
+}
+
+void* pinned_memory_pool::allocate(std::size_t bytes)
+{
+  if (bytes == 0) { return nullptr; }
+  if (not pool_enabled()) {
+    void* ptr = nullptr;
+    CUDA_TRY(cudaMallocHost(&ptr, bytes));
+    return ptr;
+  }
+
+  auto const size = align_up(bytes);
+  const std::lock_guard<std::mutex> lock(_mutex);
+
+  auto const fits = [size](auto const& block) { return block.second >= size; };
+  auto block_it   = std::find_if(_free_blocks.begin(), _free_blocks.end(), fits);
+  if (block_it == _free_blocks.end()) {
+    expand(size);
+    block_it = std::find_if(_free_blocks.begin(), _free_blocks.end(), fits);
+  }
+
+  auto* const ptr      = block_it->first;
+  auto const remainder = block_it->second - size;
+  _free_blocks.erase(block_it);
+  if (remainder != 0) { _free_blocks.emplace(ptr + size, remainder); }
+  return ptr;
+}
+
+void pinned_memory_pool::deallocate(void* ptr, std::size_t bytes) noexcept
+{
+  if (ptr == nullptr) { return; }
+  if (not pool_enabled()) {
+    auto const free_result = cudaFreeHost(ptr);
+    assert(free_result == cudaSuccess);
+    return;
+  }
+
+  auto const size = align_up(bytes);
+  const std::lock_guard<std::mutex> lock(_mutex);
+
+  auto const is_slab_start = [&](char* block) {
+    return std::find(_slabs.begin(), _slabs.end(), block) != _slabs.end();
+  };
+
+  auto block_it = _free_blocks.emplace(static_cast<char*>(ptr), size).first;
+  // coalesce with the following block, unless that block starts a different slab
+  auto const next_it = std::next(block_it);
+  if (next_it != _free_blocks.end() and block_it->first + block_it->second == next_it->first and
+      not is_slab_start(next_it->first)) {
+    block_it->second += next_it->second;
+    _free_blocks.erase(next_it);
+  }
+  // coalesce with the preceding block, unless this block starts a slab
+  if (block_it != _free_blocks.begin() and not is_slab_start(block_it->first)) {
+    auto const prev_it = std::prev(block_it);
+    if (prev_it->first + prev_it->second == block_it->first) {
+      prev_it->second += block_it->second;
+      _free_blocks.erase(block_it);
+    }
+  }
+}
+
+void pinned_memory_pool::expand(std::size_t min_bytes)
+{
+  auto const slab_size = std::max(min_bytes, _next_slab_size);
+  char* slab           = nullptr;
+  CUDA_TRY(cudaMallocHost(reinterpret_cast<void**>(&slab), slab_size));
+  _slabs.push_back(slab);
+  _free_blocks.emplace(slab, slab_size);
+  // grow geometrically, like rmm's pool resource
+  _next_slab_size = slab_size * 2;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief A process-wide pool of pinned host memory.
+ *
+ * Suballocates from large `cudaMallocHost` slabs, the same way rmm's pool resource
+ * suballocates device memory. Each `cudaMallocHost`/`cudaFreeHost` call synchronizes the
+ * device, so allocating staging buffers directly (e.g. one `hostdevice_vector` per chunk
+ * descriptor array in the readers) serializes otherwise independent work; drawing them
+ * from the pool turns all but the first allocation into a host-only free-list operation.
+ *
+ * The pool grows on demand, doubling the slab size with each expansion, and never shrinks.
+ * Freed blocks are coalesced with their neighbors within a slab. All member functions are
+ * thread-safe.
+ *
+ * Set the environment variable `LIBCUDF_PINNED_MEMORY_POOL` to "OFF" to bypass the pool
+ * and allocate directly with `cudaMallocHost`.
+ */
+class pinned_memory_pool {
+ public:
+  /**
+   * @brief Returns the process-wide pinned memory pool.
+   */
+  static pinned_memory_pool& instance();
+
+  /**
+   * @brief Allocates pinned host memory of at least `bytes` bytes.
+   *
+   * The returned pointer is aligned to 256 bytes. Returns `nullptr` when `bytes` is zero.
+   *
+   * @throw cudf::cuda_error if the pool needs to grow and the pinned allocation fails
+   *
+   * @param bytes The size of the allocation
+   * @return Pointer to the allocated pinned memory
+   */
+  void* allocate(std::size_t bytes);
+
+  /**
+   * @brief Returns memory obtained from `allocate` to the pool.
+   *
+   * @param ptr Pointer returned by a previous call to `allocate`
+   * @param bytes The size passed to that `allocate` call
+   */
+  void deallocate(void* ptr, std::size_t bytes) noexcept;
+
+  pinned_memory_pool(pinned_memory_pool const&) = delete;
+  pinned_memory_pool& operator=(pinned_memory_pool const&) = delete;
+
+ private:
+  pinned_memory_pool() = default;
+  ~pinned_memory_pool();
+
+  /**
+   * @brief Allocates a new slab large enough for `min_bytes` and adds it to the free list.
+   */
+  void expand(std::size_t min_bytes);
+
+  std::mutex _mutex;
+  std::map<char*, std::size_t> _free_blocks;  ///< free blocks, address-ordered for coalescing
+  std::vector<char*> _slabs;                  ///< upstream cudaMallocHost allocations
+  std::size_t _next_slab_size{1 << 22};  ///< 4 MiB initially; doubles with each expansion
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
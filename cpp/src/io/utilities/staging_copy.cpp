@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "staging_copy.hpp"
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns true if `ptr` does not need staging: pinned, registered, or device memory.
+ */
+bool is_transfer_ready(void const* ptr)
+{
+  cudaPointerAttributes attributes{};
+  auto const result = cudaPointerGetAttributes(&attributes, ptr);
+  if (result != cudaSuccess) {
+    cudaGetLastError();  // pageable host memory is not known to the runtime
+    return false;
+  }
+  return attributes.type != cudaMemoryTypeUnregistered;
+}
+
+}  // namespace
+
+staging_copy_engine& staging_copy_engine::instance()
+{
+  static staging_copy_engine engine;
+  return engine;
+}
+
+staging_copy_engine::~staging_copy_engine()
+{
+  if (not _initialized) { return; }
+  // process teardown; the driver may already be gone, so ignore errors
+  for (auto event : _chunk_free) {
+    cudaEventDestroy(event);
+  }
+  for (auto chunk : _chunks) {
+    pinned_memory_pool::instance().deallocate(chunk, chunk_size);
+  }
+  cudaStreamDestroy(_copy_stream);
+}
+
+void staging_copy_engine::initialize()
+{
+  CUDA_TRY(cudaStreamCreateWithFlags(&_copy_stream, cudaStreamNonBlocking));
+  for (std::size_t i = 0; i < num_chunks; ++i) {
+    _chunks[i] = static_cast<char*>(pinned_memory_pool::instance().allocate(chunk_size));
+    CUDA_TRY(cudaEventCreateWithFlags(&_chunk_free[i], cudaEventDisableTiming));
+  }
+  _initialized = true;
+}
+
+void staging_copy_engine::copy_to_device(void* dst,
+                                         void const* src,
+                                         std::size_t bytes,
+                                         rmm::cuda_stream_view stream)
+{
+  if (bytes == 0) { return; }
+
+  // already-pinned or device sources transfer at full bandwidth without staging
+  if (is_transfer_ready(src)) {
+    CUDA_TRY(cudaMemcpyAsync(dst, src, bytes, cudaMemcpyDefault, stream.value()));
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (not _initialized) { initialize(); }
+
+  // the copy stream must not start DMA before `stream` reaches this point
+  CUDA_TRY(cudaEventRecord(_chunk_free[0], stream.value()));
+  CUDA_TRY(cudaStreamWaitEvent(_copy_stream, _chunk_free[0], 0));
+
+  auto const* h_src = static_cast<char const*>(src);
+  auto* d_dst       = static_cast<char*>(dst);
+  std::size_t slot  = 0;
+  for (std::size_t offset = 0; offset < bytes; offset += chunk_size) {
+    auto const this_chunk = std::min(chunk_size, bytes - offset);
+    // wait until the slot's previous DMA has drained before overwriting it
+    CUDA_TRY(cudaEventSynchronize(_chunk_free[slot]));
+    std::memcpy(_chunks[slot], h_src + offset, this_chunk);
+    CUDA_TRY(cudaMemcpyAsync(
+      d_dst + offset, _chunks[slot], this_chunk, cudaMemcpyHostToDevice, _copy_stream));
+    CUDA_TRY(cudaEventRecord(_chunk_free[slot], _copy_stream));
+    slot = (slot + 1) % num_chunks;
+  }
+
+  // order the caller's stream after the last chunk's DMA
+  auto const last = (slot + num_chunks - 1) % num_chunks;
+  CUDA_TRY(cudaStreamWaitEvent(stream.value(), _chunk_free[last], 0));
+}
+
+void copy_to_device_staged(void* dst,
+                           void const* src,
+                           std::size_t bytes,
+                           rmm::cuda_stream_view stream)
+{
+  staging_copy_engine::instance().copy_to_device(dst, src, bytes, stream);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
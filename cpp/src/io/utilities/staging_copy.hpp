@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Pipelines pageable host to device transfers through pinned staging buffers.
+ *
+ * `cudaMemcpyAsync` from pageable memory degenerates to a synchronous copy at pageable
+ * bandwidth. This engine stages the transfer through a small ring of pinned chunks on a
+ * dedicated copy stream so the host-side `memcpy` into one chunk overlaps the DMA of the
+ * previous chunk, reaching pinned-copy bandwidth for arbitrarily large pageable inputs.
+ *
+ * The copy is stream-ordered with respect to the caller's stream: the destination stream
+ * waits on an event recorded after the last chunk, so work enqueued on it afterwards sees
+ * the transferred data without a host synchronization.
+ *
+ * Sources that are already pinned (or device-resident) are copied directly.
+ */
+class staging_copy_engine {
+ public:
+  /**
+   * @brief Returns the process-wide staging engine.
+   */
+  static staging_copy_engine& instance();
+
+  /**
+   * @brief Copies `bytes` bytes from host memory `src` to device memory `dst`.
+   *
+   * Safe to call from multiple threads; concurrent copies are serialized on the
+   * engine's ring.
+   *
+   * @param dst Destination device pointer
+   * @param src Source host pointer; may be pageable
+   * @param bytes Number of bytes to copy
+   * @param stream CUDA stream the copy is ordered on
+   */
+  void copy_to_device(void* dst, void const* src, std::size_t bytes, rmm::cuda_stream_view stream);
+
+  staging_copy_engine(staging_copy_engine const&) = delete;
+  staging_copy_engine& operator=(staging_copy_engine const&) = delete;
+
+ private:
+  staging_copy_engine() = default;
+  ~staging_copy_engine();
+
+  /**
+   * @brief Allocates the pinned ring, events, and copy stream on first use.
+   */
+  void initialize();
+
+  static constexpr std::size_t chunk_size = 1 << 22;  ///< 4 MiB per staging chunk
+  static constexpr std::size_t num_chunks = 4;        ///< ring depth
+
+  std::mutex _mutex;
+  bool _initialized = false;
+  cudaStream_t _copy_stream{};
+  std::array<char*, num_chunks> _chunks{};
+  std::array<cudaEvent_t, num_chunks> _chunk_free{};  ///< signaled when a chunk's DMA finished
+};
+
+/**
+ * @brief Convenience wrapper around `staging_copy_engine::instance().copy_to_device`.
+ */
+void copy_to_device_staged(void* dst,
+                           void const* src,
+                           std::size_t bytes,
+                           rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -25,11 +25,12 @@
 #include <atomic>       // std::atomic
 #include <chrono>       // std::chrono
 #include <cstdint>      // std::int_fast64_t, std::uint_fast32_t
+#include <deque>        // std::deque
 #include <functional>   // std::function
 #include <future>       // std::future, std::promise
+#include <iterator>     // std::make_move_iterator
 #include <memory>       // std::shared_ptr, std::unique_ptr
 #include <mutex>        // std::mutex, std::scoped_lock
-#include <queue>        // std::queue
 #include <thread>       // std::this_thread, std::thread
 #include <type_traits>  // std::decay_t, std::enable_if_t, std::is_void_v, std::invoke_result_t
 #include <utility>      // std::move, std::swap
@@ -37,11 +38,25 @@
 namespace cudf {
 namespace detail {
 
+/**
+ * @brief Priority of a task submitted to a `thread_pool`.
+ *
+ * High-priority tasks are kept in a dedicated queue that every worker drains before looking at its
+ * own tasks, so they run ahead of any normal-priority work that has not started yet.
+ */
+enum class task_priority { normal, high };
+
 /**
  * @brief A C++17 thread pool class. The user submits tasks to be executed into a queue. Whenever a
  * thread becomes available, it pops a task from the queue and executes it. Each task is
  * automatically assigned a future, which can be used to wait for the task to finish executing
  * and/or obtain its eventual return value.
+ *
+ * Normal-priority tasks are distributed round-robin over one deque per worker thread, each with its
+ * own lock; an idle worker first drains its own deque and then steals from the other workers'
+ * deques. This keeps submission and popping off a single shared lock when many small tasks are in
+ * flight. Tasks submitted with `task_priority::high` are placed in a shared queue that all workers
+ * check before their own, so they start ahead of queued normal-priority work.
  */
 class thread_pool {
   typedef std::uint_fast32_t ui32;
@@ -57,6 +72,7 @@ class thread_pool {
    */
   thread_pool(const ui32& _thread_count = std::thread::hardware_concurrency())
     : thread_count(_thread_count ? _thread_count : std::thread::hardware_concurrency()),
+      queues(new task_queue[_thread_count ? _thread_count : std::thread::hardware_concurrency()]),
       threads(new std::thread[_thread_count ? _thread_count : std::thread::hardware_concurrency()])
   {
     create_threads();
@@ -81,8 +97,15 @@ class thread_pool {
    */
   size_t get_tasks_queued() const
   {
-    const std::scoped_lock lock(queue_mutex);
-    return tasks.size();
+    size_t queued = [&] {
+      const std::scoped_lock lock(high_queue.mutex);
+      return high_queue.tasks.size();
+    }();
+    for (ui32 i = 0; i < thread_count; i++) {
+      const std::scoped_lock lock(queues[i].mutex);
+      queued += queues[i].tasks.size();
+    }
+    return queued;
   }
 
   /**
@@ -148,21 +171,40 @@ class thread_pool {
   }
 
   /**
-   * @brief Push a function with no arguments or return value into the task queue.
+   * @brief Push a function with no arguments or return value into a task queue.
    *
    * @tparam F The type of the function.
+   * @param priority The priority of the task.
    * @param task The function to push.
    */
   template <typename F>
-  void push_task(const F& task)
+  void push_task(task_priority priority, const F& task)
   {
     tasks_total++;
-    {
-      const std::scoped_lock lock(queue_mutex);
-      tasks.push(std::function<void()>(task));
+    if (priority == task_priority::high) {
+      const std::scoped_lock lock(high_queue.mutex);
+      high_queue.tasks.push_back(std::function<void()>(task));
+    } else {
+      // round-robin over the worker queues; an idle worker steals if its own queue stays empty
+      auto& queue = queues[next_queue++ % thread_count];
+      const std::scoped_lock lock(queue.mutex);
+      queue.tasks.push_back(std::function<void()>(task));
     }
   }
 
+  /**
+   * @brief Push a function with no arguments or return value into a task queue with normal
+   * priority.
+   *
+   * @tparam F The type of the function.
+   * @param task The function to push.
+   */
+  template <typename F>
+  void push_task(const F& task)
+  {
+    push_task(task_priority::normal, task);
+  }
+
   /**
    * @brief Push a function with arguments, but no return value, into the task queue.
    * @details The function is wrapped inside a lambda in order to hide the arguments, as the tasks
@@ -200,7 +242,19 @@ class thread_pool {
     wait_for_tasks();
     running = false;
     destroy_threads();
+    // gather the tasks left in the worker queues (non-empty only if the pool was paused) so they
+    // can be redistributed over the new set of queues
+    std::deque<std::function<void()>> remaining_tasks;
+    for (ui32 i = 0; i < thread_count; i++) {
+      remaining_tasks.insert(remaining_tasks.end(),
+                             std::make_move_iterator(queues[i].tasks.begin()),
+                             std::make_move_iterator(queues[i].tasks.end()));
+    }
     thread_count = _thread_count ? _thread_count : std::thread::hardware_concurrency();
+    queues.reset(new task_queue[thread_count]);
+    for (size_t i = 0; i < remaining_tasks.size(); i++) {
+      queues[i % thread_count].tasks.push_back(std::move(remaining_tasks[i]));
+    }
     threads.reset(new std::thread[thread_count]);
     paused = was_paused;
     create_threads();
@@ -223,10 +277,32 @@ class thread_pool {
             typename... A,
             typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
   std::future<R> submit(const F& task, const A&... args)
+  {
+    return submit(task_priority::normal, task, args...);
+  }
+
+  /**
+   * @brief Submit a function with zero or more arguments and a return value into a task queue,
+   * and get a future for its eventual returned value.
+   *
+   * @tparam F The type of the function.
+   * @tparam A The types of the zero or more arguments to pass to the function.
+   * @tparam R The return type of the function.
+   * @param priority The priority of the task. High-priority tasks start ahead of queued
+   * normal-priority tasks.
+   * @param task The function to submit.
+   * @param args The zero or more arguments to pass to the function.
+   * @return A future to be used later to obtain the function's returned value, waiting for it to
+   * finish its execution if needed.
+   */
+  template <typename F,
+            typename... A,
+            typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
+  std::future<R> submit(task_priority priority, const F& task, const A&... args)
   {
     std::shared_ptr<std::promise<R>> promise(new std::promise<R>);
     std::future<R> future = promise->get_future();
-    push_task([task, args..., promise] {
+    push_task(priority, [task, args..., promise] {
       try {
         if constexpr (std::is_void_v<R>) {
           task(args...);
@@ -276,13 +352,21 @@ class thread_pool {
   ui32 sleep_duration = 1000;
 
  private:
+  /**
+   * @brief A queue of tasks with the mutex that synchronizes access to it.
+   */
+  struct task_queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
   /**
    * @brief Create the threads in the pool and assign a worker to each thread.
    */
   void create_threads()
   {
     for (ui32 i = 0; i < thread_count; i++) {
-      threads[i] = std::thread(&thread_pool::worker, this);
+      threads[i] = std::thread(&thread_pool::worker, this, i);
     }
   }
 
@@ -297,22 +381,45 @@ class thread_pool {
   }
 
   /**
-   * @brief Try to pop a new task out of the queue.
+   * @brief Try to pop a task out of the given queue.
    *
+   * @param queue The queue to pop from.
    * @param task A reference to the task. Will be populated with a function if the queue is not
    * empty.
+   * @param steal Whether the caller is stealing from another worker's queue. The owning worker
+   * pops from the front while thieves pop from the back, to reduce contention on the same end.
    * @return true if a task was found, false if the queue is empty.
    */
-  bool pop_task(std::function<void()>& task)
+  bool pop_task_from(task_queue& queue, std::function<void()>& task, bool steal)
   {
-    const std::scoped_lock lock(queue_mutex);
-    if (tasks.empty())
-      return false;
-    else {
-      task = std::move(tasks.front());
-      tasks.pop();
-      return true;
+    const std::scoped_lock lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    if (steal) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
     }
+    return true;
+  }
+
+  /**
+   * @brief Try to pop a new task for the given worker: first a high-priority task, then a task
+   * from the worker's own queue, then one stolen from a sibling's queue.
+   *
+   * @param index The index of the worker's queue.
+   * @param task A reference to the task. Will be populated with a function if one was found.
+   * @return true if a task was found, false if all queues are empty.
+   */
+  bool pop_task(ui32 index, std::function<void()>& task)
+  {
+    if (pop_task_from(high_queue, task, false)) return true;
+    if (pop_task_from(queues[index], task, false)) return true;
+    for (ui32 i = 1; i < thread_count; i++) {
+      if (pop_task_from(queues[(index + i) % thread_count], task, true)) return true;
+    }
+    return false;
   }
 
   /**
@@ -329,13 +436,15 @@ class thread_pool {
 
   /**
    * @brief A worker function to be assigned to each thread in the pool. Continuously pops tasks out
-   * of the queue and executes them, as long as the atomic variable running is set to true.
+   * of the queues and executes them, as long as the atomic variable running is set to true.
+   *
+   * @param index The index of the queue owned by this worker.
    */
-  void worker()
+  void worker(const ui32 index)
   {
     while (running) {
       std::function<void()> task;
-      if (!paused && pop_task(task)) {
+      if (!paused && pop_task(index, task)) {
         task();
         tasks_total--;
       } else {
@@ -344,11 +453,6 @@ class thread_pool {
     }
   }
 
-  /**
-   * @brief A mutex to synchronize access to the task queue by different threads.
-   */
-  mutable std::mutex queue_mutex;
-
   /**
    * @brief An atomic variable indicating to the workers to keep running. When set to false, the
    * workers permanently stop working.
@@ -356,15 +460,26 @@ class thread_pool {
   std::atomic<bool> running = true;
 
   /**
-   * @brief A queue of tasks to be executed by the threads.
+   * @brief The queue of high-priority tasks, drained by every worker before its own queue.
+   */
+  mutable task_queue high_queue;
+
+  /**
+   * @brief The index of the worker queue the next normal-priority task is pushed to.
    */
-  std::queue<std::function<void()>> tasks;
+  std::atomic<ui32> next_queue = 0;
 
   /**
    * @brief The number of threads in the pool.
    */
   ui32 thread_count;
 
+  /**
+   * @brief The normal-priority task queues, one owned by each worker thread. Idle workers steal
+   * from the back of the other workers' queues.
+   */
+  std::unique_ptr<task_queue[]> queues;
+
   /**
    * @brief A smart pointer to manage the memory allocated for the threads.
    */
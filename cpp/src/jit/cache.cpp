@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <jit/cache.hpp>
+
 #include <cudf/utilities/error.hpp>
 
 #include <cuda.h>
@@ -21,6 +23,7 @@
 
 #include <cstddef>
 #include <filesystem>
+#include <utility>
 
 namespace cudf {
 namespace jit {
@@ -150,5 +153,20 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   return *(existing_cache->second);
 }
 
+std::future<void> preload_kernels(jitify2::PreprocessedProgramData preprog,
+                                  std::vector<std::string> kernel_names)
+{
+  return std::async(
+    std::launch::async,
+    [preprog = std::move(preprog), kernel_names = std::move(kernel_names)]() mutable {
+      auto& cache = get_program_cache(preprog);
+      for (auto const& kernel_name : kernel_names) {
+        // the result is deliberately discarded: a failed compilation is reported
+        // when the kernel is requested by an actual operation.
+        cache.get_kernel(kernel_name, {}, {}, {"-arch=sm_."});
+      }
+    });
+}
+
 }  // namespace jit
 }  // namespace cudf
@@ -17,12 +17,30 @@
 #pragma once
 
 #include <jitify2.hpp>
+
+#include <future>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace jit {
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Loads the given kernels into `preprog`'s program cache on a background thread.
+ *
+ * Each kernel is compiled with NVRTC or, when available, loaded from the on-disk
+ * kernel cache. A kernel that fails to compile is skipped; the error surfaces when
+ * the kernel is next requested through `get_program_cache`.
+ *
+ * @param preprog Preprocessed program the kernels are instantiated from
+ * @param kernel_names Fully instantiated names of the kernels to load
+ * @return A future that becomes ready once all kernels have been processed
+ */
+std::future<void> preload_kernels(jitify2::PreprocessedProgramData preprog,
+                                  std::vector<std::string> kernel_names);
+
 }  // namespace jit
 }  // namespace cudf
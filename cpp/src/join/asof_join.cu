@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/join_common_utils.hpp>
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Indicates whether a column may serve as the ordered `on` column of an
+ * as-of join.
+ */
+struct is_supported_on_type {
+  template <typename T>
+  constexpr bool operator()() const
+  {
+    return std::is_integral_v<T> or cudf::is_chrono<T>();
+  }
+};
+
+/**
+ * @brief Extracts an `on` column's values as 64-bit ticks so tolerance and
+ * nearest-distance arithmetic need no further type dispatch.
+ */
+struct extract_on_ticks_fn {
+  template <typename T, std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+  void operator()(column_view const& col, int64_t* out, rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream),
+                      col.begin<T>(),
+                      col.end<T>(),
+                      out,
+                      [] __device__(T v) { return static_cast<int64_t>(v); });
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_chrono<T>()>* = nullptr>
+  void operator()(column_view const& col, int64_t* out, rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(
+      rmm::exec_policy(stream), col.begin<T>(), col.end<T>(), out, [] __device__(T v) {
+        if constexpr (cudf::is_timestamp<T>()) {
+          return static_cast<int64_t>(v.time_since_epoch().count());
+        } else {
+          return static_cast<int64_t>(v.count());
+        }
+      });
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_integral_v<T> and not cudf::is_chrono<T>()>* = nullptr>
+  void operator()(column_view const&, int64_t*, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("asof_join requires integral or chrono typed on columns");
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(table_view const& left,
+                                                          table_view const& right,
+                                                          size_type left_on,
+                                                          size_type right_on,
+                                                          std::vector<size_type> const& left_by,
+                                                          std::vector<size_type> const& right_by,
+                                                          asof_join_direction direction,
+                                                          std::optional<int64_t> tolerance,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_by.size() == right_by.size(), "Mismatch in number of by-key columns");
+  CUDF_EXPECTS(not tolerance.has_value() or *tolerance >= 0, "tolerance must be non-negative");
+
+  auto const left_on_col  = left.column(left_on);
+  auto const right_on_col = right.column(right_on);
+  CUDF_EXPECTS(left_on_col.type() == right_on_col.type(), "Mismatch in types of on columns");
+  CUDF_EXPECTS(cudf::type_dispatcher(left_on_col.type(), is_supported_on_type{}),
+               "asof_join requires integral or chrono typed on columns");
+
+  // The search keys are the by-key columns followed by the on column, matching the
+  // required sort order of the right table
+  std::vector<size_type> left_key_indices(left_by);
+  std::vector<size_type> right_key_indices(right_by);
+  left_key_indices.push_back(left_on);
+  right_key_indices.push_back(right_on);
+  auto const left_keys  = left.select(left_key_indices);
+  auto const right_keys = right.select(right_key_indices);
+  for (size_type i = 0; i < left_keys.num_columns(); ++i) {
+    CUDF_EXPECTS(left_keys.column(i).type() == right_keys.column(i).type(),
+                 "Mismatch in types of by-key columns");
+    CUDF_EXPECTS(not left_keys.column(i).has_nulls() and not right_keys.column(i).has_nulls(),
+                 "Key columns of an as-of join must not contain nulls");
+  }
+
+  auto const left_num_rows  = left.num_rows();
+  auto const right_num_rows = right.num_rows();
+  auto result = std::make_unique<rmm::device_uvector<size_type>>(left_num_rows, stream, mr);
+  if (left_num_rows == 0) { return result; }
+  if (right_num_rows == 0) {
+    thrust::fill(rmm::exec_policy(stream), result->begin(), result->end(), JoinNoneValue);
+    return result;
+  }
+
+  // Each left row's backward match is the last right row at or before it in
+  // (by..., on) order and its forward match is the first right row at or after it;
+  // both come from one binary search pass over the sorted right table
+  std::vector<order> const column_order(left_keys.num_columns(), order::ASCENDING);
+  std::vector<null_order> const null_precedence(left_keys.num_columns(), null_order::BEFORE);
+  auto const lower = lower_bound(right_keys,
+                                 left_keys,
+                                 column_order,
+                                 null_precedence,
+                                 stream,
+                                 rmm::mr::get_current_device_resource());
+  auto const upper = upper_bound(right_keys,
+                                 left_keys,
+                                 column_order,
+                                 null_precedence,
+                                 stream,
+                                 rmm::mr::get_current_device_resource());
+  auto const d_lower = lower->view().data<size_type>();
+  auto const d_upper = upper->view().data<size_type>();
+
+  rmm::device_uvector<int64_t> left_ticks(left_num_rows, stream);
+  rmm::device_uvector<int64_t> right_ticks(right_num_rows, stream);
+  cudf::type_dispatcher(
+    left_on_col.type(), extract_on_ticks_fn{}, left_on_col, left_ticks.data(), stream);
+  cudf::type_dispatcher(
+    right_on_col.type(), extract_on_ticks_fn{}, right_on_col, right_ticks.data(), stream);
+
+  // A candidate row matches only if its by keys equal the left row's; the sort order
+  // then guarantees its on value lies on the requested side of the left value
+  auto const left_by_device  = table_device_view::create(left.select(left_by), stream);
+  auto const right_by_device = table_device_view::create(right.select(right_by), stream);
+  auto const by_equal = row_equality_comparator<false>{*left_by_device, *right_by_device};
+
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(left_num_rows),
+    result->begin(),
+    [d_lower,
+     d_upper,
+     by_equal,
+     d_left_ticks  = left_ticks.data(),
+     d_right_ticks = right_ticks.data(),
+     right_num_rows,
+     direction,
+     has_tolerance = tolerance.has_value(),
+     tolerance     = tolerance.value_or(0)] __device__(size_type i) {
+      auto const backward = d_upper[i] - 1;
+      auto const forward  = d_lower[i];
+      auto const is_match = [&](size_type idx) {
+        if (idx < 0 or idx >= right_num_rows or not by_equal(i, idx)) { return false; }
+        if (not has_tolerance) { return true; }
+        auto const distance = d_left_ticks[i] - d_right_ticks[idx];
+        return (distance < 0 ? -distance : distance) <= tolerance;
+      };
+
+      bool const backward_ok = direction != asof_join_direction::FORWARD and is_match(backward);
+      bool const forward_ok  = direction != asof_join_direction::BACKWARD and is_match(forward);
+      if (backward_ok and forward_ok) {
+        return d_left_ticks[i] - d_right_ticks[backward] <= d_right_ticks[forward] - d_left_ticks[i]
+                 ? backward
+                 : forward;
+      }
+      if (backward_ok) { return backward; }
+      if (forward_ok) { return forward; }
+      return JoinNoneValue;
+    });
+
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(table_view const& left,
+                                                          table_view const& right,
+                                                          size_type left_on,
+                                                          size_type right_on,
+                                                          std::vector<size_type> const& left_by,
+                                                          std::vector<size_type> const& right_by,
+                                                          asof_join_direction direction,
+                                                          std::optional<int64_t> tolerance,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::asof_join(
+    left, right, left_on, right_on, left_by, right_by, direction, tolerance, stream, mr);
+}
+
+}  // namespace cudf
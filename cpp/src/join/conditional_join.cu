@@ -81,6 +81,14 @@ conditional_join(table_view const& left,
     }
   }
 
+  // Try compiling the predicate into a specialized kernel first; interpreting
+  // the expression per row pair is considerably slower. Unsupported
+  // expressions, types, or join kinds fall through to the generic path.
+  if (auto jit_result =
+        conditional_join_jit(left, right, binary_predicate, join_type, output_size, stream, mr)) {
+    return std::move(*jit_result);
+  }
+
   // If evaluating the expression may produce null outputs we create a nullable
   // output column and follow the null-supporting expression evaluation code
   // path.
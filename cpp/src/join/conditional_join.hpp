@@ -50,6 +50,37 @@ conditional_join(table_view const& left,
                  rmm::cuda_stream_view stream           = rmm::cuda_stream_default,
                  rmm::mr::device_memory_resource* mr    = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Attempts to perform `conditional_join` with the predicate compiled
+ * into a specialized kernel at first use.
+ *
+ * The AST expression is translated to CUDA source and compiled through the
+ * jitify program cache, so repeated joins with the same predicate reuse the
+ * compiled kernel (in-process and on disk, like the binaryop JIT kernels).
+ * Only inner joins over numeric, non-null columns with operators that have a
+ * direct C++ equivalent are compiled; all other cases return `std::nullopt`
+ * and the caller falls back to the generic AST interpreter.
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right columns to join
+ * @param binary_predicate The expression to evaluate per row pair
+ * @param join_type The type of join to be performed
+ * @param output_size Optional precomputed size of the join output
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Join output indices vector pair, or `std::nullopt` if the predicate
+ * cannot be compiled
+ */
+std::optional<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                        std::unique_ptr<rmm::device_uvector<size_type>>>>
+conditional_join_jit(table_view const& left,
+                     table_view const& right,
+                     ast::expression const& binary_predicate,
+                     join_kind join_type,
+                     std::optional<std::size_t> output_size = {},
+                     rmm::cuda_stream_view stream           = rmm::cuda_stream_default,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Computes the size of a join operation between two tables without
  * materializing the result and returns the total size value.
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/conditional_join.hpp>
+#include <join/join_common_utils.hpp>
+
+#include <jit_preprocessed_files/join/jit/kernel.cu.jit.hpp>
+
+#include <jit/cache.hpp>
+#include <jit/type.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Maps a binary AST operator onto the C++ operator token used in generated source.
+ *
+ * Operators with null-aware semantics or without a direct C++ equivalent return
+ * `std::nullopt`, which makes the caller fall back to the AST interpreter.
+ */
+std::optional<std::string> binary_operator_token(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::ADD: return "+";
+    case ast::ast_operator::SUB: return "-";
+    case ast::ast_operator::MUL: return "*";
+    case ast::ast_operator::DIV: return "/";
+    case ast::ast_operator::EQUAL: return "==";
+    case ast::ast_operator::NOT_EQUAL: return "!=";
+    case ast::ast_operator::LESS: return "<";
+    case ast::ast_operator::GREATER: return ">";
+    case ast::ast_operator::LESS_EQUAL: return "<=";
+    case ast::ast_operator::GREATER_EQUAL: return ">=";
+    case ast::ast_operator::BITWISE_AND: return "&";
+    case ast::ast_operator::BITWISE_OR: return "|";
+    case ast::ast_operator::BITWISE_XOR: return "^";
+    case ast::ast_operator::LOGICAL_AND: return "&&";
+    case ast::ast_operator::LOGICAL_OR: return "||";
+    default: return std::nullopt;
+  }
+}
+
+struct literal_stringifier {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+  std::optional<std::string> operator()(scalar const& s, rmm::cuda_stream_view stream) const
+  {
+    auto const& typed = static_cast<numeric_scalar<T> const&>(s);
+    std::ostringstream os;
+    os.precision(std::numeric_limits<T>::max_digits10);
+    // The unary plus promotes int8/uint8 so they print as numbers, not characters
+    os << "static_cast<" << cudf::jit::get_type_name(s.type()) << ">(" << +typed.value(stream)
+       << ")";
+    return os.str();
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_numeric<T>()>* = nullptr>
+  std::optional<std::string> operator()(scalar const&, rmm::cuda_stream_view) const
+  {
+    return std::nullopt;
+  }
+};
+
+/**
+ * @brief Translates an AST expression into an equivalent C++ expression over the
+ * raw column pointers passed to the JIT kernels.
+ *
+ * Returns `std::nullopt` if the expression references non-numeric columns or
+ * uses an operator that codegen does not support.
+ */
+std::optional<std::string> codegen_expression(ast::expression const& expr,
+                                              table_view const& left,
+                                              table_view const& right,
+                                              rmm::cuda_stream_view stream)
+{
+  if (auto const* col = dynamic_cast<ast::column_reference const*>(&expr)) {
+    if (col->get_table_source() == ast::table_reference::OUTPUT) { return std::nullopt; }
+    auto const type = col->get_data_type(left, right);
+    if (not cudf::is_numeric(type)) { return std::nullopt; }
+    auto const is_left = col->get_table_source() == ast::table_reference::LEFT;
+    std::ostringstream os;
+    os << "static_cast<" << cudf::jit::get_type_name(type) << " const*>("
+       << (is_left ? "left_columns" : "right_columns") << "[" << col->get_column_index() << "])["
+       << (is_left ? "left_row" : "right_row") << "]";
+    return os.str();
+  }
+
+  if (auto const* lit = dynamic_cast<ast::literal const*>(&expr)) {
+    if (not lit->is_valid(stream)) { return std::nullopt; }
+    return type_dispatcher(lit->get_data_type(), literal_stringifier{}, lit->get_scalar(), stream);
+  }
+
+  if (auto const* op = dynamic_cast<ast::operation const*>(&expr)) {
+    auto const operands = op->get_operands();
+    if (operands.size() == 2) {
+      auto const token = binary_operator_token(op->get_operator());
+      if (not token) { return std::nullopt; }
+      auto const lhs = codegen_expression(operands[0], left, right, stream);
+      auto const rhs = codegen_expression(operands[1], left, right, stream);
+      if (not lhs or not rhs) { return std::nullopt; }
+      return "(" + *lhs + " " + *token + " " + *rhs + ")";
+    }
+    if (operands.size() == 1) {
+      auto const operand = codegen_expression(operands[0], left, right, stream);
+      if (not operand) { return std::nullopt; }
+      switch (op->get_operator()) {
+        case ast::ast_operator::IDENTITY: return "(" + *operand + ")";
+        case ast::ast_operator::NOT: return "(!" + *operand + ")";
+        case ast::ast_operator::BIT_INVERT: return "(~" + *operand + ")";
+        case ast::ast_operator::CAST_TO_INT64: return "static_cast<int64_t>(" + *operand + ")";
+        case ast::ast_operator::CAST_TO_UINT64: return "static_cast<uint64_t>(" + *operand + ")";
+        case ast::ast_operator::CAST_TO_FLOAT64: return "static_cast<double>(" + *operand + ")";
+        default: return std::nullopt;
+      }
+    }
+    return std::nullopt;
+  }
+
+  return std::nullopt;
+}
+
+/// Collects the raw data pointer of every column in `table` into device memory.
+rmm::device_uvector<void const*> column_pointers(table_view const& table,
+                                                 rmm::cuda_stream_view stream)
+{
+  std::vector<void const*> pointers;
+  pointers.reserve(table.num_columns());
+  std::transform(table.begin(), table.end(), std::back_inserter(pointers), [](auto const& col) {
+    return cudf::jit::get_data_ptr(col);
+  });
+  return cudf::detail::make_device_uvector_async(pointers, stream);
+}
+
+}  // namespace
+
+std::optional<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                        std::unique_ptr<rmm::device_uvector<size_type>>>>
+conditional_join_jit(table_view const& left,
+                     table_view const& right,
+                     ast::expression const& binary_predicate,
+                     join_kind join_type,
+                     std::optional<std::size_t> output_size,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr)
+{
+  // Only inner joins are compiled; the other join kinds need the null-output
+  // bookkeeping of the generic kernels.
+  if (join_type != join_kind::INNER_JOIN) { return std::nullopt; }
+  // The generated predicate reads column data directly and does not evaluate
+  // validity, so any nulls must take the interpreted path.
+  if (cudf::has_nulls(left) or cudf::has_nulls(right)) { return std::nullopt; }
+
+  auto const predicate = codegen_expression(binary_predicate, left, right, stream);
+  if (not predicate) { return std::nullopt; }
+
+  std::string const cuda_source =
+    "__device__ inline bool conditional_join_predicate(void const* const* left_columns,\n"
+    "                                                  void const* const* right_columns,\n"
+    "                                                  cudf::size_type left_row,\n"
+    "                                                  cudf::size_type right_row)\n"
+    "{\n"
+    "  return static_cast<bool>(" +
+    *predicate +
+    ");\n"
+    "}\n";
+
+  auto const left_num_rows  = left.num_rows();
+  auto const right_num_rows = right.num_rows();
+  auto const d_left_columns  = column_pointers(left, stream);
+  auto const d_right_columns = column_pointers(right, stream);
+
+  // Launch one thread per row of the larger table, as the generic path does.
+  bool const swap_tables = right_num_rows > left_num_rows;
+
+  std::size_t join_size;
+  if (output_size.has_value()) {
+    join_size = *output_size;
+  } else {
+    rmm::device_scalar<std::size_t> size(0, stream);
+    cudf::jit::get_program_cache(*join_jit_kernel_cu_jit)
+      .get_kernel("cudf::join::jit::compute_conditional_join_output_size",
+                  {},
+                  {{"join/jit/operation-udf.hpp", cuda_source}},
+                  {"-arch=sm_."})
+      ->configure_1d_max_occupancy(0, 0, 0, stream.value())
+      ->launch(d_left_columns.data(),
+               d_right_columns.data(),
+               left_num_rows,
+               right_num_rows,
+               swap_tables,
+               size.data());
+    join_size = size.value(stream);
+  }
+
+  if (join_size == 0) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  rmm::device_scalar<size_type> write_index(0, stream);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+
+  cudf::jit::get_program_cache(*join_jit_kernel_cu_jit)
+    .get_kernel("cudf::join::jit::conditional_join",
+                {},
+                {{"join/jit/operation-udf.hpp", cuda_source}},
+                {"-arch=sm_."})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())
+    ->launch(d_left_columns.data(),
+             d_right_columns.data(),
+             left_num_rows,
+             right_num_rows,
+             swap_tables,
+             left_indices->data(),
+             right_indices->data(),
+             write_index.data(),
+             join_size);
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/bloom_filter.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/structs/utilities.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace detail {
+
+std::unique_ptr<cudf::table> filter_by_bloom(
+  cudf::table_view const& input,
+  cudf::table_view const& keys,
+  std::vector<cudf::size_type> const& input_on,
+  std::vector<cudf::size_type> const& keys_on,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(input_on.size() == keys_on.size(),
+               "Mismatch in number of columns to be filtered on");
+
+  // With no key columns there is nothing to filter on
+  if (input_on.empty() || input.num_rows() == 0) {
+    return std::make_unique<table>(input, stream, mr);
+  }
+  if (keys.num_rows() == 0) { return empty_like(input); }
+
+  // Make sure any dictionary columns have matched key sets so that equal rows
+  // hash equally across the two tables.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {input.select(input_on), keys.select(keys_on)},
+    stream,
+    rmm::mr::get_current_device_resource());  // temporary objects returned
+
+  auto const input_selected = matched.second.front();
+  auto const keys_selected  = matched.second.back();
+
+  auto keys_flattened = structs::detail::flatten_nested_columns(
+    keys_selected, {}, {}, structs::detail::column_nullability::FORCE);
+  auto input_flattened = structs::detail::flatten_nested_columns(
+    input_selected, {}, {}, structs::detail::column_nullability::FORCE);
+
+  auto keys_rows_d  = table_device_view::create(keys_flattened.flattened_columns(), stream);
+  auto input_rows_d = table_device_view::create(input_flattened.flattened_columns(), stream);
+  row_hash hash_keys{*keys_rows_d};
+  row_hash hash_input{*input_rows_d};
+
+  auto bloom            = bloom_filter{keys.num_rows(), stream};
+  auto const bloom_view = bloom.view();
+
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     keys.num_rows(),
+                     [bloom_view, hash_keys] __device__(size_type idx) mutable {
+                       bloom_view.insert(hash_keys(idx));
+                     });
+
+  rmm::device_uvector<size_type> gather_vector(input.num_rows(), stream);
+  auto gather_map_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.num_rows()),
+                    gather_vector.begin(),
+                    [bloom_view, hash_input] __device__(size_type idx) {
+                      return bloom_view.contains(hash_input(idx));
+                    });
+
+  // wrapping the device vector with a column view allows calling the
+  // non-iterator version of detail::gather, just as the semi join does
+  auto gather_map =
+    column_view(data_type{type_id::INT32},
+                static_cast<size_type>(thrust::distance(gather_vector.begin(), gather_map_end)),
+                gather_vector.data(),
+                nullptr,
+                0);
+
+  auto const input_updated = scatter_columns(input_selected, input_on, input);
+  return cudf::detail::gather(input_updated,
+                              gather_map,
+                              out_of_bounds_policy::DONT_CHECK,
+                              negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::table> filter_by_bloom(cudf::table_view const& input,
+                                             cudf::table_view const& keys,
+                                             std::vector<cudf::size_type> const& input_on,
+                                             std::vector<cudf::size_type> const& keys_on,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter_by_bloom(input, keys, input_on, keys_on, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -28,6 +28,7 @@
 #include <rmm/exec_policy.hpp>
 
 #include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <numeric>
 
@@ -310,6 +311,61 @@ hash_join::hash_join_impl::hash_join_impl(cudf::table_view const& build,
   build_join_hash_table(_build, _hash_table, compare_nulls, stream);
 }
 
+hash_join::hash_join_impl::hash_join_impl(cudf::table_view const& build,
+                                          std::size_t capacity,
+                                          host_span<std::uint8_t const> slot_bytes,
+                                          rmm::cuda_stream_view stream)
+  : _is_empty{build.num_rows() == 0},
+    _hash_table{capacity,
+                std::numeric_limits<hash_value_type>::max(),
+                cudf::detail::JoinNoneValue,
+                stream.value()}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != build.num_columns(), "Hash join build table is empty");
+  CUDF_EXPECTS(slot_bytes.size() == _hash_table.get_capacity() * sizeof(cudf::detail::pair_type),
+               "Serialized hash join slot storage size mismatch");
+
+  // need to store off the owning structures for some of the views in _build
+  _flattened_build_table = structs::detail::flatten_nested_columns(
+    build, {}, {}, structs::detail::column_nullability::FORCE);
+  _build = _flattened_build_table;
+
+  CUDA_TRY(cudaMemcpyAsync(_hash_table.get_device_mutable_view().get_slots(),
+                           slot_bytes.data(),
+                           slot_bytes.size(),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  // The source is pageable host memory owned by the caller; wait for the copy
+  stream.synchronize();
+}
+
+std::vector<std::uint8_t> hash_join::hash_join_impl::serialize(rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto const slot_bytes =
+    _hash_table.get_capacity() * sizeof(cudf::detail::pair_type);
+
+  cudf::detail::serialized_hash_join_header const header{
+    cudf::detail::hash_join_blob_magic,
+    cudf::detail::hash_join_blob_version,
+    _build.num_rows(),
+    static_cast<std::uint64_t>(_hash_table.get_capacity()),
+    _hash_table.get_empty_key_sentinel(),
+    _hash_table.get_empty_value_sentinel()};
+
+  std::vector<std::uint8_t> blob(sizeof(header) + slot_bytes);
+  std::memcpy(blob.data(), &header, sizeof(header));
+  CUDA_TRY(cudaMemcpyAsync(blob.data() + sizeof(header),
+                           _hash_table.get_device_view().get_slots(),
+                           slot_bytes,
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  // The destination is pageable host memory; wait for the copy before returning it
+  stream.synchronize();
+  return blob;
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::inner_join(cudf::table_view const& probe,
@@ -26,6 +26,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -34,7 +35,9 @@
 #include <thrust/sequence.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -135,6 +138,26 @@ std::size_t compute_join_output_size(table_device_view build_table,
   return size;
 }
 
+/**
+ * @brief Header preceding the raw hash table slots in a serialized hash join blob.
+ *
+ * The slot payload is a byte-for-byte snapshot of the multimap's slot storage, so a blob
+ * is only valid with the libcudf version, hash function and sentinel values it was
+ * produced with; `magic` and `version` guard the format and the sentinels are stored to
+ * reject blobs from incompatible configurations.
+ */
+struct serialized_hash_join_header {
+  std::uint32_t magic;
+  std::uint32_t version;
+  size_type num_build_rows;
+  std::uint64_t capacity;
+  hash_value_type empty_key_sentinel;
+  size_type empty_value_sentinel;
+};
+
+constexpr std::uint32_t hash_join_blob_magic{0x42544a48};  // "HJTB" as little-endian bytes
+constexpr std::uint32_t hash_join_blob_version{1};
+
 std::pair<std::unique_ptr<table>, std::unique_ptr<table>> get_empty_joined_table(
   table_view const& probe, table_view const& build);
 
@@ -174,6 +197,27 @@ struct hash_join::hash_join_impl {
                  null_equality compare_nulls,
                  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+  /**
+   * @brief Constructor that restores the hash table from serialized slot storage instead
+   * of building it from the `build` table.
+   *
+   * @param build The build table the serialized hash table was built from.
+   * @param capacity The slot capacity recorded in the serialized header.
+   * @param slot_bytes The raw slot storage from the serialized blob.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  hash_join_impl(cudf::table_view const& build,
+                 std::size_t capacity,
+                 host_span<std::uint8_t const> slot_bytes,
+                 rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Copies the hash table into a host blob that the matching constructor accepts.
+   *
+   * @param stream CUDA stream used for device memory operations.
+   */
+  std::vector<std::uint8_t> serialize(rmm::cuda_stream_view stream) const;
+
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   inner_join(cudf::table_view const& probe,
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <utility>
+
+namespace cudf {
+namespace {
+
+using index_vector_pair = std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                                    std::unique_ptr<rmm::device_uvector<size_type>>>;
+
+/**
+ * @brief Counts the intervals containing each point, or on the second pass
+ * writes the matching (point, interval) index pairs.
+ *
+ * Candidates for a point `x` are the sorted intervals with `left edge <= x`,
+ * walked right to left from the upper bound of `x`. The running maximum of the
+ * right edges bounds the walk: once every interval at or left of a position
+ * ends at or before `x`, no further candidate can contain it. For disjoint
+ * intervals this visits a single candidate per point.
+ */
+template <typename T>
+struct containment_fn {
+  T const* points;
+  T const* lo;          ///< interval left edges, ascending
+  T const* hi;          ///< right edges, in the same sorted order
+  T const* max_hi;      ///< running inclusive maximum of `hi`
+  size_type const* perm;  ///< sorted position -> original interval index
+  size_type num_intervals;
+  size_type const* offsets{nullptr};  ///< null during the count pass
+  size_type* out_points{nullptr};
+  size_type* out_intervals{nullptr};
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const x = points[i];
+    auto p       = static_cast<size_type>(
+                     thrust::upper_bound(thrust::seq, lo, lo + num_intervals, x) - lo) -
+                   1;
+    size_type count = 0;
+    while (p >= 0 and max_hi[p] > x) {
+      if (hi[p] > x) {
+        if (offsets != nullptr) {
+          out_points[offsets[i] + count]    = i;
+          out_intervals[offsets[i] + count] = perm[p];
+        }
+        ++count;
+      }
+      --p;
+    }
+    return count;
+  }
+};
+
+struct interval_join_dispatcher {
+  template <typename T,
+            std::enable_if_t<not std::is_arithmetic<T>::value and not cudf::is_chrono<T>()>* =
+              nullptr>
+  index_vector_pair operator()(column_view const&,
+                               column_view const&,
+                               column_view const&,
+                               rmm::cuda_stream_view,
+                               rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("interval_join requires numeric or chrono typed columns");
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_arithmetic<T>::value or cudf::is_chrono<T>()>* = nullptr>
+  index_vector_pair operator()(column_view const& points,
+                               column_view const& left_edges,
+                               column_view const& right_edges,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  {
+    auto const num_points    = points.size();
+    auto const num_intervals = left_edges.size();
+
+    // sort the intervals by left edge, carrying the original indices
+    rmm::device_uvector<T> lo(num_intervals, stream);
+    rmm::device_uvector<size_type> perm(num_intervals, stream);
+    thrust::copy(
+      rmm::exec_policy(stream), left_edges.begin<T>(), left_edges.end<T>(), lo.begin());
+    thrust::sequence(rmm::exec_policy(stream), perm.begin(), perm.end());
+    thrust::sort_by_key(rmm::exec_policy(stream), lo.begin(), lo.end(), perm.begin());
+
+    rmm::device_uvector<T> hi(num_intervals, stream);
+    thrust::gather(
+      rmm::exec_policy(stream), perm.begin(), perm.end(), right_edges.begin<T>(), hi.begin());
+
+    // running maximum of the right edges bounds each point's candidate walk
+    rmm::device_uvector<T> max_hi(num_intervals, stream);
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), hi.begin(), hi.end(), max_hi.begin(), thrust::maximum<T>{});
+
+    auto fn = containment_fn<T>{points.begin<T>(),
+                                lo.data(),
+                                hi.data(),
+                                max_hi.data(),
+                                perm.data(),
+                                num_intervals};
+
+    // count matches per point, then scan into output offsets
+    rmm::device_uvector<size_type> offsets(num_points + 1, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_points),
+                      offsets.begin(),
+                      fn);
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream), offsets.begin(), offsets.end(), offsets.begin());
+    auto const num_matches = offsets.back_element(stream);
+
+    auto point_indices = std::make_unique<rmm::device_uvector<size_type>>(num_matches, stream, mr);
+    auto interval_indices =
+      std::make_unique<rmm::device_uvector<size_type>>(num_matches, stream, mr);
+
+    fn.offsets       = offsets.data();
+    fn.out_points    = point_indices->data();
+    fn.out_intervals = interval_indices->data();
+    thrust::for_each(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(num_points),
+                     [fn] __device__(size_type i) { fn(i); });
+
+    return {std::move(point_indices), std::move(interval_indices)};
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+index_vector_pair interval_join(column_view const& points,
+                                column_view const& left_edges,
+                                column_view const& right_edges,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(points.type() == left_edges.type() and points.type() == right_edges.type(),
+               "Mismatch in types of points and interval edge columns");
+  CUDF_EXPECTS(left_edges.size() == right_edges.size(),
+               "Mismatch in sizes of interval edge columns");
+  CUDF_EXPECTS(
+    not points.has_nulls() and not left_edges.has_nulls() and not right_edges.has_nulls(),
+    "Inputs of an interval join must not contain nulls");
+
+  if (points.is_empty() or left_edges.is_empty()) {
+    return {std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+            std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr)};
+  }
+
+  return type_dispatcher(
+    points.type(), interval_join_dispatcher{}, points, left_edges, right_edges, stream, mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+interval_join(column_view const& points,
+              column_view const& left_edges,
+              column_view const& right_edges,
+              rmm::cuda_stream_view stream,
+              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(points.size());
+  return detail::interval_join(points, left_edges, right_edges, stream, mr);
+}
+
+}  // namespace cudf
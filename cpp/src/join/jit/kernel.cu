@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <cudf/types.hpp>
+
+#include <join/jit/operation-udf.hpp>
+
+namespace cudf {
+namespace join {
+namespace jit {
+
+// The generated predicate provided via operation-udf.hpp has the signature
+//   __device__ bool conditional_join_predicate(void const* const* left_columns,
+//                                              void const* const* right_columns,
+//                                              cudf::size_type left_row,
+//                                              cudf::size_type right_row);
+
+__global__ void compute_conditional_join_output_size(void const* const* left_columns,
+                                                     void const* const* right_columns,
+                                                     cudf::size_type left_num_rows,
+                                                     cudf::size_type right_num_rows,
+                                                     bool swap_tables,
+                                                     std::size_t* output_size)
+{
+  std::size_t thread_counter{0};
+  auto const start  = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const stride = blockDim.x * gridDim.x;
+
+  auto const outer_num_rows = swap_tables ? right_num_rows : left_num_rows;
+  auto const inner_num_rows = swap_tables ? left_num_rows : right_num_rows;
+
+  for (cudf::size_type outer = start; outer < outer_num_rows; outer += stride) {
+    for (cudf::size_type inner = 0; inner < inner_num_rows; ++inner) {
+      auto const left_row  = swap_tables ? inner : outer;
+      auto const right_row = swap_tables ? outer : inner;
+      if (conditional_join_predicate(left_columns, right_columns, left_row, right_row)) {
+        ++thread_counter;
+      }
+    }
+  }
+
+  atomicAdd(reinterpret_cast<unsigned long long*>(output_size),
+            static_cast<unsigned long long>(thread_counter));
+}
+
+__global__ void conditional_join(void const* const* left_columns,
+                                 void const* const* right_columns,
+                                 cudf::size_type left_num_rows,
+                                 cudf::size_type right_num_rows,
+                                 bool swap_tables,
+                                 cudf::size_type* join_output_l,
+                                 cudf::size_type* join_output_r,
+                                 cudf::size_type* write_index,
+                                 std::size_t max_size)
+{
+  auto const start  = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const stride = blockDim.x * gridDim.x;
+
+  auto const outer_num_rows = swap_tables ? right_num_rows : left_num_rows;
+  auto const inner_num_rows = swap_tables ? left_num_rows : right_num_rows;
+
+  for (cudf::size_type outer = start; outer < outer_num_rows; outer += stride) {
+    for (cudf::size_type inner = 0; inner < inner_num_rows; ++inner) {
+      auto const left_row  = swap_tables ? inner : outer;
+      auto const right_row = swap_tables ? outer : inner;
+      if (conditional_join_predicate(left_columns, right_columns, left_row, right_row)) {
+        auto const output_index = atomicAdd(write_index, cudf::size_type{1});
+        if (static_cast<std::size_t>(output_index) < max_size) {
+          join_output_l[output_index] = left_row;
+          join_output_r[output_index] = right_row;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace jit
+}  // namespace join
+}  // namespace cudf
@@ -16,15 +16,53 @@
 #include <join/hash_join.cuh>
 #include <join/join_common_utils.hpp>
 
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/partitioning.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <cstring>
+#include <limits>
+#include <numeric>
+
 namespace cudf {
+namespace {
+
+/**
+ * @brief Approximates the device memory footprint of a column, including its children.
+ */
+std::size_t estimate_column_size(column_view const& col)
+{
+  std::size_t size = is_fixed_width(col.type()) ? size_of(col.type()) * col.size() : 0;
+  if (col.nullable()) { size += bitmask_allocation_size_bytes(col.size()); }
+  for (auto child = col.child_begin(); child != col.child_end(); ++child) {
+    size += estimate_column_size(*child);
+  }
+  return size;
+}
+
+/**
+ * @brief Approximates the device memory footprint of a table.
+ */
+std::size_t estimate_table_size(table_view const& input)
+{
+  return std::accumulate(
+    input.begin(), input.end(), std::size_t{0}, [](std::size_t size, column_view const& col) {
+      return size + estimate_column_size(col);
+    });
+}
+
+}  // namespace
+
 namespace detail {
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -94,6 +132,72 @@ std::unique_ptr<table> inner_join(table_view const& left_input,
   return combine_table_pair(std::move(left_result), std::move(right_result));
 }
 
+std::unique_ptr<table> partitioned_inner_join(table_view const& left,
+                                              table_view const& right,
+                                              std::vector<size_type> const& left_on,
+                                              std::vector<size_type> const& right_on,
+                                              std::size_t device_memory_budget,
+                                              null_equality compare_nulls,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  // The hash map is built at 50% occupancy, so a join pass costs roughly the build table
+  // plus twice its footprint for the map
+  auto const build_cost = 3 * estimate_table_size(right.select(right_on));
+  auto const num_partitions =
+    (device_memory_budget == 0)
+      ? 1
+      : static_cast<int>(util::div_rounding_up_safe(build_cost, device_memory_budget));
+
+  if (num_partitions <= 1 or left.num_rows() == 0 or right.num_rows() == 0) {
+    return inner_join(left, right, left_on, right_on, compare_nulls, stream, mr);
+  }
+
+  // Both sides use the same hash function and partition count, so matching keys always land
+  // in the same partition pair
+  auto left_parts  = cudf::hash_partition(left,
+                                         left_on,
+                                         num_partitions,
+                                         hash_id::HASH_MURMUR3,
+                                         cudf::DEFAULT_HASH_SEED,
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+  auto right_parts = cudf::hash_partition(right,
+                                          right_on,
+                                          num_partitions,
+                                          hash_id::HASH_MURMUR3,
+                                          cudf::DEFAULT_HASH_SEED,
+                                          stream,
+                                          rmm::mr::get_current_device_resource());
+
+  auto const left_view  = left_parts.first->view();
+  auto const right_view = right_parts.first->view();
+
+  std::vector<std::unique_ptr<table>> joined;
+  std::vector<table_view> joined_views;
+  joined.reserve(num_partitions);
+  joined_views.reserve(num_partitions);
+  for (int i = 0; i < num_partitions; ++i) {
+    auto const left_begin  = left_parts.second[i];
+    auto const left_end    = (i + 1 < num_partitions) ? left_parts.second[i + 1] : left.num_rows();
+    auto const right_begin = right_parts.second[i];
+    auto const right_end = (i + 1 < num_partitions) ? right_parts.second[i + 1] : right.num_rows();
+
+    auto const left_part  = cudf::slice(left_view, {left_begin, left_end}).front();
+    auto const right_part = cudf::slice(right_view, {right_begin, right_end}).front();
+
+    joined.push_back(inner_join(left_part,
+                                right_part,
+                                left_on,
+                                right_on,
+                                compare_nulls,
+                                stream,
+                                rmm::mr::get_current_device_resource()));
+    joined_views.push_back(joined.back()->view());
+  }
+  return detail::concatenate(joined_views, stream, mr);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 left_join(table_view const& left_input,
@@ -231,6 +335,38 @@ hash_join::hash_join(cudf::table_view const& build,
 {
 }
 
+hash_join::hash_join(std::unique_ptr<const hash_join_impl> impl) : impl{std::move(impl)} {}
+
+std::vector<std::uint8_t> hash_join::serialize(rmm::cuda_stream_view stream) const
+{
+  return impl->serialize(stream);
+}
+
+std::unique_ptr<hash_join> hash_join::deserialize(host_span<std::uint8_t const> blob,
+                                                  cudf::table_view const& build,
+                                                  rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(blob.size() >= sizeof(detail::serialized_hash_join_header),
+               "Serialized hash join blob is truncated");
+  detail::serialized_hash_join_header header;
+  std::memcpy(&header, blob.data(), sizeof(header));
+
+  CUDF_EXPECTS(header.magic == detail::hash_join_blob_magic,
+               "Buffer does not hold a serialized hash join");
+  CUDF_EXPECTS(header.version == detail::hash_join_blob_version,
+               "Serialized hash join version mismatch");
+  CUDF_EXPECTS(header.empty_key_sentinel == std::numeric_limits<hash_value_type>::max() and
+                 header.empty_value_sentinel == detail::JoinNoneValue,
+               "Serialized hash join sentinel values mismatch");
+  CUDF_EXPECTS(header.num_build_rows == build.num_rows(),
+               "Build table row count does not match the serialized hash join");
+
+  auto const slot_bytes = blob.subspan(sizeof(header), blob.size() - sizeof(header));
+  auto impl             = std::make_unique<const hash_join::hash_join_impl>(
+    build, static_cast<std::size_t>(header.capacity), slot_bytes, stream);
+  return std::unique_ptr<hash_join>(new hash_join(std::move(impl)));
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::inner_join(cudf::table_view const& probe,
@@ -293,10 +429,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 inner_join(table_view const& left,
            table_view const& right,
            null_equality compare_nulls,
+           rmm::cuda_stream_view stream,
            rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::inner_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left.num_rows() + right.num_rows());
+  return detail::inner_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> inner_join(table_view const& left,
@@ -304,11 +441,25 @@ std::unique_ptr<table> inner_join(table_view const& left,
                                   std::vector<size_type> const& left_on,
                                   std::vector<size_type> const& right_on,
                                   null_equality compare_nulls,
+                                  rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::inner_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left.num_rows() + right.num_rows());
+  return detail::inner_join(left, right, left_on, right_on, compare_nulls, stream, mr);
+}
+
+std::unique_ptr<table> partitioned_inner_join(table_view const& left,
+                                              table_view const& right,
+                                              std::vector<size_type> const& left_on,
+                                              std::vector<size_type> const& right_on,
+                                              std::size_t device_memory_budget,
+                                              null_equality compare_nulls,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left.num_rows() + right.num_rows());
+  return detail::partitioned_inner_join(
+    left, right, left_on, right_on, device_memory_budget, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -316,10 +467,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 left_join(table_view const& left,
           table_view const& right,
           null_equality compare_nulls,
+          rmm::cuda_stream_view stream,
           rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::left_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left.num_rows() + right.num_rows());
+  return detail::left_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> left_join(table_view const& left,
@@ -327,11 +479,11 @@ std::unique_ptr<table> left_join(table_view const& left,
                                  std::vector<size_type> const& left_on,
                                  std::vector<size_type> const& right_on,
                                  null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::left_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left.num_rows() + right.num_rows());
+  return detail::left_join(left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -339,10 +491,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 full_join(table_view const& left,
           table_view const& right,
           null_equality compare_nulls,
+          rmm::cuda_stream_view stream,
           rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::full_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left.num_rows() + right.num_rows());
+  return detail::full_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> full_join(table_view const& left,
@@ -350,11 +503,11 @@ std::unique_ptr<table> full_join(table_view const& left,
                                  std::vector<size_type> const& left_on,
                                  std::vector<size_type> const& right_on,
                                  null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::full_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(left.num_rows() + right.num_rows());
+  return detail::full_join(left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 }  // namespace cudf
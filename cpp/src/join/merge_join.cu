@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+merge_inner_join(table_view const& left_keys,
+                 table_view const& right_keys,
+                 rmm::cuda_stream_view stream,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  auto const left_num_rows = left_keys.num_rows();
+  if (left_num_rows == 0 or right_keys.num_rows() == 0) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  std::vector<order> const column_order(left_keys.num_columns(), order::ASCENDING);
+  std::vector<null_order> const null_precedence(left_keys.num_columns(), null_order::BEFORE);
+
+  // Each left row's matches form a contiguous run [lower, upper) in the sorted right table
+  auto const lower = lower_bound(right_keys,
+                                 left_keys,
+                                 column_order,
+                                 null_precedence,
+                                 stream,
+                                 rmm::mr::get_current_device_resource());
+  auto const upper = upper_bound(right_keys,
+                                 left_keys,
+                                 column_order,
+                                 null_precedence,
+                                 stream,
+                                 rmm::mr::get_current_device_resource());
+  auto const d_lower = lower->view().data<size_type>();
+  auto const d_upper = upper->view().data<size_type>();
+
+  // Exclusive scan of the per-row match counts yields each row's output offset
+  rmm::device_uvector<size_type> offsets(left_num_rows + 1, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left_num_rows),
+                    offsets.begin(),
+                    [d_lower, d_upper] __device__(size_type i) { return d_upper[i] - d_lower[i]; });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), offsets.begin(), offsets.end(), offsets.begin());
+  auto const join_size = offsets.back_element(stream);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+
+  auto output_it =
+    thrust::make_zip_iterator(left_indices->begin(), right_indices->begin());
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(join_size),
+                    output_it,
+                    [d_lower, d_offsets = offsets.data(), left_num_rows] __device__(size_type pos) {
+                      // Find the left row that owns this output position
+                      auto const row = static_cast<size_type>(
+                        thrust::upper_bound(
+                          thrust::seq, d_offsets, d_offsets + left_num_rows + 1, pos) -
+                        d_offsets - 1);
+                      return thrust::make_tuple(row, d_lower[row] + pos - d_offsets[row]);
+                    });
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+merge_inner_join(table_view const& left_keys,
+                 table_view const& right_keys,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_inner_join(left_keys, right_keys, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+namespace prepared_joins {
+
+namespace {
+
+/**
+ * @brief Approximates the device bytes a column occupies, recursing into children.
+ */
+std::size_t column_device_size(column_view const& col)
+{
+  std::size_t bytes = 0;
+  if (col.nullable()) { bytes += bitmask_allocation_size_bytes(col.size()); }
+  if (is_fixed_width(col.type())) {
+    bytes += static_cast<std::size_t>(size_of(col.type())) * col.size();
+  } else if (col.type().id() == type_id::STRING) {
+    auto const scv = strings_column_view(col);
+    bytes += static_cast<std::size_t>(scv.chars_size()) + sizeof(size_type) * (col.size() + 1);
+    return bytes;  // children accounted for above
+  }
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    bytes += column_device_size(col.child(i));
+  }
+  return bytes;
+}
+
+/**
+ * @brief Estimates the device bytes of a registered entry: the owned build-table
+ * copy plus the hash table, which allocates roughly two 8-byte pairs per row
+ * at its 50% target occupancy.
+ */
+std::size_t entry_device_size(table_view const& build)
+{
+  std::size_t bytes = 0;
+  for (auto const& col : build) {
+    bytes += column_device_size(col);
+  }
+  return bytes + std::size_t{16} * build.num_rows();
+}
+
+struct registry_entry {
+  std::unique_ptr<cudf::table> build;  ///< owned device copy; the hash join views it
+  std::unique_ptr<hash_join> join;
+  std::size_t bytes;
+  std::uint64_t last_use;
+};
+
+struct registry_state {
+  std::mutex lock;
+  std::map<std::string, std::shared_ptr<registry_entry>> entries;
+  std::size_t memory_budget = 0;  // 0 means unlimited
+  std::size_t memory_used   = 0;
+  std::uint64_t use_tick    = 0;
+};
+
+registry_state& state()
+{
+  static registry_state s;
+  return s;
+}
+
+/**
+ * @brief Hands out the entry's hash join with the entry (and thus its build
+ * table) pinned for the reference's lifetime.
+ */
+std::shared_ptr<hash_join const> join_of(std::shared_ptr<registry_entry> const& entry)
+{
+  return {entry, entry->join.get()};
+}
+
+/**
+ * @brief Evicts least-recently-used entries until the budget fits, never
+ * evicting `keep`. Requires `state().lock` to be held.
+ */
+void evict_to_budget(registry_state& s, std::string const& keep)
+{
+  if (s.memory_budget == 0) { return; }
+  while (s.memory_used > s.memory_budget and not s.entries.empty()) {
+    auto victim = s.entries.end();
+    for (auto it = s.entries.begin(); it != s.entries.end(); ++it) {
+      if (it->first == keep) { continue; }
+      if (victim == s.entries.end() or it->second->last_use < victim->second->last_use) {
+        victim = it;
+      }
+    }
+    if (victim == s.entries.end()) { return; }
+    s.memory_used -= victim->second->bytes;
+    s.entries.erase(victim);
+  }
+}
+
+}  // namespace
+
+std::shared_ptr<hash_join const> insert(std::string const& name,
+                                        table_view const& build,
+                                        null_equality compare_nulls,
+                                        rmm::cuda_stream_view stream)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+
+  if (auto const it = s.entries.find(name); it != s.entries.end()) {
+    it->second->last_use = ++s.use_tick;
+    return join_of(it->second);
+  }
+
+  // The build runs under the lock so concurrent registrations of the same name
+  // build exactly once; dimension-table builds are small by assumption.
+  auto entry   = std::make_shared<registry_entry>();
+  entry->build = std::make_unique<cudf::table>(
+    build, stream, rmm::mr::get_current_device_resource());
+  entry->join =
+    std::make_unique<hash_join>(entry->build->view(), compare_nulls, stream);
+  entry->bytes    = entry_device_size(entry->build->view());
+  entry->last_use = ++s.use_tick;
+
+  s.memory_used += entry->bytes;
+  s.entries.emplace(name, entry);
+  evict_to_budget(s, name);
+
+  return join_of(entry);
+}
+
+std::shared_ptr<hash_join const> find(std::string const& name)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+
+  auto const it = s.entries.find(name);
+  if (it == s.entries.end()) { return nullptr; }
+  it->second->last_use = ++s.use_tick;
+  return join_of(it->second);
+}
+
+bool erase(std::string const& name)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+
+  auto const it = s.entries.find(name);
+  if (it == s.entries.end()) { return false; }
+  s.memory_used -= it->second->bytes;
+  s.entries.erase(it);
+  return true;
+}
+
+void clear()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  s.entries.clear();
+  s.memory_used = 0;
+}
+
+void set_memory_budget(std::size_t bytes)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  s.memory_budget = bytes;
+  evict_to_budget(s, {});
+}
+
+std::size_t memory_used()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  return s.memory_used;
+}
+
+}  // namespace prepared_joins
+}  // namespace cudf
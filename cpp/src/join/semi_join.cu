@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <hash/bloom_filter.cuh>
 #include <hash/concurrent_unordered_map.cuh>
 #include <join/join_common_utils.hpp>
 
@@ -93,6 +94,12 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
                                                 equality_build);
   auto hash_table     = *hash_table_ptr;
 
+  // A Bloom filter over the right table's row hashes lets the probe below skip
+  // the hash table lookup for left rows that cannot possibly match. This pays
+  // off when the left table is large and few of its rows find a match.
+  auto bloom            = bloom_filter{right_num_rows, stream};
+  auto const bloom_view = bloom.view();
+
   // if compare_nulls == UNEQUAL, we can simply ignore any rows that
   // contain a NULL in any column as they will never compare to equal.
   auto const row_bitmask = (compare_nulls == null_equality::EQUAL)
@@ -103,10 +110,14 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
     rmm::exec_policy(stream),
     thrust::make_counting_iterator<size_type>(0),
     right_num_rows,
-    [hash_table, row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(
+    [hash_table,
+     hash_build,
+     bloom_view,
+     row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(
       size_type idx) mutable {
       if (!row_bitmask || cudf::bit_is_set(row_bitmask, idx)) {
         hash_table.insert(thrust::make_pair(idx, true));
+        bloom_view.insert(hash_build(idx));
       }
     });
 
@@ -127,7 +138,11 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
     thrust::make_counting_iterator<size_type>(0),
     thrust::make_counting_iterator<size_type>(left_num_rows),
     gather_map->begin(),
-    [hash_table, join_type_boolean, hash_probe, equality_probe] __device__(size_type idx) {
+    [hash_table, join_type_boolean, hash_probe, equality_probe, bloom_view] __device__(
+      size_type idx) {
+      // A Bloom miss proves the row has no match; only possible matches pay
+      // for the exact hash table probe.
+      if (not bloom_view.contains(hash_probe(idx))) { return not join_type_boolean; }
       auto pos = hash_table.find(idx, hash_probe, equality_probe);
       return (pos != hash_table.end()) == join_type_boolean;
     });
@@ -230,6 +245,7 @@ std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& left_on,
                                             std::vector<cudf::size_type> const& right_on,
                                             null_equality compare_nulls,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -239,7 +255,7 @@ std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& left,
                                      left_on,
                                      right_on,
                                      compare_nulls,
-                                     rmm::cuda_stream_default,
+                                     stream,
                                      mr);
 }
 
@@ -247,11 +263,12 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
   null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join(
-    detail::join_kind::LEFT_SEMI_JOIN, left, right, compare_nulls, rmm::cuda_stream_default, mr);
+    detail::join_kind::LEFT_SEMI_JOIN, left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
@@ -259,6 +276,7 @@ std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& left_on,
                                             std::vector<cudf::size_type> const& right_on,
                                             null_equality compare_nulls,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -268,7 +286,7 @@ std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
                                      left_on,
                                      right_on,
                                      compare_nulls,
-                                     rmm::cuda_stream_default,
+                                     stream,
                                      mr);
 }
 
@@ -276,11 +294,12 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_anti_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
   null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join(
-    detail::join_kind::LEFT_ANTI_JOIN, left, right, compare_nulls, rmm::cuda_stream_default, mr);
+    detail::join_kind::LEFT_ANTI_JOIN, left, right, compare_nulls, stream, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/labeling/label_sessions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_scan.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Writes the session labels as the running sum of new-session flags.
+ *
+ * A row opens a new session when its keys differ from the previous row's or
+ * the timestamp gap exceeds the threshold. The first row contributes 0 so
+ * labels start at 0. nvcc does not allow extended device lambdas inside
+ * generic lambdas, hence the named function template.
+ */
+template <typename Comparator, typename TimestampIterator, typename Duration>
+void compute_session_labels(Comparator comp,
+                            TimestampIterator d_timestamps,
+                            Duration gap_value,
+                            size_type num_rows,
+                            size_type* d_labels,
+                            rmm::cuda_stream_view stream)
+{
+  auto new_session_flag = [comp, d_timestamps, gap_value] __device__(size_type i) {
+    if (i == 0) { return size_type{0}; }
+    return (not comp(i, i - 1) or (d_timestamps[i] - d_timestamps[i - 1] > gap_value))
+             ? size_type{1}
+             : size_type{0};
+  };
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(num_rows),
+                                   d_labels,
+                                   new_session_flag,
+                                   thrust::plus<size_type>{});
+}
+
+/**
+ * @brief Computes session labels for one timestamp type via a fused
+ * transform + inclusive scan over the new-session flags.
+ */
+struct label_sessions_dispatcher {
+  template <typename T, std::enable_if_t<not is_timestamp<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(table_view const&,
+                                     column_view const&,
+                                     scalar const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("label_sessions requires a timestamp column.");
+  }
+
+  template <typename T, std::enable_if_t<is_timestamp<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(table_view const& keys,
+                                     column_view const& timestamps,
+                                     scalar const& gap,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    using Duration = typename T::duration;
+
+    CUDF_EXPECTS(gap.type() == data_type{type_to_id<Duration>()},
+                 "gap type must match the timestamp resolution.");
+    CUDF_EXPECTS(gap.is_valid(stream), "gap must be a valid scalar.");
+    auto const gap_value =
+      static_cast<duration_scalar<Duration> const&>(gap).value(stream);
+
+    auto labels = make_numeric_column(
+      data_type{type_to_id<size_type>()}, timestamps.size(), mask_state::UNALLOCATED, stream, mr);
+
+    auto const d_keys       = table_device_view::create(keys, stream);
+    auto const d_timestamps = timestamps.begin<T>();
+    auto const d_labels     = labels->mutable_view().begin<size_type>();
+
+    if (has_nulls(keys)) {
+      compute_session_labels(row_equality_comparator<true>(*d_keys, *d_keys, true),
+                             d_timestamps,
+                             gap_value,
+                             timestamps.size(),
+                             d_labels,
+                             stream);
+    } else {
+      compute_session_labels(row_equality_comparator<false>(*d_keys, *d_keys, true),
+                             d_timestamps,
+                             gap_value,
+                             timestamps.size(),
+                             d_labels,
+                             stream);
+    }
+
+    return labels;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> label_sessions(table_view const& keys,
+                                       column_view const& timestamps,
+                                       scalar const& gap,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(keys.num_columns() > 0, "label_sessions requires at least one key column.");
+  CUDF_EXPECTS(keys.num_rows() == timestamps.size(),
+               "keys and timestamps must have the same number of rows.");
+  CUDF_EXPECTS(not timestamps.has_nulls(), "timestamps must not contain nulls.");
+
+  if (timestamps.is_empty()) {
+    return make_numeric_column(
+      data_type{type_to_id<size_type>()}, 0, mask_state::UNALLOCATED, stream, mr);
+  }
+
+  return type_dispatcher(
+    timestamps.type(), label_sessions_dispatcher{}, keys, timestamps, gap, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> label_sessions(table_view const& keys,
+                                       column_view const& timestamps,
+                                       scalar const& gap,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(timestamps.size());
+  return detail::label_sessions(keys, timestamps, gap, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -14,10 +14,13 @@
  * limitations under the License.
  */
 
+#include <thrust/distance.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/transform.h>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/lists/contains.hpp>
 #include <cudf/lists/list_device_view.cuh>
@@ -35,6 +38,11 @@ namespace lists {
 
 namespace {
 
+/**
+ * @brief Sentinel index returned for list rows that do not contain the search key.
+ */
+auto constexpr absent_index = size_type{-1};
+
 auto get_search_keys_device_iterable_view(cudf::column_view const& search_keys,
                                           rmm::cuda_stream_view stream)
 {
@@ -47,7 +55,10 @@ auto get_search_keys_device_iterable_view(cudf::scalar const& search_key, rmm::c
 }
 
 /**
- * @brief Functor to search each list row for the specified search keys.
+ * @brief Functor to search each list row for the first occurrence of the specified search keys.
+ *
+ * Returns a `size_type` column of the index of the first matching element per list row, with
+ * `absent_index` where the key is not found. `contains()` is derived from this result.
  */
 template <bool search_keys_have_nulls>
 struct lookup_functor {
@@ -63,7 +74,7 @@ struct lookup_functor {
     Args&&...) const
   {
     CUDF_FAIL(
-      "lists::contains() is only supported on numeric types, decimals, chrono types, and strings.");
+      "Lists lookup is only supported on numeric types, decimals, chrono types, and strings.");
   }
 
   std::pair<rmm::device_buffer, size_type> construct_null_mask(lists_column_view const& input_lists,
@@ -85,7 +96,7 @@ struct lookup_functor {
   template <typename ElementType, typename SearchKeyPairIter>
   void search_each_list_row(cudf::detail::lists_column_device_view const& d_lists,
                             SearchKeyPairIter search_key_pair_iter,
-                            cudf::mutable_column_device_view mutable_ret_bools,
+                            cudf::mutable_column_device_view mutable_ret_indices,
                             cudf::mutable_column_device_view mutable_ret_validity,
                             rmm::cuda_stream_view stream,
                             rmm::mr::device_memory_resource*)
@@ -96,35 +107,40 @@ struct lookup_functor {
       thrust::make_counting_iterator(d_lists.size()),
       [d_lists,
        search_key_pair_iter,
-       d_bools    = mutable_ret_bools.data<bool>(),
+       d_indices  = mutable_ret_indices.data<size_type>(),
        d_validity = mutable_ret_validity.data<bool>()] __device__(auto row_index) {
         auto search_key_and_validity    = search_key_pair_iter[row_index];
         auto const& search_key_is_valid = search_key_and_validity.second;
 
         if (search_keys_have_nulls && !search_key_is_valid) {
-          d_bools[row_index]    = false;
+          d_indices[row_index]  = absent_index;
           d_validity[row_index] = false;
           return;
         }
 
         auto list = cudf::list_device_view(d_lists, row_index);
         if (list.is_null()) {
-          d_bools[row_index]    = false;
+          d_indices[row_index]  = absent_index;
           d_validity[row_index] = false;
           return;
         }
 
-        auto search_key = search_key_and_validity.first;
-        d_bools[row_index] =
+        auto search_key      = search_key_and_validity.first;
+        auto const found_iter =
           thrust::find_if(thrust::seq,
                           list.pair_rep_begin<ElementType>(),
                           list.pair_rep_end<ElementType>(),
                           [search_key] __device__(auto element_and_validity) {
                             return element_and_validity.second &&
                                    cudf::equality_compare(element_and_validity.first, search_key);
-                          }) != list.pair_rep_end<ElementType>();
+                          });
+        auto const found = found_iter != list.pair_rep_end<ElementType>();
+        d_indices[row_index] =
+          found ? static_cast<size_type>(
+                    thrust::distance(list.pair_rep_begin<ElementType>(), found_iter))
+                : absent_index;
         d_validity[row_index] =
-          d_bools[row_index] ||
+          found ||
           thrust::none_of(thrust::seq,
                           thrust::make_counting_iterator(size_type{0}),
                           thrust::make_counting_iterator(list.size()),
@@ -143,7 +159,7 @@ struct lookup_functor {
     using namespace cudf::detail;
 
     CUDF_EXPECTS(!cudf::is_nested(lists.child().type()),
-                 "Nested types not supported in lists::contains()");
+                 "Nested types not supported in list search operations.");
     CUDF_EXPECTS(lists.child().type() == search_key.type(),
                  "Type/Scale of search key does not match list column element type.");
     CUDF_EXPECTS(search_key.type().id() != type_id::EMPTY, "Type cannot be empty.");
@@ -151,7 +167,7 @@ struct lookup_functor {
     auto constexpr search_key_is_scalar = std::is_same_v<SearchKeyType, cudf::scalar>;
 
     if (search_keys_have_nulls && search_key_is_scalar) {
-      return make_fixed_width_column(data_type(type_id::BOOL8),
+      return make_fixed_width_column(data_type{type_to_id<size_type>()},
                                      lists.size(),
                                      cudf::create_null_mask(lists.size(), mask_state::ALL_NULL, mr),
                                      lists.size(),
@@ -165,34 +181,54 @@ struct lookup_functor {
 
     auto result_validity = make_fixed_width_column(
       data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-    auto result_bools = make_fixed_width_column(
-      data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-    auto mutable_result_bools =
-      mutable_column_device_view::create(result_bools->mutable_view(), stream);
+    auto result_indices = make_fixed_width_column(
+      data_type{type_to_id<size_type>()}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
+    auto mutable_result_indices =
+      mutable_column_device_view::create(result_indices->mutable_view(), stream);
     auto mutable_result_validity =
       mutable_column_device_view::create(result_validity->mutable_view(), stream);
     auto search_key_iter =
       cudf::detail::make_pair_rep_iterator<ElementType, search_keys_have_nulls>(*d_skeys);
 
     search_each_list_row<ElementType>(
-      d_lists, search_key_iter, *mutable_result_bools, *mutable_result_validity, stream, mr);
+      d_lists, search_key_iter, *mutable_result_indices, *mutable_result_validity, stream, mr);
 
     rmm::device_buffer null_mask;
     size_type num_nulls;
 
     std::tie(null_mask, num_nulls) =
       construct_null_mask(lists, result_validity->view(), stream, mr);
-    result_bools->set_null_mask(std::move(null_mask), num_nulls);
+    result_indices->set_null_mask(std::move(null_mask), num_nulls);
 
-    return result_bools;
+    return result_indices;
   }
 };
 
+/**
+ * @brief Converts key-index results into the BOOL8 column returned by `contains()`.
+ */
+std::unique_ptr<column> to_contains(std::unique_ptr<column>&& key_indices,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto result = make_fixed_width_column(
+    data_type{type_id::BOOL8}, key_indices->size(), cudf::mask_state::UNALLOCATED, stream, mr);
+  auto const indices = key_indices->view();
+  thrust::transform(rmm::exec_policy(stream),
+                    indices.begin<size_type>(),
+                    indices.end<size_type>(),
+                    result->mutable_view().begin<bool>(),
+                    [] __device__(auto const index) { return index != absent_index; });
+  auto const null_count = key_indices->null_count();
+  result->set_null_mask(cudf::detail::copy_bitmask(indices, stream, mr), null_count);
+  return result;
+}
+
 }  // namespace
 
 namespace detail {
 
-std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
                                  cudf::scalar const& search_key,
                                  rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
@@ -204,7 +240,7 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                search_key.type(), lookup_functor<true>{}, lists, search_key, stream, mr);
 }
 
-std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
                                  cudf::column_view const& search_keys,
                                  rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
@@ -219,6 +255,22 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                search_keys.type(), lookup_functor<false>{}, lists, search_keys, stream, mr);
 }
 
+std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return to_contains(index_of(lists, search_key, stream, mr), stream, mr);
+}
+
+std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return to_contains(index_of(lists, search_keys, stream, mr), stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
@@ -237,5 +289,21 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
   return detail::contains(lists, search_keys, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(lists, search_key, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(lists, search_keys, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace lists
 }  // namespace cudf
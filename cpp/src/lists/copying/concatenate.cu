@@ -21,12 +21,15 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
-#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+
 #include <memory>
 
 namespace cudf {
@@ -35,6 +38,45 @@ namespace detail {
 
 namespace {
 
+/**
+ * @brief Merges the offsets child columns of multiple list columns in one kernel.
+ *
+ * Each output offset is looked up in the owning input column and shifted by the
+ * position of that column's child rows in the concatenated child column, less
+ * the column's first offset (nonzero for sliced columns).
+ *
+ * @param offsets_ptrs First offset of each non-empty input column
+ * @param partition_starts Start position of each input column in the output
+ * @param child_starts Start position of each column's child rows in the concatenated child
+ * @param num_partitions Number of non-empty input columns
+ * @param output_count Total number of offsets to produce
+ * @param output_data The merged offsets
+ */
+__global__ void fused_merge_offsets_kernel(size_type const* const* offsets_ptrs,
+                                           size_type const* partition_starts,
+                                           size_type const* child_starts,
+                                           size_type num_partitions,
+                                           size_type output_count,
+                                           size_type* output_data)
+{
+  size_type output_index = threadIdx.x + blockIdx.x * blockDim.x;
+
+  while (output_index < output_count) {
+    // Lookup input index by searching for output index in the partition starts.
+    // Partition boundaries are written by either neighbor with equal results.
+    auto const offset_it =
+      -1 + thrust::upper_bound(
+             thrust::seq, partition_starts, partition_starts + num_partitions, output_index);
+    size_type const partition_index = offset_it - partition_starts;
+
+    auto const* d_offsets = offsets_ptrs[partition_index];
+    output_data[output_index] =
+      d_offsets[output_index - *offset_it] + child_starts[partition_index] - d_offsets[0];
+
+    output_index += blockDim.x * gridDim.x;
+  }
+}
+
 /**
  * @brief Merges the offsets child columns of multiple list columns into one.
  *
@@ -42,6 +84,7 @@ namespace {
  * all offsets are shifted to account for the new starting position
  *
  * @param[in] columns               Vector of lists columns to concatenate
+ * @param[in] children              Sliced child of each lists column, in the same order
  * @param[in] total_list_count      Total number of lists contained in the columns
  * @param[in] stream                CUDA stream used for device memory operations
  * and kernel launches.
@@ -49,6 +92,7 @@ namespace {
  * returned column's device memory.
  */
 std::unique_ptr<column> merge_offsets(host_span<lists_column_view const> columns,
+                                      host_span<column_view const> children,
                                       size_type total_list_count,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr)
@@ -56,30 +100,46 @@ std::unique_ptr<column> merge_offsets(host_span<lists_column_view const> columns
   // outgoing offsets
   auto merged_offsets = cudf::make_fixed_width_column(
     data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
-  mutable_column_device_view d_merged_offsets(*merged_offsets, 0, 0);
+  auto d_merged_offsets = merged_offsets->mutable_view().data<size_type>();
 
-  // merge offsets
-  // TODO : this could probably be done as a single gpu operation if done as a kernel.
-  size_type shift = 0;
+  // build one descriptor per non-empty input column so all offsets are merged
+  // with a single launch regardless of the number of inputs
+  std::vector<size_type const*> h_offsets_ptrs;
+  std::vector<size_type> h_partition_starts;
+  std::vector<size_type> h_child_starts;
   size_type count = 0;
-  std::for_each(columns.begin(), columns.end(), [&](lists_column_view const& c) {
+  size_type shift = 0;
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    auto const& c = columns[i];
     if (c.size() > 0) {
-      // handle sliced columns
-      int const local_shift =
-        shift -
-        (c.offset() > 0 ? cudf::detail::get_value<size_type>(c.offsets(), c.offset(), stream) : 0);
-      column_device_view offsets(c.offsets(), nullptr, nullptr);
-      thrust::transform(
-        rmm::exec_policy(stream),
-        offsets.begin<size_type>() + c.offset(),
-        offsets.begin<size_type>() + c.offset() + c.size() + 1,
-        d_merged_offsets.begin<size_type>() + count,
-        [local_shift] __device__(size_type offset) { return offset + local_shift; });
-
-      shift += c.get_sliced_child(stream).size();
+      h_offsets_ptrs.push_back(c.offsets().data<size_type>() + c.offset());
+      h_partition_starts.push_back(count);
+      h_child_starts.push_back(shift);
       count += c.size();
+      shift += children[i].size();
     }
-  });
+  }
+
+  if (h_offsets_ptrs.empty()) {
+    CUDA_TRY(cudaMemsetAsync(d_merged_offsets, 0, sizeof(size_type), stream.value()));
+    return merged_offsets;
+  }
+
+  auto d_offsets_ptrs     = cudf::detail::make_device_uvector_async(h_offsets_ptrs, stream);
+  auto d_partition_starts = cudf::detail::make_device_uvector_async(h_partition_starts, stream);
+  auto d_child_starts     = cudf::detail::make_device_uvector_async(h_child_starts, stream);
+
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d config(total_list_count + 1, block_size);
+  fused_merge_offsets_kernel<<<config.num_blocks,
+                               config.num_threads_per_block,
+                               0,
+                               stream.value()>>>(d_offsets_ptrs.data(),
+                                                 d_partition_starts.data(),
+                                                 d_child_starts.data(),
+                                                 static_cast<size_type>(h_offsets_ptrs.size()),
+                                                 total_list_count + 1,
+                                                 d_merged_offsets);
 
   return merged_offsets;
 }
@@ -115,7 +175,7 @@ std::unique_ptr<column> concatenate(
   auto data = cudf::detail::concatenate(children, stream, mr);
 
   // merge offsets
-  auto offsets = merge_offsets(lists_columns, total_list_count, stream, mr);
+  auto offsets = merge_offsets(lists_columns, children, total_list_count, stream, mr);
 
   // if any of the input columns have nulls, construct the output mask
   bool const has_nulls =
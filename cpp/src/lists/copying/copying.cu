@@ -16,8 +16,8 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_range.cuh>
-#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -48,10 +48,22 @@ std::unique_ptr<cudf::column> copy_slice(lists_column_view const& lists,
   start += lists.offset();
   end += lists.offset();
 
-  // Offsets at the beginning and end of the slice:
+  // Offsets at the beginning and end of the slice, fetched with a single synchronize:
   auto offsets_data = lists.offsets().data<cudf::size_type>();
-  auto start_offset = cudf::detail::get_value<size_type>(lists.offsets(), start, stream);
-  auto end_offset   = cudf::detail::get_value<size_type>(lists.offsets(), end, stream);
+  size_type offsets_bounds[2];
+  CUDA_TRY(cudaMemcpyAsync(&offsets_bounds[0],
+                           offsets_data + start,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  CUDA_TRY(cudaMemcpyAsync(&offsets_bounds[1],
+                           offsets_data + end,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+  auto const start_offset = offsets_bounds[0];
+  auto const end_offset   = offsets_bounds[1];
 
   rmm::device_uvector<cudf::size_type> out_offsets(offsets_count, stream);
 
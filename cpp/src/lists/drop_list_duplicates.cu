@@ -672,16 +672,12 @@ std::pair<std::unique_ptr<column>, std::unique_ptr<column>> drop_list_duplicates
 std::unique_ptr<column> drop_list_duplicates(lists_column_view const& input,
                                              null_equality nulls_equal,
                                              nan_equality nans_equal,
+                                             duplicate_keep_option keep_option,
                                              rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource* mr)
 {
-  return drop_list_duplicates_common(input,
-                                     std::nullopt,
-                                     nulls_equal,
-                                     nans_equal,
-                                     duplicate_keep_option::KEEP_FIRST,
-                                     stream,
-                                     mr)
+  return drop_list_duplicates_common(
+           input, std::nullopt, nulls_equal, nans_equal, keep_option, stream, mr)
     .first;
 }
 
@@ -720,7 +716,8 @@ std::unique_ptr<column> drop_list_duplicates(lists_column_view const& input,
                                              rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::drop_list_duplicates(input, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+  return detail::drop_list_duplicates(
+    input, nulls_equal, nans_equal, duplicate_keep_option::KEEP_FIRST, rmm::cuda_stream_default, mr);
 }
 
 }  // namespace cudf::lists
@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/utilities/validation.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -101,7 +102,10 @@ std::unique_ptr<column> make_lists_column(size_type num_rows,
   CUDF_EXPECTS(
     (num_rows == 0 && offsets_column->size() == 0) || num_rows == offsets_column->size() - 1,
     "Invalid offsets column size for lists column.");
-  CUDF_EXPECTS(offsets_column->null_count() == 0, "Offsets column should not contain nulls");
+  // may launch a null-count kernel; skipped when the caller trusts its inputs
+  if (full_validation_enabled()) {
+    CUDF_EXPECTS(offsets_column->null_count() == 0, "Offsets column should not contain nulls");
+  }
   CUDF_EXPECTS(child_column != nullptr, "Must pass a valid child column");
 
   std::vector<std::unique_ptr<column>> children;
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/lists/reduce.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+/**
+ * @brief Reduces each list element of the given lists column to a single value.
+ *
+ * @param input Lists column of values to reduce.
+ * @param agg Aggregation operator applied to each list.
+ * @param output_dtype The computation and output precision.
+ * @param null_handling Whether a null element nullifies its list's result.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Column with one reduction result per list row.
+ */
+std::unique_ptr<column> reduce(lists_column_view const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               null_policy null_handling,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  if (input.is_empty()) { return make_empty_column(output_dtype); }
+
+  // The offsets of a sliced lists column still index into the full child
+  // column, so the child is passed unsliced and only the offsets are shifted.
+  auto const offsets = column_view(data_type{type_to_id<size_type>()},
+                                   input.size() + 1,
+                                   input.offsets().head<size_type>(),
+                                   nullptr,
+                                   0,
+                                   input.offset());
+
+  auto result = cudf::detail::segmented_reduce(
+    input.child(), offsets, agg, output_dtype, null_handling, stream, mr);
+
+  // A null list row reduces to null regardless of its offsets range
+  if (input.has_nulls()) {
+    auto [null_mask, null_count] =
+      cudf::detail::bitmask_and(table_view{{result->view(), input.parent()}}, stream, mr);
+    result->set_null_mask(std::move(null_mask), null_count);
+  }
+  return result;
+}
+
+}  // namespace detail
+
+// external APIS
+
+std::unique_ptr<column> reduce(lists_column_view const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               null_policy null_handling,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, agg, output_dtype, null_handling, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
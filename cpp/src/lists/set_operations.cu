@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/detail/combine.hpp>
+#include <cudf/lists/detail/drop_list_duplicates.hpp>
+#include <cudf/lists/detail/set_operations.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/uninitialized_fill.h>
+
+namespace cudf::lists {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Check that two lists columns can be combined element-wise into set operation results.
+ */
+void check_compatibility(lists_column_view const& lhs, lists_column_view const& rhs)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "The input lists columns must have the same size.");
+  CUDF_EXPECTS(lhs.child().type() == rhs.child().type(),
+               "The input lists columns must have children of the same type.");
+}
+
+/**
+ * @brief Copy the distinct elements of each list, equivalent to `drop_list_duplicates` with
+ * intermediate memory resource.
+ */
+std::unique_ptr<column> distinct(lists_column_view const& input,
+                                 null_equality nulls_equal,
+                                 nan_equality nans_equal,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return drop_list_duplicates(
+    input, nulls_equal, nans_equal, duplicate_keep_option::KEEP_FIRST, stream, mr);
+}
+
+/**
+ * @brief Filter functor keeping the entries that can compare equal to some other entry.
+ *
+ * Null entries never match anything when `nulls_equal == UNEQUAL` and NaN entries never match
+ * anything when `nans_equal == UNEQUAL`; such entries must not reach the duplicate-counting
+ * pass of `difference_of_distinct` or they would be kept as false singletons.
+ */
+template <typename Type>
+struct matchable_entry_fn {
+  column_device_view const d_entries;
+  bool const purge_nulls;
+  bool const purge_nans;
+
+  __device__ bool operator()(size_type idx) const noexcept
+  {
+    if (purge_nulls && d_entries.is_null(idx)) { return false; }
+    if constexpr (cuda::std::is_floating_point_v<Type>) {
+      if (purge_nans && d_entries.is_valid(idx) && std::isnan(d_entries.element<Type>(idx))) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+struct purge_unmatchable_dispatch {
+  template <typename Type>
+  std::unique_ptr<table> operator()(table_view const& input,
+                                    column_device_view const& d_entries,
+                                    bool purge_nulls,
+                                    bool purge_nans,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr) const
+  {
+    return cudf::detail::copy_if(
+      input, matchable_entry_fn<Type>{d_entries, purge_nulls, purge_nans}, stream, mr);
+  }
+};
+
+/**
+ * @brief Remove the elements of each list that can never compare equal to any other element.
+ *
+ * Returns the input column unchanged when the comparison flags make all elements matchable.
+ * NaN entries nested inside STRUCT elements are not purged; behavior of the set operations is
+ * undefined for such elements when `nans_equal == UNEQUAL`.
+ */
+std::unique_ptr<column> purge_unmatchable(column_view const& input,
+                                          null_equality nulls_equal,
+                                          nan_equality nans_equal,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const lists       = lists_column_view{input};
+  auto const entries     = lists.get_sliced_child(stream);
+  auto const purge_nulls = nulls_equal == null_equality::UNEQUAL && entries.has_nulls();
+  auto const purge_nans =
+    nans_equal == nan_equality::UNEQUAL && cudf::is_floating_point(entries.type());
+  if (!purge_nulls && !purge_nans) { return std::make_unique<column>(input, stream, mr); }
+
+  auto const num_lists   = lists.size();
+  auto const num_entries = entries.size();
+
+  // Map each entry to the (1-based) index of the list containing it
+  auto entry_list_indices = rmm::device_uvector<size_type>(num_entries, stream);
+  auto const offsets_begin = lists.offsets_begin();
+  auto const sizes_it      = thrust::make_transform_iterator(
+    offsets_begin, [offsets_begin] __device__(auto const idx) { return idx - *offsets_begin; });
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      sizes_it,
+                      sizes_it + num_lists,
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_entries),
+                      entry_list_indices.begin());
+
+  auto const d_entries = column_device_view::create(entries, stream);
+  auto const list_indices_view = column_view(data_type{type_to_id<size_type>()},
+                                             num_entries,
+                                             entry_list_indices.data());
+  auto filtered = type_dispatcher(entries.type(),
+                                  purge_unmatchable_dispatch{},
+                                  table_view{{entries, list_indices_view}},
+                                  *d_entries,
+                                  purge_nulls,
+                                  purge_nans,
+                                  stream,
+                                  mr)
+                    ->release();
+
+  // Rebuild the list offsets from the surviving entries' list indices
+  auto const kept_list_indices = filtered.back()->view();
+  auto list_indices            = rmm::device_uvector<size_type>(num_lists, stream);
+  auto list_sizes              = rmm::device_uvector<size_type>(num_lists, stream);
+  auto const end               = thrust::reduce_by_key(rmm::exec_policy(stream),
+                                         kept_list_indices.begin<size_type>(),
+                                         kept_list_indices.end<size_type>(),
+                                         thrust::make_constant_iterator<size_type>(1),
+                                         list_indices.begin(),
+                                         list_sizes.begin());
+  auto const num_non_empty_lists = thrust::distance(list_indices.begin(), end.first);
+
+  auto new_offsets = rmm::device_uvector<offset_type>(num_lists + 1, stream, mr);
+  thrust::uninitialized_fill_n(
+    rmm::exec_policy(stream), new_offsets.begin(), num_lists + 1, offset_type{0});
+  thrust::scatter(rmm::exec_policy(stream),
+                  list_sizes.begin(),
+                  list_sizes.begin() + num_non_empty_lists,
+                  list_indices.begin(),
+                  new_offsets.begin());
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), new_offsets.begin(), new_offsets.end(), new_offsets.begin());
+
+  return make_lists_column(num_lists,
+                           std::make_unique<column>(data_type{type_to_id<offset_type>()},
+                                                    num_lists + 1,
+                                                    new_offsets.release()),
+                           std::move(filtered.front()),
+                           input.null_count(),
+                           cudf::detail::copy_bitmask(input, stream, mr),
+                           stream,
+                           mr);
+}
+
+/**
+ * @brief Compute the row-wise difference of two lists columns whose lists hold distinct
+ * elements.
+ *
+ * Concatenating each list of `lhs` with two copies of the corresponding list of `rhs` makes
+ * elements present in `rhs` occur two or three times per row while elements exclusive to `lhs`
+ * occur exactly once, so extracting the entries without duplicates (`KEEP_NONE`) over the
+ * segmented-sorted concatenation yields exactly `lhs - rhs`. This reuses the
+ * `drop_list_duplicates` machinery instead of exploding the inputs into element rows.
+ */
+std::unique_ptr<column> difference_of_distinct(column_view const& lhs,
+                                               column_view const& rhs,
+                                               null_equality nulls_equal,
+                                               nan_equality nans_equal,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+
+  // Unmatchable `rhs` elements would survive the duplicate counting as false singletons
+  auto const rhs_matchable = purge_unmatchable(rhs, nulls_equal, nans_equal, stream, temp_mr);
+  auto const concatenated =
+    concatenate_rows(table_view{{lhs, rhs_matchable->view(), rhs_matchable->view()}},
+                     concatenate_null_policy::NULLIFY_OUTPUT_ROW,
+                     stream,
+                     temp_mr);
+  return drop_list_duplicates(lists_column_view{concatenated->view()},
+                              nulls_equal,
+                              nans_equal,
+                              duplicate_keep_option::KEEP_NONE,
+                              stream,
+                              mr);
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<column> intersect(lists_column_view const& lhs,
+                                  lists_column_view const& rhs,
+                                  null_equality nulls_equal,
+                                  nan_equality nans_equal,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  check_compatibility(lhs, rhs);
+  if (lhs.is_empty()) { return empty_like(lhs.parent()); }
+
+  auto const temp_mr    = rmm::mr::get_current_device_resource();
+  auto const lhs_unique = distinct(lhs, nulls_equal, nans_equal, stream, temp_mr);
+  auto const rhs_unique = distinct(rhs, nulls_equal, nans_equal, stream, temp_mr);
+
+  // The elements common to both sides are the elements of `lhs` that are left after removing
+  // the elements exclusive to `lhs`. Unmatchable `lhs` elements cannot be common to both
+  // sides, so they are purged from the minuend of the second pass.
+  auto const lhs_only = difference_of_distinct(
+    lhs_unique->view(), rhs_unique->view(), nulls_equal, nans_equal, stream, temp_mr);
+  auto const lhs_matchable =
+    purge_unmatchable(lhs_unique->view(), nulls_equal, nans_equal, stream, temp_mr);
+  return difference_of_distinct(
+    lhs_matchable->view(), lhs_only->view(), nulls_equal, nans_equal, stream, mr);
+}
+
+std::unique_ptr<column> union_(lists_column_view const& lhs,
+                               lists_column_view const& rhs,
+                               null_equality nulls_equal,
+                               nan_equality nans_equal,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  check_compatibility(lhs, rhs);
+  if (lhs.is_empty()) { return empty_like(lhs.parent()); }
+
+  auto const concatenated = concatenate_rows(table_view{{lhs.parent(), rhs.parent()}},
+                                             concatenate_null_policy::NULLIFY_OUTPUT_ROW,
+                                             stream,
+                                             rmm::mr::get_current_device_resource());
+  return drop_list_duplicates(lists_column_view{concatenated->view()},
+                              nulls_equal,
+                              nans_equal,
+                              duplicate_keep_option::KEEP_FIRST,
+                              stream,
+                              mr);
+}
+
+std::unique_ptr<column> difference(lists_column_view const& lhs,
+                                   lists_column_view const& rhs,
+                                   null_equality nulls_equal,
+                                   nan_equality nans_equal,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  check_compatibility(lhs, rhs);
+  if (lhs.is_empty()) { return empty_like(lhs.parent()); }
+
+  auto const temp_mr    = rmm::mr::get_current_device_resource();
+  auto const lhs_unique = distinct(lhs, nulls_equal, nans_equal, stream, temp_mr);
+  auto const rhs_unique = distinct(rhs, nulls_equal, nans_equal, stream, temp_mr);
+  return difference_of_distinct(
+    lhs_unique->view(), rhs_unique->view(), nulls_equal, nans_equal, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> intersect(lists_column_view const& lhs,
+                                  lists_column_view const& rhs,
+                                  null_equality nulls_equal,
+                                  nan_equality nans_equal,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::intersect(lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> union_(lists_column_view const& lhs,
+                               lists_column_view const& rhs,
+                               null_equality nulls_equal,
+                               nan_equality nans_equal,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::union_(lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> difference(lists_column_view const& lhs,
+                                   lists_column_view const& rhs,
+                                   null_equality nulls_equal,
+                                   nan_equality nans_equal,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::difference(lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf::lists
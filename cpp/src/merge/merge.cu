@@ -14,10 +14,13 @@
  * limitations under the License.
  */
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/merge.hpp>
@@ -31,11 +34,17 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/pair.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
 
+#include <numeric>
 #include <queue>
 #include <vector>
 #include "cudf/utilities/traits.hpp"
@@ -217,6 +226,82 @@ index_vector generate_merged_indices(table_view const& left_table,
   return merged_indices;
 }
 
+/**
+ * @brief Generates the merged row order for a sorted table and a small sorted delta.
+ *
+ * Rather than running a comparator over every row of both tables as
+ * `generate_merged_indices` does, each delta row is binary-searched into the
+ * target once and all output positions are then derived from those insertion
+ * points with integer arithmetic, so row comparisons scale with the delta size.
+ *
+ * @param[in] target_keys Index columns of the (large) sorted target table
+ * @param[in] delta_keys Index columns of the (small) sorted delta table
+ * @param[in] column_order Sort order types of index columns
+ * @param[in] null_precedence Array indicating the order of nulls with respect to non-nulls for the
+ * index columns
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return A device_uvector of merged indices
+ */
+index_vector generate_incremental_merged_indices(table_view const& target_keys,
+                                                 table_view const& delta_keys,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::cuda_stream_view stream)
+{
+  size_type const target_size = target_keys.num_rows();
+  size_type const delta_size  = delta_keys.num_rows();
+
+  // upper_bound keeps target rows ahead of equal delta rows, matching the
+  // left-before-right stability of the comparator-driven merge
+  auto const insert_points = cudf::detail::upper_bound(target_keys,
+                                                       delta_keys,
+                                                       column_order,
+                                                       null_precedence,
+                                                       stream,
+                                                       rmm::mr::get_current_device_resource());
+  auto const d_insert      = insert_points->view().begin<size_type>();
+
+  index_vector merged_indices(target_size + delta_size, stream);
+
+  // delta row j lands at its insertion point, shifted past the j delta rows
+  // already placed before it
+  auto delta_begin = cudf::detail::make_counting_transform_iterator(
+    0, side_index_generator{side::RIGHT});
+  auto delta_positions = cudf::detail::make_counting_transform_iterator(
+    0, [d_insert] __device__(size_type j) { return d_insert[j] + j; });
+  thrust::scatter(rmm::exec_policy(stream),
+                  delta_begin,
+                  delta_begin + delta_size,
+                  delta_positions,
+                  merged_indices.begin());
+
+  // a target row shifts right by the number of delta rows inserted at or before
+  // it; the insertion points are sorted, so that count is an integer search
+  rmm::device_uvector<size_type> target_shifts(target_size, stream);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      d_insert,
+                      d_insert + delta_size,
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(target_size),
+                      target_shifts.begin());
+
+  auto target_begin = cudf::detail::make_counting_transform_iterator(
+    0, side_index_generator{side::LEFT});
+  auto const d_shifts   = target_shifts.data();
+  auto target_positions = cudf::detail::make_counting_transform_iterator(
+    0, [d_shifts] __device__(size_type i) { return i + d_shifts[i]; });
+  thrust::scatter(rmm::exec_policy(stream),
+                  target_begin,
+                  target_begin + target_size,
+                  target_positions,
+                  merged_indices.begin());
+
+  CHECK_CUDA(stream.value());
+
+  return merged_indices;
+}
+
 /**
  * @brief Generate merged column given row-order of merged tables
  *  (ordered according to indices of key_cols) and the 2 columns to merge.
@@ -431,6 +516,87 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
+/**
+ * @brief Merges N sorted tables in a single pass over the data.
+ *
+ * Merging pairwise costs log2(N) full passes over the data. Instead, the output
+ * position of every row is computed directly as its own index plus the number
+ * of rows from every other table that precede it (one vectorized binary search
+ * per table pair), and the data is then materialized once with a
+ * concatenate + gather. Rows from earlier tables precede equal rows from later
+ * tables, matching the pairwise merge.
+ *
+ * All tables must be non-empty.
+ */
+table_ptr_type merge_multiway(std::vector<table_view> const& tables,
+                              std::vector<cudf::size_type> const& key_cols,
+                              std::vector<cudf::order> const& column_order,
+                              std::vector<cudf::null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto const num_tables = static_cast<size_type>(tables.size());
+  auto const total_rows = std::accumulate(
+    tables.begin(), tables.end(), size_type{0}, [](size_type sum, table_view const& t) {
+      return sum + t.num_rows();
+    });
+
+  // gather map from output row to row of the concatenated input
+  rmm::device_uvector<size_type> gather_map(total_rows, stream);
+
+  size_type concat_offset = 0;
+  for (size_type t = 0; t < num_tables; ++t) {
+    auto const keys     = tables[t].select(key_cols);
+    auto const num_rows = tables[t].num_rows();
+
+    rmm::device_uvector<size_type> positions(num_rows, stream);
+    thrust::sequence(rmm::exec_policy(stream), positions.begin(), positions.end());
+    for (size_type u = 0; u < num_tables; ++u) {
+      if (u == t) { continue; }
+      // equal rows from earlier tables precede this table's rows
+      auto const bounds = u < t ? cudf::detail::upper_bound(tables[u].select(key_cols),
+                                                            keys,
+                                                            column_order,
+                                                            null_precedence,
+                                                            stream,
+                                                            rmm::mr::get_current_device_resource())
+                                : cudf::detail::lower_bound(tables[u].select(key_cols),
+                                                            keys,
+                                                            column_order,
+                                                            null_precedence,
+                                                            stream,
+                                                            rmm::mr::get_current_device_resource());
+      thrust::transform(rmm::exec_policy(stream),
+                        positions.begin(),
+                        positions.end(),
+                        bounds->view().begin<size_type>(),
+                        positions.begin(),
+                        thrust::plus<size_type>());
+    }
+
+    // invert the permutation: record the concatenated source index of each
+    // output row
+    auto concat_indices = thrust::counting_iterator<size_type>(concat_offset);
+    thrust::scatter(rmm::exec_policy(stream),
+                    concat_indices,
+                    concat_indices + num_rows,
+                    positions.begin(),
+                    gather_map.begin());
+    concat_offset += num_rows;
+  }
+
+  auto const concatenated =
+    cudf::detail::concatenate(tables, stream, rmm::mr::get_current_device_resource());
+  auto const gather_map_view =
+    column_view(data_type{type_to_id<size_type>()}, total_rows, gather_map.data());
+  return cudf::detail::gather(concatenated->view(),
+                              gather_map_view,
+                              out_of_bounds_policy::DONT_CHECK,
+                              detail::negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
 struct merge_queue_item {
   table_view view;
   table_ptr_type table;
@@ -491,6 +657,17 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
     tables_to_merge, stream, rmm::mr::get_current_device_resource());
   auto merge_tables = matched.second;
 
+  // With more than two non-empty inputs, compute the output permutation
+  // directly and materialize it once instead of merging pairwise log2(N) times
+  std::vector<table_view> non_empty_tables;
+  std::copy_if(merge_tables.begin(),
+               merge_tables.end(),
+               std::back_inserter(non_empty_tables),
+               [](table_view const& t) { return t.num_rows() > 0; });
+  if (non_empty_tables.size() > 2) {
+    return merge_multiway(non_empty_tables, key_cols, column_order, null_precedence, stream, mr);
+  }
+
   // A queue of (table view, table) pairs
   std::priority_queue<merge_queue_item> merge_queue;
   // The table pointer is null if we do not own the table (input tables)
@@ -528,6 +705,55 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   return std::move(top_and_pop(merge_queue).table);
 }
 
+std::unique_ptr<cudf::table> incremental_merge(table_view const& target,
+                                               table_view const& delta,
+                                               std::vector<cudf::size_type> const& key_cols,
+                                               std::vector<cudf::order> const& column_order,
+                                               std::vector<cudf::null_order> const& null_precedence,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto const n_cols = target.num_columns();
+  CUDF_EXPECTS(n_cols == delta.num_columns(), "Mismatched number of columns");
+  CUDF_EXPECTS(cudf::have_same_types(target, delta), "Mismatched column types");
+
+  CUDF_EXPECTS(!key_cols.empty(), "Empty key_cols");
+  CUDF_EXPECTS(key_cols.size() <= static_cast<size_t>(n_cols), "Too many values in key_cols");
+
+  CUDF_EXPECTS(key_cols.size() == column_order.size(),
+               "Mismatched size between key_cols and column_order");
+
+  if (target.num_rows() == 0 && delta.num_rows() == 0) { return empty_like(target); }
+  if (delta.num_rows() == 0) { return std::make_unique<cudf::table>(target, stream, mr); }
+  if (target.num_rows() == 0) { return std::make_unique<cudf::table>(delta, stream, mr); }
+
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {target, delta}, stream, rmm::mr::get_current_device_resource());
+  auto const& target_view = matched.second.front();
+  auto const& delta_view  = matched.second.back();
+
+  auto const merged_indices = generate_incremental_merged_indices(target_view.select(key_cols),
+                                                                  delta_view.select(key_cols),
+                                                                  column_order,
+                                                                  null_precedence,
+                                                                  stream);
+
+  std::vector<std::unique_ptr<column>> merged_cols;
+  merged_cols.reserve(n_cols);
+
+  column_merger merger{merged_indices};
+  transform(target_view.begin(),
+            target_view.end(),
+            delta_view.begin(),
+            std::back_inserter(merged_cols),
+            [&](auto const& left_col, auto const& right_col) {
+              return cudf::type_dispatcher<dispatch_storage_type>(
+                left_col.type(), merger, left_col, right_col, stream, mr);
+            });
+
+  return std::make_unique<cudf::table>(std::move(merged_cols));
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merge,
@@ -536,9 +762,24 @@ std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merg
                                    std::vector<cudf::null_order> const& null_precedence,
                                    rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(std::accumulate(
+    tables_to_merge.begin(), tables_to_merge.end(), std::size_t{0}, [](auto sum, auto const& t) {
+      return sum + t.num_rows();
+    }));
   return detail::merge(
     tables_to_merge, key_cols, column_order, null_precedence, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::table> incremental_merge(table_view const& target,
+                                               table_view const& delta,
+                                               std::vector<cudf::size_type> const& key_cols,
+                                               std::vector<cudf::order> const& column_order,
+                                               std::vector<cudf::null_order> const& null_precedence,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(target.num_rows() + delta.num_rows());
+  return detail::incremental_merge(
+    target, delta, key_cols, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -17,8 +17,10 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
+#include <cudf/detail/search.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
@@ -391,6 +393,7 @@ struct copy_block_partitions_dispatcher {
                                      size_type const* block_partition_sizes,
                                      size_type const* scanned_block_partition_sizes,
                                      size_type grid_size,
+                                     size_type const*,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
@@ -413,49 +416,55 @@ struct copy_block_partitions_dispatcher {
   template <typename DataType, std::enable_if_t<not is_fixed_width<DataType>()>* = nullptr>
   std::unique_ptr<column> operator()(column_view const& input,
                                      const size_type num_partitions,
-                                     size_type const* row_partition_numbers,
-                                     size_type const* row_partition_offset,
-                                     size_type const* block_partition_sizes,
-                                     size_type const* scanned_block_partition_sizes,
-                                     size_type grid_size,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type const*,
+                                     size_type,
+                                     size_type const* gather_map,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    // Use move_to_output_buffer to create an equivalent gather map
-    auto gather_map = compute_gather_map(input.size(),
-                                         num_partitions,
-                                         row_partition_numbers,
-                                         row_partition_offset,
-                                         block_partition_sizes,
-                                         scanned_block_partition_sizes,
-                                         grid_size,
-                                         stream);
-
-    // Use gather instead for non-fixed width types
+    // Use gather with the shared gather map for non-fixed width types
     return type_dispatcher(input.type(),
                            detail::column_gatherer{},
                            input,
-                           gather_map.begin(),
-                           gather_map.end(),
+                           gather_map,
+                           gather_map + input.size(),
                            false,
                            stream,
                            mr);
   }
 };
 
+/**
+ * @brief Row-to-partition mapping produced by the histogramming pass.
+ *
+ * Holds everything `copy_block_partitions` needs to move rows to their
+ * partitions, so the pass over the hashed columns runs once no matter how
+ * many columns (or tables) are subsequently reordered with the layout.
+ * `partition_offsets` is copied from the device asynchronously; synchronize
+ * the stream before reading it.
+ */
+struct partition_layout {
+  rmm::device_uvector<size_type> row_partition_numbers;
+  rmm::device_uvector<size_type> row_partition_offset;
+  rmm::device_uvector<size_type> block_partition_sizes;
+  rmm::device_uvector<size_type> scanned_block_partition_sizes;
+  std::vector<size_type> partition_offsets;
+  size_type grid_size;
+};
+
 // NOTE hash_has_nulls must be true if table_to_hash has nulls
 template <template <typename> class hash_function, bool hash_has_nulls>
-std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
-  table_view const& input,
-  table_view const& table_to_hash,
-  size_type num_partitions,
-  uint32_t seed,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
+partition_layout compute_partition_layout(table_view const& table_to_hash,
+                                          size_type num_partitions,
+                                          uint32_t seed,
+                                          bool use_optimization,
+                                          rmm::cuda_stream_view stream)
 {
   auto const num_rows = table_to_hash.num_rows();
 
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
   auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
   auto const rows_per_thread =
     use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
@@ -549,41 +558,73 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
 
   // Copy the result of the exclusive scan to the output offsets array
   // to indicate the starting point for each partition in the output
-  auto const partition_offsets =
-    cudf::detail::make_std_vector_async(global_partition_sizes, stream);
+  auto partition_offsets = cudf::detail::make_std_vector_async(global_partition_sizes, stream);
+
+  return partition_layout{std::move(row_partition_numbers),
+                          std::move(row_partition_offset),
+                          std::move(block_partition_sizes),
+                          std::move(scanned_block_partition_sizes),
+                          std::move(partition_offsets),
+                          grid_size};
+}
+
+// NOTE hash_has_nulls must be true if table_to_hash has nulls
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  uint32_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = table_to_hash.num_rows();
+
+  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
+
+  auto layout = compute_partition_layout<hash_function, hash_has_nulls>(
+    table_to_hash, num_partitions, seed, use_optimization, stream);
 
   // When the number of partitions is less than a threshold, we can apply an
   // optimization using shared memory to copy values to the output buffer.
   // Otherwise, fallback to using scatter.
   if (use_optimization) {
+    // The gather map is shared by every non-fixed-width column and by the
+    // bitmask pass, so materialize it at most once instead of per column
+    bool const needs_gather_map =
+      has_nulls(input) or std::any_of(input.begin(), input.end(), [](auto const& col) {
+        return not is_fixed_width(col.type());
+      });
+    auto gather_map = needs_gather_map ? compute_gather_map(num_rows,
+                                                            num_partitions,
+                                                            layout.row_partition_numbers.data(),
+                                                            layout.row_partition_offset.data(),
+                                                            layout.block_partition_sizes.data(),
+                                                            layout.scanned_block_partition_sizes.data(),
+                                                            layout.grid_size,
+                                                            stream)
+                                       : rmm::device_uvector<size_type>(0, stream);
+
     std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
 
     // Copy input to output by partition per column
     std::transform(input.begin(), input.end(), output_cols.begin(), [&](auto const& col) {
-      return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
-                                                          copy_block_partitions_dispatcher{},
-                                                          col,
-                                                          num_partitions,
-                                                          row_partition_numbers.data(),
-                                                          row_partition_offset.data(),
-                                                          block_partition_sizes.data(),
-                                                          scanned_block_partition_sizes.data(),
-                                                          grid_size,
-                                                          stream,
-                                                          mr);
+      return cudf::type_dispatcher<dispatch_storage_type>(
+        col.type(),
+        copy_block_partitions_dispatcher{},
+        col,
+        num_partitions,
+        layout.row_partition_numbers.data(),
+        layout.row_partition_offset.data(),
+        layout.block_partition_sizes.data(),
+        layout.scanned_block_partition_sizes.data(),
+        layout.grid_size,
+        gather_map.data(),
+        stream,
+        mr);
     });
 
     if (has_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
-                                           num_partitions,
-                                           row_partition_numbers.data(),
-                                           row_partition_offset.data(),
-                                           block_partition_sizes.data(),
-                                           scanned_block_partition_sizes.data(),
-                                           grid_size,
-                                           stream);
-
       // Handle bitmask using gather to take advantage of ballot_sync
       detail::gather_bitmask(
         input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
@@ -591,27 +632,67 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
 
     stream.synchronize();  // Async D2H copy must finish before returning host vec
     return std::make_pair(std::make_unique<table>(std::move(output_cols)),
-                          std::move(partition_offsets));
+                          std::move(layout.partition_offsets));
   } else {
     // Compute a scatter map from input to output such that the output rows are
     // sorted by partition number
-    auto row_output_locations{row_partition_numbers.data()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data()};
-    compute_row_output_locations<<<grid_size,
-                                   block_size,
+    auto row_output_locations{layout.row_partition_numbers.data()};
+    auto scanned_block_partition_sizes_ptr{layout.scanned_block_partition_sizes.data()};
+    compute_row_output_locations<<<layout.grid_size,
+                                   FALLBACK_BLOCK_SIZE,
                                    num_partitions * sizeof(size_type),
                                    stream.value()>>>(
       row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
 
     // Use the resulting scatter map to materialize the output
-    auto output = detail::scatter(
-      input, row_partition_numbers.begin(), row_partition_numbers.end(), input, false, stream, mr);
+    auto output = detail::scatter(input,
+                                  layout.row_partition_numbers.begin(),
+                                  layout.row_partition_numbers.end(),
+                                  input,
+                                  false,
+                                  stream,
+                                  mr);
 
     stream.synchronize();  // Async D2H copy must finish before returning host vec
-    return std::make_pair(std::move(output), std::move(partition_offsets));
+    return std::make_pair(std::move(output), std::move(layout.partition_offsets));
   }
 }
 
+/**
+ * @brief Moves one fixed-width column's rows to their partitions in a
+ * caller-provided buffer.
+ */
+struct copy_block_partitions_into_dispatcher {
+  template <typename DataType, std::enable_if_t<is_fixed_width<DataType>()>* = nullptr>
+  void operator()(column_view const& input,
+                  device_span<uint8_t> const output,
+                  const size_type num_partitions,
+                  partition_layout const& layout,
+                  rmm::cuda_stream_view stream)
+  {
+    copy_block_partitions_impl(input.data<DataType>(),
+                               reinterpret_cast<DataType*>(output.data()),
+                               input.size(),
+                               num_partitions,
+                               layout.row_partition_numbers.data(),
+                               layout.row_partition_offset.data(),
+                               layout.block_partition_sizes.data(),
+                               layout.scanned_block_partition_sizes.data(),
+                               layout.grid_size,
+                               stream);
+  }
+
+  template <typename DataType, std::enable_if_t<not is_fixed_width<DataType>()>* = nullptr>
+  void operator()(column_view const&,
+                  device_span<uint8_t> const,
+                  const size_type,
+                  partition_layout const&,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("hash_partition_into only supports fixed-width columns");
+  }
+};
+
 struct dispatch_map_type {
   /**
    * @brief Partitions the table `t` according to the `partition_map`.
@@ -734,8 +815,109 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
       input, table_to_hash, num_partitions, seed, stream, mr);
   }
 }
+
+template <template <typename> class hash_function>
+std::vector<size_type> hash_partition_into(table_view const& input,
+                                           std::vector<size_type> const& columns_to_hash,
+                                           int num_partitions,
+                                           host_span<device_span<uint8_t> const> output_buffers,
+                                           uint32_t seed,
+                                           rmm::cuda_stream_view stream)
+{
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    return std::vector<size_type>{};
+  }
+
+  CUDF_EXPECTS(num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL,
+               "hash_partition_into supports at most 1024 partitions");
+  CUDF_EXPECTS(output_buffers.size() == static_cast<std::size_t>(input.num_columns()),
+               "One output buffer per input column is required");
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col = input.column(i);
+    CUDF_EXPECTS(is_fixed_width(col.type()),
+                 "hash_partition_into only supports fixed-width columns");
+    CUDF_EXPECTS(not col.nullable(), "hash_partition_into does not support nullable columns");
+    CUDF_EXPECTS(
+      output_buffers[i].size() >= static_cast<std::size_t>(col.size()) * size_of(col.type()),
+      "Output buffer is too small for the partitioned column");
+  }
+
+  // All columns are non-nullable, so the hashed columns cannot contain nulls
+  auto layout = compute_partition_layout<hash_function, false>(
+    table_to_hash, num_partitions, seed, true, stream);
+
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    cudf::type_dispatcher<dispatch_storage_type>(input.column(i).type(),
+                                                 copy_block_partitions_into_dispatcher{},
+                                                 input.column(i),
+                                                 output_buffers[i],
+                                                 num_partitions,
+                                                 layout,
+                                                 stream);
+  }
+
+  stream.synchronize();  // Async D2H copy must finish before returning host vec
+  return std::move(layout.partition_offsets);
+}
 }  // namespace local
 
+std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
+  table_view const& t,
+  column_view const& partition_map,
+  size_type num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_partition,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  sorted is_input_sorted,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const keys = input.select(columns_to_partition);
+  CUDF_EXPECTS(splitters.num_columns() == keys.num_columns(),
+               "Splitters must have one column per partitioning column");
+
+  if (input.num_rows() == 0) { return std::make_pair(empty_like(input), std::vector<size_type>{}); }
+
+  // No splitters means everything lands in the one partition
+  if (splitters.num_rows() == 0) {
+    return std::make_pair(std::make_unique<table>(input, stream, mr),
+                          std::vector<size_type>{0});
+  }
+
+  if (is_input_sorted == sorted::YES) {
+    // Rows are already grouped by partition, so locate the partition
+    // boundaries with one search of the splitters and copy the input through.
+    // Each output partition inherits the input's sort order. Partition p
+    // starts at the first row comparing at or after splitter p - 1, matching
+    // the upper_bound assignment of the unsorted path below.
+    auto boundaries =
+      cudf::detail::lower_bound(keys, splitters, column_order, null_precedence, stream);
+    auto const h_boundaries = cudf::detail::make_std_vector_sync(
+      device_span<size_type const>(boundaries->view().data<size_type>(), boundaries->size()),
+      stream);
+
+    std::vector<size_type> offsets{0};
+    offsets.insert(offsets.end(), h_boundaries.begin(), h_boundaries.end());
+    return std::make_pair(std::make_unique<table>(input, stream, mr), std::move(offsets));
+  }
+
+  // Compute each row's partition number with one search of the splitters,
+  // then reuse the histogram-based partitioner to move rows in a single pass
+  auto partition_map =
+    cudf::detail::upper_bound(splitters, keys, column_order, null_precedence, stream);
+  return detail::partition(
+    input, partition_map->view(), splitters.num_rows() + 1, stream, mr);
+}
+
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
   column_view const& partition_map,
@@ -754,9 +936,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, stream, mr);
 }
-}  // namespace detail
 
-// Partition based on hash values
 std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
@@ -766,23 +946,140 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-
   switch (hash_function) {
     case (hash_id::HASH_IDENTITY):
       for (const size_type& column_id : columns_to_hash) {
         if (!is_numeric(input.column(column_id).type()))
           CUDF_FAIL("IdentityHash does not support this data type");
       }
-      return detail::local::hash_partition<IdentityHash>(
+      return local::hash_partition<IdentityHash>(
         input, columns_to_hash, num_partitions, seed, stream, mr);
     case (hash_id::HASH_MURMUR3):
-      return detail::local::hash_partition<MurmurHash3_32>(
+      return local::hash_partition<MurmurHash3_32>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64):
+      return local::hash_partition<XXHash_64>(
         input, columns_to_hash, num_partitions, seed, stream, mr);
     default: CUDF_FAIL("Unsupported hash function in hash_partition");
   }
 }
 
+std::vector<size_type> hash_partition_into(table_view const& input,
+                                           std::vector<size_type> const& columns_to_hash,
+                                           int num_partitions,
+                                           host_span<device_span<uint8_t> const> output_buffers,
+                                           hash_id hash_function,
+                                           uint32_t seed,
+                                           rmm::cuda_stream_view stream)
+{
+  switch (hash_function) {
+    case (hash_id::HASH_IDENTITY):
+      for (const size_type& column_id : columns_to_hash) {
+        if (!is_numeric(input.column(column_id).type()))
+          CUDF_FAIL("IdentityHash does not support this data type");
+      }
+      return local::hash_partition_into<IdentityHash>(
+        input, columns_to_hash, num_partitions, output_buffers, seed, stream);
+    case (hash_id::HASH_MURMUR3):
+      return local::hash_partition_into<MurmurHash3_32>(
+        input, columns_to_hash, num_partitions, output_buffers, seed, stream);
+    case (hash_id::HASH_XXHASH64):
+      return local::hash_partition_into<XXHash_64>(
+        input, columns_to_hash, num_partitions, output_buffers, seed, stream);
+    default: CUDF_FAIL("Unsupported hash function in hash_partition_into");
+  }
+}
+
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  hash_id hash_function,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  // the reordered table is scratch memory; only the packed buffers use the caller's resource
+  auto [partitioned_table, offsets] = detail::hash_partition(input,
+                                                             columns_to_hash,
+                                                             num_partitions,
+                                                             hash_function,
+                                                             seed,
+                                                             stream,
+                                                             rmm::mr::get_current_device_resource());
+  if (offsets.empty()) { return {}; }
+
+  // hash_partition returns the start offset of each partition; contiguous_split expects only
+  // the interior split points
+  std::vector<size_type> splits(offsets.begin() + 1, offsets.end());
+  return cudf::detail::contiguous_split(partitioned_table->view(), splits, stream, mr);
+}
+}  // namespace detail
+
+// Partition based on hash values
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
+  uint32_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition(
+    input, columns_to_hash, num_partitions, hash_function, seed, stream, mr);
+}
+
+// Partition rows by hash value and pack each partition into a contiguous buffer
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  hash_id hash_function,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition_and_pack(
+    input, columns_to_hash, num_partitions, hash_function, seed, stream, mr);
+}
+
+// Partition rows by hash value directly into caller-provided buffers
+std::vector<size_type> hash_partition_into(table_view const& input,
+                                           std::vector<size_type> const& columns_to_hash,
+                                           int num_partitions,
+                                           host_span<device_span<uint8_t> const> output_buffers,
+                                           hash_id hash_function,
+                                           uint32_t seed,
+                                           rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition_into(
+    input, columns_to_hash, num_partitions, output_buffers, hash_function, seed, stream);
+}
+
+// Partition based on sorted splitter values
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_partition,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  sorted is_input_sorted,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(input,
+                                 columns_to_partition,
+                                 splitters,
+                                 column_order,
+                                 null_precedence,
+                                 is_input_sorted,
+                                 stream,
+                                 mr);
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
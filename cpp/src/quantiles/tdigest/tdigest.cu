@@ -16,13 +16,19 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/tdigest/tdigest.hpp>
 #include <cudf/tdigest/tdigest_column_view.cuh>
 #include <cudf/types.hpp>
 
+#include <groupby/sort/group_reductions.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
@@ -307,6 +313,54 @@ std::unique_ptr<column> make_empty_tdigest_column(rmm::cuda_stream_view stream,
                              mr);
 }
 
+std::unique_ptr<column> create_tdigest(column_view const& input,
+                                       int max_centroids,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  if (input.size() == 0) { return make_empty_tdigest_column(stream, mr); }
+
+  // treat the entire column as a single group: sorted values with nulls last and one
+  // group spanning all rows, as the sort-based groupby would produce
+  auto const sorted = cudf::detail::sort(table_view({input}),
+                                         {order::ASCENDING},
+                                         {null_order::AFTER},
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+
+  std::vector<size_type> const h_offsets{0, input.size()};
+  std::vector<size_type> const h_valid_counts{input.size() - input.null_count()};
+  auto const group_offsets = cudf::detail::make_device_uvector_sync(h_offsets, stream);
+  auto const valid_counts  = cudf::detail::make_device_uvector_sync(h_valid_counts, stream);
+  rmm::device_uvector<size_type> group_labels(input.size(), stream);
+  thrust::fill(rmm::exec_policy(stream), group_labels.begin(), group_labels.end(), 0);
+
+  return cudf::groupby::detail::group_tdigest(sorted->view().column(0),
+                                              group_offsets,
+                                              group_labels,
+                                              valid_counts,
+                                              1,
+                                              max_centroids,
+                                              stream,
+                                              mr);
+}
+
+std::unique_ptr<column> merge_tdigests(cudf::tdigest::tdigest_column_view const& input,
+                                       int max_centroids,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  if (input.size() == 0) { return make_empty_tdigest_column(stream, mr); }
+
+  std::vector<size_type> const h_offsets{0, input.size()};
+  auto const group_offsets = cudf::detail::make_device_uvector_sync(h_offsets, stream);
+  rmm::device_uvector<size_type> group_labels(input.size(), stream);
+  thrust::fill(rmm::exec_policy(stream), group_labels.begin(), group_labels.end(), 0);
+
+  return cudf::groupby::detail::group_merge_tdigest(
+    input.parent(), group_offsets, group_labels, 1, max_centroids, stream, mr);
+}
+
 }  // namespace tdigest.
 
 std::unique_ptr<column> percentile_approx(tdigest_column_view const& input,
@@ -374,4 +428,22 @@ std::unique_ptr<column> percentile_approx(tdigest_column_view const& input,
   return percentile_approx(input, percentiles, rmm::cuda_stream_default, mr);
 }
 
+namespace tdigest {
+
+std::unique_ptr<column> create_tdigest(column_view const& input,
+                                       int max_centroids,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return detail::tdigest::create_tdigest(input, max_centroids, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> merge_tdigests(tdigest_column_view const& input,
+                                       int max_centroids,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return detail::tdigest::merge_tdigests(input, max_centroids, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace tdigest
+
 }  // namespace cudf
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Finds the index of the extreme valid element with a single
+ * thrust::min_element/max_element pass over the row indices.
+ *
+ * For a minimum search nulls order last so the winner is valid whenever any
+ * valid row exists; for a maximum search nulls order first for the same
+ * reason. Both thrust algorithms return the first extreme position, so ties
+ * resolve to the smallest index.
+ */
+struct arg_extremum_dispatcher {
+  template <typename T, std::enable_if_t<not cudf::is_relationally_comparable<T, T>()>* = nullptr>
+  size_type operator()(column_view const&, bool, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Column type is not relationally comparable.");
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_relationally_comparable<T, T>()>* = nullptr>
+  size_type operator()(column_view const& col, bool find_minimum, rmm::cuda_stream_view stream)
+  {
+    auto const d_col_ptr = column_device_view::create(col, stream);
+    auto const d_col     = *d_col_ptr;
+    auto const has_nulls = col.has_nulls();
+    auto const begin     = thrust::make_counting_iterator<size_type>(0);
+    auto const end       = thrust::make_counting_iterator<size_type>(col.size());
+
+    if (find_minimum) {
+      auto nulls_last = [d_col, has_nulls] __device__(size_type i, size_type j) {
+        bool const valid_i = not has_nulls or d_col.is_valid_nocheck(i);
+        bool const valid_j = not has_nulls or d_col.is_valid_nocheck(j);
+        if (valid_i and valid_j) { return d_col.element<T>(i) < d_col.element<T>(j); }
+        return valid_i and not valid_j;
+      };
+      return *thrust::min_element(rmm::exec_policy(stream), begin, end, nulls_last);
+    }
+
+    auto nulls_first = [d_col, has_nulls] __device__(size_type i, size_type j) {
+      bool const valid_i = not has_nulls or d_col.is_valid_nocheck(i);
+      bool const valid_j = not has_nulls or d_col.is_valid_nocheck(j);
+      if (valid_i and valid_j) { return d_col.element<T>(i) < d_col.element<T>(j); }
+      return not valid_i and valid_j;
+    };
+    return *thrust::max_element(rmm::exec_policy(stream), begin, end, nulls_first);
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+/**
+ * @brief Returns the index of the extreme valid element, or -1 if the column
+ * holds no valid rows.
+ */
+size_type arg_extremum(column_view const& col, bool find_minimum, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not cudf::is_dictionary(col.type()),
+               "Dictionary columns are not supported by argmin/argmax.");
+  if (col.size() == col.null_count()) { return -1; }
+  return type_dispatcher(col.type(), arg_extremum_dispatcher{}, col, find_minimum, stream);
+}
+
+std::unique_ptr<scalar> argmin(column_view const& col,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  auto const index = arg_extremum(col, true, stream);
+  return std::make_unique<numeric_scalar<size_type>>(
+    std::max(index, size_type{0}), index >= 0, stream, mr);
+}
+
+std::unique_ptr<scalar> argmax(column_view const& col,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  auto const index = arg_extremum(col, false, stream);
+  return std::make_unique<numeric_scalar<size_type>>(
+    std::max(index, size_type{0}), index >= 0, stream, mr);
+}
+
+/**
+ * @brief Gathers the single row selected by the extreme value of one column.
+ */
+std::unique_ptr<table> extremum_by(table_view const& input,
+                                   size_type value_column,
+                                   bool find_minimum,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(value_column >= 0 and value_column < input.num_columns(),
+               "value_column index is out of range.");
+
+  auto const index = arg_extremum(input.column(value_column), find_minimum, stream);
+  if (index < 0) { return empty_like(input); }
+
+  auto const map = thrust::make_constant_iterator<size_type>(index);
+  return detail::gather(input, map, map + 1, out_of_bounds_policy::DONT_CHECK, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<scalar> argmin(column_view const& col, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::argmin(col, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<scalar> argmax(column_view const& col, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::argmax(col, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> min_by(table_view const& input,
+                              size_type value_column,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extremum_by(input, value_column, true, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> max_by(table_view const& input,
+                              size_type value_column,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extremum_by(input, value_column, false, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cub/block/block_reduce.cuh>
+
+#include <thrust/functional.h>
+
+namespace cudf {
+namespace reduction {
+namespace batched {
+namespace {
+
+constexpr size_type block_size = 256;
+
+/**
+ * @brief Reduces every column of a table in a single launch.
+ *
+ * Thread block `b` owns column `b`: its threads accumulate the column in a
+ * block-stride loop and combine their partials with one block reduction, so no
+ * inter-block communication or per-column scratch allocation is needed. Null
+ * elements are skipped; a column with no valid rows reports itself invalid so
+ * the host can null its output row.
+ */
+template <typename ElementType, typename Op>
+__global__ void __launch_bounds__(block_size)
+  batched_reduce_kernel(table_device_view d_table, ElementType* d_results, bool* d_valid)
+{
+  using block_reduce = cub::BlockReduce<ElementType, block_size>;
+  using block_count  = cub::BlockReduce<size_type, block_size>;
+  __shared__ union {
+    typename block_reduce::TempStorage reduce;
+    typename block_count::TempStorage count;
+  } temp_storage;
+
+  auto const col       = d_table.column(blockIdx.x);
+  auto simple_op       = Op{};
+  auto const binary_op = simple_op.get_binary_op();
+
+  ElementType accum = simple_op.template get_identity<ElementType>();
+  size_type valid   = 0;
+  for (size_type row = threadIdx.x; row < col.size(); row += block_size) {
+    if (col.is_valid(row)) {
+      accum = binary_op(accum, col.element<ElementType>(row));
+      ++valid;
+    }
+  }
+  auto const result = block_reduce(temp_storage.reduce).Reduce(accum, binary_op);
+  __syncthreads();
+  auto const valid_count = block_count(temp_storage.count).Sum(valid);
+  if (threadIdx.x == 0) {
+    d_results[blockIdx.x] = result;
+    d_valid[blockIdx.x]   = valid_count > 0;
+  }
+}
+
+/**
+ * @brief Dispatcher for operations whose output type matches the input type.
+ *
+ * This is used by operations `sum()`, `product()`, `min()` and `max()`.
+ *
+ * @tparam Op The reduce operation to execute on each column.
+ */
+template <typename Op>
+struct batched_reduce_dispatcher {
+  template <typename ElementType,
+            std::enable_if_t<std::is_arithmetic<ElementType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(table_view const& input,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const num_columns = input.num_columns();
+    auto result            = make_fixed_width_column(
+      input.column(0).type(), num_columns, mask_state::UNALLOCATED, stream, mr);
+
+    auto const d_table = table_device_view::create(input, stream);
+    rmm::device_uvector<bool> d_valid(num_columns, stream);
+    batched_reduce_kernel<ElementType, Op><<<num_columns, block_size, 0, stream.value()>>>(
+      *d_table, result->mutable_view().template data<ElementType>(), d_valid.data());
+
+    auto [null_mask, null_count] =
+      cudf::detail::valid_if(d_valid.begin(), d_valid.end(), thrust::identity<bool>{}, stream, mr);
+    if (null_count > 0) { result->set_null_mask(std::move(null_mask), null_count); }
+    return result;
+  }
+
+  template <typename ElementType,
+            std::enable_if_t<not std::is_arithmetic<ElementType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(table_view const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Batched reduction operator not supported for this type");
+  }
+};
+
+}  // namespace
+}  // namespace batched
+}  // namespace reduction
+
+namespace detail {
+
+std::unique_ptr<column> batched_reduce(table_view const& input,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       data_type output_dtype,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.num_columns() > 0, "Batched reduction input must have at least one column");
+  auto const common_type = input.column(0).type();
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [common_type](auto const& col) { return col.type() == common_type; }),
+               "Batched reduction requires all columns to have the same type");
+  CUDF_EXPECTS(output_dtype == common_type,
+               "Batched reduction output type must match the input type");
+
+  using namespace cudf::reduction;
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return type_dispatcher(
+        common_type, batched::batched_reduce_dispatcher<op::sum>{}, input, stream, mr);
+    case aggregation::PRODUCT:
+      return type_dispatcher(
+        common_type, batched::batched_reduce_dispatcher<op::product>{}, input, stream, mr);
+    case aggregation::MIN:
+      return type_dispatcher(
+        common_type, batched::batched_reduce_dispatcher<op::min>{}, input, stream, mr);
+    case aggregation::MAX:
+      return type_dispatcher(
+        common_type, batched::batched_reduce_dispatcher<op::max>{}, input, stream, mr);
+    default: CUDF_FAIL("Unsupported batched reduction operator");
+  }
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> batched_reduce(table_view const& input,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       data_type output_dtype,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_reduce(input, agg, output_dtype, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,18 +17,63 @@
 
 #include <cudf/detail/reduction_functions.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <reductions/compound.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
 
+namespace {
+
+/**
+ * @brief Computes the mean of a fixed_point column as its sum over its valid count.
+ *
+ * The sum is computed with the fixed_point sum reduction and the single
+ * division is performed on the host since only one element is involved.
+ *
+ * @tparam DecimalXX The fixed_point type of the input column
+ */
+template <typename DecimalXX>
+std::unique_ptr<cudf::scalar> fixed_point_mean(cudf::column_view const& col,
+                                               cudf::data_type const output_dtype,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  using namespace numeric;
+  auto const valid_count = static_cast<int32_t>(col.size() - col.null_count());
+  if (valid_count == 0) { return cudf::make_default_constructed_scalar(output_dtype, stream, mr); }
+
+  auto const sum_result =
+    cudf::reduction::sum(col, col.type(), stream, rmm::mr::get_current_device_resource());
+  auto const sum =
+    static_cast<cudf::fixed_point_scalar<DecimalXX>*>(sum_result.get())->fixed_point_value(stream);
+  auto const mean =
+    (sum / DecimalXX{valid_count, scale_type{0}}).rescaled(scale_type{output_dtype.scale()});
+  return cudf::make_fixed_point_scalar<DecimalXX>(
+    mean.value(), scale_type{output_dtype.scale()}, stream, mr);
+}
+
+}  // namespace
+
 std::unique_ptr<cudf::scalar> cudf::reduction::mean(column_view const& col,
                                                     cudf::data_type const output_dtype,
                                                     rmm::cuda_stream_view stream,
                                                     rmm::mr::device_memory_resource* mr)
 {
-  using reducer = cudf::reduction::compound::element_type_dispatcher<cudf::reduction::op::mean>;
   auto col_type =
     cudf::is_dictionary(col.type()) ? dictionary_column_view(col).keys().type() : col.type();
+
+  if (cudf::is_fixed_point(col_type)) {
+    CUDF_EXPECTS(col_type.id() == output_dtype.id(),
+                 "Mean of a fixed_point column requires the matching fixed_point output type");
+    return col_type.id() == type_id::DECIMAL32
+             ? fixed_point_mean<numeric::decimal32>(col, output_dtype, stream, mr)
+             : fixed_point_mean<numeric::decimal64>(col, output_dtype, stream, mr);
+  }
+
+  using reducer = cudf::reduction::compound::element_type_dispatcher<cudf::reduction::op::mean>;
   return cudf::type_dispatcher(
     col_type, reducer(), col, output_dtype, /* ddof is not used for mean*/ 1, stream, mr);
 }
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Indicates whether an aggregation kind has an accumulator that can be
+ * carried in the shared single-pass state.
+ */
+bool is_fusible_kind(aggregation::Kind k)
+{
+  return k == aggregation::MIN or k == aggregation::MAX or k == aggregation::SUM or
+         k == aggregation::SUM_OF_SQUARES or k == aggregation::MEAN;
+}
+
+/**
+ * @brief Per-thread state carrying all fusible accumulators at once.
+ *
+ * One instance is produced per element and instances are combined member-wise,
+ * so a single `transform_reduce` pass yields every fused result.
+ */
+template <typename T>
+struct fused_accumulator {
+  using sum_type = cudf::detail::target_type_t<T, aggregation::SUM>;
+
+  T min;
+  T max;
+  sum_type sum;
+  sum_type sum_of_squares;
+  size_type valid_count;
+
+  static constexpr fused_accumulator identity()
+  {
+    return {DeviceMin::identity<T>(), DeviceMax::identity<T>(), sum_type{0}, sum_type{0}, 0};
+  }
+};
+
+template <typename T>
+struct fused_transform_fn {
+  column_device_view const d_col;
+  bool const has_nulls;
+
+  __device__ fused_accumulator<T> operator()(size_type i) const
+  {
+    if (has_nulls and d_col.is_null_nocheck(i)) { return fused_accumulator<T>::identity(); }
+    auto const value   = d_col.element<T>(i);
+    auto const promoted = static_cast<typename fused_accumulator<T>::sum_type>(value);
+    return {value, value, promoted, promoted * promoted, 1};
+  }
+};
+
+template <typename T>
+struct fused_combine_fn {
+  __device__ fused_accumulator<T> operator()(fused_accumulator<T> const& lhs,
+                                             fused_accumulator<T> const& rhs) const
+  {
+    return {DeviceMin{}(lhs.min, rhs.min),
+            DeviceMax{}(lhs.max, rhs.max),
+            lhs.sum + rhs.sum,
+            lhs.sum_of_squares + rhs.sum_of_squares,
+            lhs.valid_count + rhs.valid_count};
+  }
+};
+
+/**
+ * @brief Computes all fusible aggregations over `col` in one pass, filling the
+ * corresponding entries of `results` and leaving the others null.
+ *
+ * An aggregation participates in the fused pass only if its requested output
+ * type matches the type its shared accumulator produces; otherwise it is left
+ * for the per-aggregation fallback, which handles output type conversions.
+ */
+struct fused_reduce_functor {
+  template <typename T, CUDF_ENABLE_IF(std::is_arithmetic_v<T> and not std::is_same_v<T, bool>)>
+  void operator()(column_view const& col,
+                  std::vector<std::unique_ptr<aggregation>> const& aggs,
+                  std::vector<data_type> const& output_dtypes,
+                  std::vector<std::unique_ptr<scalar>>& results,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr)
+  {
+    using sum_type           = typename fused_accumulator<T>::sum_type;
+    auto const sum_dtype     = data_type{type_to_id<sum_type>()};
+    auto const output_fusible = [&](size_type i) {
+      switch (aggs[i]->kind) {
+        case aggregation::MIN:
+        case aggregation::MAX: return output_dtypes[i] == col.type();
+        case aggregation::SUM:
+        case aggregation::SUM_OF_SQUARES: return output_dtypes[i] == sum_dtype;
+        case aggregation::MEAN:
+          return output_dtypes[i].id() == type_id::FLOAT32 or
+                 output_dtypes[i].id() == type_id::FLOAT64;
+        default: return false;
+      }
+    };
+
+    std::vector<size_type> fused_indices;
+    for (size_type i = 0; i < static_cast<size_type>(aggs.size()); ++i) {
+      if (is_fusible_kind(aggs[i]->kind) and output_fusible(i)) { fused_indices.push_back(i); }
+    }
+    // A shared pass only pays for itself when at least two aggregations use it
+    if (fused_indices.size() < 2) { return; }
+
+    auto const d_col = column_device_view::create(col, stream);
+    auto const accum =
+      thrust::transform_reduce(rmm::exec_policy(stream),
+                               thrust::make_counting_iterator<size_type>(0),
+                               thrust::make_counting_iterator<size_type>(col.size()),
+                               fused_transform_fn<T>{*d_col, col.has_nulls()},
+                               fused_accumulator<T>::identity(),
+                               fused_combine_fn<T>{});
+
+    for (auto const i : fused_indices) {
+      switch (aggs[i]->kind) {
+        case aggregation::MIN: results[i] = make_fixed_width_scalar<T>(accum.min, stream, mr); break;
+        case aggregation::MAX: results[i] = make_fixed_width_scalar<T>(accum.max, stream, mr); break;
+        case aggregation::SUM:
+          results[i] = make_fixed_width_scalar<sum_type>(accum.sum, stream, mr);
+          break;
+        case aggregation::SUM_OF_SQUARES:
+          results[i] = make_fixed_width_scalar<sum_type>(accum.sum_of_squares, stream, mr);
+          break;
+        case aggregation::MEAN: {
+          auto const mean = static_cast<double>(accum.sum) / accum.valid_count;
+          results[i]      = output_dtypes[i].id() == type_id::FLOAT32
+                              ? make_fixed_width_scalar<float>(static_cast<float>(mean), stream, mr)
+                              : make_fixed_width_scalar<double>(mean, stream, mr);
+        } break;
+        default: CUDF_FAIL("Unexpected aggregation kind in fused reduction");
+      }
+    }
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not std::is_arithmetic_v<T> or std::is_same_v<T, bool>)>
+  void operator()(column_view const&,
+                  std::vector<std::unique_ptr<aggregation>> const&,
+                  std::vector<data_type> const&,
+                  std::vector<std::unique_ptr<scalar>>&,
+                  rmm::cuda_stream_view,
+                  rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Fused reduction is restricted to non-boolean arithmetic types");
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> reduce_multi(
+  column_view const& col,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  std::vector<data_type> const& output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(aggs.size() == output_dtypes.size(),
+               "Number of aggregations and output types must match");
+
+  std::vector<std::unique_ptr<scalar>> results(aggs.size());
+
+  // Restricting the fused pass to non-boolean arithmetic columns keeps its
+  // accumulator promotion rules identical to the single-aggregation kernels
+  auto const fusible_column = col.size() > col.null_count() and
+                              cudf::is_numeric(col.type()) and col.type().id() != type_id::BOOL8;
+  if (fusible_column) {
+    type_dispatcher(
+      col.type(), fused_reduce_functor{}, col, aggs, output_dtypes, results, stream, mr);
+  }
+
+  // Everything the fused pass did not cover falls back to a plain reduction
+  for (size_t i = 0; i < aggs.size(); ++i) {
+    if (results[i] == nullptr) { results[i] = reduce(col, aggs[i], output_dtypes[i], stream, mr); }
+  }
+  return results;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<scalar>> reduce_multi(
+  column_view const& col,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  std::vector<data_type> const& output_dtypes,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce_multi(col, aggs, output_dtypes, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -123,5 +123,29 @@ std::unique_ptr<column> inclusive_rank_scan(column_view const& order_by,
     mr);
 }
 
+std::unique_ptr<column> inclusive_percent_rank_scan(column_view const& order_by,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const ranks =
+    inclusive_rank_scan(order_by, stream, rmm::mr::get_current_device_resource());
+  auto const num_rows = order_by.size();
+  auto percent_ranks  = make_fixed_width_column(
+    data_type{type_to_id<double>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+
+  thrust::tabulate(rmm::exec_policy(stream),
+                   percent_ranks->mutable_view().begin<double>(),
+                   percent_ranks->mutable_view().end<double>(),
+                   [d_ranks = ranks->view().begin<size_type>(), num_rows] __device__(
+                     size_type row_index) {
+                     // a single-row column ranks as 0 rather than dividing by zero
+                     return num_rows == 1
+                              ? 0.0
+                              : (d_ranks[row_index] - 1) / static_cast<double>(num_rows - 1);
+                   });
+
+  return percent_ranks;
+}
+
 }  // namespace detail
 }  // namespace cudf
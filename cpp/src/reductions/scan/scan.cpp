@@ -19,6 +19,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scan.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -42,10 +43,27 @@ std::unique_ptr<column> scan(column_view const& input,
                  "Unsupported dense rank aggregation operator for exclusive scan");
     return inclusive_dense_rank_scan(input, rmm::cuda_stream_default, mr);
   }
+  if (agg->kind == aggregation::PERCENT_RANK) {
+    CUDF_EXPECTS(inclusive == scan_type::INCLUSIVE,
+                 "Unsupported percent rank aggregation operator for exclusive scan");
+    return inclusive_percent_rank_scan(input, rmm::cuda_stream_default, mr);
+  }
 
   return inclusive == scan_type::EXCLUSIVE
            ? detail::scan_exclusive(input, agg, null_handling, rmm::cuda_stream_default, mr)
            : detail::scan_inclusive(input, agg, null_handling, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> scan_by_key(column_view const& values,
+                                    table_view const& keys,
+                                    std::unique_ptr<aggregation> const& agg,
+                                    scan_type inclusive,
+                                    null_policy null_handling,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::scan_by_key(
+    values, keys, agg, inclusive, null_handling, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scan.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/scan.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Scans the values of one column segmented by runs of equal key rows.
+ *
+ * The keys are compared through a row comparator over counting iterators, so
+ * multi-column and nullable keys need no materialized key sequence. Rows with
+ * equal keys that are not adjacent belong to different segments; the caller is
+ * expected to provide key-clustered data.
+ *
+ * @tparam Op The scan operation to execute within each segment
+ */
+template <typename Op, typename T>
+struct scan_by_key_functor {
+  template <typename KeyComparator>
+  static std::unique_ptr<column> scan_values(column_view const& values,
+                                             KeyComparator comp,
+                                             scan_type inclusive,
+                                             null_policy null_handling,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+  {
+    auto const num_rows = values.size();
+    auto output_column =
+      detail::allocate_like(values, num_rows, mask_allocation_policy::NEVER, stream, mr);
+    mutable_column_view result = output_column->mutable_view();
+
+    auto d_values = column_device_view::create(values, stream);
+    auto const begin =
+      make_null_replacement_iterator(*d_values, Op::template identity<T>(), values.has_nulls());
+    auto const keys_it = thrust::make_counting_iterator<size_type>(0);
+
+    if (inclusive == scan_type::INCLUSIVE) {
+      thrust::inclusive_scan_by_key(
+        rmm::exec_policy(stream), keys_it, keys_it + num_rows, begin, result.data<T>(), comp, Op{});
+    } else {
+      thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                    keys_it,
+                                    keys_it + num_rows,
+                                    begin,
+                                    result.data<T>(),
+                                    Op::template identity<T>(),
+                                    comp,
+                                    Op{});
+    }
+
+    auto [mask, null_count] = [&] {
+      if (null_handling == null_policy::EXCLUDE or not values.has_nulls()) {
+        return std::make_pair(detail::copy_bitmask(values, stream, mr), values.null_count());
+      }
+      // with INCLUDE, a null poisons the rest of its segment: and-scan the
+      // validity bits within each segment
+      auto group_valid    = rmm::device_uvector<bool>(num_rows, stream);
+      auto const valid_it = detail::make_validity_iterator(*d_values);
+      if (inclusive == scan_type::INCLUSIVE) {
+        thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                      keys_it,
+                                      keys_it + num_rows,
+                                      valid_it,
+                                      group_valid.begin(),
+                                      comp,
+                                      thrust::logical_and<bool>{});
+      } else {
+        thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                      keys_it,
+                                      keys_it + num_rows,
+                                      valid_it,
+                                      group_valid.begin(),
+                                      true,
+                                      comp,
+                                      thrust::logical_and<bool>{});
+      }
+      return cudf::detail::valid_if(
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(num_rows),
+        [d_valid = group_valid.data()] __device__(size_type i) { return d_valid[i]; },
+        stream,
+        mr);
+    }();
+    output_column->set_null_mask(std::move(mask), null_count);
+
+    CHECK_CUDA(stream.value());
+    return output_column;
+  }
+};
+
+/**
+ * @brief Dispatches the scan value type, routing unsupported types to CUDF_FAIL.
+ *
+ * @tparam Op The scan operation to execute within each segment
+ */
+template <typename Op>
+struct scan_by_key_dispatcher {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     table_view const& keys,
+                                     scan_type inclusive,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto d_keys = table_device_view::create(keys, stream);
+    if (cudf::has_nulls(keys)) {
+      // null keys compare equal to each other, so an adjacent run of null-key
+      // rows forms a single segment, matching groupby's treatment of null keys
+      return scan_by_key_functor<Op, T>::scan_values(
+        values, row_equality_comparator<true>{*d_keys, *d_keys, true}, inclusive, null_handling,
+        stream, mr);
+    }
+    return scan_by_key_functor<Op, T>::scan_values(
+      values, row_equality_comparator<false>{*d_keys, *d_keys, true}, inclusive, null_handling,
+      stream, mr);
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     table_view const&,
+                                     scan_type,
+                                     null_policy,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for scan_by_key");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> scan_by_key(column_view const& values,
+                                    table_view const& keys,
+                                    std::unique_ptr<aggregation> const& agg,
+                                    scan_type inclusive,
+                                    null_policy null_handling,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(values.size() == keys.num_rows(), "Mismatch in number of rows of values and keys");
+  CUDF_EXPECTS(keys.num_columns() > 0, "Keys table cannot be empty");
+
+  if (values.is_empty()) { return empty_like(values); }
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return type_dispatcher<dispatch_storage_type>(values.type(),
+                                                    scan_by_key_dispatcher<DeviceSum>{},
+                                                    values,
+                                                    keys,
+                                                    inclusive,
+                                                    null_handling,
+                                                    stream,
+                                                    mr);
+    case aggregation::MIN:
+      return type_dispatcher<dispatch_storage_type>(values.type(),
+                                                    scan_by_key_dispatcher<DeviceMin>{},
+                                                    values,
+                                                    keys,
+                                                    inclusive,
+                                                    null_handling,
+                                                    stream,
+                                                    mr);
+    case aggregation::MAX:
+      return type_dispatcher<dispatch_storage_type>(values.type(),
+                                                    scan_by_key_dispatcher<DeviceMax>{},
+                                                    values,
+                                                    keys,
+                                                    inclusive,
+                                                    null_handling,
+                                                    stream,
+                                                    mr);
+    case aggregation::PRODUCT:
+      return type_dispatcher<dispatch_storage_type>(values.type(),
+                                                    scan_by_key_dispatcher<DeviceProduct>{},
+                                                    values,
+                                                    keys,
+                                                    inclusive,
+                                                    null_handling,
+                                                    stream,
+                                                    mr);
+    default: CUDF_FAIL("Unsupported aggregation operator for scan_by_key");
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
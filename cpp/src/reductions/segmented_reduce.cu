@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cub/device/device_segmented_reduce.cuh>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace reduction {
+namespace segmented {
+namespace {
+
+/**
+ * @brief Runs a cub segmented reduction: one call to size the scratch space
+ * and a second to compute the per-segment results.
+ */
+template <typename InputIterator, typename OutputIterator, typename BinaryOp, typename IdentityType>
+void cub_segmented_reduce(InputIterator d_in,
+                          OutputIterator d_out,
+                          size_type num_segments,
+                          size_type const* d_offsets,
+                          BinaryOp binary_op,
+                          IdentityType identity,
+                          rmm::cuda_stream_view stream)
+{
+  std::size_t temp_bytes = 0;
+  CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(nullptr,
+                                              temp_bytes,
+                                              d_in,
+                                              d_out,
+                                              num_segments,
+                                              d_offsets,
+                                              d_offsets + 1,
+                                              binary_op,
+                                              identity,
+                                              stream.value()));
+  auto d_temp = rmm::device_buffer{temp_bytes, stream};
+  CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(d_temp.data(),
+                                              temp_bytes,
+                                              d_in,
+                                              d_out,
+                                              num_segments,
+                                              d_offsets,
+                                              d_offsets + 1,
+                                              binary_op,
+                                              identity,
+                                              stream.value()));
+}
+
+/**
+ * @brief Computes the output null mask: empty segments produce null results
+ * and, with null_policy::INCLUDE, so does any segment containing a null.
+ */
+std::pair<rmm::device_buffer, size_type> segment_null_mask(column_view const& values,
+                                                           column_view const& offsets,
+                                                           size_type num_segments,
+                                                           null_policy null_handling,
+                                                           rmm::cuda_stream_view stream,
+                                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const d_offsets = offsets.begin<size_type>();
+  if (null_handling == null_policy::INCLUDE and values.has_nulls()) {
+    auto dcol = column_device_view::create(values, stream);
+    auto valid_counts = rmm::device_uvector<size_type>(num_segments, stream);
+    auto valid_it     = thrust::make_transform_iterator(
+      cudf::detail::make_validity_iterator(*dcol), thrust::identity<size_type>{});
+    cub_segmented_reduce(
+      valid_it, valid_counts.begin(), num_segments, d_offsets, cub::Sum{}, size_type{0}, stream);
+    return cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_segments),
+      [d_offsets, d_counts = valid_counts.data()] __device__(size_type i) {
+        return d_counts[i] == d_offsets[i + 1] - d_offsets[i] and d_offsets[i + 1] > d_offsets[i];
+      },
+      stream,
+      mr);
+  }
+  return cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_segments),
+    [d_offsets] __device__(size_type i) { return d_offsets[i + 1] > d_offsets[i]; },
+    stream,
+    mr);
+}
+
+/**
+ * @brief Segmented reduction for 'sum', 'product', 'min', 'max', 'any' and 'all'
+ * which map directly onto a single cub::DeviceSegmentedReduce call.
+ *
+ * Null elements are replaced with the operator's identity so they never
+ * contribute to a segment's result; `segment_null_mask` decides whether their
+ * presence nullifies the result instead.
+ *
+ * @tparam ElementType the input column data-type
+ * @tparam ResultType  the output column data-type
+ * @tparam Op          the operator of cudf::reduction::op::
+ */
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<column> simple_segmented_reduction(column_view const& values,
+                                                   column_view const& offsets,
+                                                   null_policy null_handling,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  auto const num_segments = offsets.size() - 1;
+  auto const d_offsets    = offsets.begin<size_type>();
+  auto simple_op          = Op{};
+  auto const binary_op    = simple_op.get_binary_op();
+  auto const identity     = simple_op.template get_identity<ResultType>();
+
+  auto [null_mask, null_count] =
+    segment_null_mask(values, offsets, num_segments, null_handling, stream, mr);
+  auto result = make_fixed_width_column(data_type{type_to_id<ResultType>()},
+                                        num_segments,
+                                        std::move(null_mask),
+                                        null_count,
+                                        stream,
+                                        mr);
+
+  auto dcol      = cudf::column_device_view::create(values, stream);
+  auto const out = result->mutable_view().template data<ResultType>();
+  if (values.has_nulls()) {
+    auto f  = simple_op.template get_null_replacing_element_transformer<ResultType>();
+    auto it = thrust::make_transform_iterator(dcol->pair_begin<ElementType, true>(), f);
+    cub_segmented_reduce(it, out, num_segments, d_offsets, binary_op, identity, stream);
+  } else {
+    auto f  = simple_op.template get_element_transformer<ResultType>();
+    auto it = thrust::make_transform_iterator(dcol->begin<ElementType>(), f);
+    cub_segmented_reduce(it, out, num_segments, d_offsets, binary_op, identity, stream);
+  }
+  return result;
+}
+
+/**
+ * @brief Dispatcher for operations whose output type matches the input type.
+ *
+ * This is used by operations `sum()`, `product()`, `min()` and `max()`.
+ *
+ * @tparam Op The reduce operation to execute on each segment.
+ */
+template <typename Op>
+struct same_type_segmented_dispatcher {
+  template <typename ElementType,
+            std::enable_if_t<std::is_arithmetic<ElementType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     column_view const& offsets,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return simple_segmented_reduction<ElementType, ElementType, Op>(
+      values, offsets, null_handling, stream, mr);
+  }
+
+  template <typename ElementType,
+            std::enable_if_t<not std::is_arithmetic<ElementType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     column_view const&,
+                                     null_policy,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Segmented reduction operator not supported for this type");
+  }
+};
+
+/**
+ * @brief Dispatcher for operations returning a column of type bool.
+ *
+ * This is used by operations `any()` and `all()`.
+ *
+ * @tparam Op The reduce operation to execute on each segment.
+ */
+template <typename Op>
+struct bool_result_segmented_dispatcher {
+  template <typename ElementType,
+            std::enable_if_t<std::is_arithmetic<ElementType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     column_view const& offsets,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return simple_segmented_reduction<ElementType, bool, Op>(
+      values, offsets, null_handling, stream, mr);
+  }
+
+  template <typename ElementType,
+            std::enable_if_t<not std::is_arithmetic<ElementType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     column_view const&,
+                                     null_policy,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Segmented reduction operator not supported for this type");
+  }
+};
+
+}  // namespace
+}  // namespace segmented
+}  // namespace reduction
+
+namespace detail {
+
+std::unique_ptr<column> segmented_reduce(column_view const& values,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(offsets.size() > 0, "Segment offsets cannot be empty");
+  CUDF_EXPECTS(not offsets.has_nulls(), "Segment offsets cannot contain nulls");
+  CUDF_EXPECTS(offsets.type().id() == type_to_id<size_type>(),
+               "Segment offsets must be of INT32 type");
+
+  using namespace cudf::reduction;
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      CUDF_EXPECTS(output_dtype == values.type(),
+                   "Segmented reduction output type must match the input type");
+      return type_dispatcher(values.type(),
+                             segmented::same_type_segmented_dispatcher<op::sum>{},
+                             values,
+                             offsets,
+                             null_handling,
+                             stream,
+                             mr);
+    case aggregation::PRODUCT:
+      CUDF_EXPECTS(output_dtype == values.type(),
+                   "Segmented reduction output type must match the input type");
+      return type_dispatcher(values.type(),
+                             segmented::same_type_segmented_dispatcher<op::product>{},
+                             values,
+                             offsets,
+                             null_handling,
+                             stream,
+                             mr);
+    case aggregation::MIN:
+      CUDF_EXPECTS(output_dtype == values.type(),
+                   "Segmented reduction output type must match the input type");
+      return type_dispatcher(values.type(),
+                             segmented::same_type_segmented_dispatcher<op::min>{},
+                             values,
+                             offsets,
+                             null_handling,
+                             stream,
+                             mr);
+    case aggregation::MAX:
+      CUDF_EXPECTS(output_dtype == values.type(),
+                   "Segmented reduction output type must match the input type");
+      return type_dispatcher(values.type(),
+                             segmented::same_type_segmented_dispatcher<op::max>{},
+                             values,
+                             offsets,
+                             null_handling,
+                             stream,
+                             mr);
+    case aggregation::ANY:
+      CUDF_EXPECTS(output_dtype == data_type{type_id::BOOL8},
+                   "Output type for any() must be bool type");
+      return type_dispatcher(values.type(),
+                             segmented::bool_result_segmented_dispatcher<op::max>{},
+                             values,
+                             offsets,
+                             null_handling,
+                             stream,
+                             mr);
+    case aggregation::ALL:
+      CUDF_EXPECTS(output_dtype == data_type{type_id::BOOL8},
+                   "Output type for all() must be bool type");
+      return type_dispatcher(values.type(),
+                             segmented::bool_result_segmented_dispatcher<op::min>{},
+                             values,
+                             offsets,
+                             null_handling,
+                             stream,
+                             mr);
+    default: CUDF_FAIL("Unsupported segmented reduction operator");
+  }
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_reduce(column_view const& values,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(
+    values, offsets, agg, output_dtype, null_handling, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
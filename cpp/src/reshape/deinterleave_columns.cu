@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+namespace cudf {
+namespace detail {
+namespace {
+// Error case when no other overload or specialization is available
+template <typename T, typename Enable = void>
+struct deinterleave_columns_impl {
+  template <typename... Args>
+  std::vector<std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported type in `deinterleave_columns`.");
+  }
+};
+
+struct deinterleave_columns_functor {
+  template <typename T>
+  std::vector<std::unique_ptr<cudf::column>> operator()(column_view const& input,
+                                                        size_type num_columns,
+                                                        bool create_mask,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+  {
+    return deinterleave_columns_impl<T>{}(input, num_columns, create_mask, stream, mr);
+  }
+};
+
+template <typename T>
+struct deinterleave_columns_impl<T,
+                                 typename std::enable_if_t<std::is_same_v<T, cudf::string_view>>> {
+  std::vector<std::unique_ptr<cudf::column>> operator()(column_view const& strings_column,
+                                                        size_type num_columns,
+                                                        bool create_mask,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+  {
+    auto const strings_count = strings_column.size() / num_columns;
+
+    auto const d_column_ptr = column_device_view::create(strings_column, stream);
+    auto const d_column     = *d_column_ptr;
+
+    std::vector<std::unique_ptr<column>> results;
+    results.reserve(num_columns);
+    for (size_type col_idx = 0; col_idx < num_columns; ++col_idx) {
+      if (strings_count == 0) {  // All output columns have 0 rows
+        results.push_back(make_empty_column(type_id::STRING));
+        continue;
+      }
+
+      std::pair<rmm::device_buffer, size_type> valid_mask{};
+      if (create_mask) {
+        // Create resulting null mask
+        valid_mask = cudf::detail::valid_if(
+          thrust::make_counting_iterator<size_type>(0),
+          thrust::make_counting_iterator<size_type>(strings_count),
+          [d_column, num_columns, col_idx] __device__(size_type idx) {
+            return !d_column.is_null(idx * num_columns + col_idx);
+          },
+          stream,
+          mr);
+      }
+
+      auto const null_count = valid_mask.second;
+
+      // Build offsets column by computing sizes of each string in the output
+      auto offsets_transformer = [d_column, num_columns, col_idx] __device__(size_type idx) {
+        auto const source_idx = idx * num_columns + col_idx;
+        return d_column.is_valid(source_idx)
+                 ? d_column.element<string_view>(source_idx).size_bytes()
+                 : 0;
+      };
+      auto offsets_transformer_itr = thrust::make_transform_iterator(
+        thrust::make_counting_iterator<size_type>(0), offsets_transformer);
+      auto offsets_column = strings::detail::make_offsets_child_column(
+        offsets_transformer_itr, offsets_transformer_itr + strings_count, stream, mr);
+      auto d_results_offsets = offsets_column->view().template data<int32_t>();
+
+      // Create the chars column
+      auto const bytes =
+        cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
+      auto chars_column = strings::detail::create_chars_child_column(bytes, stream, mr);
+      // Fill the chars column
+      auto d_results_chars = chars_column->mutable_view().template data<char>();
+      thrust::for_each_n(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        strings_count,
+        [d_column, num_columns, col_idx, d_results_offsets, d_results_chars] __device__(
+          size_type idx) {
+          auto const source_idx = idx * num_columns + col_idx;
+
+          // Do not write to buffer if the column value for this row is null
+          if (d_column.is_null(source_idx)) return;
+
+          size_type offset = d_results_offsets[idx];
+          char* d_buffer   = d_results_chars + offset;
+          strings::detail::copy_string(d_buffer, d_column.element<string_view>(source_idx));
+        });
+
+      results.push_back(make_strings_column(strings_count,
+                                            std::move(offsets_column),
+                                            std::move(chars_column),
+                                            null_count,
+                                            std::move(valid_mask.first)));
+    }
+
+    return results;
+  }
+};
+
+template <typename T>
+struct deinterleave_columns_impl<T, typename std::enable_if_t<cudf::is_fixed_width<T>()>> {
+  std::vector<std::unique_ptr<cudf::column>> operator()(column_view const& input,
+                                                        size_type num_columns,
+                                                        bool create_mask,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+  {
+    auto const output_size = input.size() / num_columns;
+    auto device_input      = column_device_view::create(input, stream);
+    auto index_begin       = thrust::make_counting_iterator<size_type>(0);
+    auto index_end         = thrust::make_counting_iterator<size_type>(output_size);
+
+    std::vector<std::unique_ptr<column>> results;
+    results.reserve(num_columns);
+    for (size_type col_idx = 0; col_idx < num_columns; ++col_idx) {
+      auto output =
+        allocate_like(input, output_size, mask_allocation_policy::NEVER, stream, mr);
+      auto device_output = mutable_column_device_view::create(*output);
+
+      auto func_value = [input = *device_input, num_columns, col_idx] __device__(size_type idx) {
+        return input.element<T>(idx * num_columns + col_idx);
+      };
+
+      if (not create_mask) {
+        thrust::transform(
+          rmm::exec_policy(stream), index_begin, index_end, device_output->begin<T>(), func_value);
+
+        results.push_back(std::move(output));
+        continue;
+      }
+
+      auto func_validity = [input = *device_input, num_columns, col_idx] __device__(
+                             size_type idx) {
+        return input.is_valid(idx * num_columns + col_idx);
+      };
+
+      thrust::transform_if(rmm::exec_policy(stream),
+                           index_begin,
+                           index_end,
+                           device_output->begin<T>(),
+                           func_value,
+                           func_validity);
+
+      rmm::device_buffer mask;
+      size_type null_count;
+
+      std::tie(mask, null_count) = valid_if(index_begin, index_end, func_validity, stream, mr);
+
+      output->set_null_mask(std::move(mask), null_count);
+
+      results.push_back(std::move(output));
+    }
+
+    return results;
+  }
+};
+
+}  // anonymous namespace
+
+std::unique_ptr<table> deinterleave_columns(column_view const& input,
+                                            size_type num_columns,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_columns > 0, "Number of output columns must be positive");
+  CUDF_EXPECTS(input.size() % num_columns == 0,
+               "Input column size must be divisible by the number of output columns");
+
+  auto columns = type_dispatcher<dispatch_storage_type>(input.type(),
+                                                        detail::deinterleave_columns_functor{},
+                                                        input,
+                                                        num_columns,
+                                                        input.nullable(),
+                                                        stream,
+                                                        mr);
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> deinterleave_columns(column_view const& input,
+                                            size_type num_columns,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::deinterleave_columns(input, num_columns, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Copies row-major byte data back out into fixed-width columns.
+ *
+ * The data is copied in two passes: the first pass stages a group of rows in
+ * shared memory with coalesced 64-bit reads and the second pass scatters the
+ * staged values into the destination columns, one thread per row with the
+ * block y-dimension striding over columns.
+ */
+__global__ void copy_from_rows_kernel(size_type const num_rows,
+                                      size_type const num_columns,
+                                      size_type const row_size,
+                                      size_type const* input_offset_in_row,
+                                      size_type const* num_bytes,
+                                      int8_t** output_data,
+                                      bitmask_type** output_nm,
+                                      int8_t const* input_data)
+{
+  // Because shared memory is limited we copy a subset of the rows at a time.
+  // For simplicity we will refer to this as a row_group
+  size_type const rows_per_group   = blockDim.x;
+  size_type const row_group_start  = blockIdx.x;
+  size_type const row_group_stride = gridDim.x;
+  size_type const row_group_end    = (num_rows + rows_per_group - 1) / rows_per_group + 1;
+
+  extern __shared__ int8_t shared_data[];
+
+  // Because we are copying fixed width only data and we stride the rows
+  // this thread will always start copying from shared data in the same place
+  int8_t* row_tmp = &shared_data[row_size * threadIdx.x];
+  int8_t* row_vld_tmp =
+    &row_tmp[input_offset_in_row[num_columns - 1] + num_bytes[num_columns - 1]];
+
+  for (size_type row_group_index = row_group_start; row_group_index < row_group_end;
+       row_group_index += row_group_stride) {
+    // Step 1: Copy the data into shared memory
+    // We know row_size is always aligned with and a multiple of int64_t
+    int64_t* long_shared      = reinterpret_cast<int64_t*>(shared_data);
+    int64_t const* long_input = reinterpret_cast<int64_t const*>(input_data);
+
+    size_type const shared_output_index  = threadIdx.x + (threadIdx.y * blockDim.x);
+    size_type const shared_output_stride = blockDim.x * blockDim.y;
+    size_type const row_index_end =
+      std::min(num_rows, ((row_group_index + 1) * rows_per_group));
+    size_type const num_rows_in_group = row_index_end - (row_group_index * rows_per_group);
+    size_type const shared_length     = row_size * num_rows_in_group;
+
+    size_type const shared_output_end = shared_length / sizeof(int64_t);
+
+    size_type const start_input_index =
+      (row_size * row_group_index * rows_per_group) / sizeof(int64_t);
+
+    for (size_type shared_index = shared_output_index; shared_index < shared_output_end;
+         shared_index += shared_output_stride) {
+      long_shared[shared_index] = long_input[start_input_index + shared_index];
+    }
+    // Wait for all of the data to be in shared memory
+    __syncthreads();
+
+    // Step 2: Copy the data back out
+    // Within the row group there should be 1 thread for each row. This is a
+    // requirement for launching the kernel
+    size_type const row_index = (row_group_index * rows_per_group) + threadIdx.x;
+    // But we might not use all of the threads if the number of rows does not go
+    // evenly into the thread count. We don't want those threads to exit yet
+    // because we may need them to copy data in for the next row group.
+    uint32_t const active_mask = __ballot_sync(0xffffffff, row_index < num_rows);
+    if (row_index < num_rows) {
+      for (size_type col_index = threadIdx.y; col_index < num_columns;
+           col_index += blockDim.y) {
+        size_type const col_size = num_bytes[col_index];
+        int8_t const* col_tmp    = &(row_tmp[input_offset_in_row[col_index]]);
+        int8_t* col_output       = output_data[col_index];
+        switch (col_size) {
+          case 1: {
+            col_output[row_index] = *col_tmp;
+            break;
+          }
+          case 2: {
+            int16_t* short_col_output   = reinterpret_cast<int16_t*>(col_output);
+            short_col_output[row_index] = *reinterpret_cast<int16_t const*>(col_tmp);
+            break;
+          }
+          case 4: {
+            int32_t* int_col_output   = reinterpret_cast<int32_t*>(col_output);
+            int_col_output[row_index] = *reinterpret_cast<int32_t const*>(col_tmp);
+            break;
+          }
+          case 8: {
+            int64_t* long_col_output   = reinterpret_cast<int64_t*>(col_output);
+            long_col_output[row_index] = *reinterpret_cast<int64_t const*>(col_tmp);
+            break;
+          }
+          default: {
+            size_type const output_offset = col_size * row_index;
+            for (size_type b = 0; b < col_size; b++) {
+              col_output[b + output_offset] = col_tmp[b];
+            }
+            break;
+          }
+        }
+
+        bitmask_type* nm              = output_nm[col_index];
+        int8_t* valid_byte            = &row_vld_tmp[col_index / 8];
+        size_type const byte_bit_offset = col_index % 8;
+        int const predicate           = *valid_byte & (1 << byte_bit_offset);
+        uint32_t const bitmask        = __ballot_sync(active_mask, predicate);
+        if (row_index % 32 == 0) { nm[word_index(row_index)] = bitmask; }
+      }  // end column loop
+    }    // end row copy
+    // wait for the row_group to be totally copied before starting on the next row group
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Copies fixed-width columns into packed row-major byte data.
+ *
+ * Each thread packs one row of a row group into shared memory with the block
+ * y-dimension striding over columns, then the whole block flushes the staged
+ * rows to the output with coalesced 64-bit writes.
+ */
+__global__ void copy_to_rows_kernel(size_type const start_row,
+                                    size_type const num_rows,
+                                    size_type const num_columns,
+                                    size_type const row_size,
+                                    size_type const* output_offset_in_row,
+                                    size_type const* num_bytes,
+                                    int8_t const** input_data,
+                                    bitmask_type const** input_nm,
+                                    int8_t* output_data)
+{
+  // Because shared memory is limited we copy a subset of the rows at a time.
+  // A row wider than shared memory is not supported.
+  size_type const rows_per_group   = blockDim.x;
+  size_type const row_group_start  = blockIdx.x;
+  size_type const row_group_stride = gridDim.x;
+  size_type const row_group_end    = (num_rows + rows_per_group - 1) / rows_per_group + 1;
+
+  extern __shared__ int8_t shared_data[];
+
+  // Because we are copying fixed width only data and we stride the rows
+  // this thread will always start copying to shared data in the same place
+  int8_t* row_tmp = &shared_data[row_size * threadIdx.x];
+  int8_t* row_vld_tmp =
+    &row_tmp[output_offset_in_row[num_columns - 1] + num_bytes[num_columns - 1]];
+
+  for (size_type row_group_index = row_group_start; row_group_index < row_group_end;
+       row_group_index += row_group_stride) {
+    // Within the row group there should be 1 thread for each row. This is a
+    // requirement for launching the kernel
+    size_type const row_index = start_row + (row_group_index * rows_per_group) + threadIdx.x;
+    // But we might not use all of the threads if the number of rows does not go
+    // evenly into the thread count. We don't want those threads to exit yet
+    // because we may need them to copy data back out.
+    if (row_index < (start_row + num_rows)) {
+      for (size_type col_index = threadIdx.y; col_index < num_columns;
+           col_index += blockDim.y) {
+        size_type const col_size = num_bytes[col_index];
+        int8_t* col_tmp          = &(row_tmp[output_offset_in_row[col_index]]);
+        int8_t const* col_input  = input_data[col_index];
+        switch (col_size) {
+          case 1: {
+            *col_tmp = col_input[row_index];
+            break;
+          }
+          case 2: {
+            int16_t const* short_col_input     = reinterpret_cast<int16_t const*>(col_input);
+            *reinterpret_cast<int16_t*>(col_tmp) = short_col_input[row_index];
+            break;
+          }
+          case 4: {
+            int32_t const* int_col_input       = reinterpret_cast<int32_t const*>(col_input);
+            *reinterpret_cast<int32_t*>(col_tmp) = int_col_input[row_index];
+            break;
+          }
+          case 8: {
+            int64_t const* long_col_input      = reinterpret_cast<int64_t const*>(col_input);
+            *reinterpret_cast<int64_t*>(col_tmp) = long_col_input[row_index];
+            break;
+          }
+          default: {
+            size_type const input_offset = col_size * row_index;
+            for (size_type b = 0; b < col_size; b++) {
+              col_tmp[b] = col_input[b + input_offset];
+            }
+            break;
+          }
+        }
+        // atomicOr only works on 32 bit or 64 bit aligned values, and not byte aligned
+        // so we have to rewrite the addresses to make sure that it is 4 byte aligned
+        int8_t* valid_byte              = &row_vld_tmp[col_index / 8];
+        size_type const byte_bit_offset = col_index % 8;
+        uint64_t const fixup_bytes      = reinterpret_cast<uint64_t>(valid_byte) % 4;
+        int32_t* valid_int              = reinterpret_cast<int32_t*>(valid_byte - fixup_bytes);
+        size_type const int_bit_offset  = byte_bit_offset + (fixup_bytes * 8);
+        // Now copy validity for the column
+        if (input_nm[col_index]) {
+          if (bit_is_set(input_nm[col_index], row_index)) {
+            atomicOr_block(valid_int, 1 << int_bit_offset);
+          } else {
+            atomicAnd_block(valid_int, ~(1 << int_bit_offset));
+          }
+        } else {
+          // It is valid so just set the bit
+          atomicOr_block(valid_int, 1 << int_bit_offset);
+        }
+      }  // end column loop
+    }    // end row copy
+    // wait for the row_group to be totally copied into shared memory
+    __syncthreads();
+
+    // Step 2: Copy the data out with coalesced writes
+    // We know row_size is always aligned with and a multiple of int64_t
+    int64_t* long_shared = reinterpret_cast<int64_t*>(shared_data);
+    int64_t* long_output = reinterpret_cast<int64_t*>(output_data);
+
+    size_type const shared_input_index  = threadIdx.x + (threadIdx.y * blockDim.x);
+    size_type const shared_input_stride = blockDim.x * blockDim.y;
+    size_type const row_index_end =
+      std::min(num_rows, ((row_group_index + 1) * rows_per_group));
+    size_type const num_rows_in_group = row_index_end - (row_group_index * rows_per_group);
+    size_type const shared_length     = row_size * num_rows_in_group;
+
+    size_type const shared_input_end = shared_length / sizeof(int64_t);
+
+    size_type const start_output_index =
+      (row_size * row_group_index * rows_per_group) / sizeof(int64_t);
+
+    for (size_type shared_index = shared_input_index; shared_index < shared_input_end;
+         shared_index += shared_input_stride) {
+      long_output[start_output_index + shared_index] = long_shared[shared_index];
+    }
+    __syncthreads();
+    // Go for the next round
+  }
+}
+
+/**
+ * @brief Calculate the dimensions of the kernel for fixed width only columns.
+ *
+ * @param[in] num_columns the number of columns being copied.
+ * @param[in] num_rows the number of rows being copied.
+ * @param[in] size_per_row the size each row takes up when padded.
+ * @param[out] blocks the size of the blocks for the kernel
+ * @param[out] threads the size of the threads for the kernel
+ * @return the size in bytes of shared memory needed for each block.
+ */
+int calc_fixed_width_kernel_dims(size_type const num_columns,
+                                 size_type const num_rows,
+                                 size_type const size_per_row,
+                                 dim3& blocks,
+                                 dim3& threads)
+{
+  // We have found speed degrades when a thread handles more than 4 columns.
+  // Each block is 2 dimensional. The y dimension indicates the columns.
+  // We limit this to 32 threads in the y dimension so we can still
+  // have at least 32 threads in the x dimension (1 warp) which should
+  // result in better coalescing of memory operations. We also
+  // want to guarantee that we are processing a multiple of 32 threads
+  // in the x dimension because we use atomic operations at the block
+  // level when writing validity data out to main memory, and that would
+  // need to change if we split a word of validity data between blocks.
+  int const y_block_size          = std::min((num_columns + 3) / 4, 32);
+  int const x_possible_block_size = 1024 / y_block_size;
+  // 48KB is the default setting for shared memory per block according to the cuda tutorials
+  // If someone configures the GPU to only have 16 KB this might not work.
+  int const max_shared_size = 48 * 1024;
+  // If we don't have enough shared memory there is no point in having more threads
+  // per block that will just sit idle
+  int const max_block_size = std::min(x_possible_block_size, max_shared_size / size_per_row);
+  // Make sure that the x dimension is a multiple of 32 this not only helps
+  // coalesce memory access it also lets us do a ballot sync for validity to write
+  // the data back out the warp level. If x is a multiple of 32 then each thread in the y
+  // dimension is associated with one or more warps, that should correspond to the validity
+  // words directly.
+  int const block_size = (max_block_size / 32) * 32;
+  CUDF_EXPECTS(block_size != 0, "Row size is too large to fit in shared memory");
+
+  // The maximum number of blocks supported in the x dimension is 2 ^ 31 - 1
+  // but having too many can cause some overhead that is not well understood;
+  // as little as 600 blocks can saturate memory on V100, so this is an order
+  // of magnitude higher to future proof it a bit.
+  int const num_blocks = std::max(1, std::min((num_rows + block_size - 1) / block_size, 10240));
+
+  blocks  = dim3(num_blocks, 1, 1);
+  threads = dim3(block_size, y_block_size, 1);
+  return size_per_row * block_size;
+}
+
+inline int32_t align_offset(int32_t offset, std::size_t alignment)
+{
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Given a set of fixed width columns, calculate how the data will be laid out in memory.
+ *
+ * @param[in] schema the types of columns that need to be laid out.
+ * @param[out] column_start the byte offset where each column starts in the row.
+ * @param[out] column_size the size in bytes of the data for each columns in the row.
+ * @return the size in bytes each row needs.
+ */
+int32_t compute_fixed_width_layout(std::vector<data_type> const& schema,
+                                   std::vector<size_type>& column_start,
+                                   std::vector<size_type>& column_size)
+{
+  // The start of each column is aligned to its own size so the values can be
+  // read and written with single accesses.
+  int32_t at_offset = 0;
+  for (auto const& col : schema) {
+    CUDF_EXPECTS(is_fixed_width(col), "Only fixed width types are supported");
+    size_type const s = size_of(col);
+    column_size.emplace_back(s);
+    at_offset = align_offset(at_offset, s);
+    column_start.emplace_back(at_offset);
+    at_offset += s;
+  }
+
+  // The validity bytes, one bit per column, follow the values
+  int32_t const validity_bytes_needed = (schema.size() + 7) / 8;
+  at_offset += validity_bytes_needed;
+  // Pad the end so all rows are 64 bit aligned
+  return align_offset(at_offset, 8);  // 8 bytes (64 bits)
+}
+
+/**
+ * @brief Create the output rows column for a subset of the rows of a table.
+ *
+ * When converting to rows it is possible that the size of the table was too
+ * big to fit in a single column. This creates an output column for a subset of
+ * the rows going from `start_row` and containing the next `num_rows`. The
+ * device arrays passed in are common between runs and are calculated once.
+ */
+std::unique_ptr<column> fixed_width_convert_to_rows(
+  size_type const start_row,
+  size_type const num_rows,
+  size_type const num_columns,
+  size_type const size_per_row,
+  rmm::device_uvector<size_type> const& column_start,
+  rmm::device_uvector<size_type> const& column_size,
+  rmm::device_uvector<int8_t const*> const& input_data,
+  rmm::device_uvector<bitmask_type const*> const& input_nm,
+  scalar const& zero,
+  scalar const& scalar_size_per_row,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  int64_t const total_allocation = static_cast<int64_t>(size_per_row) * num_rows;
+  // We made a mistake in the split somehow
+  CUDF_EXPECTS(total_allocation < std::numeric_limits<size_type>::max(),
+               "Table is too large to fit!");
+
+  // Allocate and set the offsets row for the byte array
+  auto offsets = cudf::detail::sequence(num_rows + 1, zero, scalar_size_per_row, stream);
+
+  auto data = make_numeric_column(data_type(type_id::INT8),
+                                  static_cast<size_type>(total_allocation),
+                                  mask_state::UNALLOCATED,
+                                  stream,
+                                  mr);
+
+  dim3 blocks;
+  dim3 threads;
+  int const shared_size =
+    calc_fixed_width_kernel_dims(num_columns, num_rows, size_per_row, blocks, threads);
+
+  copy_to_rows_kernel<<<blocks, threads, shared_size, stream.value()>>>(
+    start_row,
+    num_rows,
+    num_columns,
+    size_per_row,
+    column_start.data(),
+    column_size.data(),
+    input_data.data(),
+    input_nm.data(),
+    data->mutable_view().data<int8_t>());
+  CHECK_CUDA(stream.value());
+
+  return make_lists_column(
+    num_rows, std::move(offsets), std::move(data), 0, rmm::device_buffer{}, stream, mr);
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> to_rows(table_view const& input,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  size_type const num_columns = input.num_columns();
+  CUDF_EXPECTS(num_columns > 0, "Input table must have at least one column");
+
+  std::vector<data_type> schema(num_columns);
+  std::transform(
+    input.begin(), input.end(), schema.begin(), [](auto const& col) { return col.type(); });
+
+  std::vector<size_type> column_start;
+  std::vector<size_type> column_size;
+  int32_t const size_per_row = compute_fixed_width_layout(schema, column_start, column_size);
+  auto dev_column_start      = cudf::detail::make_device_uvector_async(column_start, stream);
+  auto dev_column_size       = cudf::detail::make_device_uvector_async(column_size, stream);
+
+  // Make the number of rows per batch a multiple of 32 so we don't have to worry about
+  // splitting validity at a specific row offset.
+  int32_t const max_rows_per_batch =
+    ((std::numeric_limits<size_type>::max() / size_per_row) / 32) * 32;
+
+  size_type const num_rows = input.num_rows();
+
+  // Get the pointers to the input columnar data ready
+  std::vector<int8_t const*> input_data;
+  std::vector<bitmask_type const*> input_nm;
+  for (auto const& col : input) {
+    input_data.emplace_back(col.data<int8_t>());
+    input_nm.emplace_back(col.null_mask());
+  }
+  auto dev_input_data = cudf::detail::make_device_uvector_async(input_data, stream);
+  auto dev_input_nm   = cudf::detail::make_device_uvector_async(input_nm, stream);
+
+  using ScalarType = scalar_type_t<size_type>;
+  auto zero        = make_numeric_scalar(data_type(type_id::INT32), stream.value());
+  zero->set_valid_async(true, stream);
+  static_cast<ScalarType*>(zero.get())->set_value(0, stream);
+
+  auto step = make_numeric_scalar(data_type(type_id::INT32), stream.value());
+  step->set_valid_async(true, stream);
+  static_cast<ScalarType*>(step.get())->set_value(static_cast<size_type>(size_per_row), stream);
+
+  std::vector<std::unique_ptr<column>> result;
+  for (size_type row_start = 0; row_start < num_rows; row_start += max_rows_per_batch) {
+    size_type const row_count = std::min(max_rows_per_batch, num_rows - row_start);
+    result.emplace_back(fixed_width_convert_to_rows(row_start,
+                                                    row_count,
+                                                    num_columns,
+                                                    size_per_row,
+                                                    dev_column_start,
+                                                    dev_column_size,
+                                                    dev_input_data,
+                                                    dev_input_nm,
+                                                    *zero,
+                                                    *step,
+                                                    stream,
+                                                    mr));
+  }
+  return result;
+}
+
+std::unique_ptr<table> from_rows(lists_column_view const& input,
+                                 std::vector<data_type> const& schema,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  // verify that the types are what we expect
+  column_view const child = input.child();
+  auto const list_type    = child.type().id();
+  CUDF_EXPECTS(list_type == type_id::INT8 || list_type == type_id::UINT8,
+               "Only a list of bytes is supported as input");
+
+  size_type const num_columns = schema.size();
+  size_type const num_rows    = input.parent().size();
+
+  std::vector<size_type> column_start;
+  std::vector<size_type> column_size;
+  int32_t const size_per_row = compute_fixed_width_layout(schema, column_start, column_size);
+
+  // Ideally we would check that the offsets are all the same, etc. but for now
+  // this is probably fine
+  CUDF_EXPECTS(size_per_row * num_rows == child.size(), "The layout of the data appears to be off");
+  auto dev_column_start = cudf::detail::make_device_uvector_async(column_start, stream);
+  auto dev_column_size  = cudf::detail::make_device_uvector_async(column_size, stream);
+
+  // Allocate the columns we are going to write into
+  std::vector<std::unique_ptr<column>> output_columns;
+  std::vector<int8_t*> output_data;
+  std::vector<bitmask_type*> output_nm;
+  for (size_type i = 0; i < num_columns; i++) {
+    auto column =
+      make_fixed_width_column(schema[i], num_rows, mask_state::UNINITIALIZED, stream, mr);
+    auto mut = column->mutable_view();
+    output_data.emplace_back(mut.data<int8_t>());
+    output_nm.emplace_back(mut.null_mask());
+    output_columns.emplace_back(std::move(column));
+  }
+
+  auto dev_output_data = cudf::detail::make_device_uvector_async(output_data, stream);
+  auto dev_output_nm   = cudf::detail::make_device_uvector_async(output_nm, stream);
+
+  dim3 blocks;
+  dim3 threads;
+  int const shared_size =
+    calc_fixed_width_kernel_dims(num_columns, num_rows, size_per_row, blocks, threads);
+
+  copy_from_rows_kernel<<<blocks, threads, shared_size, stream.value()>>>(
+    num_rows,
+    num_columns,
+    size_per_row,
+    dev_column_start.data(),
+    dev_column_size.data(),
+    dev_output_data.data(),
+    dev_output_nm.data(),
+    child.data<int8_t>());
+  CHECK_CUDA(stream.value());
+
+  return std::make_unique<table>(std::move(output_columns));
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<column>> to_rows(table_view const& input,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_rows(input, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> from_rows(lists_column_view const& input,
+                                 std::vector<data_type> const& schema,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_rows(input, schema, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
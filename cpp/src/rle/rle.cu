@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/rle.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <utility>
+
+namespace cudf {
+
+rle_column::rle_column(std::unique_ptr<column> run_ends, std::unique_ptr<column> values)
+  : _run_ends{std::move(run_ends)}, _values{std::move(values)}
+{
+  CUDF_EXPECTS(_run_ends != nullptr and _values != nullptr,
+               "run_ends and values must not be null.");
+  CUDF_EXPECTS(_run_ends->type() == data_type{type_to_id<size_type>()} and
+                 not _run_ends->nullable(),
+               "run_ends must be a non-nullable INT32 column.");
+  CUDF_EXPECTS(_run_ends->size() == _values->size(),
+               "run_ends and values must have the same length.");
+  // the last run end is the decoded size
+  _size = _run_ends->size() == 0
+            ? 0
+            : cudf::detail::get_value<size_type>(
+                _run_ends->view(), _run_ends->size() - 1, rmm::cuda_stream_default);
+}
+
+column_view rle_column::run_ends() const { return _run_ends->view(); }
+column_view rle_column::values() const { return _values->view(); }
+size_type rle_column::size() const { return _size; }
+size_type rle_column::num_runs() const { return _run_ends->size(); }
+
+namespace detail {
+namespace {
+
+/**
+ * @brief Collects the row index of the first element of each run.
+ */
+template <bool has_nulls>
+rmm::device_uvector<size_type> run_start_indices(column_view const& input,
+                                                 rmm::cuda_stream_view stream)
+{
+  auto const d_input = table_device_view::create(table_view{{input}}, stream);
+  auto const comp    = row_equality_comparator<has_nulls>{*d_input, *d_input, true};
+
+  rmm::device_uvector<size_type> starts(input.size(), stream);
+  auto const starts_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    starts.begin(),
+                    [comp] __device__(size_type i) { return i == 0 or not comp(i, i - 1); });
+  starts.resize(thrust::distance(starts.begin(), starts_end), stream);
+  return starts;
+}
+
+}  // namespace
+
+rle_column rle_encode(column_view const& input,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  if (input.is_empty()) {
+    return rle_column{make_numeric_column(
+                        data_type{type_to_id<size_type>()}, 0, mask_state::UNALLOCATED, stream, mr),
+                      empty_like(input)};
+  }
+
+  auto const starts   = input.has_nulls() ? run_start_indices<true>(input, stream)
+                                          : run_start_indices<false>(input, stream);
+  auto const num_runs = static_cast<size_type>(starts.size());
+
+  // each run ends where the next one starts; the last ends at the input size
+  auto run_ends = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_runs, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_runs),
+                    run_ends->mutable_view().begin<size_type>(),
+                    [d_starts = starts.data(), num_runs, size = input.size()] __device__(
+                      size_type i) { return i + 1 < num_runs ? d_starts[i + 1] : size; });
+
+  auto values_table = cudf::detail::gather(table_view{{input}},
+                                           starts.begin(),
+                                           starts.end(),
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           stream,
+                                           mr);
+
+  return rle_column{std::move(run_ends), std::move(values_table->release().front())};
+}
+
+std::unique_ptr<column> rle_decode(rle_column const& input,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  if (input.size() == 0) { return empty_like(input.values()); }
+
+  // map every decoded row to its run: the first run whose end lies beyond it
+  auto const d_run_ends = input.run_ends().begin<size_type>();
+  rmm::device_uvector<size_type> gather_map(input.size(), stream);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      d_run_ends,
+                      d_run_ends + input.num_runs(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      gather_map.begin());
+
+  auto decoded = cudf::detail::gather(table_view{{input.values()}},
+                                      gather_map.begin(),
+                                      gather_map.end(),
+                                      out_of_bounds_policy::DONT_CHECK,
+                                      stream,
+                                      mr);
+  return std::move(decoded->release().front());
+}
+
+namespace {
+
+/**
+ * @brief Translates insertion points among the run values into insertion
+ * points of the decoded domain: run index `i` maps to `run_ends[i - 1]`, the
+ * first decoded row of run `i`.
+ */
+std::unique_ptr<column> translate_run_bounds(std::unique_ptr<column>&& run_bounds,
+                                             column_view const& run_ends,
+                                             rmm::cuda_stream_view stream)
+{
+  auto const d_run_ends = run_ends.begin<size_type>();
+  auto const bounds     = run_bounds->mutable_view();
+  thrust::transform(rmm::exec_policy(stream),
+                    bounds.begin<size_type>(),
+                    bounds.end<size_type>(),
+                    bounds.begin<size_type>(),
+                    [d_run_ends] __device__(size_type run) {
+                      return run == 0 ? size_type{0} : d_run_ends[run - 1];
+                    });
+  return std::move(run_bounds);
+}
+
+}  // namespace
+
+std::unique_ptr<column> rle_lower_bound(rle_column const& haystack,
+                                        column_view const& needles,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  auto run_bounds = cudf::detail::lower_bound(table_view{{haystack.values()}},
+                                              table_view{{needles}},
+                                              {order::ASCENDING},
+                                              {null_order::AFTER},
+                                              stream,
+                                              mr);
+  return translate_run_bounds(std::move(run_bounds), haystack.run_ends(), stream);
+}
+
+std::unique_ptr<column> rle_upper_bound(rle_column const& haystack,
+                                        column_view const& needles,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  auto run_bounds = cudf::detail::upper_bound(table_view{{haystack.values()}},
+                                              table_view{{needles}},
+                                              {order::ASCENDING},
+                                              {null_order::AFTER},
+                                              stream,
+                                              mr);
+  return translate_run_bounds(std::move(run_bounds), haystack.run_ends(), stream);
+}
+
+}  // namespace detail
+
+rle_column rle_encode(column_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.size());
+  return detail::rle_encode(input, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> rle_decode(rle_column const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.size());
+  return detail::rle_decode(input, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> rle_lower_bound(rle_column const& haystack,
+                                        column_view const& needles,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rle_lower_bound(haystack, needles, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> rle_upper_bound(rle_column const& haystack,
+                                        column_view const& needles,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rle_upper_bound(haystack, needles, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -297,21 +297,19 @@ std::unique_ptr<column> expand_to_column(Calculator const& calc,
   return window_column;
 }
 
-/// Range window computation, with
+/// Range window bounds computation, with
 ///   1. no grouping keys specified
 ///   2. rows in ASCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_ASC(
+  column_view const& orderby_column,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
 
@@ -347,12 +345,12 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto following_calculator =
     [nulls_begin_idx = h_nulls_begin_idx,
      nulls_end_idx   = h_nulls_end_idx,
-     num_rows        = input.size(),
+     num_rows        = orderby_column.size(),
      d_orderby       = orderby_column.data<T>(),
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -378,10 +376,9 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 // Given an orderby column grouped as specified in group_offsets,
@@ -462,20 +459,18 @@ get_null_bounds_for_orderby_column(column_view const& orderby_column,
   }
 }
 
-// Range window computation, for orderby column in ASCENDING order.
+// Range window bounds computation, for orderby column in ASCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                         rmm::device_uvector<cudf::size_type> const& group_labels,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_ASC(
+  column_view const& orderby_column,
+  rmm::device_uvector<cudf::size_type> const& group_offsets,
+  rmm::device_uvector<cudf::size_type> const& group_labels,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -518,7 +513,7 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
@@ -559,27 +554,24 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
-/// Range window computation, with
+/// Range window bounds computation, with
 ///   1. no grouping keys specified
 ///   2. rows in DESCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_DESC(
+  column_view const& orderby_column,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
 
@@ -617,12 +609,12 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto following_calculator =
     [nulls_begin_idx = h_nulls_begin_idx,
      nulls_end_idx   = h_nulls_end_idx,
-     num_rows        = input.size(),
+     num_rows        = orderby_column.size(),
      d_orderby       = orderby_column.data<T>(),
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -651,26 +643,23 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
-// Range window computation, for rows in DESCENDING order.
+// Range window bounds computation, for rows in DESCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                          rmm::device_uvector<cudf::size_type> const& group_labels,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_DESC(
+  column_view const& orderby_column,
+  rmm::device_uvector<cudf::size_type> const& group_offsets,
+  rmm::device_uvector<cudf::size_type> const& group_labels,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -715,7 +704,7 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
@@ -758,27 +747,19 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
-    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-  }
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 template <typename OrderByT>
-std::unique_ptr<column> grouped_range_rolling_window_impl(
-  column_view const& input,
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_range_window_columns_impl(
   column_view const& orderby_column,
   cudf::order const& timestamp_ordering,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
   rmm::device_uvector<cudf::size_type> const& group_labels,
   range_window_bounds const& preceding_window,
   range_window_bounds const& following_window,
-  size_type min_periods,
-  rolling_aggregation const& aggr,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
@@ -786,58 +767,46 @@ std::unique_ptr<column> grouped_range_rolling_window_impl(
   auto following_value = detail::range_comparable_value<OrderByT>(following_window);
 
   if (timestamp_ordering == cudf::order::ASCENDING) {
-    return group_offsets.is_empty() ? range_window_ASC(input,
-                                                       orderby_column,
+    return group_offsets.is_empty() ? range_window_ASC(orderby_column,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
                                                        stream,
                                                        mr)
-                                    : range_window_ASC(input,
-                                                       orderby_column,
+                                    : range_window_ASC(orderby_column,
                                                        group_offsets,
                                                        group_labels,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
                                                        stream,
                                                        mr);
   } else {
-    return group_offsets.is_empty() ? range_window_DESC(input,
-                                                        orderby_column,
+    return group_offsets.is_empty() ? range_window_DESC(orderby_column,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
                                                         stream,
                                                         mr)
-                                    : range_window_DESC(input,
-                                                        orderby_column,
+                                    : range_window_DESC(orderby_column,
                                                         group_offsets,
                                                         group_labels,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
                                                         stream,
                                                         mr);
   }
 }
 
-struct dispatch_grouped_range_rolling_window {
+struct dispatch_grouped_range_window_columns {
   template <typename OrderByColumnType, typename... Args>
   std::enable_if_t<!detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
+                   std::pair<std::unique_ptr<column>, std::unique_ptr<column>>>
   operator()(Args&&...) const
   {
     CUDF_FAIL("Unsupported OrderBy column type.");
@@ -845,33 +814,66 @@ struct dispatch_grouped_range_rolling_window {
 
   template <typename OrderByColumnType>
   std::enable_if_t<detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
-  operator()(column_view const& input,
-             column_view const& orderby_column,
+                   std::pair<std::unique_ptr<column>, std::unique_ptr<column>>>
+  operator()(column_view const& orderby_column,
              cudf::order const& timestamp_ordering,
              rmm::device_uvector<cudf::size_type> const& group_offsets,
              rmm::device_uvector<cudf::size_type> const& group_labels,
              range_window_bounds const& preceding_window,
              range_window_bounds const& following_window,
-             size_type min_periods,
-             rolling_aggregation const& aggr,
              rmm::cuda_stream_view stream,
              rmm::mr::device_memory_resource* mr) const
   {
-    return grouped_range_rolling_window_impl<OrderByColumnType>(input,
-                                                                orderby_column,
+    return grouped_range_window_columns_impl<OrderByColumnType>(orderby_column,
                                                                 timestamp_ordering,
                                                                 group_offsets,
                                                                 group_labels,
                                                                 preceding_window,
                                                                 following_window,
-                                                                min_periods,
-                                                                aggr,
                                                                 stream,
                                                                 mr);
   }
 };
 
+/**
+ * @brief Computes the preceding/following window-bound columns for a grouped,
+ * range-based window specification.
+ *
+ * This is the binary-search step shared by `grouped_range_rolling_window` and
+ * `grouped_range_rolling_window_bounds`; computing it once allows the same
+ * bounds to be reused across many aggregations on the same frame.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_grouped_range_window_columns(
+  table_view const& group_keys,
+  column_view const& order_by_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  using index_vector        = sort_groupby_helper::index_vector;
+
+  index_vector group_offsets(0, stream), group_labels(0, stream);
+  if (group_keys.num_columns() > 0) {
+    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
+    group_offsets = index_vector(helper.group_offsets(stream), stream);
+    group_labels  = index_vector(helper.group_labels(stream), stream);
+  }
+
+  return cudf::type_dispatcher(order_by_column.type(),
+                               dispatch_grouped_range_window_columns{},
+                               order_by_column,
+                               order,
+                               group_offsets,
+                               group_labels,
+                               preceding,
+                               following,
+                               stream,
+                               mr);
+}
+
 /**
  * @brief Functor to convert from size_type (number of days) to appropriate duration type.
  */
@@ -976,29 +978,51 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
 
   CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
 
-  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
-  using index_vector        = sort_groupby_helper::index_vector;
+  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
+    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
+  }
 
-  index_vector group_offsets(0, stream), group_labels(0, stream);
-  if (group_keys.num_columns() > 0) {
-    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
-    group_offsets = index_vector(helper.group_offsets(stream), stream);
-    group_labels  = index_vector(helper.group_labels(stream), stream);
+  auto [preceding_column, following_column] = make_grouped_range_window_columns(
+    group_keys, order_by_column, order, preceding, following, stream, mr);
+
+  return cudf::detail::rolling_window(
+    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+}
+
+/**
+ * @copydoc std::pair<std::unique_ptr<column>, std::unique_ptr<column>>
+ *          grouped_range_rolling_window_bounds(
+ *              table_view const& group_keys,
+ *              column_view const& orderby_column,
+ *              cudf::order const& order,
+ *              range_window_bounds const& preceding,
+ *              range_window_bounds const& following,
+ *              rmm::mr::device_memory_resource* mr );
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_range_rolling_window_bounds(
+  table_view const& group_keys,
+  column_view const& order_by_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(
+    (group_keys.num_columns() == 0 || group_keys.num_rows() == order_by_column.size()),
+    "Size mismatch between group_keys and orderby column.");
+
+  if (order_by_column.is_empty()) {
+    return {cudf::make_empty_column(data_type{type_id::INT32}),
+            cudf::make_empty_column(data_type{type_id::INT32})};
   }
 
-  return cudf::type_dispatcher(order_by_column.type(),
-                               dispatch_grouped_range_rolling_window{},
-                               input,
-                               order_by_column,
-                               order,
-                               group_offsets,
-                               group_labels,
-                               preceding,
-                               following,
-                               min_periods,
-                               aggr,
-                               stream,
-                               mr);
+  return make_grouped_range_window_columns(
+    group_keys, order_by_column, order, preceding, following, stream, mr);
 }
 
 }  // namespace detail
@@ -1112,4 +1136,25 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
                                               mr);
 }
 
+/**
+ * @copydoc grouped_range_rolling_window_bounds(
+ *               table_view const& group_keys,
+ *               column_view const& orderby_column,
+ *               cudf::order const& order,
+ *               range_window_bounds const& preceding,
+ *               range_window_bounds const& following,
+ *               rmm::mr::device_memory_resource* mr );
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_range_rolling_window_bounds(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  rmm::mr::device_memory_resource* mr)
+{
+  return detail::grouped_range_rolling_window_bounds(
+    group_keys, orderby_column, order, preceding, following, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -15,7 +15,17 @@
  */
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include "rolling_detail.cuh"
+#include "rolling_detail.hpp"
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
 
 namespace cudf {
 namespace detail {
@@ -50,6 +60,13 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                             stream,
                                             mr);
   } else {
+    // Fixed-size windows with prefix-summable aggregations can skip the
+    // per-window loop of the generic kernel entirely
+    if (auto output = cudf::detail::rolling_window_prefix_sum(
+          input, preceding_window, following_window, min_periods, agg, stream, mr)) {
+      return output;
+    }
+
     auto preceding_window_begin = thrust::make_constant_iterator(preceding_window);
     auto following_window_begin = thrust::make_constant_iterator(following_window);
 
@@ -110,6 +127,226 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
+namespace {
+
+/// Per-output descriptor for the fused multi-aggregation rolling kernel
+struct fused_rolling_output {
+  aggregation::Kind kind;
+  void* data;
+  size_type ddof;  ///< VARIANCE/STD only
+};
+
+constexpr bool is_fusable_rolling_kind(aggregation::Kind kind)
+{
+  return kind == aggregation::SUM or kind == aggregation::MIN or kind == aggregation::MAX or
+         kind == aggregation::MEAN or kind == aggregation::COUNT_VALID or
+         kind == aggregation::VARIANCE or kind == aggregation::STD;
+}
+
+/**
+ * @brief Visits each window's elements once, feeding one accumulator set that serves every
+ * requested aggregation.
+ */
+template <typename T>
+struct fused_rolling_fn {
+  column_device_view input;
+  fused_rolling_output const* outputs;
+  size_type num_outputs;
+  size_type preceding;
+  size_type following;
+  size_type* counts;
+
+  __device__ void operator()(size_type i)
+  {
+    auto const start = max(size_type{0}, i - preceding + 1);
+    auto const end   = min(input.size(), i + following + 1);
+
+    size_type count = 0;
+    T sum{};
+    double dsum = 0, dsumsq = 0;
+    T mn{}, mx{};
+    for (size_type j = start; j < end; ++j) {
+      if (input.is_valid(j)) {
+        T const v = input.element<T>(j);
+        if (count == 0) {
+          mn = v;
+          mx = v;
+        } else {
+          mn = min(mn, v);
+          mx = max(mx, v);
+        }
+        sum += v;
+        auto const dv = static_cast<double>(v);
+        dsum += dv;
+        dsumsq += dv * dv;
+        ++count;
+      }
+    }
+    counts[i] = count;
+
+    for (size_type k = 0; k < num_outputs; ++k) {
+      auto const& out = outputs[k];
+      switch (out.kind) {
+        case aggregation::COUNT_VALID: static_cast<size_type*>(out.data)[i] = count; break;
+        case aggregation::SUM:
+          if (count > 0) { static_cast<T*>(out.data)[i] = sum; }
+          break;
+        case aggregation::MIN:
+          if (count > 0) { static_cast<T*>(out.data)[i] = mn; }
+          break;
+        case aggregation::MAX:
+          if (count > 0) { static_cast<T*>(out.data)[i] = mx; }
+          break;
+        case aggregation::MEAN:
+          if (count > 0) { static_cast<T*>(out.data)[i] = static_cast<T>(dsum / count); }
+          break;
+        case aggregation::VARIANCE:
+        case aggregation::STD:
+          if (count > out.ddof) {
+            double const var = (dsumsq - dsum * dsum / count) / (count - out.ddof);
+            static_cast<double*>(out.data)[i] = out.kind == aggregation::STD ? sqrt(var) : var;
+          }
+          break;
+        default: break;
+      }
+    }
+  }
+};
+
+struct fused_rolling_dispatcher {
+  template <typename T,
+            std::enable_if_t<std::is_arithmetic<T>::value and
+                             not std::is_same<T, bool>::value>* = nullptr>
+  void operator()(column_view const& input,
+                  fused_rolling_output const* d_outputs,
+                  size_type num_outputs,
+                  size_type preceding,
+                  size_type following,
+                  size_type* counts,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const d_input = column_device_view::create(input, stream);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      fused_rolling_fn<T>{*d_input, d_outputs, num_outputs, preceding, following, counts});
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_arithmetic<T>::value or
+                             std::is_same<T, bool>::value>* = nullptr>
+  void operator()(column_view const&,
+                  fused_rolling_output const*,
+                  size_type,
+                  size_type,
+                  size_type,
+                  size_type*,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Fused rolling aggregations support only numeric types.");
+  }
+};
+
+}  // namespace
+
+// Applies several rolling window aggregations over the same fixed-size window.
+std::vector<std::unique_ptr<column>> rolling_window_multi(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
+
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(aggs.size());
+  if (aggs.empty()) { return results; }
+
+  auto const fusable =
+    cudf::is_numeric(input.type()) and input.type().id() != type_id::BOOL8 and
+    not input.is_empty() and std::all_of(aggs.begin(), aggs.end(), [](auto const& agg) {
+      return is_fusable_rolling_kind(agg->kind);
+    });
+
+  if (not fusable) {
+    // one pass per aggregation, exactly as repeated single-aggregation calls
+    auto const defaults =
+      cudf::is_dictionary(input.type()) ? dictionary_column_view(input).indices() : input;
+    for (auto const& agg : aggs) {
+      results.push_back(rolling_window(input,
+                                       empty_like(defaults)->view(),
+                                       preceding_window,
+                                       following_window,
+                                       min_periods,
+                                       *agg,
+                                       stream,
+                                       mr));
+    }
+    return results;
+  }
+
+  // allocate one output column per aggregation and describe it to the fused kernel
+  std::vector<fused_rolling_output> h_outputs;
+  h_outputs.reserve(aggs.size());
+  std::vector<size_type> ddofs(aggs.size(), 0);
+  for (std::size_t k = 0; k < aggs.size(); ++k) {
+    auto const kind = aggs[k]->kind;
+    auto const type = [&] {
+      if (kind == aggregation::COUNT_VALID) { return data_type{type_to_id<size_type>()}; }
+      if (kind == aggregation::VARIANCE or kind == aggregation::STD) {
+        return data_type{type_id::FLOAT64};
+      }
+      return input.type();
+    }();
+    if (kind == aggregation::VARIANCE or kind == aggregation::STD) {
+      ddofs[k] = dynamic_cast<cudf::detail::std_var_aggregation const&>(*aggs[k])._ddof;
+    }
+    auto col = make_fixed_width_column(type, input.size(), mask_state::UNALLOCATED, stream, mr);
+    h_outputs.push_back(fused_rolling_output{kind, col->mutable_view().head<void>(), ddofs[k]});
+    results.push_back(std::move(col));
+  }
+
+  auto const d_outputs = cudf::detail::make_device_uvector_async(h_outputs, stream);
+  rmm::device_uvector<size_type> counts(input.size(), stream);
+
+  type_dispatcher(input.type(),
+                  fused_rolling_dispatcher{},
+                  input,
+                  d_outputs.data(),
+                  static_cast<size_type>(aggs.size()),
+                  preceding_window,
+                  following_window,
+                  counts.data(),
+                  stream);
+
+  // a row is valid when its window holds enough observations; VARIANCE/STD additionally
+  // need more observations than their delta degrees of freedom
+  for (std::size_t k = 0; k < aggs.size(); ++k) {
+    auto const kind = aggs[k]->kind;
+    auto const threshold =
+      (kind == aggregation::VARIANCE or kind == aggregation::STD)
+        ? std::max(min_periods, ddofs[k] + 1)
+        : min_periods;
+    auto mask = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(input.size()),
+      [d_counts = counts.data(), threshold] __device__(size_type i) {
+        return d_counts[i] >= threshold;
+      },
+      stream,
+      mr);
+    results[k]->set_null_mask(std::move(mask.first), mask.second);
+  }
+
+  return results;
+}
+
 }  // namespace detail
 
 // Applies a fixed-size rolling window function to the values in a column, with default output
@@ -158,4 +395,17 @@ std::unique_ptr<column> rolling_window(column_view const& input,
     input, preceding_window, following_window, min_periods, agg, rmm::cuda_stream_default, mr);
 }
 
+// Applies several rolling window aggregations over the same fixed-size window.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<rolling_aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  return detail::rolling_window_multi(
+    input, preceding_window, following_window, min_periods, aggs, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -17,15 +17,39 @@
 #ifndef ROLLING_DETAIL_HPP
 #define ROLLING_DETAIL_HPP
 
+#include <cudf/column/column.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/utilities/device_operators.cuh>
 #include <cudf/utilities/traits.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 namespace cudf {
 // helper functions - used in the rolling window implementation and tests
 
 namespace detail {
 
+/**
+ * @brief Applies a fixed-size rolling window function using prefix sums, if possible.
+ *
+ * Fixed windows over prefix-summable aggregations (SUM, MEAN and, for nullable
+ * inputs, COUNT_VALID) do not need the generic one-thread-per-window loop: a
+ * single inclusive scan over the input lets every window value be derived from
+ * two prefix elements, independent of window size. The fast path is limited to
+ * non-boolean integral inputs for SUM/MEAN so that its accumulation order
+ * cannot change results relative to the generic kernel.
+ *
+ * @return The rolling window results, or nullptr if the input or aggregation
+ * is not eligible and the caller must use the generic path.
+ */
+std::unique_ptr<column> rolling_window_prefix_sum(column_view const& input,
+                                                  size_type preceding_window,
+                                                  size_type following_window,
+                                                  size_type min_periods,
+                                                  rolling_aggregation const& agg,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr);
+
 // store functor
 template <typename T, bool is_mean = false>
 struct rolling_store_output_functor {
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rolling_detail.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform_scan.h>
+
+namespace cudf {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Computes the clamped window bounds for an output row, matching the
+ * arithmetic of the generic `gpu_rolling` kernel.
+ */
+struct window_bounds_fn {
+  size_type num_rows;
+  int64_t preceding;
+  int64_t following;
+
+  __device__ thrust::pair<size_type, size_type> operator()(size_type i) const
+  {
+    auto const start = static_cast<size_type>(
+      thrust::min(static_cast<int64_t>(num_rows), thrust::max(int64_t{0}, i - preceding + 1)));
+    auto const end = static_cast<size_type>(
+      thrust::min(static_cast<int64_t>(num_rows), thrust::max(int64_t{0}, i + following + 1)));
+    return {thrust::min(start, end), thrust::max(start, end)};
+  }
+};
+
+/**
+ * @brief Difference of two inclusive-prefix elements, i.e. the sum of
+ * `values[start, end)` that the prefix array was scanned from.
+ */
+template <typename T>
+__device__ T prefix_range_sum(T const* prefix, size_type start, size_type end)
+{
+  if (start >= end) { return T{0}; }
+  return prefix[end - 1] - (start > 0 ? prefix[start - 1] : T{0});
+}
+
+/**
+ * @brief Loads an element widened to the int64_t accumulator, treating nulls
+ * as zero so they do not contribute to window sums.
+ */
+template <typename T>
+struct null_replaced_load_fn {
+  column_device_view d_input;
+  bool has_nulls;
+
+  __device__ int64_t operator()(size_type i) const
+  {
+    if (has_nulls and d_input.is_null_nocheck(i)) { return 0; }
+    return static_cast<int64_t>(d_input.element<T>(i));
+  }
+};
+
+struct valid_count_load_fn {
+  column_device_view d_input;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return d_input.is_valid_nocheck(i) ? 1 : 0;
+  }
+};
+
+/**
+ * @brief Scans the input into an int64_t inclusive prefix-sum array.
+ */
+struct prefix_sum_dispatch_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_index_type<T>())>
+  void operator()(column_view const& input,
+                  device_span<int64_t> prefix_sums,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const d_input = column_device_view::create(input, stream);
+    thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                     thrust::make_counting_iterator<size_type>(0),
+                                     thrust::make_counting_iterator<size_type>(input.size()),
+                                     prefix_sums.begin(),
+                                     null_replaced_load_fn<T>{*d_input, input.has_nulls()},
+                                     thrust::plus<int64_t>{});
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_index_type<T>())>
+  void operator()(column_view const&, device_span<int64_t>, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Prefix-sum rolling windows support only non-boolean integral types");
+  }
+};
+
+template <aggregation::Kind op, typename OutputType>
+struct windowed_value_fn {
+  int64_t const* prefix_sums;     // null-replaced value prefix, SUM/MEAN only
+  size_type const* valid_counts;  // validity prefix, nullptr when input has no nulls
+  window_bounds_fn bounds;
+
+  __device__ OutputType operator()(size_type i) const
+  {
+    auto const window = bounds(i);
+    auto const start  = window.first;
+    auto const end    = window.second;
+    auto const count =
+      valid_counts != nullptr ? prefix_range_sum(valid_counts, start, end) : end - start;
+    if (op == aggregation::COUNT_VALID) { return static_cast<OutputType>(count); }
+    auto const sum = prefix_range_sum(prefix_sums, start, end);
+    if (op == aggregation::MEAN) {
+      // count is always positive when the output is valid
+      return count > 0 ? static_cast<OutputType>(static_cast<double>(sum) / count)
+                       : OutputType{0};
+    }
+    return static_cast<OutputType>(sum);
+  }
+};
+
+/**
+ * @brief Predicate for output row validity, mirroring the generic kernel:
+ * SUM/MEAN require `min_periods` valid inputs, COUNT_VALID requires
+ * `min_periods` window rows.
+ */
+struct windowed_valid_fn {
+  size_type const* valid_counts;
+  window_bounds_fn bounds;
+  size_type min_periods;
+  bool count_window_rows;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const window = bounds(i);
+    auto const start  = window.first;
+    auto const end    = window.second;
+    if (count_window_rows) { return end - start >= min_periods; }
+    auto const count =
+      valid_counts != nullptr ? prefix_range_sum(valid_counts, start, end) : end - start;
+    return count >= min_periods;
+  }
+};
+
+template <aggregation::Kind op, typename OutputType>
+std::unique_ptr<column> make_windowed_output(size_type num_rows,
+                                             int64_t const* prefix_sums,
+                                             size_type const* valid_counts,
+                                             window_bounds_fn bounds,
+                                             size_type min_periods,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_fixed_width_column(
+    data_type{type_to_id<OutputType>()}, num_rows, mask_state::UNINITIALIZED, stream, mr);
+
+  thrust::tabulate(rmm::exec_policy(stream),
+                   output->mutable_view().begin<OutputType>(),
+                   output->mutable_view().end<OutputType>(),
+                   windowed_value_fn<op, OutputType>{prefix_sums, valid_counts, bounds});
+
+  auto [null_mask, null_count] = valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    windowed_valid_fn{
+      valid_counts, bounds, min_periods, op == aggregation::COUNT_VALID},
+    stream,
+    mr);
+  output->set_null_mask(std::move(null_mask), null_count);
+  return output;
+}
+
+}  // namespace
+
+std::unique_ptr<column> rolling_window_prefix_sum(column_view const& input,
+                                                  size_type preceding_window,
+                                                  size_type following_window,
+                                                  size_type min_periods,
+                                                  rolling_aggregation const& agg,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  // COUNT_VALID only profits from prefix sums when the generic path would
+  // otherwise count valid rows with a per-window loop
+  auto const needs_value_prefix = agg.kind == aggregation::SUM or agg.kind == aggregation::MEAN;
+  auto const eligible =
+    (needs_value_prefix and cudf::is_index_type(input.type())) or
+    (agg.kind == aggregation::COUNT_VALID and input.has_nulls());
+  if (not eligible) { return nullptr; }
+
+  auto const num_rows = input.size();
+  auto const bounds   = window_bounds_fn{
+    num_rows, static_cast<int64_t>(preceding_window), static_cast<int64_t>(following_window)};
+
+  rmm::device_uvector<int64_t> prefix_sums(needs_value_prefix ? num_rows : 0, stream);
+  if (needs_value_prefix) {
+    type_dispatcher(
+      input.type(), prefix_sum_dispatch_fn{}, input, device_span<int64_t>{prefix_sums}, stream);
+  }
+
+  rmm::device_uvector<size_type> valid_counts(input.has_nulls() ? num_rows : 0, stream);
+  if (input.has_nulls()) {
+    auto const d_input = column_device_view::create(input, stream);
+    thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                     thrust::make_counting_iterator<size_type>(0),
+                                     thrust::make_counting_iterator<size_type>(num_rows),
+                                     valid_counts.begin(),
+                                     valid_count_load_fn{*d_input},
+                                     thrust::plus<size_type>{});
+  }
+
+  auto const counts_ptr = input.has_nulls() ? valid_counts.data() : nullptr;
+  switch (agg.kind) {
+    case aggregation::SUM:
+      return make_windowed_output<aggregation::SUM, int64_t>(
+        num_rows, prefix_sums.data(), counts_ptr, bounds, min_periods, stream, mr);
+    case aggregation::MEAN:
+      return make_windowed_output<aggregation::MEAN, double>(
+        num_rows, prefix_sums.data(), counts_ptr, bounds, min_periods, stream, mr);
+    case aggregation::COUNT_VALID:
+      return make_windowed_output<aggregation::COUNT_VALID, size_type>(
+        num_rows, nullptr, counts_ptr, bounds, min_periods, stream, mr);
+    default: return nullptr;
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -208,6 +208,7 @@ typename fixed_point_scalar<T>::rep_type const* fixed_point_scalar<T>::data() co
  */
 template class fixed_point_scalar<numeric::decimal32>;
 template class fixed_point_scalar<numeric::decimal64>;
+template class fixed_point_scalar<numeric::decimal128>;
 
 namespace detail {
 
@@ -281,6 +282,7 @@ template class fixed_width_scalar<int8_t>;
 template class fixed_width_scalar<int16_t>;
 template class fixed_width_scalar<int32_t>;
 template class fixed_width_scalar<int64_t>;
+template class fixed_width_scalar<__int128_t>;
 template class fixed_width_scalar<uint8_t>;
 template class fixed_width_scalar<uint16_t>;
 template class fixed_width_scalar<uint32_t>;
@@ -339,6 +341,7 @@ template class numeric_scalar<int8_t>;
 template class numeric_scalar<int16_t>;
 template class numeric_scalar<int32_t>;
 template class numeric_scalar<int64_t>;
+template class numeric_scalar<__int128_t>;
 template class numeric_scalar<uint8_t>;
 template class numeric_scalar<uint16_t>;
 template class numeric_scalar<uint32_t>;
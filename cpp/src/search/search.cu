@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -36,6 +37,8 @@
 
 #include <thrust/binary_search.h>
 
+#include <array>
+
 namespace cudf {
 namespace {
 template <typename DataIterator,
@@ -70,6 +73,165 @@ void launch_search(DataIterator it_data,
   }
 }
 
+/**
+ * @brief Indicates whether a column can take the normalized-key search path.
+ *
+ * Signed and unsigned integers, booleans and chrono types map onto an
+ * order-preserving 64-bit key. Floating point (NaN ordering), fixed point
+ * (per-column scales), dictionaries and nested types stay on the generic
+ * comparator.
+ */
+struct is_normalized_key_supported {
+  template <typename T>
+  constexpr bool operator()() const
+  {
+    return std::is_integral_v<T> or cudf::is_chrono<T>();
+  }
+};
+
+/**
+ * @brief Fills `out` with 64-bit keys that compare like the column's elements.
+ *
+ * Signed values have their sign bit flipped after widening so unsigned
+ * comparison preserves their order; descending columns store the bitwise
+ * complement so a single ascending comparator serves both directions.
+ */
+struct normalize_key_fn {
+  template <typename T, std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+  void operator()(column_view const& col,
+                  uint64_t* out,
+                  bool ascending,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(
+      rmm::exec_policy(stream), col.begin<T>(), col.end<T>(), out, [ascending] __device__(T v) {
+        uint64_t const key = std::is_signed_v<T>
+                               ? static_cast<uint64_t>(static_cast<int64_t>(v)) ^ (uint64_t{1} << 63)
+                               : static_cast<uint64_t>(v);
+        return ascending ? key : ~key;
+      });
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_chrono<T>()>* = nullptr>
+  void operator()(column_view const& col,
+                  uint64_t* out,
+                  bool ascending,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(
+      rmm::exec_policy(stream), col.begin<T>(), col.end<T>(), out, [ascending] __device__(T v) {
+        auto const ticks = [&]() {
+          if constexpr (cudf::is_timestamp<T>()) { return v.time_since_epoch().count(); }
+          else {
+            return v.count();
+          }
+        }();
+        uint64_t const key = static_cast<uint64_t>(static_cast<int64_t>(ticks)) ^ (uint64_t{1} << 63);
+        return ascending ? key : ~key;
+      });
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_integral_v<T> and not cudf::is_chrono<T>()>* = nullptr>
+  void operator()(column_view const&, uint64_t*, bool, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Unsupported type for normalized search keys");
+  }
+};
+
+/**
+ * @brief Compares rows of pre-normalized 64-bit keys, avoiding per-element
+ * type dispatch inside the binary search loop.
+ */
+template <int num_keys>
+struct normalized_key_comparator {
+  uint64_t const* lhs[num_keys];
+  uint64_t const* rhs[num_keys];
+
+  __device__ bool operator()(size_type lhs_index, size_type rhs_index) const
+  {
+    for (int k = 0; k < num_keys; ++k) {
+      uint64_t const l = lhs[k][lhs_index];
+      uint64_t const r = rhs[k][rhs_index];
+      if (l < r) { return true; }
+      if (l > r) { return false; }
+    }
+    return false;
+  }
+};
+
+bool can_use_normalized_search(table_view const& t, table_view const& values)
+{
+  if (t.num_columns() < 1 or t.num_columns() > 2) { return false; }
+  if (t.num_columns() != values.num_columns()) { return false; }
+
+  auto const supported = [](column_view const& col) {
+    return not col.has_nulls() and
+           cudf::type_dispatcher(col.type(), is_normalized_key_supported{});
+  };
+  for (size_type i = 0; i < t.num_columns(); ++i) {
+    if (t.column(i).type() != values.column(i).type()) { return false; }
+    if (not supported(t.column(i)) or not supported(values.column(i))) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Search fast path for one or two null-free fixed-width key columns.
+ *
+ * Each key column is normalized once into order-preserving 64-bit keys
+ * (8 bytes of scratch per key), after which every probe comparison is a plain
+ * unsigned compare instead of a dispatched lexicographic comparison.
+ */
+std::unique_ptr<column> search_ordered_normalized(table_view const& t,
+                                                  table_view const& values,
+                                                  bool find_first,
+                                                  std::vector<order> const& column_order,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, values.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  auto const result_out = result->mutable_view().data<size_type>();
+
+  auto const num_keys = t.num_columns();
+  rmm::device_uvector<uint64_t> t_keys(static_cast<std::size_t>(t.num_rows()) * num_keys, stream);
+  rmm::device_uvector<uint64_t> values_keys(
+    static_cast<std::size_t>(values.num_rows()) * num_keys, stream);
+
+  std::array<uint64_t const*, 2> t_key_ptrs{};
+  std::array<uint64_t const*, 2> values_key_ptrs{};
+  for (size_type i = 0; i < num_keys; ++i) {
+    auto const ascending = column_order.empty() or column_order[i] == order::ASCENDING;
+    auto const t_out     = t_keys.data() + static_cast<std::size_t>(i) * t.num_rows();
+    auto const values_out =
+      values_keys.data() + static_cast<std::size_t>(i) * values.num_rows();
+    cudf::type_dispatcher(t.column(i).type(), normalize_key_fn{}, t.column(i), t_out, ascending, stream);
+    cudf::type_dispatcher(
+      values.column(i).type(), normalize_key_fn{}, values.column(i), values_out, ascending, stream);
+    t_key_ptrs[i]      = t_out;
+    values_key_ptrs[i] = values_out;
+  }
+
+  // Mirror the generic path: thrust passes (haystack, needle) for lower_bound
+  // and (needle, haystack) for upper_bound
+  auto const& lhs = find_first ? t_key_ptrs : values_key_ptrs;
+  auto const& rhs = find_first ? values_key_ptrs : t_key_ptrs;
+
+  auto const count_it = thrust::make_counting_iterator<size_type>(0);
+  if (num_keys == 1) {
+    auto const comp = normalized_key_comparator<1>{{lhs[0]}, {rhs[0]}};
+    launch_search(
+      count_it, count_it, t.num_rows(), values.num_rows(), result_out, comp, find_first, stream);
+  } else {
+    auto const comp = normalized_key_comparator<2>{{lhs[0], lhs[1]}, {rhs[0], rhs[1]}};
+    launch_search(
+      count_it, count_it, t.num_rows(), values.num_rows(), result_out, comp, find_first, stream);
+  }
+
+  return result;
+}
+
 std::unique_ptr<column> search_ordered(table_view const& t,
                                        table_view const& values,
                                        bool find_first,
@@ -96,6 +258,12 @@ std::unique_ptr<column> search_ordered(table_view const& t,
     return result;
   }
 
+  // Null-free tables of one or two integral keys skip the dispatched
+  // lexicographic comparator entirely
+  if (can_use_normalized_search(t, values)) {
+    return search_ordered_normalized(t, values, find_first, column_order, stream, mr);
+  }
+
   // This utility will ensure all corresponding dictionary columns have matching keys.
   // It will return any new dictionary columns created as well as updated table_views.
   auto const matched = dictionary::detail::match_dictionaries({t, values}, stream);
@@ -213,6 +381,79 @@ bool contains(column_view const& col, scalar const& value, rmm::cuda_stream_view
   return cudf::type_dispatcher(col.type(), contains_scalar_dispatch{}, col, value, stream);
 }
 
+/**
+ * @brief Probes a prebuilt hash set of needle values with every element of `haystack`.
+ *
+ * Shared between `contains` (which builds the set per call) and
+ * `contains_lookup` (which builds it once at construction).
+ */
+template <typename Element>
+std::unique_ptr<column> probe_contains_set(
+  cudf::detail::unordered_multiset<Element> const& hash_set,
+  column_view const& haystack,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::unique_ptr<column> result = make_numeric_column(data_type{type_to_id<bool>()},
+                                                       haystack.size(),
+                                                       copy_bitmask(haystack),
+                                                       haystack.null_count(),
+                                                       stream,
+                                                       mr);
+
+  if (haystack.is_empty()) { return result; }
+
+  mutable_column_view result_view = result.get()->mutable_view();
+
+  auto device_hash_set = hash_set.to_device();
+
+  auto d_haystack_ptr = column_device_view::create(haystack, stream);
+  auto d_haystack     = *d_haystack_ptr;
+
+  if (haystack.has_nulls()) {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(haystack.size()),
+                      result_view.begin<bool>(),
+                      [device_hash_set, d_haystack] __device__(size_t index) {
+                        return d_haystack.is_null_nocheck(index) ||
+                               device_hash_set.contains(d_haystack.element<Element>(index));
+                      });
+  } else {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(haystack.size()),
+                      result_view.begin<bool>(),
+                      [device_hash_set, d_haystack] __device__(size_t index) {
+                        return device_hash_set.contains(d_haystack.element<Element>(index));
+                      });
+  }
+
+  return result;
+}
+
+/**
+ * @brief Returns an all-false result column carrying `haystack`'s null mask,
+ * for probes against an empty needle set.
+ */
+std::unique_ptr<column> make_empty_probe_result(column_view const& haystack,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  std::unique_ptr<column> result = make_numeric_column(data_type{type_to_id<bool>()},
+                                                       haystack.size(),
+                                                       copy_bitmask(haystack),
+                                                       haystack.null_count(),
+                                                       stream,
+                                                       mr);
+  if (haystack.is_empty()) { return result; }
+
+  mutable_column_view result_view = result.get()->mutable_view();
+  thrust::fill(
+    rmm::exec_policy(stream), result_view.begin<bool>(), result_view.end<bool>(), false);
+  return result;
+}
+
 struct multi_contains_dispatch {
   template <typename Element>
   std::unique_ptr<column> operator()(column_view const& haystack,
@@ -220,49 +461,12 @@ struct multi_contains_dispatch {
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    std::unique_ptr<column> result = make_numeric_column(data_type{type_to_id<bool>()},
-                                                         haystack.size(),
-                                                         copy_bitmask(haystack),
-                                                         haystack.null_count(),
-                                                         stream,
-                                                         mr);
-
-    if (haystack.is_empty()) { return result; }
-
-    mutable_column_view result_view = result.get()->mutable_view();
-
-    if (needles.is_empty()) {
-      thrust::fill(
-        rmm::exec_policy(stream), result_view.begin<bool>(), result_view.end<bool>(), false);
-      return result;
+    if (haystack.is_empty() || needles.is_empty()) {
+      return make_empty_probe_result(haystack, stream, mr);
     }
 
-    auto hash_set        = cudf::detail::unordered_multiset<Element>::create(needles, stream);
-    auto device_hash_set = hash_set.to_device();
-
-    auto d_haystack_ptr = column_device_view::create(haystack, stream);
-    auto d_haystack     = *d_haystack_ptr;
-
-    if (haystack.has_nulls()) {
-      thrust::transform(rmm::exec_policy(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(haystack.size()),
-                        result_view.begin<bool>(),
-                        [device_hash_set, d_haystack] __device__(size_t index) {
-                          return d_haystack.is_null_nocheck(index) ||
-                                 device_hash_set.contains(d_haystack.element<Element>(index));
-                        });
-    } else {
-      thrust::transform(rmm::exec_policy(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(haystack.size()),
-                        result_view.begin<bool>(),
-                        [device_hash_set, d_haystack] __device__(size_t index) {
-                          return device_hash_set.contains(d_haystack.element<Element>(index));
-                        });
-    }
-
-    return result;
+    auto hash_set = cudf::detail::unordered_multiset<Element>::create(needles, stream);
+    return probe_contains_set(hash_set, haystack, stream, mr);
   }
 };
 
@@ -383,4 +587,134 @@ std::unique_ptr<column> contains(column_view const& haystack,
   return detail::contains(haystack, needles, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @brief Type-erased holder of the prepared needle set.
+ *
+ * The lookup owns a deep copy of the needles: for non-fixed-width elements the
+ * hash set stores views into the needle column's device data, so the copy
+ * guarantees those views stay valid for the lookup's lifetime.
+ */
+struct contains_lookup::impl {
+  virtual ~impl() = default;
+  virtual std::unique_ptr<column> contains(column_view const& haystack,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr) const = 0;
+};
+
+namespace {
+
+/**
+ * @brief Prepared set holding a prebuilt hash set over the needle elements.
+ */
+template <typename Element>
+struct typed_lookup_impl : contains_lookup::impl {
+  std::unique_ptr<column> needles;
+  cudf::detail::unordered_multiset<Element> hash_set;
+
+  typed_lookup_impl(std::unique_ptr<column>&& needles_, rmm::cuda_stream_view stream)
+    : needles{std::move(needles_)},
+      hash_set{cudf::detail::unordered_multiset<Element>::create(needles->view(), stream)}
+  {
+  }
+
+  std::unique_ptr<column> contains(column_view const& haystack,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr) const override
+  {
+    CUDF_EXPECTS(haystack.type() == needles->view().type(), "DTYPE mismatch");
+    if (haystack.is_empty()) { return detail::make_empty_probe_result(haystack, stream, mr); }
+    return detail::probe_contains_set(hash_set, haystack, stream, mr);
+  }
+};
+
+/**
+ * @brief Prepared set with no elements: every probe is false.
+ */
+struct empty_lookup_impl : contains_lookup::impl {
+  data_type type;
+
+  explicit empty_lookup_impl(data_type type_) : type{type_} {}
+
+  std::unique_ptr<column> contains(column_view const& haystack,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr) const override
+  {
+    CUDF_EXPECTS(haystack.type() == type, "DTYPE mismatch");
+    return detail::make_empty_probe_result(haystack, stream, mr);
+  }
+};
+
+/**
+ * @brief Fallback for element types whose probe cannot be prepared ahead of
+ * time (dictionaries re-encode both sides per probe): defers to `contains`.
+ */
+struct deferred_lookup_impl : contains_lookup::impl {
+  std::unique_ptr<column> needles;
+
+  explicit deferred_lookup_impl(std::unique_ptr<column>&& needles_) : needles{std::move(needles_)}
+  {
+  }
+
+  std::unique_ptr<column> contains(column_view const& haystack,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr) const override
+  {
+    return detail::contains(haystack, needles->view(), stream, mr);
+  }
+};
+
+struct lookup_impl_dispatch {
+  template <typename Element>
+  std::unique_ptr<contains_lookup::impl> operator()(std::unique_ptr<column>&& needles,
+                                                    rmm::cuda_stream_view stream)
+  {
+    return std::make_unique<typed_lookup_impl<Element>>(std::move(needles), stream);
+  }
+};
+
+template <>
+std::unique_ptr<contains_lookup::impl> lookup_impl_dispatch::operator()<list_view>(
+  std::unique_ptr<column>&& needles, rmm::cuda_stream_view stream)
+{
+  CUDF_FAIL("list_view type not supported");
+}
+
+template <>
+std::unique_ptr<contains_lookup::impl> lookup_impl_dispatch::operator()<struct_view>(
+  std::unique_ptr<column>&& needles, rmm::cuda_stream_view stream)
+{
+  CUDF_FAIL("struct_view type not supported");
+}
+
+template <>
+std::unique_ptr<contains_lookup::impl> lookup_impl_dispatch::operator()<dictionary32>(
+  std::unique_ptr<column>&& needles, rmm::cuda_stream_view stream)
+{
+  return std::make_unique<deferred_lookup_impl>(std::move(needles));
+}
+
+}  // namespace
+
+contains_lookup::contains_lookup(column_view const& needles, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const stream = rmm::cuda_stream_default;
+  auto needles_copy = std::make_unique<column>(needles, stream, mr);
+  _impl             = needles.is_empty()
+                        ? std::make_unique<empty_lookup_impl>(needles.type())
+                        : cudf::type_dispatcher(
+                            needles.type(), lookup_impl_dispatch{}, std::move(needles_copy), stream);
+}
+
+contains_lookup::contains_lookup(contains_lookup&&) = default;
+contains_lookup& contains_lookup::operator=(contains_lookup&&) = default;
+contains_lookup::~contains_lookup()                            = default;
+
+std::unique_ptr<column> contains_lookup::contains(column_view const& haystack,
+                                                  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->contains(haystack, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+
+result_cursor::result_cursor(table_view const& input,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr)
+  : _input{input}
+{
+  CUDF_FUNC_RANGE();
+  // A stable order keeps the cursor deterministic for equal sort keys
+  _order = detail::stable_sorted_order(
+    input, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+result_cursor::~result_cursor() = default;
+
+std::unique_ptr<table> result_cursor::next_page(size_type max_rows,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(max_rows > 0, "Page size must be positive");
+
+  auto const stream    = rmm::cuda_stream_default;
+  auto const page_rows = std::min(max_rows, _input.num_rows() - _position);
+  if (page_rows == 0) { return empty_like(_input); }
+
+  if (_order) {
+    auto const d_order = _order->view().data<size_type>() + _position;
+    auto page          = detail::gather(_input,
+                               device_span<size_type const>{d_order, std::size_t(page_rows)},
+                               out_of_bounds_policy::DONT_CHECK,
+                               detail::negative_index_policy::NOT_ALLOWED,
+                               stream,
+                               mr);
+    _position += page_rows;
+    return page;
+  }
+
+  // The permutation is spilled: upload only this page's slice of indices
+  rmm::device_uvector<size_type> page_order(page_rows, stream);
+  CUDA_TRY(cudaMemcpyAsync(page_order.data(),
+                           _host_order.data() + _position,
+                           page_rows * sizeof(size_type),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  auto page = detail::gather(_input,
+                             device_span<size_type const>{page_order.data(), page_order.size()},
+                             out_of_bounds_policy::DONT_CHECK,
+                             detail::negative_index_policy::NOT_ALLOWED,
+                             stream,
+                             mr);
+  _position += page_rows;
+  return page;
+}
+
+void result_cursor::seek(size_type position)
+{
+  CUDF_EXPECTS(position >= 0 and position <= _input.num_rows(), "Seek position out of range");
+  _position = position;
+}
+
+void result_cursor::spill()
+{
+  CUDF_FUNC_RANGE();
+  if (not _order) { return; }
+  auto const stream = rmm::cuda_stream_default;
+  _host_order.resize(_input.num_rows());
+  CUDA_TRY(cudaMemcpyAsync(_host_order.data(),
+                           _order->view().data<size_type>(),
+                           _host_order.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+  _order.reset();
+}
+
+}  // namespace cudf
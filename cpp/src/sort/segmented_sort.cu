@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
@@ -24,6 +27,9 @@
 #include <thrust/binary_search.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+
+#include <cub/cub.cuh>
 
 namespace cudf {
 namespace detail {
@@ -55,6 +61,80 @@ rmm::device_uvector<size_type> get_segment_indices(size_type num_rows,
   return segment_ids;
 }
 
+/**
+ * @brief Type-dispatched functor for sorting a single integral key column per
+ * segment with cub's segmented radix sort.
+ */
+struct segmented_radix_sort_fn {
+  template <typename T, typename std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& keys,
+                                     column_view const& segment_offsets,
+                                     bool ascending,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    auto const num_rows     = keys.size();
+    auto const num_segments = segment_offsets.size() - 1;
+
+    auto sorted_indices = cudf::make_numeric_column(
+      data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+    auto indices_view = sorted_indices->mutable_view();
+
+    rmm::device_uvector<size_type> input_indices(num_rows, stream);
+    thrust::sequence(rmm::exec_policy(stream), input_indices.begin(), input_indices.end(), 0);
+    rmm::device_uvector<T> output_keys(num_rows, stream);
+
+    auto const d_keys    = keys.data<T>();
+    auto const d_offsets = segment_offsets.begin<size_type>();
+
+    auto sort = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+      if (ascending) {
+        CUDA_TRY(cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_keys,
+                                                          output_keys.data(),
+                                                          input_indices.data(),
+                                                          indices_view.begin<size_type>(),
+                                                          num_rows,
+                                                          num_segments,
+                                                          d_offsets,
+                                                          d_offsets + 1,
+                                                          0,
+                                                          static_cast<int>(sizeof(T) * 8),
+                                                          stream.value()));
+      } else {
+        CUDA_TRY(
+          cub::DeviceSegmentedRadixSort::SortPairsDescending(d_temp_storage,
+                                                             temp_storage_bytes,
+                                                             d_keys,
+                                                             output_keys.data(),
+                                                             input_indices.data(),
+                                                             indices_view.begin<size_type>(),
+                                                             num_rows,
+                                                             num_segments,
+                                                             d_offsets,
+                                                             d_offsets + 1,
+                                                             0,
+                                                             static_cast<int>(sizeof(T) * 8),
+                                                             stream.value()));
+      }
+    };
+    size_t temp_storage_bytes{0};
+    sort(nullptr, temp_storage_bytes);
+    rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+    sort(d_temp_storage.data(), temp_storage_bytes);
+
+    return sorted_indices;
+  }
+
+  template <typename T, typename std::enable_if_t<!std::is_integral_v<T>>* = nullptr>
+  std::unique_ptr<column> operator()(
+    column_view const&, column_view const&, bool, rmm::cuda_stream_view, rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("Only integral key types are suitable for segmented radix sorting");
+  }
+};
+
 std::unique_ptr<column> segmented_sorted_order_common(
   table_view const& keys,
   column_view const& segment_offsets,
@@ -66,6 +146,29 @@ std::unique_ptr<column> segmented_sorted_order_common(
 {
   CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
                "segment offsets should be size_type");
+
+  // Fast path: a single integral key column without nulls whose segment offsets cover
+  // all rows can be sorted by one cub segmented radix sort pass instead of a full
+  // lexicographic sort over (segment id, key) pairs. The radix sort is stable, so it
+  // serves the stable variant as well.
+  if (keys.num_columns() == 1 and keys.num_rows() > 0 and segment_offsets.size() > 1 and
+      not keys.column(0).has_nulls() and cudf::is_numeric(keys.column(0).type()) and
+      not cudf::is_floating_point(keys.column(0).type())) {
+    auto const first_offset = detail::get_value<size_type>(segment_offsets, 0, stream);
+    auto const last_offset =
+      detail::get_value<size_type>(segment_offsets, segment_offsets.size() - 1, stream);
+    if (first_offset == 0 and last_offset == keys.num_rows()) {
+      bool const ascending = column_order.empty() or column_order.front() == order::ASCENDING;
+      return type_dispatcher(keys.column(0).type(),
+                             segmented_radix_sort_fn{},
+                             keys.column(0),
+                             segment_offsets,
+                             ascending,
+                             stream,
+                             mr);
+    }
+  }
+
   // Get segment id of each element in all segments.
   auto segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
 
@@ -106,7 +106,7 @@ std::unique_ptr<column> sorted_order(table_view const& input,
                                      std::vector<null_order> const& null_precedence,
                                      rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return detail::sorted_order(input, column_order, null_precedence, rmm::cuda_stream_default, mr);
 }
 
@@ -115,7 +115,7 @@ std::unique_ptr<table> sort(table_view const& input,
                             std::vector<null_order> const& null_precedence,
                             rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return detail::sort(input, column_order, null_precedence, rmm::cuda_stream_default, mr);
 }
 
@@ -125,7 +125,7 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
                                    std::vector<null_order> const& null_precedence,
                                    rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(keys.num_rows());
   return detail::sort_by_key(
     values, keys, column_order, null_precedence, rmm::cuda_stream_default, mr);
 }
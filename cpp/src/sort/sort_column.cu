@@ -16,6 +16,10 @@
 
 #include <sort/sort_impl.cuh>
 
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/partition.h>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -74,6 +78,76 @@ struct column_sorted_order_fn {
     CUDF_FAIL("Only fixed-width types are suitable for faster sorting");
   }
 
+  /**
+   * @brief Sorts nullable fixed-width columns using faster thrust sort.
+   *
+   * The row indices are partitioned into valid and null rows; the valid rows are then
+   * sorted by key with the radix-based thrust sort and the null rows are placed before
+   * or after them as requested by the null order.
+   *
+   * @param input Column to sort
+   * @param indices Output sorted indices
+   * @param ascending True if sort order is ascending
+   * @param null_precedence How null rows are to be ordered
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  template <typename T, typename std::enable_if_t<is_radix_sort_supported<T>()>* = nullptr>
+  void radix_sort_nullable(column_view const& input,
+                           mutable_column_view& indices,
+                           bool ascending,
+                           null_order null_precedence,
+                           rmm::cuda_stream_view stream)
+  {
+    auto const num_rows  = input.size();
+    auto const num_nulls = input.null_count();
+    auto const d_input   = column_device_view::create(input, stream);
+    auto const d_col     = *d_input;
+
+    rmm::device_uvector<size_type> valid_indices(num_rows - num_nulls, stream);
+    rmm::device_uvector<size_type> null_indices(num_nulls, stream);
+    thrust::partition_copy(
+      rmm::exec_policy(stream),
+      thrust::counting_iterator<size_type>(0),
+      thrust::counting_iterator<size_type>(num_rows),
+      valid_indices.begin(),
+      null_indices.begin(),
+      [d_col] __device__(size_type index) { return d_col.is_valid_nocheck(index); });
+
+    rmm::device_uvector<T> keys(valid_indices.size(), stream);
+    thrust::gather(rmm::exec_policy(stream),
+                   valid_indices.begin(),
+                   valid_indices.end(),
+                   input.data<T>(),
+                   keys.begin());
+    if (ascending) {
+      thrust::sort_by_key(rmm::exec_policy(stream),
+                          keys.begin(),
+                          keys.end(),
+                          valid_indices.begin(),
+                          thrust::less<T>());
+    } else {
+      thrust::sort_by_key(rmm::exec_policy(stream),
+                          keys.begin(),
+                          keys.end(),
+                          valid_indices.begin(),
+                          thrust::greater<T>());
+    }
+
+    // nulls are placed first when the null order matches the sort direction
+    bool const nulls_first = ascending == (null_precedence == null_order::BEFORE);
+    auto const output      = indices.begin<size_type>();
+    auto const valid_begin = nulls_first ? output + num_nulls : output;
+    auto const null_begin  = nulls_first ? output : output + valid_indices.size();
+    thrust::copy(rmm::exec_policy(stream), valid_indices.begin(), valid_indices.end(), valid_begin);
+    thrust::copy(rmm::exec_policy(stream), null_indices.begin(), null_indices.end(), null_begin);
+  }
+  template <typename T, typename std::enable_if_t<!is_radix_sort_supported<T>()>* = nullptr>
+  void radix_sort_nullable(
+    column_view const&, mutable_column_view&, bool, null_order, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only fixed-width types are suitable for faster sorting");
+  }
+
   /**
    * @brief Sorts a single column with a relationally comparable type.
    *
@@ -93,13 +167,15 @@ struct column_sorted_order_fn {
                   null_order null_precedence,
                   rmm::cuda_stream_view stream)
   {
-    // column with nulls or non-supported types will also use a comparator
-    if (input.has_nulls() || !is_radix_sort_supported<T>()) {
+    // non-supported types will use a comparator
+    if (!is_radix_sort_supported<T>()) {
       auto keys = column_device_view::create(input, stream);
       thrust::sort(rmm::exec_policy(stream),
                    indices.begin<size_type>(),
                    indices.end<size_type>(),
                    simple_comparator<T>{*keys, input.has_nulls(), ascending, null_precedence});
+    } else if (input.has_nulls()) {
+      radix_sort_nullable<T>(input, indices, ascending, null_precedence, stream);
     } else {
       radix_sort<T>(input, indices, ascending, stream);
     }
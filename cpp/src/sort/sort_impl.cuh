@@ -32,6 +32,8 @@
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 
@@ -123,11 +125,23 @@ std::unique_ptr<column> sorted_order(table_view input,
                    mutable_indices_view.end<size_type>(),
                    0);
 
-  auto flattened    = structs::detail::flatten_nested_columns(input, column_order, null_precedence);
+  // STRUCT columns whose members are all non-nested are compared in place by the
+  // struct-aware element comparator; only deeper nesting pays for flattening.
+  auto const single_level_structs =
+    std::all_of(input.begin(), input.end(), [](column_view const& col) {
+      return col.type().id() != type_id::STRUCT or
+             std::all_of(col.child_begin(), col.child_end(), [](column_view const& child) {
+               return not is_nested(child.type());
+             });
+    });
+  auto const flattened =
+    single_level_structs
+      ? structs::detail::flattened_table{input, column_order, null_precedence, {}, {}}
+      : structs::detail::flatten_nested_columns(input, column_order, null_precedence);
   auto device_table = table_device_view::create(flattened, stream);
   auto const d_column_order = make_device_uvector_async(flattened.orders(), stream);
 
-  if (has_nulls(flattened)) {
+  if (has_nested_nulls(flattened)) {
     auto const d_null_precedence = make_device_uvector_async(flattened.null_orders(), stream);
     auto const comparator        = row_lexicographic_comparator<true>(
       *device_table, *device_table, d_column_order.data(), d_null_precedence.data());
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Number of rows per candidate-selection segment; segments are sorted independently
+// and only their first k rows survive to the final sort.
+constexpr size_type top_k_segment_size = 4096;
+
+/**
+ * @brief Computes the indices of the top `k` rows of a single key column without a
+ * full-table sort.
+ *
+ * The column is cut into fixed-size segments that are sorted independently through
+ * the segmented radix fast path. Only the first `k` rows of each segment can belong
+ * to the overall top `k`, so only those candidates see the final sort.
+ */
+std::unique_ptr<column> top_k_order(column_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows     = keys.size();
+  auto const num_segments = util::div_rounding_up_safe(num_rows, top_k_segment_size);
+
+  rmm::device_uvector<size_type> offsets(num_segments + 1, stream);
+  thrust::tabulate(
+    rmm::exec_policy(stream), offsets.begin(), offsets.end(), [num_rows] __device__(size_type i) {
+      return std::min(i * top_k_segment_size, num_rows);
+    });
+
+  auto const keys_table = table_view{{keys}};
+  auto const segment_order = detail::segmented_sorted_order(
+    keys_table,
+    column_view(data_type(type_to_id<size_type>()), num_segments + 1, offsets.data()),
+    column_order,
+    null_precedence,
+    stream,
+    rmm::mr::get_current_device_resource());
+
+  // keep the first k rows of every segment as candidates
+  rmm::device_uvector<size_type> candidates(num_segments * k, stream);
+  auto const d_segment_order = segment_order->view().begin<size_type>();
+  auto const candidates_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    d_segment_order,
+                    d_segment_order + num_rows,
+                    thrust::counting_iterator<size_type>(0),
+                    candidates.begin(),
+                    [k] __device__(size_type i) { return i % top_k_segment_size < k; });
+  auto const num_candidates =
+    static_cast<size_type>(thrust::distance(candidates.begin(), candidates_end));
+
+  // sort the candidate keys and keep the top k of them
+  auto const candidate_indices =
+    column_view(data_type(type_to_id<size_type>()), num_candidates, candidates.data());
+  auto const candidate_keys = detail::gather(keys_table,
+                                             candidate_indices,
+                                             out_of_bounds_policy::DONT_CHECK,
+                                             detail::negative_index_policy::NOT_ALLOWED,
+                                             stream,
+                                             rmm::mr::get_current_device_resource());
+  auto const candidate_order = detail::sorted_order(candidate_keys->view(),
+                                                    column_order,
+                                                    null_precedence,
+                                                    stream,
+                                                    rmm::mr::get_current_device_resource());
+
+  // map the top k candidate positions back to rows of the input
+  auto top_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), k, mask_state::UNALLOCATED, stream, mr);
+  thrust::gather(rmm::exec_policy(stream),
+                 candidate_order->view().begin<size_type>(),
+                 candidate_order->view().begin<size_type>() + k,
+                 candidates.begin(),
+                 top_indices->mutable_view().begin<size_type>());
+  return top_indices;
+}
+
+}  // namespace
+
+std::unique_ptr<table> top_k(table_view const& input,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "Number of rows to select must not be negative");
+  if (k == 0 or input.num_rows() == 0 or input.num_columns() == 0) { return empty_like(input); }
+  if (k >= input.num_rows()) {
+    return detail::sort(input, column_order, null_precedence, stream, mr);
+  }
+
+  // candidate selection requires a key type the segmented radix fast path supports
+  auto const use_selection = input.num_columns() == 1 and not input.column(0).has_nulls() and
+                             cudf::is_numeric(input.column(0).type()) and
+                             not cudf::is_floating_point(input.column(0).type()) and
+                             k < top_k_segment_size and
+                             input.num_rows() > 2 * top_k_segment_size;
+
+  auto const indices = use_selection ? top_k_order(input.column(0),
+                                                   k,
+                                                   column_order,
+                                                   null_precedence,
+                                                   stream,
+                                                   rmm::mr::get_current_device_resource())
+                                     : detail::sorted_order(input,
+                                                            column_order,
+                                                            null_precedence,
+                                                            stream,
+                                                            rmm::mr::get_current_device_resource());
+
+  auto const top = detail::slice(indices->view(), 0, k);
+  return detail::gather(input,
+                        top,
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> top_k(table_view const& input,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(input, k, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -15,17 +15,28 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/column/packed_bools.hpp>
 #include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/managed.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
 
@@ -52,14 +63,66 @@ struct boolean_mask_filter {
   cudf::column_device_view boolean_mask;
 };
 
+// Returns true if bit i of the packed mask is set
+// This is the filter functor for the packed_bools overload of apply_boolean_mask
+struct packed_bool_filter {
+  packed_bool_filter(cudf::bitmask_type const* bits) : bits{bits} {}
+
+  __device__ inline bool operator()(cudf::size_type i) { return cudf::bit_is_set(bits, i); }
+
+ protected:
+  cudf::bitmask_type const* bits;
+};
+
 }  // namespace
 
 namespace cudf {
 namespace detail {
+/*
+ * Converts a boolean mask into a gather map of the passing row indices.
+ *
+ * Runs a single copy_if of the row indices through the `boolean_mask_filter`
+ * functor, so the mask is scanned exactly once.
+ */
+std::unique_ptr<column> mask_to_gather_map(column_view const& boolean_mask,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+
+  if (boolean_mask.is_empty()) { return make_empty_column(type_to_id<size_type>()); }
+
+  auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
+
+  rmm::device_uvector<size_type> indices(boolean_mask.size(), stream, mr);
+  auto const begin = thrust::make_counting_iterator<size_type>(0);
+  auto const end   = begin + boolean_mask.size();
+  auto const indices_end =
+    boolean_mask.has_nulls()
+      ? thrust::copy_if(rmm::exec_policy(stream),
+                        begin,
+                        end,
+                        indices.begin(),
+                        boolean_mask_filter<true>{*device_boolean_mask})
+      : thrust::copy_if(rmm::exec_policy(stream),
+                        begin,
+                        end,
+                        indices.begin(),
+                        boolean_mask_filter<false>{*device_boolean_mask});
+
+  auto const output_size = static_cast<size_type>(thrust::distance(indices.begin(), indices_end));
+  indices.resize(output_size, stream);
+  indices.shrink_to_fit(stream);
+  return std::make_unique<column>(
+    data_type{type_to_id<size_type>()}, output_size, indices.release());
+}
+
 /*
  * Filters a table_view using a column_view of boolean values as a mask.
  *
- * calls copy_if() with the `boolean_mask_filter` functor.
+ * Single-column inputs call copy_if() with the `boolean_mask_filter` functor.
+ * Wider tables materialize the gather map once and gather all columns through
+ * it, instead of re-evaluating the mask for every column as copy_if does.
  */
 std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           column_view const& boolean_mask,
@@ -73,6 +136,19 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size(),
                "Column size mismatch");
 
+  // page managed-memory inputs onto the device before the filter touches them
+  detail::prefetch(input, stream);
+
+  if (input.num_rows() > 0 && input.num_columns() > 1) {
+    auto gather_map = detail::mask_to_gather_map(boolean_mask, stream);
+    return detail::gather(input,
+                          gather_map->view(),
+                          out_of_bounds_policy::DONT_CHECK,
+                          detail::negative_index_policy::NOT_ALLOWED,
+                          stream,
+                          mr);
+  }
+
   auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
 
   if (boolean_mask.has_nulls()) {
@@ -82,6 +158,56 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   }
 }
 
+/*
+ * Filters a table using a column_view of boolean values as a mask, consuming the
+ * input table.
+ *
+ * Materializes the surviving row indices once, then gathers column by column
+ * through the consuming gather so each input column is freed as soon as it has
+ * been filtered.
+ */
+std::unique_ptr<table> apply_boolean_mask(std::unique_ptr<table>&& input,
+                                          column_view const& boolean_mask,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  if (boolean_mask.is_empty()) { return empty_like(input->view()); }
+
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+  // zero-size inputs are OK, but otherwise input size must match mask size
+  CUDF_EXPECTS(input->num_rows() == 0 || input->num_rows() == boolean_mask.size(),
+               "Column size mismatch");
+
+  auto gather_map = detail::mask_to_gather_map(boolean_mask, stream);
+
+  return detail::gather(std::move(input),
+                        gather_map->view(),
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+/*
+ * Filters a table_view using a bit-packed boolean column as a mask.
+ *
+ * The packed representation has no separate validity, so a single copy_if
+ * through `packed_bool_filter` suffices for any input width.
+ */
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          packed_bools const& boolean_mask,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  if (boolean_mask.size() == 0) { return empty_like(input); }
+
+  // zero-size inputs are OK, but otherwise input size must match mask size
+  CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size(),
+               "Column size mismatch");
+
+  return detail::copy_if(input, packed_bool_filter{boolean_mask.data()}, stream, mr);
+}
+
 }  // namespace detail
 
 /*
@@ -91,7 +217,39 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           column_view const& boolean_mask,
                                           rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return detail::apply_boolean_mask(input, boolean_mask, rmm::cuda_stream_default, mr);
 }
+
+/*
+ * Filters a table using a column_view of boolean values as a mask, consuming the input.
+ */
+std::unique_ptr<table> apply_boolean_mask(std::unique_ptr<table>&& input,
+                                          column_view const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input->num_rows());
+  return detail::apply_boolean_mask(std::move(input), boolean_mask, rmm::cuda_stream_default, mr);
+}
+
+/*
+ * Filters a table_view using a bit-packed boolean column as a mask.
+ */
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          packed_bools const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
+  return detail::apply_boolean_mask(input, boolean_mask, rmm::cuda_stream_default, mr);
+}
+
+/*
+ * Converts a boolean mask into a gather map of the passing row indices.
+ */
+std::unique_ptr<column> mask_to_gather_map(column_view const& boolean_mask,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(boolean_mask.size());
+  return detail::mask_to_gather_map(boolean_mask, rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/concurrent_unordered_map.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/structs/utilities.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+
+#include <limits>
+
+namespace cudf {
+
+namespace {
+
+using map_type = concurrent_unordered_map<cudf::size_type,
+                                          bool,
+                                          cudf::detail::row_hash,
+                                          cudf::detail::row_equality>;
+
+}  // namespace
+
+namespace detail {
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                null_equality nulls_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  if (0 == input.num_rows() || 0 == input.num_columns() || 0 == keys.size()) {
+    return empty_like(input);
+  }
+
+  auto const num_rows   = input.num_rows();
+  auto const keys_view  = input.select(keys);
+  auto keys_flattened   = structs::detail::flatten_nested_columns(
+    keys_view, {}, {}, structs::detail::column_nullability::FORCE);
+  auto const keys_rows_d = table_device_view::create(keys_flattened.flattened_columns(), stream);
+
+  bool const nulls_are_equal = (nulls_equal == null_equality::EQUAL);
+  cudf::detail::row_hash hash_key{*keys_rows_d};
+  cudf::detail::row_equality equality_key{*keys_rows_d, *keys_rows_d, nulls_are_equal};
+
+  auto map_ptr = map_type::create(compute_hash_table_size(num_rows),
+                                  stream,
+                                  std::numeric_limits<bool>::max(),
+                                  std::numeric_limits<cudf::size_type>::max(),
+                                  hash_key,
+                                  equality_key);
+  auto map     = *map_ptr;
+
+  // if nulls_equal == UNEQUAL, rows containing a NULL in any key column never
+  // compare equal to anything, so they are always distinct and are kept out of
+  // the hash set.
+  auto const row_bitmask =
+    nulls_are_equal ? rmm::device_buffer{}
+                    : cudf::detail::bitmask_and(keys_flattened.flattened_columns(), stream).first;
+
+  // The first thread to claim a key wins; which of several duplicate rows that
+  // is depends on the insertion race, so the surviving row is unspecified.
+  rmm::device_uvector<bool> is_distinct(num_rows, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    [map,
+     is_distinct = is_distinct.data(),
+     row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(
+      size_type idx) mutable {
+      if (row_bitmask && !cudf::bit_is_set(row_bitmask, idx)) {
+        is_distinct[idx] = true;
+        return;
+      }
+      is_distinct[idx] = map.insert(thrust::make_pair(idx, true)).second;
+    });
+
+  rmm::device_uvector<size_type> distinct_indices(num_rows, stream);
+  auto const distinct_indices_end = thrust::copy_if(rmm::exec_policy(stream),
+                                                    thrust::make_counting_iterator<size_type>(0),
+                                                    thrust::make_counting_iterator(num_rows),
+                                                    is_distinct.begin(),
+                                                    distinct_indices.begin(),
+                                                    thrust::identity<bool>{});
+  auto const num_distinct = static_cast<size_type>(
+    thrust::distance(distinct_indices.begin(), distinct_indices_end));
+
+  auto const gather_map =
+    column_view(data_type{type_id::INT32}, num_distinct, distinct_indices.data());
+  return cudf::detail::gather(input,
+                              gather_map,
+                              out_of_bounds_policy::DONT_CHECK,
+                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                null_equality nulls_equal,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
+  return detail::distinct(input, keys, nulls_equal, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/concurrent_unordered_map.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/structs/utilities.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+
+namespace {
+
+using map_type = concurrent_unordered_map<cudf::size_type,
+                                          bool,
+                                          cudf::detail::row_hash,
+                                          cudf::detail::row_equality>;
+
+using map_ptr_type = std::unique_ptr<map_type, std::function<void(map_type*)>>;
+
+}  // namespace
+
+struct distinct_builder::distinct_builder_impl {
+  distinct_builder_impl(cudf::table_view const& initial,
+                        null_equality nulls_equal,
+                        rmm::cuda_stream_view stream)
+    : _nulls_equal{nulls_equal}, _seen{empty_like(initial)}
+  {
+    CUDF_EXPECTS(0 != initial.num_columns(), "Distinct builder key table is empty");
+
+    create_map(compute_hash_table_size(std::max(initial.num_rows(), size_type{1})), stream);
+
+    if (initial.num_rows() > 0) { insert(initial, stream, rmm::mr::get_current_device_resource()); }
+  }
+
+  std::unique_ptr<table> insert(cudf::table_view const& batch,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+  {
+    auto const seen = _seen->view();
+    CUDF_EXPECTS(batch.num_columns() == seen.num_columns(),
+                 "Mismatch in number of columns to be inserted");
+    CUDF_EXPECTS(std::equal(batch.begin(),
+                            batch.end(),
+                            seen.begin(),
+                            [](auto const& lhs, auto const& rhs) { return lhs.type() == rhs.type(); }),
+                 "Mismatch in types of columns to be inserted");
+
+    auto const batch_num_rows = batch.num_rows();
+    auto const seen_num_rows  = seen.num_rows();
+    if (batch_num_rows == 0) { return empty_like(batch); }
+
+    // Grow the persistent set up front so this whole batch fits at the target
+    // occupancy. Growth re-inserts only the previously seen keys and doubles
+    // the capacity, so its cost is amortized over the rows that filled it.
+    auto const required_size = compute_hash_table_size(seen_num_rows + batch_num_rows);
+    if (required_size > static_cast<std::size_t>(_map->capacity())) {
+      create_map(std::max(required_size, 2 * static_cast<std::size_t>(_map->capacity())), stream);
+    }
+
+    auto seen_flattened = structs::detail::flatten_nested_columns(
+      seen, {}, {}, structs::detail::column_nullability::FORCE);
+    auto batch_flattened = structs::detail::flatten_nested_columns(
+      batch, {}, {}, structs::detail::column_nullability::FORCE);
+
+    auto seen_rows_d  = table_device_view::create(seen_flattened.flattened_columns(), stream);
+    auto batch_rows_d = table_device_view::create(batch_flattened.flattened_columns(), stream);
+
+    bool const nulls_are_equal = (_nulls_equal == null_equality::EQUAL);
+    cudf::detail::row_hash hash_batch{*batch_rows_d};
+    cudf::detail::row_equality equality_probe{*batch_rows_d, *seen_rows_d, nulls_are_equal};
+    cudf::detail::row_equality equality_batch{*batch_rows_d, *batch_rows_d, nulls_are_equal};
+
+    // A batch-local map drops duplicates within the batch itself; the first
+    // thread to claim a key wins, so exactly one duplicate row is emitted.
+    auto batch_map_ptr = map_type::create(compute_hash_table_size(batch_num_rows),
+                                          stream,
+                                          std::numeric_limits<bool>::max(),
+                                          std::numeric_limits<cudf::size_type>::max(),
+                                          hash_batch,
+                                          equality_batch);
+    auto batch_map     = *batch_map_ptr;
+    auto seen_map      = *_map;
+
+    // if _nulls_equal == UNEQUAL, rows containing a NULL in any key column
+    // never compare equal to anything, so they are always newly seen and are
+    // kept out of both hash sets.
+    auto const row_bitmask =
+      (_nulls_equal == null_equality::EQUAL)
+        ? rmm::device_buffer{}
+        : cudf::detail::bitmask_and(batch_flattened.flattened_columns(), stream).first;
+
+    rmm::device_uvector<bool> is_new(batch_num_rows, stream);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      batch_num_rows,
+      [seen_map,
+       batch_map,
+       hash_batch,
+       equality_probe,
+       is_new      = is_new.data(),
+       row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(
+        size_type idx) mutable {
+        if (row_bitmask && !cudf::bit_is_set(row_bitmask, idx)) {
+          is_new[idx] = true;
+          return;
+        }
+        if (seen_map.find(idx, hash_batch, equality_probe) != seen_map.end()) {
+          is_new[idx] = false;
+          return;
+        }
+        is_new[idx] = batch_map.insert(thrust::make_pair(idx, true)).second;
+      });
+
+    rmm::device_uvector<size_type> new_indices(batch_num_rows, stream);
+    auto const new_indices_end = thrust::copy_if(rmm::exec_policy(stream),
+                                                 thrust::make_counting_iterator<size_type>(0),
+                                                 thrust::make_counting_iterator(batch_num_rows),
+                                                 is_new.begin(),
+                                                 new_indices.begin(),
+                                                 thrust::identity<bool>{});
+    auto const num_new = static_cast<size_type>(
+      thrust::distance(new_indices.begin(), new_indices_end));
+    if (num_new == 0) { return empty_like(batch); }
+
+    auto const gather_map =
+      column_view(data_type{type_id::INT32}, num_new, new_indices.data());
+    auto new_rows = cudf::detail::gather(batch,
+                                         gather_map,
+                                         out_of_bounds_policy::DONT_CHECK,
+                                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                         stream,
+                                         mr);
+
+    // Append the newly seen rows to the history and register them in the
+    // persistent set under their final row indices. Only the new rows are
+    // hashed; the history's entries remain valid because a row's hash depends
+    // only on its values, which an append never changes.
+    _seen = cudf::detail::concatenate(std::vector<table_view>{seen, new_rows->view()}, stream);
+
+    insert_seen_rows(seen_num_rows, num_new, stream);
+
+    return new_rows;
+  }
+
+  size_type num_seen() const { return _seen->num_rows(); }
+
+ private:
+  /**
+   * @brief (Re)creates the persistent map with the given capacity and inserts
+   * all previously seen keys.
+   */
+  void create_map(std::size_t capacity, rmm::cuda_stream_view stream)
+  {
+    auto const seen_num_rows = _seen->num_rows();
+
+    auto seen_flattened = structs::detail::flatten_nested_columns(
+      _seen->view(), {}, {}, structs::detail::column_nullability::FORCE);
+    auto seen_rows_d = table_device_view::create(seen_flattened.flattened_columns(), stream);
+
+    // The functors handed to create() reference device views of the current
+    // history, which are rebuilt on every insert. All later map operations
+    // therefore use the insert/find overloads taking explicit functors; the
+    // stored ones are never used again after this function returns.
+    cudf::detail::row_hash hash_seen{*seen_rows_d};
+    cudf::detail::row_equality equality_seen{
+      *seen_rows_d, *seen_rows_d, _nulls_equal == null_equality::EQUAL};
+
+    _map = map_type::create(capacity,
+                            stream,
+                            std::numeric_limits<bool>::max(),
+                            std::numeric_limits<cudf::size_type>::max(),
+                            hash_seen,
+                            equality_seen);
+
+    if (seen_num_rows > 0) { insert_seen_rows(0, seen_num_rows, stream); }
+  }
+
+  /**
+   * @brief Inserts history rows `[first, first + count)` into the persistent map.
+   */
+  void insert_seen_rows(size_type first, size_type count, rmm::cuda_stream_view stream)
+  {
+    auto seen_flattened = structs::detail::flatten_nested_columns(
+      _seen->view(), {}, {}, structs::detail::column_nullability::FORCE);
+    auto seen_rows_d = table_device_view::create(seen_flattened.flattened_columns(), stream);
+
+    cudf::detail::row_hash hash_seen{*seen_rows_d};
+    cudf::detail::row_equality equality_seen{
+      *seen_rows_d, *seen_rows_d, _nulls_equal == null_equality::EQUAL};
+
+    auto const row_bitmask =
+      (_nulls_equal == null_equality::EQUAL)
+        ? rmm::device_buffer{}
+        : cudf::detail::bitmask_and(seen_flattened.flattened_columns(), stream).first;
+
+    auto seen_map = *_map;
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(first),
+      count,
+      [seen_map,
+       hash_seen,
+       equality_seen,
+       row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(
+        size_type idx) mutable {
+        if (!row_bitmask || cudf::bit_is_set(row_bitmask, idx)) {
+          seen_map.insert(thrust::make_pair(idx, true), hash_seen, equality_seen);
+        }
+      });
+  }
+
+  null_equality _nulls_equal;
+  std::unique_ptr<cudf::table> _seen;
+  map_ptr_type _map;
+};
+
+distinct_builder::~distinct_builder() = default;
+
+distinct_builder::distinct_builder(cudf::table_view const& initial,
+                                   null_equality nulls_equal,
+                                   rmm::cuda_stream_view stream)
+  : impl{std::make_unique<distinct_builder_impl>(initial, nulls_equal, stream)}
+{
+}
+
+std::unique_ptr<table> distinct_builder::insert(cudf::table_view const& batch,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return impl->insert(batch, stream, mr);
+}
+
+size_type distinct_builder::num_seen() const { return impl->num_seen(); }
+
+}  // namespace cudf
@@ -156,7 +156,7 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
                                        null_order null_precedence,
                                        rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return detail::drop_duplicates(
     input, keys, keep, nulls_equal, null_precedence, rmm::cuda_stream_default, mr);
 }
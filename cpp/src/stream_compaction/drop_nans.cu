@@ -114,7 +114,7 @@ std::unique_ptr<table> drop_nans(table_view const& input,
                                  cudf::size_type keep_threshold,
                                  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return cudf::detail::drop_nans(input, keys, keep_threshold, rmm::cuda_stream_default, mr);
 }
 /*
@@ -124,7 +124,7 @@ std::unique_ptr<table> drop_nans(table_view const& input,
                                  std::vector<size_type> const& keys,
                                  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return cudf::detail::drop_nans(input, keys, keys.size(), rmm::cuda_stream_default, mr);
 }
 
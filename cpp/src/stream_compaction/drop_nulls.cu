@@ -87,7 +87,7 @@ std::unique_ptr<table> drop_nulls(table_view const& input,
                                   cudf::size_type keep_threshold,
                                   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return cudf::detail::drop_nulls(input, keys, keep_threshold, rmm::cuda_stream_default, mr);
 }
 /*
@@ -97,7 +97,7 @@ std::unique_ptr<table> drop_nulls(table_view const& input,
                                   std::vector<size_type> const& keys,
                                   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
   return cudf::detail::drop_nulls(input, keys, keys.size(), rmm::cuda_stream_default, mr);
 }
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/expression_evaluator.cuh>
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace {
+
+// Upper bound on the AST intermediate storage the fused filter keeps in
+// thread-local memory. Expressions needing more intermediates fall back to
+// materializing the boolean mask.
+constexpr cudf::size_type max_fused_filter_intermediates = 8;
+
+/**
+ * @brief Filter functor that evaluates an AST predicate for a single row.
+ *
+ * This is the filter functor for the fused `cudf::filter`: the predicate is
+ * evaluated inside the copy_if kernels with intermediates held in thread-local
+ * storage, so the boolean mask never exists in memory. Rows where the
+ * predicate evaluates to null are filtered out.
+ */
+template <bool has_nulls>
+struct ast_predicate_filter {
+  cudf::table_device_view table;
+  cudf::ast::detail::expression_device_view device_expression_data;
+
+  __device__ inline bool operator()(cudf::size_type i) const
+  {
+    cudf::ast::detail::IntermediateDataType<has_nulls>
+      intermediates[max_fused_filter_intermediates];
+    auto evaluator =
+      cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
+    auto result = cudf::ast::detail::value_expression_result<bool, has_nulls>();
+    evaluator.evaluate(result, i, intermediates);
+    return result.is_valid() && result.value();
+  }
+};
+
+}  // namespace
+
+namespace cudf {
+namespace detail {
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  if (0 == input.num_rows() || 0 == input.num_columns()) { return empty_like(input); }
+
+  auto const has_nulls = predicate.may_evaluate_null(input, stream);
+  auto const parser    = ast::detail::expression_parser{
+    predicate, input, has_nulls, stream, rmm::mr::get_current_device_resource()};
+  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
+               "Filter predicate must evaluate to a boolean");
+
+  // Expressions too deep for the fused path's thread-local intermediate
+  // storage take the mask-materializing path instead.
+  if (parser.device_expression_data.num_intermediates > max_fused_filter_intermediates) {
+    auto const mask =
+      detail::compute_column(input, predicate, stream, rmm::mr::get_current_device_resource());
+    return detail::apply_boolean_mask(input, mask->view(), stream, mr);
+  }
+
+  auto const table_device = table_device_view::create(input, stream);
+  if (has_nulls) {
+    return detail::copy_if(
+      input, ast_predicate_filter<true>{*table_device, parser.device_expression_data}, stream, mr);
+  }
+  return detail::copy_if(
+    input, ast_predicate_filter<false>{*table_device, parser.device_expression_data}, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(input.num_rows());
+  return detail::filter(input, predicate, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -27,8 +28,11 @@
 #include <strings/utilities.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -62,6 +66,39 @@ struct contains_fn {
   }
 };
 
+/**
+ * @brief Evaluates a DFA compiled by reprog_dfa::create_from against each string.
+ *
+ * The scan is branch-free per character: look up the column for the character,
+ * index the transition table, and continue until an accepting state is hit or
+ * the string ends. No state is kept per instruction so no stack is needed.
+ */
+struct dfa_contains_fn {
+  column_device_view d_strings;
+  char32_t const* d_symbols;
+  int32_t num_symbols;
+  int16_t const* d_table;
+  uint8_t const* d_accepting;
+  int16_t start_id;
+
+  __device__ bool operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) return false;
+    if (d_accepting[start_id]) return true;  // pattern matches the empty string
+    auto state        = start_id;
+    string_view d_str = d_strings.element<string_view>(idx);
+    for (auto const chr : d_str) {
+      auto const found = thrust::lower_bound(thrust::seq, d_symbols, d_symbols + num_symbols, chr);
+      auto const col   = (found != d_symbols + num_symbols && *found == chr)
+                           ? static_cast<int32_t>(found - d_symbols)
+                           : num_symbols;  // characters not in the pattern share a column
+      state = d_table[state * (num_symbols + 1) + col];
+      if (d_accepting[state]) return true;
+    }
+    return false;
+  }
+};
+
 //
 std::unique_ptr<column> contains_util(
   strings_column_view const& strings,
@@ -75,6 +112,33 @@ std::unique_ptr<column> contains_util(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
+  // simple patterns convert to a DFA which avoids the backtracking engine
+  if (auto dfa = reprog_dfa::create_from(pattern, flags, !beginning_only)) {
+    auto const d_symbols   = cudf::detail::make_device_uvector_async(dfa->symbols, stream);
+    auto const d_table     = cudf::detail::make_device_uvector_async(dfa->table, stream);
+    auto const d_accepting = cudf::detail::make_device_uvector_async(dfa->accepting, stream);
+
+    auto results   = make_numeric_column(data_type{type_id::BOOL8},
+                                       strings_count,
+                                       cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                       strings.null_count(),
+                                       stream,
+                                       mr);
+    auto d_results = results->mutable_view().data<bool>();
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_results,
+                      dfa_contains_fn{d_column,
+                                      d_symbols.data(),
+                                      static_cast<int32_t>(d_symbols.size()),
+                                      d_table.data(),
+                                      d_accepting.data(),
+                                      dfa->start_id});
+    results->set_null_count(strings.null_count());
+    return results;
+  }
+
   // compile regex into device object
   auto prog =
     reprog_device::create(pattern, flags, get_character_flags_table(), strings_count, stream);
@@ -109,6 +173,12 @@ std::unique_ptr<column> contains_util(
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
                       contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only});
+  else if (regex_insts <= RX_XLARGE_INSTS)
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_results,
+                      contains_fn<RX_STACK_XLARGE>{d_prog, d_column, beginning_only});
   else
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
@@ -238,6 +308,12 @@ std::unique_ptr<column> count_re(
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
                       count_fn<RX_STACK_LARGE>{d_prog, d_column});
+  else if (regex_insts <= RX_XLARGE_INSTS)
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_results,
+                      count_fn<RX_STACK_XLARGE>{d_prog, d_column});
   else
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
@@ -87,6 +87,20 @@ struct alignas(4) format_item {
   }
 };
 
+/**
+ * @brief Represents a format specifier at a fixed byte position within a string.
+ *
+ * Created by the format_compiler alongside the `format_item` vector. Since every
+ * supported specifier has a fixed width, the byte offset of each field is known
+ * once the format is parsed. Strings whose length matches the total format width
+ * can be parsed directly from these offsets without walking the format items.
+ */
+struct alignas(4) fixed_format_item {
+  char value;      // specifier value
+  int8_t length;   // field length in bytes
+  int16_t offset;  // field byte offset within the string
+};
+
 /**
  * @brief The format-compiler parses a timestamp format string into a vector of
  * `format_items`.
@@ -99,6 +113,8 @@ using specifier_map = std::map<char, int8_t>;
 struct format_compiler {
   std::string const format;
   rmm::device_uvector<format_item> d_items;
+  rmm::device_uvector<fixed_format_item> d_fixed_items;
+  size_type width = 0;  // total byte width of the format
 
   // clang-format off
   // The specifiers are documented here (not all are supported):
@@ -111,7 +127,7 @@ struct format_compiler {
   format_compiler(std::string fmt,
                   rmm::cuda_stream_view stream,
                   specifier_map extra_specifiers = {})
-    : format(fmt), d_items(0, stream)
+    : format(fmt), d_items(0, stream), d_fixed_items(0, stream)
   {
     specifiers.insert(extra_specifiers.begin(), extra_specifiers.end());
     std::vector<format_item> items;
@@ -150,12 +166,31 @@ struct format_compiler {
       items.push_back(format_item::new_specifier(ch, specifiers[ch]));
     }
 
+    // Compute the byte offset of each specifier. Every item has a fixed width
+    // so strings of exactly this total width can be parsed by offset directly.
+    std::vector<fixed_format_item> fixed_items;
+    for (auto const& item : items) {
+      if (item.item_type == format_char_type::specifier && item.value != 'Z') {
+        fixed_items.push_back(
+          fixed_format_item{item.value, item.length, static_cast<int16_t>(width)});
+      }
+      width += item.length;
+    }
+
     // copy format_items to device memory
-    d_items = cudf::detail::make_device_uvector_async(items, stream);
+    d_items       = cudf::detail::make_device_uvector_async(items, stream);
+    d_fixed_items = cudf::detail::make_device_uvector_async(fixed_items, stream);
   }
 
   device_span<format_item const> format_items() { return device_span<format_item const>(d_items); }
 
+  device_span<fixed_format_item const> fixed_format_items()
+  {
+    return device_span<fixed_format_item const>(d_fixed_items);
+  }
+
+  size_type format_width() const { return width; }
+
   int8_t subsecond_precision() const { return specifiers.at('f'); }
 };
 
@@ -187,6 +222,8 @@ template <typename T>
 struct parse_datetime {
   column_device_view const d_strings;
   device_span<format_item const> const d_format_items;
+  device_span<fixed_format_item const> const d_fixed_items;
+  size_type const format_width;
   int8_t const subsecond_precision;
 
   /**
@@ -310,6 +347,79 @@ struct parse_datetime {
     return timeparts;
   }
 
+  // Parse a string whose length matches the format width exactly.
+  // Each field is read from its precomputed byte offset which avoids walking
+  // the format items and the length bookkeeping of the general path above.
+  // Fixed-width formats like ISO8601 hit this path on every row.
+  __device__ timestamp_components parse_into_parts_fixed(string_view const& d_string) const
+  {
+    timestamp_components timeparts = {1970, 1, 1, 0};  // init to epoch time
+
+    for (auto item : d_fixed_items) {
+      auto const str = d_string.data() + item.offset;
+      switch (item.value) {
+        case 'Y': {
+          timeparts.year = static_cast<int16_t>(parse_int(str, item.length).first);
+          break;
+        }
+        case 'y': {
+          auto const year = parse_int(str, item.length).first;
+          timeparts.year  = static_cast<int16_t>(year + (year < 69 ? 2000 : 1900));
+          break;
+        }
+        case 'm': {
+          timeparts.month = static_cast<int8_t>(parse_int(str, item.length).first);
+          break;
+        }
+        case 'd': {
+          timeparts.day = static_cast<int8_t>(parse_int(str, item.length).first);
+          break;
+        }
+        case 'j': {
+          timeparts.day_of_year = static_cast<int16_t>(parse_int(str, item.length).first);
+          break;
+        }
+        case 'H':
+        case 'I': {
+          timeparts.hour = static_cast<int8_t>(parse_int(str, item.length).first);
+          break;
+        }
+        case 'M': {
+          timeparts.minute = static_cast<int8_t>(parse_int(str, item.length).first);
+          break;
+        }
+        case 'S': {
+          timeparts.second = static_cast<int8_t>(parse_int(str, item.length).first);
+          break;
+        }
+        case 'f': {
+          auto const [fraction, left] = parse_int(str, item.length);
+          timeparts.subsecond         = static_cast<int32_t>(fraction * power_of_ten(0 - left));
+          break;
+        }
+        case 'p': {
+          string_view am_pm(str, 2);
+          auto hour = timeparts.hour;
+          if ((am_pm.compare("AM", 2) == 0) || (am_pm.compare("am", 2) == 0)) {
+            if (hour == 12) hour = 0;
+          } else if (hour < 12)
+            hour += 12;
+          timeparts.hour = hour;
+          break;
+        }
+        case 'z': {
+          auto const sign      = *str == '-' ? 1 : -1;
+          auto const hh        = parse_int(str + 1, 2).first;
+          auto const mm        = parse_int(str + 3, 2).first;
+          timeparts.tz_minutes = sign * ((hh * 60) + mm);  // revert timezone back to UTC
+          break;
+        }
+        default: break;
+      }
+    }
+    return timeparts;
+  }
+
   __device__ int64_t timestamp_from_parts(timestamp_components const& timeparts) const
   {
     auto const ymd =  // convenient chrono class handles the leap year calculations for us
@@ -343,7 +453,8 @@ struct parse_datetime {
     string_view d_str = d_strings.element<string_view>(idx);
     if (d_str.empty()) return epoch_time;
 
-    auto const timeparts = parse_into_parts(d_str);
+    auto const timeparts = d_str.size_bytes() == format_width ? parse_into_parts_fixed(d_str)
+                                                              : parse_into_parts(d_str);
 
     return T{T::duration(timestamp_from_parts(timeparts))};
   }
@@ -360,7 +471,11 @@ struct dispatch_to_timestamps_fn {
                   rmm::cuda_stream_view stream) const
   {
     format_compiler compiler(format, stream);
-    parse_datetime<T> pfn{d_strings, compiler.format_items(), compiler.subsecond_precision()};
+    parse_datetime<T> pfn{d_strings,
+                          compiler.format_items(),
+                          compiler.fixed_format_items(),
+                          compiler.format_width(),
+                          compiler.subsecond_precision()};
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(results_view.size()),
@@ -41,6 +41,12 @@ namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+
+// Powers of ten that are exactly representable as doubles.
+__constant__ double const exact_powers_of_ten[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
 /**
  * @brief This function converts the given string into a
  * floating point double value.
@@ -69,6 +75,7 @@ __device__ inline double stod(string_view const& d_str)
   // until we are about to exceed the limit of uint64_t
   constexpr uint64_t max_holding = (std::numeric_limits<uint64_t>::max() - 9L) / 10L;
   uint64_t digits                = 0;
+  int num_digits                 = 0;  // significant digits held in `digits`
   int exp_off                    = 0;
   bool decimal                   = false;
   while (in_ptr < end) {
@@ -86,8 +93,10 @@ __device__ inline double stod(string_view const& d_str)
       if (digits > max_holding) {
         digits = digits / 10L;
         exp_off += (int)!decimal;
-      } else
+      } else {
         exp_off -= (int)decimal;
+        if (digits != 0) ++num_digits;
+      }
     }
     ++in_ptr;
   }
@@ -114,9 +123,19 @@ __device__ inline double stod(string_view const& d_str)
     }
   }
 
-  int const num_digits = static_cast<int>(log10(digits)) + 1;
   exp_ten *= exp_sign;
-  exp_ten += exp_off;
+  exp_ten += exp_off;  // total power of ten to apply to the digits
+
+  // Fast path for fixed-format strings: when the mantissa fits in the 53-bit
+  // significand and the scale is a power of ten that is exactly representable,
+  // a single multiply or divide produces the correctly rounded result without
+  // the exp10() calls below. This covers typical integer and decimal data.
+  if (digits <= (1ul << 53) && exp_ten >= -22 && exp_ten <= 22) {
+    double const value = static_cast<double>(digits);
+    double const scale = exact_powers_of_ten[exp_ten < 0 ? -exp_ten : exp_ten];
+    return sign * (exp_ten < 0 ? value / scale : value * scale);
+  }
+
   exp_ten += num_digits - 1;
   if (exp_ten > std::numeric_limits<double>::max_exponent10)
     return sign > 0 ? std::numeric_limits<double>::infinity()
@@ -16,7 +16,6 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
-#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
@@ -65,6 +64,20 @@ struct chars_size_transform {
   }
 };
 
+// Computes the position of each column's first character in its chars child
+struct chars_begin_transform {
+  __device__ size_t operator()(column_device_view const& col) const
+  {
+    if (col.size() > 0) {
+      constexpr auto offsets_index = strings_column_view::offsets_column_index;
+      auto d_offsets               = col.child(offsets_index).data<int32_t>();
+      return d_offsets[col.offset()];
+    } else {
+      return 0;
+    }
+  }
+};
+
 auto create_strings_device_views(host_span<column_view const> views, rmm::cuda_stream_view stream)
 {
   CUDF_FUNC_RANGE();
@@ -277,28 +290,30 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
         d_new_chars);
     } else {
       // Memcpy each input chars column (more efficient for very large strings)
-      for (auto column = columns.begin(); column != columns.end(); ++column) {
-        size_type column_size = column->size();
-        if (column_size == 0)  // nothing to do
-          continue;            // empty column may not have children
-        size_type column_offset   = column->offset();
-        column_view offsets_child = column->child(strings_column_view::offsets_column_index);
-        column_view chars_child   = column->child(strings_column_view::chars_column_index);
-
-        auto bytes_offset =
-          cudf::detail::get_value<offset_type>(offsets_child, column_offset, stream);
-
-        // copy the chars column data
-        auto d_chars = chars_child.data<char>() + bytes_offset;
-        auto const bytes =
-          cudf::detail::get_value<offset_type>(offsets_child, column_size + column_offset, stream) -
-          bytes_offset;
-
-        CUDA_TRY(
-          cudaMemcpyAsync(d_new_chars, d_chars, bytes, cudaMemcpyDeviceToDevice, stream.value()));
-
-        // get ready for the next column
-        d_new_chars += bytes;
+      // Batch the per-column source positions into a single device round trip so
+      // the copies below can be issued back-to-back even for many inputs
+      auto d_chars_begins = rmm::device_uvector<size_t>(columns.size(), stream);
+      thrust::transform(rmm::exec_policy(stream),
+                        d_views,
+                        d_views + columns.size(),
+                        d_chars_begins.begin(),
+                        chars_begin_transform{});
+      auto const h_chars_begins = cudf::detail::make_std_vector_sync(d_chars_begins, stream);
+      auto const h_partition_offsets =
+        cudf::detail::make_std_vector_sync(d_partition_offsets, stream);
+
+      for (size_t i = 0; i < columns.size(); ++i) {
+        auto const bytes = h_partition_offsets[i + 1] - h_partition_offsets[i];
+        if (bytes == 0)  // nothing to do
+          continue;      // empty column may not have children
+        auto const* d_chars =
+          columns[i].child(strings_column_view::chars_column_index).data<char>() +
+          h_chars_begins[i];
+        CUDA_TRY(cudaMemcpyAsync(d_new_chars + h_partition_offsets[i],
+                                 d_chars,
+                                 bytes,
+                                 cudaMemcpyDeviceToDevice,
+                                 stream.value()));
       }
     }
   }
@@ -16,12 +16,13 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
-#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/strings/detail/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 namespace cudf {
@@ -40,28 +41,31 @@ std::unique_ptr<cudf::column> copy_slice(strings_column_view const& strings,
   auto const strings_count  = end - start;
   auto const offsets_offset = start + strings.offset();
 
-  // slice the offsets child column
+  // fetch the chars boundaries for the slice with a single synchronize
+  auto const d_offsets = strings.offsets().data<int32_t>() + offsets_offset;
+  int32_t chars_bounds[2];
+  CUDA_TRY(cudaMemcpyAsync(
+    &chars_bounds[0], d_offsets, sizeof(int32_t), cudaMemcpyDeviceToHost, stream.value()));
+  CUDA_TRY(cudaMemcpyAsync(&chars_bounds[1],
+                           d_offsets + strings_count,
+                           sizeof(int32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+  auto const chars_offset = chars_bounds[0];
+  auto const data_size    = chars_bounds[1] - chars_offset;
+
+  // build the output offsets column, rebasing the offset values in the same pass
+  rmm::device_uvector<int32_t> out_offsets(strings_count + 1, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    d_offsets,
+                    d_offsets + strings_count + 1,
+                    out_offsets.begin(),
+                    [chars_offset] __device__(auto offset) { return offset - chars_offset; });
   auto offsets_column = std::make_unique<cudf::column>(
-    cudf::detail::slice(
-      strings.offsets(), {offsets_offset, offsets_offset + strings_count + 1}, stream)
-      .front(),
-    stream,
-    mr);
-  auto const chars_offset =
-    offsets_offset == 0 ? 0 : cudf::detail::get_value<int32_t>(offsets_column->view(), 0, stream);
-  if (chars_offset > 0) {
-    // adjust the individual offset values only if needed
-    auto d_offsets = offsets_column->mutable_view();
-    thrust::transform(rmm::exec_policy(stream),
-                      d_offsets.begin<int32_t>(),
-                      d_offsets.end<int32_t>(),
-                      d_offsets.begin<int32_t>(),
-                      [chars_offset] __device__(auto offset) { return offset - chars_offset; });
-  }
+    data_type{type_id::INT32}, strings_count + 1, out_offsets.release());
 
   // slice the chars child column
-  auto const data_size =
-    cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
   auto chars_column = std::make_unique<cudf::column>(
     cudf::detail::slice(strings.chars(), {chars_offset, chars_offset + data_size}, stream).front(),
     stream,
@@ -116,6 +116,11 @@ std::unique_ptr<table> extract(
                        thrust::make_counting_iterator<size_type>(0),
                        strings_count,
                        extract_fn<RX_STACK_LARGE>{d_prog, d_strings, d_indices});
+  } else if (regex_insts <= RX_XLARGE_INSTS) {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       extract_fn<RX_STACK_XLARGE>{d_prog, d_strings, d_indices});
   } else {
     thrust::for_each_n(rmm::exec_policy(stream),
                        thrust::make_counting_iterator<size_type>(0),
@@ -16,13 +16,18 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -282,6 +287,80 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
   return results;
 }
 
+/**
+ * @brief Kernel for checking if a target string exists within each string
+ * using a warp per string.
+ *
+ * Each lane checks the target against byte positions `lane, lane+32, ...` so
+ * adjacent lanes read adjacent bytes and the per-string byte loop is split
+ * 32 ways instead of serialized in a single thread. Used for columns of
+ * long strings where the thread-per-string kernel is dominated by divergence.
+ */
+__global__ void contains_warp_parallel_fn(column_device_view const d_strings,
+                                          string_view const d_target,
+                                          bool* d_results)
+{
+  auto const idx = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+  if (idx >= (d_strings.size() * cudf::detail::warp_size)) return;
+
+  auto const str_idx  = idx / cudf::detail::warp_size;
+  auto const lane_idx = idx % cudf::detail::warp_size;
+  if (d_strings.is_null(str_idx)) {
+    if (lane_idx == 0) d_results[str_idx] = false;
+    return;
+  }
+  auto const d_str = d_strings.element<string_view>(str_idx);
+
+  auto found = false;
+  for (size_type i = lane_idx; !found && (i + d_target.size_bytes()) <= d_str.size_bytes();
+       i += cudf::detail::warp_size) {
+    found = d_target.compare(d_str.data() + i, d_target.size_bytes()) == 0;
+  }
+
+  auto const result = __any_sync(0xffffffff, found);
+  if (lane_idx == 0) d_results[str_idx] = result;
+}
+
+/**
+ * @brief Warp-per-string variant of the scalar-target contains utility.
+ *
+ * Produces the same results as `contains_fn` with the substring-search
+ * functor but assigns a full warp to each string.
+ */
+std::unique_ptr<column> contains_warp_parallel(strings_column_view const& strings,
+                                               string_scalar const& target,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto strings_count = strings.size();
+  CUDF_EXPECTS(target.is_valid(stream), "Parameter target must be valid.");
+  if (target.size() == 0)  // empty target string returns true
+  {
+    auto const true_scalar = make_fixed_width_scalar<bool>(true, stream);
+    auto results           = make_column_from_scalar(*true_scalar, strings.size(), stream, mr);
+    results->set_null_mask(cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                           strings.null_count());
+    return results;
+  }
+
+  auto d_target       = string_view(target.data(), target.size());
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  // create output column
+  auto results = make_numeric_column(data_type{type_id::BOOL8},
+                                     strings_count,
+                                     cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d grid{strings_count * cudf::detail::warp_size, block_size};
+  contains_warp_parallel_fn<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+    *strings_column, d_target, results->mutable_view().data<bool>());
+  results->set_null_count(strings.null_count());
+  return results;
+}
+
 }  // namespace
 
 std::unique_ptr<column> contains(
@@ -290,6 +369,10 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  // columns of mostly long strings run faster with a warp per string
+  if (!strings.is_empty() && prefer_warp_parallel(strings)) {
+    return contains_warp_parallel(strings, target, stream, mr);
+  }
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
@@ -308,6 +391,41 @@ std::unique_ptr<column> contains(
   return contains_fn(strings, targets, pfn, stream, mr);
 }
 
+std::unique_ptr<column> contains(
+  dictionary_column_view const& input,
+  string_scalar const& target,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  if (input.is_empty()) return make_empty_column(type_id::BOOL8);
+  CUDF_EXPECTS(input.keys().type().id() == type_id::STRING,
+               "dictionary keys must be a strings column");
+
+  // search the distinct keys only; each row's result maps through its index
+  auto keys_result = contains(strings_column_view(input.keys()),
+                              target,
+                              stream,
+                              rmm::mr::get_current_device_resource());
+
+  column_view indices{input.indices().type(),
+                      input.size(),
+                      input.indices().head(),
+                      nullptr,  // no nulls for gather indices
+                      0,
+                      input.offset()};
+  auto table_column = cudf::detail::gather(table_view{{keys_result->view()}},
+                                           indices,
+                                           cudf::out_of_bounds_policy::NULLIFY,
+                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           mr)
+                        ->release();
+  auto output_column = std::unique_ptr<column>(std::move(table_column.front()));
+  output_column->set_null_mask(cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                               input.null_count());
+  return output_column;
+}
+
 std::unique_ptr<column> starts_with(
   strings_column_view const& strings,
   string_scalar const& target,
@@ -386,6 +504,14 @@ std::unique_ptr<column> contains(strings_column_view const& strings,
   return detail::contains(strings, targets, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> contains(dictionary_column_view const& input,
+                                 string_scalar const& target,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains(input, target, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> starts_with(strings_column_view const& strings,
                                     string_scalar const& target,
                                     rmm::mr::device_memory_resource* mr)
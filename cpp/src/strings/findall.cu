@@ -16,9 +16,12 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/findall.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -106,50 +109,100 @@ struct findall_count_fn : public findall_fn<stack_size> {
   }
 };
 
-}  // namespace
-
-//
-std::unique_ptr<table> findall_re(
-  strings_column_view const& strings,
-  std::string const& pattern,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource(),
-  rmm::cuda_stream_view stream        = rmm::cuda_stream_default)
-{
-  auto const strings_count = strings.size();
-  auto const d_strings     = column_device_view::create(strings.parent(), stream);
+/**
+ * @brief This functor writes the (begin,end) character positions of all the
+ * matches found in each string without materializing the matched substrings.
+ */
+template <int stack_size>
+struct findall_positions_fn {
+  column_device_view const d_strings;
+  reprog_device prog;
+  int32_t const* d_offsets;
+  int32_t* d_begins;
+  int32_t* d_ends;
 
-  auto const d_flags = detail::get_character_flags_table();
-  // compile regex into device object
-  auto const d_prog      = reprog_device::create(pattern, d_flags, strings_count, stream);
-  auto const regex_insts = d_prog->insts_counts();
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str  = d_strings.element<string_view>(idx);
+    auto const nchars = d_str.length();
+    int32_t spos      = 0;
+    int32_t epos      = static_cast<int32_t>(nchars);
+    auto out_idx      = d_offsets[idx];
+    while (spos <= nchars) {
+      if (prog.find<stack_size>(idx, d_str, spos, epos) <= 0) break;  // no more matches found
+      d_begins[out_idx] = spos;
+      d_ends[out_idx]   = epos;
+      ++out_idx;
+      spos = epos > spos ? epos : spos + 1;
+      epos = static_cast<int32_t>(nchars);
+    }
+  }
+};
 
+/**
+ * @brief Returns the number of pattern matches in each string.
+ */
+rmm::device_uvector<size_type> count_matches(column_device_view const& d_strings,
+                                             reprog_device& d_prog,
+                                             size_type strings_count,
+                                             rmm::cuda_stream_view stream)
+{
   rmm::device_uvector<size_type> find_counts(strings_count, stream);
-  auto d_find_counts = find_counts.data();
+  auto const regex_insts = d_prog.insts_counts();
 
   if (regex_insts <= RX_SMALL_INSTS)
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
-                      d_find_counts,
-                      findall_count_fn<RX_STACK_SMALL>{*d_strings, *d_prog});
+                      find_counts.data(),
+                      findall_count_fn<RX_STACK_SMALL>{d_strings, d_prog});
   else if (regex_insts <= RX_MEDIUM_INSTS)
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
-                      d_find_counts,
-                      findall_count_fn<RX_STACK_MEDIUM>{*d_strings, *d_prog});
+                      find_counts.data(),
+                      findall_count_fn<RX_STACK_MEDIUM>{d_strings, d_prog});
   else if (regex_insts <= RX_LARGE_INSTS)
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
-                      d_find_counts,
-                      findall_count_fn<RX_STACK_LARGE>{*d_strings, *d_prog});
+                      find_counts.data(),
+                      findall_count_fn<RX_STACK_LARGE>{d_strings, d_prog});
+  else if (regex_insts <= RX_XLARGE_INSTS)
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      find_counts.data(),
+                      findall_count_fn<RX_STACK_XLARGE>{d_strings, d_prog});
   else
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
-                      d_find_counts,
-                      findall_count_fn<RX_STACK_ANY>{*d_strings, *d_prog});
+                      find_counts.data(),
+                      findall_count_fn<RX_STACK_ANY>{d_strings, d_prog});
+  return find_counts;
+}
+
+}  // namespace
+
+//
+std::unique_ptr<table> findall_re(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource(),
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default)
+{
+  auto const strings_count = strings.size();
+  auto const d_strings     = column_device_view::create(strings.parent(), stream);
+
+  auto const d_flags = detail::get_character_flags_table();
+  // compile regex into device object
+  auto const d_prog      = reprog_device::create(pattern, d_flags, strings_count, stream);
+  auto const regex_insts = d_prog->insts_counts();
+
+  auto find_counts   = count_matches(*d_strings, *d_prog, strings_count, stream);
+  auto d_find_counts = find_counts.data();
 
   std::vector<std::unique_ptr<column>> results;
 
@@ -191,6 +244,13 @@ std::unique_ptr<table> findall_re(
         thrust::make_counting_iterator<size_type>(strings_count),
         indices.begin(),
         findall_fn<RX_STACK_LARGE>{*d_strings, *d_prog, column_index, d_find_counts});
+    else if (regex_insts <= RX_XLARGE_INSTS)
+      thrust::transform(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(strings_count),
+        indices.begin(),
+        findall_fn<RX_STACK_XLARGE>{*d_strings, *d_prog, column_index, d_find_counts});
     else
       thrust::transform(rmm::exec_policy(stream),
                         thrust::make_counting_iterator<size_type>(0),
@@ -204,6 +264,81 @@ std::unique_ptr<table> findall_re(
   return std::make_unique<table>(std::move(results));
 }
 
+//
+std::unique_ptr<column> findall_positions_re(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource(),
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default)
+{
+  auto const strings_count = strings.size();
+  auto const d_strings     = column_device_view::create(strings.parent(), stream);
+
+  auto const d_flags = detail::get_character_flags_table();
+  // compile regex into device object
+  auto const d_prog      = reprog_device::create(pattern, d_flags, strings_count, stream);
+  auto const regex_insts = d_prog->insts_counts();
+
+  auto const find_counts = count_matches(*d_strings, *d_prog, strings_count, stream);
+
+  auto offsets = make_offsets_child_column(find_counts.begin(), find_counts.end(), stream, mr);
+  auto const d_offsets = offsets->view().data<int32_t>();
+  auto const total_matches =
+    cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+
+  auto begins = make_numeric_column(
+    data_type{type_id::INT32}, total_matches, mask_state::UNALLOCATED, stream, mr);
+  auto ends = make_numeric_column(
+    data_type{type_id::INT32}, total_matches, mask_state::UNALLOCATED, stream, mr);
+  auto const d_begins = begins->mutable_view().data<int32_t>();
+  auto const d_ends   = ends->mutable_view().data<int32_t>();
+
+  if (regex_insts <= RX_SMALL_INSTS)
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      findall_positions_fn<RX_STACK_SMALL>{*d_strings, *d_prog, d_offsets, d_begins, d_ends});
+  else if (regex_insts <= RX_MEDIUM_INSTS)
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      findall_positions_fn<RX_STACK_MEDIUM>{*d_strings, *d_prog, d_offsets, d_begins, d_ends});
+  else if (regex_insts <= RX_LARGE_INSTS)
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      findall_positions_fn<RX_STACK_LARGE>{*d_strings, *d_prog, d_offsets, d_begins, d_ends});
+  else if (regex_insts <= RX_XLARGE_INSTS)
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      findall_positions_fn<RX_STACK_XLARGE>{*d_strings, *d_prog, d_offsets, d_begins, d_ends});
+  else
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      findall_positions_fn<RX_STACK_ANY>{*d_strings, *d_prog, d_offsets, d_begins, d_ends});
+
+  std::vector<std::unique_ptr<column>> children;
+  children.emplace_back(std::move(begins));
+  children.emplace_back(std::move(ends));
+  auto pairs =
+    make_structs_column(total_matches, std::move(children), 0, rmm::device_buffer{}, stream, mr);
+
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           std::move(pairs),
+                           strings.null_count(),
+                           cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -216,5 +351,13 @@ std::unique_ptr<table> findall_re(strings_column_view const& strings,
   return detail::findall_re(strings, pattern, mr);
 }
 
+std::unique_ptr<column> findall_positions_re(strings_column_view const& strings,
+                                             std::string const& pattern,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall_positions_re(strings, pattern, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -36,6 +36,10 @@
 
 #include <thrust/optional.h>
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -959,6 +963,79 @@ __launch_bounds__(block_size) __global__
   }
 }
 
+/**
+ * @brief Kernel for running several JSONPath queries per document.
+ *
+ * Same two-pass scheme as `get_json_object_kernel`, but each thread evaluates
+ * every command buffer against its document in turn before moving on, so the
+ * document's characters are read through the cache hierarchy once per pass
+ * rather than once per path. A null command buffer (an empty path) produces
+ * all-null output for that path.
+ *
+ * @param col Device view of the incoming string
+ * @param commands One JSONPath command buffer per path, nullptr for empty paths
+ * @param num_paths Number of paths queried
+ * @param output_offsets Per-path buffers used to store the string offsets of the results
+ * @param out_bufs Per-path buffers used to store the results of the queries
+ * @param out_validity Per-path output validity buffers
+ * @param out_valid_counts Per-path output counts of # of valid bits, zero initialized
+ * @param options Options controlling behavior
+ */
+template <int block_size>
+__launch_bounds__(block_size) __global__
+  void get_json_object_multi_kernel(column_device_view col,
+                                    path_operator const* const* commands,
+                                    size_type num_paths,
+                                    offset_type* const* output_offsets,
+                                    thrust::optional<char* const*> out_bufs,
+                                    thrust::optional<bitmask_type* const*> out_validity,
+                                    thrust::optional<size_type*> out_valid_counts,
+                                    get_json_object_options options)
+{
+  size_type tid    = threadIdx.x + (blockDim.x * blockIdx.x);
+  size_type stride = blockDim.x * gridDim.x;
+
+  auto active_threads = __ballot_sync(0xffffffff, tid < col.size());
+  while (tid < col.size()) {
+    string_view const str = col.element<string_view>(tid);
+
+    // every thread runs the same path count, so the ballots below stay uniform
+    for (size_type p = 0; p < num_paths; ++p) {
+      bool is_valid         = false;
+      size_type output_size = 0;
+      if (commands[p] != nullptr && str.size_bytes() > 0) {
+        char* dst = out_bufs.has_value() ? out_bufs.value()[p] + output_offsets[p][tid] : nullptr;
+        size_t const dst_size =
+          out_bufs.has_value() ? output_offsets[p][tid + 1] - output_offsets[p][tid] : 0;
+
+        parse_result result;
+        json_output out;
+        thrust::tie(result, out) =
+          get_json_object_single(str.data(), str.size_bytes(), commands[p], dst, dst_size, options);
+        output_size = out.output_len.value_or(0);
+        if (out.output_len.has_value() && result == parse_result::SUCCESS) { is_valid = true; }
+      }
+
+      // filled in only during the precompute step. during the compute step, the offsets
+      // are fed back in so we do -not- want to write them out
+      if (!out_bufs.has_value()) { output_offsets[p][tid] = static_cast<offset_type>(output_size); }
+
+      // validity filled in only during the output step
+      if (out_validity.has_value()) {
+        uint32_t mask = __ballot_sync(active_threads, is_valid);
+        // 0th lane of the warp writes the validity and counts
+        if (!(tid % cudf::detail::warp_size)) {
+          out_validity.value()[p][cudf::word_index(tid)] = mask;
+          atomicAdd(out_valid_counts.value() + p, __popc(mask));
+        }
+      }
+    }
+
+    tid += stride;
+    active_threads = __ballot_sync(active_threads, tid < col.size());
+  }
+}
+
 /**
  * @copydoc cudf::strings::detail::get_json_object
  */
@@ -1041,6 +1118,117 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
                              std::move(validity));
 }
 
+/**
+ * @copydoc cudf::strings::detail::get_json_object(cudf::strings_column_view const&,
+ * host_span<cudf::string_scalar const>,get_json_object_options,rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_object(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_paths = static_cast<size_type>(json_paths.size());
+  std::vector<std::unique_ptr<cudf::column>> results;
+  if (num_paths == 0) { return results; }
+
+  if (col.size() == 0) {
+    std::generate_n(std::back_inserter(results), num_paths, [&] {
+      return make_empty_column(type_id::STRING);
+    });
+    return results;
+  }
+
+  // preprocess each json_path into a command buffer; empty paths keep a
+  // nullptr command pointer and become all-null columns
+  std::vector<thrust::optional<rmm::device_uvector<path_operator>>> command_buffers;
+  std::vector<path_operator const*> h_commands;
+  for (auto const& json_path : json_paths) {
+    auto preprocess = build_command_buffer(json_path, stream);
+    CUDF_EXPECTS(std::get<1>(preprocess) <= max_command_stack_depth,
+                 "Encountered JSONPath string that is too complex");
+    command_buffers.push_back(std::move(std::get<0>(preprocess)));
+    h_commands.push_back(command_buffers.back().has_value() ? command_buffers.back()->data()
+                                                            : nullptr);
+  }
+  auto const d_commands = cudf::detail::make_device_uvector_async(h_commands, stream);
+
+  // allocate the output offsets buffers
+  std::vector<std::unique_ptr<column>> offsets;
+  std::vector<offset_type*> h_offset_ptrs;
+  for (size_type p = 0; p < num_paths; p++) {
+    offsets.push_back(cudf::make_fixed_width_column(
+      data_type{type_id::INT32}, col.size() + 1, mask_state::UNALLOCATED, stream, mr));
+    h_offset_ptrs.push_back(offsets.back()->mutable_view().head<offset_type>());
+  }
+  auto const d_offset_ptrs = cudf::detail::make_device_uvector_async(h_offset_ptrs, stream);
+
+  constexpr int block_size = 512;
+  cudf::detail::grid_1d const grid{col.size(), block_size};
+
+  auto cdv = column_device_view::create(col.parent(), stream);
+
+  // preprocess sizes for every path (returned in the offsets buffers)
+  get_json_object_multi_kernel<block_size>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(*cdv,
+                                                                         d_commands.data(),
+                                                                         num_paths,
+                                                                         d_offset_ptrs.data(),
+                                                                         thrust::nullopt,
+                                                                         thrust::nullopt,
+                                                                         thrust::nullopt,
+                                                                         options);
+
+  // convert sizes to offsets and allocate each output string column
+  std::vector<std::unique_ptr<column>> chars;
+  std::vector<rmm::device_buffer> validities;
+  std::vector<char*> h_char_ptrs;
+  std::vector<bitmask_type*> h_validity_ptrs;
+  for (size_type p = 0; p < num_paths; p++) {
+    auto offsets_view = offsets[p]->mutable_view();
+    thrust::exclusive_scan(rmm::exec_policy(stream),
+                           offsets_view.head<offset_type>(),
+                           offsets_view.head<offset_type>() + col.size() + 1,
+                           offsets_view.head<offset_type>(),
+                           0);
+    size_type const output_size =
+      cudf::detail::get_value<offset_type>(offsets_view, col.size(), stream);
+
+    chars.push_back(create_chars_child_column(output_size, stream, mr));
+    validities.push_back(
+      cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr));
+    h_char_ptrs.push_back(chars.back()->mutable_view().head<char>());
+    h_validity_ptrs.push_back(static_cast<bitmask_type*>(validities.back().data()));
+  }
+  auto const d_char_ptrs     = cudf::detail::make_device_uvector_async(h_char_ptrs, stream);
+  auto const d_validity_ptrs = cudf::detail::make_device_uvector_async(h_validity_ptrs, stream);
+  auto d_valid_counts = cudf::detail::make_zeroed_device_uvector_async<size_type>(
+    static_cast<std::size_t>(num_paths), stream);
+
+  // compute results for every path
+  get_json_object_multi_kernel<block_size>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(*cdv,
+                                                                         d_commands.data(),
+                                                                         num_paths,
+                                                                         d_offset_ptrs.data(),
+                                                                         d_char_ptrs.data(),
+                                                                         d_validity_ptrs.data(),
+                                                                         d_valid_counts.data(),
+                                                                         options);
+
+  auto const valid_counts = cudf::detail::make_std_vector_sync(d_valid_counts, stream);
+  for (size_type p = 0; p < num_paths; p++) {
+    results.push_back(make_strings_column(col.size(),
+                                          std::move(offsets[p]),
+                                          std::move(chars[p]),
+                                          col.size() - valid_counts[p],
+                                          std::move(validities[p])));
+  }
+  return results;
+}
+
 }  // namespace
 }  // namespace detail
 
@@ -1056,5 +1244,19 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
   return detail::get_json_object(col, json_path, options, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc cudf::strings::get_json_object(cudf::strings_column_view const&,
+ * host_span<cudf::string_scalar const>,get_json_object_options,rmm::mr::device_memory_resource*)
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_object(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_json_object(col, json_paths, options, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
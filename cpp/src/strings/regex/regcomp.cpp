@@ -21,6 +21,10 @@
 #include <string.h>
 #include <algorithm>
 #include <array>
+#include <list>
+#include <map>
+#include <mutex>
+#include <utility>
 
 namespace cudf {
 namespace strings {
@@ -1028,6 +1032,135 @@ void reprog::print(regex_flags const flags)
 }
 #endif
 
+std::unique_ptr<reprog_dfa> reprog_dfa::create_from(std::string const& pattern,
+                                                    regex_flags const flags,
+                                                    bool match_anywhere)
+{
+  constexpr int32_t max_states  = 256;  // keeps transition tables small enough to cache well
+  constexpr int32_t max_symbols = 64;
+
+  reprog prog = get_cached_program(pattern, flags);
+  prog.optimize1();  // removes NOPs so only real instructions remain
+
+  // Only patterns built from literal characters plus alternation, grouping and
+  // repetition can be converted. Anything that inspects character classes,
+  // position (anchors, word boundaries) or arbitrary characters stays on the
+  // backtracking engine.
+  std::vector<char32_t> symbols;
+  auto const* insts = prog.insts_data();
+  auto const count  = prog.insts_count();
+  for (int32_t id = 0; id < count; ++id) {
+    switch (insts[id].type) {
+      case CHAR: symbols.push_back(insts[id].u1.c); break;
+      case OR:
+      case LBRA:
+      case RBRA:
+      case END: break;
+      default: return nullptr;
+    }
+  }
+  std::sort(symbols.begin(), symbols.end());
+  symbols.erase(std::unique(symbols.begin(), symbols.end()), symbols.end());
+  if (static_cast<int32_t>(symbols.size()) > max_symbols) { return nullptr; }
+
+  // Expands a set of instruction ids by following all non-consuming edges:
+  // OR branches and (capturing) group markers, which only matter for
+  // sub-string extraction and are epsilon edges for a boolean match.
+  auto epsilon_closure = [&](std::vector<int32_t> ids) {
+    std::vector<bool> visited(count, false);
+    std::vector<int32_t> result;
+    while (!ids.empty()) {
+      auto const id = ids.back();
+      ids.pop_back();
+      if (visited[id]) { continue; }
+      visited[id] = true;
+      switch (insts[id].type) {
+        case OR:
+          ids.push_back(insts[id].u2.left_id);
+          ids.push_back(insts[id].u1.right_id);
+          break;
+        case LBRA:
+        case RBRA: ids.push_back(insts[id].u2.next_id); break;
+        default: result.push_back(id);
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  auto const start_set = epsilon_closure({prog.get_start_inst()});
+
+  auto dfa               = std::make_unique<reprog_dfa>();
+  auto const num_columns = static_cast<int32_t>(symbols.size()) + 1;
+
+  // Subset construction: each DFA state is a set of NFA instruction ids.
+  std::map<std::vector<int32_t>, int16_t> state_ids;
+  std::vector<std::vector<int32_t>> state_sets;
+  auto add_state = [&](std::vector<int32_t> const& set) {
+    auto const inserted =
+      state_ids.emplace(set, static_cast<int16_t>(state_sets.size()));
+    if (inserted.second) {
+      state_sets.push_back(set);
+      auto const accepts = std::any_of(
+        set.begin(), set.end(), [&](int32_t id) { return insts[id].type == END; });
+      dfa->accepting.push_back(accepts ? 1 : 0);
+    }
+    return inserted.first->second;
+  };
+
+  add_state({});  // state 0 is the dead state
+  dfa->start_id = add_state(start_set);
+
+  for (int16_t state = 0; state < static_cast<int16_t>(state_sets.size()); ++state) {
+    for (int32_t col = 0; col < num_columns; ++col) {
+      std::vector<int32_t> moved;
+      if (col < static_cast<int32_t>(symbols.size())) {
+        for (auto const id : state_sets[state]) {
+          if (insts[id].type == CHAR && insts[id].u1.c == symbols[col]) {
+            moved.push_back(insts[id].u2.next_id);
+          }
+        }
+      }
+      // Matching may begin at any position: fold the start states into every
+      // transition target so the scan never needs to restart.
+      if (match_anywhere) {
+        moved.insert(moved.end(), start_set.begin(), start_set.end());
+      }
+      dfa->table.push_back(add_state(epsilon_closure(std::move(moved))));
+      if (static_cast<int32_t>(state_sets.size()) > max_states) { return nullptr; }
+    }
+  }
+
+  dfa->symbols = std::move(symbols);
+  return dfa;
+}
+
+reprog get_cached_program(std::string const& pattern, regex_flags const flags)
+{
+  // Large enough to cover the patterns of a typical repeatedly-executed pipeline while
+  // keeping the linear lookup below the cost of a recompile
+  constexpr std::size_t max_cached_programs = 128;
+
+  using cache_key = std::pair<std::string, regex_flags>;
+  static std::mutex cache_mutex;
+  static std::list<std::pair<cache_key, reprog>> cache;  // most recently used first
+
+  auto const key = cache_key{pattern, flags};
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto const it = std::find_if(
+    cache.begin(), cache.end(), [&](auto const& entry) { return entry.first == key; });
+  if (it != cache.end()) {
+    cache.splice(cache.begin(), cache, it);  // move to the front to delay eviction
+    return cache.front().second;
+  }
+
+  auto const pattern32 = string_to_char32_vector(pattern);
+  auto prog            = reprog::create_from(pattern32.data(), flags);
+  cache.emplace_front(key, prog);
+  if (cache.size() > max_cached_programs) { cache.pop_back(); }
+  return prog;
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
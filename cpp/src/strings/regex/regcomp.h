@@ -17,6 +17,7 @@
 
 #include <cudf/strings/regex/flags.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -126,6 +127,69 @@ class reprog {
   int32_t _num_capturing_groups;
 };
 
+/**
+ * @brief Deterministic finite automaton compiled from a regex pattern.
+ *
+ * Patterns whose instructions reduce to literal characters combined with
+ * alternation, grouping and repetition (no classes, wildcards, anchors, or
+ * word boundaries) can be executed with a table-driven scan instead of the
+ * backtracking engine. Each input character selects a column (its index in
+ * `symbols`, or the last column for characters that appear nowhere in the
+ * pattern) and the scan follows `table[state * (symbols.size() + 1) + column]`
+ * until an accepting state is reached or the string is exhausted.
+ *
+ * State 0 is the dead state. When built with `match_anywhere`, the start
+ * states are folded into every transition so a match may begin at any
+ * position without restarting the scan.
+ */
+struct reprog_dfa {
+  std::vector<char32_t> symbols;   // sorted distinct literal characters
+  std::vector<int16_t> table;      // num_states x (symbols.size() + 1) transition ids
+  std::vector<uint8_t> accepting;  // per-state accept flags
+  int16_t start_id;                // initial state id
+
+  /**
+   * @brief Builds a DFA for the given pattern, if the pattern is convertible.
+   *
+   * @param pattern Regular expression encoded with UTF-8
+   * @param flags Regex flags for interpreting special characters in the pattern
+   * @param match_anywhere If true, the automaton finds matches starting at any
+   * position; otherwise matches must start at the beginning of the string
+   * @return The compiled automaton, or nullptr if the pattern cannot be
+   * converted to a DFA
+   */
+  static std::unique_ptr<reprog_dfa> create_from(std::string const& pattern,
+                                                 regex_flags const flags,
+                                                 bool match_anywhere);
+};
+
+/**
+ * @brief Converts UTF-8 string into fixed-width 32-bit character vector.
+ *
+ * No character conversion occurs.
+ * Each UTF-8 character is promoted into a 32-bit value.
+ * The last entry in the returned vector will be a 0 value.
+ * The fixed-width vector makes it easier to compile and faster to execute.
+ *
+ * @param pattern Regular expression encoded with UTF-8.
+ * @return Fixed-width 32-bit character vector.
+ */
+std::vector<char32_t> string_to_char32_vector(std::string const& pattern);
+
+/**
+ * @brief Returns the compiled program for the given pattern, compiling it only if it is
+ * not already cached.
+ *
+ * The cache is process-wide, thread-safe, keyed by (pattern, flags) and evicts the least
+ * recently used program once full. It keeps pipelines that repeatedly execute the same
+ * patterns from paying the compilation cost on every call.
+ *
+ * @param pattern Regular expression encoded with UTF-8
+ * @param flags Regex flags for interpreting special characters in the pattern
+ * @return Copy of the cached compiled program
+ */
+reprog get_cached_program(std::string const& pattern, regex_flags const flags);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -45,6 +45,7 @@ using match_result = thrust::optional<match_pair>;
 constexpr int32_t RX_STACK_SMALL  = 112;    ///< fastest stack size
 constexpr int32_t RX_STACK_MEDIUM = 1104;   ///< faster stack size
 constexpr int32_t RX_STACK_LARGE  = 10128;  ///< fast stack size
+constexpr int32_t RX_STACK_XLARGE = 20256;  ///< largest thread-local stack size
 constexpr int32_t RX_STACK_ANY    = 8;      ///< slowest: uses global memory
 
 /**
@@ -55,10 +56,16 @@ constexpr int32_t RX_STACK_ANY    = 8;      ///< slowest: uses global memory
  * Formula is based on relist::data_size_for() calculation;
  * Stack ≈ (8+2)*x + (x/8) = 10.125x < 11x  where x is number of instructions
  * ```
+ *
+ * The XLARGE tier doubles the LARGE stack so medium-complexity patterns stay in
+ * thread-local memory instead of falling off to the much slower global-memory
+ * path. It is not grown further because the local-memory footprint scales with
+ * the maximum number of resident threads on the device.
  */
 constexpr int32_t RX_SMALL_INSTS  = (RX_STACK_SMALL / 11);
 constexpr int32_t RX_MEDIUM_INSTS = (RX_STACK_MEDIUM / 11);
 constexpr int32_t RX_LARGE_INSTS  = (RX_STACK_LARGE / 11);
+constexpr int32_t RX_XLARGE_INSTS = (RX_STACK_XLARGE / 11);
 
 /**
  * @brief Regex class stored on the device and executed by reprog_device.
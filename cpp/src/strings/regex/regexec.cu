@@ -27,18 +27,7 @@
 namespace cudf {
 namespace strings {
 namespace detail {
-namespace {
-/**
- * @brief Converts UTF-8 string into fixed-width 32-bit character vector.
- *
- * No character conversion occurs.
- * Each UTF-8 character is promoted into a 32-bit value.
- * The last entry in the returned vector will be a 0 value.
- * The fixed-width vector makes it easier to compile and faster to execute.
- *
- * @param pattern Regular expression encoded with UTF-8.
- * @return Fixed-width 32-bit character vector.
- */
+// Documented in regcomp.h; also used to build reprog_dfa instances.
 std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
 {
   size_type size  = static_cast<size_type>(pattern.size());
@@ -59,8 +48,6 @@ std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
   return result;
 }
 
-}  // namespace
-
 // Copy reprog primitive values
 reprog_device::reprog_device(reprog& prog)
   : _startinst_id{prog.get_start_inst()},
@@ -90,9 +77,9 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   size_type strings_count,
   rmm::cuda_stream_view stream)
 {
-  std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
-  // compile pattern into host object
-  reprog h_prog = reprog::create_from(pattern32.data(), flags);
+  // compile pattern into host object; the process-wide cache avoids recompiling
+  // patterns that are executed repeatedly
+  reprog h_prog = get_cached_program(pattern, flags);
   // compute size to hold all the member data
   auto insts_count   = h_prog.insts_count();
   auto classes_count = h_prog.classes_count();
@@ -109,7 +96,7 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   size_t memsize  = insts_size + startids_size + classes_size;
   size_t rlm_size = 0;
   // check memory size needed for executing regex
-  if (insts_count > RX_LARGE_INSTS) {
+  if (insts_count > RX_XLARGE_INSTS) {
     auto relist_alloc_size = relist::alloc_size(insts_count);
     rlm_size               = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
   }
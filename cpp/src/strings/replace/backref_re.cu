@@ -150,6 +150,13 @@ std::unique_ptr<column> replace_with_backrefs(
         strings.size(),
         stream,
         mr);
+    } else if (regex_insts <= RX_XLARGE_INSTS) {
+      return make_strings_children(
+        backrefs_fn<BackRefIterator, RX_STACK_XLARGE>{
+          *d_strings, *d_prog, d_repl_template, backrefs.begin(), backrefs.end()},
+        strings.size(),
+        stream,
+        mr);
     } else {
       return make_strings_children(
         backrefs_fn<BackRefIterator, RX_STACK_ANY>{
@@ -193,6 +193,13 @@ std::unique_ptr<column> replace_re(
         strings_count,
         stream,
         mr);
+    else if (regex_insts <= RX_XLARGE_INSTS)
+      return make_strings_children(
+        replace_multi_regex_fn<RX_STACK_XLARGE>{
+          *d_strings, d_progs, static_cast<size_type>(progs.size()), d_found_ranges, *d_repls},
+        strings_count,
+        stream,
+        mr);
     else
       return make_strings_children(
         replace_multi_regex_fn<RX_STACK_ANY>{
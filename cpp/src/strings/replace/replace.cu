@@ -21,6 +21,7 @@
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/detail/replace.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
@@ -753,6 +754,131 @@ struct replace_multi_fn {
   }
 };
 
+// Transitions per trie node -- one per possible byte value.
+constexpr size_type trie_width = 256;
+
+// Minimum number of targets before building the targets trie pays for its
+// host-side construction and extra device memory.
+constexpr size_type trie_threshold = 8;
+
+/**
+ * @brief Byte trie over the target strings serialized for device traversal.
+ *
+ * Each node owns `trie_width` entries in `next` giving the child node for
+ * that byte value (-1 if none). The entry in `match` for a node is the
+ * first-listed target terminating at that node (-1 if none). Node 0 is the
+ * root.
+ */
+struct targets_trie {
+  rmm::device_uvector<int32_t> next;
+  rmm::device_uvector<int32_t> match;
+};
+
+/**
+ * @brief Builds a serialized trie from the given target strings.
+ *
+ * The targets are copied to the host to build the trie since they are
+ * expected to be small relative to the strings column being processed.
+ */
+targets_trie build_targets_trie(strings_column_view const& targets, rmm::cuda_stream_view stream)
+{
+  auto const offsets = cudf::detail::make_std_vector_sync(
+    device_span<int32_t const>{targets.offsets_begin(),
+                               static_cast<std::size_t>(targets.size()) + 1},
+    stream);
+  auto const first_offset = offsets.front();
+  auto const chars        = cudf::detail::make_std_vector_sync(
+    device_span<char const>{targets.chars_begin() + first_offset,
+                            static_cast<std::size_t>(offsets.back() - first_offset)},
+    stream);
+
+  std::vector<int32_t> h_next(trie_width, -1);  // start with only the root node
+  std::vector<int32_t> h_match(1, -1);
+  for (size_type tgt_idx = 0; tgt_idx < targets.size(); ++tgt_idx) {
+    int32_t node = 0;
+    for (auto pos = offsets[tgt_idx]; pos < offsets[tgt_idx + 1]; ++pos) {
+      auto const edge = node * trie_width + static_cast<uint8_t>(chars[pos - first_offset]);
+      if (h_next[edge] < 0) {
+        h_next[edge] = static_cast<int32_t>(h_match.size());
+        h_next.resize(h_next.size() + trie_width, -1);
+        h_match.push_back(-1);
+      }
+      node = h_next[edge];
+    }
+    // ascending order ensures the first-listed of any duplicate targets wins
+    if ((offsets[tgt_idx + 1] > offsets[tgt_idx]) && (h_match[node] < 0)) h_match[node] = tgt_idx;
+  }
+
+  return targets_trie{cudf::detail::make_device_uvector_async(h_next, stream),
+                      cudf::detail::make_device_uvector_async(h_match, stream)};
+}
+
+/**
+ * @brief Trie-based function logic for the replace_multi API.
+ *
+ * Instead of comparing every target against every byte position, each
+ * position makes a single walk down a trie of all the targets so the work
+ * per position is bounded by the longest target rather than by the number
+ * of targets.
+ */
+struct replace_multi_trie_fn {
+  column_device_view const d_strings;
+  column_device_view const d_repls;
+  int32_t const* d_trie_next;   // trie_width transitions per node; -1 means no edge
+  int32_t const* d_trie_match;  // first-listed target ending at each node; -1 means none
+  int32_t* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+    auto const d_str   = d_strings.element<string_view>(idx);
+    char const* in_ptr = d_str.data();
+
+    size_type bytes = d_str.size_bytes();
+    size_type spos  = 0;
+    size_type lpos  = 0;
+    char* out_ptr   = d_chars ? d_chars + d_offsets[idx] : nullptr;
+
+    while (spos < d_str.size_bytes()) {
+      // walk the trie from this position keeping the first-listed target
+      // found to mirror the check-each-target-in-order replace behavior
+      int32_t node     = 0;
+      int32_t tgt_idx  = -1;
+      size_type length = 0;
+      for (size_type wpos = spos; wpos < d_str.size_bytes(); ++wpos) {
+        node = d_trie_next[node * trie_width + static_cast<uint8_t>(in_ptr[wpos])];
+        if (node < 0) break;
+        auto const match = d_trie_match[node];
+        if ((match >= 0) && ((tgt_idx < 0) || (match < tgt_idx))) {
+          tgt_idx = match;
+          length  = wpos + 1 - spos;
+        }
+      }
+      if (tgt_idx >= 0) {
+        auto const d_repl = (d_repls.size() == 1) ? d_repls.element<string_view>(0)
+                                                  : d_repls.element<string_view>(tgt_idx);
+        bytes += d_repl.size_bytes() - length;
+        if (out_ptr) {
+          out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
+          out_ptr = copy_string(out_ptr, d_repl);
+          lpos    = spos + length;
+        }
+        spos += length;
+      } else {
+        ++spos;
+      }
+    }
+    if (out_ptr)  // copy remainder
+      memcpy(out_ptr, in_ptr + lpos, d_str.size_bytes() - lpos);
+    else
+      d_offsets[idx] = bytes;
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<column> replace(strings_column_view const& strings,
@@ -774,8 +900,18 @@ std::unique_ptr<column> replace(strings_column_view const& strings,
   auto d_repls   = column_device_view::create(repls.parent(), stream);
 
   // this utility calls the given functor to build the offsets and chars columns
-  auto children = cudf::strings::detail::make_strings_children(
-    replace_multi_fn{*d_strings, *d_targets, *d_repls}, strings.size(), stream, mr);
+  auto children = [&] {
+    if (targets.size() >= trie_threshold) {
+      auto const trie = build_targets_trie(targets, stream);
+      return cudf::strings::detail::make_strings_children(
+        replace_multi_trie_fn{*d_strings, *d_repls, trie.next.data(), trie.match.data()},
+        strings.size(),
+        stream,
+        mr);
+    }
+    return cudf::strings::detail::make_strings_children(
+      replace_multi_fn{*d_strings, *d_targets, *d_repls}, strings.size(), stream, mr);
+  }();
 
   return make_strings_column(strings.size(),
                              std::move(children.first),
@@ -146,6 +146,12 @@ std::unique_ptr<column> replace_re(
         strings_count,
         stream,
         mr);
+    else if (regex_insts <= RX_XLARGE_INSTS)
+      return make_strings_children(
+        replace_regex_fn<RX_STACK_XLARGE>{d_strings, d_prog, d_repl, maxrepl},
+        strings_count,
+        stream,
+        mr);
     else
       return make_strings_children(
         replace_regex_fn<RX_STACK_ANY>{d_strings, d_prog, d_repl, maxrepl},
@@ -28,6 +28,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/transform.h>
 
@@ -258,6 +259,70 @@ std::unique_ptr<column> split_record_fn(strings_column_view const& strings,
                            copy_bitmask(strings.parent(), stream, mr));
 }
 
+// The output is one list of (byte offset, byte length) structs per string
+template <typename TokenCounter, typename TokenReader>
+std::unique_ptr<column> split_to_list_view_fn(strings_column_view const& strings,
+                                              TokenCounter counter,
+                                              TokenReader reader,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  // create offsets column by counting the number of tokens per string
+  auto strings_count = strings.size();
+  auto offsets       = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    d_offsets,
+                    counter);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+
+  // last entry is the total number of tokens to be generated
+  auto total_tokens = cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+  // split each string into an array of index-pair values
+  rmm::device_uvector<string_index_pair> tokens(total_tokens, stream);
+  reader.d_token_offsets = d_offsets;
+  reader.d_tokens        = tokens.data();
+  thrust::for_each_n(
+    rmm::exec_policy(stream), thrust::make_counting_iterator<size_type>(0), strings_count, reader);
+
+  // convert the token pointers into byte offsets within the input chars data;
+  // no token character data is copied
+  auto token_offsets = make_numeric_column(
+    data_type{type_id::INT32}, total_tokens, mask_state::UNALLOCATED, stream, mr);
+  auto token_lengths = make_numeric_column(
+    data_type{type_id::INT32}, total_tokens, mask_state::UNALLOCATED, stream, mr);
+  auto const d_chars = strings.chars().data<char>();
+  thrust::transform(rmm::exec_policy(stream),
+                    tokens.begin(),
+                    tokens.end(),
+                    thrust::make_zip_iterator(
+                      thrust::make_tuple(token_offsets->mutable_view().data<int32_t>(),
+                                         token_lengths->mutable_view().data<int32_t>())),
+                    [d_chars] __device__(string_index_pair const& token) {
+                      // zero-length tokens may point at a placeholder outside the chars data
+                      auto const offset = (token.first == nullptr || token.second == 0)
+                                            ? 0
+                                            : static_cast<int32_t>(token.first - d_chars);
+                      return thrust::make_tuple(offset, token.second);
+                    });
+
+  std::vector<std::unique_ptr<column>> children;
+  children.emplace_back(std::move(token_offsets));
+  children.emplace_back(std::move(token_lengths));
+  auto structs =
+    make_structs_column(total_tokens, std::move(children), 0, rmm::device_buffer{}, stream, mr);
+  // create a lists column using the offsets and the structs columns
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           std::move(structs),
+                           strings.null_count(),
+                           copy_bitmask(strings.parent(), stream, mr));
+}
+
 template <Dir dir>
 std::unique_ptr<column> split_record(
   strings_column_view const& strings,
@@ -288,6 +353,36 @@ std::unique_ptr<column> split_record(
   }
 }
 
+std::unique_ptr<column> split_to_list_view(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
+
+  // makes consistent with Pandas
+  size_type max_tokens = maxsplit > 0 ? maxsplit + 1 : std::numeric_limits<size_type>::max();
+
+  auto d_strings_column_ptr = column_device_view::create(strings.parent(), stream);
+  if (delimiter.size() == 0) {
+    return split_to_list_view_fn(
+      strings,
+      whitespace_token_counter_fn{*d_strings_column_ptr, max_tokens},
+      whitespace_token_reader_fn<Dir::FORWARD>{*d_strings_column_ptr, max_tokens},
+      stream,
+      mr);
+  } else {
+    string_view d_delimiter(delimiter.data(), delimiter.size());
+    return split_to_list_view_fn(strings,
+                                 token_counter_fn{*d_strings_column_ptr, d_delimiter, max_tokens},
+                                 token_reader_fn<Dir::FORWARD>{*d_strings_column_ptr, d_delimiter},
+                                 stream,
+                                 mr);
+  }
+}
+
 }  // namespace detail
 
 // external APIs
@@ -312,5 +407,14 @@ std::unique_ptr<column> rsplit_record(strings_column_view const& strings,
     strings, delimiter, maxsplit, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> split_to_list_view(strings_column_view const& strings,
+                                           string_scalar const& delimiter,
+                                           size_type maxsplit,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_to_list_view(strings, delimiter, maxsplit, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
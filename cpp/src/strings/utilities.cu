@@ -98,6 +98,19 @@ std::unique_ptr<cudf::column> child_chars_from_string_vector(cudf::device_span<s
   return chars_column;
 }
 
+/**
+ * @copydoc prefer_warp_parallel
+ */
+bool prefer_warp_parallel(strings_column_view const& input)
+{
+  // Below this average size a thread-per-string kernel wins: the extra warps
+  // mostly idle and the launch covers 32x as many threads.
+  constexpr int64_t avg_char_bytes_threshold = 64;
+  auto const rows                            = input.size() - input.null_count();
+  if (rows <= 0) return false;
+  return (static_cast<int64_t>(input.chars_size()) / rows) > avg_char_bytes_threshold;
+}
+
 //
 std::unique_ptr<column> create_chars_child_column(cudf::size_type total_bytes,
                                                   rmm::cuda_stream_view stream,
@@ -72,8 +72,20 @@ bool is_relationally_comparable(TableView const& lhs, TableView const& rhs)
                         [lhs, rhs] __device__(auto const i) {
                           // Simplified this for compile time. (Ideally use double_type_dispatcher)
                           // TODO: possible to implement without double type dispatcher.
-                          return lhs.column(i).type() == rhs.column(i).type() and
-                                 type_dispatcher(lhs.column(i).type(),
+                          if (lhs.column(i).type() != rhs.column(i).type()) { return false; }
+                          // Single-level STRUCT columns are compared member by member, so they
+                          // are comparable iff every member is itself comparable.
+                          if (lhs.column(i).type().id() == type_id::STRUCT) {
+                            auto const& col = lhs.column(i);
+                            for (size_type child = 0; child < col.num_child_columns(); ++child) {
+                              if (not type_dispatcher(col.child(child).type(),
+                                                      is_relationally_comparable_functor{})) {
+                                return false;
+                              }
+                            }
+                            return true;
+                          }
+                          return type_dispatcher(lhs.column(i).type(),
                                                  is_relationally_comparable_functor{});
                         });
 }
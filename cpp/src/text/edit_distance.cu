@@ -23,11 +23,13 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
@@ -35,6 +37,16 @@ namespace nvtext {
 namespace detail {
 namespace {
 
+// Pairs where the shorter string has at least this many characters are computed
+// with a block of threads walking each anti-diagonal of the DP matrix in parallel
+// instead of a single thread serializing all the cell updates.
+constexpr cudf::size_type long_string_threshold = 256;
+// Number of threads cooperating on one long pair
+constexpr int long_pair_block_size = 128;
+// The 3 DP lines are kept in shared memory when the shorter string has no more
+// characters than this; longer pairs fall back to the global memory work buffer.
+constexpr cudf::size_type shared_band_size = 4096;
+
 /**
  * @brief Compute the edit-distance between two strings
  *
@@ -89,6 +101,65 @@ __device__ int32_t compute_distance(cudf::string_view const& d_str,
   return static_cast<int32_t>(line0[lengths.first - 1]);
 }
 
+/**
+ * @brief Compute the edit-distance between two long strings with a block of threads
+ *
+ * Same algorithm as compute_distance() but the cells of each anti-diagonal are
+ * independent and so are computed by the threads of the block in parallel with
+ * a synchronization between diagonals. The 3 DP lines are placed in shared
+ * memory when the shorter string fits within the shared-memory band; otherwise
+ * the global memory work buffer is used.
+ *
+ * All threads of the block must call this function and all receive the result.
+ *
+ * @param d_str First string
+ * @param d_tgt Second string
+ * @param buffer Temporary memory buffer used when shared memory is too small.
+ * @return Edit distance value
+ */
+__device__ int32_t compute_distance_block(cudf::string_view const& d_str,
+                                          cudf::string_view const& d_tgt,
+                                          int16_t* buffer)
+{
+  auto const str_length = d_str.length();
+  auto const tgt_length = d_tgt.length();
+
+  auto itr_A = str_length < tgt_length ? d_str.begin() : d_tgt.begin();
+  auto itr_B = str_length < tgt_length ? d_tgt.begin() : d_str.begin();
+  // .first is min and .second is max
+  auto const lengths = std::minmax(str_length, tgt_length);
+  // setup compute buffer pointers
+  extern __shared__ int16_t shared_lines[];
+  auto line2 = lengths.first <= shared_band_size ? shared_lines : buffer;
+  auto line1 = line2 + lengths.first;
+  auto line0 = line1 + lengths.first;
+  // range is both lengths
+  auto const range = lengths.first + lengths.second - 1;
+  for (cudf::size_type i = 0; i < range; ++i) {
+    auto tmp = line2;
+    line2    = line1;
+    line1    = line0;
+    line0    = tmp;
+    // each thread computes a stride of cells along the anti-diagonal
+    for (int x = (i < lengths.second ? 0 : i - lengths.second + 1) + static_cast<int>(threadIdx.x);
+         (x < lengths.first) && (x < i + 1);
+         x += static_cast<int>(blockDim.x)) {
+      int const y = i - x;
+      itr_A += (x - itr_A.position());  // point to next
+      itr_B += (y - itr_B.position());  // characters to check
+      int16_t const w =
+        (((x > 0) && (y > 0)) ? line2[x - 1] : static_cast<int16_t>(std::max(x, y))) +
+        static_cast<int16_t>(*itr_A != *itr_B);  // add 1 if characters do not match
+      int16_t const u = (y > 0 ? line1[x] : x + 1) + 1;
+      int16_t const v = (x > 0 ? line1[x - 1] : y + 1) + 1;
+      // store min(u,v,w)
+      line0[x] = std::min(std::min(u, v), w);
+    }
+    __syncthreads();  // complete the diagonal before starting the next one
+  }
+  return static_cast<int32_t>(line0[lengths.first - 1]);
+}
+
 /**
  * @brief Compute the Levenshtein distance for each string.
  *
@@ -110,8 +181,22 @@ struct edit_distance_levenshtein_algorithm {
       return d_targets.size() == 1 ? d_targets.element<cudf::string_view>(0)
                                    : d_targets.element<cudf::string_view>(idx);
     }();
+    if (std::min(d_str.length(), d_tgt.length()) >= long_string_threshold) {
+      return;  // computed by the block-per-pair kernel
+    }
     d_results[idx] = compute_distance(d_str, d_tgt, d_buffer + d_results[idx]);
   }
+
+  // block-per-pair entry point for long strings;
+  // d_results[idx] still holds the buffer offset for this pair on input
+  __device__ void compute_long(cudf::size_type idx)
+  {
+    auto d_str = d_strings.element<cudf::string_view>(idx);
+    auto d_tgt = d_targets.size() == 1 ? d_targets.element<cudf::string_view>(0)
+                                       : d_targets.element<cudf::string_view>(idx);
+    auto const distance = compute_distance_block(d_str, d_tgt, d_buffer + d_results[idx]);
+    if (threadIdx.x == 0) { d_results[idx] = distance; }
+  }
 };
 
 struct edit_distance_matrix_levenshtein_algorithm {
@@ -130,13 +215,43 @@ struct edit_distance_matrix_levenshtein_algorithm {
       d_strings.is_null(row) ? cudf::string_view{} : d_strings.element<cudf::string_view>(row);
     cudf::string_view d_str2 =
       d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
+    if (row != col && std::min(d_str1.length(), d_str2.length()) >= long_string_threshold) {
+      return;  // computed by the block-per-pair kernel
+    }
     auto work_buffer       = d_buffer + d_offsets[idx - ((row + 1) * (row + 2)) / 2];
     int32_t const distance = (row == col) ? 0 : compute_distance(d_str1, d_str2, work_buffer);
     d_results[idx]         = distance;                // top half of matrix
     d_results[col * strings_count + row] = distance;  // bottom half of matrix
   }
+
+  // block-per-pair entry point for long strings
+  __device__ void compute_long(cudf::size_type idx)
+  {
+    auto const strings_count = d_strings.size();
+    auto const row           = idx / strings_count;
+    auto const col           = idx % strings_count;
+    auto const d_str1        = d_strings.element<cudf::string_view>(row);
+    auto const d_str2        = d_strings.element<cudf::string_view>(col);
+    auto work_buffer         = d_buffer + d_offsets[idx - ((row + 1) * (row + 2)) / 2];
+    auto const distance      = compute_distance_block(d_str1, d_str2, work_buffer);
+    if (threadIdx.x == 0) {
+      d_results[idx]                       = distance;  // top half of matrix
+      d_results[col * strings_count + row] = distance;  // bottom half of matrix
+    }
+  }
 };
 
+/**
+ * @brief Computes long string pairs with a block of threads per pair
+ *
+ * The `d_indices` array identifies the pairs the thread-per-pair pass skipped.
+ */
+template <typename DistanceFn>
+__global__ void edit_distance_long_kernel(DistanceFn fn, cudf::size_type const* d_indices)
+{
+  fn.compute_long(d_indices[blockIdx.x]);
+}
+
 }  // namespace
 
 /**
@@ -191,14 +306,38 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
   rmm::device_uvector<int16_t> compute_buffer(compute_size, stream);
   auto d_buffer = compute_buffer.data();
 
+  // gather the rows where both strings are long;
+  // these are assigned a block of threads per pair instead of a single thread
+  rmm::device_uvector<cudf::size_type> long_rows(strings_count, stream);
+  auto const long_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                    long_rows.begin(),
+                    [d_strings, d_targets] __device__(auto idx) {
+                      if (d_strings.is_null(idx) || d_targets.is_null(idx)) return false;
+                      auto d_str = d_strings.element<cudf::string_view>(idx);
+                      auto d_tgt = d_targets.size() == 1 ? d_targets.element<cudf::string_view>(0)
+                                                         : d_targets.element<cudf::string_view>(idx);
+                      return std::min(d_str.length(), d_tgt.length()) >= long_string_threshold;
+                    });
+  auto const long_count =
+    static_cast<cudf::size_type>(thrust::distance(long_rows.begin(), long_end));
+
   // compute the edit distance into the output column in-place
   // - on input, d_results is the offset to the working section of d_buffer for each row
   // - on output, d_results is the calculated edit distance for that row
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<cudf::size_type>(0),
-    strings_count,
-    edit_distance_levenshtein_algorithm{d_strings, d_targets, d_buffer, d_results});
+  edit_distance_levenshtein_algorithm fn{d_strings, d_targets, d_buffer, d_results};
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     fn);
+  if (long_count > 0) {
+    auto const shmem_size = 3 * shared_band_size * sizeof(int16_t);
+    edit_distance_long_kernel<<<long_count, long_pair_block_size, shmem_size, stream.value()>>>(
+      fn, long_rows.data());
+    CHECK_CUDA(stream.value());
+  }
   return results;
 }
 
@@ -261,11 +400,39 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
                                                stream,
                                                mr);
   auto d_results = results->mutable_view().data<int32_t>();
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<cudf::size_type>(0),
-    strings_count * strings_count,
-    edit_distance_matrix_levenshtein_algorithm{d_strings, d_buffer, d_offsets, d_results});
+
+  // gather the matrix entries where both strings are long;
+  // these are assigned a block of threads per pair instead of a single thread
+  rmm::device_uvector<cudf::size_type> long_entries(n_upper, stream);
+  auto const long_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(strings_count * strings_count),
+                    long_entries.begin(),
+                    [d_strings, strings_count] __device__(auto idx) {
+                      auto const row = idx / strings_count;
+                      auto const col = idx % strings_count;
+                      if (row >= col || d_strings.is_null(row) || d_strings.is_null(col)) {
+                        return false;
+                      }
+                      auto const d_str1 = d_strings.element<cudf::string_view>(row);
+                      auto const d_str2 = d_strings.element<cudf::string_view>(col);
+                      return std::min(d_str1.length(), d_str2.length()) >= long_string_threshold;
+                    });
+  auto const long_count =
+    static_cast<cudf::size_type>(thrust::distance(long_entries.begin(), long_end));
+
+  edit_distance_matrix_levenshtein_algorithm fn{d_strings, d_buffer, d_offsets, d_results};
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count * strings_count,
+                     fn);
+  if (long_count > 0) {
+    auto const shmem_size = 3 * shared_band_size * sizeof(int16_t);
+    edit_distance_long_kernel<<<long_count, long_pair_block_size, shmem_size, stream.value()>>>(
+      fn, long_entries.data());
+    CHECK_CUDA(stream.value());
+  }
 
   // build a lists column of the results
   auto offsets_column = cudf::make_fixed_width_column(cudf::data_type{cudf::type_id::INT32},
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nvtext/minhash.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Computes one hash of a MinHash signature.
+ *
+ * Each thread handles one (string, seed) pair by hashing every character
+ * ngram of the string with that seed and keeping the minimum hash value.
+ * The ngrams are hashed in place from the string data -- no intermediate
+ * ngram strings are created.
+ */
+struct minhash_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type ngrams;      // ngram width in characters
+  cudf::size_type num_hashes;  // hashes per signature
+  uint32_t* d_results;         // output signature values
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    auto const str_idx  = idx / num_hashes;
+    auto const hash_idx = idx % num_hashes;
+    if (d_strings.is_null(str_idx)) {
+      d_results[idx] = 0;
+      return;
+    }
+    auto const d_str = d_strings.element<cudf::string_view>(str_idx);
+    auto const hasher =
+      cudf::detail::MurmurHash3_32<cudf::string_view>{static_cast<uint32_t>(hash_idx)};
+
+    if (d_str.length() < ngrams) {  // too short; hash the whole string
+      d_results[idx] = hasher(d_str);
+      return;
+    }
+
+    auto result          = std::numeric_limits<uint32_t>::max();
+    auto itr             = d_str.begin();           // leading edge of the ngram
+    auto itr_end         = d_str.begin() + ngrams;  // trailing edge of the ngram
+    auto const ngram_count = d_str.length() + 1 - ngrams;
+    for (cudf::size_type n = 0; n < ngram_count; ++n, ++itr, ++itr_end) {
+      auto const begin = itr.byte_offset();
+      auto const end   = itr_end.byte_offset();
+      auto const hash_value =
+        hasher(cudf::string_view(d_str.data() + begin, end - begin));
+      result = std::min(result, hash_value);
+    }
+    d_results[idx] = result;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::size_type ngrams,
+                                      cudf::size_type num_hashes,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+  CUDF_EXPECTS(num_hashes > 0, "Parameter num_hashes must be greater than zero");
+
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::LIST});
+  CUDF_EXPECTS(static_cast<size_t>(strings_count) * static_cast<size_t>(num_hashes) <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>().max()),
+               "too many hashes to create the output column");
+
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  // compute all the signature values;
+  // each thread computes one hash of one signature
+  auto results   = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                           strings_count * num_hashes,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_results = results->mutable_view().data<uint32_t>();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count * num_hashes,
+                     minhash_fn{d_strings, ngrams, num_hashes, d_results});
+
+  // build a lists column of the results -- each signature is one list
+  auto offsets_column = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                  strings_count + 1,
+                                                  cudf::mask_state::UNALLOCATED,
+                                                  stream,
+                                                  mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<int32_t>(0),
+                    thrust::make_counting_iterator<int32_t>(strings_count + 1),
+                    offsets_column->mutable_view().data<int32_t>(),
+                    [num_hashes] __device__(auto idx) { return idx * num_hashes; });
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets_column),
+                                 std::move(results),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::size_type ngrams,
+                                      cudf::size_type num_hashes,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, ngrams, num_hashes, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
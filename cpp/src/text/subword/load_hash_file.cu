@@ -32,6 +32,9 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace nvtext {
@@ -301,6 +304,32 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   return std::make_unique<hashed_vocabulary>(std::move(result));
 }
 
+/**
+ * @brief Return the device-resident vocabulary for the given file, loading it on first use.
+ *
+ * The vocabulary tables are kept in a process-wide cache keyed by file path so
+ * repeated tokenize calls (possibly from different host threads) share a single
+ * device copy instead of re-reading and re-uploading the table each time.
+ * Cached entries are allocated with the current device memory resource since
+ * they outlive any single call.
+ */
+std::shared_ptr<hashed_vocabulary const> get_cached_vocabulary(
+  std::string const& filename_hashed_vocabulary, rmm::cuda_stream_view stream)
+{
+  static std::mutex vocab_cache_mutex;
+  static std::map<std::string, std::shared_ptr<hashed_vocabulary const>> vocab_cache;
+
+  std::lock_guard<std::mutex> guard(vocab_cache_mutex);
+  auto found = vocab_cache.find(filename_hashed_vocabulary);
+  if (found == vocab_cache.end()) {
+    std::shared_ptr<hashed_vocabulary const> vocabulary = load_vocabulary_file(
+      filename_hashed_vocabulary, stream, rmm::mr::get_current_device_resource());
+    stream.synchronize();  // ensure the upload completes before sharing across threads
+    found = vocab_cache.emplace(filename_hashed_vocabulary, std::move(vocabulary)).first;
+  }
+  return found->second;
+}
+
 }  // namespace detail
 
 std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
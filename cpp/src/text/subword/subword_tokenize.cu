@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
@@ -29,6 +30,9 @@
 #include <thrust/for_each.h>
 #include <thrust/transform_scan.h>
 
+#include <algorithm>
+#include <iterator>
+
 namespace nvtext {
 namespace detail {
 namespace {
@@ -247,6 +251,49 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+tokenizer_result subword_tokenize_batch(std::vector<cudf::strings_column_view> const& batch,
+                                        hashed_vocabulary const& vocab_table,
+                                        uint32_t max_sequence_length,
+                                        uint32_t stride,
+                                        bool do_lower_case,
+                                        bool do_truncate,
+                                        uint32_t max_rows_tensor,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!batch.empty(), "batch must contain at least one strings column");
+  if (batch.size() == 1) {
+    return subword_tokenize(batch.front(),
+                            vocab_table,
+                            max_sequence_length,
+                            stride,
+                            do_lower_case,
+                            do_truncate,
+                            max_rows_tensor,
+                            stream,
+                            mr);
+  }
+
+  // Combine the batch so the tokenizer kernel sequence runs only once for all columns.
+  std::vector<cudf::column_view> views;
+  views.reserve(batch.size());
+  std::transform(batch.begin(), batch.end(), std::back_inserter(views), [](auto const& input) {
+    return input.parent();
+  });
+  auto const combined =
+    cudf::detail::concatenate(views, stream, rmm::mr::get_current_device_resource());
+
+  return subword_tokenize(cudf::strings_column_view(combined->view()),
+                          vocab_table,
+                          max_sequence_length,
+                          stride,
+                          do_lower_case,
+                          do_truncate,
+                          max_rows_tensor,
+                          stream,
+                          mr);
+}
+
 }  // namespace detail
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -258,7 +305,8 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   uint32_t max_rows_tensor,
                                   rmm::mr::device_memory_resource* mr)
 {
-  auto vocab_table = load_vocabulary_file(filename_hashed_vocabulary, mr);
+  auto vocab_table =
+    detail::get_cached_vocabulary(filename_hashed_vocabulary, rmm::cuda_stream_default);
   CUDF_FUNC_RANGE();
   return detail::subword_tokenize(strings,
                                   *vocab_table,
@@ -292,4 +340,25 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   mr);
 }
 
+tokenizer_result subword_tokenize_batch(std::vector<cudf::strings_column_view> const& batch,
+                                        hashed_vocabulary const& vocabulary_table,
+                                        uint32_t max_sequence_length,
+                                        uint32_t stride,
+                                        bool do_lower_case,
+                                        bool do_truncate,
+                                        uint32_t max_rows_tensor,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::subword_tokenize_batch(batch,
+                                        vocabulary_table,
+                                        max_sequence_length,
+                                        stride,
+                                        do_lower_case,
+                                        do_truncate,
+                                        max_rows_tensor,
+                                        rmm::cuda_stream_default,
+                                        mr);
+}
+
 }  // namespace nvtext
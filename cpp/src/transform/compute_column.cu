@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "compute_column_jit.hpp"
+
 #include <cudf/ast/detail/expression_evaluator.cuh>
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
@@ -90,6 +92,16 @@ std::unique_ptr<column> compute_column(table_view const& table,
 
   auto const parser = ast::detail::expression_parser{expr, table, has_nulls, stream, mr};
 
+  // Eligible expressions over non-nullable numeric columns are JIT-compiled
+  // into a fused kernel, avoiding the per-row operator dispatch and
+  // shared-memory intermediates of the interpreting kernel below.
+  if (!has_nulls) {
+    if (auto output =
+          transformation::jit::compute_column_jit(table, expr, parser.output_type(), stream, mr)) {
+      return output;
+    }
+  }
+
   auto const output_column_mask_state =
     has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED;
 
@@ -134,7 +146,7 @@ std::unique_ptr<column> compute_column(table_view const& table,
                                        ast::expression const& expr,
                                        rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
+  CUDF_FUNC_RANGE_WITH_PAYLOAD(table.num_rows());
   return detail::compute_column(table, expr, rmm::cuda_stream_default, mr);
 }
 
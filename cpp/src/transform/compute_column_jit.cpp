@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compute_column_jit.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <jit_preprocessed_files/transform/jit/row_expression_kernel.cu.jit.hpp>
+
+#include <jit/cache.hpp>
+#include <jit/type.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+namespace {
+
+/**
+ * @brief Returns the C++ spelling of a binary operator, or nullptr for
+ * operators the expression compiler does not support.
+ *
+ * The device functors behind these ast_operators are the plain C++ operators,
+ * so emitting the operator token reproduces the interpreter's semantics
+ * including the usual arithmetic conversions.
+ */
+char const* binary_operator_token(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::ADD: return "+";
+    case ast::ast_operator::SUB: return "-";
+    case ast::ast_operator::MUL: return "*";
+    case ast::ast_operator::DIV: return "/";
+    case ast::ast_operator::MOD: return "%";
+    case ast::ast_operator::EQUAL: return "==";
+    case ast::ast_operator::NOT_EQUAL: return "!=";
+    case ast::ast_operator::LESS: return "<";
+    case ast::ast_operator::GREATER: return ">";
+    case ast::ast_operator::LESS_EQUAL: return "<=";
+    case ast::ast_operator::GREATER_EQUAL: return ">=";
+    case ast::ast_operator::BITWISE_AND: return "&";
+    case ast::ast_operator::BITWISE_OR: return "|";
+    case ast::ast_operator::BITWISE_XOR: return "^";
+    case ast::ast_operator::LOGICAL_AND: return "&&";
+    case ast::ast_operator::LOGICAL_OR: return "||";
+    default: return nullptr;
+  }
+}
+
+/**
+ * @brief Returns the C++ spelling of a unary operator, or nullptr for
+ * operators the expression compiler does not support.
+ */
+char const* unary_operator_token(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::IDENTITY: return "";
+    case ast::ast_operator::NOT: return "!";
+    case ast::ast_operator::BIT_INVERT: return "~";
+    default: return nullptr;
+  }
+}
+
+/**
+ * @brief Recursively translates an expression tree into C++ source.
+ *
+ * Column references become the row-value parameters `v0..vN-1` of the
+ * generated function. Returns false if any node cannot be translated
+ * (literals, unsupported operators, non-numeric or right-table columns).
+ */
+bool emit_expression(ast::expression const& expr, table_view const& table, std::string& source)
+{
+  if (auto const* col = dynamic_cast<ast::column_reference const*>(&expr)) {
+    if (col->get_table_source() != ast::table_reference::LEFT) { return false; }
+    if (!cudf::is_numeric(col->get_data_type(table))) { return false; }
+    source += "v" + std::to_string(col->get_column_index());
+    return true;
+  }
+  if (auto const* op = dynamic_cast<ast::operation const*>(&expr)) {
+    auto const operands = op->get_operands();
+    if (operands.size() == 1) {
+      auto const token = unary_operator_token(op->get_operator());
+      if (token == nullptr) { return false; }
+      source += "(";
+      source += token;
+      if (!emit_expression(operands[0].get(), table, source)) { return false; }
+      source += ")";
+      return true;
+    }
+    if (operands.size() == 2) {
+      auto const token = binary_operator_token(op->get_operator());
+      if (token == nullptr) { return false; }
+      source += "(";
+      if (!emit_expression(operands[0].get(), table, source)) { return false; }
+      source += " ";
+      source += token;
+      source += " ";
+      if (!emit_expression(operands[1].get(), table, source)) { return false; }
+      source += ")";
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           data_type output_type,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  if (!cudf::is_numeric(output_type)) { return nullptr; }
+  // the kernel binds a data pointer for every table column, so all of them
+  // must have a JIT-compatible numeric layout
+  if (std::any_of(table.begin(), table.end(), [](column_view const& col) {
+        return !cudf::is_numeric(col.type());
+      })) {
+    return nullptr;
+  }
+
+  std::string body;
+  if (!emit_expression(expr, table, body)) { return nullptr; }
+
+  // generate the device function evaluating the expression for one row
+  auto const output_type_name = cudf::jit::get_type_name(output_type);
+  std::string cuda_source     = "#pragma once\n__device__ inline " + output_type_name +
+                            " ROW_EXPRESSION(";
+  for (size_type idx = 0; idx < table.num_columns(); ++idx) {
+    if (idx > 0) { cuda_source += ", "; }
+    cuda_source += cudf::jit::get_type_name(table.column(idx).type()) + " v" + std::to_string(idx);
+  }
+  cuda_source += ") { return static_cast<" + output_type_name + ">(" + body + "); }\n";
+
+  std::vector<std::string> template_types;
+  template_types.reserve(table.num_columns() + 1);
+  template_types.push_back(output_type_name);
+  std::transform(table.begin(),
+                 table.end(),
+                 std::back_inserter(template_types),
+                 [](column_view const& col) { return cudf::jit::get_type_name(col.type()); });
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::row_expression_kernel")
+      .instantiate(template_types);
+
+  auto output_column = cudf::make_fixed_width_column(
+    output_type, table.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (table.num_rows() == 0) { return output_column; }
+
+  cudf::size_type size   = table.num_rows();
+  const void* outcol_ptr = cudf::jit::get_data_ptr(output_column->mutable_view());
+
+  std::vector<void*> kernel_args;
+  kernel_args.reserve(table.num_columns() + 2);
+  kernel_args.insert(kernel_args.begin(), {&size, &outcol_ptr});
+
+  std::vector<const void*> data_ptrs(table.num_columns());
+  std::transform(table.begin(), table.end(), data_ptrs.begin(), [](column_view const& col) {
+    return cudf::jit::get_data_ptr(col);
+  });
+  for (auto& data_ptr : data_ptrs) {
+    kernel_args.push_back(&data_ptr);
+  }
+
+  cudf::jit::get_program_cache(*transform_jit_row_expression_kernel_cu_jit)
+    .get_kernel(
+      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())
+    ->launch(kernel_args.data());
+
+  return output_column;
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+/**
+ * @brief Evaluates an expression by JIT-compiling it into a fused kernel.
+ *
+ * The expression tree is translated into C++ source evaluating one row and
+ * compiled through the jitify program cache, removing the per-row operator
+ * dispatch and shared-memory intermediates of the interpreting kernel.
+ * Only expressions built from column references and arithmetic, comparison,
+ * bitwise and logical operators over non-nullable numeric columns can be
+ * compiled.
+ *
+ * @param table The table used for expression evaluation
+ * @param expr The root of the expression tree
+ * @param output_type The type of the resulting column as computed by the
+ * expression parser
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Output column, or nullptr if the expression cannot be compiled
+ */
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           data_type output_type,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr);
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
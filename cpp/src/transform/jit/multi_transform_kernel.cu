@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/limits>
+#include <cuda/std/tuple>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <transform/jit/operation-udf.hpp>
+
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+// Output columns are passed to the UDF as pointers to the current row, input
+// columns as the current row's value
+template <typename T>
+__device__ T* transform_arg(cuda::std::true_type, T* data, cudf::size_type i)
+{
+  return data + i;
+}
+
+template <typename T>
+__device__ T transform_arg(cuda::std::false_type, T* data, cudf::size_type i)
+{
+  return data[i];
+}
+
+template <int num_outputs, typename... Types, cuda::std::size_t... indices>
+__device__ auto make_transform_args(cudf::size_type i,
+                                    cuda::std::index_sequence<indices...>,
+                                    Types*... data)
+{
+  return cuda::std::make_tuple(
+    transform_arg(
+      cuda::std::integral_constant<bool, (static_cast<int>(indices) < num_outputs)>{}, data, i)...);
+}
+
+template <int num_outputs, typename... Types>
+__global__ void multi_transform_kernel(cudf::size_type size, Types*... data)
+{
+  int const tid    = threadIdx.x;
+  int const blkid  = blockIdx.x;
+  int const blksz  = blockDim.x;
+  int const gridsz = gridDim.x;
+  int const start  = tid + blkid * blksz;
+  int const step   = blksz * gridsz;
+
+  for (cudf::size_type i = start; i < size; i += step) {
+    cuda::std::apply(
+      GENERIC_TRANSFORM_OP,
+      make_transform_args<num_outputs>(
+        i, cuda::std::make_index_sequence<sizeof...(Types)>{}, data...));
+  }
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
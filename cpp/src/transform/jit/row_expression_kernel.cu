@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <transform/jit/operation-udf.hpp>
+
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+template <typename TypeOut, typename... TypeIn>
+__global__ void row_expression_kernel(cudf::size_type size,
+                                      TypeOut* out_data,
+                                      TypeIn const*... in_data)
+{
+  int const tid    = threadIdx.x;
+  int const blkid  = blockIdx.x;
+  int const blksz  = blockDim.x;
+  int const gridsz = gridDim.x;
+
+  int const start = tid + blkid * blksz;
+  int const step  = blksz * gridsz;
+
+  for (cudf::size_type i = start; i < size; i += step) {
+    out_data[i] = ROW_EXPRESSION(in_data[i]...);
+  }
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/null_mask.hpp>
@@ -25,6 +26,7 @@
 
 #include <jit_preprocessed_files/transform/jit/kernel.cu.jit.hpp>
 #include <jit_preprocessed_files/transform/jit/masked_udf_kernel.cu.jit.hpp>
+#include <jit_preprocessed_files/transform/jit/multi_transform_kernel.cu.jit.hpp>
 
 #include <jit/cache.hpp>
 #include <jit/parser.hpp>
@@ -65,6 +67,64 @@ void unary_operation(mutable_column_view output,
              cudf::jit::get_data_ptr(input));
 }
 
+void multi_transform_operation(std::vector<mutable_column_view> const& outputs,
+                               table_view const& inputs,
+                               std::string const& udf,
+                               bool is_ptx,
+                               rmm::cuda_stream_view stream)
+{
+  // The first template argument is the number of output columns; the rest are the
+  // element types of the output columns followed by those of the input columns
+  std::vector<std::string> template_types;
+  template_types.reserve(outputs.size() + inputs.num_columns() + 1);
+  template_types.push_back(std::to_string(outputs.size()));
+  std::transform(
+    outputs.begin(), outputs.end(), std::back_inserter(template_types), [](auto const& out) {
+      return cudf::jit::get_type_name(out.type());
+    });
+  std::transform(
+    inputs.begin(), inputs.end(), std::back_inserter(template_types), [](auto const& col) {
+      return cudf::jit::get_type_name(col.type());
+    });
+
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::multi_transform_kernel")
+      .instantiate(template_types);
+
+  std::string cuda_source =
+    is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
+                                                  "GENERIC_TRANSFORM_OP",
+                                                  cudf::jit::get_type_name(outputs.front().type()),
+                                                  {0})
+           : cudf::jit::parse_single_function_cuda(udf,  //
+                                                   "GENERIC_TRANSFORM_OP");
+
+  cudf::size_type size = inputs.num_rows();
+
+  std::vector<const void*> data_ptrs;
+  data_ptrs.reserve(outputs.size() + inputs.num_columns());
+  std::transform(outputs.begin(), outputs.end(), std::back_inserter(data_ptrs), [](auto const& out) {
+    return cudf::jit::get_data_ptr(out);
+  });
+  std::transform(inputs.begin(), inputs.end(), std::back_inserter(data_ptrs), [](auto const& col) {
+    return cudf::jit::get_data_ptr(col);
+  });
+
+  std::vector<void*> kernel_args;
+  kernel_args.reserve(data_ptrs.size() + 1);
+  kernel_args.push_back(&size);
+  std::transform(
+    data_ptrs.begin(), data_ptrs.end(), std::back_inserter(kernel_args), [](auto const& ptr) {
+      return const_cast<void*>(static_cast<const void*>(&ptr));
+    });
+
+  cudf::jit::get_program_cache(*transform_jit_multi_transform_kernel_cu_jit)
+    .get_kernel(
+      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
+    ->launch(kernel_args.data());
+}
+
 std::vector<std::string> make_template_types(column_view outcol_view, table_view const& data_view)
 {
   std::string mskptr_type =
@@ -165,6 +225,57 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::vector<std::unique_ptr<column>> transform(table_view const& inputs,
+                                               std::string const& transform_udf,
+                                               std::vector<data_type> const& output_types,
+                                               bool is_ptx,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(inputs.num_columns() > 0, "Transform requires at least one input column");
+  CUDF_EXPECTS(not output_types.empty(), "Transform requires at least one output type");
+  CUDF_EXPECTS(std::all_of(inputs.begin(),
+                           inputs.end(),
+                           [](auto const& col) { return is_fixed_width(col.type()); }),
+               "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(std::all_of(output_types.begin(),
+                           output_types.end(),
+                           [](auto const& type) { return is_fixed_width(type); }),
+               "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(not is_ptx or output_types.size() == 1,
+               "PTX transform UDFs support only a single output column");
+
+  // An output row is null if the corresponding row of any input is null
+  auto const null_mask = cudf::detail::bitmask_and(inputs, stream, mr);
+
+  std::vector<std::unique_ptr<column>> outputs;
+  outputs.reserve(output_types.size());
+  std::transform(output_types.begin(),
+                 output_types.end(),
+                 std::back_inserter(outputs),
+                 [&](auto const& type) {
+                   return make_fixed_width_column(type,
+                                                  inputs.num_rows(),
+                                                  rmm::device_buffer{null_mask.first, stream, mr},
+                                                  null_mask.second,
+                                                  stream,
+                                                  mr);
+                 });
+
+  if (inputs.num_rows() == 0) { return outputs; }
+
+  std::vector<mutable_column_view> output_views;
+  output_views.reserve(outputs.size());
+  std::transform(outputs.begin(),
+                 outputs.end(),
+                 std::back_inserter(output_views),
+                 [](auto const& col) { return col->mutable_view(); });
+
+  transformation::jit::multi_transform_operation(output_views, inputs, transform_udf, is_ptx, stream);
+
+  return outputs;
+}
+
 std::unique_ptr<column> generalized_masked_op(table_view const& data_view,
                                               std::string const& udf,
                                               data_type output_type,
@@ -195,6 +306,17 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, rmm::cuda_stream_default, mr);
 }
 
+std::vector<std::unique_ptr<column>> transform(table_view const& inputs,
+                                               std::string const& transform_udf,
+                                               std::vector<data_type> const& output_types,
+                                               bool is_ptx,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(
+    inputs, transform_udf, output_types, is_ptx, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> generalized_masked_op(table_view const& data_view,
                                               std::string const& udf,
                                               data_type output_type,
@@ -19,12 +19,15 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/detail/iterator.cuh>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <type_traits>
 
@@ -230,6 +233,80 @@ struct DeviceNot {
   }
 };
 
+// chained math ops
+
+/**
+ * @brief Applies a sequence of the math ops above to each element in a single pass.
+ *
+ * Fusing the chain into one transform keeps the column traffic at a single
+ * read and write regardless of how many ops are applied.
+ */
+struct chained_math_fn {
+  device_span<cudf::unary_operator const> ops;
+
+  template <typename T>
+  __device__ T operator()(T data)
+  {
+    for (auto const op : ops) {
+      switch (op) {
+        case cudf::unary_operator::SIN: data = DeviceSin{}(data); break;
+        case cudf::unary_operator::COS: data = DeviceCos{}(data); break;
+        case cudf::unary_operator::TAN: data = DeviceTan{}(data); break;
+        case cudf::unary_operator::ARCSIN: data = DeviceArcSin{}(data); break;
+        case cudf::unary_operator::ARCCOS: data = DeviceArcCos{}(data); break;
+        case cudf::unary_operator::ARCTAN: data = DeviceArcTan{}(data); break;
+        case cudf::unary_operator::SINH: data = DeviceSinH{}(data); break;
+        case cudf::unary_operator::COSH: data = DeviceCosH{}(data); break;
+        case cudf::unary_operator::TANH: data = DeviceTanH{}(data); break;
+        case cudf::unary_operator::ARCSINH: data = DeviceArcSinH{}(data); break;
+        case cudf::unary_operator::ARCCOSH: data = DeviceArcCosH{}(data); break;
+        case cudf::unary_operator::ARCTANH: data = DeviceArcTanH{}(data); break;
+        case cudf::unary_operator::EXP: data = DeviceExp{}(data); break;
+        case cudf::unary_operator::LOG: data = DeviceLog{}(data); break;
+        case cudf::unary_operator::SQRT: data = DeviceSqrt{}(data); break;
+        case cudf::unary_operator::CBRT: data = DeviceCbrt{}(data); break;
+        case cudf::unary_operator::CEIL: data = DeviceCeil{}(data); break;
+        case cudf::unary_operator::FLOOR: data = DeviceFloor{}(data); break;
+        case cudf::unary_operator::ABS: data = DeviceAbs{}(data); break;
+        case cudf::unary_operator::RINT: data = DeviceRInt{}(data); break;
+        default: break;  // non-math ops are rejected before the kernel is launched
+      }
+    }
+    return data;
+  }
+};
+
+struct ChainedMathOpDispatcher {
+  template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
+                                           device_span<cudf::unary_operator const> ops,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+  {
+    auto output = make_fixed_width_column(input.type(),
+                                          input.size(),
+                                          cudf::detail::copy_bitmask(input, stream, mr),
+                                          input.null_count(),
+                                          stream,
+                                          mr);
+    if (input.is_empty()) return output;
+    auto output_view = output->mutable_view();
+    thrust::transform(rmm::exec_policy(stream),
+                      input.begin<T>(),
+                      input.end<T>(),
+                      output_view.begin<T>(),
+                      chained_math_fn{ops});
+    return output;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!std::is_floating_point<T>::value, std::unique_ptr<cudf::column>> operator()(
+    Args&&...)
+  {
+    CUDF_FAIL("unary_chain expects a floating-point column");
+  }
+};
+
 // fixed_point ops
 
 /*
@@ -632,6 +709,32 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   }
 }
 
+std::unique_ptr<cudf::column> unary_chain(cudf::column_view const& input,
+                                          std::vector<cudf::unary_operator> const& ops,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(not ops.empty(), "unary_chain requires at least one operation");
+  CUDF_EXPECTS(std::all_of(ops.begin(),
+                           ops.end(),
+                           [](auto op) {
+                             return op >= cudf::unary_operator::SIN and
+                                    op <= cudf::unary_operator::RINT;
+                           }),
+               "unary_chain only supports math operations");
+
+  auto d_ops = cudf::detail::make_device_uvector_async(ops, stream);
+  // only floating-point instantiations are ever reachable; dispatch over a
+  // list so the chained kernel is not generated for the other ~28 types
+  return list_type_dispatcher<floating_point_dispatch_list>(
+    input.type(),
+    detail::ChainedMathOpDispatcher{},
+    input,
+    device_span<cudf::unary_operator const>{d_ops},
+    stream,
+    mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -642,4 +745,12 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   return detail::unary_operation(input, op, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> unary_chain(cudf::column_view const& input,
+                                          std::vector<cudf::unary_operator> const& ops,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::unary_chain(input, ops, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/batch_arena.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/detail/aligned.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Bump-pointer resource backing a `batch_arena` scope.
+ *
+ * Allocations advance an offset within the most recent block; when a block is
+ * exhausted a larger one is reserved from the upstream resource. Deallocation
+ * is a no-op — every block is returned to the upstream resource at once when
+ * the resource is destroyed.
+ */
+class bump_resource final : public rmm::mr::device_memory_resource {
+ public:
+  bump_resource(std::size_t initial_size,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* upstream)
+    : _next_block_size{initial_size}, _stream{stream}, _upstream{upstream}
+  {
+  }
+
+  std::size_t allocated_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _allocated;
+  }
+
+  std::size_t reserved_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _reserved;
+  }
+
+  bool supports_streams() const noexcept override { return false; }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view) override
+  {
+    if (bytes == 0) { return nullptr; }
+    bytes = rmm::detail::align_up(bytes, rmm::detail::CUDA_ALLOCATION_ALIGNMENT);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_blocks.empty() or _offset + bytes > _blocks.back().size()) {
+      auto const block_size = std::max(bytes, _next_block_size);
+      _blocks.emplace_back(block_size, _stream, _upstream);
+      _next_block_size = block_size * 2;
+      _reserved += block_size;
+      _offset = 0;
+    }
+    auto* ptr = static_cast<uint8_t*>(_blocks.back().data()) + _offset;
+    _offset += bytes;
+    _allocated += bytes;
+    return ptr;
+  }
+
+  void do_deallocate(void*, std::size_t, rmm::cuda_stream_view) override
+  {
+    // individual frees are no-ops; blocks are released wholesale on destruction
+  }
+
+  bool do_is_equal(device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view) const override
+  {
+    return {0, 0};
+  }
+
+  std::size_t _next_block_size;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _upstream;
+  std::vector<rmm::device_buffer> _blocks;
+  std::size_t _offset{0};
+  std::size_t _allocated{0};
+  std::size_t _reserved{0};
+  mutable std::mutex _mutex;
+};
+
+}  // namespace
+
+batch_arena::batch_arena(std::size_t initial_size, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(initial_size > 0, "batch_arena initial size must be nonzero");
+  auto* upstream = rmm::mr::get_current_device_resource();
+  _resource      = std::make_unique<bump_resource>(initial_size, stream, upstream);
+  _previous      = rmm::mr::set_current_device_resource(_resource.get());
+}
+
+batch_arena::~batch_arena() { rmm::mr::set_current_device_resource(_previous); }
+
+std::size_t batch_arena::allocated_bytes() const
+{
+  return static_cast<bump_resource const*>(_resource.get())->allocated_bytes();
+}
+
+std::size_t batch_arena::reserved_bytes() const
+{
+  return static_cast<bump_resource const*>(_resource.get())->reserved_bytes();
+}
+
+}  // namespace cudf
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/cuda_graph.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <utility>
+
+namespace cudf {
+
+cuda_graph::~cuda_graph() { destroy(); }
+
+cuda_graph::cuda_graph(cuda_graph&& other) noexcept
+  : _graph{std::exchange(other._graph, nullptr)}, _exec{std::exchange(other._exec, nullptr)}
+{
+}
+
+cuda_graph& cuda_graph::operator=(cuda_graph&& other) noexcept
+{
+  if (this != &other) {
+    destroy();
+    _graph = std::exchange(other._graph, nullptr);
+    _exec  = std::exchange(other._exec, nullptr);
+  }
+  return *this;
+}
+
+void cuda_graph::begin_capture(rmm::cuda_stream_view stream)
+{
+  CUDA_TRY(cudaStreamBeginCapture(stream.value(), cudaStreamCaptureModeThreadLocal));
+}
+
+void cuda_graph::end_capture(rmm::cuda_stream_view stream)
+{
+  destroy();
+  CUDA_TRY(cudaStreamEndCapture(stream.value(), &_graph));
+  CUDA_TRY(cudaGraphInstantiate(&_exec, _graph, nullptr, nullptr, 0));
+}
+
+void cuda_graph::launch(rmm::cuda_stream_view stream) const
+{
+  CUDF_EXPECTS(is_instantiated(), "no captured graph to launch");
+  CUDA_TRY(cudaGraphLaunch(_exec, stream.value()));
+}
+
+bool cuda_graph::is_capturing(rmm::cuda_stream_view stream)
+{
+  cudaStreamCaptureStatus status{cudaStreamCaptureStatusNone};
+  CUDA_TRY(cudaStreamIsCapturing(stream.value(), &status));
+  return status == cudaStreamCaptureStatusActive;
+}
+
+void cuda_graph::destroy() noexcept
+{
+  // destruction must not throw; a failed destroy leaks the graph but the
+  // error will resurface on the next CUDA call
+  if (_exec != nullptr) {
+    cudaGraphExecDestroy(_exec);
+    _exec = nullptr;
+  }
+  if (_graph != nullptr) {
+    cudaGraphDestroy(_graph);
+    _graph = nullptr;
+  }
+}
+
+}  // namespace cudf
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/launch_config.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace cudf {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Directory holding the per-device launch config profile.
+ *
+ * Follows the same conventions as the JIT kernel cache: the
+ * `LIBCUDF_KERNEL_CACHE_PATH` environment variable overrides the default of
+ * `$HOME/.cudf/$CUDF_VERSION`, and profiles are separated by compute
+ * capability so devices of different SKUs do not share tuning results.
+ * Returns an empty path when no usable directory exists, in which case
+ * profiles live only in process memory.
+ */
+std::filesystem::path get_profile_dir()
+{
+  auto const path_env = std::getenv("LIBCUDF_KERNEL_CACHE_PATH");
+  auto profile_dir    = [&]() -> std::filesystem::path {
+    if (path_env != nullptr) { return std::filesystem::path(path_env); }
+    auto const home_dir = std::getenv("HOME");
+    if (home_dir != nullptr) { return std::filesystem::path(home_dir) / ".cudf"; }
+    return std::filesystem::path();
+  }();
+
+  if (profile_dir.empty()) { return profile_dir; }
+
+  profile_dir /= std::string{CUDF_STRINGIFY(CUDF_VERSION)};
+
+  int device;
+  int cc_major;
+  int cc_minor;
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
+  CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
+  profile_dir /= std::to_string(cc_major * 10 + cc_minor);
+
+  try {
+    std::filesystem::create_directories(profile_dir);
+  } catch (std::exception const&) {
+    return std::filesystem::path();
+  }
+  return profile_dir;
+}
+
+std::filesystem::path get_profile_path()
+{
+  auto const dir = get_profile_dir();
+  return dir.empty() ? dir : dir / "launch_configs";
+}
+
+/**
+ * @brief Loads the persisted profile into an in-process registry.
+ *
+ * The profile is a text file of `kernel_name block_size items_per_thread`
+ * lines; unparsable lines are skipped so a corrupt or truncated profile
+ * degrades to the built-in fallbacks rather than failing.
+ */
+std::unordered_map<std::string, launch_config> load_profile()
+{
+  std::unordered_map<std::string, launch_config> configs;
+
+  auto const path = get_profile_path();
+  if (path.empty()) { return configs; }
+
+  std::ifstream profile(path);
+  std::string line;
+  while (std::getline(profile, line)) {
+    std::istringstream parser(line);
+    std::string kernel_name;
+    launch_config config{};
+    if (parser >> kernel_name >> config.block_size >> config.items_per_thread) {
+      configs[kernel_name] = config;
+    }
+  }
+  return configs;
+}
+
+void persist_config(std::string const& kernel_name, launch_config config)
+{
+  auto const path = get_profile_path();
+  if (path.empty()) { return; }
+
+  // Failure to persist only costs a re-tune in the next process
+  std::ofstream profile(path, std::ios::app);
+  profile << kernel_name << ' ' << config.block_size << ' ' << config.items_per_thread << '\n';
+}
+
+std::mutex& registry_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+// Guarded by `registry_mutex()`
+std::unordered_map<std::string, launch_config>& registry()
+{
+  static auto* configs = new std::unordered_map<std::string, launch_config>{load_profile()};
+  return *configs;
+}
+
+}  // namespace
+
+launch_config get_launch_config(std::string const& kernel_name, launch_config fallback)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  auto const found = registry().find(kernel_name);
+  return found != registry().end() ? found->second : fallback;
+}
+
+launch_config tune_launch_config(std::string const& kernel_name,
+                                 std::vector<launch_config> const& candidates,
+                                 std::function<void(launch_config const&)> const& launch,
+                                 rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not candidates.empty(), "No launch config candidates to tune over");
+
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto const found = registry().find(kernel_name);
+    if (found != registry().end()) { return found->second; }
+  }
+
+  cudaEvent_t start;
+  cudaEvent_t stop;
+  CUDA_TRY(cudaEventCreate(&start));
+  CUDA_TRY(cudaEventCreate(&stop));
+
+  constexpr int timed_iterations = 3;
+
+  auto best         = candidates.front();
+  auto best_elapsed = std::numeric_limits<float>::max();
+  for (auto const& candidate : candidates) {
+    launch(candidate);  // warm up
+    CUDA_TRY(cudaEventRecord(start, stream.value()));
+    for (int i = 0; i < timed_iterations; ++i) {
+      launch(candidate);
+    }
+    CUDA_TRY(cudaEventRecord(stop, stream.value()));
+    CUDA_TRY(cudaEventSynchronize(stop));
+    float elapsed;
+    CUDA_TRY(cudaEventElapsedTime(&elapsed, start, stop));
+    if (elapsed < best_elapsed) {
+      best_elapsed = elapsed;
+      best         = candidate;
+    }
+  }
+
+  CUDA_TRY(cudaEventDestroy(start));
+  CUDA_TRY(cudaEventDestroy(stop));
+
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  // Another thread may have tuned the same kernel concurrently; keep its result
+  auto const [it, inserted] = registry().emplace(kernel_name, best);
+  if (inserted) { persist_config(kernel_name, best); }
+  return it->second;
+}
+
+}  // namespace detail
+}  // namespace cudf
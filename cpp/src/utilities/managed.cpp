@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/managed.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/managed.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/managed_memory_resource.hpp>
+
+#include <cuda_runtime_api.h>
+
+namespace cudf {
+
+rmm::mr::device_memory_resource* managed_memory_resource()
+{
+  static rmm::mr::managed_memory_resource mr{};
+  return &mr;
+}
+
+namespace detail {
+
+namespace {
+
+bool is_managed(void const* ptr)
+{
+  if (ptr == nullptr) { return false; }
+  cudaPointerAttributes attributes{};
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    cudaGetLastError();  // pointers unknown to the runtime are simply not managed
+    return false;
+  }
+  return attributes.type == cudaMemoryTypeManaged;
+}
+
+void prefetch_range(void const* ptr, std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  if (bytes == 0 || !is_managed(ptr)) { return; }
+  int device_id{};
+  CUDA_TRY(cudaGetDevice(&device_id));
+  CUDA_TRY(cudaMemPrefetchAsync(ptr, bytes, device_id, stream.value()));
+}
+
+}  // namespace
+
+void prefetch(column_view const& input, rmm::cuda_stream_view stream)
+{
+  if (input.size() == 0) { return; }
+  // head() is the start of the allocation, so sliced views fetch from the
+  // buffer start through their last row
+  if (input.head() != nullptr && is_fixed_width(input.type())) {
+    auto const bytes = std::size_t{size_of(input.type())} * (input.offset() + input.size());
+    prefetch_range(input.head(), bytes, stream);
+  }
+  if (input.nullable()) {
+    prefetch_range(
+      input.null_mask(), bitmask_allocation_size_bytes(input.offset() + input.size()), stream);
+  }
+  for (size_type i = 0; i < input.num_children(); ++i) {
+    prefetch(input.child(i), stream);
+  }
+}
+
+void prefetch(table_view const& input, rmm::cuda_stream_view stream)
+{
+  for (auto const& col : input) {
+    prefetch(col, stream);
+  }
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> make_managed_column(column_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return std::make_unique<column>(input, rmm::cuda_stream_default, managed_memory_resource());
+}
+
+std::unique_ptr<table> make_managed_table(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return std::make_unique<table>(input, rmm::cuda_stream_default, managed_memory_resource());
+}
+
+void prefetch(column_view const& input) { detail::prefetch(input, rmm::cuda_stream_default); }
+
+void prefetch(table_view const& input) { detail::prefetch(input, rmm::cuda_stream_default); }
+
+}  // namespace cudf
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/profiling.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace profiling {
+
+namespace {
+
+// Innermost-first stack of the profiling scopes active on this thread; the top
+// entry is the operator device allocations are attributed to.
+thread_local std::vector<char const*> t_scope_stack;
+
+char const* current_scope_name()
+{
+  return t_scope_stack.empty() ? "" : t_scope_stack.back();
+}
+
+void record_allocation_event(void const* ptr, std::size_t bytes, bool is_allocation);
+
+/**
+ * @brief Memory resource adaptor that counts bytes and attributes every
+ * allocation to the profiling scope active on the allocating thread.
+ */
+class attribution_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  explicit attribution_adaptor(rmm::mr::device_memory_resource* upstream) : _upstream{upstream} {}
+
+  rmm::mr::device_memory_resource* get_upstream() const noexcept { return _upstream; }
+
+  struct counter {
+    std::int64_t value{0};
+    std::int64_t peak{0};
+  };
+
+  counter get_bytes_counter() const
+  {
+    std::lock_guard<std::mutex> guard{_mutex};
+    return _bytes;
+  }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    auto* ptr = _upstream->allocate(bytes, stream);
+    {
+      std::lock_guard<std::mutex> guard{_mutex};
+      _bytes.value += bytes;
+      _bytes.peak = std::max(_bytes.peak, _bytes.value);
+    }
+    record_allocation_event(ptr, bytes, true);
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    _upstream->deallocate(ptr, bytes, stream);
+    {
+      std::lock_guard<std::mutex> guard{_mutex};
+      _bytes.value -= bytes;
+    }
+    record_allocation_event(ptr, bytes, false);
+  }
+
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* _upstream;
+  mutable std::mutex _mutex;
+  counter _bytes;
+};
+
+/**
+ * @brief Metrics of a single completed call whose device work may still be in
+ * flight; the events are resolved lazily by `report()`.
+ */
+struct call_record {
+  char const* name;
+  std::chrono::nanoseconds wall_time;
+  std::size_t data_volume;
+  std::size_t peak_memory;
+  cudaEvent_t start_event;
+  cudaEvent_t stop_event;
+};
+
+/**
+ * @brief A live allocation awaiting its deallocation.
+ */
+struct allocation_record {
+  std::string name;
+  std::size_t bytes;
+  std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * @brief Per-name memory aggregate; `current_bytes` tracks the bytes this
+ * operator's allocations hold right now so its individual peak can be derived.
+ */
+struct memory_aggregate {
+  memory_summary summary;
+  std::int64_t current_bytes{0};
+};
+
+struct profiler_state {
+  std::atomic<bool> enabled{false};
+  std::mutex lock;
+  std::vector<call_record> pending;
+  std::unordered_map<std::string, operator_summary> aggregates;
+  std::unordered_map<std::string, memory_aggregate> memory_aggregates;
+  std::unordered_map<void const*, allocation_record> outstanding;
+  allocation_callback callback;
+  // Adaptors are never destroyed once installed: buffers allocated while
+  // profiling was enabled deallocate through the adaptor that served them,
+  // which may be after profiling is disabled again.
+  std::vector<std::unique_ptr<attribution_adaptor>> adaptors;
+  rmm::mr::device_memory_resource* upstream = nullptr;
+};
+
+profiler_state& state()
+{
+  static profiler_state s;
+  return s;
+}
+
+attribution_adaptor* active_adaptor()
+{
+  auto& s = state();
+  return s.adaptors.empty() ? nullptr : s.adaptors.back().get();
+}
+
+void record_allocation_event(void const* ptr, std::size_t bytes, bool is_allocation)
+{
+  auto& s = state();
+
+  // The event name passed to the callback: the allocating scope for an
+  // allocation, the scope the buffer was attributed to for a deallocation.
+  std::string event_name{current_scope_name()};
+  allocation_callback callback_copy;
+  {
+    std::lock_guard<std::mutex> guard{s.lock};
+
+    if (is_allocation) {
+      auto& aggregate = s.memory_aggregates[event_name];
+      if (aggregate.summary.num_allocations == 0) { aggregate.summary.name = event_name; }
+      aggregate.summary.num_allocations += 1;
+      aggregate.summary.allocated_bytes += bytes;
+      aggregate.current_bytes += bytes;
+      aggregate.summary.peak_bytes = std::max(aggregate.summary.peak_bytes,
+                                              static_cast<std::size_t>(aggregate.current_bytes));
+      s.outstanding[ptr] = allocation_record{event_name, bytes, std::chrono::steady_clock::now()};
+    } else if (auto it = s.outstanding.find(ptr); it != s.outstanding.end()) {
+      event_name      = it->second.name;
+      auto& aggregate = s.memory_aggregates[event_name];
+      aggregate.current_bytes -= it->second.bytes;
+      aggregate.summary.total_lifetime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - it->second.start);
+      s.outstanding.erase(it);
+    }
+
+    callback_copy = s.callback;
+  }
+
+  // Invoked outside the lock so a callback may call report()/memory_report().
+  if (callback_copy) {
+    callback_copy(allocation_event{event_name.c_str(), ptr, bytes, is_allocation});
+  }
+}
+
+/**
+ * @brief Folds all pending call records into the aggregates, synchronizing on
+ * their stop events. Requires `state().lock` to be held.
+ */
+void resolve_pending(profiler_state& s)
+{
+  for (auto& record : s.pending) {
+    float elapsed_ms{0};
+    CUDA_TRY(cudaEventSynchronize(record.stop_event));
+    CUDA_TRY(cudaEventElapsedTime(&elapsed_ms, record.start_event, record.stop_event));
+    CUDA_TRY(cudaEventDestroy(record.start_event));
+    CUDA_TRY(cudaEventDestroy(record.stop_event));
+
+    auto& summary = s.aggregates[record.name];
+    if (summary.num_calls == 0) { summary.name = record.name; }
+    summary.num_calls += 1;
+    summary.wall_time += record.wall_time;
+    summary.kernel_time +=
+      std::chrono::nanoseconds{static_cast<std::int64_t>(elapsed_ms * 1.0e6)};
+    summary.data_volume += record.data_volume;
+    summary.peak_memory = std::max(summary.peak_memory, record.peak_memory);
+  }
+  s.pending.clear();
+}
+
+}  // namespace
+
+struct scope::impl {
+  char const* name;
+  std::size_t data_volume;
+  std::chrono::steady_clock::time_point start_time;
+  std::int64_t start_bytes{0};
+  std::int64_t start_peak{0};
+  cudaEvent_t start_event{};
+  cudaEvent_t stop_event{};
+};
+
+scope::scope(char const* name, std::size_t data_volume)
+{
+  if (not is_enabled()) { return; }
+
+  _impl              = std::make_unique<impl>();
+  _impl->name        = name;
+  _impl->data_volume = data_volume;
+  if (auto* adaptor = active_adaptor()) {
+    auto const counter = adaptor->get_bytes_counter();
+    _impl->start_bytes = counter.value;
+    _impl->start_peak  = counter.peak;
+  }
+  t_scope_stack.push_back(name);
+  CUDA_TRY(cudaEventCreate(&_impl->start_event));
+  CUDA_TRY(cudaEventCreate(&_impl->stop_event));
+  CUDA_TRY(cudaEventRecord(_impl->start_event, rmm::cuda_stream_default.value()));
+  _impl->start_time = std::chrono::steady_clock::now();
+}
+
+scope::~scope()
+{
+  if (not _impl) { return; }
+
+  t_scope_stack.pop_back();
+
+  auto const wall_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - _impl->start_time);
+
+  // If this call raised the process-wide allocation high-water mark, it owns
+  // the peak; otherwise report the memory held when the call began as a lower
+  // bound.
+  auto peak_memory = static_cast<std::size_t>(_impl->start_bytes);
+  if (auto* adaptor = active_adaptor()) {
+    auto const counter = adaptor->get_bytes_counter();
+    if (counter.peak > _impl->start_peak) { peak_memory = static_cast<std::size_t>(counter.peak); }
+  }
+
+  // Destructor must not throw; a failed event record yields a zero kernel time
+  // for this call when resolved.
+  cudaEventRecord(_impl->stop_event, rmm::cuda_stream_default.value());
+
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  s.pending.push_back(call_record{_impl->name,
+                                  wall_time,
+                                  _impl->data_volume,
+                                  peak_memory,
+                                  _impl->start_event,
+                                  _impl->stop_event});
+}
+
+bool is_enabled() { return state().enabled.load(std::memory_order_relaxed); }
+
+void set_allocation_callback(allocation_callback callback)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  s.callback = std::move(callback);
+}
+
+void enable()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  if (s.enabled.load()) { return; }
+
+  auto* current = rmm::mr::get_current_device_resource();
+  if (auto* adaptor = active_adaptor(); adaptor != nullptr and adaptor == current) {
+    // our adaptor is still installed from a previous session
+  } else if (auto* adaptor = active_adaptor();
+             adaptor != nullptr and adaptor->get_upstream() == current) {
+    rmm::mr::set_current_device_resource(adaptor);
+  } else {
+    s.adaptors.push_back(std::make_unique<attribution_adaptor>(current));
+    s.upstream = current;
+    rmm::mr::set_current_device_resource(s.adaptors.back().get());
+  }
+  s.enabled.store(true);
+}
+
+void disable()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  if (not s.enabled.load()) { return; }
+  s.enabled.store(false);
+
+  if (s.upstream != nullptr and rmm::mr::get_current_device_resource() == active_adaptor()) {
+    rmm::mr::set_current_device_resource(s.upstream);
+  }
+}
+
+void reset()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  for (auto& record : s.pending) {
+    cudaEventDestroy(record.start_event);
+    cudaEventDestroy(record.stop_event);
+  }
+  s.pending.clear();
+  s.aggregates.clear();
+  // Outstanding allocations are kept so the lifetimes of still-live buffers can
+  // be attributed when they are eventually freed.
+  s.memory_aggregates.clear();
+}
+
+std::vector<operator_summary> report()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+  resolve_pending(s);
+
+  std::vector<operator_summary> result;
+  result.reserve(s.aggregates.size());
+  for (auto const& entry : s.aggregates) {
+    result.push_back(entry.second);
+  }
+  std::sort(result.begin(), result.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.wall_time > rhs.wall_time;
+  });
+  return result;
+}
+
+std::vector<memory_summary> memory_report()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> guard{s.lock};
+
+  std::vector<memory_summary> result;
+  result.reserve(s.memory_aggregates.size());
+  for (auto const& entry : s.memory_aggregates) {
+    result.push_back(entry.second.summary);
+  }
+  std::sort(result.begin(), result.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.allocated_bytes > rhs.allocated_bytes;
+  });
+  return result;
+}
+
+}  // namespace profiling
+}  // namespace cudf
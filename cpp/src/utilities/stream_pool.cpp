@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/stream_pool.hpp>
+
+namespace cudf {
+
+stream_pool::stream_pool(std::size_t pool_size) : _streams(pool_size)
+{
+  CUDF_EXPECTS(pool_size > 0, "stream_pool size must be greater than zero");
+}
+
+rmm::cuda_stream_view stream_pool::get_stream()
+{
+  return _streams[_next.fetch_add(1, std::memory_order_relaxed) % _streams.size()].view();
+}
+
+void stream_pool::synchronize()
+{
+  for (auto& stream : _streams) {
+    stream.synchronize();
+  }
+}
+
+}  // namespace cudf
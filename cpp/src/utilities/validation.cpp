@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/validation.hpp>
+
+namespace cudf {
+namespace {
+
+thread_local validation_level current_level = validation_level::FULL;
+
+}  // namespace
+
+validation_level get_validation_level() { return current_level; }
+
+void set_validation_level(validation_level level) { current_level = level; }
+
+bool full_validation_enabled() { return current_level == validation_level::FULL; }
+
+}  // namespace cudf
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/zone_map.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Maps a row index to its chunk index.
+ */
+struct chunk_index_fn {
+  size_type chunk_rows;
+  __device__ size_type operator()(size_type idx) const { return idx / chunk_rows; }
+};
+
+/**
+ * @brief Computes per-chunk minimums and maximums with a keyed reduction.
+ *
+ * Null rows contribute the reduction identities so a chunk of all nulls ends
+ * up with an inverted (empty) range that no predicate interval intersects.
+ */
+struct zone_minmax_dispatch {
+  template <typename T,
+            typename std::enable_if_t<cudf::is_relationally_comparable<T, T>() and
+                                      cudf::is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  mutable_column_view minimums,
+                  mutable_column_view maximums,
+                  size_type chunk_rows,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const keys = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                      chunk_index_fn{chunk_rows});
+    if (input.has_nulls()) {
+      auto d_input  = column_device_view::create(input, stream);
+      auto min_itr  = cudf::detail::make_null_replacement_iterator(
+        *d_input, cudf::DeviceMin::identity<T>());
+      auto max_itr = cudf::detail::make_null_replacement_iterator(
+        *d_input, cudf::DeviceMax::identity<T>());
+      thrust::reduce_by_key(rmm::exec_policy(stream),
+                            keys,
+                            keys + input.size(),
+                            min_itr,
+                            thrust::make_discard_iterator(),
+                            minimums.begin<T>(),
+                            thrust::equal_to<size_type>{},
+                            cudf::DeviceMin{});
+      thrust::reduce_by_key(rmm::exec_policy(stream),
+                            keys,
+                            keys + input.size(),
+                            max_itr,
+                            thrust::make_discard_iterator(),
+                            maximums.begin<T>(),
+                            thrust::equal_to<size_type>{},
+                            cudf::DeviceMax{});
+    } else {
+      thrust::reduce_by_key(rmm::exec_policy(stream),
+                            keys,
+                            keys + input.size(),
+                            input.begin<T>(),
+                            thrust::make_discard_iterator(),
+                            minimums.begin<T>(),
+                            thrust::equal_to<size_type>{},
+                            cudf::DeviceMin{});
+      thrust::reduce_by_key(rmm::exec_policy(stream),
+                            keys,
+                            keys + input.size(),
+                            input.begin<T>(),
+                            thrust::make_discard_iterator(),
+                            maximums.begin<T>(),
+                            thrust::equal_to<size_type>{},
+                            cudf::DeviceMax{});
+    }
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!(cudf::is_relationally_comparable<T, T>() and cudf::is_fixed_width<T>()), void>
+  operator()(Args&&...)
+  {
+    CUDF_FAIL("zone_map only supports fixed-width relationally comparable columns");
+  }
+};
+
+}  // namespace
+
+zone_map::zone_map(column_view const& input,
+                   size_type chunk_rows,
+                   rmm::mr::device_memory_resource* mr)
+  : _num_rows(input.size()), _chunk_rows(chunk_rows)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(chunk_rows > 0, "chunk_rows must be positive");
+
+  auto const stream     = rmm::cuda_stream_default;
+  auto const num_chunks = input.is_empty() ? 0 : (input.size() + chunk_rows - 1) / chunk_rows;
+
+  _minimums =
+    make_fixed_width_column(input.type(), num_chunks, mask_state::UNALLOCATED, stream, mr);
+  _maximums =
+    make_fixed_width_column(input.type(), num_chunks, mask_state::UNALLOCATED, stream, mr);
+  if (num_chunks == 0) {
+    // still reject unsupported types for consistency with non-empty input
+    CUDF_EXPECTS(is_fixed_width(input.type()),
+                 "zone_map only supports fixed-width relationally comparable columns");
+    return;
+  }
+
+  type_dispatcher(input.type(),
+                  zone_minmax_dispatch{},
+                  input,
+                  _minimums->mutable_view(),
+                  _maximums->mutable_view(),
+                  chunk_rows,
+                  stream);
+
+  if (input.has_nulls()) {
+    std::vector<size_type> indices;
+    indices.reserve(num_chunks * 2);
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+      indices.push_back(input.offset() + chunk * chunk_rows);
+      indices.push_back(input.offset() + std::min((chunk + 1) * chunk_rows, input.size()));
+    }
+    _null_counts = cudf::detail::segmented_count_unset_bits(input.null_mask(), indices, stream);
+  } else {
+    _null_counts.assign(num_chunks, 0);
+  }
+}
+
+std::vector<size_type> zone_map::matching_chunks(scalar const& lo, scalar const& hi) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(lo.type() == _minimums->type() and hi.type() == _minimums->type(),
+               "predicate bounds must match the indexed column type");
+
+  auto const stream = rmm::cuda_stream_default;
+  if (num_chunks() == 0) { return {}; }
+
+  // a chunk may match when its recorded range intersects [lo, hi]; all-null
+  // chunks hold an inverted range and are never selected
+  auto const bool_type = data_type{type_id::BOOL8};
+  auto const reaches_lo = cudf::detail::binary_operation(
+    _maximums->view(), lo, binary_operator::GREATER_EQUAL, bool_type, stream);
+  auto const reaches_hi = cudf::detail::binary_operation(
+    _minimums->view(), hi, binary_operator::LESS_EQUAL, bool_type, stream);
+  auto const intersects = cudf::detail::binary_operation(
+    reaches_lo->view(), reaches_hi->view(), binary_operator::LOGICAL_AND, bool_type, stream);
+
+  auto const d_flags = device_span<bool const>{intersects->view().data<bool>(),
+                                               static_cast<std::size_t>(num_chunks())};
+  auto const h_flags = cudf::detail::make_std_vector_sync(d_flags, stream);
+
+  std::vector<size_type> result;
+  for (size_type chunk = 0; chunk < num_chunks(); ++chunk) {
+    if (h_flags[chunk]) { result.push_back(chunk); }
+  }
+  return result;
+}
+
+}  // namespace cudf
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/expression_builder.hpp>
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
@@ -193,6 +194,71 @@ TEST_F(TransformTest, LessComparatorLarge)
   cudf::test::expect_columns_equal(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, ExpressionBuilder)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto c_2   = column_wrapper<int32_t>{-3, 66, 2, -99};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  // a * b + c evaluated in one pass; the builder owns all intermediate nodes
+  auto builder       = cudf::ast::expression_builder(table);
+  auto const& a      = builder.column(0);
+  auto const& b      = builder.column(1);
+  auto const& c      = builder.column(2);
+  auto const& result = builder.add(builder.mul(a, b), c);
+
+  auto expected = column_wrapper<int32_t>{27, 206, 22, -49};
+  auto output   = builder.materialize(result);
+
+  cudf::test::expect_columns_equal(expected, output->view(), verbosity);
+}
+
+TEST_F(TransformTest, ExpressionBuilderComparison)
+{
+  auto c_0   = column_wrapper<double>{3.0, 20.0, 1.0, 50.0};
+  auto c_1   = column_wrapper<double>{10.0, 7.0, 20.0, 0.0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto builder = cudf::ast::expression_builder(table);
+  auto const& cmp =
+    builder.make_operation(cudf::ast::ast_operator::GREATER_EQUAL,
+                           builder.div(builder.column(0), builder.column(1)),
+                           builder.column(1));
+
+  auto expected = column_wrapper<bool>{false, false, false, true};
+  auto output   = builder.materialize(cmp);
+
+  cudf::test::expect_columns_equal(expected, output->view(), verbosity);
+
+  EXPECT_THROW(builder.column(7), cudf::logic_error);
+}
+
+TEST_F(TransformTest, ChainedArithmeticComparison)
+{
+  // a * b + c > d over non-nullable numeric columns exercises the
+  // JIT-compiled expression path
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto c_2   = column_wrapper<int32_t>{-3, 66, 2, -99};
+  auto c_3   = column_wrapper<int32_t>{40, 300, 20, -100};
+  auto table = cudf::table_view{{c_0, c_1, c_2, c_3}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+  auto col_ref_3 = cudf::ast::column_reference(3);
+
+  auto product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto sum        = cudf::ast::operation(cudf::ast::ast_operator::ADD, product, col_ref_2);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::GREATER, sum, col_ref_3);
+
+  auto expected = column_wrapper<bool>{false, false, true, true};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
 TEST_F(TransformTest, MultiLevelTreeArithmetic)
 {
   auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
@@ -618,6 +684,84 @@ TEST_F(TransformTest, NullLogicalAnd)
   cudf::test::expect_columns_equal(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, StringEqualityComparison)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"a", "bb", "ccc", "dd"});
+  auto c_1   = cudf::test::strings_column_wrapper({"a", "bbb", "ccc", "d"});
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, col_ref_1);
+
+  auto expected = column_wrapper<bool>{true, false, true, false};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringContains)
+{
+  auto c_0 = cudf::test::strings_column_wrapper({"banana", "apple", "", "grape fruit"},
+                                                {true, true, true, true});
+  auto c_1 =
+    cudf::test::strings_column_wrapper({"ban", "les", "", "fruit"}, {true, false, true, true});
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_0, col_ref_1);
+
+  auto expected = column_wrapper<bool>{{true, false, true, true}, {1, 0, 1, 1}};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringStartsEndsWith)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"banana", "apple", "", "grape fruit"});
+  auto c_1   = cudf::test::strings_column_wrapper({"ban", "les", "", "fruit"});
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  auto starts_with =
+    cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, col_ref_0, col_ref_1);
+  auto expected_starts = column_wrapper<bool>{true, false, true, false};
+  auto result_starts   = cudf::compute_column(table, starts_with);
+  cudf::test::expect_columns_equal(expected_starts, result_starts->view(), verbosity);
+
+  auto ends_with = cudf::ast::operation(cudf::ast::ast_operator::ENDS_WITH, col_ref_0, col_ref_1);
+  auto expected_ends = column_wrapper<bool>{false, false, true, true};
+  auto result_ends   = cudf::compute_column(table, ends_with);
+  cudf::test::expect_columns_equal(expected_ends, result_ends->view(), verbosity);
+}
+
+TEST_F(TransformTest, MixedStringAndNumericPredicate)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"banana", "apple", "grape", "apple"});
+  auto c_1   = cudf::test::strings_column_wrapper({"ana", "app", "app", "xyz"});
+  auto c_2   = column_wrapper<int32_t>{10, 99, 7, 3};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0    = cudf::ast::column_reference(0);
+  auto col_ref_1    = cudf::ast::column_reference(1);
+  auto col_ref_2    = cudf::ast::column_reference(2);
+  auto literal_value = cudf::numeric_scalar<int32_t>(50);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto contains = cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_0, col_ref_1);
+  auto less     = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_2, literal);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, contains, less);
+
+  auto expected = column_wrapper<bool>{true, false, false, false};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
 TEST_F(TransformTest, NullLogicalOr)
 {
   auto c_0   = column_wrapper<bool>{{false, false, true, true, false, false, true, true},
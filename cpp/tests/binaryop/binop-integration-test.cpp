@@ -2673,6 +2673,58 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointBinaryOpThrows)
                cudf::logic_error);
 }
 
+TEST_F(BinaryOperationIntegrationTest, FixedPointBinaryOpDecimal128)
+{
+  using namespace numeric;
+
+  auto const lhs = fp_wrapper<__int128_t>{{11, 22, 33, 44}, scale_type{-1}};
+  auto const rhs = fp_wrapper<__int128_t>{{100, 200, 300, 400}, scale_type{-2}};
+
+  auto const expected_add = fp_wrapper<__int128_t>{{210, 420, 630, 840}, scale_type{-2}};
+  auto const expected_mul = fp_wrapper<__int128_t>{{1100, 4400, 9900, 17600}, scale_type{-3}};
+
+  auto const add_type =
+    cudf::binary_operation_fixed_point_output_type(cudf::binary_operator::ADD,
+                                                   static_cast<cudf::column_view>(lhs).type(),
+                                                   static_cast<cudf::column_view>(rhs).type());
+  auto const mul_type =
+    cudf::binary_operation_fixed_point_output_type(cudf::binary_operator::MUL,
+                                                   static_cast<cudf::column_view>(lhs).type(),
+                                                   static_cast<cudf::column_view>(rhs).type());
+
+  auto const result_add =
+    cudf::jit::binary_operation(lhs, rhs, cudf::binary_operator::ADD, add_type);
+  auto const result_mul =
+    cudf::jit::binary_operation(lhs, rhs, cudf::binary_operator::MUL, mul_type);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_add, result_add->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_mul, result_mul->view());
+}
+
+TEST_F(BinaryOperationIntegrationTest, PreloadBinaryOperation)
+{
+  using TypeOut = int32_t;
+  using TypeLhs = int32_t;
+  using TypeRhs = int32_t;
+
+  using ADD = cudf::library::operation::Add<TypeOut, TypeLhs, TypeRhs>;
+
+  auto warmup = cudf::jit::preload_binary_operation(
+    data_type(type_to_id<TypeOut>()),
+    data_type(type_to_id<TypeLhs>()),
+    data_type(type_to_id<TypeRhs>()),
+    {cudf::binary_operator::ADD, cudf::binary_operator::MUL});
+  warmup.wait();
+
+  // the warmed kernels must produce the same results as a cold cache
+  auto lhs = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs = make_random_wrapped_column<TypeRhs>(100);
+  auto out = cudf::jit::binary_operation(
+    lhs, rhs, cudf::binary_operator::ADD, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ADD());
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
@@ -595,4 +596,78 @@ TEST_F(MergeBitmaskTest, TestBitmaskOr)
   EXPECT_EQ(nullptr, result3_mask.data());
 }
 
+struct BatchedNullCountTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(BatchedNullCountTest, TableNullCounts)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const col1({1, 2, 3, 4, 5}, {0, 1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> const col2({1, 2, 3, 4, 5});
+  cudf::test::fixed_width_column_wrapper<bool> const col3({0, 1, 0, 1, 1}, {1, 1, 1, 1, 0});
+
+  auto const counts = cudf::detail::null_counts(cudf::table_view({col1, col2, col3}));
+
+  EXPECT_EQ(counts, (std::vector<cudf::size_type>{2, 0, 1}));
+}
+
+TEST_F(BatchedNullCountTest, OffsetColumns)
+{
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> const col(data, data + 100, validity);
+
+  auto const pieces = cudf::slice(col, {5, 77, 64, 100});
+  auto const counts = cudf::detail::null_counts(cudf::table_view({pieces[0], pieces[1]}));
+
+  EXPECT_EQ(counts,
+            (std::vector<cudf::size_type>{pieces[0].null_count(), pieces[1].null_count()}));
+}
+
+TEST_F(BatchedNullCountTest, EmptyTable)
+{
+  EXPECT_TRUE(cudf::detail::null_counts(cudf::table_view{}).empty());
+}
+
+TEST_F(MergeBitmaskTest, TestBitmaskExprFold)
+{
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col1({0, 1, 0, 1, 1}, {0, 1, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col2({0, 2, 1, 0, 255}, {1, 1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col3({0, 2, 1, 0, 255}, {1, 0, 0, 0, 1});
+
+  std::vector<cudf::column_view> const cols{bools_col1, bools_col2, bools_col3};
+  std::vector<cudf::bitmask_type const*> masks;
+  std::vector<cudf::size_type> begin_bits;
+  for (auto const& col : cols) {
+    masks.push_back(col.null_mask());
+    begin_bits.push_back(col.offset());
+  }
+  auto const num_rows = cols.front().size();
+
+  using cudf::detail::bitmask_expr_op;
+  // (mask0 & mask1) | mask2, in postfix order
+  std::vector<cudf::detail::bitmask_expr_node> const expr{{bitmask_expr_op::MASK, 0},
+                                                          {bitmask_expr_op::MASK, 1},
+                                                          {bitmask_expr_op::BIT_AND, 0},
+                                                          {bitmask_expr_op::MASK, 2},
+                                                          {bitmask_expr_op::BIT_OR, 0}};
+
+  auto [result_mask, result_null_count] =
+    cudf::detail::bitmask_expr_fold(expr, masks, begin_bits, num_rows);
+
+  EXPECT_EQ(result_null_count, 1);
+
+  auto all_but_index2 =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  auto gold = cudf::test::detail::make_null_mask(all_but_index2, all_but_index2 + num_rows);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+    result_mask.data(), gold.data(), cudf::num_bitmask_words(num_rows));
+
+  // an expression that underflows its operand stack is rejected
+  std::vector<cudf::detail::bitmask_expr_node> const malformed{{bitmask_expr_op::MASK, 0},
+                                                               {bitmask_expr_op::BIT_AND, 0}};
+  EXPECT_THROW(cudf::detail::bitmask_expr_fold(malformed, masks, begin_bits, num_rows),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/broadcast_column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <memory>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+
+namespace {
+
+cudf::broadcast_column make_broadcast(int32_t value, cudf::size_type size)
+{
+  return cudf::broadcast_column{std::make_unique<cudf::numeric_scalar<int32_t>>(value), size};
+}
+
+}  // namespace
+
+struct BroadcastColumnTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(BroadcastColumnTest, MaterializeMatchesScalar)
+{
+  auto const bcast = make_broadcast(7, 4);
+  EXPECT_EQ(bcast.size(), 4);
+  EXPECT_EQ(bcast.type(), cudf::data_type{cudf::type_id::INT32});
+
+  fixed_width_column_wrapper<int32_t> expected{7, 7, 7, 7};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, bcast.materialize()->view());
+}
+
+TEST_F(BroadcastColumnTest, InvalidScalarBroadcastsNulls)
+{
+  auto value = std::make_unique<cudf::numeric_scalar<int32_t>>(0, false);
+  auto const bcast = cudf::broadcast_column{std::move(value), 3};
+
+  fixed_width_column_wrapper<int32_t> expected{{0, 0, 0}, {0, 0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, bcast.materialize()->view());
+}
+
+TEST_F(BroadcastColumnTest, WithSizeAndGatherStaySymbolic)
+{
+  auto const bcast = make_broadcast(5, 100);
+
+  auto const resized = bcast.with_size(2);
+  fixed_width_column_wrapper<int32_t> expected{5, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, resized.materialize()->view());
+
+  fixed_width_column_wrapper<cudf::size_type> gather_map{42, 0, 99};
+  auto const gathered = cudf::gather(bcast, gather_map);
+  EXPECT_EQ(gathered.size(), 3);
+  fixed_width_column_wrapper<int32_t> expected_gathered{5, 5, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_gathered, gathered.materialize()->view());
+}
+
+TEST_F(BroadcastColumnTest, ConcatenateSharedAndDistinctScalars)
+{
+  auto const bcast = make_broadcast(1, 3);
+
+  // both parts share one scalar: a single materialization of the summed size
+  std::vector<cudf::broadcast_column> shared{bcast, bcast.with_size(2)};
+  fixed_width_column_wrapper<int32_t> expected_shared{1, 1, 1, 1, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_shared, cudf::concatenate(shared)->view());
+
+  std::vector<cudf::broadcast_column> distinct{bcast.with_size(2), make_broadcast(2, 2)};
+  fixed_width_column_wrapper<int32_t> expected_distinct{1, 1, 2, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_distinct, cudf::concatenate(distinct)->view());
+}
+
+TEST_F(BroadcastColumnTest, BinaryOperations)
+{
+  auto const bcast = make_broadcast(10, 3);
+  fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  auto const output_type = cudf::data_type{cudf::type_id::INT32};
+
+  fixed_width_column_wrapper<int32_t> expected_add{11, 12, 13};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_add,
+    cudf::binary_operation(bcast, col, cudf::binary_operator::ADD, output_type)->view());
+
+  fixed_width_column_wrapper<int32_t> expected_sub{-9, -8, -7};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expected_sub,
+    cudf::binary_operation(col, bcast, cudf::binary_operator::SUB, output_type)->view());
+
+  // constant op constant evaluates once and stays a broadcast
+  auto const product =
+    cudf::binary_operation(bcast, make_broadcast(4, 3), cudf::binary_operator::MUL, output_type);
+  EXPECT_EQ(product.size(), 3);
+  fixed_width_column_wrapper<int32_t> expected_mul{40, 40, 40};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_mul, product.materialize()->view());
+}
+
+TEST_F(BroadcastColumnTest, Errors)
+{
+  EXPECT_THROW(cudf::broadcast_column(std::unique_ptr<cudf::scalar>{}, 1), cudf::logic_error);
+  EXPECT_THROW(make_broadcast(1, -1), cudf::logic_error);
+
+  auto const bcast = make_broadcast(1, 3);
+  EXPECT_THROW(bcast.with_size(-1), cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> wrong_size{1, 2};
+  EXPECT_THROW(
+    cudf::binary_operation(
+      bcast, wrong_size, cudf::binary_operator::ADD, cudf::data_type{cudf::type_id::INT32}),
+    cudf::logic_error);
+
+  fixed_width_column_wrapper<cudf::size_type> null_map{{0, 1}, {1, 0}};
+  EXPECT_THROW(cudf::gather(bcast, null_map), cudf::logic_error);
+
+  EXPECT_THROW(cudf::concatenate(std::vector<cudf::broadcast_column>{}), cudf::logic_error);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/column/packed_bools.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <algorithm>
+#include <vector>
+
+struct PackedBoolsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PackedBoolsTest, RoundTripTreatsNullsAsFalse)
+{
+  cudf::test::fixed_width_column_wrapper<bool> input{{true, false, true, true, false},
+                                                     {1, 1, 0, 1, 1}};
+  auto const packed = cudf::packed_bools{input};
+
+  EXPECT_EQ(packed.size(), 5);
+  EXPECT_EQ(packed.true_count(), 2);
+
+  // a null unpacks to a valid false
+  cudf::test::fixed_width_column_wrapper<bool> expected{true, false, false, true, false};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, packed.to_column()->view());
+}
+
+TEST_F(PackedBoolsTest, LogicalOperations)
+{
+  // more than one bitmask word, to exercise the partial final word
+  auto const size = 100;
+  std::vector<bool> lhs_data(size);
+  std::vector<bool> rhs_data(size);
+  std::generate(lhs_data.begin(), lhs_data.end(), [i = 0]() mutable { return (i++ % 3) == 0; });
+  std::generate(rhs_data.begin(), rhs_data.end(), [i = 0]() mutable { return (i++ % 2) == 0; });
+
+  cudf::test::fixed_width_column_wrapper<bool> lhs(lhs_data.begin(), lhs_data.end());
+  cudf::test::fixed_width_column_wrapper<bool> rhs(rhs_data.begin(), rhs_data.end());
+  auto const packed_lhs = cudf::packed_bools{lhs};
+  auto const packed_rhs = cudf::packed_bools{rhs};
+
+  std::vector<bool> expect_and(size);
+  std::vector<bool> expect_or(size);
+  std::vector<bool> expect_not(size);
+  for (int i = 0; i < size; ++i) {
+    expect_and[i] = lhs_data[i] && rhs_data[i];
+    expect_or[i]  = lhs_data[i] || rhs_data[i];
+    expect_not[i] = !lhs_data[i];
+  }
+
+  cudf::test::fixed_width_column_wrapper<bool> expected_and(expect_and.begin(), expect_and.end());
+  cudf::test::fixed_width_column_wrapper<bool> expected_or(expect_or.begin(), expect_or.end());
+  cudf::test::fixed_width_column_wrapper<bool> expected_not(expect_not.begin(), expect_not.end());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_and,
+                                 cudf::packed_and(packed_lhs, packed_rhs).to_column()->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_or,
+                                 cudf::packed_or(packed_lhs, packed_rhs).to_column()->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_not, cudf::packed_not(packed_lhs).to_column()->view());
+
+  // NOT must leave the bits beyond size() unset, so the count stays consistent
+  EXPECT_EQ(cudf::packed_not(packed_lhs).true_count(),
+            size - static_cast<cudf::size_type>(
+                     std::count(lhs_data.begin(), lhs_data.end(), true)));
+}
+
+TEST_F(PackedBoolsTest, ApplyBooleanMaskMatchesBool8Path)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> values{10, 20, 30, 40, 50, 60};
+  cudf::test::strings_column_wrapper names{"a", "b", "c", "d", "e", "f"};
+  auto const input = cudf::table_view{{values, names}};
+
+  cudf::test::fixed_width_column_wrapper<bool> mask{{true, false, true, false, true, true},
+                                                    {1, 1, 1, 0, 1, 1}};
+
+  auto const expected = cudf::apply_boolean_mask(input, mask);
+  auto const result   = cudf::apply_boolean_mask(input, cudf::packed_bools{mask});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(PackedBoolsTest, EmptyAndErrors)
+{
+  cudf::test::fixed_width_column_wrapper<bool> empty_bools{};
+  auto const empty_packed = cudf::packed_bools{empty_bools};
+  EXPECT_EQ(empty_packed.size(), 0);
+  EXPECT_EQ(empty_packed.true_count(), 0);
+  EXPECT_EQ(empty_packed.to_column()->size(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> not_bools{1, 2, 3};
+  EXPECT_THROW(cudf::packed_bools{not_bools}, cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<bool> three{true, false, true};
+  EXPECT_THROW(cudf::packed_and(cudf::packed_bools{three}, empty_packed), cudf::logic_error);
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+
+#include <vector>
+
+template <typename T>
+struct CaseWhenTypedTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_SUITE(CaseWhenTypedTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(CaseWhenTypedTest, FirstMatchWins)
+{
+  using T = TypeParam;
+  using cudf::test::fixed_width_column_wrapper;
+
+  fixed_width_column_wrapper<bool> cond0{true, false, true, false, false};
+  fixed_width_column_wrapper<bool> cond1{true, true, false, false, false};
+  fixed_width_column_wrapper<T, int32_t> result0{10, 11, 12, 13, 14};
+  fixed_width_column_wrapper<T, int32_t> result1{20, 21, 22, 23, 24};
+  fixed_width_column_wrapper<T, int32_t> otherwise{30, 31, 32, 33, 34};
+
+  std::vector<cudf::column_view> conditions{cond0, cond1};
+  std::vector<cudf::column_view> results{result0, result1};
+  auto const out = cudf::case_when(conditions, results, otherwise);
+
+  fixed_width_column_wrapper<T, int32_t> expected{10, 21, 12, 33, 34};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, out->view());
+}
+
+struct CaseWhenTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CaseWhenTest, NullConditionsAndResults)
+{
+  using cudf::test::fixed_width_column_wrapper;
+
+  // null condition elements fall through, like copy_if_else
+  fixed_width_column_wrapper<bool> cond0{{true, true, false, false}, {1, 0, 1, 1}};
+  fixed_width_column_wrapper<int32_t> result0{{10, 11, 12, 13}, {0, 1, 1, 1}};
+  fixed_width_column_wrapper<int32_t> otherwise{{30, 31, 32, 33}, {1, 1, 1, 0}};
+
+  std::vector<cudf::column_view> conditions{cond0};
+  std::vector<cudf::column_view> results{result0};
+  auto const out = cudf::case_when(conditions, results, otherwise);
+
+  // row 0 takes the null from result0; row 3 takes the null from otherwise
+  fixed_width_column_wrapper<int32_t> expected{{10, 31, 32, 33}, {0, 1, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, out->view());
+}
+
+TEST_F(CaseWhenTest, Strings)
+{
+  using cudf::test::strings_column_wrapper;
+
+  cudf::test::fixed_width_column_wrapper<bool> cond0{false, true, false, true};
+  cudf::test::fixed_width_column_wrapper<bool> cond1{true, true, false, false};
+  strings_column_wrapper result0{"a0", "a1", "a2", "a3"};
+  strings_column_wrapper result1{"b0", "b1", "b2", "b3"};
+  strings_column_wrapper otherwise{"c0", "c1", "c2", "c3"};
+
+  std::vector<cudf::column_view> conditions{cond0, cond1};
+  std::vector<cudf::column_view> results{result0, result1};
+  auto const out = cudf::case_when(conditions, results, otherwise);
+
+  strings_column_wrapper expected{"b0", "a1", "c2", "a3"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, out->view());
+}
+
+TEST_F(CaseWhenTest, EmptyAndErrors)
+{
+  using cudf::test::fixed_width_column_wrapper;
+
+  fixed_width_column_wrapper<bool> empty_cond{};
+  fixed_width_column_wrapper<int32_t> empty_ints{};
+  std::vector<cudf::column_view> empty_conditions{empty_cond};
+  std::vector<cudf::column_view> empty_results{empty_ints};
+  auto const empty_out =
+    cudf::case_when(empty_conditions, empty_results, fixed_width_column_wrapper<int32_t>{});
+  EXPECT_EQ(empty_out->size(), 0);
+
+  fixed_width_column_wrapper<bool> cond{true, false};
+  fixed_width_column_wrapper<int32_t> ints{1, 2};
+  fixed_width_column_wrapper<double> doubles{1.0, 2.0};
+  std::vector<cudf::column_view> conditions{cond};
+  std::vector<cudf::column_view> results{ints};
+
+  // no conditions
+  EXPECT_THROW(cudf::case_when(std::vector<cudf::column_view>{}, results, ints),
+               cudf::logic_error);
+  // condition count != result count
+  EXPECT_THROW(cudf::case_when(conditions, std::vector<cudf::column_view>{ints, ints}, ints),
+               cudf::logic_error);
+  // non-boolean condition
+  EXPECT_THROW(cudf::case_when(results, results, ints), cudf::logic_error);
+  // mismatched result type
+  EXPECT_THROW(cudf::case_when(conditions, results, doubles), cudf::logic_error);
+}
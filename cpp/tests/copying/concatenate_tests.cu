@@ -156,6 +156,28 @@ TEST_F(StringColumnTest, ConcatenateColumnView)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringColumnTest, ConcatenateManyColumns)
+{
+  std::vector<std::string> h_strings;
+  for (int idx = 0; idx < 300; ++idx) {
+    h_strings.push_back("str" + std::to_string(idx % 23));
+  }
+
+  std::vector<cudf::test::strings_column_wrapper> wrappers;
+  std::vector<cudf::column_view> strings_columns;
+  for (std::size_t pos = 0; pos < h_strings.size(); pos += 5) {
+    wrappers.emplace_back(h_strings.begin() + pos, h_strings.begin() + pos + 5);
+  }
+  for (auto const& wrapper : wrappers) {
+    strings_columns.push_back(wrapper);
+  }
+
+  auto results = cudf::concatenate(strings_columns);
+
+  cudf::test::strings_column_wrapper expected(h_strings.begin(), h_strings.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringColumnTest, ConcatenateTooManyColumns)
 {
   std::vector<const char*> h_strings{"aaa",
@@ -1023,6 +1045,29 @@ TEST_F(ListsColumnTest, ConcatenateLists)
   }
 }
 
+TEST_F(ListsColumnTest, ConcatenateManySlicedColumns)
+{
+  cudf::test::lists_column_wrapper<int> a{{0, 1},
+                                          {2, 3, 4, 5},
+                                          {6, 7, 8},
+                                          {},
+                                          {9},
+                                          {10, 11},
+                                          {12, 13, 14, 15},
+                                          {16},
+                                          {17, 18},
+                                          {19, 20, 21},
+                                          {22},
+                                          {23, 24}};
+
+  // concatenating slices of a column must reproduce the column, including a
+  // zero-length slice mixed in with the others
+  auto const slices = cudf::slice(a, {0, 3, 3, 3, 3, 7, 7, 12});
+  auto result       = cudf::concatenate(slices);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, a);
+}
+
 TEST_F(ListsColumnTest, ConcatenateEmptyLists)
 {
   // to disambiguate between {} == 0 and {} == List{0}
@@ -201,6 +201,69 @@ TYPED_TEST(GatherTest, MultiColReverseIdentityTest)
   }
 }
 
+TYPED_TEST(GatherTest, DestructiveGather)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> source_column(
+    data, data + source_size, validity);
+  auto reversed_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return source_size - 1 - i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(reversed_data,
+                                                             reversed_data + source_size);
+
+  cudf::table_view source_table({source_column, source_column});
+  auto expected = cudf::gather(source_table, gather_map);
+
+  // the consuming form frees the input as it goes but must produce the same result
+  auto owned_source = std::make_unique<cudf::table>(source_table);
+  auto result       = cudf::gather(std::move(owned_source), gather_map);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TYPED_TEST(GatherTest, MultiColMixedWidthsWithOffset)
+{
+  // mixes element widths so the fused gather groups columns by width, and
+  // slices one source column to cover non-zero column offsets
+  constexpr cudf::size_type source_size{1000};
+
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<TypeParam, int32_t> col0(data, data + source_size);
+  cudf::test::fixed_width_column_wrapper<int8_t, int32_t> col1(data, data + source_size);
+  cudf::test::fixed_width_column_wrapper<int64_t, int32_t> col2(data, data + source_size);
+  cudf::test::fixed_width_column_wrapper<TypeParam, int32_t> col3_padded(data,
+                                                                         data + source_size + 10);
+  auto col3 = cudf::slice(col3_padded, {10, 10 + source_size})[0];
+
+  auto reversed_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return source_size - 1 - i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(reversed_data,
+                                                             reversed_data + source_size);
+
+  cudf::table_view source_table{{col0, col1, col2, col3}};
+
+  auto const result = cudf::gather(source_table, gather_map);
+
+  auto shifted_reversed_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return source_size - 1 - i + 10; });
+  cudf::test::fixed_width_column_wrapper<TypeParam, int32_t> expect0(reversed_data,
+                                                                     reversed_data + source_size);
+  cudf::test::fixed_width_column_wrapper<int8_t, int32_t> expect1(reversed_data,
+                                                                  reversed_data + source_size);
+  cudf::test::fixed_width_column_wrapper<int64_t, int32_t> expect2(reversed_data,
+                                                                   reversed_data + source_size);
+  cudf::test::fixed_width_column_wrapper<TypeParam, int32_t> expect3(
+    shifted_reversed_data, shifted_reversed_data + source_size);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect0, result->view().column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect1, result->view().column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect2, result->view().column(2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect3, result->view().column(3));
+}
+
 TYPED_TEST(GatherTest, MultiColNulls)
 {
   constexpr cudf::size_type source_size{1000};
@@ -244,3 +307,83 @@ TYPED_TEST(GatherTest, MultiColNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_column, result->view().column(i));
   }
 }
+
+struct PreparedGatherMapTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PreparedGatherMapTest, InBounds)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source_column({10, 20, 30, 40, 50});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({4, 2, 0, 2});
+  cudf::table_view source_table({source_column});
+
+  cudf::prepared_gather_map prepared(gather_map);
+  EXPECT_EQ(prepared.min_index(), 0);
+  EXPECT_EQ(prepared.max_index(), 4);
+
+  auto const result = cudf::gather(source_table, prepared);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({50, 30, 10, 30});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view().column(0));
+}
+
+TEST_F(PreparedGatherMapTest, NegativeIndices)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source_column({10, 20, 30, 40, 50});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({-1, -5, 1});
+  cudf::table_view source_table({source_column});
+
+  cudf::prepared_gather_map prepared(gather_map);
+  EXPECT_EQ(prepared.min_index(), -5);
+  EXPECT_EQ(prepared.max_index(), 1);
+
+  auto const result = cudf::gather(source_table, prepared);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({50, 10, 20});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view().column(0));
+}
+
+TEST_F(PreparedGatherMapTest, OutOfBoundsNullified)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source_column({10, 20, 30});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({0, 7, 2});
+  cudf::table_view source_table({source_column});
+
+  cudf::prepared_gather_map prepared(gather_map);
+  EXPECT_EQ(prepared.max_index(), 7);
+
+  auto const result = cudf::gather(source_table, prepared);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({10, 0, 30}, {1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view().column(0));
+}
+
+TEST_F(PreparedGatherMapTest, ReuseAcrossTables)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({1, 3, 0});
+  cudf::prepared_gather_map prepared(gather_map);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> column1({10, 20, 30, 40});
+  cudf::test::fixed_width_column_wrapper<int32_t> column2({5, 6, 7, 8});
+
+  auto const result1 = cudf::gather(cudf::table_view({column1}), prepared);
+  auto const result2 = cudf::gather(cudf::table_view({column2}), prepared);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected1({20, 40, 10});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected2({6, 8, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected1, result1->view().column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected2, result2->view().column(0));
+}
+
+TEST_F(PreparedGatherMapTest, NullMapFails)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({0, 1, 2}, {1, 0, 1});
+  EXPECT_THROW(cudf::prepared_gather_map{gather_map}, cudf::logic_error);
+}
+
+TEST_F(PreparedGatherMapTest, EmptyMap)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source_column({10, 20, 30});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{};
+  cudf::prepared_gather_map prepared(gather_map);
+
+  auto const result = cudf::gather(cudf::table_view({source_column}), prepared);
+  EXPECT_EQ(result->num_rows(), 0);
+}
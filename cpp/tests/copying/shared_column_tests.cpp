@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/shared_column.hpp>
+
+struct SharedColumnTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SharedColumnTest, SlicesShareBaseBuffers)
+{
+  auto const input = cudf::test::strings_column_wrapper{"aa", "bb", "cc", "dd", "ee"};
+  auto shared = cudf::shared_column{std::make_unique<cudf::column>(cudf::column_view{input})};
+
+  auto const first  = shared.slice(0, 3);
+  auto const second = shared.slice(2, 5);
+
+  EXPECT_TRUE(shared.is_shared());
+  EXPECT_FALSE(first.is_base());
+  EXPECT_TRUE(first.base().is_base());
+
+  // All slices view the same chars/offsets allocations as the base column
+  EXPECT_EQ(first.view().child(1).head(), shared.view().child(1).head());
+  EXPECT_EQ(second.view().child(1).head(), shared.view().child(1).head());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(first.view(),
+                                 cudf::test::strings_column_wrapper{"aa", "bb", "cc"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(second.view(),
+                                 cudf::test::strings_column_wrapper{"cc", "dd", "ee"});
+}
+
+TEST_F(SharedColumnTest, SplitSharesBaseBuffers)
+{
+  auto const input = cudf::test::fixed_width_column_wrapper<int32_t>{0, 1, 2, 3, 4, 5};
+  auto shared = cudf::shared_column{std::make_unique<cudf::column>(cudf::column_view{input})};
+
+  auto const splits = std::vector<cudf::size_type>{2, 4};
+  auto const pieces = shared.split(splits);
+
+  ASSERT_EQ(pieces.size(), std::size_t{3});
+  for (auto const& piece : pieces) {
+    EXPECT_EQ(piece.view().head(), shared.view().head());
+  }
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(pieces[1].view(),
+                                 cudf::test::fixed_width_column_wrapper<int32_t>{2, 3});
+}
+
+TEST_F(SharedColumnTest, ReleaseWithoutCopyWhenUnique)
+{
+  auto const input = cudf::test::fixed_width_column_wrapper<int32_t>{0, 1, 2, 3};
+  auto shared = cudf::shared_column{std::make_unique<cudf::column>(cudf::column_view{input})};
+
+  auto const* data = shared.view().head();
+  auto released    = shared.release();
+
+  // Sole unsliced owner: the base column is moved out, not copied
+  EXPECT_EQ(released->view().head(), data);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(released->view(),
+                                 cudf::test::fixed_width_column_wrapper<int32_t>{0, 1, 2, 3});
+}
+
+TEST_F(SharedColumnTest, ReleaseCopiesWhenSlicedOrShared)
+{
+  auto const input = cudf::test::fixed_width_column_wrapper<int32_t>{0, 1, 2, 3};
+  auto shared = cudf::shared_column{std::make_unique<cudf::column>(cudf::column_view{input})};
+
+  auto sliced        = shared.slice(1, 3);
+  auto released      = sliced.release();
+  auto released_base = shared.release();
+
+  EXPECT_NE(released->view().head(), released_base->view().head());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(released->view(),
+                                 cudf::test::fixed_width_column_wrapper<int32_t>{1, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(released_base->view(),
+                                 cudf::test::fixed_width_column_wrapper<int32_t>{0, 1, 2, 3});
+}
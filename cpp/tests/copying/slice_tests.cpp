@@ -367,6 +367,33 @@ TYPED_TEST(SliceTableTest, NumericColumnsWithNulls)
   }
 }
 
+TYPED_TEST(SliceTableTest, DestructiveSlice)
+{
+  using T = TypeParam;
+
+  cudf::size_type start    = 0;
+  cudf::size_type col_size = 10;
+  auto valids              = cudf::detail::make_counting_transform_iterator(
+    start, [](auto i) { return i % 2 == 0 ? true : false; });
+
+  cudf::size_type num_cols = 5;
+  cudf::table src_table    = create_fixed_table<T>(num_cols, start, col_size, valids);
+
+  auto expected = cudf::slice(src_table, {2, 8}).front();
+
+  // the consuming form frees the input as it goes but must produce the same result
+  auto owned  = std::make_unique<cudf::table>(src_table);
+  auto result = cudf::slice(std::move(owned), 2, 8);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
+
+  // a whole-table slice hands back the input with its device buffers reused
+  auto whole_input        = std::make_unique<cudf::table>(src_table);
+  auto const* data_before = whole_input->get_column(0).view().head();
+  auto whole              = cudf::slice(std::move(whole_input), 0, col_size);
+  EXPECT_EQ(data_before, whole->get_column(0).view().head());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(src_table, whole->view());
+}
+
 struct SliceStringTableTest : public SliceTableTest<std::string> {
 };
 
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace test {
+
+struct SpillUnspillTest : public BaseFixture {
+  void run_test(cudf::table_view const& t)
+  {
+    auto spilled   = spill(t);
+    auto unspilled = unspill(spilled);
+    auto unpacked  = unpack(unspilled);
+    cudf::test::expect_tables_equal(t, unpacked);
+  }
+  void run_test(std::vector<column_view> const& t) { run_test(cudf::table_view{t}); }
+};
+
+TEST_F(SpillUnspillTest, SingleColumnFixedWidth)
+{
+  fixed_width_column_wrapper<int64_t> col1({1, 2, 3, 4, 5, 6, 7}, {1, 1, 1, 0, 1, 0, 1});
+
+  this->run_test({col1});
+}
+
+TEST_F(SpillUnspillTest, MultiColumnWithStrings)
+{
+  fixed_width_column_wrapper<int16_t> col1({1, 2, 3, 4, 5, 6, 7}, {1, 1, 1, 0, 1, 0, 1});
+  strings_column_wrapper col2({"Lorem", "ipsum", "dolor", "sit", "amet", "ort", "ral"},
+                              {1, 0, 1, 1, 1, 0, 1});
+  strings_column_wrapper col3({"", "this", "is", "a", "column", "of", "strings"});
+
+  this->run_test({col1, col2, col3});
+}
+
+TEST_F(SpillUnspillTest, EmptyTable)
+{
+  this->run_test(std::vector<column_view>{});
+
+  fixed_width_column_wrapper<int32_t> col1({});
+  this->run_test({col1});
+}
+
+TEST_F(SpillUnspillTest, CompressibleSpansManyBlocks)
+{
+  // repetitive data spanning several compression blocks should shrink
+  std::vector<int64_t> values(1 << 17);
+  std::iota(values.begin(), values.end(), 0);
+  std::transform(
+    values.begin(), values.end(), values.begin(), [](auto v) { return v % 8; });
+  fixed_width_column_wrapper<int64_t> col1(values.begin(), values.end());
+
+  cudf::table_view t{{col1}};
+  auto spilled = spill(t);
+  EXPECT_GT(spilled.uncompressed_size, spilled.data->size());
+  EXPECT_GT(spilled.block_sizes.size(), std::size_t{1});
+
+  auto unspilled = unspill(spilled);
+  cudf::test::expect_tables_equal(t, unpack(unspilled));
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+struct ToHostTest : public BaseFixture {
+  // snapshot the table, restore the host buffer to the device and compare
+  void run_test(cudf::table_view const& t)
+  {
+    auto snapshot = to_host(t);
+    snapshot.wait();
+    EXPECT_TRUE(snapshot.is_ready());
+
+    auto restored = std::make_unique<rmm::device_buffer>(
+      snapshot.data(), snapshot.size(), rmm::cuda_stream_default);
+    auto metadata = std::make_unique<packed_columns::metadata>(std::vector<uint8_t>(
+      snapshot.metadata().data(), snapshot.metadata().data() + snapshot.metadata().size()));
+    packed_columns packed{std::move(metadata), std::move(restored)};
+    cudf::test::expect_tables_equal(t, unpack(packed));
+  }
+  void run_test(std::vector<column_view> const& t) { run_test(cudf::table_view{t}); }
+};
+
+TEST_F(ToHostTest, SingleColumnFixedWidth)
+{
+  fixed_width_column_wrapper<int64_t> col1({1, 2, 3, 4, 5, 6, 7}, {1, 1, 1, 0, 1, 0, 1});
+
+  this->run_test({col1});
+}
+
+TEST_F(ToHostTest, MultiColumnWithStrings)
+{
+  fixed_width_column_wrapper<int16_t> col1({1, 2, 3, 4, 5, 6, 7}, {1, 1, 1, 0, 1, 0, 1});
+  strings_column_wrapper col2({"Lorem", "ipsum", "dolor", "sit", "amet", "ort", "ral"},
+                              {1, 0, 1, 1, 1, 0, 1});
+  strings_column_wrapper col3({"", "this", "is", "a", "column", "of", "strings"});
+
+  this->run_test({col1, col2, col3});
+}
+
+TEST_F(ToHostTest, EmptyTable)
+{
+  this->run_test(std::vector<column_view>{});
+
+  fixed_width_column_wrapper<int32_t> col1({});
+  this->run_test({col1});
+}
+
+TEST_F(ToHostTest, MovedSnapshotStaysValid)
+{
+  fixed_width_column_wrapper<int32_t> col1({1, 2, 3, 4, 5});
+  cudf::table_view t{{col1}};
+
+  auto snapshot = to_host(t);
+  auto moved    = std::move(snapshot);
+  moved.wait();
+  EXPECT_GT(moved.size(), std::size_t{0});
+
+  auto restored = std::make_unique<rmm::device_buffer>(
+    moved.data(), moved.size(), rmm::cuda_stream_default);
+  auto metadata = std::make_unique<packed_columns::metadata>(std::vector<uint8_t>(
+    moved.metadata().data(), moved.metadata().data() + moved.metadata().size()));
+  packed_columns packed{std::move(metadata), std::move(restored)};
+  cudf::test::expect_tables_equal(t, unpack(packed));
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -26,6 +26,7 @@
 #include <cudf/datetime.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/types.hpp>
+#include <cudf/wrappers/durations.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
 #define XXX false  // stub for null values
@@ -405,6 +406,41 @@ TYPED_TEST(TypedDatetimeOpsTest, TestCeilDatetime)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*ceil_millisecond(input), expected_millisecond);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestRoundToInterval)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  // timestamps in seconds bucketed into 5 minute (300 second) intervals
+  auto timestamps = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    -150, 0, 120, 300, 449, 450};
+  auto const interval = cudf::duration_scalar<cudf::duration_s>(300, true);
+
+  auto expected_floor = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    -300, 0, 0, 300, 300, 300};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*floor_timestamps(timestamps, interval), expected_floor);
+
+  auto expected_ceil =
+    fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{0, 0, 300, 300, 600, 600};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*ceil_timestamps(timestamps, interval), expected_ceil);
+
+  auto expected_round =
+    fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{0, 0, 0, 300, 300, 600};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*round_timestamps(timestamps, interval), expected_round);
+
+  // an interval expressed in a different resolution than the column
+  auto const ms_interval = cudf::duration_scalar<cudf::duration_ms>(300000, true);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*floor_timestamps(timestamps, ms_interval), expected_floor);
+
+  // intervals finer than the timestamp resolution are rejected
+  EXPECT_THROW(floor_timestamps(timestamps, cudf::duration_scalar<cudf::duration_ms>(500, true)),
+               cudf::logic_error);
+
+  // non-positive intervals are rejected
+  EXPECT_THROW(floor_timestamps(timestamps, cudf::duration_scalar<cudf::duration_s>(0, true)),
+               cudf::logic_error);
+}
+
 TEST_F(BasicDatetimeOpsTest, TestDayOfYearWithDate)
 {
   using namespace cudf::test;
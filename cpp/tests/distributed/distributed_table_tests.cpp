@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/distributed_table.hpp>
+#include <cudf/table/table.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// The tests run with a single GPU: all shards live on device 0 and peer
+// copies degenerate to same-device copies, which exercises the same
+// pack/transfer/unpack path.
+
+struct DistributedTableTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+
+std::unique_ptr<cudf::table> make_table(std::vector<int32_t> const& keys,
+                                        std::vector<int32_t> const& values)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys_col(keys.begin(), keys.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> values_col(values.begin(), values.end());
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(keys_col.release());
+  columns.push_back(values_col.release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+}  // namespace
+
+TEST_F(DistributedTableTest, GatherMatchesConcatenate)
+{
+  std::vector<cudf::distributed_table::shard> shards;
+  shards.push_back({0, make_table({1, 2, 3}, {10, 20, 30})});
+  shards.push_back({0, make_table({4, 5}, {40, 50})});
+  cudf::distributed_table distributed(std::move(shards));
+
+  EXPECT_EQ(distributed.num_shards(), 2);
+  EXPECT_EQ(distributed.num_rows(), 5);
+  EXPECT_EQ(distributed.shard_device(0), 0);
+  EXPECT_EQ(distributed.shard_view(1).num_rows(), 2);
+
+  auto const expected =
+    cudf::concatenate(std::vector<cudf::table_view>{distributed.shard_view(0),
+                                                    distributed.shard_view(1)});
+  auto const result = distributed.gather_to(0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(DistributedTableTest, HashPartitionPreservesRows)
+{
+  std::vector<cudf::distributed_table::shard> shards;
+  shards.push_back({0, make_table({1, 2, 3, 4}, {10, 20, 30, 40})});
+  shards.push_back({0, make_table({1, 2, 3, 4}, {11, 21, 31, 41})});
+  cudf::distributed_table distributed(std::move(shards));
+
+  auto const partitioned = distributed.hash_partition({0});
+  EXPECT_EQ(partitioned.num_shards(), distributed.num_shards());
+  EXPECT_EQ(partitioned.num_rows(), distributed.num_rows());
+
+  // equal keys must land in a single shard: each key appears in at most one shard
+  for (int32_t key = 1; key <= 4; ++key) {
+    int shards_with_key = 0;
+    for (cudf::size_type i = 0; i < partitioned.num_shards(); ++i) {
+      auto const keys = cudf::test::to_host<int32_t>(partitioned.shard_view(i).column(0)).first;
+      if (std::count(keys.begin(), keys.end(), key) > 0) { ++shards_with_key; }
+    }
+    EXPECT_LE(shards_with_key, 1);
+  }
+}
+
+TEST_F(DistributedTableTest, HashPartitionWithEmptyShard)
+{
+  std::vector<cudf::distributed_table::shard> shards;
+  shards.push_back({0, make_table({1, 2, 3, 4}, {10, 20, 30, 40})});
+  shards.push_back({0, make_table({}, {})});
+  cudf::distributed_table distributed(std::move(shards));
+
+  auto const partitioned = distributed.hash_partition({0});
+  EXPECT_EQ(partitioned.num_shards(), 2);
+  EXPECT_EQ(partitioned.num_rows(), 4);
+}
+
+TEST_F(DistributedTableTest, ConstructorErrors)
+{
+  // no shards
+  EXPECT_THROW(cudf::distributed_table(std::vector<cudf::distributed_table::shard>{}),
+               cudf::logic_error);
+
+  // null shard table
+  {
+    std::vector<cudf::distributed_table::shard> shards;
+    shards.push_back({0, nullptr});
+    EXPECT_THROW(cudf::distributed_table(std::move(shards)), cudf::logic_error);
+  }
+
+  // mismatched schemas
+  {
+    cudf::test::fixed_width_column_wrapper<double> doubles({1.0, 2.0});
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    columns.push_back(doubles.release());
+
+    std::vector<cudf::distributed_table::shard> shards;
+    shards.push_back({0, make_table({1, 2}, {10, 20})});
+    shards.push_back({0, std::make_unique<cudf::table>(std::move(columns))});
+    EXPECT_THROW(cudf::distributed_table(std::move(shards)), cudf::logic_error);
+  }
+}
+
+TEST_F(DistributedTableTest, HashPartitionErrors)
+{
+  std::vector<cudf::distributed_table::shard> shards;
+  shards.push_back({0, make_table({1, 2}, {10, 20})});
+  cudf::distributed_table distributed(std::move(shards));
+  EXPECT_THROW(distributed.hash_partition({}), cudf::logic_error);
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/estimation.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+struct EstimationTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(EstimationTest, DistinctCountExactOnSmallColumn)
+{
+  // the sample covers the whole column so the estimate is exact
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 2, 3, 3, 3, 4}};
+  auto const estimate = cudf::estimation::estimate_distinct_count(input);
+  EXPECT_DOUBLE_EQ(estimate, 4.0);
+}
+
+TEST_F(EstimationTest, DistinctCountSampled)
+{
+  // 100k rows with 100 distinct values; the estimate should land near 100
+  std::vector<int32_t> values(100000);
+  std::generate(values.begin(), values.end(), [i = 0]() mutable { return (i++) % 100; });
+  cudf::test::fixed_width_column_wrapper<int32_t> input(values.begin(), values.end());
+
+  auto const estimate = cudf::estimation::estimate_distinct_count(input, 4096);
+  EXPECT_GE(estimate, 50.0);
+  EXPECT_LE(estimate, 200.0);
+}
+
+TEST_F(EstimationTest, DistinctCountAllUnique)
+{
+  std::vector<int32_t> values(50000);
+  std::iota(values.begin(), values.end(), 0);
+  cudf::test::fixed_width_column_wrapper<int32_t> input(values.begin(), values.end());
+
+  // every sampled value is a singleton so the estimate should approach the row count
+  auto const estimate = cudf::estimation::estimate_distinct_count(input, 4096);
+  EXPECT_GE(estimate, 25000.0);
+  EXPECT_LE(estimate, 50000.0);
+}
+
+TEST_F(EstimationTest, DistinctCountEmpty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{};
+  EXPECT_DOUBLE_EQ(cudf::estimation::estimate_distinct_count(input), 0.0);
+}
+
+TEST_F(EstimationTest, EquidepthHistogram)
+{
+  std::vector<int32_t> values(10000);
+  std::iota(values.begin(), values.end(), 0);
+  cudf::test::fixed_width_column_wrapper<int32_t> input(values.begin(), values.end());
+
+  auto const boundaries = cudf::estimation::equidepth_histogram(input, 4);
+  EXPECT_EQ(boundaries->size(), 5);
+  EXPECT_EQ(boundaries->type().id(), cudf::type_id::INT32);
+
+  // boundaries must be ascending
+  auto const host = cudf::test::to_host<int32_t>(boundaries->view()).first;
+  EXPECT_TRUE(std::is_sorted(host.begin(), host.end()));
+}
+
+TEST_F(EstimationTest, EquidepthHistogramErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3}};
+  EXPECT_THROW(cudf::estimation::equidepth_histogram(input, 0), cudf::logic_error);
+}
+
+TEST_F(EstimationTest, JoinSelectivity)
+{
+  // keys with 10 distinct values on the left and 4 on the right:
+  // selectivity should be about 1/10
+  std::vector<int32_t> left_v(1000);
+  std::generate(left_v.begin(), left_v.end(), [i = 0]() mutable { return (i++) % 10; });
+  std::vector<int32_t> right_v(1000);
+  std::generate(right_v.begin(), right_v.end(), [i = 0]() mutable { return (i++) % 4; });
+  cudf::test::fixed_width_column_wrapper<int32_t> left(left_v.begin(), left_v.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> right(right_v.begin(), right_v.end());
+
+  auto const selectivity = cudf::estimation::estimate_join_selectivity(left, right);
+  EXPECT_GT(selectivity, 0.0);
+  EXPECT_NEAR(selectivity, 0.1, 0.05);
+}
+
+TEST_F(EstimationTest, JoinSelectivityEmpty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> left{};
+  cudf::test::fixed_width_column_wrapper<int32_t> right{{1, 2, 3}};
+  EXPECT_DOUBLE_EQ(cudf::estimation::estimate_join_selectivity(left, right), 0.0);
+}
+
+TEST_F(EstimationTest, CountMinSketchTopK)
+{
+  // value v appears 100 * (10 - v) times: 0 is the heaviest, 9 the lightest
+  std::vector<int32_t> values;
+  for (int32_t v = 0; v < 10; ++v) {
+    values.insert(values.end(), 100 * (10 - v), v);
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> input(values.begin(), values.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> candidates{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+
+  auto const sketch = cudf::estimation::count_min_sketch(input);
+  EXPECT_EQ(sketch->type().id(), cudf::type_id::UINT64);
+  EXPECT_EQ(sketch->size(), 4096 * 5);
+
+  auto const topk = cudf::estimation::topk_from_sketch(sketch->view(), candidates, 3);
+  EXPECT_EQ(topk->num_columns(), 2);
+  EXPECT_EQ(topk->num_rows(), 3);
+
+  // the estimates never undercount and the heaviest values rank first
+  auto const top_values = cudf::test::to_host<int32_t>(topk->view().column(0)).first;
+  auto const top_counts = cudf::test::to_host<uint64_t>(topk->view().column(1)).first;
+  EXPECT_EQ(top_values[0], 0);
+  EXPECT_EQ(top_values[1], 1);
+  EXPECT_EQ(top_values[2], 2);
+  EXPECT_GE(top_counts[0], 1000u);
+  EXPECT_GE(top_counts[1], 900u);
+  EXPECT_GE(top_counts[2], 800u);
+}
+
+TEST_F(EstimationTest, CountMinSketchMerge)
+{
+  std::vector<int32_t> first_half(500, 7);
+  std::vector<int32_t> second_half(250, 7);
+  second_half.insert(second_half.end(), 100, 3);
+  cudf::test::fixed_width_column_wrapper<int32_t> first(first_half.begin(), first_half.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> second(second_half.begin(), second_half.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> candidates{{3, 7}};
+
+  // element-wise addition of two partial sketches merges them
+  auto const sketch1 = cudf::estimation::count_min_sketch(first, 1024, 3);
+  auto const sketch2 = cudf::estimation::count_min_sketch(second, 1024, 3);
+  auto const merged  = cudf::binary_operation(sketch1->view(),
+                                              sketch2->view(),
+                                              cudf::binary_operator::ADD,
+                                              cudf::data_type{cudf::type_id::UINT64});
+
+  auto const topk = cudf::estimation::topk_from_sketch(merged->view(), candidates, 2, 3);
+  auto const top_values = cudf::test::to_host<int32_t>(topk->view().column(0)).first;
+  auto const top_counts = cudf::test::to_host<uint64_t>(topk->view().column(1)).first;
+  EXPECT_EQ(top_values[0], 7);
+  EXPECT_GE(top_counts[0], 750u);
+  EXPECT_EQ(top_values[1], 3);
+  EXPECT_GE(top_counts[1], 100u);
+}
+
+TEST_F(EstimationTest, CountMinSketchSkipsNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 1, 1, 2, 2}, {1, 1, 1, 0, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> candidates{{1, 2}};
+
+  auto const sketch = cudf::estimation::count_min_sketch(input, 256, 3);
+  auto const topk   = cudf::estimation::topk_from_sketch(sketch->view(), candidates, 2, 3);
+
+  auto const top_values = cudf::test::to_host<int32_t>(topk->view().column(0)).first;
+  auto const top_counts = cudf::test::to_host<uint64_t>(topk->view().column(1)).first;
+  EXPECT_EQ(top_values[0], 1);
+  EXPECT_GE(top_counts[0], 3u);
+  // the null rows holding 2 are not counted; its estimate can only come from
+  // colliding with the three counted rows
+  EXPECT_LE(top_counts[1], 3u);
+}
+
+TEST_F(EstimationTest, CountMinSketchErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3}};
+  EXPECT_THROW(cudf::estimation::count_min_sketch(input, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::estimation::count_min_sketch(input, 1024, 0), cudf::logic_error);
+
+  auto const sketch = cudf::estimation::count_min_sketch(input, 1024, 3);
+  // k must be positive and depth must divide the sketch size
+  EXPECT_THROW(cudf::estimation::topk_from_sketch(sketch->view(), input, 0, 3), cudf::logic_error);
+  EXPECT_THROW(cudf::estimation::topk_from_sketch(sketch->view(), input, 1, 5), cudf::logic_error);
+}
@@ -185,3 +185,73 @@ TEST_F(SequenceTestFixture, DateSequenceBadTypes)
 
   EXPECT_THROW(calendrical_month_sequence(size, init, months), cudf::logic_error);
 }
+
+TEST_F(SequenceTestFixture, TimestampSequence)
+{
+  timestamp_scalar<timestamp_s> init(timestamp_s{duration_s{100}}, true);
+  duration_scalar<duration_s> step(duration_s{3600}, true);
+
+  auto result = cudf::sequence(4, init, step);
+
+  fixed_width_column_wrapper<timestamp_s, int64_t> expected{100, 3700, 7300, 10900};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(SequenceTestFixture, TimestampSequenceMismatchedResolution)
+{
+  timestamp_scalar<timestamp_s> init(timestamp_s{duration_s{100}}, true);
+  duration_scalar<duration_ms> step(duration_ms{500}, true);
+
+  EXPECT_THROW(cudf::sequence(4, init, step), cudf::logic_error);
+}
+
+TEST_F(SequenceTestFixture, SequenceByGroup)
+{
+  fixed_width_column_wrapper<int32_t> labels{0, 0, 0, 1, 1, 2};
+  numeric_scalar<int32_t> init(0);
+  numeric_scalar<int32_t> step(1);
+
+  auto result = cudf::sequence_by_group(labels, init, step);
+
+  fixed_width_column_wrapper<int32_t> expected{0, 1, 2, 0, 1, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(SequenceTestFixture, SequenceByGroupWithStep)
+{
+  // Equal labels in non-contiguous runs form separate groups
+  strings_column_wrapper labels{"a", "a", "b", "b", "a"};
+  numeric_scalar<int64_t> init(10);
+  numeric_scalar<int64_t> step(5);
+
+  auto result = cudf::sequence_by_group(labels, init, step);
+
+  fixed_width_column_wrapper<int64_t> expected{10, 15, 10, 15, 10};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(SequenceTestFixture, SequenceByGroupNullLabels)
+{
+  // Null labels compare equal, so a run of nulls forms a single group
+  fixed_width_column_wrapper<int32_t> labels{{1, 0, 0, 2}, {1, 0, 0, 1}};
+  numeric_scalar<int32_t> init(0);
+  numeric_scalar<int32_t> step(1);
+
+  auto result = cudf::sequence_by_group(labels, init, step);
+
+  fixed_width_column_wrapper<int32_t> expected{0, 0, 1, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(SequenceTestFixture, SequenceByGroupBadTypes)
+{
+  fixed_width_column_wrapper<int32_t> labels{0, 0, 1};
+
+  string_scalar string_init("zero");
+  string_scalar string_step("one");
+  EXPECT_THROW(cudf::sequence_by_group(labels, string_init, string_step), cudf::logic_error);
+
+  numeric_scalar<int32_t> init(0);
+  numeric_scalar<int64_t> step(1);
+  EXPECT_THROW(cudf::sequence_by_group(labels, init, step), cudf::logic_error);
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+#include <cmath>
+
+using namespace cudf::test::iterators;
+
+namespace cudf {
+namespace test {
+namespace {
+// Runs a single groupby aggregation and returns the per-group result values
+// in group-key order.
+std::vector<size_type> run_agg(column_view const& keys,
+                               column_view const& vals,
+                               std::unique_ptr<groupby_aggregation> agg)
+{
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(std::move(agg));
+
+  groupby::groupby gb_obj{table_view({keys})};
+  auto result = gb_obj.aggregate(requests);
+
+  auto sorted_order =
+    cudf::sorted_order(result.first->view(), {}, std::vector<null_order>(1, null_order::AFTER));
+  auto sorted_vals =
+    cudf::gather(table_view({result.second[0].results[0]->view()}), *sorted_order)->get_column(0);
+
+  auto host_vals = to_host<size_type>(sorted_vals.view()).first;
+  return std::vector<size_type>(host_vals.begin(), host_vals.end());
+}
+}  // namespace
+
+struct groupby_approx_nunique_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_approx_nunique_test, small_cardinality_is_near_exact)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto const exact = run_agg(keys, vals, cudf::make_nunique_aggregation<groupby_aggregation>());
+  auto const approx =
+    run_agg(keys, vals, cudf::make_approx_nunique_aggregation<groupby_aggregation>());
+
+  // With a handful of distinct values the linear-counting path is essentially
+  // exact; allow one-off differences from register collisions
+  ASSERT_EQ(exact.size(), approx.size());
+  for (size_t i = 0; i < exact.size(); ++i) {
+    EXPECT_NEAR(exact[i], approx[i], 1);
+  }
+}
+
+TEST_F(groupby_approx_nunique_test, large_cardinality_within_tolerance)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  constexpr int num_rows   = 60000;
+  constexpr int num_groups = 3;
+
+  auto keys_begin = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<K>(i % num_groups); });
+  fixed_width_column_wrapper<K> keys(keys_begin, keys_begin + num_rows);
+  // every value distinct within its group
+  auto vals_begin = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<V>(i); });
+  fixed_width_column_wrapper<V> vals(vals_begin, vals_begin + num_rows);
+
+  auto const approx =
+    run_agg(keys, vals, cudf::make_approx_nunique_aggregation<groupby_aggregation>());
+
+  // default precision 11 gives ~2.3% standard error; allow 5 sigma
+  constexpr double exact     = num_rows / num_groups;
+  constexpr double tolerance = 5 * 1.04 / 45.25;  // 1.04 / sqrt(2^11)
+  ASSERT_EQ(approx.size(), static_cast<size_t>(num_groups));
+  for (auto const estimate : approx) {
+    EXPECT_NEAR(estimate, exact, exact * tolerance);
+  }
+}
+
+TEST_F(groupby_approx_nunique_test, null_handling)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  fixed_width_column_wrapper<K> keys{1, 1, 1, 2, 2, 2};
+  fixed_width_column_wrapper<V> vals({1, 2, 2, 0, 0, 0}, {1, 1, 1, 0, 0, 0});
+
+  auto const exclude = run_agg(
+    keys, vals, cudf::make_approx_nunique_aggregation<groupby_aggregation>(null_policy::EXCLUDE));
+  EXPECT_EQ(exclude[0], 2);
+  EXPECT_EQ(exclude[1], 0);
+
+  // all nulls count as a single distinct value
+  auto const include = run_agg(
+    keys, vals, cudf::make_approx_nunique_aggregation<groupby_aggregation>(null_policy::INCLUDE));
+  EXPECT_EQ(include[0], 3);
+  EXPECT_EQ(include[1], 1);
+}
+
+TEST_F(groupby_approx_nunique_test, empty_cols)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  fixed_width_column_wrapper<K> keys{};
+  fixed_width_column_wrapper<V> vals{};
+
+  auto const approx =
+    run_agg(keys, vals, cudf::make_approx_nunique_aggregation<groupby_aggregation>());
+  EXPECT_TRUE(approx.empty());
+}
+
+TEST_F(groupby_approx_nunique_test, invalid_precision_throws)
+{
+  EXPECT_THROW(cudf::make_approx_nunique_aggregation<groupby_aggregation>(null_policy::EXCLUDE, 3),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::make_approx_nunique_aggregation<groupby_aggregation>(null_policy::EXCLUDE, 19),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
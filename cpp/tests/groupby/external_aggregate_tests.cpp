@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+using namespace cudf::test::iterators;
+
+namespace cudf {
+namespace test {
+namespace {
+// Compares an external (partitioned) aggregate against a single-pass aggregate
+// over the whole input, normalizing both to sorted key order.
+void expect_matches_single_pass(table_view const& keys,
+                                std::vector<groupby::aggregation_request> const& requests,
+                                size_type num_partitions)
+{
+  auto [got_keys, got_results] = groupby::external_aggregate(keys, requests, num_partitions);
+
+  groupby::groupby gb_obj(keys);
+  auto [expect_keys, expect_results] = gb_obj.aggregate(requests);
+
+  auto const sort_result = [](table_view const& result_keys, column_view const& result_vals) {
+    auto const order = sorted_order(result_keys, {}, {null_order::AFTER});
+    return std::make_pair(gather(result_keys, *order), gather(table_view({result_vals}), *order));
+  };
+
+  for (size_t i = 0; i < requests.size(); ++i) {
+    for (size_t agg = 0; agg < requests[i].aggregations.size(); ++agg) {
+      auto const [got_keys_sorted, got_vals_sorted] =
+        sort_result(got_keys->view(), got_results[i].results[agg]->view());
+      auto const [expect_keys_sorted, expect_vals_sorted] =
+        sort_result(expect_keys->view(), expect_results[i].results[agg]->view());
+
+      CUDF_TEST_EXPECT_TABLES_EQUAL(*expect_keys_sorted, *got_keys_sorted);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals_sorted->get_column(0),
+                                          got_vals_sorted->get_column(0));
+    }
+  }
+}
+}  // namespace
+
+struct groupby_external_aggregate_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_external_aggregate_test, simple_aggregations)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_min_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_mean_aggregation<groupby_aggregation>());
+
+  expect_matches_single_pass(table_view({keys}), requests, 4);
+}
+
+TEST_F(groupby_external_aggregate_test, multiple_requests_with_nulls)
+{
+  fixed_width_column_wrapper<int32_t> keys{{1, 2, 3, 1, 2, 2, 1, 3, 3, 2}, null_at(3)};
+  fixed_width_column_wrapper<int32_t> vals0{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, null_at(1)};
+  fixed_width_column_wrapper<double> vals1{1., 2., 3., 4., 5., 6., 7., 8., 9., 10.};
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals0;
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<groupby_aggregation>());
+  requests.emplace_back();
+  requests[1].values = vals1;
+  requests[1].aggregations.push_back(cudf::make_max_aggregation<groupby_aggregation>());
+
+  expect_matches_single_pass(table_view({keys}), requests, 3);
+}
+
+TEST_F(groupby_external_aggregate_test, more_partitions_than_keys)
+{
+  // Some partitions end up empty and must not contribute result rows
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals{10, 20, 30, 40};
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+
+  expect_matches_single_pass(table_view({keys}), requests, 16);
+}
+
+TEST_F(groupby_external_aggregate_test, empty_input)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  fixed_width_column_wrapper<int32_t> vals{};
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+
+  auto [result_keys, results] = groupby::external_aggregate(table_view({keys}), requests, 4);
+  EXPECT_EQ(result_keys->num_rows(), 0);
+  EXPECT_EQ(results[0].results[0]->size(), 0);
+}
+
+TEST_F(groupby_external_aggregate_test, invalid_arguments)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2};
+  fixed_width_column_wrapper<int32_t> short_vals{0, 1};
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+
+  EXPECT_THROW(groupby::external_aggregate(table_view({keys}), requests, 0), cudf::logic_error);
+
+  requests[0].values = short_vals;
+  EXPECT_THROW(groupby::external_aggregate(table_view({keys}), requests, 4), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
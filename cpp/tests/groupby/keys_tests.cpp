@@ -54,6 +54,26 @@ TYPED_TEST(groupby_keys_test, basic)
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
 
+TYPED_TEST(groupby_keys_test, negative_keys)
+{
+  using K = TypeParam;
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, aggregation::COUNT_VALID>;
+
+  // clang-format off
+  fixed_width_column_wrapper<K> keys        { -3,  2, -3,  0,  2, -3,  0};
+  fixed_width_column_wrapper<V> vals        {  0,  1,  2,  3,  4,  5,  6};
+
+  fixed_width_column_wrapper<K> expect_keys { -3,  0,  2 };
+  fixed_width_column_wrapper<R> expect_vals {  3,  2,  2 };
+  // clang-format on
+
+  // Force the sort implementation to verify the radix sorted order of signed
+  // keys matches the comparison sorted order
+  auto agg = cudf::make_count_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg), force_use_sort_impl::YES);
+}
+
 TYPED_TEST(groupby_keys_test, zero_valid_keys)
 {
   using K = TypeParam;
@@ -263,6 +283,35 @@ TEST_F(groupby_string_keys_test, basic)
 }
 // clang-format on
 
+struct groupby_multi_fixed_width_keys_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_multi_fixed_width_keys_test, packed_radix_keys)
+{
+  // Mixed-width fixed-width key columns pack into a single radix sort key
+  // clang-format off
+  fixed_width_column_wrapper<int32_t> key0{ 1, -1,  1, -1,  1,  1};
+  fixed_width_column_wrapper<int8_t>  key1{ 2,  4,  2,  4,  3,  2};
+  fixed_width_column_wrapper<int32_t> vals{ 0,  1,  2,  3,  4,  5};
+
+  fixed_width_column_wrapper<int32_t>   expect_key0{-1, 1, 1};
+  fixed_width_column_wrapper<int8_t>    expect_key1{ 4, 2, 3};
+  fixed_width_column_wrapper<size_type> expect_vals{ 2, 3, 1};
+  // clang-format on
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals;
+  // nunique is a sort-based aggregation, so this exercises the sort helper
+  requests[0].aggregations.push_back(cudf::make_nunique_aggregation<groupby_aggregation>());
+
+  groupby::groupby gb_obj(table_view({key0, key1}));
+  auto result = gb_obj.aggregate(requests);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_key0, expect_key1}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals, *result.second[0].results[0]);
+}
+
 struct groupby_dictionary_keys_test : public cudf::test::BaseFixture {
 };
 
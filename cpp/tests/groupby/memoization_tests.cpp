@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/groupby.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+struct groupby_memoization_test : public cudf::test::BaseFixture {
+  void TearDown() override
+  {
+    groupby::memoization::clear();
+    cudf::test::BaseFixture::TearDown();
+  }
+};
+
+namespace {
+
+auto sum_aggregate(table_view const& keys, column_view const& values)
+{
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+  groupby::groupby gb(keys);
+  return gb.aggregate(requests);
+}
+
+}  // namespace
+
+TEST_F(groupby_memoization_test, RepeatedAggregateMatchesUncached)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  table_view keys_view({keys});
+
+  auto const uncached = sum_aggregate(keys_view, vals);
+
+  groupby::memoization::register_immutable(keys_view);
+  auto const first  = sum_aggregate(keys_view, vals);
+  auto const second = sum_aggregate(keys_view, vals);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(uncached.first->view(), first.first->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(uncached.first->view(), second.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(uncached.second[0].results[0]->view(),
+                                 first.second[0].results[0]->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(uncached.second[0].results[0]->view(),
+                                 second.second[0].results[0]->view());
+  // hits hand out independent copies
+  EXPECT_NE(first.second[0].results[0]->view().head<void>(),
+            second.second[0].results[0]->view().head<void>());
+}
+
+TEST_F(groupby_memoization_test, DifferentAggregationsMissTheCache)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals{10, 20, 30, 40};
+  table_view keys_view({keys});
+
+  groupby::memoization::register_immutable(keys_view);
+
+  auto const sums = sum_aggregate(keys_view, vals);
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_min_aggregation<groupby_aggregation>());
+  groupby::groupby gb(keys_view);
+  auto const mins = gb.aggregate(requests);
+
+  fixed_width_column_wrapper<int64_t> expect_sums{40, 60};
+  fixed_width_column_wrapper<int32_t> expect_mins{10, 20};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_sums, sums.second[0].results[0]->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_mins, mins.second[0].results[0]->view());
+}
+
+TEST_F(groupby_memoization_test, DeregisterDropsEntries)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals{10, 20, 30, 40};
+  table_view keys_view({keys});
+
+  groupby::memoization::register_immutable(keys_view);
+  auto const cached = sum_aggregate(keys_view, vals);
+  groupby::memoization::deregister(keys_view);
+
+  // results computed after deregistration are still correct and no longer served from cache
+  auto const recomputed = sum_aggregate(keys_view, vals);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cached.first->view(), recomputed.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cached.second[0].results[0]->view(),
+                                 recomputed.second[0].results[0]->view());
+}
+
+TEST_F(groupby_memoization_test, CapacityEvicts)
+{
+  groupby::memoization::set_capacity(1);
+
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals1{1, 2, 3, 4};
+  fixed_width_column_wrapper<int32_t> vals2{5, 6, 7, 8};
+  table_view keys_view({keys});
+
+  groupby::memoization::register_immutable(keys_view);
+  auto const first  = sum_aggregate(keys_view, vals1);
+  auto const second = sum_aggregate(keys_view, vals2);  // evicts the first entry
+  auto const again  = sum_aggregate(keys_view, vals1);  // recomputed, not stale
+
+  fixed_width_column_wrapper<int64_t> expect_first{4, 6};
+  fixed_width_column_wrapper<int64_t> expect_second{12, 14};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_first, first.second[0].results[0]->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_second, second.second[0].results[0]->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_first, again.second[0].results[0]->view());
+
+  groupby::memoization::set_capacity(64);
+}
+
+}  // namespace test
+}  // namespace cudf
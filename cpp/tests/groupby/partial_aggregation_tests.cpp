@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+
+#include <functional>
+
+using namespace cudf::test::iterators;
+
+namespace cudf {
+namespace test {
+namespace {
+using agg_factory = std::function<std::unique_ptr<groupby_aggregation>()>;
+
+// Splits keys/values in two partitions, runs partial_aggregate on each,
+// concatenates the partial keys and states, and merges them.
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> run_partial_merge(
+  column_view const& keys,
+  column_view const& values,
+  agg_factory const& make_agg,
+  size_type split_point)
+{
+  auto const key_parts = cudf::slice(keys, {0, split_point, split_point, keys.size()});
+  auto const val_parts = cudf::slice(values, {0, split_point, split_point, values.size()});
+
+  std::vector<std::unique_ptr<table>> partial_keys;
+  std::vector<std::unique_ptr<column>> partial_states;
+  for (size_t part = 0; part < key_parts.size(); ++part) {
+    std::vector<groupby::aggregation_request> requests;
+    requests.emplace_back();
+    requests[0].values = val_parts[part];
+    requests[0].aggregations.push_back(make_agg());
+
+    groupby::groupby gb_obj(table_view({key_parts[part]}));
+    auto [part_keys, part_results] = gb_obj.partial_aggregate(requests);
+    partial_keys.push_back(std::move(part_keys));
+    partial_states.push_back(std::move(part_results[0].results[0]));
+  }
+
+  auto const all_keys = cudf::concatenate(
+    std::vector<table_view>{partial_keys[0]->view(), partial_keys[1]->view()});
+  auto const all_states = cudf::concatenate(
+    std::vector<column_view>{partial_states[0]->view(), partial_states[1]->view()});
+
+  std::vector<groupby::aggregation_request> merge_requests;
+  merge_requests.emplace_back();
+  merge_requests[0].values = all_states->view();
+  merge_requests[0].aggregations.push_back(make_agg());
+
+  groupby::groupby gb_merge(all_keys->view());
+  auto [merged_keys, merged_results] = gb_merge.merge_aggregate(merge_requests);
+  return {std::move(merged_keys), std::move(merged_results[0].results[0])};
+}
+
+// Compares the merged two-phase result against a single-pass aggregate over
+// the whole input, normalizing both to sorted key order.
+void expect_matches_single_pass(column_view const& keys,
+                                column_view const& values,
+                                agg_factory const& make_agg,
+                                size_type split_point)
+{
+  auto [got_keys, got_vals] = run_partial_merge(keys, values, make_agg, split_point);
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = values;
+  requests[0].aggregations.push_back(make_agg());
+  groupby::groupby gb_obj(table_view({keys}));
+  auto [expect_keys, expect_results] = gb_obj.aggregate(requests);
+
+  auto const sort_result = [](table_view const& result_keys, column_view const& result_vals) {
+    auto const order = sorted_order(result_keys, {}, {null_order::AFTER});
+    return std::make_pair(gather(result_keys, *order),
+                          gather(table_view({result_vals}), *order));
+  };
+  auto const [got_keys_sorted, got_vals_sorted] = sort_result(got_keys->view(), got_vals->view());
+  auto const [expect_keys_sorted, expect_vals_sorted] =
+    sort_result(expect_keys->view(), expect_results[0].results[0]->view());
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expect_keys_sorted, *got_keys_sorted);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals_sorted->get_column(0),
+                                      got_vals_sorted->get_column(0));
+}
+}  // namespace
+
+struct groupby_partial_aggregation_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_partial_aggregation_test, simple_aggregations)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  for (auto const& make_agg :
+       {agg_factory{[] { return cudf::make_sum_aggregation<groupby_aggregation>(); }},
+        agg_factory{[] { return cudf::make_min_aggregation<groupby_aggregation>(); }},
+        agg_factory{[] { return cudf::make_max_aggregation<groupby_aggregation>(); }},
+        agg_factory{[] { return cudf::make_count_aggregation<groupby_aggregation>(); }}}) {
+    expect_matches_single_pass(keys, vals, make_agg, 5);
+  }
+}
+
+TEST_F(groupby_partial_aggregation_test, mean)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<double> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  expect_matches_single_pass(
+    keys, vals, [] { return cudf::make_mean_aggregation<groupby_aggregation>(); }, 4);
+}
+
+TEST_F(groupby_partial_aggregation_test, variance_and_std)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<double> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  expect_matches_single_pass(
+    keys, vals, [] { return cudf::make_variance_aggregation<groupby_aggregation>(); }, 5);
+  expect_matches_single_pass(
+    keys, vals, [] { return cudf::make_std_aggregation<groupby_aggregation>(); }, 5);
+  expect_matches_single_pass(
+    keys, vals, [] { return cudf::make_m2_aggregation<groupby_aggregation>(); }, 5);
+}
+
+TEST_F(groupby_partial_aggregation_test, null_values)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<double> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                          {1, 1, 1, 0, 1, 1, 0, 1, 1, 1});
+
+  expect_matches_single_pass(
+    keys, vals, [] { return cudf::make_sum_aggregation<groupby_aggregation>(); }, 5);
+  expect_matches_single_pass(
+    keys, vals, [] { return cudf::make_count_aggregation<groupby_aggregation>(); }, 5);
+  expect_matches_single_pass(
+    keys, vals, [] { return cudf::make_mean_aggregation<groupby_aggregation>(); }, 5);
+}
+
+TEST_F(groupby_partial_aggregation_test, median)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 1, 2, 2, 2, 2};
+  fixed_width_column_wrapper<double> vals{10, 20, 30, 40, 1, 3, 5, 7};
+
+  auto [got_keys, got_vals] = run_partial_merge(
+    keys, vals, [] { return cudf::make_median_aggregation<groupby_aggregation>(); }, 4);
+
+  auto const order       = sorted_order(got_keys->view(), {}, {null_order::AFTER});
+  auto const sorted_vals = gather(table_view({got_vals->view()}), *order);
+  auto const host_vals   = to_host<double>(sorted_vals->get_column(0).view()).first;
+
+  // medians of {10, 20, 30, 40} and {1, 3, 5, 7}; tdigests of small groups are exact
+  ASSERT_EQ(host_vals.size(), 2u);
+  EXPECT_NEAR(host_vals[0], 25.0, 1e-6);
+  EXPECT_NEAR(host_vals[1], 4.0, 1e-6);
+}
+
+TEST_F(groupby_partial_aggregation_test, unsupported_aggregation_throws)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2};
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_nunique_aggregation<groupby_aggregation>());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.partial_aggregate(requests), cudf::logic_error);
+  EXPECT_THROW(gb_obj.merge_aggregate(requests), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
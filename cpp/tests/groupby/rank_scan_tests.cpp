@@ -427,6 +427,22 @@ TEST(groupby_rank_scan_test, strings)
   test_pair_rank_scans(keys, struct_order_with_nulls, expected_dense_vals, expected_rank_vals);
 }
 
+TEST_F(groupby_rank_scan_test, percent_rank)
+{
+  fixed_width_column_wrapper<uint32_t> keys{0, 0, 0, 0, 0, 1, 1, 1};
+  fixed_width_column_wrapper<uint32_t> order_col{1, 1, 2, 2, 3, 4, 4, 5};
+
+  fixed_width_column_wrapper<double> expected_percent_vals{0.0, 0.0, 0.5, 0.5, 1.0, 0.0, 0.0, 1.0};
+
+  test_single_scan(keys,
+                   order_col,
+                   keys,
+                   expected_percent_vals,
+                   make_percent_rank_aggregation<groupby_scan_aggregation>(),
+                   null_policy::INCLUDE,
+                   sorted::YES);
+}
+
 TEST_F(groupby_rank_scan_test_failures, test_exception_triggers)
 {
   using T = uint32_t;
@@ -56,6 +56,29 @@ TYPED_TEST(groupby_sum_test, basic)
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, low_cardinality_many_rows)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Enough rows over few groups for the hash groupby to take the shared
+  // memory pre-aggregation path
+  constexpr int num_rows   = 20000;
+  constexpr int num_groups = 4;
+
+  auto keys_begin = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<K>(i % num_groups); });
+  fixed_width_column_wrapper<K> keys(keys_begin, keys_begin + num_rows);
+  auto vals_begin = cudf::detail::make_counting_transform_iterator(0, [](auto) { return 1; });
+  fixed_width_column_wrapper<V, int> vals(vals_begin, vals_begin + num_rows);
+
+  fixed_width_column_wrapper<K> expect_keys{0, 1, 2, 3};
+  fixed_width_column_wrapper<R, int> expect_vals{5000, 5000, 5000, 5000};
+
+  auto agg = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
 TYPED_TEST(groupby_sum_test, empty_cols)
 {
   using V = TypeParam;
@@ -110,6 +133,26 @@ TYPED_TEST(groupby_sum_test, zero_valid_values)
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, zero_valid_values_many_groups)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // entirely-null values take the trivial-result path in both engines; the
+  // result must still have one null row per group
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 3};
+  fixed_width_column_wrapper<V> vals({3, 4, 5, 6, 7, 8}, all_nulls());
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<R> expect_vals({0, 0, 0}, all_nulls());
+
+  auto agg = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 TYPED_TEST(groupby_sum_test, null_keys_and_values)
 {
   using V = TypeParam;
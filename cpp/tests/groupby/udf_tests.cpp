@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+
+struct groupby_udf_test : public cudf::test::BaseFixture {
+  const std::string cuda_func{
+    R"***(
+      template <typename OutType, typename InType>
+      __device__ void CUDA_GENERIC_AGGREGATOR(OutType *ret, InType *in_col, cudf::size_type start,
+                                              cudf::size_type count) {
+        OutType val = 0;
+        for (cudf::size_type i = 0; i < count; i++) {
+          val += in_col[start + i];
+        }
+        *ret = val;
+      }
+    )***"};
+
+  const std::string ptx_func{
+    R"***(
+    //
+    // Generated by NVIDIA NVVM Compiler
+    //
+    // Compiler Build ID: CL-24817639
+    // Cuda compilation tools, release 10.0, V10.0.130
+    // Based on LLVM 3.4svn
+    //
+
+    .version 6.3
+    .target sm_70
+    .address_size 64
+
+    // .globl	_ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE
+    .common .global .align 8 .u64 _ZN08NumbaEnv8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE;
+
+    .visible .func  (.param .b32 func_retval0) _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE(
+    .param .b64 _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_0,
+    .param .b64 _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_1,
+    .param .b64 _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_2,
+    .param .b64 _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_3,
+    .param .b64 _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_4,
+    .param .b64 _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_5,
+    .param .b64 _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_6,
+    .param .b64 _ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_7
+    )
+    {
+    .reg .pred 	%p<3>;
+    .reg .b32 	%r<6>;
+    .reg .b64 	%rd<18>;
+
+
+    ld.param.u64 	%rd6, [_ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_0];
+    ld.param.u64 	%rd7, [_ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_5];
+    ld.param.u64 	%rd8, [_ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_6];
+    ld.param.u64 	%rd9, [_ZN8__main__7add$241E5ArrayIiLi1E1A7mutable7alignedE_paam_7];
+    mov.u64 	%rd15, 0;
+    mov.u64 	%rd16, %rd15;
+
+    BB0_1:
+    mov.u64 	%rd2, %rd16;
+    mov.u32 	%r5, 0;
+    setp.ge.s64	%p1, %rd15, %rd8;
+    mov.u64 	%rd17, %rd15;
+    @%p1 bra 	BB0_3;
+
+    mul.lo.s64 	%rd12, %rd15, %rd9;
+    add.s64 	%rd13, %rd12, %rd7;
+    ld.u32 	%r5, [%rd13];
+    add.s64 	%rd17, %rd15, 1;
+
+    BB0_3:
+    cvt.s64.s32	%rd14, %r5;
+    add.s64 	%rd16, %rd14, %rd2;
+    setp.lt.s64	%p2, %rd15, %rd8;
+    mov.u64 	%rd15, %rd17;
+    @%p2 bra 	BB0_1;
+
+    st.u64 	[%rd6], %rd2;
+    mov.u32 	%r4, 0;
+    st.param.b32	[func_retval0+0], %r4;
+    ret;
+    }
+    )***"};
+};
+
+TEST_F(groupby_udf_test, cuda_udf)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> expect_vals{9, 19, 17};
+
+  auto agg = cudf::make_udf_aggregation<groupby_aggregation>(
+    cudf::udf_type::CUDA, this->cuda_func, cudf::data_type{cudf::type_id::INT64});
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TEST_F(groupby_udf_test, ptx_udf)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> expect_vals{9, 19, 17};
+
+  auto agg = cudf::make_udf_aggregation<groupby_aggregation>(
+    cudf::udf_type::PTX, this->ptx_func, cudf::data_type{cudf::type_id::INT64});
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TEST_F(groupby_udf_test, values_with_nulls)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2};
+  fixed_width_column_wrapper<int32_t> vals{{0, 1, 2, 3, 4, 5}, {1, 1, 0, 1, 1, 1}};
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back(groupby::aggregation_request());
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_udf_aggregation<groupby_aggregation>(
+    cudf::udf_type::CUDA, this->cuda_func, cudf::data_type{cudf::type_id::INT64}));
+
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.aggregate(requests), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -451,6 +451,62 @@ TEST_F(SparkMurmurHash3Test, ListThrows)
     cudf::logic_error);
 }
 
+class XXHash64Test : public cudf::test::BaseFixture {
+};
+
+TEST_F(XXHash64Test, MultiValueWithSeeds)
+{
+  // Expected values computed with the reference xxHash implementation (XXH64)
+  fixed_width_column_wrapper<uint64_t> const strings_col_result({14076869737159367836ul,
+                                                                 17727514425473790601ul,
+                                                                 10220431020829739037ul,
+                                                                 5233279012148278091ul});
+  fixed_width_column_wrapper<uint64_t> const ints_col_result({3614696996920510707ul,
+                                                              10459001408622102323ul,
+                                                              8990748234399402673ul,
+                                                              2073849959933241805ul,
+                                                              1508894993788531228ul});
+
+  strings_column_wrapper const strings_col({"",
+                                            "The quick brown fox",
+                                            "jumps over the lazy dog.",
+                                            "All work and no play makes Jack a dull boy"});
+
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100, limits::min(), limits::max()});
+
+  constexpr auto hasher   = cudf::hash_id::HASH_XXHASH64;
+  auto const strings_hash = cudf::hash(cudf::table_view({strings_col}), hasher, {}, 314);
+  auto const ints_hash    = cudf::hash(cudf::table_view({ints_col}), hasher, {}, 42);
+
+  EXPECT_EQ(cudf::type_id::UINT64, strings_hash->type().id());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*strings_hash, strings_col_result, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*ints_hash, ints_col_result, verbosity);
+}
+
+TEST_F(XXHash64Test, EqualityWithNulls)
+{
+  // Null values are skipped by chaining the running hash, so differing unmasked
+  // values behind equal null masks must not change the row hash
+  fixed_width_column_wrapper<int32_t> const col1({0, 100, 0, -100}, {1, 0, 1, 0});
+  fixed_width_column_wrapper<int32_t> const col2({0, 200, 0, 200}, {1, 0, 1, 0});
+  strings_column_wrapper const strings1({"a", "b", "", "d"}, {1, 1, 0, 1});
+  strings_column_wrapper const strings2({"a", "b", "x", "d"}, {1, 1, 0, 1});
+
+  constexpr auto hasher = cudf::hash_id::HASH_XXHASH64;
+  auto const hash1      = cudf::hash(cudf::table_view({col1, strings1}), hasher, {});
+  auto const hash2      = cudf::hash(cudf::table_view({col2, strings2}), hasher, {});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*hash1, *hash2, verbosity);
+}
+
+TEST_F(XXHash64Test, ListThrows)
+{
+  lists_column_wrapper<cudf::string_view> strings_list_col({{""}, {"abc"}, {"123"}});
+  EXPECT_THROW(cudf::hash(cudf::table_view({strings_list_col}), cudf::hash_id::HASH_XXHASH64, {}),
+               cudf::logic_error);
+}
+
 class MD5HashTest : public cudf::test::BaseFixture {
 };
 
@@ -368,3 +368,52 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   // Verify that from_dlpack(to_dlpack(input)) == input
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
+
+TYPED_TEST(DLPackNumericTests, AdoptDlpackZeroCopy)
+{
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<TypeParam> col2({5, 6, 7, 8});
+  cudf::table_view input({col1, col2});
+
+  // to_dlpack produces a device-resident, column-contiguous tensor, so no copy is made
+  auto tensor        = cudf::to_dlpack(input);
+  auto const* data   = tensor->dl_tensor.data;
+  auto const adopted = cudf::adopt_dlpack(tensor);
+
+  EXPECT_TRUE(adopted->is_zero_copy());
+  EXPECT_EQ(adopted->view().column(0).template head<void>(), data);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, adopted->view());
+}
+
+TYPED_TEST(DLPackNumericTests, AdoptDlpackCpuFallsBackToCopy)
+{
+  using T         = TypeParam;
+  auto const data = cudf::test::make_type_param_vector<T>({1, 2, 3, 4, 5, 6, 7, 8});
+  int64_t shape[2]   = {4, 2};
+  int64_t strides[2] = {1, 4};
+
+  static bool deleter_called;
+  deleter_called = false;
+
+  DLManagedTensor tensor{};
+  tensor.dl_tensor.device.device_type = kDLCPU;
+  tensor.dl_tensor.dtype              = get_dtype<T>();
+  tensor.dl_tensor.ndim               = 2;
+  tensor.dl_tensor.shape              = shape;
+  tensor.dl_tensor.strides            = strides;
+  tensor.deleter                      = [](DLManagedTensor*) { deleter_called = true; };
+
+  thrust::host_vector<T> host_vector(data.begin(), data.end());
+  tensor.dl_tensor.data = host_vector.data();
+
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<TypeParam> col2({5, 6, 7, 8});
+  cudf::table_view expected({col1, col2});
+
+  auto const adopted = cudf::adopt_dlpack(&tensor);
+
+  EXPECT_FALSE(adopted->is_zero_copy());
+  // the copy fallback takes ownership too: the tensor is deleted once the copy completes
+  EXPECT_TRUE(deleter_called);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, adopted->view());
+}
@@ -481,6 +481,30 @@ TEST_F(ToArrowTest, FixedPointTableNulls)
   }
 }
 
+TEST_F(ToArrowTest, DeviceZeroCopyRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1.5, 2.5, 3.5, 4.5, 5.5});
+  auto owned    = std::make_shared<cudf::table>(cudf::table_view{{ints, doubles}});
+  auto expected = owned->view();
+
+  auto arrow_device_table = cudf::to_arrow_device(owned, {{"a"}, {"b"}});
+  EXPECT_EQ(2, arrow_device_table->num_columns());
+  EXPECT_EQ("a", arrow_device_table->field(0)->name());
+
+  // the arrays reference the cudf table's device memory directly
+  EXPECT_EQ(expected.column(0).head<uint8_t>(),
+            arrow_device_table->column(0)->chunk(0)->data()->buffers[1]->data());
+
+  auto roundtrip = cudf::from_arrow_device(*arrow_device_table);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, roundtrip);
+
+  // layouts that differ between cudf and arrow must be rejected, not reinterpreted
+  cudf::test::fixed_width_column_wrapper<bool> bools({true, false});
+  auto bool_table = std::make_shared<cudf::table>(cudf::table_view{{bools}});
+  EXPECT_THROW(cudf::to_arrow_device(bool_table), cudf::logic_error);
+}
+
 struct ToArrowTestSlice
   : public ToArrowTest,
     public ::testing::WithParamInterface<std::tuple<cudf::size_type, cudf::size_type>> {
@@ -2228,4 +2228,29 @@ TEST_F(CsvReaderTest, CsvDefaultOptionsWriteReadMatch)
   EXPECT_EQ(new_table_and_metadata.metadata.column_names[1], "1");
 }
 
+TEST_F(CsvReaderTest, PartialDtypeMap)
+{
+  auto filepath = temp_env->get_temp_dir() + "PartialDtypeMap.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "A,B,C\n1,1.5,one\n2,2.5,two\n3,3.5,three\n";
+  }
+
+  // hint only column A; B and C are inferred from the data
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath})
+      .dtypes(std::map<std::string, cudf::data_type>{{"A", dtype<int16_t>()}});
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(3, view.num_columns());
+  EXPECT_EQ(type_id::INT16, view.column(0).type().id());
+  EXPECT_EQ(type_id::FLOAT64, view.column(1).type().id());
+  EXPECT_EQ(type_id::STRING, view.column(2).type().id());
+
+  expect_column_data_equal(std::vector<int16_t>{1, 2, 3}, view.column(0));
+  expect_column_data_equal(std::vector<double>{1.5, 2.5, 3.5}, view.column(1));
+  expect_column_data_equal(std::vector<std::string>{"one", "two", "three"}, view.column(2));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
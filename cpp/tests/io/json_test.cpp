@@ -544,6 +544,36 @@ TEST_F(JsonReaderTest, JsonLinesObjectsStrings)
     "{\"col3\":\"bbb\", \"col1\":200, \"col2\":2.2}\n");
 }
 
+TEST_F(JsonReaderTest, JsonLinesNestedAsStrings)
+{
+  // Nested objects and lists are not split on their inner delimiters and are
+  // passed through whole, as strings
+  std::string const data =
+    "{\"col1\":100, \"col2\":{\"a\":1, \"b\":[1,2]}, \"col3\":[1,2,3]}\n"
+    "{\"col1\":200, \"col2\":{\"a\":2, \"b\":[3,4]}, \"col3\":[4,5,6]}\n";
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true);
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  EXPECT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.tbl->num_rows(), 2);
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(result.tbl->get_column(2).type().id(), cudf::type_id::STRING);
+
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_wrapper{{100, 200}, validity});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    result.tbl->get_column(1),
+    cudf::test::strings_column_wrapper({"{\"a\":1, \"b\":[1,2]}", "{\"a\":2, \"b\":[3,4]}"}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(2),
+                                 cudf::test::strings_column_wrapper({"[1,2,3]", "[4,5,6]"}));
+}
+
 TEST_F(JsonReaderTest, JsonLinesObjectsMissingData)
 {
   // Note: columns will be ordered based on which fields appear first
@@ -22,6 +22,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -517,6 +518,31 @@ TEST_F(OrcWriterTest, Strings)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(OrcWriterTest, HighCardinalityStrings)
+{
+  // All strings are unique, so dictionary encoding is disabled by the cardinality cutoff
+  constexpr auto num_rows = 10000;
+
+  std::vector<std::string> strings(num_rows);
+  std::generate(strings.begin(), strings.end(), [i = 0]() mutable {
+    return "unique_string_" + std::to_string(i++);
+  });
+  column_wrapper<cudf::string_view> col0{strings.begin(), strings.end()};
+
+  table_view expected({col0});
+
+  auto filepath = temp_env->get_temp_filepath("OrcHighCardinalityStrings.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).use_index(false);
+  auto result = cudf_io::read_orc(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(OrcWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offsetted views into existing cudf tables
@@ -1097,6 +1123,102 @@ TEST_F(OrcReaderTest, SingleInputs)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *table1);
 }
 
+TEST_F(OrcReaderTest, CachedFooterReread)
+{
+  // the second read of an unchanged file reuses the cached footer parse; rewriting the file
+  // changes its identity and must invalidate the cached entry
+  column_wrapper<int32_t> c0{1, 2, 3, 4};
+  table_view original({c0});
+
+  auto filepath = temp_env->get_temp_filepath("CachedFooterReread.orc");
+  cudf_io::orc_writer_options write_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, original);
+  cudf_io::write_orc(write_opts);
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{{filepath}});
+  auto const first  = cudf_io::read_orc(read_opts);
+  auto const second = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(original, second.tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(first.tbl->view(), second.tbl->view());
+
+  column_wrapper<int32_t> c1{10, 20, 30, 40, 50, 60};
+  table_view rewritten({c1});
+  cudf_io::orc_writer_options rewrite_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, rewritten);
+  cudf_io::write_orc(rewrite_opts);
+
+  auto const third = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(rewritten, third.tbl->view());
+}
+
+TEST_F(OrcReaderTest, ReadInto)
+{
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  column_wrapper<int32_t> c0{{1, 2, 3, 4, 5, 6}, valids};
+  column_wrapper<double> c1{{1.5, 2.5, 3.5, 4.5, 5.5, 6.5}};
+  table_view expected({c0, c1});
+
+  auto filepath = temp_env->get_temp_filepath("OrcReadInto.orc");
+  cudf_io::orc_writer_options write_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_orc(write_opts);
+
+  // decode into pre-allocated columns of the same shape
+  std::vector<std::unique_ptr<cudf::column>> dest_columns;
+  dest_columns.push_back(cudf::allocate_like(c0, cudf::mask_allocation_policy::ALWAYS));
+  dest_columns.push_back(cudf::allocate_like(c1, cudf::mask_allocation_policy::ALWAYS));
+  cudf::table dest(std::move(dest_columns));
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{{filepath}});
+  cudf_io::read_orc_into(read_opts, dest);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, dest.view());
+}
+
+TEST_F(OrcReaderTest, ReadIntoErrors)
+{
+  column_wrapper<int32_t> c0{1, 2, 3, 4};
+  table_view expected({c0});
+
+  auto filepath = temp_env->get_temp_filepath("OrcReadIntoErrors.orc");
+  cudf_io::orc_writer_options write_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_orc(write_opts);
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{{filepath}});
+
+  // mismatched type
+  {
+    column_wrapper<double> wrong_type{1.0, 2.0, 3.0, 4.0};
+    std::vector<std::unique_ptr<cudf::column>> cols;
+    cols.push_back(cudf::allocate_like(wrong_type, cudf::mask_allocation_policy::ALWAYS));
+    cudf::table dest(std::move(cols));
+    EXPECT_THROW(cudf_io::read_orc_into(read_opts, dest), cudf::logic_error);
+  }
+
+  // mismatched column count
+  {
+    std::vector<std::unique_ptr<cudf::column>> cols;
+    cols.push_back(cudf::allocate_like(c0, cudf::mask_allocation_policy::ALWAYS));
+    cols.push_back(cudf::allocate_like(c0, cudf::mask_allocation_policy::ALWAYS));
+    cudf::table dest(std::move(cols));
+    EXPECT_THROW(cudf_io::read_orc_into(read_opts, dest), cudf::logic_error);
+  }
+
+  // mismatched row count
+  {
+    column_wrapper<int32_t> too_small{1, 2};
+    std::vector<std::unique_ptr<cudf::column>> cols;
+    cols.push_back(cudf::allocate_like(too_small, cudf::mask_allocation_policy::ALWAYS));
+    cudf::table dest(std::move(cols));
+    EXPECT_THROW(cudf_io::read_orc_into(read_opts, dest), cudf::logic_error);
+  }
+}
+
 TEST_F(OrcReaderTest, MultipleInputs)
 {
   srand(31537);
@@ -1126,6 +1248,31 @@ TEST_F(OrcReaderTest, MultipleInputs)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(OrcReaderTest, FilterStripesWithStatistics)
+{
+  // Two stripes with disjoint value ranges; the filter should prune the second
+  auto low_col  = column_wrapper<int32_t>{0, 1, 2, 3};
+  auto low_tbl  = table_view{{low_col}};
+  auto high_col = column_wrapper<int32_t>{100, 101, 102, 103};
+  auto high_tbl = table_view{{high_col}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterStripes.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(low_tbl).write(high_tbl);
+
+  auto literal_value = cudf::numeric_scalar<int32_t>(10);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref       = cudf::ast::column_reference(0);
+  auto predicate     = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, literal);
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(predicate);
+  auto result = cudf_io::read_orc(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, low_tbl);
+}
+
 struct OrcWriterTestDecimal : public OrcWriterTest,
                               public ::testing::WithParamInterface<std::tuple<int, int>> {
 };
@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
@@ -226,6 +229,10 @@ TYPED_TEST_SUITE(ParquetWriterChronoTypeTest, SupportedChronoTypes);
 using SupportedTimestampTypes = cudf::test::Types<cudf::timestamp_ms, cudf::timestamp_us>;
 TYPED_TEST_SUITE(ParquetWriterTimestampTypeTest, SupportedTimestampTypes);
 
+// Base test fixture for chunked reader tests
+struct ParquetChunkedReaderTest : public cudf::test::BaseFixture {
+};
+
 // Base test fixture for chunked writer tests
 struct ParquetChunkedWriterTest : public cudf::test::BaseFixture {
 };
@@ -415,6 +422,9 @@ TEST_F(ParquetWriterTest, MultiColumn)
   auto col7_data = cudf::detail::make_counting_transform_iterator(0, [col7_vals](auto i) {
     return numeric::decimal64{col7_vals[i], numeric::scale_type{-5}};
   });
+  auto col8_data = cudf::detail::make_counting_transform_iterator(0, [col7_vals](auto i) {
+    return numeric::decimal128{col7_vals[i], numeric::scale_type{-6}};
+  });
   auto validity  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
 
   // column_wrapper<bool> col0{
@@ -426,6 +436,7 @@ TEST_F(ParquetWriterTest, MultiColumn)
   column_wrapper<double> col5{col5_data.begin(), col5_data.end(), validity};
   column_wrapper<numeric::decimal32> col6{col6_data, col6_data + num_rows, validity};
   column_wrapper<numeric::decimal64> col7{col7_data, col7_data + num_rows, validity};
+  column_wrapper<numeric::decimal128> col8{col8_data, col8_data + num_rows, validity};
 
   std::vector<std::unique_ptr<column>> cols;
   // cols.push_back(col0.release());
@@ -436,8 +447,9 @@ TEST_F(ParquetWriterTest, MultiColumn)
   cols.push_back(col5.release());
   cols.push_back(col6.release());
   cols.push_back(col7.release());
+  cols.push_back(col8.release());
   auto expected = std::make_unique<table>(std::move(cols));
-  EXPECT_EQ(7, expected->num_columns());
+  EXPECT_EQ(8, expected->num_columns());
 
   cudf_io::table_input_metadata expected_metadata(*expected);
   // expected_metadata.column_metadata[0].set_name( "bools");
@@ -448,6 +460,7 @@ TEST_F(ParquetWriterTest, MultiColumn)
   expected_metadata.column_metadata[4].set_name("doubles");
   expected_metadata.column_metadata[5].set_name("decimal32s").set_decimal_precision(10);
   expected_metadata.column_metadata[6].set_name("decimal64s").set_decimal_precision(20);
+  expected_metadata.column_metadata[7].set_name("decimal128s").set_decimal_precision(38);
 
   auto filepath = temp_env->get_temp_filepath("MultiColumn.parquet");
   cudf_io::parquet_writer_options out_opts =
@@ -481,6 +494,9 @@ TEST_F(ParquetWriterTest, MultiColumnWithNulls)
   auto col7_data = cudf::detail::make_counting_transform_iterator(0, [col7_vals](auto i) {
     return numeric::decimal64{col7_vals[i], numeric::scale_type{-8}};
   });
+  auto col8_data = cudf::detail::make_counting_transform_iterator(0, [col7_vals](auto i) {
+    return numeric::decimal128{col7_vals[i], numeric::scale_type{-9}};
+  });
   // auto col0_mask = cudf::detail::make_counting_transform_iterator(
   //    0, [](auto i) { return (i % 2); });
   auto col1_mask =
@@ -496,6 +512,8 @@ TEST_F(ParquetWriterTest, MultiColumnWithNulls)
     cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i % 5); });
   auto col7_mask =
     cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i != 55); });
+  auto col8_mask =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i % 3); });
 
   // column_wrapper<bool> col0{
   //    col0_data.begin(), col0_data.end(), col0_mask};
@@ -506,6 +524,7 @@ TEST_F(ParquetWriterTest, MultiColumnWithNulls)
   column_wrapper<double> col5{col5_data.begin(), col5_data.end(), col5_mask};
   column_wrapper<numeric::decimal32> col6{col6_data, col6_data + num_rows, col6_mask};
   column_wrapper<numeric::decimal64> col7{col7_data, col7_data + num_rows, col7_mask};
+  column_wrapper<numeric::decimal128> col8{col8_data, col8_data + num_rows, col8_mask};
 
   std::vector<std::unique_ptr<column>> cols;
   // cols.push_back(col0.release());
@@ -516,8 +535,9 @@ TEST_F(ParquetWriterTest, MultiColumnWithNulls)
   cols.push_back(col5.release());
   cols.push_back(col6.release());
   cols.push_back(col7.release());
+  cols.push_back(col8.release());
   auto expected = std::make_unique<table>(std::move(cols));
-  EXPECT_EQ(7, expected->num_columns());
+  EXPECT_EQ(8, expected->num_columns());
 
   cudf_io::table_input_metadata expected_metadata(*expected);
   // expected_metadata.column_names.emplace_back("bools");
@@ -528,6 +548,7 @@ TEST_F(ParquetWriterTest, MultiColumnWithNulls)
   expected_metadata.column_metadata[4].set_name("doubles");
   expected_metadata.column_metadata[5].set_name("decimal32s").set_decimal_precision(9);
   expected_metadata.column_metadata[6].set_name("decimal64s").set_decimal_precision(20);
+  expected_metadata.column_metadata[7].set_name("decimal128s").set_decimal_precision(38);
 
   auto filepath = temp_env->get_temp_filepath("MultiColumnWithNulls.parquet");
   cudf_io::parquet_writer_options out_opts =
@@ -879,6 +900,83 @@ TEST_F(ParquetWriterTest, HostBuffer)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(ParquetWriterTest, ByteStreamSplit)
+{
+  // Random (non-dictionary-encodable) floating point columns written with compression are
+  // stored byte-stream-split
+  constexpr auto num_rows = 50000;
+  auto floats             = random_values<float>(num_rows);
+  auto doubles            = random_values<double>(num_rows);
+  const auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  column_wrapper<float> col0{floats.begin(), floats.end(), validity};
+  column_wrapper<double> col1{doubles.begin(), doubles.end(), validity};
+  table_view expected({col0, col1});
+
+  auto filepath = temp_env->get_temp_filepath("ByteStreamSplit.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, SkipCompression)
+{
+  // High-entropy columns can opt out of compression per column; their chunks are written
+  // uncompressed even when the file-level compression is enabled
+  constexpr auto num_rows = 50000;
+  auto ints               = random_values<int>(num_rows);
+  auto doubles            = random_values<double>(num_rows);
+  column_wrapper<int> col0{ints.begin(), ints.end()};
+  column_wrapper<double> col1{doubles.begin(), doubles.end()};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  cudf_io::table_input_metadata expected_metadata(*expected);
+  expected_metadata.column_metadata[1].set_skip_compression(true);
+
+  auto filepath = temp_env->get_temp_filepath("SkipCompression.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected->view())
+      .metadata(&expected_metadata)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, WritePipelineDepth)
+{
+  srand(31337);
+  // Several row groups' worth of rows so that more than one write batch is exercised
+  auto expected = create_random_fixed_table<int>(2, 3 * 1024 * 1024, false);
+
+  auto filepath = temp_env->get_temp_filepath("WritePipelineDepth.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, *expected)
+      .write_pipeline_depth(3);
+  cudf_io::write_parquet(args);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -1219,6 +1317,136 @@ TEST_F(ParquetWriterTest, Slice)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(read_table.tbl->view(), tbl);
 }
 
+TEST_F(ParquetReaderTest, FilterRowGroupsWithStatistics)
+{
+  // Two row groups with disjoint value ranges; the filter should prune the second
+  auto low_col  = column_wrapper<int32_t>{0, 1, 2, 3};
+  auto low_tbl  = table_view{{low_col}};
+  auto high_col = column_wrapper<int32_t>{100, 101, 102, 103};
+  auto high_tbl = table_view{{high_col}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterRowGroups.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(low_tbl).write(high_tbl);
+
+  auto literal_value = cudf::numeric_scalar<int32_t>(10);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref       = cudf::ast::column_reference(0);
+  auto predicate     = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, literal);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(predicate);
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, low_tbl);
+}
+
+TEST_F(ParquetReaderTest, FilterRowGroupsWithBloomFilter)
+{
+  // Two row groups with overlapping value ranges so that min/max statistics alone cannot
+  // prune either; the second group's bloom filter proves it cannot contain the literal
+  auto first_col  = column_wrapper<int32_t>{1, 5, 9, 1000};
+  auto first_tbl  = table_view{{first_col}};
+  auto second_col = column_wrapper<int32_t>{2, 6, 10, 999};
+  auto second_tbl = table_view{{second_col}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterRowGroupsBloom.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(first_tbl).write(second_tbl);
+
+  auto literal_value = cudf::numeric_scalar<int32_t>(5);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref       = cudf::ast::column_reference(0);
+  auto predicate     = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, literal);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(predicate);
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, first_tbl);
+}
+
+TEST_F(ParquetReaderTest, ReadMetadata)
+{
+  auto int_col = column_wrapper<int32_t>{1, 2, 3, 4};
+  auto str_col = cudf::test::strings_column_wrapper{"a", "b", "c", "d"};
+  auto tbl     = table_view{{int_col, str_col}};
+
+  cudf_io::table_input_metadata input_metadata(tbl);
+  input_metadata.column_metadata[0].set_name("ints");
+  input_metadata.column_metadata[1].set_name("strings");
+
+  auto filepath = temp_env->get_temp_filepath("ReadMetadata.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, tbl)
+      .metadata(&input_metadata);
+  cudf_io::write_parquet(out_opts);
+
+  auto const metadata = cudf_io::read_parquet_metadata(cudf_io::source_info{filepath});
+  ASSERT_EQ(metadata.size(), 1);
+  EXPECT_EQ(metadata[0].num_rows, 4);
+  EXPECT_EQ(metadata[0].num_row_groups, 1);
+  ASSERT_EQ(metadata[0].column_names.size(), 2);
+  EXPECT_EQ(metadata[0].column_names[0], "ints");
+  EXPECT_EQ(metadata[0].column_names[1], "strings");
+  ASSERT_EQ(metadata[0].row_group_num_rows.size(), 1);
+  EXPECT_EQ(metadata[0].row_group_num_rows[0], 4);
+}
+
+TEST_F(ParquetChunkedReaderTest, SingleChunk)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(5, 256, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReaderSingle.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, *expected);
+  cudf_io::write_parquet(args);
+
+  // A zero limit means unbounded, so everything comes back in one chunk
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto reader = cudf_io::chunked_parquet_reader(0, read_opts);
+
+  EXPECT_TRUE(reader.has_next());
+  auto result = reader.read_chunk();
+  EXPECT_FALSE(reader.has_next());
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+}
+
+TEST_F(ParquetChunkedReaderTest, MultipleChunks)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 256, true);
+  auto table2 = create_random_fixed_table<int>(5, 256, true);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2}));
+
+  // Write two row groups so a tiny budget forces one chunk per row group
+  auto filepath = temp_env->get_temp_filepath("ChunkedReaderMultiple.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto reader = cudf_io::chunked_parquet_reader(1, read_opts);
+
+  std::vector<std::unique_ptr<table>> chunks;
+  std::vector<table_view> chunk_views;
+  while (reader.has_next()) {
+    chunks.push_back(std::move(reader.read_chunk().tbl));
+    chunk_views.push_back(*chunks.back());
+  }
+  EXPECT_EQ(chunks.size(), 2);
+
+  auto result = cudf::concatenate(chunk_views);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result, *full_table);
+}
+
 TEST_F(ParquetChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -1308,6 +1536,43 @@ TEST_F(ParquetChunkedWriterTest, ManyTables)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
 }
 
+TEST_F(ParquetChunkedWriterTest, CoalescedRowGroups)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<table>> tables;
+  std::vector<table_view> table_views;
+  constexpr int num_tables = 24;
+  for (int idx = 0; idx < num_tables; idx++) {
+    auto tbl = create_random_fixed_table<int>(4, 64, true);
+    table_views.push_back(*tbl);
+    tables.push_back(std::move(tbl));
+  }
+
+  auto expected = cudf::concatenate(table_views);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedCoalesced.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath})
+      .target_row_group_rows(512);
+  cudf_io::parquet_chunked_writer writer(args);
+  std::for_each(table_views.begin(), table_views.end(), [&writer](table_view const& tbl) {
+    writer.write(tbl);
+  });
+  writer.close();
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  // the 64-row batches must have been coalesced: the first row group holds a full
+  // target's worth of rows, not one batch
+  cudf_io::parquet_reader_options rg_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).row_groups({{0}});
+  auto first_row_group = cudf_io::read_parquet(rg_opts);
+  EXPECT_EQ(first_row_group.tbl->num_rows(), 512);
+}
+
 TEST_F(ParquetChunkedWriterTest, Strings)
 {
   std::vector<std::unique_ptr<cudf::column>> cols;
@@ -3016,7 +3281,37 @@ TEST_F(ParquetReaderTest, DecimalRead)
     cudf::test::expect_columns_equal(result.tbl->view().column(1), col1);
 
     read_opts.set_columns({"dec20p1"});
-    EXPECT_THROW(cudf_io::read_parquet(read_opts), cudf::logic_error);
+    result = cudf_io::read_parquet(read_opts);
+    EXPECT_EQ(result.tbl->view().num_columns(), 1);
+
+    auto validity_c2 = cudf::detail::make_counting_transform_iterator(
+      0, [](auto i) { return i != 6 and i != 14; });
+    __int128_t col2_data[] = {9078697037144433659,
+                              9050770539577117612,
+                              2358363961733893636,
+                              1566059559232276662,
+                              6658306200002735268,
+                              4967909073046397334,
+                              0,
+                              7235588493887532473,
+                              5023160741463849572,
+                              2765173712965988273,
+                              3880866513515749646,
+                              5019704400576359500,
+                              5544435986818825655,
+                              7265381725809874549,
+                              0,
+                              1576192427381240677,
+                              2828305195087094598,
+                              260308667809395171,
+                              2460080200895288476,
+                              2718441925197820439};
+
+    EXPECT_EQ(static_cast<std::size_t>(result.tbl->view().column(0).size()),
+              sizeof(col2_data) / sizeof(col2_data[0]));
+    cudf::test::fixed_point_column_wrapper<__int128_t> col2(
+      std::begin(col2_data), std::end(col2_data), validity_c2, numeric::scale_type{-1});
+    cudf::test::expect_columns_equal(result.tbl->view().column(0), col2);
   }
 }
 
@@ -3056,4 +3351,226 @@ TEST_F(ParquetReaderTest, EmptyOutput)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(ParquetReaderTest, NestedColumnSelection)
+{
+  // struct<a, b, c>; selecting a single leaf must only decode that leaf
+  auto a = column_wrapper<int32_t>{1, 2, 3, 4};
+  auto b = column_wrapper<double>{1.5, 2.5, 3.5, 4.5};
+  auto c = column_wrapper<int64_t>{10, 20, 30, 40};
+  auto s = cudf::test::structs_column_wrapper{{a, b, c}};
+  table_view expected({s});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("s");
+  expected_metadata.column_metadata[0].child(0).set_name("a");
+  expected_metadata.column_metadata[0].child(1).set_name("b");
+  expected_metadata.column_metadata[0].child(2).set_name("c");
+
+  auto filepath = temp_env->get_temp_filepath("NestedColumnSelection.parquet");
+  cudf_io::parquet_writer_options out_args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  out_args.set_metadata(&expected_metadata);
+  cudf_io::write_parquet(out_args);
+
+  // select one leaf out of the struct
+  cudf_io::parquet_reader_options read_args =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .columns({"s.b"});
+  auto const result = cudf_io::read_parquet(read_args);
+
+  // output is the struct containing only the selected child
+  EXPECT_EQ(result.tbl->view().num_columns(), 1);
+  auto const read_struct = result.tbl->view().column(0);
+  EXPECT_EQ(read_struct.type().id(), cudf::type_id::STRUCT);
+  EXPECT_EQ(read_struct.num_children(), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(b, read_struct.child(0));
+  ASSERT_EQ(result.metadata.schema_info.size(), std::size_t{1});
+  EXPECT_EQ(result.metadata.schema_info[0].name, "s");
+  ASSERT_EQ(result.metadata.schema_info[0].children.size(), std::size_t{1});
+  EXPECT_EQ(result.metadata.schema_info[0].children[0].name, "b");
+}
+
+TEST_F(ParquetReaderTest, NestedColumnSubtreeSelection)
+{
+  // selecting an inner node selects its whole subtree
+  auto f1    = column_wrapper<int32_t>{1, 2, 3};
+  auto f2    = column_wrapper<int32_t>{4, 5, 6};
+  auto inner = cudf::test::structs_column_wrapper{{f1, f2}};
+  auto other = column_wrapper<double>{0.5, 1.5, 2.5};
+  auto outer = cudf::test::structs_column_wrapper{{inner, other}};
+  table_view expected({outer});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("outer");
+  expected_metadata.column_metadata[0].child(0).set_name("inner");
+  expected_metadata.column_metadata[0].child(0).child(0).set_name("f1");
+  expected_metadata.column_metadata[0].child(0).child(1).set_name("f2");
+  expected_metadata.column_metadata[0].child(1).set_name("other");
+
+  auto filepath = temp_env->get_temp_filepath("NestedColumnSubtreeSelection.parquet");
+  cudf_io::parquet_writer_options out_args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  out_args.set_metadata(&expected_metadata);
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::parquet_reader_options read_args =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .columns({"outer.inner"});
+  auto const result = cudf_io::read_parquet(read_args);
+
+  auto const read_outer = result.tbl->view().column(0);
+  EXPECT_EQ(read_outer.num_children(), 1);
+  auto const read_inner = read_outer.child(0);
+  EXPECT_EQ(read_inner.num_children(), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(f1, read_inner.child(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(f2, read_inner.child(1));
+}
+
+TEST_F(ParquetReaderTest, CachedFooterReread)
+{
+  // the second read of an unchanged file reuses the cached footer parse; rewriting the file
+  // changes its identity and must invalidate the cached entry
+  column_wrapper<int32_t> c0{1, 2, 3, 4};
+  table_view original({c0});
+
+  auto filepath = temp_env->get_temp_filepath("CachedFooterReread.parquet");
+  cudf_io::parquet_writer_options out_args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, original);
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::parquet_reader_options read_args =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto const first  = cudf_io::read_parquet(read_args);
+  auto const second = cudf_io::read_parquet(read_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(original, second.tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(first.tbl->view(), second.tbl->view());
+
+  column_wrapper<int32_t> c1{10, 20, 30, 40, 50, 60};
+  table_view rewritten({c1});
+  cudf_io::parquet_writer_options rewrite_args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, rewritten);
+  cudf_io::write_parquet(rewrite_args);
+
+  auto const third = cudf_io::read_parquet(read_args);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(rewritten, third.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, ReadInto)
+{
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  column_wrapper<int32_t> c0{{1, 2, 3, 4, 5, 6}, valids};
+  column_wrapper<double> c1{{1.5, 2.5, 3.5, 4.5, 5.5, 6.5}};
+  table_view expected({c0, c1});
+
+  auto filepath = temp_env->get_temp_filepath("ReadInto.parquet");
+  cudf_io::parquet_writer_options out_args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(out_args);
+
+  // decode into pre-allocated columns of the same shape
+  std::vector<std::unique_ptr<cudf::column>> dest_columns;
+  dest_columns.push_back(cudf::allocate_like(c0, cudf::mask_allocation_policy::ALWAYS));
+  dest_columns.push_back(cudf::allocate_like(c1, cudf::mask_allocation_policy::ALWAYS));
+  cudf::table dest(std::move(dest_columns));
+
+  cudf_io::parquet_reader_options read_args =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  cudf_io::read_parquet_into(read_args, dest);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, dest.view());
+}
+
+TEST_F(ParquetReaderTest, ReadIntoErrors)
+{
+  column_wrapper<int32_t> c0{1, 2, 3, 4};
+  table_view expected({c0});
+
+  auto filepath = temp_env->get_temp_filepath("ReadIntoErrors.parquet");
+  cudf_io::parquet_writer_options out_args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::parquet_reader_options read_args =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+
+  // mismatched type
+  {
+    column_wrapper<double> wrong_type{1.0, 2.0, 3.0, 4.0};
+    std::vector<std::unique_ptr<cudf::column>> cols;
+    cols.push_back(cudf::allocate_like(wrong_type, cudf::mask_allocation_policy::ALWAYS));
+    cudf::table dest(std::move(cols));
+    EXPECT_THROW(cudf_io::read_parquet_into(read_args, dest), cudf::logic_error);
+  }
+
+  // mismatched column count
+  {
+    std::vector<std::unique_ptr<cudf::column>> cols;
+    cols.push_back(cudf::allocate_like(c0, cudf::mask_allocation_policy::ALWAYS));
+    cols.push_back(cudf::allocate_like(c0, cudf::mask_allocation_policy::ALWAYS));
+    cudf::table dest(std::move(cols));
+    EXPECT_THROW(cudf_io::read_parquet_into(read_args, dest), cudf::logic_error);
+  }
+
+  // mismatched row count
+  {
+    column_wrapper<int32_t> too_small{1, 2};
+    std::vector<std::unique_ptr<cudf::column>> cols;
+    cols.push_back(cudf::allocate_like(too_small, cudf::mask_allocation_policy::ALWAYS));
+    cudf::table dest(std::move(cols));
+    EXPECT_THROW(cudf_io::read_parquet_into(read_args, dest), cudf::logic_error);
+  }
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionaries)
+{
+  constexpr auto num_rows = 100;
+  auto const choices      = std::vector<char const*>{"apple", "banana", "cherry"};
+  auto elements           = cudf::detail::make_counting_transform_iterator(
+    0, [&](auto i) { return choices[i % choices.size()]; });
+  cudf::test::strings_column_wrapper col(elements, elements + num_rows);
+  table_view expected({col});
+
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionaries.parquet");
+  cudf_io::parquet_writer_options out_args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::parquet_reader_options read_args =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .convert_strings_to_dictionaries(true);
+  auto result = cudf_io::read_parquet(read_args);
+
+  auto const& result_col = result.tbl->view().column(0);
+  ASSERT_EQ(result_col.type().id(), cudf::type_id::DICTIONARY32);
+  auto const decoded = cudf::dictionary::decode(cudf::dictionary_column_view(result_col));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, col);
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionariesWithNulls)
+{
+  constexpr auto num_rows = 100;
+  auto const choices      = std::vector<char const*>{"apple", "banana", "cherry"};
+  auto elements           = cudf::detail::make_counting_transform_iterator(
+    0, [&](auto i) { return choices[i % choices.size()]; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  cudf::test::strings_column_wrapper col(elements, elements + num_rows, validity);
+  table_view expected({col});
+
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionariesWithNulls.parquet");
+  cudf_io::parquet_writer_options out_args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::parquet_reader_options read_args =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .convert_strings_to_dictionaries(true);
+  auto result = cudf_io::read_parquet(read_args);
+
+  auto const& result_col = result.tbl->view().column(0);
+  ASSERT_EQ(result_col.type().id(), cudf::type_id::DICTIONARY32);
+  auto const decoded = cudf::dictionary::decode(cudf::dictionary_column_view(result_col));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, col);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+struct PartitionForWriteTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PartitionForWriteTest, FixedWidthDeterministicSlices)
+{
+  std::vector<int64_t> values(1000);
+  std::iota(values.begin(), values.end(), 0);
+  cudf::test::fixed_width_column_wrapper<int64_t> col(values.begin(), values.end());
+  cudf::table_view input({col});
+
+  // 1000 rows x 8 bytes against a 1000 byte budget yields 8 slices of 125 rows
+  auto const partitions = cudf::io::partition_for_write(input, 1000);
+
+  EXPECT_EQ(partitions.size(), std::size_t{8});
+  for (auto const& partition : partitions) {
+    EXPECT_EQ(partition.num_rows(), 125);
+  }
+
+  auto const rebuilt = cudf::concatenate(partitions);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(rebuilt->view(), input);
+}
+
+TEST_F(PartitionForWriteTest, StringsAccountForCharacterBytes)
+{
+  // identical row counts but wildly different character payloads
+  std::vector<std::string> strings;
+  for (int i = 0; i < 100; i++) {
+    strings.push_back(std::string(i < 50 ? 4 : 400, 'x'));
+  }
+  cudf::test::strings_column_wrapper col(strings.begin(), strings.end());
+  cudf::table_view input({col});
+
+  auto const partitions = cudf::io::partition_for_write(input, 4000);
+
+  EXPECT_GT(partitions.size(), std::size_t{1});
+  for (auto const& partition : partitions) {
+    EXPECT_GT(partition.num_rows(), 0);
+  }
+
+  // the short-string half must be packed far more densely than the long half
+  EXPECT_GT(partitions.front().num_rows(), partitions.back().num_rows());
+
+  auto const rebuilt = cudf::concatenate(partitions);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(rebuilt->view(), input);
+}
+
+TEST_F(PartitionForWriteTest, OversizedRowsGetOwnPartition)
+{
+  std::vector<std::string> strings{"a", std::string(1000, 'y'), "b", std::string(1000, 'z'), "c"};
+  cudf::test::strings_column_wrapper col(strings.begin(), strings.end());
+  cudf::table_view input({col});
+
+  // every long row blows the budget on its own; no partition may come out empty
+  auto const partitions = cudf::io::partition_for_write(input, 100);
+
+  for (auto const& partition : partitions) {
+    EXPECT_GT(partition.num_rows(), 0);
+  }
+
+  auto const rebuilt = cudf::concatenate(partitions);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(rebuilt->view(), input);
+}
+
+TEST_F(PartitionForWriteTest, LargeBudgetReturnsSingleView)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4, 5});
+  cudf::table_view input({col});
+
+  auto const partitions = cudf::io::partition_for_write(input, std::size_t{1} << 30);
+
+  EXPECT_EQ(partitions.size(), std::size_t{1});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(partitions.front(), input);
+}
+
+TEST_F(PartitionForWriteTest, EmptyAndErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_col{};
+  cudf::table_view empty_input({empty_col});
+
+  auto const partitions = cudf::io::partition_for_write(empty_input, 1024);
+  EXPECT_EQ(partitions.size(), std::size_t{1});
+  EXPECT_EQ(partitions.front().num_rows(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3});
+  cudf::table_view input({col});
+  EXPECT_THROW(cudf::io::partition_for_write(input, 0), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
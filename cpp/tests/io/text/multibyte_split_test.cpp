@@ -81,6 +81,27 @@ TEST_F(MultibyteSplitTest, LargeInput)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
 }
 
+TEST_F(MultibyteSplitTest, MultipleSources)
+{
+  auto delimiter   = std::string(":");
+  auto host_inputs = std::vector<std::string>{"abc:def:", "x:yy:zzz", ":::", "no delimiter here"};
+
+  auto sources      = std::vector<std::unique_ptr<cudf::io::text::data_chunk_source>>();
+  auto source_views = std::vector<cudf::io::text::data_chunk_source const*>();
+  for (auto const& host_input : host_inputs) {
+    sources.emplace_back(cudf::io::text::make_source(host_input));
+    source_views.push_back(sources.back().get());
+  }
+
+  auto outputs = cudf::io::text::multibyte_split(source_views, delimiter);
+
+  ASSERT_EQ(outputs.size(), host_inputs.size());
+  for (std::size_t i = 0; i < source_views.size(); i++) {
+    auto expected = cudf::io::text::multibyte_split(*source_views[i], delimiter);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *outputs[i]);
+  }
+}
+
 TEST_F(MultibyteSplitTest, OverlappingMatchErasure)
 {
   auto delimiter = "::";
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct AsofJoinTest : public cudf::test::BaseFixture {
+  // Materializes the matched right rows so unmatched left rows show up as nulls
+  static std::unique_ptr<cudf::table> gather_matches(
+    cudf::table_view const& right, rmm::device_uvector<cudf::size_type> const& result)
+  {
+    cudf::column_view const map{cudf::data_type{cudf::type_to_id<cudf::size_type>()},
+                                static_cast<cudf::size_type>(result.size()),
+                                result.data()};
+    return cudf::gather(right, map, cudf::out_of_bounds_policy::NULLIFY);
+  }
+};
+
+TEST_F(AsofJoinTest, BackwardNoByKeys)
+{
+  fixed_width_column_wrapper<int64_t> left_on{3, 1, 7, 0};
+  fixed_width_column_wrapper<int64_t> right_on{1, 2, 6};
+  fixed_width_column_wrapper<int32_t> right_payload{10, 20, 60};
+
+  auto const left  = cudf::table_view{{left_on}};
+  auto const right = cudf::table_view{{right_on, right_payload}};
+
+  auto const result  = cudf::asof_join(left, right, 0, 0, {}, {});
+  auto const matched = gather_matches(right, *result);
+
+  fixed_width_column_wrapper<int32_t> expect{{20, 10, 60, 0}, {1, 1, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(matched->get_column(1), expect);
+}
+
+TEST_F(AsofJoinTest, ForwardNoByKeys)
+{
+  fixed_width_column_wrapper<int64_t> left_on{3, 1, 7};
+  fixed_width_column_wrapper<int64_t> right_on{1, 2, 6};
+  fixed_width_column_wrapper<int32_t> right_payload{10, 20, 60};
+
+  auto const left  = cudf::table_view{{left_on}};
+  auto const right = cudf::table_view{{right_on, right_payload}};
+
+  auto const result =
+    cudf::asof_join(left, right, 0, 0, {}, {}, cudf::asof_join_direction::FORWARD);
+  auto const matched = gather_matches(right, *result);
+
+  fixed_width_column_wrapper<int32_t> expect{{60, 10, 0}, {1, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(matched->get_column(1), expect);
+}
+
+TEST_F(AsofJoinTest, NearestPrefersBackwardOnTies)
+{
+  fixed_width_column_wrapper<int64_t> left_on{4, 1, 9};
+  fixed_width_column_wrapper<int64_t> right_on{2, 6, 8};
+  fixed_width_column_wrapper<int32_t> right_payload{20, 60, 80};
+
+  auto const left  = cudf::table_view{{left_on}};
+  auto const right = cudf::table_view{{right_on, right_payload}};
+
+  auto const result =
+    cudf::asof_join(left, right, 0, 0, {}, {}, cudf::asof_join_direction::NEAREST);
+  auto const matched = gather_matches(right, *result);
+
+  // 4 is equidistant from 2 and 6 and takes the backward match
+  fixed_width_column_wrapper<int32_t> expect{20, 20, 80};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(matched->get_column(1), expect);
+}
+
+TEST_F(AsofJoinTest, ExactMatchesJoinToThemselves)
+{
+  fixed_width_column_wrapper<int64_t> left_on{2, 6};
+  fixed_width_column_wrapper<int64_t> right_on{2, 6};
+  fixed_width_column_wrapper<int32_t> right_payload{20, 60};
+
+  auto const left  = cudf::table_view{{left_on}};
+  auto const right = cudf::table_view{{right_on, right_payload}};
+
+  for (auto const direction : {cudf::asof_join_direction::BACKWARD,
+                               cudf::asof_join_direction::FORWARD,
+                               cudf::asof_join_direction::NEAREST}) {
+    auto const result  = cudf::asof_join(left, right, 0, 0, {}, {}, direction);
+    auto const matched = gather_matches(right, *result);
+
+    fixed_width_column_wrapper<int32_t> expect{20, 60};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(matched->get_column(1), expect);
+  }
+}
+
+TEST_F(AsofJoinTest, ToleranceDropsDistantMatches)
+{
+  fixed_width_column_wrapper<int64_t> left_on{3, 20};
+  fixed_width_column_wrapper<int64_t> right_on{1, 2};
+  fixed_width_column_wrapper<int32_t> right_payload{10, 20};
+
+  auto const left  = cudf::table_view{{left_on}};
+  auto const right = cudf::table_view{{right_on, right_payload}};
+
+  auto const result =
+    cudf::asof_join(left, right, 0, 0, {}, {}, cudf::asof_join_direction::BACKWARD, int64_t{5});
+  auto const matched = gather_matches(right, *result);
+
+  fixed_width_column_wrapper<int32_t> expect{{20, 0}, {1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(matched->get_column(1), expect);
+}
+
+TEST_F(AsofJoinTest, ByKeysRestrictMatches)
+{
+  strings_column_wrapper left_by{"a", "b", "a", "c"};
+  fixed_width_column_wrapper<int64_t> left_on{5, 5, 1, 5};
+
+  // Sorted on (by, on)
+  strings_column_wrapper right_by{"a", "a", "b"};
+  fixed_width_column_wrapper<int64_t> right_on{2, 4, 3};
+  fixed_width_column_wrapper<int32_t> right_payload{12, 14, 23};
+
+  auto const left  = cudf::table_view{{left_by, left_on}};
+  auto const right = cudf::table_view{{right_by, right_on, right_payload}};
+
+  auto const result  = cudf::asof_join(left, right, 1, 1, {0}, {0});
+  auto const matched = gather_matches(right, *result);
+
+  // "c" has no right rows and "a" at 1 precedes all "a" right rows
+  fixed_width_column_wrapper<int32_t> expect{{14, 23, 0, 0}, {1, 1, 0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(matched->get_column(2), expect);
+}
+
+TEST_F(AsofJoinTest, TimestampOnColumns)
+{
+  using wrapper = fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>;
+  wrapper left_on{1000, 4500};
+  wrapper right_on{900, 2000, 4000};
+  fixed_width_column_wrapper<int32_t> right_payload{9, 20, 40};
+
+  auto const left  = cudf::table_view{{left_on}};
+  auto const right = cudf::table_view{{right_on, right_payload}};
+
+  // Tolerance is in ticks of the on column, here milliseconds
+  auto const result =
+    cudf::asof_join(left, right, 0, 0, {}, {}, cudf::asof_join_direction::BACKWARD, int64_t{200});
+  auto const matched = gather_matches(right, *result);
+
+  fixed_width_column_wrapper<int32_t> expect{{9, 0}, {1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(matched->get_column(1), expect);
+}
+
+TEST_F(AsofJoinTest, EmptyInputs)
+{
+  fixed_width_column_wrapper<int64_t> empty_on{};
+  fixed_width_column_wrapper<int64_t> left_on{3, 1};
+  fixed_width_column_wrapper<int64_t> right_on{1, 2};
+
+  auto const result_empty_left =
+    cudf::asof_join(cudf::table_view{{empty_on}}, cudf::table_view{{right_on}}, 0, 0, {}, {});
+  EXPECT_EQ(0u, result_empty_left->size());
+
+  auto const result_empty_right =
+    cudf::asof_join(cudf::table_view{{left_on}}, cudf::table_view{{empty_on}}, 0, 0, {}, {});
+  auto const matched = gather_matches(cudf::table_view{{empty_on}}, *result_empty_right);
+  EXPECT_EQ(2, matched->num_rows());
+  EXPECT_EQ(2, matched->get_column(0).null_count());
+}
+
+TEST_F(AsofJoinTest, InvalidInputs)
+{
+  fixed_width_column_wrapper<int64_t> on{1, 2};
+  fixed_width_column_wrapper<int64_t> nullable_on{{1, 2}, {1, 0}};
+  strings_column_wrapper string_on{"a", "b"};
+  fixed_width_column_wrapper<int32_t> by{0, 1};
+
+  auto const left         = cudf::table_view{{on, by}};
+  auto const right        = cudf::table_view{{on, by}};
+  auto const left_strings = cudf::table_view{{string_on}};
+
+  // Mismatched by-key counts
+  EXPECT_THROW(cudf::asof_join(left, right, 0, 0, {1}, {}), cudf::logic_error);
+  // Unsupported on column type
+  EXPECT_THROW(cudf::asof_join(left_strings, left_strings, 0, 0, {}, {}), cudf::logic_error);
+  // Nulls in a key column
+  EXPECT_THROW(cudf::asof_join(cudf::table_view{{nullable_on}}, right, 0, 0, {}, {}),
+               cudf::logic_error);
+  // Negative tolerance
+  EXPECT_THROW(
+    cudf::asof_join(left, right, 0, 0, {}, {}, cudf::asof_join_direction::BACKWARD, int64_t{-1}),
+    cudf::logic_error);
+}
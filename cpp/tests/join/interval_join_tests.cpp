@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/join.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+
+struct IntervalJoinTest : public cudf::test::BaseFixture {
+  // Result order is unspecified; normalize to sorted (point, interval) pairs
+  static std::vector<std::pair<cudf::size_type, cudf::size_type>> sorted_pairs(
+    std::pair<std::unique_ptr<rmm::device_uvector<cudf::size_type>>,
+              std::unique_ptr<rmm::device_uvector<cudf::size_type>>> const& result)
+  {
+    auto const as_column = [](rmm::device_uvector<cudf::size_type> const& v) {
+      return cudf::column_view{cudf::data_type{cudf::type_to_id<cudf::size_type>()},
+                               static_cast<cudf::size_type>(v.size()),
+                               v.data()};
+    };
+    auto const points    = cudf::test::to_host<cudf::size_type>(as_column(*result.first)).first;
+    auto const intervals = cudf::test::to_host<cudf::size_type>(as_column(*result.second)).first;
+
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> pairs;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      pairs.emplace_back(points[i], intervals[i]);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  }
+};
+
+TEST_F(IntervalJoinTest, DisjointIntervals)
+{
+  fixed_width_column_wrapper<int64_t> points{5, 15, 25, 100};
+  fixed_width_column_wrapper<int64_t> left_edges{0, 10, 20};
+  fixed_width_column_wrapper<int64_t> right_edges{10, 20, 30};
+
+  auto const result = cudf::interval_join(points, left_edges, right_edges);
+
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expect{{0, 0}, {1, 1}, {2, 2}};
+  EXPECT_EQ(sorted_pairs(result), expect);
+}
+
+TEST_F(IntervalJoinTest, EdgesAreHalfOpen)
+{
+  fixed_width_column_wrapper<int32_t> points{0, 10};
+  fixed_width_column_wrapper<int32_t> left_edges{0};
+  fixed_width_column_wrapper<int32_t> right_edges{10};
+
+  auto const result = cudf::interval_join(points, left_edges, right_edges);
+
+  // the left edge is contained, the right edge is not
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expect{{0, 0}};
+  EXPECT_EQ(sorted_pairs(result), expect);
+}
+
+TEST_F(IntervalJoinTest, OverlappingIntervals)
+{
+  fixed_width_column_wrapper<int32_t> points{5, 12};
+  fixed_width_column_wrapper<int32_t> left_edges{0, 3, 10};
+  fixed_width_column_wrapper<int32_t> right_edges{20, 7, 15};
+
+  auto const result = cudf::interval_join(points, left_edges, right_edges);
+
+  // point 5 lies in intervals 0 and 1; point 12 in intervals 0 and 2
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expect{
+    {0, 0}, {0, 1}, {1, 0}, {1, 2}};
+  EXPECT_EQ(sorted_pairs(result), expect);
+}
+
+TEST_F(IntervalJoinTest, UnsortedIntervalsReportOriginalIndices)
+{
+  fixed_width_column_wrapper<int32_t> points{25, 5};
+  fixed_width_column_wrapper<int32_t> left_edges{20, 0};
+  fixed_width_column_wrapper<int32_t> right_edges{30, 10};
+
+  auto const result = cudf::interval_join(points, left_edges, right_edges);
+
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expect{{0, 0}, {1, 1}};
+  EXPECT_EQ(sorted_pairs(result), expect);
+}
+
+TEST_F(IntervalJoinTest, EmptyInputs)
+{
+  fixed_width_column_wrapper<int32_t> points{1, 2};
+  fixed_width_column_wrapper<int32_t> empty{};
+
+  auto const no_intervals = cudf::interval_join(points, empty, empty);
+  EXPECT_EQ(no_intervals.first->size(), 0);
+  EXPECT_EQ(no_intervals.second->size(), 0);
+
+  fixed_width_column_wrapper<int32_t> left_edges{0};
+  fixed_width_column_wrapper<int32_t> right_edges{10};
+  auto const no_points = cudf::interval_join(empty, left_edges, right_edges);
+  EXPECT_EQ(no_points.first->size(), 0);
+  EXPECT_EQ(no_points.second->size(), 0);
+}
+
+TEST_F(IntervalJoinTest, Errors)
+{
+  fixed_width_column_wrapper<int32_t> points{1, 2};
+  fixed_width_column_wrapper<int32_t> left_edges{0};
+  fixed_width_column_wrapper<int32_t> right_edges{10};
+
+  // type mismatch
+  fixed_width_column_wrapper<int64_t> wide_points{1, 2};
+  EXPECT_THROW(cudf::interval_join(wide_points, left_edges, right_edges), cudf::logic_error);
+
+  // edge size mismatch
+  fixed_width_column_wrapper<int32_t> extra_edges{10, 20};
+  EXPECT_THROW(cudf::interval_join(points, left_edges, extra_edges), cudf::logic_error);
+
+  // nulls
+  fixed_width_column_wrapper<int32_t> null_points{{1, 2}, {1, 0}};
+  EXPECT_THROW(cudf::interval_join(null_points, left_edges, right_edges), cudf::logic_error);
+
+  // unsupported type
+  cudf::test::strings_column_wrapper string_points{"a"};
+  cudf::test::strings_column_wrapper string_edges{"b"};
+  EXPECT_THROW(cudf::interval_join(string_points, string_edges, string_edges), cudf::logic_error);
+}
@@ -677,6 +677,61 @@ TEST_F(JoinTest, InnerJoinNoNulls)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinTest, MergeInnerJoin)
+{
+  // Both sides sorted ascending on the key columns
+  column_wrapper<int32_t> col0_0{{0, 1, 2, 2, 3}};
+  strcol_wrapper col0_1({"s4", "s1", "s0", "s0", "s1"});
+
+  column_wrapper<int32_t> col1_0{{0, 2, 2, 3, 4}};
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s1", "s2"});
+
+  cudf::table_view t0({col0_0, col0_1});
+  cudf::table_view t1({col1_0, col1_1});
+
+  auto result = cudf::merge_inner_join(t0, t1);
+
+  column_wrapper<int32_t> expected_left_map{{2, 3, 4}};
+  column_wrapper<int32_t> expected_right_map{{1, 1, 3}};
+
+  auto const [sorted_gold, sorted_result] =
+    gather_maps_as_tables(expected_left_map, expected_right_map, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, PartitionedInnerJoin)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2}};
+  strcol_wrapper col0_1({"s1", "s1", "s0", "s4", "s0"});
+  column_wrapper<int32_t> col0_2{{0, 1, 2, 4, 1}};
+
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s2", "s1"});
+  column_wrapper<int32_t> col1_2{{1, 0, 1, 2, 1}};
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols0.push_back(col0_2.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+  cols1.push_back(col1_2.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  // A tiny budget forces multiple partition passes; the result must match the
+  // single-pass join up to row order
+  auto result            = cudf::partitioned_inner_join(t0, t1, {0, 1}, {0, 1}, 32);
+  auto result_sort_order = cudf::sorted_order(result->view());
+  auto sorted_result     = cudf::gather(result->view(), *result_sort_order);
+
+  auto gold            = cudf::inner_join(t0, t1, {0, 1}, {0, 1});
+  auto gold_sort_order = cudf::sorted_order(gold->view());
+  auto sorted_gold     = cudf::gather(gold->view(), *gold_sort_order);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
 TEST_F(JoinTest, InnerJoinWithNulls)
 {
   column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2}};
@@ -1358,6 +1413,64 @@ TEST_F(JoinTest, HashJoinSequentialProbes)
   }
 }
 
+TEST_F(JoinTest, HashJoinSerializeRoundTrip)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+  cols1.emplace_back(strcol_wrapper{{"s1", "s0", "s1", "s2", "s1"}}.release());
+
+  Table t1(std::move(cols1));
+
+  cudf::hash_join hash_join(t1, cudf::null_equality::EQUAL);
+  auto const blob = hash_join.serialize();
+  auto const restored =
+    cudf::hash_join::deserialize(cudf::host_span<std::uint8_t const>{blob}, t1);
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 2}}.release());
+  cols0.emplace_back(strcol_wrapper({"s1", "s1", "s0", "s4", "s0"}).release());
+
+  Table t0(std::move(cols0));
+
+  EXPECT_EQ(hash_join.inner_join_size(t0), restored->inner_join_size(t0));
+  EXPECT_EQ(hash_join.left_join_size(t0), restored->left_join_size(t0));
+
+  auto result = restored->inner_join(t0);
+  column_wrapper<int32_t> col_gold_0{{2, 4, 0}};
+  column_wrapper<int32_t> col_gold_1{{1, 1, 4}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, HashJoinDeserializeInvalidBlob)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+
+  Table t1(std::move(cols1));
+
+  cudf::hash_join hash_join(t1, cudf::null_equality::EQUAL);
+  auto blob = hash_join.serialize();
+
+  // Truncated blob
+  std::vector<std::uint8_t> truncated(blob.begin(), blob.begin() + 4);
+  EXPECT_THROW(
+    cudf::hash_join::deserialize(cudf::host_span<std::uint8_t const>{truncated}, t1),
+    cudf::logic_error);
+
+  // Build table with a different row count
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{2, 2, 0}}.release());
+  Table t0(std::move(cols0));
+  EXPECT_THROW(cudf::hash_join::deserialize(cudf::host_span<std::uint8_t const>{blob}, t0),
+               cudf::logic_error);
+
+  // Corrupted magic
+  blob[0] = ~blob[0];
+  EXPECT_THROW(cudf::hash_join::deserialize(cudf::host_span<std::uint8_t const>{blob}, t1),
+               cudf::logic_error);
+}
+
 TEST_F(JoinTest, HashJoinWithStructsAndNulls)
 {
   auto col0_names_col = strcol_wrapper{
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+
+struct PreparedJoinTest : public cudf::test::BaseFixture {
+  void TearDown() override
+  {
+    cudf::prepared_joins::clear();
+    cudf::prepared_joins::set_memory_budget(0);
+    cudf::test::BaseFixture::TearDown();
+  }
+};
+
+TEST_F(PreparedJoinTest, InsertAndProbe)
+{
+  fixed_width_column_wrapper<int32_t> build_keys{1, 2, 3};
+  auto const join =
+    cudf::prepared_joins::insert("dimension", cudf::table_view{{build_keys}});
+  ASSERT_NE(join, nullptr);
+
+  fixed_width_column_wrapper<int32_t> probe_keys{2, 3, 4};
+  auto const [probe_indices, build_indices] = join->inner_join(cudf::table_view{{probe_keys}});
+  EXPECT_EQ(probe_indices->size(), 2);
+  EXPECT_EQ(build_indices->size(), 2);
+}
+
+TEST_F(PreparedJoinTest, InsertIsIdempotent)
+{
+  fixed_width_column_wrapper<int32_t> build_keys{1, 2, 3};
+  auto const first  = cudf::prepared_joins::insert("dimension", cudf::table_view{{build_keys}});
+  auto const second = cudf::prepared_joins::insert("dimension", cudf::table_view{{build_keys}});
+  EXPECT_EQ(first.get(), second.get());
+}
+
+TEST_F(PreparedJoinTest, FindHitAndMiss)
+{
+  EXPECT_EQ(cudf::prepared_joins::find("missing"), nullptr);
+
+  fixed_width_column_wrapper<int32_t> build_keys{1, 2, 3};
+  auto const inserted = cudf::prepared_joins::insert("dimension", cudf::table_view{{build_keys}});
+  auto const found    = cudf::prepared_joins::find("dimension");
+  EXPECT_EQ(inserted.get(), found.get());
+}
+
+TEST_F(PreparedJoinTest, EraseAndClear)
+{
+  fixed_width_column_wrapper<int32_t> build_keys{1, 2, 3};
+  cudf::prepared_joins::insert("a", cudf::table_view{{build_keys}});
+  cudf::prepared_joins::insert("b", cudf::table_view{{build_keys}});
+
+  EXPECT_TRUE(cudf::prepared_joins::erase("a"));
+  EXPECT_FALSE(cudf::prepared_joins::erase("a"));
+  EXPECT_EQ(cudf::prepared_joins::find("a"), nullptr);
+
+  cudf::prepared_joins::clear();
+  EXPECT_EQ(cudf::prepared_joins::find("b"), nullptr);
+  EXPECT_EQ(cudf::prepared_joins::memory_used(), 0);
+}
+
+TEST_F(PreparedJoinTest, BudgetEvictsLeastRecentlyUsed)
+{
+  fixed_width_column_wrapper<int32_t> build_keys{1, 2, 3};
+  auto const held = cudf::prepared_joins::insert("a", cudf::table_view{{build_keys}});
+  auto const used_one = cudf::prepared_joins::memory_used();
+  ASSERT_GT(used_one, 0);
+  cudf::prepared_joins::insert("b", cudf::table_view{{build_keys}});
+
+  // a two-entry budget, "a" refreshed last: inserting "c" must evict "b"
+  cudf::prepared_joins::set_memory_budget(2 * used_one);
+  cudf::prepared_joins::find("a");
+  cudf::prepared_joins::insert("c", cudf::table_view{{build_keys}});
+
+  EXPECT_NE(cudf::prepared_joins::find("a"), nullptr);
+  EXPECT_EQ(cudf::prepared_joins::find("b"), nullptr);
+  EXPECT_NE(cudf::prepared_joins::find("c"), nullptr);
+  EXPECT_LE(cudf::prepared_joins::memory_used(), 2 * used_one);
+
+  // an evicted entry held through a shared reference remains probe-able
+  cudf::prepared_joins::erase("a");
+  fixed_width_column_wrapper<int32_t> probe_keys{1};
+  auto const [probe_indices, build_indices] = held->inner_join(cudf::table_view{{probe_keys}});
+  EXPECT_EQ(probe_indices->size(), 1);
+}
@@ -215,3 +215,54 @@ TEST_F(JoinTest, AntiJoinWithStructsAndNullsNotEqual)
 
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
+
+TEST_F(JoinTest, FilterByBloomKeepsAllMatches)
+{
+  column_wrapper<int32_t> col0_0{{0, 1, 2, 3, 4, 5, 6, 7}};
+  strcol_wrapper col0_1({"s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7"});
+
+  column_wrapper<int32_t> col1_0{{1, 3, 5}};
+  strcol_wrapper col1_1({"s1", "s3", "s5"});
+
+  column_vector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  auto filtered = cudf::filter_by_bloom(t0, t1, {0, 1}, {0, 1});
+
+  // The filter may keep false positives but must never drop a matching row, so
+  // the exact semi join of the filtered rows matches that of the full input.
+  auto gold   = cudf::left_semi_join(t0, t1, {0, 1}, {0, 1});
+  auto result = cudf::left_semi_join(*filtered, t1, {0, 1}, {0, 1});
+
+  EXPECT_EQ(gold->num_rows(), 3);
+  EXPECT_LE(filtered->num_rows(), t0.num_rows());
+  EXPECT_GE(filtered->num_rows(), gold->num_rows());
+
+  auto result_sort_order = cudf::sorted_order(result->view());
+  auto sorted_result     = cudf::gather(result->view(), *result_sort_order);
+  auto gold_sort_order   = cudf::sorted_order(gold->view());
+  auto sorted_gold       = cudf::gather(gold->view(), *gold_sort_order);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, FilterByBloomEmptyKeys)
+{
+  column_wrapper<int32_t> col0_0{{0, 1, 2}};
+  column_wrapper<int32_t> col1_0{};
+
+  column_vector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols1.push_back(col1_0.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  auto filtered = cudf::filter_by_bloom(t0, t1, {0}, {0});
+  EXPECT_EQ(filtered->num_rows(), 0);
+}
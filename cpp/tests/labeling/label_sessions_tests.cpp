@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/labeling/label_sessions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+struct LabelSessionsTest : public cudf::test::BaseFixture {
+};
+
+using key_wrapper   = cudf::test::fixed_width_column_wrapper<int32_t>;
+using ts_wrapper    = cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, int64_t>;
+using label_wrapper = cudf::test::fixed_width_column_wrapper<cudf::size_type>;
+
+TEST_F(LabelSessionsTest, GapsAndKeyChangesStartSessions)
+{
+  key_wrapper keys{1, 1, 1, 2, 2};
+  ts_wrapper timestamps{0, 10, 100, 100, 105};
+  cudf::duration_scalar<cudf::duration_s> gap{cudf::duration_s{30}, true};
+
+  auto const labels = cudf::label_sessions(cudf::table_view{{keys}}, timestamps, gap);
+
+  // row 2 exceeds the gap within key 1; row 3 changes key
+  label_wrapper expected{0, 0, 1, 2, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, labels->view());
+}
+
+TEST_F(LabelSessionsTest, SingleSession)
+{
+  key_wrapper keys{7, 7, 7, 7};
+  ts_wrapper timestamps{0, 5, 10, 15};
+  cudf::duration_scalar<cudf::duration_s> gap{cudf::duration_s{30}, true};
+
+  auto const labels = cudf::label_sessions(cudf::table_view{{keys}}, timestamps, gap);
+
+  label_wrapper expected{0, 0, 0, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, labels->view());
+}
+
+TEST_F(LabelSessionsTest, MultipleKeyColumns)
+{
+  key_wrapper keys_a{1, 1, 1, 1};
+  key_wrapper keys_b{1, 1, 2, 2};
+  ts_wrapper timestamps{0, 5, 6, 10};
+  cudf::duration_scalar<cudf::duration_s> gap{cudf::duration_s{30}, true};
+
+  auto const labels = cudf::label_sessions(cudf::table_view{{keys_a, keys_b}}, timestamps, gap);
+
+  // the second key column changes at row 2
+  label_wrapper expected{0, 0, 1, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, labels->view());
+}
+
+TEST_F(LabelSessionsTest, NullKeysCompareEqual)
+{
+  key_wrapper keys{{1, 1, 0, 0}, {1, 1, 0, 0}};
+  ts_wrapper timestamps{0, 5, 10, 15};
+  cudf::duration_scalar<cudf::duration_s> gap{cudf::duration_s{30}, true};
+
+  auto const labels = cudf::label_sessions(cudf::table_view{{keys}}, timestamps, gap);
+
+  // the two null keys form one session of their own
+  label_wrapper expected{0, 0, 1, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, labels->view());
+}
+
+TEST_F(LabelSessionsTest, EmptyInput)
+{
+  key_wrapper keys{};
+  ts_wrapper timestamps{};
+  cudf::duration_scalar<cudf::duration_s> gap{cudf::duration_s{30}, true};
+
+  auto const labels = cudf::label_sessions(cudf::table_view{{keys}}, timestamps, gap);
+
+  EXPECT_EQ(labels->size(), 0);
+  EXPECT_EQ(labels->type(), cudf::data_type{cudf::type_to_id<cudf::size_type>()});
+}
+
+TEST_F(LabelSessionsTest, Errors)
+{
+  key_wrapper keys{1, 1, 1};
+  ts_wrapper timestamps{0, 5, 10};
+  cudf::duration_scalar<cudf::duration_s> gap{cudf::duration_s{30}, true};
+
+  // size mismatch
+  key_wrapper short_keys{1, 1};
+  EXPECT_THROW(cudf::label_sessions(cudf::table_view{{short_keys}}, timestamps, gap),
+               cudf::logic_error);
+
+  // not a timestamp column
+  key_wrapper not_timestamps{0, 5, 10};
+  EXPECT_THROW(cudf::label_sessions(cudf::table_view{{keys}}, not_timestamps, gap),
+               cudf::logic_error);
+
+  // gap resolution does not match the timestamps
+  cudf::duration_scalar<cudf::duration_ms> wrong_gap{cudf::duration_ms{30}, true};
+  EXPECT_THROW(cudf::label_sessions(cudf::table_view{{keys}}, timestamps, wrong_gap),
+               cudf::logic_error);
+
+  // nulls in the timestamps
+  ts_wrapper null_timestamps{{0, 5, 10}, {1, 0, 1}};
+  EXPECT_THROW(cudf::label_sessions(cudf::table_view{{keys}}, null_timestamps, gap),
+               cudf::logic_error);
+}
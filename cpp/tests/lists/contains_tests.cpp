@@ -761,6 +761,97 @@ TYPED_TEST(TypedContainsDecimalsTest, ListContainsVector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
 }
 
+TYPED_TEST(TypedContainsTest, ListIndexOfScalarWithNoNulls)
+{
+  using T = TypeParam;
+
+  auto search_space = lists_column_wrapper<T, int32_t>{
+    {0, 1, 2},
+    {3, 4, 5},
+    {6, 7, 8},
+    {9, 0, 1},
+    {2, 3, 4},
+    {5, 6, 7},
+    {8, 9, 0},
+    {},
+    {1, 2, 3},
+    {}}.release();
+  auto search_key_one  = create_scalar_search_key<T>(1);
+  auto actual_result   = lists::index_of(search_space->view(), *search_key_one);
+  auto expected_result = fixed_width_column_wrapper<size_type>{1, -1, -1, 2, -1, -1, -1, -1, 0, -1};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
+TYPED_TEST(TypedContainsTest, ListIndexOfScalarWithNullLists)
+{
+  // Null list rows and rows with null elements but no match are null in the output.
+
+  using T = TypeParam;
+
+  auto search_space = lists_column_wrapper<T, int32_t>{
+    {{0, 1, 2},
+     {3, 4, 5},
+     {},
+     {9, 0, 1}},
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+      return i != 2;
+    })}.release();
+
+  auto search_key_one = create_scalar_search_key<T>(1);
+  auto actual_result  = lists::index_of(search_space->view(), *search_key_one);
+  auto expected_result = fixed_width_column_wrapper<size_type>{
+    {1, -1, 0, 2},
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 2; })};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
+TYPED_TEST(TypedContainsTest, ListIndexOfScalarNullSearchKey)
+{
+  using T = TypeParam;
+
+  auto search_space = lists_column_wrapper<T, int32_t>{{0, 1, 2}, {3, 4, 5}, {}}.release();
+
+  auto search_key_null = create_null_search_key<T>();
+  auto actual_result   = lists::index_of(search_space->view(), *search_key_null);
+  auto expected_result = fixed_width_column_wrapper<size_type>{
+    {0, 0, 0}, cudf::detail::make_counting_transform_iterator(0, [](auto) { return false; })};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
+TYPED_TEST(TypedVectorContainsTest, ListIndexOfVectorWithNoNulls)
+{
+  using T = TypeParam;
+
+  auto search_space = lists_column_wrapper<T, int32_t>{
+    {0, 1, 2},
+    {3, 4, 5},
+    {6, 7, 8},
+    {},
+    {1, 2, 3}}.release();
+
+  auto search_keys = fixed_width_column_wrapper<T, int32_t>{2, 3, 8, 9, 1};
+
+  auto actual_result   = lists::index_of(search_space->view(), search_keys);
+  auto expected_result = fixed_width_column_wrapper<size_type>{2, 0, 2, -1, 0};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
+TEST_F(ContainsTest, StringListIndexOfScalar)
+{
+  auto search_space = lists_column_wrapper<std::string>{
+    {"a", "b", "c"}, {"d", "e"}, {}, {"b", "b", "a"}}.release();
+
+  auto search_key     = create_scalar_search_key<std::string>("b");
+  auto actual_result  = lists::index_of(search_space->view(), *search_key);
+  auto expected_result = fixed_width_column_wrapper<size_type>{1, -1, -1, 0};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
 }  // namespace test
 
 }  // namespace cudf
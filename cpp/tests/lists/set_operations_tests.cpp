@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/lists/set_operations.hpp>
+
+using namespace cudf::test::iterators;
+
+using float_type    = float;
+using IntListsCol   = cudf::test::lists_column_wrapper<int32_t>;
+using FloatListsCol = cudf::test::lists_column_wrapper<float_type>;
+using StrListsCol   = cudf::test::lists_column_wrapper<cudf::string_view>;
+
+auto constexpr NaN       = std::numeric_limits<float_type>::quiet_NaN();
+auto constexpr verbosity = cudf::test::debug_output_level::FIRST_ERROR;
+
+struct ListSetOperationsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ListSetOperationsTest, Intersect)
+{
+  auto const lhs = IntListsCol{{1, 1, 2, 3}, {4, 5}, {}, {6}};
+  auto const rhs = IntListsCol{{2, 3, 5}, {6, 7}, {1}, {6, 6}};
+
+  auto const results =
+    cudf::lists::intersect(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+
+  // Output elements are sorted ascending within each list
+  auto const expected = IntListsCol{{2, 3}, {}, {}, {6}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+}
+
+TEST_F(ListSetOperationsTest, Union)
+{
+  auto const lhs = IntListsCol{{1, 1, 2, 3}, {4, 5}, {}, {6}};
+  auto const rhs = IntListsCol{{2, 3, 5}, {6, 7}, {1}, {6, 6}};
+
+  auto const results =
+    cudf::lists::union_(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+
+  auto const expected = IntListsCol{{1, 2, 3, 5}, {4, 5, 6, 7}, {1}, {6}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+}
+
+TEST_F(ListSetOperationsTest, Difference)
+{
+  auto const lhs = IntListsCol{{1, 1, 2, 3}, {4, 5}, {}, {6}};
+  auto const rhs = IntListsCol{{2, 3, 5}, {6, 7}, {1}, {6, 6}};
+
+  auto const results =
+    cudf::lists::difference(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+
+  auto const expected = IntListsCol{{1}, {4, 5}, {}, {}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+}
+
+TEST_F(ListSetOperationsTest, StringElements)
+{
+  auto const lhs = StrListsCol{{"a", "b", "b"}, {"x"}};
+  auto const rhs = StrListsCol{{"b", "c"}, {"y", "z"}};
+
+  auto const intersected =
+    cudf::lists::intersect(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(intersected->view(), StrListsCol{{"b"}, {}}, verbosity);
+
+  auto const unioned =
+    cudf::lists::union_(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    unioned->view(), StrListsCol{{"a", "b", "c"}, {"x", "y", "z"}}, verbosity);
+
+  auto const differenced =
+    cudf::lists::difference(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(differenced->view(), StrListsCol{{"a"}, {"x"}}, verbosity);
+}
+
+TEST_F(ListSetOperationsTest, NullRowsNullifyOutputRows)
+{
+  auto const lhs = IntListsCol{{{1, 2}, {} /*NULL*/, {3}}, null_at(1)};
+  auto const rhs = IntListsCol{{{2, 3}, {4}, {} /*NULL*/}, null_at(2)};
+
+  auto const results =
+    cudf::lists::intersect(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+
+  auto const expected = IntListsCol{{{2}, {}, {}}, nulls_at({1, 2})};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected, verbosity);
+}
+
+TEST_F(ListSetOperationsTest, NullElementsComparedEqual)
+{
+  // With nulls_equal == EQUAL (the default), null elements match each other
+  auto const lhs = IntListsCol{{{1, 0 /*NULL*/, 2}, null_at(1)}};
+  auto const rhs = IntListsCol{{{0 /*NULL*/, 3}, null_at(0)}};
+
+  auto const intersected =
+    cudf::lists::intersect(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+  auto const expected_intersect = IntListsCol{{{0 /*NULL*/}, null_at(0)}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(intersected->view(), expected_intersect, verbosity);
+
+  auto const differenced =
+    cudf::lists::difference(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(differenced->view(), IntListsCol{{1, 2}}, verbosity);
+}
+
+TEST_F(ListSetOperationsTest, NullElementsComparedUnequal)
+{
+  // With nulls_equal == UNEQUAL, a null element matches nothing: it never appears in an
+  // intersection and is always retained in a difference
+  auto const lhs = IntListsCol{{{1, 0 /*NULL*/, 2}, null_at(1)}};
+  auto const rhs = IntListsCol{{{0 /*NULL*/, 2, 3}, null_at(0)}};
+
+  auto const intersected = cudf::lists::intersect(
+    cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}, cudf::null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(intersected->view(), IntListsCol{{2}}, verbosity);
+
+  auto const differenced = cudf::lists::difference(
+    cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}, cudf::null_equality::UNEQUAL);
+  auto const expected_difference = IntListsCol{{{1, 0 /*NULL*/}, null_at(1)}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(differenced->view(), expected_difference, verbosity);
+}
+
+TEST_F(ListSetOperationsTest, FloatingPointNaNs)
+{
+  // With nans_equal == ALL_EQUAL, NaNs match each other
+  auto const lhs = FloatListsCol{{NaN, 1.0f}};
+  auto const rhs = FloatListsCol{{NaN, 2.0f}};
+
+  auto const intersected = cudf::lists::intersect(cudf::lists_column_view{lhs},
+                                                  cudf::lists_column_view{rhs},
+                                                  cudf::null_equality::EQUAL,
+                                                  cudf::nan_equality::ALL_EQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(intersected->view(), FloatListsCol{{NaN}}, verbosity);
+
+  // With nans_equal == UNEQUAL (the default), NaNs match nothing
+  auto const intersected_unequal =
+    cudf::lists::intersect(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(intersected_unequal->view(), FloatListsCol{FloatListsCol{}},
+                                 verbosity);
+
+  auto const differenced =
+    cudf::lists::difference(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(differenced->view(), FloatListsCol{{NaN, 1.0f}}, verbosity);
+}
+
+TEST_F(ListSetOperationsTest, InvalidInputs)
+{
+  auto const ints    = IntListsCol{{1, 2}, {3}};
+  auto const floats  = FloatListsCol{{1.0f, 2.0f}, {3.0f}};
+  auto const shorter = IntListsCol{{1, 2}};
+
+  EXPECT_THROW(
+    cudf::lists::intersect(cudf::lists_column_view{ints}, cudf::lists_column_view{shorter}),
+    cudf::logic_error);
+  EXPECT_THROW(
+    cudf::lists::union_(cudf::lists_column_view{ints}, cudf::lists_column_view{floats}),
+    cudf::logic_error);
+}
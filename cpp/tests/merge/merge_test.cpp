@@ -727,6 +727,97 @@ TEST_F(MergeTest, KeysWithNulls)
     }
 }
 
+TEST_F(MergeTest, NWayMergeKeysWithNulls)
+{
+  // enough tables to trigger the single-pass N-way merge path
+  constexpr int num_tables = 5;
+  cudf::size_type nrows    = 5000;
+  auto data_iter           = thrust::make_counting_iterator<int32_t>(0);
+
+  std::vector<cudf::test::fixed_width_column_wrapper<int32_t>> data;
+  for (int t = 0; t < num_tables; ++t) {
+    auto valids = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return (row % (10 + t) == 0) ? false : true; });
+    data.emplace_back(data_iter, data_iter + nrows, valids);
+  }
+  std::vector<cudf::column_view> data_views(data.begin(), data.end());
+  auto all_data = cudf::concatenate(data_views);
+
+  std::vector<cudf::order> column_orders{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> null_precedences{cudf::null_order::AFTER, cudf::null_order::BEFORE};
+
+  for (auto co : column_orders)
+    for (auto np : null_precedences) {
+      std::vector<cudf::order> column_order{co};
+      std::vector<cudf::null_order> null_precedence{np};
+
+      std::vector<std::unique_ptr<cudf::table>> sorted;
+      std::vector<cudf::table_view> sorted_views;
+      for (auto const& col : data_views) {
+        sorted.push_back(cudf::sort(cudf::table_view({col}), column_order, null_precedence));
+        sorted_views.push_back(sorted.back()->view());
+      }
+
+      auto result = cudf::merge(sorted_views, {0}, column_order, null_precedence);
+      auto sorted_all =
+        cudf::sort(cudf::table_view({all_data->view()}), column_order, null_precedence);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_all->view().column(0), result->view().column(0));
+    }
+}
+
+TEST_F(MergeTest, IncrementalMerge)
+{
+  cudf::size_type nrows = 13200;
+  auto data_iter        = thrust::make_counting_iterator<int32_t>(0);
+  auto valids1          = cudf::detail::make_counting_transform_iterator(
+    0, [](auto row) { return (row % 10 == 0) ? false : true; });
+  cudf::test::fixed_width_column_wrapper<int32_t> data1(data_iter, data_iter + nrows, valids1);
+  // a small delta batch; every value collides with a target value so stability matters
+  auto delta_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto row) { return row * 100; });
+  cudf::test::fixed_width_column_wrapper<int32_t> data2(delta_iter, delta_iter + 37);
+
+  std::vector<cudf::order> column_orders{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> null_precedences{cudf::null_order::AFTER, cudf::null_order::BEFORE};
+
+  for (auto co : column_orders)
+    for (auto np : null_precedences) {
+      std::vector<cudf::order> column_order{co};
+      std::vector<cudf::null_order> null_precedence{np};
+      auto sorted1 =
+        cudf::sort(cudf::table_view({data1}), column_order, null_precedence)->release();
+      auto col1 = sorted1.front()->view();
+      auto sorted2 =
+        cudf::sort(cudf::table_view({data2}), column_order, null_precedence)->release();
+      auto col2 = sorted2.front()->view();
+
+      auto expected = cudf::merge(
+        {cudf::table_view({col1}), cudf::table_view({col2})}, {0}, column_order, null_precedence);
+      auto result = cudf::incremental_merge(
+        cudf::table_view({col1}), cudf::table_view({col2}), {0}, column_order, null_precedence);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+    }
+}
+
+TEST_F(MergeTest, IncrementalMergeEmptyInputs)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> data{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> empty{};
+  cudf::table_view table{{data}};
+  cudf::table_view empty_table{{empty}};
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::AFTER};
+
+  auto result = cudf::incremental_merge(table, empty_table, {0}, column_order, null_precedence);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table, result->view());
+
+  result = cudf::incremental_merge(empty_table, table, {0}, column_order, null_precedence);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table, result->view());
+
+  result = cudf::incremental_merge(empty_table, empty_table, {0}, column_order, null_precedence);
+  EXPECT_EQ(result->num_rows(), 0);
+}
+
 TEST_F(MergeTest, Structs)
 {
   // clang-format off
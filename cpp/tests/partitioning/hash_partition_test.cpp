@@ -17,6 +17,7 @@
 #include <cudf/partitioning.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
@@ -24,6 +25,8 @@
 #include <cudf_test/type_lists.hpp>
 #include "cudf/detail/utilities/vector_factories.hpp"
 
+#include <rmm/device_buffer.hpp>
+
 using cudf::test::fixed_width_column_wrapper;
 using cudf::test::strings_column_wrapper;
 
@@ -243,6 +246,155 @@ TEST_F(HashPartition, CustomSeedValue)
   CUDF_TEST_EXPECT_TABLES_EQUAL(output1->view(), output2->view());
 }
 
+TEST_F(HashPartition, XXHash64Function)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  fixed_width_column_wrapper<int16_t> integers({1, 2, 3, 4, 5, 6, 7, 8});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"});
+  auto input = cudf::table_view({floats, integers, strings});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0, 2});
+
+  cudf::size_type const num_partitions = 3;
+  std::unique_ptr<cudf::table> output1, output2;
+  std::vector<cudf::size_type> offsets1, offsets2;
+  std::tie(output1, offsets1) =
+    cudf::hash_partition(input, columns_to_hash, num_partitions, cudf::hash_id::HASH_XXHASH64);
+  std::tie(output2, offsets2) =
+    cudf::hash_partition(input, columns_to_hash, num_partitions, cudf::hash_id::HASH_XXHASH64);
+
+  // Expect output to have size num_partitions
+  EXPECT_EQ(static_cast<size_t>(num_partitions), offsets1.size());
+  EXPECT_EQ(offsets1.size(), offsets2.size());
+
+  // Expect output to have same shape as input
+  CUDF_TEST_EXPECT_TABLE_PROPERTIES_EQUAL(input, output1->view());
+
+  // Expect deterministic result from hashing the same input
+  CUDF_TEST_EXPECT_TABLES_EQUAL(output1->view(), output2->view());
+}
+
+TEST_F(HashPartition, PartitionAndPack)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  fixed_width_column_wrapper<int16_t> integers({1, 2, 3, 4, 5, 6, 7, 8});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"});
+  auto input = cudf::table_view({floats, integers, strings});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0, 2});
+
+  cudf::size_type const num_partitions = 3;
+  auto packed = cudf::hash_partition_and_pack(input, columns_to_hash, num_partitions);
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::hash_partition(input, columns_to_hash, num_partitions);
+
+  // Expect one packed table per partition, matching the splits of hash_partition
+  EXPECT_EQ(static_cast<size_t>(num_partitions), packed.size());
+  offsets.push_back(input.num_rows());
+  for (cudf::size_type i = 0; i < num_partitions; ++i) {
+    auto const expected = cudf::slice(output->view(), {offsets[i], offsets[i + 1]}).front();
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, packed[i].table);
+    // the packed metadata and buffer must round-trip through unpack without copies
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf::unpack(packed[i].data));
+  }
+}
+
+TEST_F(HashPartition, PartitionAndPackZeroPartitions)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f});
+  auto input = cudf::table_view({floats});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0});
+
+  auto packed = cudf::hash_partition_and_pack(input, columns_to_hash, 0);
+  EXPECT_TRUE(packed.empty());
+}
+
+TEST_F(HashPartition, PartitionInto)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  fixed_width_column_wrapper<int16_t> integers({1, 2, 3, 4, 5, 6, 7, 8});
+  auto input = cudf::table_view({floats, integers});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0});
+
+  cudf::size_type const num_partitions = 3;
+  auto const num_rows                  = input.num_rows();
+  rmm::device_buffer floats_out(num_rows * sizeof(float), rmm::cuda_stream_default);
+  rmm::device_buffer integers_out(num_rows * sizeof(int16_t), rmm::cuda_stream_default);
+  std::vector<cudf::device_span<uint8_t>> buffers(
+    {{static_cast<uint8_t*>(floats_out.data()), floats_out.size()},
+     {static_cast<uint8_t*>(integers_out.data()), integers_out.size()}});
+
+  auto offsets = cudf::hash_partition_into(input, columns_to_hash, num_partitions, buffers);
+
+  std::unique_ptr<cudf::table> expected;
+  std::vector<cudf::size_type> expected_offsets;
+  std::tie(expected, expected_offsets) = cudf::hash_partition(input, columns_to_hash, num_partitions);
+
+  EXPECT_EQ(expected_offsets, offsets);
+  cudf::column_view floats_view(cudf::data_type{cudf::type_id::FLOAT32},
+                                num_rows,
+                                floats_out.data());
+  cudf::column_view integers_view(cudf::data_type{cudf::type_id::INT16},
+                                  num_rows,
+                                  integers_out.data());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(0), floats_view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(1), integers_view);
+}
+
+TEST_F(HashPartition, PartitionIntoZeroPartitions)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f});
+  auto input = cudf::table_view({floats});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0});
+
+  rmm::device_buffer floats_out(3 * sizeof(float), rmm::cuda_stream_default);
+  std::vector<cudf::device_span<uint8_t>> buffers(
+    {{static_cast<uint8_t*>(floats_out.data()), floats_out.size()}});
+
+  auto offsets = cudf::hash_partition_into(input, columns_to_hash, 0, buffers);
+  EXPECT_TRUE(offsets.empty());
+}
+
+TEST_F(HashPartition, PartitionIntoInvalidInputs)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f});
+  fixed_width_column_wrapper<float> nullable_floats({1.f, 2.f, 3.f}, {1, 0, 1});
+  strings_column_wrapper strings({"a", "bb", "ccc"});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({0});
+
+  rmm::device_buffer out(3 * sizeof(float), rmm::cuda_stream_default);
+  std::vector<cudf::device_span<uint8_t>> buffers(
+    {{static_cast<uint8_t*>(out.data()), out.size()}});
+
+  // nullable and non-fixed-width columns are not supported
+  EXPECT_THROW(cudf::hash_partition_into(
+                 cudf::table_view({nullable_floats}), columns_to_hash, 2, buffers),
+               cudf::logic_error);
+  EXPECT_THROW(
+    cudf::hash_partition_into(cudf::table_view({strings}), columns_to_hash, 2, buffers),
+    cudf::logic_error);
+
+  // one buffer per column is required, and it must be large enough
+  EXPECT_THROW(cudf::hash_partition_into(
+                 cudf::table_view({floats, floats}), columns_to_hash, 2, buffers),
+               cudf::logic_error);
+  std::vector<cudf::device_span<uint8_t>> small_buffers(
+    {{static_cast<uint8_t*>(out.data()), sizeof(float)}});
+  EXPECT_THROW(
+    cudf::hash_partition_into(cudf::table_view({floats}), columns_to_hash, 2, small_buffers),
+    cudf::logic_error);
+
+  // the shared memory kernel supports at most 1024 partitions
+  EXPECT_THROW(cudf::hash_partition_into(cudf::table_view({floats}), columns_to_hash, 2048, buffers),
+               cudf::logic_error);
+}
+
 template <typename T>
 class HashPartitionFixedWidth : public cudf::test::BaseFixture {
 };
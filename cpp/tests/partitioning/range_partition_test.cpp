@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <algorithm>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+class RangePartition : public cudf::test::BaseFixture {
+};
+
+TEST_F(RangePartition, UnsortedInput)
+{
+  fixed_width_column_wrapper<int32_t> keys({5, 1, 7, 3, 9, 2});
+  auto input = cudf::table_view({keys});
+
+  fixed_width_column_wrapper<int32_t> splitter_keys({3, 7});
+  auto splitters = cudf::table_view({splitter_keys});
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::range_partition(
+    input, {0}, splitters, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+
+  // Partition p holds the rows at or after splitter p - 1 and before splitter p.
+  // Row order within a partition is not specified, so compare sorted values.
+  auto const values = cudf::test::to_host<int32_t>(output->get_column(0).view()).first;
+  offsets.push_back(input.num_rows());
+  std::vector<std::vector<int32_t>> expected({{1, 2}, {3, 5}, {7, 9}});
+  ASSERT_EQ(offsets.size(), expected.size() + 1);
+  for (std::size_t p = 0; p < expected.size(); ++p) {
+    std::vector<int32_t> partition(values.begin() + offsets[p], values.begin() + offsets[p + 1]);
+    std::sort(partition.begin(), partition.end());
+    EXPECT_EQ(expected[p], partition);
+  }
+}
+
+TEST_F(RangePartition, SortedInput)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 5, 7, 9});
+  strings_column_wrapper values({"a", "b", "c", "d", "e", "f"});
+  auto input = cudf::table_view({keys, values});
+
+  fixed_width_column_wrapper<int32_t> splitter_keys({3, 7});
+  auto splitters = cudf::table_view({splitter_keys});
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::range_partition(input,
+                                                    {0},
+                                                    splitters,
+                                                    {cudf::order::ASCENDING},
+                                                    {cudf::null_order::BEFORE},
+                                                    cudf::sorted::YES);
+
+  // Sorted input passes through unchanged; only the boundaries are computed
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, output->view());
+  EXPECT_EQ(std::vector<cudf::size_type>({0, 2, 4}), offsets);
+}
+
+TEST_F(RangePartition, BoundaryValuesMatchUnsortedPath)
+{
+  // Rows equal to a splitter belong to the partition the splitter starts
+  fixed_width_column_wrapper<int32_t> keys({3, 3, 7});
+  auto input = cudf::table_view({keys});
+
+  fixed_width_column_wrapper<int32_t> splitter_keys({3, 7});
+  auto splitters = cudf::table_view({splitter_keys});
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::range_partition(input,
+                                                    {0},
+                                                    splitters,
+                                                    {cudf::order::ASCENDING},
+                                                    {cudf::null_order::BEFORE},
+                                                    cudf::sorted::YES);
+
+  EXPECT_EQ(std::vector<cudf::size_type>({0, 0, 2}), offsets);
+
+  std::tie(output, offsets) = cudf::range_partition(input,
+                                                    {0},
+                                                    splitters,
+                                                    {cudf::order::ASCENDING},
+                                                    {cudf::null_order::BEFORE},
+                                                    cudf::sorted::NO);
+
+  EXPECT_EQ(std::vector<cudf::size_type>({0, 0, 2}), offsets);
+}
+
+TEST_F(RangePartition, NoSplitters)
+{
+  fixed_width_column_wrapper<int32_t> keys({5, 1, 7});
+  auto input = cudf::table_view({keys});
+
+  auto splitters = cudf::table_view({fixed_width_column_wrapper<int32_t>({})});
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::range_partition(
+    input, {0}, splitters, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, output->view());
+  EXPECT_EQ(std::vector<cudf::size_type>({0}), offsets);
+}
+
+TEST_F(RangePartition, EmptyInput)
+{
+  fixed_width_column_wrapper<int32_t> keys({});
+  auto input = cudf::table_view({keys});
+
+  auto splitters = cudf::table_view({fixed_width_column_wrapper<int32_t>({3, 7})});
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::range_partition(
+    input, {0}, splitters, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+
+  EXPECT_EQ(0, output->num_rows());
+  EXPECT_TRUE(offsets.empty());
+}
+
+TEST_F(RangePartition, MismatchedSplitterColumns)
+{
+  fixed_width_column_wrapper<int32_t> keys({5, 1, 7});
+  auto input = cudf::table_view({keys});
+
+  fixed_width_column_wrapper<int32_t> splitter_keys({3, 7});
+  auto splitters = cudf::table_view({splitter_keys, splitter_keys});
+
+  EXPECT_THROW(cudf::range_partition(
+                 input, {0}, splitters, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE}),
+               cudf::logic_error);
+}
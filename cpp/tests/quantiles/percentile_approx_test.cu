@@ -4,6 +4,7 @@
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/groupby.hpp>
 #include <cudf/quantiles.hpp>
+#include <cudf/tdigest/tdigest.hpp>
 #include <cudf/tdigest/tdigest_column_view.cuh>
 #include <cudf/transform.hpp>
 #include <cudf/unary.hpp>
@@ -435,3 +436,52 @@ TEST_F(PercentileApproxTest, NullPercentiles)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
 }
+
+TEST_F(PercentileApproxTest, CreateTdigest)
+{
+  auto const delta = 1000;
+
+  cudf::test::fixed_width_column_wrapper<double> values{1, 1, 2, 3, 4, 5, 6, 7, 8};
+  auto result = cudf::tdigest::create_tdigest(values, delta);
+
+  // a standalone digest is the same as a groupby digest over a single group
+  cudf::test::fixed_width_column_wrapper<int> keys{0, 0, 0, 0, 0, 0, 0, 0, 0};
+  auto expected = tdigest_gen{}.operator()<double>(keys, values, delta);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+}
+
+TEST_F(PercentileApproxTest, CreateEmptyTdigest)
+{
+  auto result = cudf::tdigest::create_tdigest(cudf::test::fixed_width_column_wrapper<double>{});
+
+  auto expected = cudf::detail::tdigest::make_empty_tdigest_column();
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+}
+
+TEST_F(PercentileApproxTest, MergeTdigests)
+{
+  auto const delta = 1000;
+
+  // digests built from separate batches of the input
+  cudf::test::fixed_width_column_wrapper<double> batch_a{1, 1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<double> batch_b{5, 6, 7, 8};
+  auto digest_a = cudf::tdigest::create_tdigest(batch_a, delta);
+  auto digest_b = cudf::tdigest::create_tdigest(batch_b, delta);
+  auto digests  = cudf::concatenate(std::vector<column_view>{*digest_a, *digest_b});
+
+  auto result = cudf::tdigest::merge_tdigests(tdigest_column_view{*digests}, delta);
+
+  // merging standalone digests is the same as a groupby merge over a single group
+  cudf::test::fixed_width_column_wrapper<int> keys{0, 0};
+  cudf::table_view t({keys});
+  cudf::groupby::groupby gb(t);
+  std::vector<cudf::groupby::aggregation_request> requests;
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggregations;
+  aggregations.push_back(cudf::make_merge_tdigest_aggregation<cudf::groupby_aggregation>(delta));
+  requests.push_back({*digests, std::move(aggregations)});
+  auto expected = gb.aggregate(requests);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected.second[0].results[0]);
+}
@@ -147,6 +147,23 @@ TYPED_TEST(QuantilesTest, TestMultiColumnUnsorted)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, actual->view());
 }
 
+TYPED_TEST(QuantilesTest, TestMultiColumnVerifiedSorted)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T, int32_t> input_a({0, 1, 2, 3, 4, 5}, {1, 1, 1, 1, 1, 1});
+  auto input = table_view({input_a});
+
+  // after a successful is_sorted check, callers may pass sorted::YES to skip
+  // re-sorting; the result must match the default sorting path
+  ASSERT_TRUE(is_sorted(input, {}, {}));
+
+  auto actual   = quantiles(input, {0.0f, 0.5f, 1.0f}, interpolation::NEAREST, sorted::YES);
+  auto expected = quantiles(input, {0.0f, 0.5f, 1.0f}, interpolation::NEAREST, sorted::NO);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), actual->view());
+}
+
 TYPED_TEST(QuantilesTest, TestMultiColumnAssumedSorted)
 {
   using T = TypeParam;
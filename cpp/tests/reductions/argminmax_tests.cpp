@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct ArgMinMaxTest : public cudf::test::BaseFixture {
+  static cudf::size_type index_of(std::unique_ptr<cudf::scalar> const& result)
+  {
+    return static_cast<cudf::numeric_scalar<cudf::size_type> const&>(*result).value();
+  }
+};
+
+TEST_F(ArgMinMaxTest, BasicArgMinMax)
+{
+  fixed_width_column_wrapper<int32_t> col{5, 3, 9, 3, 7};
+
+  auto const min_result = cudf::argmin(col);
+  ASSERT_TRUE(min_result->is_valid());
+  EXPECT_EQ(index_of(min_result), 1);  // ties resolve to the smallest index
+
+  auto const max_result = cudf::argmax(col);
+  ASSERT_TRUE(max_result->is_valid());
+  EXPECT_EQ(index_of(max_result), 2);
+}
+
+TEST_F(ArgMinMaxTest, NullsAreSkipped)
+{
+  fixed_width_column_wrapper<int32_t> col{{0, 3, 9, 2}, {0, 1, 0, 1}};
+
+  EXPECT_EQ(index_of(cudf::argmin(col)), 3);
+  EXPECT_EQ(index_of(cudf::argmax(col)), 1);
+}
+
+TEST_F(ArgMinMaxTest, Strings)
+{
+  strings_column_wrapper col{"pear", "apple", "zebra", "mango"};
+
+  EXPECT_EQ(index_of(cudf::argmin(col)), 1);
+  EXPECT_EQ(index_of(cudf::argmax(col)), 2);
+}
+
+TEST_F(ArgMinMaxTest, EmptyAndAllNull)
+{
+  fixed_width_column_wrapper<int32_t> empty{};
+  EXPECT_FALSE(cudf::argmin(empty)->is_valid());
+  EXPECT_FALSE(cudf::argmax(empty)->is_valid());
+
+  fixed_width_column_wrapper<int32_t> all_null{{1, 2}, {0, 0}};
+  EXPECT_FALSE(cudf::argmin(all_null)->is_valid());
+  EXPECT_FALSE(cudf::argmax(all_null)->is_valid());
+}
+
+TEST_F(ArgMinMaxTest, MinByMaxByGatherFullRow)
+{
+  fixed_width_column_wrapper<int32_t> ids{10, 20, 30};
+  fixed_width_column_wrapper<double> values{1.5, 0.5, 2.5};
+  strings_column_wrapper names{"a", "b", "c"};
+  auto const input = cudf::table_view{{ids, values, names}};
+
+  auto const min_row = cudf::min_by(input, 1);
+  fixed_width_column_wrapper<int32_t> expect_min_id{20};
+  fixed_width_column_wrapper<double> expect_min_value{0.5};
+  strings_column_wrapper expect_min_name{"b"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::table_view({expect_min_id, expect_min_value, expect_min_name}), min_row->view());
+
+  auto const max_row = cudf::max_by(input, 1);
+  fixed_width_column_wrapper<int32_t> expect_max_id{30};
+  fixed_width_column_wrapper<double> expect_max_value{2.5};
+  strings_column_wrapper expect_max_name{"c"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::table_view({expect_max_id, expect_max_value, expect_max_name}), max_row->view());
+}
+
+TEST_F(ArgMinMaxTest, MinByAllNullValueColumn)
+{
+  fixed_width_column_wrapper<int32_t> ids{10, 20};
+  fixed_width_column_wrapper<int32_t> values{{0, 0}, {0, 0}};
+  auto const input = cudf::table_view{{ids, values}};
+
+  auto const result = cudf::min_by(input, 1);
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_EQ(result->num_columns(), 2);
+}
+
+TEST_F(ArgMinMaxTest, Errors)
+{
+  fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  auto const input = cudf::table_view{{col}};
+
+  EXPECT_THROW(cudf::min_by(input, 1), cudf::logic_error);
+  EXPECT_THROW(cudf::max_by(input, -1), cudf::logic_error);
+}
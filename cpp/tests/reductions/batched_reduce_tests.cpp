@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <numeric>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+
+struct BatchedReduceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(BatchedReduceTest, Sum)
+{
+  fixed_width_column_wrapper<int32_t> col0{1, 2, 3, 4};
+  fixed_width_column_wrapper<int32_t> col1{10, 20, 30, 40};
+  fixed_width_column_wrapper<int32_t> col2{-1, 1, -1, 1};
+
+  auto result = cudf::batched_reduce(cudf::table_view{{col0, col1, col2}},
+                                     cudf::make_sum_aggregation(),
+                                     cudf::data_type{cudf::type_id::INT32});
+
+  fixed_width_column_wrapper<int32_t> expected{10, 100, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(BatchedReduceTest, MinMaxWithNulls)
+{
+  fixed_width_column_wrapper<double> col0{{5.0, -1.0, 3.5}, {1, 0, 1}};
+  fixed_width_column_wrapper<double> col1{{7.0, 2.0, 4.0}, {0, 0, 0}};
+
+  auto min_result = cudf::batched_reduce(cudf::table_view{{col0, col1}},
+                                         cudf::make_min_aggregation(),
+                                         cudf::data_type{cudf::type_id::FLOAT64});
+  // the entirely-null column produces a null row
+  fixed_width_column_wrapper<double> expected_min{{3.5, 0.0}, {1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_min, *min_result);
+
+  auto max_result = cudf::batched_reduce(cudf::table_view{{col0, col1}},
+                                         cudf::make_max_aggregation(),
+                                         cudf::data_type{cudf::type_id::FLOAT64});
+  fixed_width_column_wrapper<double> expected_max{{5.0, 0.0}, {1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, *max_result);
+}
+
+TEST_F(BatchedReduceTest, ManyColumns)
+{
+  constexpr cudf::size_type num_columns = 200;
+  constexpr cudf::size_type num_rows    = 1000;
+
+  std::vector<fixed_width_column_wrapper<int64_t>> columns;
+  std::vector<cudf::column_view> views;
+  std::vector<int64_t> expected_sums;
+  for (cudf::size_type c = 0; c < num_columns; ++c) {
+    std::vector<int64_t> data(num_rows);
+    std::iota(data.begin(), data.end(), c);
+    columns.emplace_back(data.begin(), data.end());
+    expected_sums.push_back(std::accumulate(data.begin(), data.end(), int64_t{0}));
+  }
+  for (auto const& col : columns) {
+    views.push_back(col);
+  }
+
+  auto result = cudf::batched_reduce(cudf::table_view{views},
+                                     cudf::make_sum_aggregation(),
+                                     cudf::data_type{cudf::type_id::INT64});
+
+  fixed_width_column_wrapper<int64_t> expected(expected_sums.begin(), expected_sums.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(BatchedReduceTest, EmptyColumns)
+{
+  fixed_width_column_wrapper<int32_t> col0{};
+  fixed_width_column_wrapper<int32_t> col1{};
+
+  auto result = cudf::batched_reduce(cudf::table_view{{col0, col1}},
+                                     cudf::make_sum_aggregation(),
+                                     cudf::data_type{cudf::type_id::INT32});
+
+  fixed_width_column_wrapper<int32_t> expected{{0, 0}, {0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(BatchedReduceTest, InvalidInputs)
+{
+  fixed_width_column_wrapper<int32_t> int_col{1, 2, 3};
+  fixed_width_column_wrapper<double> double_col{1.0, 2.0, 3.0};
+
+  // mixed column types
+  EXPECT_THROW(cudf::batched_reduce(cudf::table_view{{int_col, double_col}},
+                                    cudf::make_sum_aggregation(),
+                                    cudf::data_type{cudf::type_id::INT32}),
+               cudf::logic_error);
+
+  // output type must match the column type
+  EXPECT_THROW(cudf::batched_reduce(cudf::table_view{{int_col}},
+                                    cudf::make_sum_aggregation(),
+                                    cudf::data_type{cudf::type_id::INT64}),
+               cudf::logic_error);
+
+  // no columns
+  EXPECT_THROW(cudf::batched_reduce(cudf::table_view{std::vector<cudf::column_view>{}},
+                                    cudf::make_sum_aggregation(),
+                                    cudf::data_type{cudf::type_id::INT32}),
+               cudf::logic_error);
+
+  // unsupported aggregation
+  EXPECT_THROW(cudf::batched_reduce(cudf::table_view{{int_col}},
+                                    cudf::make_nunique_aggregation(),
+                                    cudf::data_type{cudf::type_id::INT32}),
+               cudf::logic_error);
+}
@@ -239,6 +239,29 @@ TEST(RankScanTest, BoolRankWithNull)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_rank_vals, nullable_rank_out->view());
 }
 
+TEST(RankScanTest, PercentRank)
+{
+  cudf::test::fixed_width_column_wrapper<uint32_t> order_col{5, 5, 1, 1, 9};
+
+  auto const percent_out = cudf::scan(
+    order_col, cudf::make_percent_rank_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE);
+
+  cudf::test::fixed_width_column_wrapper<double> expected_percent_vals{0.0, 0.0, 0.5, 0.5, 1.0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_percent_vals, percent_out->view());
+}
+
+TEST(RankScanTest, PercentRankSingleRow)
+{
+  // a single-row column ranks as 0 rather than dividing by zero
+  cudf::test::fixed_width_column_wrapper<uint32_t> order_col{7};
+
+  auto const percent_out = cudf::scan(
+    order_col, cudf::make_percent_rank_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE);
+
+  cudf::test::fixed_width_column_wrapper<double> expected_percent_vals{0.0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_percent_vals, percent_out->view());
+}
+
 TEST(RankScanTest, ExclusiveScan)
 {
   cudf::test::fixed_width_column_wrapper<uint32_t> vals{3, 4, 5};
@@ -252,4 +275,8 @@ TEST(RankScanTest, ExclusiveScan)
   CUDF_EXPECT_THROW_MESSAGE(
     cudf::scan(vals, cudf::make_rank_aggregation(), scan_type::EXCLUSIVE, null_policy::INCLUDE),
     "Unsupported rank aggregation operator for exclusive scan");
+  CUDF_EXPECT_THROW_MESSAGE(
+    cudf::scan(
+      vals, cudf::make_percent_rank_aggregation(), scan_type::EXCLUSIVE, null_policy::INCLUDE),
+    "Unsupported percent rank aggregation operator for exclusive scan");
 }
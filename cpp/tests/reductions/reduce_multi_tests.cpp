@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Runs reduce_multi and checks every result against the corresponding
+// single-aggregation reduction.
+void expect_matches_single_reductions(cudf::column_view const& col,
+                                      std::vector<std::unique_ptr<cudf::aggregation>> const& aggs,
+                                      std::vector<cudf::data_type> const& output_dtypes)
+{
+  auto const results = cudf::reduce_multi(col, aggs, output_dtypes);
+  ASSERT_EQ(results.size(), aggs.size());
+
+  for (size_t i = 0; i < aggs.size(); ++i) {
+    auto const expected = cudf::reduce(col, aggs[i], output_dtypes[i]);
+    EXPECT_EQ(results[i]->type(), expected->type());
+    EXPECT_EQ(results[i]->is_valid(), expected->is_valid());
+    if (expected->is_valid()) {
+      auto const expected_col = cudf::make_column_from_scalar(*expected, 1);
+      auto const result_col   = cudf::make_column_from_scalar(*results[i], 1);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_col->view(), result_col->view());
+    }
+  }
+}
+
+}  // namespace
+
+struct ReduceMultiTest : public cudf::test::BaseFixture {
+};
+
+template <typename T>
+struct ReduceMultiTypedTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_SUITE(ReduceMultiTypedTest, cudf::test::NumericTypes);
+
+TEST_F(ReduceMultiTest, FusedAggregations)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{6, -14, 13, 64, 0, -13, -20, 45};
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+
+  expect_matches_single_reductions(col,
+                                   std::move(aggs),
+                                   {cudf::data_type{cudf::type_id::INT32},
+                                    cudf::data_type{cudf::type_id::INT32},
+                                    cudf::data_type{cudf::type_id::INT64},
+                                    cudf::data_type{cudf::type_id::INT64},
+                                    cudf::data_type{cudf::type_id::FLOAT64}});
+}
+
+TEST_F(ReduceMultiTest, FusedAggregationsWithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<double> col({1.5, -2.0, 0.0, 7.25, 3.0, -8.5},
+                                                     {1, 0, 1, 1, 0, 1});
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+
+  expect_matches_single_reductions(col,
+                                   std::move(aggs),
+                                   {cudf::data_type{cudf::type_id::FLOAT64},
+                                    cudf::data_type{cudf::type_id::FLOAT64},
+                                    cudf::data_type{cudf::type_id::FLOAT64},
+                                    cudf::data_type{cudf::type_id::FLOAT64}});
+}
+
+TEST_F(ReduceMultiTest, MixedFusedAndFallback)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{5, 5, 2, 9, 2, 2, 7};
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_nunique_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_product_aggregation());
+
+  expect_matches_single_reductions(col,
+                                   std::move(aggs),
+                                   {cudf::data_type{cudf::type_id::INT32},
+                                    cudf::data_type{cudf::type_id::INT32},
+                                    cudf::data_type{cudf::type_id::INT32},
+                                    cudf::data_type{cudf::type_id::INT64}});
+}
+
+TEST_F(ReduceMultiTest, AllNull)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3}, {0, 0, 0});
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+
+  auto const results = cudf::reduce_multi(
+    col, aggs, {cudf::data_type{cudf::type_id::INT32}, cudf::data_type{cudf::type_id::INT64}});
+  EXPECT_FALSE(results[0]->is_valid());
+  EXPECT_FALSE(results[1]->is_valid());
+}
+
+TEST_F(ReduceMultiTest, SizeMismatchThrows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+
+  EXPECT_THROW(cudf::reduce_multi(col, aggs, {cudf::data_type{cudf::type_id::INT32}}),
+               cudf::logic_error);
+}
+
+TYPED_TEST(ReduceMultiTypedTest, MinMaxSum)
+{
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T, int32_t> col{5, 9, 3, 1, 8, 4};
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+
+  auto const col_type = cudf::data_type{cudf::type_to_id<T>()};
+  expect_matches_single_reductions(col, std::move(aggs), {col_type, col_type});
+}
@@ -1191,6 +1191,46 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointReductionSumFractional)
   }
 }
 
+TYPED_TEST(FixedPointTestBothReps, FixedPointReductionMean)
+{
+  using namespace numeric;
+  using decimalXX  = TypeParam;
+  using RepType    = cudf::device_storage_type_t<decimalXX>;
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<RepType>;
+
+  for (auto const i : {0, -1, -2, -3}) {
+    auto const scale    = scale_type{i};
+    auto const column   = fp_wrapper{{10, 20, 30, 40}, scale};
+    auto const out_type = static_cast<cudf::column_view>(column).type();
+    auto const expected = decimalXX{scaled_integer<RepType>{25, scale}};
+
+    auto const result        = cudf::reduce(column, cudf::make_mean_aggregation(), out_type);
+    auto const result_scalar = static_cast<cudf::scalar_type_t<decimalXX>*>(result.get());
+
+    EXPECT_EQ(result_scalar->fixed_point_value(), expected);
+  }
+}
+
+TYPED_TEST(FixedPointTestBothReps, FixedPointReductionMeanWithNulls)
+{
+  using namespace numeric;
+  using decimalXX  = TypeParam;
+  using RepType    = cudf::device_storage_type_t<decimalXX>;
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<RepType>;
+
+  for (auto const i : {0, -1, -2, -3}) {
+    auto const scale    = scale_type{i};
+    auto const column   = fp_wrapper{{10, 20, 30, 40, 50, 60}, {1, 1, 1, 1, 0, 0}, scale};
+    auto const out_type = static_cast<cudf::column_view>(column).type();
+    auto const expected = decimalXX{scaled_integer<RepType>{25, scale}};
+
+    auto const result        = cudf::reduce(column, cudf::make_mean_aggregation(), out_type);
+    auto const result_scalar = static_cast<cudf::scalar_type_t<decimalXX>*>(result.get());
+
+    EXPECT_EQ(result_scalar->fixed_point_value(), expected);
+  }
+}
+
 TYPED_TEST(FixedPointTestBothReps, FixedPointReductionSumLarge)
 {
   using namespace numeric;
@@ -1420,6 +1460,34 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointReductionNthElement)
   }
 }
 
+struct Decimal128ReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(Decimal128ReductionTest, Decimal128SumMinMax)
+{
+  using namespace numeric;
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<__int128_t>;
+
+  auto const scale    = scale_type{-2};
+  auto const column   = fp_wrapper{{-1111, 2222, 3333, 4444}, scale};
+  auto const out_type = static_cast<cudf::column_view>(column).type();
+
+  auto const sum        = cudf::reduce(column, cudf::make_sum_aggregation(), out_type);
+  auto const sum_scalar = static_cast<cudf::scalar_type_t<decimal128>*>(sum.get());
+  EXPECT_EQ(sum_scalar->fixed_point_value(),
+            decimal128{scaled_integer<__int128_t>{8888, scale}});
+
+  auto const min        = cudf::reduce(column, cudf::make_min_aggregation(), out_type);
+  auto const min_scalar = static_cast<cudf::scalar_type_t<decimal128>*>(min.get());
+  EXPECT_EQ(min_scalar->fixed_point_value(),
+            decimal128{scaled_integer<__int128_t>{-1111, scale}});
+
+  auto const max        = cudf::reduce(column, cudf::make_max_aggregation(), out_type);
+  auto const max_scalar = static_cast<cudf::scalar_type_t<decimal128>*>(max.get());
+  EXPECT_EQ(max_scalar->fixed_point_value(),
+            decimal128{scaled_integer<__int128_t>{4444, scale}});
+}
+
 TYPED_TEST(ReductionTest, NthElement)
 {
   using T = TypeParam;
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct ScanByKeyTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScanByKeyTest, InclusiveSum)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 2, 2, 3};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5, 6};
+
+  auto result = cudf::scan_by_key(
+    values, cudf::table_view{{keys}}, cudf::make_sum_aggregation(), cudf::scan_type::INCLUSIVE);
+
+  fixed_width_column_wrapper<int32_t> expected{1, 3, 6, 4, 9, 6};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(ScanByKeyTest, ExclusiveSum)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 2, 2, 3};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5, 6};
+
+  auto result = cudf::scan_by_key(
+    values, cudf::table_view{{keys}}, cudf::make_sum_aggregation(), cudf::scan_type::EXCLUSIVE);
+
+  fixed_width_column_wrapper<int32_t> expected{0, 1, 3, 0, 4, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(ScanByKeyTest, NonAdjacentKeysRestart)
+{
+  // equal keys that are not adjacent belong to different runs
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 1};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4};
+
+  auto result = cudf::scan_by_key(
+    values, cudf::table_view{{keys}}, cudf::make_sum_aggregation(), cudf::scan_type::INCLUSIVE);
+
+  fixed_width_column_wrapper<int32_t> expected{1, 2, 3, 7};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(ScanByKeyTest, MultipleKeyColumns)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 1, 2};
+  strings_column_wrapper names{"a", "a", "b", "b", "b"};
+  fixed_width_column_wrapper<int64_t> values{1, 2, 3, 4, 5};
+
+  auto result = cudf::scan_by_key(values,
+                                  cudf::table_view{{keys, names}},
+                                  cudf::make_max_aggregation(),
+                                  cudf::scan_type::INCLUSIVE);
+
+  fixed_width_column_wrapper<int64_t> expected{1, 2, 3, 4, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(ScanByKeyTest, NullValues)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 2, 2, 2};
+  fixed_width_column_wrapper<int32_t> values{{1, 2, 3, 4, 5, 6}, {1, 0, 1, 1, 1, 1}};
+
+  auto excluded = cudf::scan_by_key(values,
+                                    cudf::table_view{{keys}},
+                                    cudf::make_sum_aggregation(),
+                                    cudf::scan_type::INCLUSIVE,
+                                    cudf::null_policy::EXCLUDE);
+  fixed_width_column_wrapper<int32_t> expected_excluded{{1, 0, 4, 4, 9, 15}, {1, 0, 1, 1, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_excluded, *excluded);
+
+  // with INCLUDE, the null poisons the rest of its run but not the next run
+  auto included = cudf::scan_by_key(values,
+                                    cudf::table_view{{keys}},
+                                    cudf::make_sum_aggregation(),
+                                    cudf::scan_type::INCLUSIVE,
+                                    cudf::null_policy::INCLUDE);
+  fixed_width_column_wrapper<int32_t> expected_included{{1, 0, 0, 4, 9, 15}, {1, 0, 0, 1, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_included, *included);
+}
+
+TEST_F(ScanByKeyTest, NullKeys)
+{
+  // null keys compare equal, so the adjacent null-key rows form one run
+  fixed_width_column_wrapper<int32_t> keys{{1, 1, 0, 0, 2}, {1, 1, 0, 0, 1}};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5};
+
+  auto result = cudf::scan_by_key(
+    values, cudf::table_view{{keys}}, cudf::make_sum_aggregation(), cudf::scan_type::INCLUSIVE);
+
+  fixed_width_column_wrapper<int32_t> expected{1, 3, 3, 7, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
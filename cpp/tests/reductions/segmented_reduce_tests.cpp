@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/lists/reduce.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+
+struct SegmentedReduceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedReduceTest, Sum)
+{
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5, 6};
+  fixed_width_column_wrapper<int32_t> offsets{0, 3, 4, 4, 6};
+
+  auto result = cudf::segmented_reduce(
+    values, offsets, cudf::make_sum_aggregation(), cudf::data_type{cudf::type_id::INT32});
+
+  // the empty segment produces a null row
+  fixed_width_column_wrapper<int32_t> expected{{6, 4, 0, 11}, {1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(SegmentedReduceTest, SumWithNulls)
+{
+  fixed_width_column_wrapper<int32_t> values{{1, 2, 3, 4, 5, 6}, {1, 0, 1, 1, 1, 1}};
+  fixed_width_column_wrapper<int32_t> offsets{0, 3, 4, 6};
+
+  auto excluded = cudf::segmented_reduce(values,
+                                         offsets,
+                                         cudf::make_sum_aggregation(),
+                                         cudf::data_type{cudf::type_id::INT32},
+                                         cudf::null_policy::EXCLUDE);
+  fixed_width_column_wrapper<int32_t> expected_excluded{4, 4, 11};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_excluded, *excluded);
+
+  // with INCLUDE, the segment containing the null is nullified
+  auto included = cudf::segmented_reduce(values,
+                                         offsets,
+                                         cudf::make_sum_aggregation(),
+                                         cudf::data_type{cudf::type_id::INT32},
+                                         cudf::null_policy::INCLUDE);
+  fixed_width_column_wrapper<int32_t> expected_included{{0, 4, 11}, {0, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_included, *included);
+}
+
+TEST_F(SegmentedReduceTest, MinMax)
+{
+  fixed_width_column_wrapper<double> values{5.0, -1.0, 3.5, 7.0, 2.0};
+  fixed_width_column_wrapper<int32_t> offsets{0, 3, 5};
+
+  auto min_result = cudf::segmented_reduce(
+    values, offsets, cudf::make_min_aggregation(), cudf::data_type{cudf::type_id::FLOAT64});
+  fixed_width_column_wrapper<double> expected_min{-1.0, 2.0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_min, *min_result);
+
+  auto max_result = cudf::segmented_reduce(
+    values, offsets, cudf::make_max_aggregation(), cudf::data_type{cudf::type_id::FLOAT64});
+  fixed_width_column_wrapper<double> expected_max{5.0, 7.0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, *max_result);
+}
+
+TEST_F(SegmentedReduceTest, AnyAll)
+{
+  fixed_width_column_wrapper<int32_t> values{0, 0, 1, 0, 0, 1, 1};
+  fixed_width_column_wrapper<int32_t> offsets{0, 3, 5, 7};
+
+  auto any_result = cudf::segmented_reduce(
+    values, offsets, cudf::make_any_aggregation(), cudf::data_type{cudf::type_id::BOOL8});
+  fixed_width_column_wrapper<bool> expected_any{true, false, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_any, *any_result);
+
+  auto all_result = cudf::segmented_reduce(
+    values, offsets, cudf::make_all_aggregation(), cudf::data_type{cudf::type_id::BOOL8});
+  fixed_width_column_wrapper<bool> expected_all{false, false, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_all, *all_result);
+}
+
+TEST_F(SegmentedReduceTest, OutputTypeMismatch)
+{
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3};
+  fixed_width_column_wrapper<int32_t> offsets{0, 3};
+
+  EXPECT_THROW(cudf::segmented_reduce(values,
+                                      offsets,
+                                      cudf::make_sum_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT64}),
+               cudf::logic_error);
+}
+
+TEST_F(SegmentedReduceTest, ListsReduce)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW input{LCW{1, 2, 3}, LCW{4}, LCW{}, LCW{5, 6}};
+
+  auto result = cudf::lists::reduce(cudf::lists_column_view{input},
+                                    cudf::make_sum_aggregation(),
+                                    cudf::data_type{cudf::type_id::INT32});
+
+  fixed_width_column_wrapper<int32_t> expected{{6, 4, 0, 11}, {1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/reshape.hpp>
+
+template <typename T>
+struct DeinterleaveColumnsTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_SUITE(DeinterleaveColumnsTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(DeinterleaveColumnsTest, OneColumn)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> in({-1, 0, 1});
+
+  auto expected = cudf::test::fixed_width_column_wrapper<T, int32_t>({-1, 0, 1});
+  auto actual   = cudf::deinterleave_columns(in, 1);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected}), actual->view());
+}
+
+TYPED_TEST(DeinterleaveColumnsTest, TwoColumns)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> in({0, 1, 2, 3});
+
+  auto a      = cudf::test::fixed_width_column_wrapper<T, int32_t>({0, 2});
+  auto b      = cudf::test::fixed_width_column_wrapper<T, int32_t>({1, 3});
+  auto actual = cudf::deinterleave_columns(in, 2);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({a, b}), actual->view());
+}
+
+TYPED_TEST(DeinterleaveColumnsTest, ThreeColumns)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> in({0, 1, 2, 3, 4, 5});
+
+  auto a      = cudf::test::fixed_width_column_wrapper<T, int32_t>({0, 3});
+  auto b      = cudf::test::fixed_width_column_wrapper<T, int32_t>({1, 4});
+  auto c      = cudf::test::fixed_width_column_wrapper<T, int32_t>({2, 5});
+  auto actual = cudf::deinterleave_columns(in, 3);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({a, b, c}), actual->view());
+}
+
+TYPED_TEST(DeinterleaveColumnsTest, EmptyInput)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> in({});
+
+  auto a      = cudf::test::fixed_width_column_wrapper<T, int32_t>({});
+  auto b      = cudf::test::fixed_width_column_wrapper<T, int32_t>({});
+  auto actual = cudf::deinterleave_columns(in, 2);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({a, b}), actual->view());
+}
+
+TYPED_TEST(DeinterleaveColumnsTest, Nullable)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> in({0, 1, 2, 3, 4, 5}, {1, 0, 0, 1, 1, 1});
+
+  auto a      = cudf::test::fixed_width_column_wrapper<T, int32_t>({0, 2, 4}, {1, 0, 1});
+  auto b      = cudf::test::fixed_width_column_wrapper<T, int32_t>({1, 3, 5}, {0, 1, 1});
+  auto actual = cudf::deinterleave_columns(in, 2);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({a, b}), actual->view());
+}
+
+TYPED_TEST(DeinterleaveColumnsTest, RoundTrip)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> a({0, 1, 2, 3}, {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<T, int32_t> b({4, 5, 6, 7}, {0, 1, 1, 1});
+  cudf::table_view expected(std::vector<cudf::column_view>{a, b});
+
+  auto interleaved = cudf::interleave_columns(expected);
+  auto actual      = cudf::deinterleave_columns(interleaved->view(), expected.num_columns());
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, actual->view());
+}
+
+TYPED_TEST(DeinterleaveColumnsTest, InvalidInput)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> in({0, 1, 2});
+
+  EXPECT_THROW(cudf::deinterleave_columns(in, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::deinterleave_columns(in, 2), cudf::logic_error);
+}
+
+struct DeinterleaveStringsColumnsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DeinterleaveStringsColumnsTest, ZeroSizedColumns)
+{
+  cudf::test::strings_column_wrapper in{};
+
+  auto expected = cudf::test::strings_column_wrapper{};
+  auto actual   = cudf::deinterleave_columns(in, 2);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, actual->view().column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, actual->view().column(1));
+}
+
+TEST_F(DeinterleaveStringsColumnsTest, MultiColumnStringMix)
+{
+  cudf::test::strings_column_wrapper in{"a", "1", "", "bb", "22", "xyz", "", "333", ""};
+
+  auto a      = cudf::test::strings_column_wrapper{"a", "bb", ""};
+  auto b      = cudf::test::strings_column_wrapper{"1", "22", "333"};
+  auto c      = cudf::test::strings_column_wrapper{"", "xyz", ""};
+  auto actual = cudf::deinterleave_columns(in, 3);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({a, b, c}), actual->view());
+}
+
+TEST_F(DeinterleaveStringsColumnsTest, MultiColumnWithNulls)
+{
+  cudf::test::strings_column_wrapper in({"a", "1", "bb", "22", "", "333"}, {1, 0, 1, 1, 0, 1});
+
+  auto a      = cudf::test::strings_column_wrapper({"a", "bb", ""}, {1, 1, 0});
+  auto b      = cudf::test::strings_column_wrapper({"", "22", "333"}, {0, 1, 1});
+  auto actual = cudf::deinterleave_columns(in, 2);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({a, b}), actual->view());
+}
+
+TEST_F(DeinterleaveStringsColumnsTest, RoundTrip)
+{
+  cudf::test::strings_column_wrapper a({"a", "bb", ""}, {1, 1, 0});
+  cudf::test::strings_column_wrapper b({"", "22", "333"}, {0, 1, 1});
+  cudf::table_view expected(std::vector<cudf::column_view>{a, b});
+
+  auto interleaved = cudf::interleave_columns(expected);
+  auto actual      = cudf::deinterleave_columns(interleaved->view(), expected.num_columns());
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, actual->view());
+}
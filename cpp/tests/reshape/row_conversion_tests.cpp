@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+
+#include <numeric>
+#include <vector>
+
+struct RowConversionTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+
+// Convert a table to rows and back, expecting the round trip to be lossless.
+void run_round_trip(cudf::table_view const& input)
+{
+  std::vector<cudf::data_type> schema;
+  for (auto const& col : input) {
+    schema.push_back(col.type());
+  }
+
+  auto rows = cudf::to_rows(input);
+
+  std::vector<std::unique_ptr<cudf::table>> outputs;
+  std::vector<cudf::table_view> output_views;
+  cudf::size_type row_count = 0;
+  for (auto const& row_col : rows) {
+    cudf::lists_column_view lcv(row_col->view());
+    outputs.push_back(cudf::from_rows(lcv, schema));
+    output_views.push_back(outputs.back()->view());
+    row_count += lcv.parent().size();
+  }
+  EXPECT_EQ(row_count, input.num_rows());
+
+  auto result = cudf::concatenate(output_views);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, result->view());
+}
+
+}  // namespace
+
+TEST_F(RowConversionTest, SingleColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({-1, 0, 1, 2, 3, 4, 5});
+  run_round_trip(cudf::table_view{{a}});
+}
+
+TEST_F(RowConversionTest, MixedTypes)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> a({1, 2, 3, 4, 5});
+  cudf::test::fixed_width_column_wrapper<int64_t> b({10, 20, 30, 40, 50});
+  cudf::test::fixed_width_column_wrapper<int16_t> c({-1, -2, -3, -4, -5});
+  cudf::test::fixed_width_column_wrapper<double> d({1.5, 2.5, 3.5, 4.5, 5.5});
+  cudf::test::fixed_width_column_wrapper<bool> e({true, false, true, false, true});
+  run_round_trip(cudf::table_view{{a, b, c, d, e}});
+}
+
+TEST_F(RowConversionTest, WithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, 2, 3, 4, 5}, {1, 0, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<float> b({1.f, 2.f, 3.f, 4.f, 5.f}, {0, 1, 1, 1, 0});
+  run_round_trip(cudf::table_view{{a, b}});
+}
+
+TEST_F(RowConversionTest, ManyRows)
+{
+  std::vector<int32_t> values(10000);
+  std::iota(values.begin(), values.end(), 0);
+  cudf::test::fixed_width_column_wrapper<int32_t> a(values.begin(), values.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> b(values.rbegin(), values.rend());
+  run_round_trip(cudf::table_view{{a, b}});
+}
+
+TEST_F(RowConversionTest, NonFixedWidthError)
+{
+  cudf::test::strings_column_wrapper strings({"eee", "bb", "", "aa", "bbb"});
+  cudf::table_view in{{strings}};
+  EXPECT_THROW(cudf::to_rows(in), cudf::logic_error);
+}
+
+TEST_F(RowConversionTest, SchemaMismatchError)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, 2, 3, 4, 5});
+  auto rows = cudf::to_rows(cudf::table_view{{a}});
+  ASSERT_EQ(rows.size(), std::size_t{1});
+  cudf::lists_column_view lcv(rows.front()->view());
+
+  // the schema layout does not match the size of the byte rows
+  std::vector<cudf::data_type> schema({cudf::data_type{cudf::type_id::INT64}});
+  EXPECT_THROW(cudf::from_rows(lcv, schema), cudf::logic_error);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/rle.hpp>
+#include <cudf/utilities/error.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct RleTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RleTest, EncodeDecodeRoundTrip)
+{
+  fixed_width_column_wrapper<int32_t> input{1, 1, 1, 2, 2, 3, 3, 3, 3};
+
+  auto const encoded = cudf::rle_encode(input);
+  EXPECT_EQ(encoded.num_runs(), 3);
+  EXPECT_EQ(encoded.size(), 9);
+
+  fixed_width_column_wrapper<cudf::size_type> expected_ends{3, 5, 9};
+  fixed_width_column_wrapper<int32_t> expected_values{1, 2, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_ends, encoded.run_ends());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_values, encoded.values());
+
+  auto const decoded = cudf::rle_decode(encoded);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, decoded->view());
+}
+
+TEST_F(RleTest, NullsFormRuns)
+{
+  fixed_width_column_wrapper<int32_t> input{{1, 1, 0, 0, 2}, {1, 1, 0, 0, 1}};
+
+  auto const encoded = cudf::rle_encode(input);
+  EXPECT_EQ(encoded.num_runs(), 3);
+
+  auto const decoded = cudf::rle_decode(encoded);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, decoded->view());
+}
+
+TEST_F(RleTest, Strings)
+{
+  strings_column_wrapper input{"up", "up", "down", "down", "down", "up"};
+
+  auto const encoded = cudf::rle_encode(input);
+  EXPECT_EQ(encoded.num_runs(), 3);
+
+  auto const decoded = cudf::rle_decode(encoded);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, decoded->view());
+}
+
+TEST_F(RleTest, EmptyColumn)
+{
+  fixed_width_column_wrapper<int32_t> input{};
+
+  auto const encoded = cudf::rle_encode(input);
+  EXPECT_EQ(encoded.num_runs(), 0);
+  EXPECT_EQ(encoded.size(), 0);
+
+  auto const decoded = cudf::rle_decode(encoded);
+  EXPECT_EQ(decoded->size(), 0);
+}
+
+TEST_F(RleTest, SearchMatchesDecodedBounds)
+{
+  // decoded: {10, 10, 10, 20, 20, 30}
+  fixed_width_column_wrapper<int32_t> input{10, 10, 10, 20, 20, 30};
+  auto const encoded = cudf::rle_encode(input);
+
+  fixed_width_column_wrapper<int32_t> needles{5, 10, 20, 25, 30, 40};
+
+  auto const lower = cudf::rle_lower_bound(encoded, needles);
+  fixed_width_column_wrapper<cudf::size_type> expected_lower{0, 0, 3, 5, 5, 6};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_lower, lower->view());
+
+  auto const upper = cudf::rle_upper_bound(encoded, needles);
+  fixed_width_column_wrapper<cudf::size_type> expected_upper{0, 3, 5, 5, 6, 6};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_upper, upper->view());
+}
+
+TEST_F(RleTest, ConstructorErrors)
+{
+  // run_ends must be INT32
+  auto bad_ends = fixed_width_column_wrapper<int64_t>{3}.release();
+  auto values   = fixed_width_column_wrapper<int32_t>{1}.release();
+  EXPECT_THROW(cudf::rle_column(std::move(bad_ends), std::move(values)), cudf::logic_error);
+
+  // lengths must match
+  auto ends       = fixed_width_column_wrapper<cudf::size_type>{3, 5}.release();
+  auto one_value  = fixed_width_column_wrapper<int32_t>{1}.release();
+  EXPECT_THROW(cudf::rle_column(std::move(ends), std::move(one_value)), cudf::logic_error);
+}
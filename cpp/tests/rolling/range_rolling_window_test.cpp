@@ -603,5 +603,58 @@ TYPED_TEST(TypedRangeRollingNullsTest, UnboundedFollowingWindowSingleGroupOrderB
                                    {9, 9, 9, 9, 5, 5, 4, 4, 3, 2}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1}});
 }
 
+struct RangeRollingWindowBoundsTest : public RangeRollingTest {
+};
+
+// Precomputed window-bound columns, fed through rolling_window() per
+// aggregation, must reproduce grouped_range_rolling_window() exactly.
+TEST_F(RangeRollingWindowBoundsTest, PrecomputedBoundsMatchDirectWindows)
+{
+  using namespace cudf;
+
+  // clang-format off
+  auto const gby_column = int_col { 0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  auto const agg_column = int_col {{0, 8, 4, 6, 2, 9, 3, 5, 1, 7},
+                                   {1, 1, 1, 1, 1, 1, 1, 1, 1, 0}};
+  auto const oby_column = int_col {  1, 5, 6, 8, 9, 2, 2, 3, 4, 9};
+  // clang-format on
+
+  auto const grouping_keys = table_view{std::vector<column_view>{gby_column}};
+  auto const preceding     = range_window_bounds::get(numeric_scalar<int32_t>(2));
+  auto const following     = range_window_bounds::get(numeric_scalar<int32_t>(1));
+  auto const min_periods   = size_type{1};
+
+  auto const [preceding_col, following_col] = grouped_range_rolling_window_bounds(
+    grouping_keys, oby_column, order::ASCENDING, preceding, following);
+
+  for (auto const& agg : {make_sum_aggregation<rolling_aggregation>(),
+                          make_min_aggregation<rolling_aggregation>(),
+                          make_count_aggregation<rolling_aggregation>()}) {
+    auto const expected = grouped_range_rolling_window(
+      grouping_keys, oby_column, order::ASCENDING, agg_column, preceding, following, min_periods, *agg);
+    auto const actual = rolling_window(
+      agg_column, preceding_col->view(), following_col->view(), min_periods, *agg);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), actual->view());
+  }
+}
+
+TEST_F(RangeRollingWindowBoundsTest, EmptyInput)
+{
+  using namespace cudf;
+
+  auto const gby_column = int_col{};
+  auto const oby_column = int_col{};
+
+  auto const [preceding_col, following_col] = grouped_range_rolling_window_bounds(
+    table_view{std::vector<column_view>{gby_column}},
+    oby_column,
+    order::ASCENDING,
+    range_window_bounds::get(numeric_scalar<int32_t>(2)),
+    range_window_bounds::get(numeric_scalar<int32_t>(1)));
+
+  EXPECT_EQ(preceding_col->size(), 0);
+  EXPECT_EQ(following_col->size(), 0);
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -37,6 +37,8 @@
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -927,6 +929,44 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+// ------------- prefix-sum fast path ---------------------
+
+struct RollingPrefixSumTest : public cudf::test::BaseFixture {
+};
+
+// The fixed-size API selects the prefix-sum engine for SUM/MEAN/COUNT_VALID on
+// integral inputs; the window-column API always uses the generic kernel. Both
+// must agree on the same windows.
+TEST_F(RollingPrefixSumTest, MatchesGenericKernel)
+{
+  size_type const num_rows = 2000;
+  std::vector<int32_t> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<int32_t> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<int32_t> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  size_type const preceding = 40;
+  size_type const following = 15;
+  size_type const periods   = 30;
+  auto const preceding_col =
+    cudf::test::fixed_width_column_wrapper<size_type>(
+      thrust::make_constant_iterator(preceding), thrust::make_constant_iterator(preceding) + num_rows);
+  auto const following_col =
+    cudf::test::fixed_width_column_wrapper<size_type>(
+      thrust::make_constant_iterator(following), thrust::make_constant_iterator(following) + num_rows);
+
+  for (auto const& agg : {cudf::make_sum_aggregation<cudf::rolling_aggregation>(),
+                          cudf::make_mean_aggregation<cudf::rolling_aggregation>(),
+                          cudf::make_count_aggregation<cudf::rolling_aggregation>()}) {
+    auto const fast    = cudf::rolling_window(input, preceding, following, periods, *agg);
+    auto const generic = cudf::rolling_window(input, preceding_col, following_col, periods, *agg);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(fast->view(), generic->view());
+  }
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -1385,4 +1425,92 @@ TEST_F(RollingDictionaryTest, LeadLag)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_lag, got_lag->view());
 }
 
+struct RollingMultiAggTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RollingMultiAggTest, FusedMatchesSingleAggregation)
+{
+  size_type const num_rows = 2000;
+  std::vector<double> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<int32_t> rng(-100, 100);
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<double> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  size_type const preceding = 5;
+  size_type const following = 2;
+  size_type const periods   = 3;
+
+  std::vector<std::unique_ptr<cudf::rolling_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_count_aggregation<cudf::rolling_aggregation>());
+
+  auto const fused = cudf::rolling_window(input, preceding, following, periods, aggs);
+  ASSERT_EQ(fused.size(), aggs.size());
+
+  for (std::size_t k = 0; k < aggs.size(); ++k) {
+    auto const single = cudf::rolling_window(input, preceding, following, periods, *aggs[k]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(single->view(), fused[k]->view());
+  }
+}
+
+TEST_F(RollingMultiAggTest, VarianceAndStd)
+{
+  // small integral values keep every intermediate exactly representable
+  fixed_width_column_wrapper<int32_t> input{1, 2, 3, 5, 7};
+
+  std::vector<std::unique_ptr<cudf::rolling_aggregation>> aggs;
+  aggs.push_back(cudf::make_variance_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_std_aggregation<cudf::rolling_aggregation>());
+
+  // windows: {1,2}, {1,2,3}, {2,3,5}, {3,5,7}, {5,7}
+  auto const results = cudf::rolling_window(input, 2, 1, 2, aggs);
+
+  fixed_width_column_wrapper<double> expected_var{0.5, 1.0, 7.0 / 3.0, 4.0, 2.0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_var, results[0]->view());
+
+  fixed_width_column_wrapper<double> expected_std{
+    std::sqrt(0.5), 1.0, std::sqrt(7.0 / 3.0), 2.0, std::sqrt(2.0)};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_std, results[1]->view());
+}
+
+TEST_F(RollingMultiAggTest, NonFusableFallsBack)
+{
+  // strings only support MIN/MAX among the fused set; the fallback must match single calls
+  cudf::test::strings_column_wrapper input{{"d", "a", "c", "b", "e"}, {1, 1, 0, 1, 1}};
+
+  std::vector<std::unique_ptr<cudf::rolling_aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation<cudf::rolling_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<cudf::rolling_aggregation>());
+
+  auto const results = cudf::rolling_window(input, 2, 1, 1, aggs);
+  ASSERT_EQ(results.size(), aggs.size());
+
+  for (std::size_t k = 0; k < aggs.size(); ++k) {
+    auto const single = cudf::rolling_window(input, 2, 1, 1, *aggs[k]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(single->view(), results[k]->view());
+  }
+}
+
+TEST_F(RollingMultiAggTest, EmptyInputs)
+{
+  fixed_width_column_wrapper<int32_t> empty_input{};
+  std::vector<std::unique_ptr<cudf::rolling_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::rolling_aggregation>());
+
+  auto const results = cudf::rolling_window(empty_input, 2, 1, 1, aggs);
+  ASSERT_EQ(results.size(), std::size_t{1});
+  EXPECT_EQ(results[0]->size(), 0);
+
+  fixed_width_column_wrapper<int32_t> input{1, 2, 3};
+  auto const no_aggs = cudf::rolling_window(
+    input, 2, 1, 1, std::vector<std::unique_ptr<cudf::rolling_aggregation>>{});
+  EXPECT_TRUE(no_aggs.empty());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
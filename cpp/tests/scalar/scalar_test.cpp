@@ -19,6 +19,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/detail/scalar_pool.hpp>
 #include <cudf/scalar/scalar.hpp>
 
 template <typename T>
@@ -297,4 +298,52 @@ TEST_F(StructScalarTest, BasicNulls)
   }
 }
 
+struct ScalarPoolTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScalarPoolTest, CachesDistinctValues)
+{
+  cudf::detail::scalar_pool pool;
+
+  auto const& seven       = pool.get(int32_t{7});
+  auto const& seven_again = pool.get(int32_t{7});
+  auto const& eight       = pool.get(int32_t{8});
+
+  EXPECT_EQ(&seven, &seven_again);
+  EXPECT_NE(&seven, &eight);
+  EXPECT_EQ(pool.size(), std::size_t{2});
+
+  EXPECT_TRUE(seven.is_valid());
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t> const&>(seven).value(), 7);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t> const&>(eight).value(), 8);
+}
+
+TEST_F(ScalarPoolTest, DistinguishesTypesWithEqualBits)
+{
+  cudf::detail::scalar_pool pool;
+
+  auto const& as_int32 = pool.get(int32_t{1});
+  auto const& as_int64 = pool.get(int64_t{1});
+
+  EXPECT_NE(&as_int32, &as_int64);
+  EXPECT_EQ(as_int32.type(), cudf::data_type{cudf::type_id::INT32});
+  EXPECT_EQ(as_int64.type(), cudf::data_type{cudf::type_id::INT64});
+}
+
+TEST_F(ScalarPoolTest, ClearEmptiesCache)
+{
+  cudf::detail::scalar_pool pool;
+  pool.get(int32_t{42});
+  pool.get(double{2.5});
+  EXPECT_EQ(pool.size(), std::size_t{2});
+
+  pool.clear();
+  EXPECT_EQ(pool.size(), std::size_t{0});
+}
+
+TEST_F(ScalarPoolTest, GlobalPoolIsSingleton)
+{
+  EXPECT_EQ(&cudf::detail::get_scalar_pool(), &cudf::detail::get_scalar_pool());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
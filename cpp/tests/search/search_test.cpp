@@ -220,6 +220,66 @@ TEST_F(SearchTest, nullable_column__find_first__nulls_as_largest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, two_integral_keys__find_first)
+{
+  fixed_width_column_wrapper<int32_t> column_0{10, 20, 20, 30};
+  fixed_width_column_wrapper<int64_t> column_1{5, 1, 7, 2};
+
+  fixed_width_column_wrapper<int32_t> values_0{10, 10, 20, 20, 30, 40};
+  fixed_width_column_wrapper<int64_t> values_1{0, 5, 7, 8, 2, 0};
+
+  fixed_width_column_wrapper<size_type> expect{0, 0, 2, 3, 3, 4};
+
+  std::unique_ptr<cudf::column> result{};
+
+  EXPECT_NO_THROW(result = cudf::lower_bound({cudf::table_view{{column_0, column_1}}},
+                                             {cudf::table_view{{values_0, values_1}}},
+                                             {cudf::order::ASCENDING, cudf::order::ASCENDING},
+                                             {cudf::null_order::BEFORE, cudf::null_order::BEFORE}));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
+}
+
+TEST_F(SearchTest, two_integral_keys__find_last)
+{
+  fixed_width_column_wrapper<int32_t> column_0{10, 20, 20, 30};
+  fixed_width_column_wrapper<int64_t> column_1{5, 1, 7, 2};
+
+  fixed_width_column_wrapper<int32_t> values_0{10, 10, 20, 20, 30, 40};
+  fixed_width_column_wrapper<int64_t> values_1{0, 5, 7, 8, 2, 0};
+
+  fixed_width_column_wrapper<size_type> expect{0, 1, 3, 3, 4, 4};
+
+  std::unique_ptr<cudf::column> result{};
+
+  EXPECT_NO_THROW(result = cudf::upper_bound({cudf::table_view{{column_0, column_1}}},
+                                             {cudf::table_view{{values_0, values_1}}},
+                                             {cudf::order::ASCENDING, cudf::order::ASCENDING},
+                                             {cudf::null_order::BEFORE, cudf::null_order::BEFORE}));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
+}
+
+TEST_F(SearchTest, two_integral_keys_partial_desc__find_first)
+{
+  fixed_width_column_wrapper<int32_t> column_0{10, 10, 20, 20};
+  fixed_width_column_wrapper<int64_t> column_1{9, 3, 8, 2};
+
+  fixed_width_column_wrapper<int32_t> values_0{0, 10, 10, 20, 20, 30};
+  fixed_width_column_wrapper<int64_t> values_1{0, 10, 3, 5, 2, 1};
+
+  fixed_width_column_wrapper<size_type> expect{0, 0, 1, 3, 3, 4};
+
+  std::unique_ptr<cudf::column> result{};
+
+  EXPECT_NO_THROW(result = cudf::lower_bound({cudf::table_view{{column_0, column_1}}},
+                                             {cudf::table_view{{values_0, values_1}}},
+                                             {cudf::order::ASCENDING, cudf::order::DESCENDING},
+                                             {cudf::null_order::BEFORE, cudf::null_order::BEFORE}));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
+}
+
 TEST_F(SearchTest, table__find_first)
 {
   fixed_width_column_wrapper<int32_t> column_0{10, 20, 20, 20, 20, 20, 50};
@@ -1870,4 +1930,60 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointUpperBound)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, contains_lookup_repeated_probes)
+{
+  using element_type = int64_t;
+
+  fixed_width_column_wrapper<element_type> needles{17, 19, 45, 72};
+  auto const lookup = cudf::contains_lookup(needles);
+
+  {
+    fixed_width_column_wrapper<element_type> haystack{0, 1, 17, 19, 23, 29, 71};
+    fixed_width_column_wrapper<bool> expect{0, 0, 1, 1, 0, 0, 0};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lookup.contains(haystack), expect);
+  }
+  {
+    fixed_width_column_wrapper<element_type> haystack{{72, 1, 17, 4}, {1, 1, 1, 0}};
+    fixed_width_column_wrapper<bool> expect{{1, 0, 1, 1}, {1, 1, 1, 0}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lookup.contains(haystack), expect);
+  }
+}
+
+TEST_F(SearchTest, contains_lookup_string)
+{
+  std::vector<const char*> h_needles{"17", "19", "45", "72"};
+  cudf::test::strings_column_wrapper needles(h_needles.begin(), h_needles.end());
+
+  // the lookup keeps its own copy of the needles
+  auto const lookup = [&] {
+    cudf::test::strings_column_wrapper transient(h_needles.begin(), h_needles.end());
+    return cudf::contains_lookup(transient);
+  }();
+
+  std::vector<const char*> h_haystack{"0", "1", "17", "19", "23", "29", "71"};
+  cudf::test::strings_column_wrapper haystack(h_haystack.begin(), h_haystack.end());
+
+  fixed_width_column_wrapper<bool> expect{0, 0, 1, 1, 0, 0, 0};
+
+  auto const single_use = cudf::contains(haystack, needles);
+  auto const prepared   = lookup.contains(haystack);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*prepared, expect);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*prepared, *single_use);
+}
+
+TEST_F(SearchTest, contains_lookup_empty_and_errors)
+{
+  using element_type = int64_t;
+
+  fixed_width_column_wrapper<element_type> haystack{0, 1, 17};
+
+  auto const empty_lookup = cudf::contains_lookup(fixed_width_column_wrapper<element_type>{});
+  fixed_width_column_wrapper<bool> expect{0, 0, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*empty_lookup.contains(haystack), expect);
+
+  auto const lookup = cudf::contains_lookup(fixed_width_column_wrapper<element_type>{17});
+  fixed_width_column_wrapper<double> wrong_type{1.0, 2.0};
+  EXPECT_THROW(lookup.contains(wrong_type), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/zone_map.hpp>
+
+#include <numeric>
+#include <vector>
+
+struct ZoneMapTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ZoneMapTest, SortedColumn)
+{
+  // 1000 sorted values indexed in chunks of 100
+  std::vector<int32_t> values(1000);
+  std::iota(values.begin(), values.end(), 0);
+  cudf::test::fixed_width_column_wrapper<int32_t> input(values.begin(), values.end());
+
+  cudf::zone_map zmap(input, 100);
+  EXPECT_EQ(zmap.num_chunks(), 10);
+  EXPECT_EQ(zmap.chunk_rows(), 100);
+
+  // range [250, 450] spans chunks 2 through 4 only
+  cudf::numeric_scalar<int32_t> lo(250);
+  cudf::numeric_scalar<int32_t> hi(450);
+  auto const chunks = zmap.matching_chunks(lo, hi);
+  EXPECT_EQ(chunks, (std::vector<cudf::size_type>{2, 3, 4}));
+}
+
+TEST_F(ZoneMapTest, MinMaxValues)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{5, 1, 9, 40, 20, 30}};
+  cudf::zone_map zmap(input, 3);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_mins{{1, 20}};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_maxs{{9, 40}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_mins, zmap.minimums());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_maxs, zmap.maximums());
+}
+
+TEST_F(ZoneMapTest, NullCounts)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3, 4, 5, 6}, {1, 0, 1, 0, 0, 1}};
+  cudf::zone_map zmap(input, 2);
+  EXPECT_EQ(zmap.null_counts(), (std::vector<cudf::size_type>{1, 1, 1}));
+}
+
+TEST_F(ZoneMapTest, AllNullChunkNeverMatches)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 0, 0, 5, 6}, {1, 1, 0, 0, 1, 1}};
+  cudf::zone_map zmap(input, 2);
+
+  cudf::numeric_scalar<int32_t> lo(1);
+  cudf::numeric_scalar<int32_t> hi(6);
+  auto const chunks = zmap.matching_chunks(lo, hi);
+  EXPECT_EQ(chunks, (std::vector<cudf::size_type>{0, 2}));
+}
+
+TEST_F(ZoneMapTest, NoMatchingChunks)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3, 4}};
+  cudf::zone_map zmap(input, 2);
+
+  cudf::numeric_scalar<int32_t> lo(100);
+  cudf::numeric_scalar<int32_t> hi(200);
+  EXPECT_TRUE(zmap.matching_chunks(lo, hi).empty());
+}
+
+TEST_F(ZoneMapTest, EmptyColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{};
+  cudf::zone_map zmap(input);
+  EXPECT_EQ(zmap.num_chunks(), 0);
+
+  cudf::numeric_scalar<int32_t> lo(0);
+  cudf::numeric_scalar<int32_t> hi(1);
+  EXPECT_TRUE(zmap.matching_chunks(lo, hi).empty());
+}
+
+TEST_F(ZoneMapTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3}};
+  EXPECT_THROW(cudf::zone_map(input, 0), cudf::logic_error);
+
+  cudf::test::strings_column_wrapper strings{{"a", "b"}};
+  EXPECT_THROW(cudf::zone_map(strings), cudf::logic_error);
+
+  cudf::zone_map zmap(input);
+  cudf::numeric_scalar<int64_t> lo(0);
+  cudf::numeric_scalar<int64_t> hi(1);
+  EXPECT_THROW(zmap.matching_chunks(lo, hi), cudf::logic_error);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct ResultCursorTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ResultCursorTest, PagesCoverSortedResult)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 4, 2, 8, 7, 3, 6};
+  strings_column_wrapper names{"e", "a", "d", "b", "h", "g", "c", "f"};
+  cudf::table_view input{{keys, names}};
+
+  auto const expected = cudf::sort(input);
+
+  cudf::result_cursor cursor(input);
+  std::vector<std::unique_ptr<cudf::table>> pages;
+  std::vector<cudf::table_view> page_views;
+  while (cursor.has_next()) {
+    pages.push_back(cursor.next_page(3));
+    page_views.push_back(pages.back()->view());
+  }
+  EXPECT_EQ(pages.size(), 3u);
+  EXPECT_EQ(pages.back()->num_rows(), 2);
+
+  auto const paged = cudf::concatenate(page_views);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), paged->view());
+}
+
+TEST_F(ResultCursorTest, SpillBetweenPages)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 4, 2, 8, 7, 3, 6};
+  cudf::table_view input{{keys}};
+
+  auto const expected = cudf::sort(input);
+
+  cudf::result_cursor cursor(input);
+  auto const page0 = cursor.next_page(3);
+  cursor.spill();
+  auto const page1 = cursor.next_page(3);
+  auto const page2 = cursor.next_page(3);
+
+  auto const paged =
+    cudf::concatenate(std::vector<cudf::table_view>{page0->view(), page1->view(), page2->view()});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), paged->view());
+}
+
+TEST_F(ResultCursorTest, SeekAndDescending)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 4, 2, 8, 7, 3, 6};
+  cudf::table_view input{{keys}};
+
+  cudf::result_cursor cursor(input, {cudf::order::DESCENDING});
+  cursor.seek(4);
+  EXPECT_EQ(cursor.position(), 4);
+
+  auto const page = cursor.next_page(10);
+  fixed_width_column_wrapper<int32_t> expected{4, 3, 2, 1};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected}}, page->view());
+  EXPECT_FALSE(cursor.has_next());
+}
+
+TEST_F(ResultCursorTest, ExhaustedCursorReturnsEmptyPage)
+{
+  fixed_width_column_wrapper<int32_t> keys{2, 1};
+  cudf::table_view input{{keys}};
+
+  cudf::result_cursor cursor(input);
+  auto const page = cursor.next_page(5);
+  EXPECT_EQ(page->num_rows(), 2);
+  EXPECT_FALSE(cursor.has_next());
+  EXPECT_EQ(cursor.next_page(5)->num_rows(), 0);
+}
+
+TEST_F(ResultCursorTest, InvalidArguments)
+{
+  fixed_width_column_wrapper<int32_t> keys{2, 1};
+  cudf::table_view input{{keys}};
+
+  cudf::result_cursor cursor(input);
+  EXPECT_THROW(cursor.next_page(0), cudf::logic_error);
+  EXPECT_THROW(cursor.seek(-1), cudf::logic_error);
+  EXPECT_THROW(cursor.seek(3), cudf::logic_error);
+}
@@ -214,6 +214,23 @@ TEST_F(SegmentedSortInt, NonZeroSegmentsStart)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected3);
 }
 
+TEST_F(SegmentedSortInt, NegativeKeys)
+{
+  using T = int;
+  // clang-format off
+  column_wrapper<T>        col1{{-5, 3, -1, 0, -2, 7}};
+  column_wrapper<int> segments{{0,        3,        6}};
+  column_wrapper<int> expected_asc{{0, 2, 1, 4, 3, 5}};
+  column_wrapper<int> expected_des{{1, 2, 0, 5, 3, 4}};
+  // clang-format on
+  table_view input{{col1}};
+
+  auto results = cudf::detail::segmented_sorted_order(input, segments, {order::ASCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected_asc);
+  results = cudf::detail::segmented_sorted_order(input, segments, {order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected_des);
+}
+
 TEST_F(SegmentedSortInt, Sliced)
 {
   using T = int;
@@ -22,6 +22,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
@@ -202,6 +203,75 @@ TYPED_TEST(Sort, WithAllValid)
   }
 }
 
+TYPED_TEST(Sort, SingleColumnWithNulls)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T> col{{5, 1, 4, 2, 9, 3}, {1, 1, 1, 1, 0, 1}};
+  table_view input{{col}};
+
+  {
+    fixed_width_column_wrapper<int32_t> expected{{4, 1, 3, 5, 2, 0}};
+    auto got = sorted_order(input, {order::ASCENDING}, {null_order::BEFORE});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, {order::ASCENDING}, {null_order::BEFORE});
+  }
+  {
+    // null_order::BEFORE in a descending sort places the null row at the end
+    fixed_width_column_wrapper<int32_t> expected{{0, 2, 5, 3, 1, 4}};
+    auto got = sorted_order(input, {order::DESCENDING}, {null_order::BEFORE});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, {order::DESCENDING}, {null_order::BEFORE});
+  }
+  {
+    fixed_width_column_wrapper<int32_t> expected{{4, 0, 2, 5, 3, 1}};
+    auto got = sorted_order(input, {order::DESCENDING}, {null_order::AFTER});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, {order::DESCENDING}, {null_order::AFTER});
+  }
+}
+
+TYPED_TEST(Sort, TopK)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T> col1{{5, 4, 3, 5, 8, 5}, {1, 1, 0, 1, 1, 1}};
+  strings_column_wrapper col2({"d", "e", "a", "d", "k", "d"}, {1, 1, 0, 1, 1, 1});
+  table_view input{{col1, col2}};
+  std::vector<order> column_order{order::ASCENDING, order::DESCENDING};
+
+  auto const sorted = cudf::sort(input, column_order);
+  auto const got    = cudf::top_k(input, 3, column_order);
+
+  if (!std::is_same_v<T, bool>) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(sorted->view(), {0, 3})[0], got->view());
+  }
+
+  // requesting at least as many rows as the input returns the whole sorted table
+  auto const all = cudf::top_k(input, 10, column_order);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sorted->view(), all->view());
+
+  EXPECT_EQ(cudf::top_k(input, 0, column_order)->num_rows(), 0);
+  EXPECT_THROW(cudf::top_k(input, -1, column_order), cudf::logic_error);
+}
+
+TYPED_TEST(Sort, TopKLargeSingleColumn)
+{
+  using T = TypeParam;
+
+  // large enough to engage the candidate-selection path for integral keys
+  auto elements =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % 1000; });
+  fixed_width_column_wrapper<T, int32_t> col(elements, elements + 10000);
+  table_view input{{col}};
+
+  for (auto const sort_order : {order::ASCENDING, order::DESCENDING}) {
+    auto const sorted = cudf::sort(input, {sort_order});
+    auto const got    = cudf::top_k(input, 100, {sort_order});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(sorted->view(), {0, 100})[0], got->view());
+  }
+}
+
 TYPED_TEST(Sort, WithStructColumn)
 {
   using T = TypeParam;
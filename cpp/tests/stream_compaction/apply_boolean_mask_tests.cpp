@@ -48,6 +48,24 @@ TEST_F(ApplyBooleanMask, NonNullBooleanMask)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got->view());
 }
 
+TEST_F(ApplyBooleanMask, DestructiveFilter)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col1{{true, false, true, false, true, false},
+                                                       {1, 1, 0, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper col3{{"a", "b", "c", "d", "e", "f"}, {1, 1, 0, 1, 1, 0}};
+  cudf::table_view input{{col1, col2, col3}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, false, true, false},
+                                                            {1, 1, 1, 1, 1, 0}};
+  auto expected = cudf::apply_boolean_mask(input, boolean_mask);
+
+  // the consuming form frees the input as it goes but must produce the same result
+  auto owned_input = std::make_unique<cudf::table>(input);
+  auto got         = cudf::apply_boolean_mask(std::move(owned_input), boolean_mask);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
 TEST_F(ApplyBooleanMask, NullBooleanMask)
 {
   cudf::test::fixed_width_column_wrapper<int16_t> col1{{true, false, true, false, true, false},
@@ -366,4 +384,70 @@ TEST_F(ApplyBooleanMask, StructOfListsFiltering)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(filtered_lists_column, expected_structs_column);
 }
 
+struct MaskToGatherMapTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MaskToGatherMapTest, NonNullBooleanMask)
+{
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{
+    {true, false, true, false, true, false}};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{{0, 2, 4}};
+
+  auto got = cudf::mask_to_gather_map(boolean_mask);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(MaskToGatherMapTest, NullsTreatedAsFalse)
+{
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, true, true, false, true, true},
+                                                            {1, 0, 1, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{{0, 2, 4}};
+
+  auto got = cudf::mask_to_gather_map(boolean_mask);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(MaskToGatherMapTest, EmptyMask)
+{
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{};
+
+  auto got = cudf::mask_to_gather_map(boolean_mask);
+
+  EXPECT_EQ(got->size(), 0);
+  EXPECT_EQ(got->type().id(), cudf::type_to_id<cudf::size_type>());
+}
+
+TEST_F(MaskToGatherMapTest, NoPassingRows)
+{
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{false, false, false}};
+
+  auto got = cudf::mask_to_gather_map(boolean_mask);
+
+  EXPECT_EQ(got->size(), 0);
+}
+
+TEST_F(MaskToGatherMapTest, WrongMaskType)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> boolean_mask{{0, 1, 0}};
+
+  EXPECT_THROW(cudf::mask_to_gather_map(boolean_mask), cudf::logic_error);
+}
+
+TEST_F(MaskToGatherMapTest, GatherMatchesApplyBooleanMask)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper col2{{"a", "b", "c", "d", "e", "f"}, {1, 1, 0, 1, 1, 0}};
+  cudf::table_view input{{col1, col2}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, false, true, false},
+                                                            {1, 1, 1, 1, 1, 0}};
+
+  auto expected   = cudf::apply_boolean_mask(input, boolean_mask);
+  auto gather_map = cudf::mask_to_gather_map(boolean_mask);
+  auto got        = cudf::gather(input, gather_map->view());
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/iterator.cuh>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct DistinctBuilder : public cudf::test::BaseFixture {
+};
+
+TEST_F(DistinctBuilder, SuccessiveBatches)
+{
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  auto builder = cudf::distinct_builder(cudf::table_view{{empty_col}});
+
+  fixed_width_column_wrapper<int32_t> batch_1{4, 5, 4, 6};
+  auto result_1 = builder.insert(cudf::table_view{{batch_1}});
+
+  fixed_width_column_wrapper<int32_t> expected_1{4, 5, 6};
+  // the order within a batch is preserved, so no sort is necessary here
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_1}}, result_1->view());
+  EXPECT_EQ(builder.num_seen(), 3);
+
+  fixed_width_column_wrapper<int32_t> batch_2{5, 7, 4, 8, 7};
+  auto result_2 = builder.insert(cudf::table_view{{batch_2}});
+
+  fixed_width_column_wrapper<int32_t> expected_2{7, 8};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_2}}, result_2->view());
+  EXPECT_EQ(builder.num_seen(), 5);
+
+  // a batch of entirely seen keys yields no rows
+  auto result_3 = builder.insert(cudf::table_view{{batch_1}});
+  EXPECT_EQ(result_3->num_rows(), 0);
+  EXPECT_EQ(builder.num_seen(), 5);
+}
+
+TEST_F(DistinctBuilder, SeededHistory)
+{
+  fixed_width_column_wrapper<int32_t> initial{1, 2, 3, 2};
+  auto builder = cudf::distinct_builder(cudf::table_view{{initial}});
+  EXPECT_EQ(builder.num_seen(), 3);
+
+  fixed_width_column_wrapper<int32_t> batch{3, 4, 1};
+  auto result = builder.insert(cudf::table_view{{batch}});
+
+  fixed_width_column_wrapper<int32_t> expected{4};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected}}, result->view());
+}
+
+TEST_F(DistinctBuilder, MultipleKeyColumns)
+{
+  fixed_width_column_wrapper<int32_t> empty_keys{};
+  strings_column_wrapper empty_names{};
+  auto builder = cudf::distinct_builder(cudf::table_view{{empty_keys, empty_names}});
+
+  fixed_width_column_wrapper<int32_t> keys_1{1, 1, 2};
+  strings_column_wrapper names_1{"a", "b", "a"};
+  auto result_1 = builder.insert(cudf::table_view{{keys_1, names_1}});
+  EXPECT_EQ(result_1->num_rows(), 3);
+
+  // same ints but one new (int, string) combination
+  fixed_width_column_wrapper<int32_t> keys_2{1, 2, 2};
+  strings_column_wrapper names_2{"a", "a", "b"};
+  auto result_2 = builder.insert(cudf::table_view{{keys_2, names_2}});
+
+  fixed_width_column_wrapper<int32_t> expected_keys{2};
+  strings_column_wrapper expected_names{"b"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_keys, expected_names}},
+                                result_2->view());
+}
+
+TEST_F(DistinctBuilder, NullsEqual)
+{
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  auto builder = cudf::distinct_builder(cudf::table_view{{empty_col}});
+
+  fixed_width_column_wrapper<int32_t> batch_1{{4, -1, 5, -1}, {1, 0, 1, 0}};
+  auto result_1 = builder.insert(cudf::table_view{{batch_1}});
+
+  fixed_width_column_wrapper<int32_t> expected_1{{4, -1, 5}, {1, 0, 1}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_1}}, result_1->view());
+
+  // null keys were seen in batch 1 and match under null_equality::EQUAL
+  fixed_width_column_wrapper<int32_t> batch_2{{-1, 6}, {0, 1}};
+  auto result_2 = builder.insert(cudf::table_view{{batch_2}});
+
+  fixed_width_column_wrapper<int32_t> expected_2{6};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_2}}, result_2->view());
+}
+
+TEST_F(DistinctBuilder, NullsUnequal)
+{
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  auto builder =
+    cudf::distinct_builder(cudf::table_view{{empty_col}}, cudf::null_equality::UNEQUAL);
+
+  fixed_width_column_wrapper<int32_t> batch_1{{4, -1, 5, -1}, {1, 0, 1, 0}};
+  auto result_1 = builder.insert(cudf::table_view{{batch_1}});
+
+  // null keys never match, so every null row is emitted
+  fixed_width_column_wrapper<int32_t> expected_1{{4, -1, 5, -1}, {1, 0, 1, 0}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_1}}, result_1->view());
+
+  fixed_width_column_wrapper<int32_t> batch_2{{-1, 4}, {0, 1}};
+  auto result_2 = builder.insert(cudf::table_view{{batch_2}});
+
+  fixed_width_column_wrapper<int32_t> expected_2{{-1}, {0}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_2}}, result_2->view());
+}
+
+TEST_F(DistinctBuilder, GrowsAcrossManyBatches)
+{
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  auto builder = cudf::distinct_builder(cudf::table_view{{empty_col}});
+
+  // force multiple capacity growths and verify counts stay exact; every batch
+  // overlaps the previous one in its lower half
+  cudf::size_type constexpr batch_size = 1000;
+  for (int b = 0; b < 10; ++b) {
+    auto begin = cudf::detail::make_counting_transform_iterator(
+      0, [b](auto i) { return b * batch_size / 2 + i; });
+    fixed_width_column_wrapper<int32_t> batch(begin, begin + batch_size);
+    auto result = builder.insert(cudf::table_view{{batch}});
+    EXPECT_EQ(result->num_rows(), b == 0 ? batch_size : batch_size / 2);
+  }
+  EXPECT_EQ(builder.num_seen(), batch_size / 2 * 11);
+}
+
+TEST_F(DistinctBuilder, MismatchedTypesThrow)
+{
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  auto builder = cudf::distinct_builder(cudf::table_view{{empty_col}});
+
+  fixed_width_column_wrapper<double> batch{1.0};
+  EXPECT_THROW(builder.insert(cudf::table_view{{batch}}), cudf::logic_error);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct Distinct : public cudf::test::BaseFixture {
+};
+
+// which of several duplicate rows survives is unspecified, so results are
+// sorted before comparison wherever the surviving index could differ
+
+TEST_F(Distinct, SingleColumn)
+{
+  fixed_width_column_wrapper<int32_t> col{5, 4, 3, 5, 8, 5, 4};
+  cudf::table_view input{{col}};
+
+  auto result        = cudf::distinct(input, {0});
+  auto result_sorted = cudf::sort(result->view());
+
+  fixed_width_column_wrapper<int32_t> expected{3, 4, 5, 8};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected}}, result_sorted->view());
+}
+
+TEST_F(Distinct, MultipleColumns)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 2, 1, 2};
+  strings_column_wrapper names{"a", "b", "a", "a", "a"};
+  cudf::table_view input{{keys, names}};
+
+  auto result        = cudf::distinct(input, {0, 1});
+  auto result_sorted = cudf::sort(result->view());
+
+  fixed_width_column_wrapper<int32_t> expected_keys{1, 1, 2};
+  strings_column_wrapper expected_names{"a", "b", "a"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_keys, expected_names}},
+                                result_sorted->view());
+}
+
+TEST_F(Distinct, KeyColumnSubset)
+{
+  fixed_width_column_wrapper<int32_t> keys{9, 5, 9, 9, 5};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5};
+  cudf::table_view input{{keys, values}};
+
+  // values differ between duplicate keys, so only the keys are deterministic
+  auto result = cudf::distinct(input, {0});
+  EXPECT_EQ(result->num_rows(), 2);
+
+  auto result_sorted = cudf::sort(cudf::table_view{{result->view().column(0)}});
+  fixed_width_column_wrapper<int32_t> expected_keys{5, 9};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_keys}}, result_sorted->view());
+}
+
+TEST_F(Distinct, NullsEqual)
+{
+  fixed_width_column_wrapper<int32_t> col{{5, 4, 5, 5, 4}, {0, 1, 1, 0, 1}};
+  cudf::table_view input{{col}};
+
+  auto result        = cudf::distinct(input, {0}, cudf::null_equality::EQUAL);
+  auto result_sorted = cudf::sort(result->view());
+
+  fixed_width_column_wrapper<int32_t> expected{{0, 4, 5}, {0, 1, 1}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected}}, result_sorted->view());
+}
+
+TEST_F(Distinct, NullsUnequal)
+{
+  fixed_width_column_wrapper<int32_t> col{{5, 4, 5, 5, 4}, {0, 1, 1, 0, 1}};
+  cudf::table_view input{{col}};
+
+  // with UNEQUAL nulls every null row is distinct, so both nulls are kept
+  auto result        = cudf::distinct(input, {0}, cudf::null_equality::UNEQUAL);
+  auto result_sorted = cudf::sort(result->view());
+
+  fixed_width_column_wrapper<int32_t> expected{{0, 0, 4, 5}, {0, 0, 1, 1}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected}}, result_sorted->view());
+}
+
+TEST_F(Distinct, EmptyInput)
+{
+  fixed_width_column_wrapper<int32_t> col{};
+  cudf::table_view input{{col}};
+
+  auto result = cudf::distinct(input, {0});
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_EQ(result->num_columns(), 1);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+struct FilterTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(FilterTest, BasicComparison)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  auto result = cudf::filter(table, expression);
+
+  auto expected_0 = column_wrapper<int32_t>{3, 1};
+  auto expected_1 = column_wrapper<int32_t>{10, 20};
+  auto expected   = cudf::table_view{{expected_0, expected_1}};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
+}
+
+TEST_F(FilterTest, MatchesMaterializedMask)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50, 7, 8}, {1, 1, 0, 1, 1, 0}};
+  auto c_1   = column_wrapper<double>{{0.5, -7.0, 20.0, 0.0, 7.5, 1.0}, {1, 1, 1, 0, 1, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(5);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, literal);
+
+  // null predicate results drop the row, matching apply_boolean_mask on the
+  // computed mask
+  auto mask     = cudf::compute_column(table, expression);
+  auto expected = cudf::apply_boolean_mask(table, mask->view());
+  auto result   = cudf::filter(table, expression);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(FilterTest, NonBooleanPredicateThrows)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_0);
+
+  EXPECT_THROW(cudf::filter(table, expression), cudf::logic_error);
+}
+
+TEST_F(FilterTest, EmptyInput)
+{
+  auto c_0   = column_wrapper<int32_t>{};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(
+    cudf::ast::ast_operator::LESS, col_ref_0, col_ref_0);
+
+  auto result = cudf::filter(table, expression);
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_EQ(result->num_columns(), 1);
+}
@@ -82,6 +82,20 @@ TEST_F(StringsAttributesTest, StringsLengths)
 
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
   }
+  {
+    // strings longer than 8 bytes with multi-byte characters at varied
+    // positions exercise the word-at-a-time character counting path
+    std::vector<std::string> h_long_strings{
+      std::string(100, 'x') + "ééé",
+      "é" + std::string(63, 'y') + "é",
+      "ééééééééééééééééééééééééé",
+      std::string(17, 'z')};
+    cudf::test::strings_column_wrapper long_strings(h_long_strings.begin(), h_long_strings.end());
+
+    auto results = cudf::strings::count_characters(cudf::strings_column_view(long_strings));
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({103, 65, 25, 17});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
   {
     auto results = cudf::strings::count_bytes(strings_view);
     std::vector<int32_t> h_expected{3, 2, 0, 0, 2, 6, 24};
@@ -261,6 +261,53 @@ TEST_F(StringsContainsTests, EmbeddedNullCharacter)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected);
 }
 
+TEST_F(StringsContainsTests, SimplePatterns)
+{
+  // literal characters with alternation/grouping/repetition are executed
+  // by the DFA fast path; equivalent patterns with a character class are not
+  std::vector<const char*> h_strings{
+    "error: disk full", "warning: low disk", "fatal error", "errors", nullptr, ""};
+  auto valids =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), valids);
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    auto results      = cudf::strings::contains_re(strings_view, "error|warning");
+    bool h_expected[] = {true, true, true, true, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), valids);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results      = cudf::strings::contains_re(strings_view, "er+or");
+    bool h_expected[] = {true, false, true, true, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), valids);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results      = cudf::strings::contains_re(strings_view, "[ew]rror");
+    bool h_expected[] = {true, false, true, true, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), valids);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results      = cudf::strings::matches_re(strings_view, "(error|fatal)s?");
+    bool h_expected[] = {true, false, true, true, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), valids);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results      = cudf::strings::matches_re(strings_view, "x*");
+    bool h_expected[] = {true, true, true, true, false, true};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), valids);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsContainsTests, CountTest)
 {
   std::vector<const char*> h_strings{
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/find.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -80,6 +81,59 @@ TEST_F(StringsFindTest, Contains)
   }
 }
 
+TEST_F(StringsFindTest, ContainsLongStrings)
+{
+  // average string length here exceeds the warp-parallel threshold
+  cudf::test::strings_column_wrapper strings(
+    {"Héllo, there world and goodbye",
+     "quick brown fox jumped over the lazy brown dog; the fat cats jump in place without moving",
+     "the following code snippet demonstrates how to use search for values in an ordered set",
+     "it returns the last position where value could be inserted without violating the ordering",
+     "algorithms execution is parallelized as determined by an execution policy. t",
+     "he this is a continuation of previous row to make sure string boundaries are honored",
+     ""},
+    {1, 1, 1, 1, 1, 1, 0});
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 1, 1, 0, 1, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("e "));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 1, 0, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("fat cats"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 0, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("zzz"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
+TEST_F(StringsFindTest, ContainsDictionary)
+{
+  cudf::test::dictionary_column_wrapper<std::string> dictionary(
+    {"fleas", "tigré", "lion", "fleas", "tigré", "", "lion", ""},
+    {1, 1, 1, 1, 1, 0, 1, 0});
+  auto dictionary_view = cudf::dictionary_column_view(dictionary);
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 1, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 0, 1, 0});
+    auto results = cudf::strings::contains(dictionary_view, cudf::string_scalar("lea"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 1, 0, 0, 0, 1, 0},
+                                                          {1, 1, 1, 1, 1, 0, 1, 0});
+    auto results = cudf::strings::contains(dictionary_view, cudf::string_scalar("ion"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsFindTest, StartsWith)
 {
   cudf::test::strings_column_wrapper strings({"Héllo", "thesé", "", "lease", "tést strings", ""},
@@ -15,6 +15,7 @@
  */
 
 #include <tests/strings/utilities.h>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/strings/findall.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -75,6 +76,25 @@ TEST_F(StringsFindallTests, FindallTest)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*results, expected);
 }
 
+TEST_F(StringsFindallTests, FindallPositions)
+{
+  std::vector<const char*> h_strings{"First Last", "Joe Schmoe", "", nullptr, "Beyonce"};
+  auto valids = thrust::make_transform_iterator(h_strings.begin(),
+                                                [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), valids);
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::findall_positions_re(strings_view, "\\w+");
+
+  cudf::test::fixed_width_column_wrapper<int32_t> begins({0, 6, 0, 4, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> ends({5, 10, 3, 10, 7});
+  auto pairs = cudf::test::structs_column_wrapper{{begins, ends}};
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets({0, 2, 4, 4, 4, 5});
+  auto expected = cudf::make_lists_column(
+    5, offsets.release(), pairs.release(), 1, cudf::test::detail::make_null_mask(valids, valids + 5));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+}
+
 TEST_F(StringsFindallTests, MediumRegex)
 {
   // This results in 15 regex instructions and falls in the 'medium' range.
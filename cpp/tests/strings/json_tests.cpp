@@ -967,4 +967,57 @@ TEST_F(JsonPathTests, EscapeSequences)
     // clang-format on
     CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
   }
-}
\ No newline at end of file
+}
+TEST_F(JsonPathTests, GetJsonObjectMultiplePaths)
+{
+  // each output must match the result of querying its path alone
+  cudf::test::strings_column_wrapper input{json_string, "{\"store\": 7}", ""};
+
+  std::vector<cudf::string_scalar> json_paths;
+  json_paths.emplace_back("$.store.bicycle");
+  json_paths.emplace_back("$.store.book[2].title");
+  json_paths.emplace_back("$.store.book[*].price");
+
+  auto const results =
+    cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths);
+  ASSERT_EQ(results.size(), json_paths.size());
+
+  for (std::size_t p = 0; p < json_paths.size(); p++) {
+    auto const single =
+      cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths[p]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*single, *results[p]);
+  }
+}
+
+TEST_F(JsonPathTests, GetJsonObjectMultiplePathsEmptyAndInvalid)
+{
+  cudf::test::strings_column_wrapper input{"{\"a\": 1}", "{\"b\": 2}"};
+
+  // no paths yields no columns
+  auto const no_paths = cudf::strings::get_json_object(cudf::strings_column_view(input),
+                                                       std::vector<cudf::string_scalar>{});
+  EXPECT_TRUE(no_paths.empty());
+
+  // an empty path yields an all-null column, like the single-path overload
+  {
+    std::vector<cudf::string_scalar> json_paths;
+    json_paths.emplace_back("");
+    json_paths.emplace_back("$.a");
+    auto const results =
+      cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths);
+    ASSERT_EQ(results.size(), std::size_t{2});
+    EXPECT_EQ(results[0]->null_count(), 2);
+
+    cudf::test::strings_column_wrapper expected{{"1", ""}, {1, 0}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *results[1]);
+  }
+
+  // one bad path fails the whole call
+  {
+    std::vector<cudf::string_scalar> json_paths;
+    json_paths.emplace_back("$.a");
+    json_paths.emplace_back("${a}");
+    EXPECT_THROW(cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths),
+                 cudf::logic_error);
+  }
+}
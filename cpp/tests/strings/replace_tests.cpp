@@ -337,6 +337,40 @@ TEST_F(StringsReplaceTest, ReplaceMulti)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceManyTargets)
+{
+  // enough targets to engage the trie path, with overlapping prefixes to
+  // verify the first-listed target still wins at each position
+  auto strings      = build_corpus();
+  auto strings_view = cudf::strings_column_view(strings);
+
+  std::vector<const char*> h_targets{
+    "the ", "theres", "cat", "catch", "dog", "in", "include", "turtlé", "éd", "composéd"};
+  cudf::test::strings_column_wrapper targets(h_targets.begin(), h_targets.end());
+  auto targets_view = cudf::strings_column_view(targets);
+
+  std::vector<const char*> h_repls{
+    "== ", "!", "feline", "grab", "canine", "@", "$", "snail", "+", "-"};
+  cudf::test::strings_column_wrapper repls(h_repls.begin(), h_repls.end());
+  auto repls_view = cudf::strings_column_view(repls);
+
+  auto results = cudf::strings::replace(strings_view, targets_view, repls_view);
+
+  std::vector<const char*> h_expected{
+    "== quick brown fox jumps over == lazy canine",
+    "== fat feline lays next to == other accénted feline",
+    "a slow mov@g snail cannot felinech == bird",
+    "which can be - together to form a more complete",
+    "The result does not @clude == value @ == sum @",
+    "",
+    nullptr};
+  cudf::test::strings_column_wrapper expected(
+    h_expected.begin(),
+    h_expected.end(),
+    thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsReplaceTest, EmptyStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/split/partition.hpp>
 #include <cudf/strings/split/split.hpp>
@@ -430,6 +431,40 @@ TEST_F(StringsSplitTest, RSplitRecordWhitespaceWithMaxSplit)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
 }
 
+TEST_F(StringsSplitTest, SplitToListView)
+{
+  std::vector<const char*> h_strings{"a_bc", "", "def_g", nullptr};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+
+  {
+    auto result = cudf::strings::split_to_list_view(cudf::strings_column_view(strings),
+                                                    cudf::string_scalar("_"));
+    EXPECT_EQ(result->null_count(), 1);
+    auto const lists = cudf::lists_column_view(result->view());
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets({0, 2, 3, 5, 5});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.offsets(), expected_offsets);
+    // tokens reference bytes of the input chars data: "a_bcdef_g"
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_byte_offsets({0, 2, 0, 4, 8});
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_byte_lengths({1, 2, 0, 3, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.child().child(0), expected_byte_offsets);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.child().child(1), expected_byte_lengths);
+  }
+  {
+    // whitespace delimiter produces no empty tokens
+    cudf::test::strings_column_wrapper input({"a bc", " d "});
+    auto result = cudf::strings::split_to_list_view(cudf::strings_column_view(input));
+    auto const lists = cudf::lists_column_view(result->view());
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets({0, 2, 3});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.offsets(), expected_offsets);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_byte_offsets({0, 2, 5});
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_byte_lengths({1, 2, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.child().child(0), expected_byte_offsets);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.child().child(1), expected_byte_lengths);
+  }
+}
+
 TEST_F(StringsSplitTest, SplitRecordZeroSizeStringsColumns)
 {
   cudf::column_view zero_size_strings_column(
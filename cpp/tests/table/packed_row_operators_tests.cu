@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/packed_row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+struct PackedRowOperatorsTest : public cudf::test::BaseFixture {
+};
+
+// Compares row `row_index` of the packed table against every row, writing
+// `true`/1 for each equal row into `output`.
+void packed_row_comparison(cudf::table_view input,
+                           cudf::size_type row_index,
+                           cudf::mutable_column_view output)
+{
+  rmm::cuda_stream_view stream{};
+
+  auto packed     = cudf::packed_row_table(input, stream);
+  auto comparator = packed.equality_comparator();
+
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(input.num_rows()),
+                    output.data<int8_t>(),
+                    [comparator, row_index] __device__(cudf::size_type idx) {
+                      return comparator(row_index, idx);
+                    });
+}
+
+TEST_F(PackedRowOperatorsTest, IsSupported)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4}};
+  cudf::test::fixed_width_column_wrapper<int32_t> with_nulls{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<double> doubles{{1., 2., 3., 4.}};
+  cudf::test::strings_column_wrapper strings{"a", "b", "c", "d"};
+
+  EXPECT_TRUE(cudf::packed_row_table::is_supported(cudf::table_view{{ints}}));
+  EXPECT_FALSE(cudf::packed_row_table::is_supported(cudf::table_view{{ints, with_nulls}}));
+  EXPECT_FALSE(cudf::packed_row_table::is_supported(cudf::table_view{{ints, doubles}}));
+  EXPECT_FALSE(cudf::packed_row_table::is_supported(cudf::table_view{{ints, strings}}));
+}
+
+TEST_F(PackedRowOperatorsTest, EqualityComparator)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> col1{{1, 2, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{10, 20, 10, 30}};
+  cudf::test::fixed_width_column_wrapper<int64_t> col3{{100, 200, 100, 100}};
+  cudf::table_view input{{col1, col2, col3}};
+
+  auto got = cudf::make_numeric_column(
+    cudf::data_type(cudf::type_id::INT8), input.num_rows(), cudf::mask_state::UNALLOCATED);
+  cudf::test::fixed_width_column_wrapper<int8_t> expected{{1, 0, 1, 0}};
+  packed_row_comparison(input, 0, got->mutable_view());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(PackedRowOperatorsTest, HasherMatchesEquality)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col1{{1, 2, 1, 2, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{{5, 6, 5, 7, 5}};
+  cudf::table_view input{{col1, col2}};
+
+  rmm::cuda_stream_view stream{};
+  auto packed = cudf::packed_row_table(input, stream);
+  auto hasher = packed.hasher();
+
+  auto got = cudf::make_numeric_column(
+    cudf::data_type(cudf::type_id::UINT32), input.num_rows(), cudf::mask_state::UNALLOCATED);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(input.num_rows()),
+                    got->mutable_view().data<cudf::hash_value_type>(),
+                    hasher);
+
+  auto const hashes = cudf::test::to_host<cudf::hash_value_type>(got->view()).first;
+  EXPECT_EQ(hashes[0], hashes[2]);
+  EXPECT_EQ(hashes[0], hashes[4]);
+  EXPECT_NE(hashes[0], hashes[1]);
+  EXPECT_NE(hashes[1], hashes[3]);
+}
+
+TEST_F(PackedRowOperatorsTest, SlicedInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{9, 1, 2, 1, 9}};
+  auto const sliced = cudf::slice(static_cast<cudf::column_view>(col), {1, 4}).front();
+  cudf::table_view input{{sliced}};
+
+  auto got = cudf::make_numeric_column(
+    cudf::data_type(cudf::type_id::INT8), input.num_rows(), cudf::mask_state::UNALLOCATED);
+  cudf::test::fixed_width_column_wrapper<int8_t> expected{{1, 0, 1}};
+  packed_row_comparison(input, 0, got->mutable_view());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(PackedRowOperatorsTest, UnsupportedThrows)
+{
+  cudf::test::fixed_width_column_wrapper<float> col{{1.f, 2.f}};
+  cudf::table_view input{{col}};
+
+  rmm::cuda_stream_view stream{};
+  EXPECT_THROW(cudf::packed_row_table(input, stream), cudf::logic_error);
+}
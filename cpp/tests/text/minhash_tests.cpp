@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <nvtext/minhash.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <vector>
+
+struct TextMinHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TextMinHashTest, MinHash)
+{
+  std::vector<const char*> h_strings{"the quick brown fox jumped over the lazy brown dog",
+                                     nullptr,
+                                     "the slowest brown fox crawled under the lazy brown dog",
+                                     "the quick brown fox jumped over the lazy brown dog",
+                                     ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  auto const results = nvtext::minhash(cudf::strings_column_view(strings), 4, 16);
+
+  auto const view = cudf::lists_column_view(results->view());
+  EXPECT_EQ(view.size(), static_cast<cudf::size_type>(h_strings.size()));
+  EXPECT_EQ(view.child().size(), static_cast<cudf::size_type>(h_strings.size()) * 16);
+  EXPECT_EQ(results->null_count(), 1);
+
+  // identical strings must produce identical signatures
+  auto const row0 = cudf::slice(results->view(), {0, 1}).front();
+  auto const row3 = cudf::slice(results->view(), {3, 4}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(row0, row3);
+
+  // different strings are expected to produce different signatures
+  auto const row2 = cudf::slice(results->view(), {2, 3}).front();
+  EXPECT_FALSE(
+    cudf::test::expect_columns_equivalent(row0, row2, cudf::test::debug_output_level::QUIET));
+}
+
+TEST_F(TextMinHashTest, ShortStrings)
+{
+  // strings shorter than the ngram width are hashed whole
+  cudf::test::strings_column_wrapper strings({"ab", "cd", "ab"});
+
+  auto const results = nvtext::minhash(cudf::strings_column_view(strings), 4, 8);
+
+  auto const row0 = cudf::slice(results->view(), {0, 1}).front();
+  auto const row2 = cudf::slice(results->view(), {2, 3}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(row0, row2);
+}
+
+TEST_F(TextMinHashTest, EmptyTest)
+{
+  auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  auto results = nvtext::minhash(cudf::strings_column_view(strings->view()));
+  EXPECT_EQ(results->size(), 0);
+}
+
+TEST_F(TextMinHashTest, ErrorsTest)
+{
+  cudf::test::strings_column_wrapper strings({"this string intentionally left not blank"});
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), 1, 16), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), 4, 0), cudf::logic_error);
+}
@@ -143,6 +143,45 @@ TEST(TextSubwordTest, TokenizeMultiRow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
 
+TEST(TextSubwordTest, TokenizeBatch)
+{
+  cudf::test::strings_column_wrapper strings1({"This is a test."});
+  cudf::test::strings_column_wrapper strings2(
+    {"This is a test. A test this is.", "This is a test."});
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  uint32_t max_sequence_length = 8;
+  uint32_t stride              = 8;
+
+  std::vector<cudf::strings_column_view> batch{cudf::strings_column_view{strings1},
+                                               cudf::strings_column_view{strings2}};
+  auto result = nvtext::subword_tokenize_batch(batch,
+                                               *vocab,
+                                               max_sequence_length,
+                                               stride,
+                                               true,  // do_lower_case
+                                               true,  // do_truncate
+                                               MAX_ROWS_TENSOR);
+
+  EXPECT_EQ(uint32_t{3}, result.nrows_tensor);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens(
+    {2023, 2003, 1037, 3231, 1012, 0,    0,    0,    2023, 2003, 1037, 3231,
+     1012, 1037, 3231, 2023, 2023, 2003, 1037, 3231, 1012, 0,    0,    0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(), expected_tokens);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_attn(
+    {1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(), expected_attn);
+  // metadata row-ids index the concatenated batch
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata({0, 0, 4, 1, 0, 7, 2, 0, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
+
+  EXPECT_THROW(nvtext::subword_tokenize_batch(
+                 {}, *vocab, max_sequence_length, stride, true, true, MAX_ROWS_TENSOR),
+               cudf::logic_error);
+}
+
 TEST(TextSubwordTest, TokenizeMaxEqualsTokens)
 {
   cudf::test::strings_column_wrapper strings({"This is a test."});
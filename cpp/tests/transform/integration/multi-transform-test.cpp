@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+namespace cudf {
+namespace test {
+namespace transformation {
+
+struct MultiTransformIntegrationTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MultiTransformIntegrationTest, MultipleInputsAndOutputs)
+{
+  // Two outputs computed from two inputs in a single kernel
+  const char cuda[] =
+    R"***(
+__device__ inline void f(float* out_sum, float* out_diff, float a, float b)
+{
+  *out_sum  = a + b;
+  *out_diff = a - b;
+}
+)***";
+
+  fixed_width_column_wrapper<float> a{1.0f, 2.0f, 3.0f, 4.0f};
+  fixed_width_column_wrapper<float> b{10.0f, 20.0f, 30.0f, 40.0f};
+
+  auto outputs = cudf::transform(cudf::table_view{{a, b}},
+                                 cuda,
+                                 {cudf::data_type{cudf::type_id::FLOAT32},
+                                  cudf::data_type{cudf::type_id::FLOAT32}},
+                                 false);
+
+  fixed_width_column_wrapper<float> expect_sum{11.0f, 22.0f, 33.0f, 44.0f};
+  fixed_width_column_wrapper<float> expect_diff{-9.0f, -18.0f, -27.0f, -36.0f};
+
+  ASSERT_EQ(outputs.size(), 2u);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*outputs[0], expect_sum);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*outputs[1], expect_diff);
+}
+
+TEST_F(MultiTransformIntegrationTest, NullsPropagate)
+{
+  const char cuda[] =
+    R"***(
+__device__ inline void f(int* out, int a, int b)
+{
+  *out = a * b;
+}
+)***";
+
+  fixed_width_column_wrapper<int32_t> a{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  fixed_width_column_wrapper<int32_t> b{{5, 6, 7, 8}, {1, 1, 0, 1}};
+
+  auto outputs = cudf::transform(
+    cudf::table_view{{a, b}}, cuda, {cudf::data_type{cudf::type_id::INT32}}, false);
+
+  // An output row is null if the corresponding row of any input is null
+  fixed_width_column_wrapper<int32_t> expected{{5, 12, 21, 32}, {1, 0, 0, 1}};
+
+  ASSERT_EQ(outputs.size(), 1u);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*outputs[0], expected);
+}
+
+TEST_F(MultiTransformIntegrationTest, PtxRequiresSingleOutput)
+{
+  fixed_width_column_wrapper<int32_t> a{1, 2, 3, 4};
+
+  EXPECT_THROW(cudf::transform(cudf::table_view{{a}},
+                               "",
+                               {cudf::data_type{cudf::type_id::INT32},
+                                cudf::data_type{cudf::type_id::INT32}},
+                               true),
+               cudf::logic_error);
+}
+
+}  // namespace transformation
+}  // namespace test
+}  // namespace cudf
@@ -176,4 +176,35 @@ TEST_P(IdFixedDoubleDispatcherTest, IdToType)
                                            t));
 }
 
+template <typename T>
+struct TypedListDispatcherTest : public DispatcherTest {
+};
+
+TYPED_TEST_SUITE(TypedListDispatcherTest, cudf::test::NumericTypes);
+
+TYPED_TEST(TypedListDispatcherTest, TypeToId)
+{
+  EXPECT_TRUE(cudf::list_type_dispatcher<cudf::numeric_dispatch_list>(
+    cudf::data_type{cudf::type_to_id<TypeParam>()}, type_tester<TypeParam>{}));
+}
+
+struct ListDispatcherTest : public DispatcherTest {
+};
+
+TEST_F(ListDispatcherTest, TypeOutsideListThrows)
+{
+  EXPECT_THROW(cudf::list_type_dispatcher<cudf::floating_point_dispatch_list>(
+                 cudf::data_type{cudf::type_id::INT32}, type_tester<int32_t>{}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::list_type_dispatcher<cudf::numeric_dispatch_list>(
+                 cudf::data_type{cudf::type_id::STRING}, type_tester<cudf::string_view>{}),
+               cudf::logic_error);
+}
+
+TEST_F(ListDispatcherTest, SingleTypeList)
+{
+  EXPECT_TRUE(cudf::list_type_dispatcher<cudf::dispatch_list<cudf::type_id::FLOAT64>>(
+    cudf::data_type{cudf::type_id::FLOAT64}, type_tester<double>{}));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -441,3 +441,33 @@ TEST_F(UnaryMathOpsErrorTest, LogicalOpTypeFail)
   auto d = cudf::dictionary::encode(input);
   EXPECT_THROW(cudf::unary_operation(d->view(), cudf::unary_operator::NOT), cudf::logic_error);
 }
+
+TYPED_TEST(UnaryMathFloatOpsTest, ChainedOps)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input{{-1, 4, -9, 16}, {1, 1, 0, 1}};
+
+  auto const abs_col  = cudf::unary_operation(input, cudf::unary_operator::ABS);
+  auto const expected = cudf::unary_operation(abs_col->view(), cudf::unary_operator::SQRT);
+
+  auto const output =
+    cudf::unary_chain(input, {cudf::unary_operator::ABS, cudf::unary_operator::SQRT});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), output->view());
+}
+
+TYPED_TEST(UnaryMathFloatOpsTest, ChainedSingleOp)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input{{1, 4, 9, 16}};
+  auto const expected = cudf::unary_operation(input, cudf::unary_operator::SQRT);
+  auto const output   = cudf::unary_chain(input, {cudf::unary_operator::SQRT});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), output->view());
+}
+
+TEST_F(UnaryMathOpsErrorTest, ChainedOpsFail)
+{
+  cudf::test::fixed_width_column_wrapper<float> input{{1.f, 2.f}};
+  EXPECT_THROW(cudf::unary_chain(input, {}), cudf::logic_error);
+  EXPECT_THROW(cudf::unary_chain(input, {cudf::unary_operator::NOT}), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2}};
+  EXPECT_THROW(cudf::unary_chain(ints, {cudf::unary_operator::ABS}), cudf::logic_error);
+}
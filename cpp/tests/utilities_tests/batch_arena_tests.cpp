@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/batch_arena.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+TEST(BatchArenaTest, InstallsAndRestoresResource)
+{
+  auto* before = rmm::mr::get_current_device_resource();
+  {
+    cudf::batch_arena arena;
+    EXPECT_NE(before, rmm::mr::get_current_device_resource());
+    EXPECT_EQ(before, arena.upstream());
+  }
+  EXPECT_EQ(before, rmm::mr::get_current_device_resource());
+}
+
+TEST(BatchArenaTest, BumpAllocation)
+{
+  cudf::batch_arena arena(1 << 20);
+  EXPECT_EQ(std::size_t{0}, arena.allocated_bytes());
+
+  // allocations within the initial block reserve nothing further
+  rmm::device_buffer buf1(1024, rmm::cuda_stream_view{});
+  rmm::device_buffer buf2(1024, rmm::cuda_stream_view{});
+  EXPECT_EQ(std::size_t{2048}, arena.allocated_bytes());
+  EXPECT_EQ(std::size_t{1 << 20}, arena.reserved_bytes());
+
+  // an oversized request grows the arena instead of failing
+  rmm::device_buffer big(2 << 20, rmm::cuda_stream_view{});
+  EXPECT_GT(arena.reserved_bytes(), std::size_t{1 << 20});
+}
+
+TEST(BatchArenaTest, DeallocationIsNoOp)
+{
+  cudf::batch_arena arena(1 << 20);
+  {
+    rmm::device_buffer buf(4096, rmm::cuda_stream_view{});
+  }
+  // freeing does not shrink the arena; memory is released at scope end
+  EXPECT_EQ(std::size_t{4096}, arena.allocated_bytes());
+}
+
+TEST(BatchArenaTest, Errors) { EXPECT_THROW(cudf::batch_arena(0), cudf::logic_error); }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+
+#include <cudf/utilities/cuda_graph.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/transform.h>
+
+struct CudaGraphTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CudaGraphTest, CaptureAndReplay)
+{
+  rmm::cuda_stream stream;
+  rmm::device_uvector<int> data(1024, stream.view());
+  thrust::fill(rmm::exec_policy(stream.view()), data.begin(), data.end(), 0);
+
+  // capture an increment of every element
+  cudf::cuda_graph graph;
+  EXPECT_FALSE(graph.is_instantiated());
+  graph.begin_capture(stream.view());
+  EXPECT_TRUE(cudf::cuda_graph::is_capturing(stream.view()));
+  thrust::transform(rmm::exec_policy(stream.view()),
+                    data.begin(),
+                    data.end(),
+                    data.begin(),
+                    [] __device__(int v) { return v + 1; });
+  graph.end_capture(stream.view());
+  EXPECT_TRUE(graph.is_instantiated());
+  EXPECT_FALSE(cudf::cuda_graph::is_capturing(stream.view()));
+
+  // three replays should increment every element three times
+  graph.launch(stream.view());
+  graph.launch(stream.view());
+  graph.launch(stream.view());
+
+  EXPECT_EQ(data.element(0, stream.view()), 3);
+  EXPECT_EQ(data.element(1023, stream.view()), 3);
+}
+
+TEST_F(CudaGraphTest, LaunchWithoutCaptureFails)
+{
+  rmm::cuda_stream stream;
+  cudf::cuda_graph graph;
+  EXPECT_THROW(graph.launch(stream.view()), cudf::logic_error);
+}
+
+TEST_F(CudaGraphTest, MoveTransfersGraph)
+{
+  rmm::cuda_stream stream;
+  rmm::device_uvector<int> data(64, stream.view());
+  thrust::fill(rmm::exec_policy(stream.view()), data.begin(), data.end(), 7);
+
+  cudf::cuda_graph graph;
+  graph.begin_capture(stream.view());
+  thrust::fill(rmm::exec_policy(stream.view()), data.begin(), data.end(), 42);
+  graph.end_capture(stream.view());
+
+  cudf::cuda_graph moved = std::move(graph);
+  EXPECT_TRUE(moved.is_instantiated());
+  EXPECT_FALSE(graph.is_instantiated());
+
+  moved.launch(stream.view());
+  EXPECT_EQ(data.element(0, stream.view()), 42);
+}
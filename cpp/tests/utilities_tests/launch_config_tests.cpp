@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+
+#include <cudf/detail/utilities/launch_config.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+// Disable the on-disk profile so repeated test runs tune from scratch
+[[maybe_unused]] auto const disable_profile = setenv("LIBCUDF_KERNEL_CACHE_PATH", "", 1);
+}  // namespace
+
+// The registry is process-global, so each test uses a distinct kernel name.
+
+struct LaunchConfigTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(LaunchConfigTest, FallbackForUnknownKernel)
+{
+  auto const config =
+    cudf::detail::get_launch_config("launch_config_test_unknown", {512, 4});
+
+  EXPECT_EQ(config.block_size, 512);
+  EXPECT_EQ(config.items_per_thread, 4);
+}
+
+TEST_F(LaunchConfigTest, TunePicksACandidate)
+{
+  std::vector<cudf::detail::launch_config> const candidates{{128}, {256}, {512}};
+
+  int launches      = 0;
+  auto const winner = cudf::detail::tune_launch_config(
+    "launch_config_test_tune",
+    candidates,
+    [&launches](cudf::detail::launch_config const&) { ++launches; },
+    rmm::cuda_stream_default);
+
+  // one warm up plus the timed iterations per candidate
+  EXPECT_GE(launches, static_cast<int>(candidates.size()) * 2);
+  EXPECT_TRUE(std::any_of(candidates.begin(), candidates.end(), [&](auto const& c) {
+    return c.block_size == winner.block_size;
+  }));
+}
+
+TEST_F(LaunchConfigTest, TuneIsSticky)
+{
+  std::vector<cudf::detail::launch_config> const candidates{{128}, {256}};
+
+  auto const winner = cudf::detail::tune_launch_config(
+    "launch_config_test_sticky",
+    candidates,
+    [](cudf::detail::launch_config const&) {},
+    rmm::cuda_stream_default);
+
+  // later tunes and lookups return the recorded winner without re-benchmarking
+  int launches     = 0;
+  auto const again = cudf::detail::tune_launch_config(
+    "launch_config_test_sticky",
+    candidates,
+    [&launches](cudf::detail::launch_config const&) { ++launches; },
+    rmm::cuda_stream_default);
+  EXPECT_EQ(launches, 0);
+  EXPECT_EQ(again.block_size, winner.block_size);
+
+  auto const looked_up = cudf::detail::get_launch_config("launch_config_test_sticky", {1024});
+  EXPECT_EQ(looked_up.block_size, winner.block_size);
+}
+
+TEST_F(LaunchConfigTest, NoCandidatesThrows)
+{
+  EXPECT_THROW(cudf::detail::tune_launch_config(
+                 "launch_config_test_empty",
+                 {},
+                 [](cudf::detail::launch_config const&) {},
+                 rmm::cuda_stream_default),
+               cudf::logic_error);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/managed.hpp>
+
+struct ManagedTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ManagedTest, ManagedColumnRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4, 5}, {1, 1, 0, 1, 1});
+
+  auto const managed = cudf::make_managed_column(col);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(managed->view(), col);
+  EXPECT_NO_THROW(cudf::prefetch(managed->view()));
+}
+
+TEST_F(ManagedTest, ManagedTableThroughOperators)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> ints({10, 20, 30, 40, 50});
+  cudf::test::strings_column_wrapper strings({"a", "bb", "ccc", "dddd", "eeeee"});
+  cudf::table_view input({ints, strings});
+
+  auto const managed = cudf::make_managed_table(input);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(managed->view(), input);
+
+  // managed columns flow through operators unchanged; gather and filtering
+  // prefetch their inputs internally
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({4, 2, 0});
+  auto const gathered = cudf::gather(managed->view(), gather_map);
+  auto const expected = cudf::gather(input, gather_map);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(gathered->view(), expected->view());
+
+  cudf::test::fixed_width_column_wrapper<bool> mask({true, false, true, false, true});
+  auto const filtered = cudf::apply_boolean_mask(managed->view(), mask);
+  auto const expected_filtered = cudf::apply_boolean_mask(input, mask);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(filtered->view(), expected_filtered->view());
+}
+
+TEST_F(ManagedTest, PrefetchPlainMemoryIsNoop)
+{
+  cudf::test::fixed_width_column_wrapper<double> col({1.5, 2.5, 3.5});
+  cudf::test::strings_column_wrapper strings({"managed", "", "memory"});
+
+  EXPECT_NO_THROW(cudf::prefetch(col));
+  EXPECT_NO_THROW(cudf::prefetch(cudf::table_view({col, strings})));
+}
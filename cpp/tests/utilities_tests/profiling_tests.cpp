@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/profiling.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+struct ProfilingTest : public cudf::test::BaseFixture {
+  void TearDown() override
+  {
+    cudf::profiling::disable();
+    cudf::profiling::set_allocation_callback({});
+    cudf::profiling::reset();
+    cudf::test::BaseFixture::TearDown();
+  }
+};
+
+namespace {
+
+std::vector<cudf::profiling::operator_summary> summaries_named(std::string const& name)
+{
+  auto summaries = cudf::profiling::report();
+  summaries.erase(std::remove_if(summaries.begin(),
+                                 summaries.end(),
+                                 [&](auto const& s) { return s.name != name; }),
+                  summaries.end());
+  return summaries;
+}
+
+}  // namespace
+
+TEST_F(ProfilingTest, DisabledRecordsNothing)
+{
+  cudf::profiling::reset();
+  EXPECT_FALSE(cudf::profiling::is_enabled());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{5, 3, 4, 1, 2};
+  cudf::sort(cudf::table_view{{col}});
+
+  EXPECT_TRUE(cudf::profiling::report().empty());
+}
+
+TEST_F(ProfilingTest, RecordsInstrumentedCalls)
+{
+  cudf::profiling::reset();
+  cudf::profiling::enable();
+  EXPECT_TRUE(cudf::profiling::is_enabled());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{5, 3, 4, 1, 2};
+  cudf::sort(cudf::table_view{{col}});
+  cudf::sort(cudf::table_view{{col}});
+  cudf::profiling::disable();
+
+  auto const summaries = summaries_named("sort");
+  ASSERT_EQ(summaries.size(), 1);
+  EXPECT_EQ(summaries.front().num_calls, 2);
+  EXPECT_EQ(summaries.front().data_volume, 10);  // 5 rows per call
+  EXPECT_GT(summaries.front().wall_time.count(), 0);
+  EXPECT_GT(summaries.front().peak_memory, 0);
+}
+
+TEST_F(ProfilingTest, ExplicitScope)
+{
+  cudf::profiling::reset();
+  cudf::profiling::enable();
+  {
+    cudf::profiling::scope const my_scope{"my_operator", 1024};
+  }
+  cudf::profiling::disable();
+
+  auto const summaries = summaries_named("my_operator");
+  ASSERT_EQ(summaries.size(), 1);
+  EXPECT_EQ(summaries.front().num_calls, 1);
+  EXPECT_EQ(summaries.front().data_volume, 1024);
+}
+
+TEST_F(ProfilingTest, MemoryReportAttributesAllocations)
+{
+  cudf::profiling::reset();
+  cudf::profiling::enable();
+
+  auto* mr = rmm::mr::get_current_device_resource();
+  {
+    cudf::profiling::scope const my_scope{"my_operator"};
+    auto* ptr = mr->allocate(1024);
+    mr->deallocate(ptr, 1024);
+  }
+  cudf::profiling::disable();
+
+  auto summaries = cudf::profiling::memory_report();
+  auto const it  = std::find_if(summaries.begin(), summaries.end(), [](auto const& s) {
+    return s.name == "my_operator";
+  });
+  ASSERT_NE(it, summaries.end());
+  EXPECT_EQ(it->num_allocations, 1);
+  EXPECT_EQ(it->allocated_bytes, 1024);
+  EXPECT_EQ(it->peak_bytes, 1024);
+  EXPECT_GT(it->total_lifetime.count(), 0);
+}
+
+TEST_F(ProfilingTest, AllocationCallback)
+{
+  cudf::profiling::reset();
+
+  std::size_t num_events  = 0;
+  std::size_t event_bytes = 0;
+  std::string last_name;
+  cudf::profiling::set_allocation_callback([&](cudf::profiling::allocation_event const& event) {
+    num_events += 1;
+    event_bytes += event.bytes;
+    last_name = event.name;
+  });
+
+  cudf::profiling::enable();
+  auto* mr = rmm::mr::get_current_device_resource();
+  {
+    cudf::profiling::scope const my_scope{"my_operator"};
+    auto* ptr = mr->allocate(512);
+    mr->deallocate(ptr, 512);
+  }
+  cudf::profiling::disable();
+  cudf::profiling::set_allocation_callback({});
+
+  EXPECT_EQ(num_events, 2);         // one allocation, one deallocation
+  EXPECT_EQ(event_bytes, 2 * 512);  // both events carry the allocation size
+  EXPECT_EQ(last_name, "my_operator");
+}
+
+TEST_F(ProfilingTest, ResetClearsReport)
+{
+  cudf::profiling::reset();
+  cudf::profiling::enable();
+  {
+    cudf::profiling::scope const my_scope{"my_operator"};
+  }
+  cudf::profiling::disable();
+
+  EXPECT_FALSE(cudf::profiling::report().empty());
+  cudf::profiling::reset();
+  EXPECT_TRUE(cudf::profiling::report().empty());
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/stream_pool.hpp>
+
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <set>
+
+TEST(StreamPoolTest, RoundRobin)
+{
+  cudf::stream_pool pool(4);
+  EXPECT_EQ(std::size_t{4}, pool.size());
+
+  std::set<cudaStream_t> streams;
+  for (std::size_t i = 0; i < pool.size(); ++i) {
+    auto const stream = pool.get_stream();
+    EXPECT_FALSE(stream.is_default());
+    streams.insert(stream.value());
+  }
+  // all streams are distinct until the pool wraps around
+  EXPECT_EQ(pool.size(), streams.size());
+  EXPECT_TRUE(streams.count(pool.get_stream().value()));
+
+  pool.synchronize();
+}
+
+TEST(StreamPoolTest, Errors) { EXPECT_THROW(cudf::stream_pool(0), cudf::logic_error); }
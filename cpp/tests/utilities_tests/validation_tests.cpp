@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/utilities/validation.hpp>
+
+struct ValidationLevelTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ValidationLevelTest, DefaultIsFull)
+{
+  EXPECT_EQ(cudf::get_validation_level(), cudf::validation_level::FULL);
+  EXPECT_TRUE(cudf::full_validation_enabled());
+}
+
+TEST_F(ValidationLevelTest, ScopeSetsAndRestores)
+{
+  {
+    cudf::validation_scope trusted{cudf::validation_level::MINIMAL};
+    EXPECT_EQ(cudf::get_validation_level(), cudf::validation_level::MINIMAL);
+    EXPECT_FALSE(cudf::full_validation_enabled());
+    {
+      cudf::validation_scope inner{cudf::validation_level::FULL};
+      EXPECT_TRUE(cudf::full_validation_enabled());
+    }
+    EXPECT_FALSE(cudf::full_validation_enabled());
+  }
+  EXPECT_EQ(cudf::get_validation_level(), cudf::validation_level::FULL);
+}
+
+TEST_F(ValidationLevelTest, MinimalSkipsDeviceChecks)
+{
+  // an offsets column with nulls violates a device-checked invariant
+  auto make_bad_offsets = [] {
+    return cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, 2}, {1, 0, 1}).release();
+  };
+  auto child = cudf::test::fixed_width_column_wrapper<int32_t>({7, 8}).release();
+
+  EXPECT_THROW(cudf::make_lists_column(2,
+                                       make_bad_offsets(),
+                                       std::move(child),
+                                       0,
+                                       rmm::device_buffer{}),
+               cudf::logic_error);
+
+  cudf::validation_scope trusted{cudf::validation_level::MINIMAL};
+  auto trusted_child = cudf::test::fixed_width_column_wrapper<int32_t>({7, 8}).release();
+  EXPECT_NO_THROW(cudf::make_lists_column(
+    2, make_bad_offsets(), std::move(trusted_child), 0, rmm::device_buffer{}));
+}